@@ -25,6 +25,13 @@ extern int jack_dirty;
 extern pthread_mutex_t registration_callback_lock;
 extern pthread_mutex_t shutdown_callback_lock;
 extern int jack_success;
+extern int jack_batch;
+
+// Connections queued in a connection transaction, reported after the commit.
+static char** batch_src = NULL;
+static char** batch_dest = NULL;
+static int batch_n = 0;
+static int batch_size = 0;
 
 
 void jack_port_registration (jack_port_id_t port, int reg, void *arg) {
@@ -82,6 +89,81 @@ void jack_initialize( jack_client_t** jackc, int callbacks_on )
     return;
 }
 
+static void jack_report_connection( const char* src_port, const char* dest_port, int err )
+{
+    if(verbose){
+        if (err == 0) {
+            fprintf(stdout, "Connecting port '%s' with '%s'\n", src_port, dest_port);
+        } 
+        else if (!daemon_running) {
+            if (err == EEXIST) {
+                fprintf(stdout, "Port '%s' is already connected to '%s'\n", src_port, dest_port);
+            } 
+            else {
+                fprintf(stdout, "Failed to connect port '%s' to '%s'!\n", src_port, dest_port);
+                jack_success = 0;
+            }
+        }
+    }
+}
+
+static void jack_batch_add( const char* src_port, const char* dest_port )
+{
+    if (batch_n == batch_size) { // Grow the arrays when needed
+        batch_size *= 2;
+        batch_src = realloc(batch_src, batch_size * sizeof(char*));
+        batch_dest = realloc(batch_dest, batch_size * sizeof(char*));
+    }
+    batch_src[batch_n] = strdup(src_port);
+    batch_dest[batch_n] = strdup(dest_port);
+    batch_n++;
+}
+
+static int jack_batch_begin( jack_client_t** jackc )
+{
+    int err = -1;
+
+    pthread_mutex_lock( &shutdown_callback_lock );
+    if (*jackc != NULL) {
+        err = jack_connection_transaction_begin(*jackc);
+    }
+    pthread_mutex_unlock( &shutdown_callback_lock );
+
+    if (err == 0) {
+        batch_size = 64;
+        batch_n = 0;
+        batch_src = malloc(batch_size * sizeof(char*));
+        batch_dest = malloc(batch_size * sizeof(char*));
+    }
+    return err;
+}
+
+static void jack_batch_commit( jack_client_t** jackc )
+{
+    int i;
+    int* results = malloc((batch_n + 1) * sizeof(int));
+
+    pthread_mutex_lock( &shutdown_callback_lock );
+    if (*jackc == NULL || jack_connection_transaction_commit(*jackc, results) < 0) {
+        for (i = 0; i < batch_n; i++) results[i] = ENOENT;
+    }
+    pthread_mutex_unlock( &shutdown_callback_lock );
+
+    for (i = 0; i < batch_n; i++) {
+        jack_report_connection(batch_src[i], batch_dest[i], results[i]);
+        free(batch_src[i]);
+        free(batch_dest[i]);
+    }
+
+    free(results);
+    free(batch_src);
+    free(batch_dest);
+    batch_src = NULL;
+    batch_dest = NULL;
+    batch_n = 0;
+    batch_size = 0;
+}
+
 void jack_restore_connections( jack_client_t** jackc, const char* client_name, const char* port_name, mxml_node_t* port_node )
 {
     mxml_node_t* connection_node;
@@ -112,19 +194,11 @@ void jack_restore_connections( jack_client_t** jackc, const char* client_name, c
             }
             pthread_mutex_unlock( &shutdown_callback_lock );
 
-            if(verbose){
-                if (err == 0) {
-                    fprintf(stdout, "Connecting port '%s' with '%s'\n", src_port, dest_port);
-                } 
-                else if (!daemon_running) {
-                    if (err == EEXIST) {
-                        fprintf(stdout, "Port '%s' is already connected to '%s'\n", src_port, dest_port);
-                    } 
-                    else {
-                        fprintf(stdout, "Failed to connect port '%s' to '%s'!\n", src_port, dest_port);
-                        jack_success = 0;
-                    }
-                }
+            if (err == 0 && batch_size > 0) {
+                jack_batch_add(src_port, dest_port);
+            }
+            else {
+                jack_report_connection(src_port, dest_port, err);
             }
         }
         else if(verbose && !daemon_running){
@@ -173,7 +247,15 @@ void jack_restore( jack_client_t** jackc, mxml_node_t* root_node )
    
     mxml_node_t* jack_node;
     jack_node = mxmlFindElement(root_node, root_node, "jack", NULL, NULL, MXML_DESCEND_FIRST);
-    jack_restore_clients(jackc, jack_node);
+
+    if (jack_batch && jack_batch_begin(jackc) == 0) {
+        // Connections are queued, and applied all at once by the server on commit.
+        jack_restore_clients(jackc, jack_node);
+        jack_batch_commit(jackc);
+    }
+    else {
+        jack_restore_clients(jackc, jack_node);
+    }
 }
 
 void jack_store_connections( jack_client_t* jackc, const char* port_name, mxml_node_t* port_node )
@@ -42,6 +42,7 @@ static void usage(void)
     fprintf(stdout, "  -q,--quiet    Be quiet about what happens when storing/restoring connections.       \n");
     fprintf(stdout, "  -x,--remove   With 'file': remove all ALSA and/or JACK connections before restoring.\n");
     fprintf(stdout, "  -x,--remove   Without 'file': only remove ALSA and/or JACK connections.             \n");
+    fprintf(stdout, "  -b,--batch    Restore all JACK connections at once, in a single graph change.       \n");
     fprintf(stdout, "                                                                                      \n");
 } 
 
@@ -64,6 +65,7 @@ static const struct option long_option[] = {
     {"ignore", 1, NULL, 'i'},
     {"quiet", 0, NULL, 'q'},
     {"poll", 1, NULL, 'p'},
+    {"batch", 0, NULL, 'b'},
     {NULL, 0, NULL, 0}
 };
 
@@ -79,6 +81,7 @@ int ic_n = 0; // number of ignored clients.
 char *ignored_clients[IGNORED_CLIENTS_MAX]; // array to store names of ignored clients
 int alsa_success = 1; 
 int jack_success = 1; 
+int jack_batch = 0; // restore JACK connections in one connection transaction
 
 pthread_mutex_t registration_callback_lock = PTHREAD_MUTEX_INITIALIZER;
 pthread_mutex_t shutdown_callback_lock = PTHREAD_MUTEX_INITIALIZER;
@@ -127,7 +130,7 @@ int main(int argc, char **argv)
     int npfds = 0;
     int alsa_dirty = 1;
 
-    while ((c = getopt_long(argc, argv, "ajrdxfi:p:qh", long_option, NULL)) != -1) {
+    while ((c = getopt_long(argc, argv, "ajrdxfi:p:qbh", long_option, NULL)) != -1) {
 
         switch (c){
 
@@ -163,6 +166,9 @@ int main(int argc, char **argv)
         case 'q':
             verbose = 0;
             break;
+        case 'b':
+            jack_batch = 1;
+            break;
         case 'h':
             usage();
             return 1;
@@ -175,6 +175,9 @@ extern "C"
                                 const char* source_port,
                                 const char* destination_port);
     LIB_EXPORT int jack_port_disconnect(jack_client_t *, jack_port_t *);
+    LIB_EXPORT int jack_connection_transaction_begin(jack_client_t *);
+    LIB_EXPORT int jack_connection_transaction_commit(jack_client_t *, int* results);
+    LIB_EXPORT int jack_connection_transaction_abort(jack_client_t *);
     LIB_EXPORT int jack_port_name_size(void);
     LIB_EXPORT int jack_port_type_size(void);
     LIB_EXPORT size_t jack_port_type_get_buffer_size(jack_client_t *client, const char* port_type);
@@ -684,7 +687,7 @@ LIB_EXPORT int jack_port_set_alias(jack_port_t* port, const char* name)
         return -1;
     } else {
         JackGraphManager* manager = GetGraphManager();
-        return (manager ? manager->GetPort(myport)->SetAlias(name) : -1);
+        return (manager ? manager->SetPortAlias(myport, name) : -1);
     }
 }
 
@@ -702,7 +705,7 @@ LIB_EXPORT int jack_port_unset_alias(jack_port_t* port, const char* name)
         return -1;
     } else {
         JackGraphManager* manager = GetGraphManager();
-        return (manager ? manager->GetPort(myport)->UnsetAlias(name) : -1);
+        return (manager ? manager->UnsetPortAlias(myport, name) : -1);
     }
 }
 
@@ -1258,6 +1261,45 @@ LIB_EXPORT int jack_port_disconnect(jack_client_t* ext_client, jack_port_t* src)
     return client->PortDisconnect(myport);
 }
 
+LIB_EXPORT int jack_connection_transaction_begin(jack_client_t* ext_client)
+{
+    JackGlobals::CheckContext("jack_connection_transaction_begin");
+
+    JackClient* client = (JackClient*)ext_client;
+    if (client == NULL) {
+        jack_error("jack_connection_transaction_begin called with a NULL client");
+        return -1;
+    } else {
+        return client->ConnectionTransactionBegin();
+    }
+}
+
+LIB_EXPORT int jack_connection_transaction_commit(jack_client_t* ext_client, int* results)
+{
+    JackGlobals::CheckContext("jack_connection_transaction_commit");
+
+    JackClient* client = (JackClient*)ext_client;
+    if (client == NULL) {
+        jack_error("jack_connection_transaction_commit called with a NULL client");
+        return -1;
+    } else {
+        return client->ConnectionTransactionCommit(results);
+    }
+}
+
+LIB_EXPORT int jack_connection_transaction_abort(jack_client_t* ext_client)
+{
+    JackGlobals::CheckContext("jack_connection_transaction_abort");
+
+    JackClient* client = (JackClient*)ext_client;
+    if (client == NULL) {
+        jack_error("jack_connection_transaction_abort called with a NULL client");
+        return -1;
+    } else {
+        return client->ConnectionTransactionAbort();
+    }
+}
+
 LIB_EXPORT jack_nframes_t jack_get_sample_rate(jack_client_t* ext_client)
 {
     JackGlobals::CheckContext("jack_get_sample_rate");
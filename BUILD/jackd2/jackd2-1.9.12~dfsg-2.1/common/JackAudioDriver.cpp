@@ -113,7 +113,6 @@ void JackAudioDriver::UpdateLatencies()
 
 int JackAudioDriver::Attach()
 {
-    JackPort* port;
     jack_port_id_t port_index;
     char name[REAL_JACK_PORT_NAME_SIZE+1];
     char alias[REAL_JACK_PORT_NAME_SIZE+1];
@@ -128,8 +127,7 @@ int JackAudioDriver::Attach()
             jack_error("driver: cannot register port for %s", name);
             return -1;
         }
-        port = fGraphManager->GetPort(port_index);
-        port->SetAlias(alias);
+        fGraphManager->SetPortAlias(port_index, alias);
         fCapturePortList[i] = port_index;
         jack_log("JackAudioDriver::Attach fCapturePortList[i] port_index = %ld", port_index);
     }
@@ -141,8 +139,7 @@ int JackAudioDriver::Attach()
             jack_error("driver: cannot register port for %s", name);
             return -1;
         }
-        port = fGraphManager->GetPort(port_index);
-        port->SetAlias(alias);
+        fGraphManager->SetPortAlias(port_index, alias);
         fPlaybackPortList[i] = port_index;
         jack_log("JackAudioDriver::Attach fPlaybackPortList[i] port_index = %ld", port_index);
 
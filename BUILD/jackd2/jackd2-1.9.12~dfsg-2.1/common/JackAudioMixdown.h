@@ -0,0 +1,307 @@
+/*
+Copyright (C) 2001-2003 Paul Davis
+Copyright (C) 2004-2008 Grame
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 2.1 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+*/
+
+#ifndef __JackAudioMixdown__
+#define __JackAudioMixdown__
+
+#include "types.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (__APPLE__)
+#include <Accelerate/Accelerate.h>
+#elif defined (__SSE__) && !defined (__sun__)
+#include <xmmintrin.h>
+#elif defined (__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#if !defined (__APPLE__) && defined (__SSE2__) && !defined (__sun__) && defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+#define JACK_MIXDOWN_DISPATCH
+#include <immintrin.h>
+#endif
+
+/*
+Kept in a header so that example-clients/simdtests.cpp can compare the variants.
+*/
+
+#define MIXDOWN_GENERIC 0   // Copy first buffer then add the others, SSE/NEON when enabled at compile time
+#define MIXDOWN_AVX2    1
+#define MIXDOWN_AVX512  2
+
+namespace Jack
+{
+
+static inline void MixAudioBuffer(jack_default_audio_sample_t* mixbuffer, jack_default_audio_sample_t* buffer, jack_nframes_t frames)
+{
+#ifdef __APPLE__
+    vDSP_vadd(buffer, 1, mixbuffer, 1, mixbuffer, 1, frames);
+#else
+    jack_nframes_t frames_group = frames / 4;
+    frames = frames % 4;
+
+    while (frames_group > 0) {
+    #if defined (__SSE__) && !defined (__sun__)
+        __m128 vec = _mm_add_ps(_mm_load_ps(mixbuffer), _mm_load_ps(buffer));
+        _mm_store_ps(mixbuffer, vec);
+
+        mixbuffer += 4;
+        buffer += 4;
+        frames_group--;
+    #elif defined (__ARM_NEON__)
+        float32x4_t vec = vaddq_f32(vld1q_f32(mixbuffer), vld1q_f32(buffer));
+        vst1q_f32(mixbuffer, vec);
+
+        mixbuffer += 4;
+        buffer += 4;
+        frames_group--;
+    #else
+        register jack_default_audio_sample_t mixFloat1 = *mixbuffer;
+        register jack_default_audio_sample_t sourceFloat1 = *buffer;
+        register jack_default_audio_sample_t mixFloat2 = *(mixbuffer + 1);
+        register jack_default_audio_sample_t sourceFloat2 = *(buffer + 1);
+        register jack_default_audio_sample_t mixFloat3 = *(mixbuffer + 2);
+        register jack_default_audio_sample_t sourceFloat3 = *(buffer + 2);
+        register jack_default_audio_sample_t mixFloat4 = *(mixbuffer + 3);
+        register jack_default_audio_sample_t sourceFloat4 = *(buffer + 3);
+
+        buffer += 4;
+        frames_group--;
+
+        mixFloat1 += sourceFloat1;
+        mixFloat2 += sourceFloat2;
+        mixFloat3 += sourceFloat3;
+        mixFloat4 += sourceFloat4;
+
+        *mixbuffer = mixFloat1;
+        *(mixbuffer + 1) = mixFloat2;
+        *(mixbuffer + 2) = mixFloat3;
+        *(mixbuffer + 3) = mixFloat4;
+
+        mixbuffer += 4;
+    #endif
+    }
+
+    while (frames > 0) {
+        register jack_default_audio_sample_t mixFloat1 = *mixbuffer;
+        register jack_default_audio_sample_t sourceFloat1 = *buffer;
+        buffer++;
+        frames--;
+        mixFloat1 += sourceFloat1;
+        *mixbuffer = mixFloat1;
+        mixbuffer++;
+    }
+#endif
+}
+
+static inline void AudioBufferMixdownGeneric(jack_default_audio_sample_t* mixbuffer, jack_default_audio_sample_t** src_buffers, int src_count, jack_nframes_t nframes)
+{
+    // Copy first buffer
+#if defined (__SSE__) && !defined (__sun__)
+    jack_nframes_t frames_group = nframes / 4;
+    jack_nframes_t remaining_frames = nframes % 4;
+
+    jack_default_audio_sample_t* source = src_buffers[0];
+    jack_default_audio_sample_t* target = mixbuffer;
+
+    while (frames_group > 0) {
+        __m128 vec = _mm_load_ps(source);
+        _mm_store_ps(target, vec);
+        source += 4;
+        target += 4;
+        --frames_group;
+    }
+
+    for (jack_nframes_t i = 0; i != remaining_frames; ++i) {
+        target[i] = source[i];
+    }
+#elif defined (__ARM_NEON__)
+    jack_nframes_t frames_group = nframes / 4;
+    jack_nframes_t remaining_frames = nframes % 4;
+
+    jack_default_audio_sample_t* source = src_buffers[0];
+    jack_default_audio_sample_t* target = mixbuffer;
+
+    while (frames_group > 0) {
+        float32x4_t vec = vld1q_f32(source);
+        vst1q_f32(target, vec);
+        source += 4;
+        target += 4;
+        --frames_group;
+    }
+
+    for (jack_nframes_t i = 0; i != remaining_frames; ++i) {
+        target[i] = source[i];
+    }
+#else
+    memcpy(mixbuffer, src_buffers[0], nframes * sizeof(jack_default_audio_sample_t));
+#endif
+
+    // Mix remaining buffers
+    for (int i = 1; i < src_count; ++i) {
+        MixAudioBuffer(mixbuffer, src_buffers[i], nframes);
+    }
+}
+
+#ifdef JACK_MIXDOWN_DISPATCH
+
+/*
+The AVX variants sum all sources in registers, block by block, so the mix buffer is only written once.
+Sources are added in the same order as in the generic version, the results are identical.
+*/
+
+__attribute__((target("avx2")))
+static void AudioBufferMixdownAVX2(jack_default_audio_sample_t* mixbuffer, jack_default_audio_sample_t** src_buffers, int src_count, jack_nframes_t nframes)
+{
+    jack_nframes_t frame = 0;
+
+    for (; frame + 32 <= nframes; frame += 32) {
+        const jack_default_audio_sample_t* source = src_buffers[0] + frame;
+        __m256 sum1 = _mm256_loadu_ps(source);
+        __m256 sum2 = _mm256_loadu_ps(source + 8);
+        __m256 sum3 = _mm256_loadu_ps(source + 16);
+        __m256 sum4 = _mm256_loadu_ps(source + 24);
+        for (int i = 1; i < src_count; ++i) {
+            source = src_buffers[i] + frame;
+            sum1 = _mm256_add_ps(sum1, _mm256_loadu_ps(source));
+            sum2 = _mm256_add_ps(sum2, _mm256_loadu_ps(source + 8));
+            sum3 = _mm256_add_ps(sum3, _mm256_loadu_ps(source + 16));
+            sum4 = _mm256_add_ps(sum4, _mm256_loadu_ps(source + 24));
+        }
+        _mm256_storeu_ps(mixbuffer + frame, sum1);
+        _mm256_storeu_ps(mixbuffer + frame + 8, sum2);
+        _mm256_storeu_ps(mixbuffer + frame + 16, sum3);
+        _mm256_storeu_ps(mixbuffer + frame + 24, sum4);
+    }
+
+    for (; frame + 8 <= nframes; frame += 8) {
+        __m256 sum = _mm256_loadu_ps(src_buffers[0] + frame);
+        for (int i = 1; i < src_count; ++i) {
+            sum = _mm256_add_ps(sum, _mm256_loadu_ps(src_buffers[i] + frame));
+        }
+        _mm256_storeu_ps(mixbuffer + frame, sum);
+    }
+
+    for (; frame < nframes; ++frame) {
+        jack_default_audio_sample_t sum = src_buffers[0][frame];
+        for (int i = 1; i < src_count; ++i) {
+            sum += src_buffers[i][frame];
+        }
+        mixbuffer[frame] = sum;
+    }
+}
+
+__attribute__((target("avx512f")))
+static void AudioBufferMixdownAVX512(jack_default_audio_sample_t* mixbuffer, jack_default_audio_sample_t** src_buffers, int src_count, jack_nframes_t nframes)
+{
+    jack_nframes_t frame = 0;
+
+    for (; frame + 64 <= nframes; frame += 64) {
+        const jack_default_audio_sample_t* source = src_buffers[0] + frame;
+        __m512 sum1 = _mm512_loadu_ps(source);
+        __m512 sum2 = _mm512_loadu_ps(source + 16);
+        __m512 sum3 = _mm512_loadu_ps(source + 32);
+        __m512 sum4 = _mm512_loadu_ps(source + 48);
+        for (int i = 1; i < src_count; ++i) {
+            source = src_buffers[i] + frame;
+            sum1 = _mm512_add_ps(sum1, _mm512_loadu_ps(source));
+            sum2 = _mm512_add_ps(sum2, _mm512_loadu_ps(source + 16));
+            sum3 = _mm512_add_ps(sum3, _mm512_loadu_ps(source + 32));
+            sum4 = _mm512_add_ps(sum4, _mm512_loadu_ps(source + 48));
+        }
+        _mm512_storeu_ps(mixbuffer + frame, sum1);
+        _mm512_storeu_ps(mixbuffer + frame + 16, sum2);
+        _mm512_storeu_ps(mixbuffer + frame + 32, sum3);
+        _mm512_storeu_ps(mixbuffer + frame + 48, sum4);
+    }
+
+    for (; frame + 16 <= nframes; frame += 16) {
+        __m512 sum = _mm512_loadu_ps(src_buffers[0] + frame);
+        for (int i = 1; i < src_count; ++i) {
+            sum = _mm512_add_ps(sum, _mm512_loadu_ps(src_buffers[i] + frame));
+        }
+        _mm512_storeu_ps(mixbuffer + frame, sum);
+    }
+
+    // Remaining frames use a mask instead of a scalar loop
+    if (frame < nframes) {
+        __mmask16 mask = (__mmask16)((1 << (nframes - frame)) - 1);
+        __m512 sum = _mm512_maskz_loadu_ps(mask, src_buffers[0] + frame);
+        for (int i = 1; i < src_count; ++i) {
+            sum = _mm512_add_ps(sum, _mm512_maskz_loadu_ps(mask, src_buffers[i] + frame));
+        }
+        _mm512_mask_storeu_ps(mixbuffer + frame, mask, sum);
+    }
+}
+
+#endif
+
+/*
+Detected once, JACK_SIMD_LEVEL ("sse", "avx2" or "avx512") lowers the level like for the driver sample conversions.
+*/
+
+static inline int DetectMixdownLevel()
+{
+    int level = MIXDOWN_GENERIC;
+#ifdef JACK_MIXDOWN_DISPATCH
+    const char* max_level = getenv("JACK_SIMD_LEVEL");
+
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        level = MIXDOWN_AVX2;
+        if (__builtin_cpu_supports("avx512f")) {
+            level = MIXDOWN_AVX512;
+        }
+    }
+
+    if (max_level) {
+        if (strcmp(max_level, "avx2") == 0) {
+            if (level > MIXDOWN_AVX2) {
+                level = MIXDOWN_AVX2;
+            }
+        } else if (strcmp(max_level, "avx512") != 0) {
+            level = MIXDOWN_GENERIC;
+        }
+    }
+#endif
+    return level;
+}
+
+static inline void AudioBufferMixdownLevel(int level, jack_default_audio_sample_t* mixbuffer, jack_default_audio_sample_t** src_buffers, int src_count, jack_nframes_t nframes)
+{
+    switch (level) {
+#ifdef JACK_MIXDOWN_DISPATCH
+        case MIXDOWN_AVX512:
+            AudioBufferMixdownAVX512(mixbuffer, src_buffers, src_count, nframes);
+            break;
+        case MIXDOWN_AVX2:
+            AudioBufferMixdownAVX2(mixbuffer, src_buffers, src_count, nframes);
+            break;
+#endif
+        default:
+            AudioBufferMixdownGeneric(mixbuffer, src_buffers, src_count, nframes);
+            break;
+    }
+}
+
+} // namespace Jack
+
+#endif
@@ -22,6 +22,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 
 #include "types.h"
 #include "JackSession.h"
+#include <list>
 
 namespace Jack
 {
@@ -31,6 +32,7 @@ class JackClient;
 class JackServer;
 struct JackEngineControl;
 class JackGraphManager;
+struct JackConnectionOp;
 
 namespace detail
 {
@@ -149,6 +151,8 @@ class JackClientChannelInterface
         {}
         virtual void PortDisconnect(int refnum, jack_port_id_t src, jack_port_id_t dst, int* result)
         {}
+        virtual void PortConnectionTransaction(int refnum, std::list<JackConnectionOp>& ops, int* result)
+        {}
         virtual void PortRename(int refnum, jack_port_id_t port, const char* name, int* result)
         {}
 
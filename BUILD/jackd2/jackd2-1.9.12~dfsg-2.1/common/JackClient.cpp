@@ -79,6 +79,8 @@ JackClient::JackClient(JackSynchro* table):fThread(this)
     fLatencyArg = NULL;
 
     fSessionReply = kPendingSessionReply;
+    fPlacementSerial = 0;
+    fConnectionTransaction = false;
 }
 
 JackClient::~JackClient()
@@ -245,7 +247,7 @@ int JackClient::ClientNotify(int refnum, const char* name, int notify, int sync,
                 }
                 // Acquire RT only when the RT thread is actually running
                 if (GetEngineControl()->fRealTime && fThread.GetStatus() == JackThread::kRunning) {
-                    if (fThread.AcquireRealTime(GetEngineControl()->fClientPriority) < 0) {
+                    if (fThread.AcquireRealTime(GetRealTimePriority()) < 0) {
                         jack_error("JackClient::AcquireRealTime error");
                     }
                 }
@@ -319,6 +321,11 @@ int JackClient::ClientNotify(int refnum, const char* name, int notify, int sync,
             case kLatencyCallback:
                 res = HandleLatencyCallback(value1);
                 break;
+
+            case kPlacementCallback:
+                jack_log("JackClient::kPlacementCallback");
+                ApplyPlacement();
+                break;
         }
     }
 
@@ -479,6 +486,7 @@ int JackClient::Deactivate()
     // RT thread is stopped only when needed...
     if (IsRealTime()) {
         fThread.Kill();
+        fPlacementSerial = -1;  // A restarted RT thread needs the placement again
     }
     return result;
 }
@@ -539,11 +547,43 @@ void JackClient::SetupRealTime()
     // Will do "something" on OSX only...
     fThread.SetParams(GetEngineControl()->fPeriod, GetEngineControl()->fComputation, GetEngineControl()->fConstraint);
 
-    if (fThread.AcquireSelfRealTime(GetEngineControl()->fClientPriority) < 0) {
+    if (fThread.AcquireSelfRealTime(GetRealTimePriority()) < 0) {
         jack_error("JackClient::AcquireSelfRealTime error");
     }
 }
 
+/*!
+\brief Client RT priority, including the offset possibly given by the server placement.
+*/
+int JackClient::GetRealTimePriority()
+{
+    int priority = GetEngineControl()->fClientPriority + GetClientControl()->fPlacementPriority;
+    if (priority > GetEngineControl()->fMaxClientPriority) {
+        priority = GetEngineControl()->fMaxClientPriority;
+    }
+    return (priority < 1) ? 1 : priority;
+}
+
+/*!
+\brief Apply a new CPU/priority placement decided by the server to the RT thread, called in the notification thread.
+*/
+void JackClient::ApplyPlacement()
+{
+    JackClientControl* control = GetClientControl();
+    int serial = control->fPlacementSerial;
+
+    if (serial != fPlacementSerial && fThread.GetStatus() != JackThread::kIdle) {
+        fPlacementSerial = serial;
+        jack_log("JackClient::ApplyPlacement name = %s cpu = %d priority offset = %d", control->fName, control->fPlacementCPU, control->fPlacementPriority);
+        if (fThread.AcquireAffinity(control->fPlacementCPU) < 0) {
+            jack_error("JackClient::AcquireAffinity error");
+        }
+        if (GetEngineControl()->fRealTime && fThread.AcquireRealTime(GetRealTimePriority()) < 0) {
+            jack_error("JackClient::AcquireRealTime error");
+        }
+    }
+}
+
 int JackClient::StartThread()
 {
     if (fThread.StartSync() < 0) {
@@ -623,7 +663,7 @@ inline int JackClient::CallProcessCallback()
 inline bool JackClient::WaitSync()
 {
     // Suspend itself: wait on the input synchro
-    if (GetGraphManager()->SuspendRefNum(GetClientControl(), fSynchroTable, 0x7FFFFFFF) < 0) {
+    if (GetGraphManager()->SuspendRefNum(GetClientControl(), fSynchroTable, 0x7FFFFFFF, GetEngineControl()) < 0) {
         jack_error("SuspendRefNum error");
         return false;
     } else {
@@ -726,6 +766,9 @@ int JackClient::PortConnect(const char* src, const char* dst)
         jack_error("\"%s\" is too long to be used as a JACK port name.\n", src);
         return -1; 
     }
+    if (fConnectionTransaction) {
+        return QueueConnection(true, src, dst);
+    }
     int result = -1;
     fChannel->PortConnect(GetClientControl()->fRefNum, src, dst, &result);
     return result;
@@ -742,6 +785,9 @@ int JackClient::PortDisconnect(const char* src, const char* dst)
         jack_error("\"%s\" is too long to be used as a JACK port name.\n", src);
         return -1; 
     }
+    if (fConnectionTransaction) {
+        return QueueConnection(false, src, dst);
+    }
     int result = -1;
     fChannel->PortDisconnect(GetClientControl()->fRefNum, src, dst, &result);
     return result;
@@ -755,6 +801,63 @@ int JackClient::PortDisconnect(jack_port_id_t src)
     return result;
 }
 
+int JackClient::QueueConnection(bool connect, const char* src, const char* dst)
+{
+    if (fConnectionOps.size() >= CONNECTION_TRANSACTION_NUM) {
+        jack_error("Too many operations in connection transaction (max %d)", CONNECTION_TRANSACTION_NUM);
+        return -1;
+    }
+    fConnectionOps.push_back(JackConnectionOp(connect, src, dst));
+    return 0;
+}
+
+int JackClient::ConnectionTransactionBegin()
+{
+    jack_log("JackClient::ConnectionTransactionBegin");
+    if (fConnectionTransaction) {
+        jack_error("A connection transaction is already started");
+        return -1;
+    }
+    fConnectionOps.clear();
+    fConnectionTransaction = true;
+    return 0;
+}
+
+int JackClient::ConnectionTransactionCommit(int* results)
+{
+    if (!fConnectionTransaction) {
+        jack_error("No connection transaction to commit");
+        return -1;
+    }
+    jack_log("JackClient::ConnectionTransactionCommit count = %ld", fConnectionOps.size());
+    fConnectionTransaction = false;
+
+    int result = 0;
+    if (fConnectionOps.size() > 0) {
+        fChannel->PortConnectionTransaction(GetClientControl()->fRefNum, fConnectionOps, &result);
+    }
+    if (results) {
+        int i = 0;
+        for (std::list<JackConnectionOp>::iterator it = fConnectionOps.begin(); it != fConnectionOps.end(); it++) {
+            results[i++] = it->fResult;
+        }
+    }
+    fConnectionOps.clear();
+    return result;
+}
+
+int JackClient::ConnectionTransactionAbort()
+{
+    jack_log("JackClient::ConnectionTransactionAbort");
+    if (!fConnectionTransaction) {
+        jack_error("No connection transaction to abort");
+        return -1;
+    }
+    fConnectionTransaction = false;
+    fConnectionOps.clear();
+    return 0;
+}
+
 int JackClient::PortIsMine(jack_port_id_t port_index)
 {
     JackPort* port = GetGraphManager()->GetPort(port_index);
@@ -95,8 +95,13 @@ class SERVER_EXPORT JackClient : public JackClientInterface, public JackRunnable
         std::list<jack_port_id_t> fPortList;
 
         JackSessionReply fSessionReply;
+        int fPlacementSerial;  /*! Last placement applied to the RT thread */
+
+        bool fConnectionTransaction;
+        std::list<JackConnectionOp> fConnectionOps;  /*! Connections queued until the transaction is committed */
 
         int StartThread();
+        int QueueConnection(bool connect, const char* src, const char* dst);
         void SetupDriverSync(bool freewheel);
         bool IsActive();
 
@@ -119,6 +124,8 @@ class SERVER_EXPORT JackClient : public JackClientInterface, public JackRunnable
         inline int ActivateAux();
         inline void InitAux();
         inline void SetupRealTime();
+        void ApplyPlacement();
+        inline int GetRealTimePriority();
 
         int HandleLatencyCallback(int status);
 
@@ -154,6 +161,10 @@ class SERVER_EXPORT JackClient : public JackClientInterface, public JackRunnable
         virtual int PortDisconnect(const char* src, const char* dst);
         virtual int PortDisconnect(jack_port_id_t src);
 
+        virtual int ConnectionTransactionBegin();
+        virtual int ConnectionTransactionCommit(int* results);
+        virtual int ConnectionTransactionAbort();
+
         virtual int PortIsMine(jack_port_id_t port_index);
         virtual int PortRename(jack_port_id_t port_index, const char* name);
 
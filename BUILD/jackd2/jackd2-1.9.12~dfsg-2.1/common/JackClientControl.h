@@ -50,6 +50,11 @@ struct JackClientControl : public JackShmMemAble
     char fSessionCommand[JACK_SESSION_COMMAND_SIZE];
     jack_session_flags_t fSessionFlags;
 
+    // RT thread placement decided by the server, applied by the client notification thread when fPlacementSerial changes
+    int fPlacementCPU;
+    int fPlacementPriority;
+    volatile int fPlacementSerial;
+
     JackClientControl(const char* name, int pid, int refnum, int uuid)
     {
         Init(name, pid, refnum, uuid);
@@ -76,6 +81,8 @@ struct JackClientControl : public JackShmMemAble
         fCallback[kRemoveClient] = true;
         fCallback[kActivateClient] = true;
         fCallback[kLatencyCallback] = true;
+        // So that a RT thread placement decided by the server is applied
+        fCallback[kPlacementCallback] = true;
         // So that driver synchro are correctly setup in "flush" or "normal" mode
         fCallback[kStartFreewheelCallback] = true;
         fCallback[kStopFreewheelCallback] = true;
@@ -87,6 +94,10 @@ struct JackClientControl : public JackShmMemAble
         fActive = false;
 
         fSessionID = uuid;
+
+        fPlacementCPU = -1;
+        fPlacementPriority = 0;
+        fPlacementSerial = 0;
     }
 
 } POST_PACKED_STRUCTURE;
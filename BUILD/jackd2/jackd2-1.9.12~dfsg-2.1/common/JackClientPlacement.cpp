@@ -0,0 +1,381 @@
+/*
+Copyright (C) 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+*/
+
+#include "JackSystemDeps.h"
+#include "JackClientPlacement.h"
+#include "JackClientInterface.h"
+#include "JackClientControl.h"
+#include "JackGraphManager.h"
+#include "JackControlAPI.h"
+#include "JackError.h"
+
+#include <vector>
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef __linux__
+#include <sched.h>
+#elif !defined(WIN32)
+#include <unistd.h>
+#endif
+
+namespace Jack
+{
+
+JackClientPlacement::JackClientPlacement()
+{
+    fAuto = false;
+    fPriorityBoost = false;
+    fRuleNum = 0;
+    fCPUNum = 0;
+    for (int i = 0; i < CLIENT_NUM; i++) {
+        fCost[i] = 0.f;
+    }
+}
+
+void JackClientPlacement::ReadCPUTable()
+{
+    fCPUNum = 0;
+
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+        for (int i = 0; i < CPU_SETSIZE && fCPUNum < PLACEMENT_CPU_NUM; i++) {
+            if (CPU_ISSET(i, &cpu_set)) {
+                fCPUTable[fCPUNum++] = i;
+            }
+        }
+    }
+#elif defined(WIN32)
+    DWORD_PTR process_mask, system_mask;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask)) {
+        for (int i = 0; i < int(sizeof(DWORD_PTR) * 8) && fCPUNum < PLACEMENT_CPU_NUM; i++) {
+            if (process_mask & (DWORD_PTR(1) << i)) {
+                fCPUTable[fCPUNum++] = i;
+            }
+        }
+    }
+#else
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    for (int i = 0; i < cpus && fCPUNum < PLACEMENT_CPU_NUM; i++) {
+        fCPUTable[fCPUNum++] = i;
+    }
+#endif
+
+    if (fCPUNum == 0) {
+        fCPUTable[fCPUNum++] = 0;
+    }
+}
+
+int JackClientPlacement::ParseRule(const char* rule, JackPlacementRule* res)
+{
+    const char* equal = strchr(rule, '=');
+    size_t len = (equal) ? size_t(equal - rule) : 0;
+
+    if (len == 0 || len > JACK_CLIENT_NAME_SIZE) {
+        jack_error("Invalid client placement rule \"%s\"", rule);
+        return -1;
+    }
+
+    strncpy(res->fName, rule, len);
+    res->fName[len] = 0;
+    res->fPrefix = (res->fName[len - 1] == '*');
+    if (res->fPrefix) {
+        res->fName[len - 1] = 0;
+    }
+
+    const char* cpu = equal + 1;
+    char* end;
+    if (*cpu == '*') {
+        res->fCPU = PLACEMENT_AUTO_CPU;
+        end = (char*)cpu + 1;
+    } else {
+        res->fCPU = strtol(cpu, &end, 10);
+        if (end == cpu || res->fCPU < 0) {
+            jack_error("Invalid CPU in client placement rule \"%s\"", rule);
+            return -1;
+        }
+    }
+
+    res->fPriority = 0;
+    if (*end == '/') {
+        const char* priority = end + 1;
+        res->fPriority = strtol(priority, &end, 10);
+        if (end == priority) {
+            jack_error("Invalid priority offset in client placement rule \"%s\"", rule);
+            return -1;
+        }
+    }
+
+    if (*end != 0) {
+        jack_error("Invalid client placement rule \"%s\"", rule);
+        return -1;
+    }
+
+    return 0;
+}
+
+int JackClientPlacement::Init(bool automatic, const char* rules, bool priority_boost)
+{
+    fAuto = automatic;
+    fPriorityBoost = priority_boost;
+    fRuleNum = 0;
+    ReadCPUTable();
+
+    if (rules && rules[0] != 0) {
+        char buffer[JACK_PARAM_STRING_MAX + 1];
+        strncpy(buffer, rules, JACK_PARAM_STRING_MAX);
+        buffer[JACK_PARAM_STRING_MAX] = 0;
+
+        char* rule = buffer;
+        while (rule) {
+            char* next = strchr(rule, ',');
+            if (next) {
+                *next++ = 0;
+            }
+            if (rule[0] != 0) {
+                if (fRuleNum == PLACEMENT_RULE_NUM) {
+                    jack_error("Too many client placement rules, max = %d", PLACEMENT_RULE_NUM);
+                    return -1;
+                }
+                if (ParseRule(rule, &fRules[fRuleNum]) < 0) {
+                    return -1;
+                }
+                fRuleNum++;
+            }
+            rule = next;
+        }
+    }
+
+    if (IsActive()) {
+        jack_info("Client placement %s on %d CPU(s), %d rule(s)%s", (fAuto) ? "automatic" : "manual", fCPUNum, fRuleNum, (fPriorityBoost) ? ", critical path priority boost" : "");
+    }
+    return 0;
+}
+
+const JackPlacementRule* JackClientPlacement::FindRule(const char* name)
+{
+    for (int i = 0; i < fRuleNum; i++) {
+        const JackPlacementRule* rule = &fRules[i];
+        if (rule->fPrefix) {
+            if (strncmp(name, rule->fName, strlen(rule->fName)) == 0) {
+                return rule;
+            }
+        } else if (strcmp(name, rule->fName) == 0) {
+            return rule;
+        }
+    }
+    return NULL;
+}
+
+void JackClientPlacement::Reset(int refnum)
+{
+    fCost[refnum] = 0.f;
+}
+
+// RT
+void JackClientPlacement::Measure(JackClientInterface** table, JackGraphManager* manager, int driver_num)
+{
+    if (!IsActive()) {
+        return;
+    }
+
+    for (int i = driver_num; i < CLIENT_NUM; i++) {
+        JackClientInterface* client = table[i];
+        JackClientTiming* timing = manager->GetClientTiming(i);
+        if (client && client->GetClientControl()->fActive && timing->fStatus == Finished && timing->fFinishedAt > timing->fAwakeAt) {
+            float duration = float(timing->fFinishedAt - timing->fAwakeAt);
+            fCost[i] += (duration - fCost[i]) * 0.125f;
+        }
+    }
+}
+
+/*!
+\brief Returns the index in fCPUTable of the least loaded CPU at the current graph depth, the CPU of the predecessor being prefered on equality.
+*/
+int JackClientPlacement::ChooseCPU(float* level_load, float* total_load, int prefered_cpu)
+{
+    int best = 0;
+
+    for (int i = 1; i < fCPUNum; i++) {
+        if (level_load[i] < level_load[best]) {
+            best = i;
+        } else if (level_load[i] == level_load[best]) {
+            if (fCPUTable[best] == prefered_cpu) {
+                continue;
+            }
+            if (fCPUTable[i] == prefered_cpu || total_load[i] < total_load[best]) {
+                best = i;
+            }
+        }
+    }
+
+    return best;
+}
+
+// Server
+void JackClientPlacement::Update(JackClientInterface** table, JackGraphManager* manager, int driver_num)
+{
+    if (!IsActive()) {
+        return;
+    }
+
+    std::vector<jack_int_t> sorted;
+    int depth[CLIENT_NUM];
+    int pred[CLIENT_NUM];
+    float start[CLIENT_NUM];
+    float finish[CLIENT_NUM];
+    int cpu[CLIENT_NUM];
+    int priority[CLIENT_NUM];
+    bool placed[CLIENT_NUM];
+
+    for (int i = 0; i < CLIENT_NUM; i++) {
+        depth[i] = 0;
+        pred[i] = -1;
+        start[i] = 0.f;
+        finish[i] = 0.f;
+        cpu[i] = PLACEMENT_AUTO_CPU;
+        priority[i] = 0;
+        placed[i] = false;
+        if (!table[i]) {
+            fCost[i] = 0.f;
+        }
+    }
+
+    manager->TopologicalSort(sorted);
+
+    // Graph depth and longest (critical) path, drivers are the roots of the graph
+    for (size_t i = 0; i < sorted.size(); i++) {
+        int ref = sorted[i];
+        if (ref >= driver_num) {
+            finish[ref] = start[ref] + fCost[ref];
+        }
+        for (size_t j = i + 1; j < sorted.size(); j++) {
+            int dst = sorted[j];
+            if (dst >= driver_num && manager->IsDirectConnection(ref, dst)) {
+                if (depth[ref] + 1 > depth[dst]) {
+                    depth[dst] = depth[ref] + 1;
+                }
+                if (pred[dst] < 0 || finish[ref] > start[dst]) {
+                    start[dst] = finish[ref];
+                    pred[dst] = ref;
+                }
+            }
+        }
+    }
+
+    // Clients which run their own RT thread, by depth then heaviest first
+    std::vector<int> clients;
+    for (size_t i = 0; i < sorted.size(); i++) {
+        int ref = sorted[i];
+        JackClientInterface* client = table[ref];
+        if (ref < driver_num || !client || placed[ref]) {
+            continue;
+        }
+        JackClientControl* control = client->GetClientControl();
+        if (control->fActive && control->fCallback[kRealTimeCallback]) {
+            placed[ref] = true;
+            std::vector<int>::iterator it = clients.begin();
+            while (it != clients.end() && (depth[*it] < depth[ref] || (depth[*it] == depth[ref] && fCost[*it] >= fCost[ref]))) {
+                it++;
+            }
+            clients.insert(it, ref);
+        }
+    }
+
+    // Critical path
+    if (fPriorityBoost) {
+        int last = -1;
+        for (size_t i = 0; i < clients.size(); i++) {
+            if (last < 0 || finish[clients[i]] > finish[last]) {
+                last = clients[i];
+            }
+        }
+        for (int ref = last; ref >= driver_num; ref = pred[ref]) {
+            priority[ref] = 1;
+        }
+    }
+
+    float level_load[PLACEMENT_CPU_NUM];
+    float total_load[PLACEMENT_CPU_NUM];
+    for (int i = 0; i < fCPUNum; i++) {
+        total_load[i] = 0.f;
+    }
+
+    size_t level_begin = 0;
+    while (level_begin < clients.size()) {
+
+        size_t level_end = level_begin;
+        while (level_end < clients.size() && depth[clients[level_end]] == depth[clients[level_begin]]) {
+            level_end++;
+        }
+
+        for (int i = 0; i < fCPUNum; i++) {
+            level_load[i] = 0.f;
+        }
+
+        // Pinned clients first, so that automatic ones are spread around them
+        for (int pass = 0; pass < 2; pass++) {
+            for (size_t i = level_begin; i < level_end; i++) {
+                int ref = clients[i];
+                const JackPlacementRule* rule = FindRule(table[ref]->GetClientControl()->fName);
+                // Unmeasured clients still count, so that they are spread too
+                float cost = (fCost[ref] > 1.f) ? fCost[ref] : 1.f;
+
+                if (rule) {
+                    priority[ref] = rule->fPriority;
+                }
+
+                if (pass == 0 && rule && rule->fCPU != PLACEMENT_AUTO_CPU) {
+                    cpu[ref] = rule->fCPU;
+                    for (int k = 0; k < fCPUNum; k++) {
+                        if (fCPUTable[k] == rule->fCPU) {
+                            level_load[k] += cost;
+                            total_load[k] += cost;
+                        }
+                    }
+                } else if (pass == 1 && (fAuto || rule) && !(rule && rule->fCPU != PLACEMENT_AUTO_CPU)) {
+                    int prefered_cpu = (pred[ref] >= driver_num) ? cpu[pred[ref]] : PLACEMENT_AUTO_CPU;
+                    int index = ChooseCPU(level_load, total_load, prefered_cpu);
+                    cpu[ref] = fCPUTable[index];
+                    level_load[index] += cost;
+                    total_load[index] += cost;
+                }
+            }
+        }
+
+        level_begin = level_end;
+    }
+
+    // Publish, the client notification thread applies the new placement when the serial changes
+    for (size_t i = 0; i < clients.size(); i++) {
+        int ref = clients[i];
+        JackClientControl* control = table[ref]->GetClientControl();
+        if (control->fPlacementCPU != cpu[ref] || control->fPlacementPriority != priority[ref]) {
+            jack_log("JackClientPlacement::Update client = %s depth = %d cost = %ld cpu = %d priority offset = %d",
+                    control->fName, depth[ref], long(fCost[ref]), cpu[ref], priority[ref]);
+            control->fPlacementCPU = cpu[ref];
+            control->fPlacementPriority = priority[ref];
+            control->fPlacementSerial++;
+        }
+    }
+}
+
+} // end of namespace
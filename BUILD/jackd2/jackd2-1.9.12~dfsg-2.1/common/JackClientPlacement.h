@@ -0,0 +1,98 @@
+/*
+Copyright (C) 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+*/
+
+#ifndef __JackClientPlacement__
+#define __JackClientPlacement__
+
+#include "JackConstants.h"
+#include "JackCompilerDeps.h"
+
+namespace Jack
+{
+
+class JackClientInterface;
+class JackGraphManager;
+
+#define PLACEMENT_RULE_NUM 32
+#define PLACEMENT_CPU_NUM 64
+#define PLACEMENT_AUTO_CPU -1
+
+/*!
+\brief Manual placement rule: "name=cpu[/priority-offset]", a trailing '*' in name matches a prefix, cpu may be '*' for automatic placement.
+*/
+
+struct JackPlacementRule
+{
+    char fName[JACK_CLIENT_NAME_SIZE + 1];
+    bool fPrefix;
+    int fCPU;
+    int fPriority;
+};
+
+/*!
+\brief Server side placement of client RT threads on CPUs.
+
+Clients at the same depth of the graph (as seen from the drivers) can run in parallel, so they are spread
+on different CPUs, heaviest first, using the averaged client durations measured in the RT thread.
+The result is written in each JackClientControl, the client RT thread applies it at the end of its cycle.
+*/
+
+class SERVER_EXPORT JackClientPlacement
+{
+
+    private:
+
+        bool fAuto;
+        bool fPriorityBoost;
+        JackPlacementRule fRules[PLACEMENT_RULE_NUM];
+        int fRuleNum;
+        int fCPUTable[PLACEMENT_CPU_NUM];
+        int fCPUNum;
+        float fCost[CLIENT_NUM];    // Averaged client duration in usecs, written by the RT thread
+
+        const JackPlacementRule* FindRule(const char* name);
+        int ParseRule(const char* rule, JackPlacementRule* res);
+        int ChooseCPU(float* level_load, float* total_load, int prefered_cpu);
+        void ReadCPUTable();
+
+    public:
+
+        JackClientPlacement();
+        ~JackClientPlacement()
+        {}
+
+        int Init(bool automatic, const char* rules, bool priority_boost);
+
+        bool IsActive()
+        {
+            return fAuto || fRuleNum > 0;
+        }
+
+        // RT
+        void Measure(JackClientInterface** table, JackGraphManager* manager, int driver_num);
+
+        // Server
+        void Update(JackClientInterface** table, JackGraphManager* manager, int driver_num);
+        void Reset(int refnum);
+
+};
+
+} // end of namespace
+
+#endif
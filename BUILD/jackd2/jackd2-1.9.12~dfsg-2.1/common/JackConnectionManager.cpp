@@ -23,6 +23,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 #include "JackGlobals.h"
 #include "JackError.h"
 #include <set>
+#include <algorithm>
 #include <iostream>
 #include <assert.h>
 
@@ -229,15 +230,83 @@ void JackConnectionManager::ResetGraph(JackClientTiming* timing)
     }
 }
 
+/*!
+\brief Tell if a client feeding the given one has not finished the current cycle yet, and finished its last cycle on a CPU.
+*/
+bool JackConnectionManager::IsInputPendingOn(int refnum, JackClientTiming* timing, int cpu, jack_time_t cycle_begin) const
+{
+    for (int i = 0; i < CLIENT_NUM; i++) {
+        if (fConnectionRef.GetItemCount(i, refnum) > 0 && timing[i].fCPU == cpu
+            && (timing[i].fStatus != Finished || timing[i].fFinishedAt < cycle_begin)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*!
+\brief Average the date of the signal in the cycle, just after waking up.
+*/
+void JackConnectionManager::UpdateSignalOffset(JackClientTiming* timing, JackEngineControl* engine_control)
+{
+    jack_time_t cycle_begin = engine_control->fCurCycleTime;
+
+    if (timing->fSignaledAt >= cycle_begin && timing->fSignaledAt - cycle_begin < engine_control->fPeriodUsecs) {
+        long long offset = timing->fSignaledAt - cycle_begin;
+        if (timing->fSignalOffset == 0) {
+            timing->fSignalOffset = offset;
+        } else {
+            long long deviation = offset - (long long)timing->fSignalOffset;
+            timing->fSignalOffset = (7 * timing->fSignalOffset + offset) / 8;
+            timing->fSignalJitter = (7 * timing->fSignalJitter + ((deviation < 0) ? -deviation : deviation)) / 8;
+        }
+    }
+}
+
 /*!
 \brief Wait on the input synchro.
+
+When spin waits are enabled (engine_control->fSpinUsecs), the date of the signal is predicted from the previous
+cycles: the client sleeps on the synchro until shortly before it, then spins for at most fSpinUsecs before sleeping
+again. It does not spin when the prediction is not reliable, or when a client it waits for uses the same CPU.
 */
-int JackConnectionManager::SuspendRefNum(JackClientControl* control, JackSynchro* table, JackClientTiming* timing, long time_out_usec)
+int JackConnectionManager::SuspendRefNum(JackClientControl* control, JackSynchro* table, JackClientTiming* timing, long time_out_usec,
+                                         JackEngineControl* engine_control)
 {
-    bool res;
-    if ((res = table[control->fRefNum].TimedWait(time_out_usec))) {
-        timing[control->fRefNum].fStatus = Running;
-        timing[control->fRefNum].fAwakeAt = GetMicroSeconds();
+    int refnum = control->fRefNum;
+    long spin_usec = (engine_control) ? engine_control->fSpinUsecs : 0;
+    bool res = false;
+
+    if (spin_usec > 0 && timing[refnum].fSignalOffset > 0 && 2 * timing[refnum].fSignalJitter < (jack_time_t)spin_usec) {
+        jack_time_t now = GetMicroSeconds();
+        jack_time_t expected = engine_control->fCurCycleTime + timing[refnum].fSignalOffset;
+        jack_time_t lead = std::min(jack_time_t(spin_usec / 2), 2 * timing[refnum].fSignalJitter + SPIN_WAIT_LEAD);
+
+        // Already woken up in the current cycle: wait for the next one
+        if (timing[refnum].fAwakeAt >= engine_control->fCurCycleTime) {
+            expected += engine_control->fPeriodUsecs;
+        }
+
+        if (expected < now + engine_control->fPeriodUsecs) {
+            long sleep_usec = (expected > now + lead) ? long(expected - now - lead) : 0;
+            if (sleep_usec > 0) {
+                res = table[refnum].SpinWait(sleep_usec, 0);
+            }
+            if (!res && !IsInputPendingOn(refnum, timing, JackSynchro::GetCPU(), engine_control->fCurCycleTime)) {
+                res = table[refnum].SpinWait(0, spin_usec);
+            }
+            if (!res) {
+                time_out_usec = std::max(time_out_usec - long(GetMicroSeconds() - now), 0L);
+            }
+        }
+    }
+
+    if (res || (res = table[refnum].TimedWait(time_out_usec))) {
+        timing[refnum].fStatus = Running;
+        timing[refnum].fAwakeAt = GetMicroSeconds();
+        if (spin_usec > 0) {
+            UpdateSignalOffset(&timing[refnum], engine_control);
+        }
     }
     return (res) ? 0 : -1;
 }
@@ -254,6 +323,7 @@ int JackConnectionManager::ResumeRefNum(JackClientControl* control, JackSynchro*
     // Update state and timestamp of current client
     timing[control->fRefNum].fStatus = Finished;
     timing[control->fRefNum].fFinishedAt = current_date;
+    timing[control->fRefNum].fCPU = JackSynchro::GetCPU();
 
     for (int i = 0; i < CLIENT_NUM; i++) {
 
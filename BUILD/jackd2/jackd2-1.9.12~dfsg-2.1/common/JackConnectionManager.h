@@ -31,6 +31,7 @@ namespace Jack
 {
 
 struct JackClientControl;
+struct JackEngineControl;
 
 /*!
 \brief Utility class.
@@ -378,6 +379,11 @@ struct JackClientTiming
     jack_time_t fFinishedAt;
     jack_client_state_t fStatus;
 
+    // Spin waits: averaged date of the signal in the cycle and its deviation, CPU at the end of the last cycle
+    jack_time_t fSignalOffset;
+    jack_time_t fSignalJitter;
+    int fCPU;
+
     JackClientTiming()
     {
         Init();
@@ -391,6 +397,9 @@ struct JackClientTiming
         fAwakeAt = 0;
         fFinishedAt = 0;
         fStatus = NotTriggered;
+        fSignalOffset = 0;
+        fSignalJitter = 0;
+        fCPU = -1;
     }
 
 } POST_PACKED_STRUCTURE;
@@ -421,6 +430,8 @@ class SERVER_EXPORT JackConnectionManager
         JackLoopFeedback<CONNECTION_NUM_FOR_PORT> fLoopFeedback;		/*! Loop feedback connections */
 
         bool IsLoopPathAux(int ref1, int ref2) const;
+        bool IsInputPendingOn(int refnum, JackClientTiming* timing, int cpu, jack_time_t cycle_begin) const;
+        void UpdateSignalOffset(JackClientTiming* timing, JackEngineControl* engine_control);
 
     public:
 
@@ -484,7 +495,8 @@ class SERVER_EXPORT JackConnectionManager
         // Graph
         void ResetGraph(JackClientTiming* timing);
         int ResumeRefNum(JackClientControl* control, JackSynchro* table, JackClientTiming* timing);
-        int SuspendRefNum(JackClientControl* control, JackSynchro* table, JackClientTiming* timing, long time_out_usec);
+        int SuspendRefNum(JackClientControl* control, JackSynchro* table, JackClientTiming* timing, long time_out_usec,
+                          JackEngineControl* engine_control = NULL);
         void TopologicalSort(std::vector<jack_int_t>& sorted);
 
 } POST_PACKED_STRUCTURE;
@@ -57,9 +57,12 @@
 #endif
 
 #define FIRST_AVAILABLE_PORT 1
+#define PORT_GROUP_GAP 16          // Free ports left after another client's ports when a client gets its first port
 
 #define CONNECTION_NUM_FOR_PORT PORT_NUM_FOR_CLIENT
 
+#define CONNECTION_TRANSACTION_NUM 4096
+
 #ifndef CLIENT_NUM
 #define CLIENT_NUM 64
 #endif
@@ -71,12 +74,13 @@
 
 #define ALL_CLIENTS -1 // for notification
 
-#define JACK_PROTOCOL_VERSION 8
+#define JACK_PROTOCOL_VERSION 14
 
 #define SOCKET_TIME_OUT 2               // in sec
 #define DRIVER_OPEN_TIMEOUT 5           // in sec
 #define FREEWHEEL_DRIVER_TIMEOUT 10     // in sec
 #define DRIVER_TIMEOUT_FACTOR    10
+#define SPIN_WAIT_LEAD 20               // in usec, spin waits start at least this time before the expected signal
 
 #define JACK_SERVER_FAILURE "JACK server has been closed"
 
@@ -109,6 +109,30 @@ struct jackctl_server
     /* char enum, self connect mode mode */
     union jackctl_parameter_value self_connect_mode;
     union jackctl_parameter_value default_self_connect_mode;
+
+    /* bool, automatic placement of client RT threads on CPUs */
+    union jackctl_parameter_value cpu_placement;
+    union jackctl_parameter_value default_cpu_placement;
+
+    /* string, manual client placement rules */
+    union jackctl_parameter_value cpu_pin;
+    union jackctl_parameter_value default_cpu_pin;
+
+    /* bool, raise priority of clients on the graph critical path */
+    union jackctl_parameter_value cpu_placement_priority;
+    union jackctl_parameter_value default_cpu_placement_priority;
+
+    /* string, directory of xrun dumps */
+    union jackctl_parameter_value xrun_dump;
+    union jackctl_parameter_value default_xrun_dump;
+
+    /* uint32_t, maximum spin time of client waits in usecs */
+    union jackctl_parameter_value spin_wait;
+    union jackctl_parameter_value default_spin_wait;
+
+    /* bool, back large shared memory segments with huge pages */
+    union jackctl_parameter_value hugepages;
+    union jackctl_parameter_value default_hugepages;
 };
 
 struct jackctl_driver
@@ -918,6 +942,90 @@ SERVER_EXPORT jackctl_server_t * jackctl_server_create(
         goto fail_free_parameters;
     }
 
+    value.b = false;
+    if (jackctl_add_parameter(
+            &server_ptr->parameters,
+            "cpu-placement",
+            "Place client RT threads on CPUs using the graph topology.",
+            "Clients which can run in parallel in the graph are placed on different CPUs, using their measured durations. The placement is evaluated again each time the graph changes.",
+            JackParamBool,
+            &server_ptr->cpu_placement,
+            &server_ptr->default_cpu_placement,
+            value) == NULL)
+    {
+        goto fail_free_parameters;
+    }
+
+    value.str[0] = 0;
+    if (jackctl_add_parameter(
+            &server_ptr->parameters,
+            "cpu-pin",
+            "Client placement rules.",
+            "Comma separated list of name=cpu[/priority-offset] rules, a trailing '*' in name matches a client name prefix, cpu can be '*' for automatic placement.",
+            JackParamString,
+            &server_ptr->cpu_pin,
+            &server_ptr->default_cpu_pin,
+            value) == NULL)
+    {
+        goto fail_free_parameters;
+    }
+
+    value.b = false;
+    if (jackctl_add_parameter(
+            &server_ptr->parameters,
+            "cpu-placement-priority",
+            "Raise RT priority of clients on the graph critical path.",
+            "",
+            JackParamBool,
+            &server_ptr->cpu_placement_priority,
+            &server_ptr->default_cpu_placement_priority,
+            value) == NULL)
+    {
+        goto fail_free_parameters;
+    }
+
+    value.str[0] = 0;
+    if (jackctl_add_parameter(
+            &server_ptr->parameters,
+            "xrun-dump",
+            "Directory of xrun dumps.",
+            "Record the timings of the last cycles and write them in a file of this directory each time an xrun occurs.",
+            JackParamString,
+            &server_ptr->xrun_dump,
+            &server_ptr->default_xrun_dump,
+            value) == NULL)
+    {
+        goto fail_free_parameters;
+    }
+
+    value.ui = 0;
+    if (jackctl_add_parameter(
+            &server_ptr->parameters,
+            "spin-wait",
+            "Maximum spin time of client waits in usecs.",
+            "Clients sleep until shortly before the date they are usually signaled at, then spin for at most this time instead of sleeping, as long as no client they wait for runs on the same CPU. 0 disables spinning.",
+            JackParamUInt,
+            &server_ptr->spin_wait,
+            &server_ptr->default_spin_wait,
+            value) == NULL)
+    {
+        goto fail_free_parameters;
+    }
+
+    value.b = false;
+    if (jackctl_add_parameter(
+            &server_ptr->parameters,
+            "hugepages",
+            "Use huge pages for the port buffers and graph state.",
+            "The graph and port buffer shared memory is allocated on a hugetlbfs mount (found in /proc/mounts, or given by JACK_HUGETLBFS) and faulted in at server start. Normal shared memory is used when no huge pages are available.",
+            JackParamBool,
+            &server_ptr->hugepages,
+            &server_ptr->default_hugepages,
+            value) == NULL)
+    {
+        goto fail_free_parameters;
+    }
+
     JackServerGlobals::on_device_acquire = on_device_acquire;
     JackServerGlobals::on_device_release = on_device_release;
 
@@ -1041,6 +1149,8 @@ jackctl_server_open(
             goto fail;
         }
 
+        jack_shm_set_hugepages(server_ptr->hugepages.b);
+
         /* get the engine/driver started */
         server_ptr->engine = new JackServer(
             server_ptr->sync.b,
@@ -1059,6 +1169,27 @@ jackctl_server_open(
             goto fail_unregister;
         }
 
+        if (server_ptr->engine->GetEngine()->SetClientPlacement(
+                server_ptr->cpu_placement.b,
+                server_ptr->cpu_pin.str,
+                server_ptr->cpu_placement_priority.b) < 0)
+        {
+            jack_error("Failed to setup client placement");
+            goto fail_delete;
+        }
+
+        if (server_ptr->engine->GetEngine()->SetXRunDump(server_ptr->xrun_dump.str) < 0)
+        {
+            jack_error("Failed to setup xrun dumps");
+            goto fail_delete;
+        }
+
+        if (server_ptr->engine->GetEngine()->SetSpinWait(server_ptr->spin_wait.ui) < 0)
+        {
+            jack_error("Failed to setup spin waits");
+            goto fail_delete;
+        }
+
         if (!jackctl_create_param_list(driver_ptr->parameters, &paramlist)) goto fail_delete;
         rc = server_ptr->engine->Open(driver_ptr->desc_ptr, paramlist);
         jackctl_destroy_param_list(paramlist);
@@ -315,6 +315,29 @@ int JackDebugClient::PortDisconnect(jack_port_id_t src)
     return res;
 }
 
+int JackDebugClient::ConnectionTransactionBegin()
+{
+    CheckClient("ConnectionTransactionBegin");
+    *fStream << "JackClientDebug : ConnectionTransactionBegin" << endl;
+    return fClient->ConnectionTransactionBegin();
+}
+
+int JackDebugClient::ConnectionTransactionCommit(int* results)
+{
+    CheckClient("ConnectionTransactionCommit");
+    int res = fClient->ConnectionTransactionCommit(results);
+    if (res != 0)
+        *fStream << "Client '" << fClientName << "' try to do ConnectionTransactionCommit but server return " << res << " ." << endl;
+    return res;
+}
+
+int JackDebugClient::ConnectionTransactionAbort()
+{
+    CheckClient("ConnectionTransactionAbort");
+    *fStream << "JackClientDebug : ConnectionTransactionAbort" << endl;
+    return fClient->ConnectionTransactionAbort();
+}
+
 int JackDebugClient::PortIsMine(jack_port_id_t port_index)
 {
     CheckClient("PortIsMine");
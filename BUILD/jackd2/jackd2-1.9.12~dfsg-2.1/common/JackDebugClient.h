@@ -95,6 +95,10 @@ class JackDebugClient : public JackClient
         int PortDisconnect(const char* src, const char* dst);
         int PortDisconnect(jack_port_id_t src);
 
+        int ConnectionTransactionBegin();
+        int ConnectionTransactionCommit(int* results);
+        int ConnectionTransactionAbort();
+
         int PortIsMine(jack_port_id_t port_index);
         int PortRename(jack_port_id_t port_index, const char* name);
 
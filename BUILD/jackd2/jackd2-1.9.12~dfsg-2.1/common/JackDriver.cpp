@@ -582,7 +582,7 @@ int JackDriver::ResumeRefNum()
 
 int JackDriver::SuspendRefNum()
 {
-    return fGraphManager->SuspendRefNum(&fClientControl, fSynchroTable, DRIVER_TIMEOUT_FACTOR * fEngineControl->fTimeOutUsecs);
+    return fGraphManager->SuspendRefNum(&fClientControl, fSynchroTable, DRIVER_TIMEOUT_FACTOR * fEngineControl->fTimeOutUsecs, fEngineControl);
 }
 
 } // end of namespace
@@ -56,6 +56,7 @@ JackEngine::JackEngine(JackGraphManager* manager,
     fSessionPendingReplies = 0;
     fSessionTransaction = NULL;
     fSessionResult = NULL;
+    fConnectionTransaction = false;
 }
 
 JackEngine::~JackEngine()
@@ -120,6 +121,7 @@ int JackEngine::AllocateRefnum()
 void JackEngine::ReleaseRefnum(int refnum)
 {
     fClientTable[refnum] = NULL;
+    fPlacement.Reset(refnum);
 
     if (fEngineControl->fTemporary) {
         int i;
@@ -145,6 +147,7 @@ void JackEngine::ProcessNext(jack_time_t cur_cycle_begin)
 {
     fLastSwitchUsecs = cur_cycle_begin;
     if (fGraphManager->RunNextGraph())  {   // True if the graph actually switched to a new state
+        fXRunRecorder.GraphSwitched();
         fChannel.Notify(ALL_CLIENTS, kGraphOrderCallback, 0);
     }
     fSignal.Signal();                       // Signal for threads waiting for next cycle
@@ -164,6 +167,9 @@ bool JackEngine::Process(jack_time_t cur_cycle_begin, jack_time_t prev_cycle_end
 
     // Cycle  begin
     fEngineControl->CycleBegin(fClientTable, fGraphManager, cur_cycle_begin, prev_cycle_end);
+    fPlacement.Measure(fClientTable, fGraphManager, fEngineControl->fDriverNum);
+    fXRunRecorder.Record(fClientTable, fGraphManager, fEngineControl->fDriverNum,
+                         fEngineControl->fPeriodUsecs, cur_cycle_begin, prev_cycle_end);
   
     // Graph
     if (fGraphManager->IsFinishedGraph()) {
@@ -255,6 +261,26 @@ int JackEngine::ComputeTotalLatencies()
     return 0;
 }
 
+int JackEngine::SetClientPlacement(bool automatic, const char* rules, bool priority_boost)
+{
+    return fPlacement.Init(automatic, rules, priority_boost);
+}
+
+int JackEngine::SetXRunDump(const char* path)
+{
+    return fXRunRecorder.Init(path);
+}
+
+int JackEngine::SetSpinWait(long usecs)
+{
+    if (usecs < 0) {
+        jack_error("JackEngine::SetSpinWait incorrect spin time = %ld", usecs);
+        return -1;
+    }
+    fEngineControl->fSpinUsecs = usecs;
+    return 0;
+}
+
 //---------------
 // Notifications
 //---------------
@@ -340,9 +366,21 @@ void JackEngine::NotifyRemoveClient(const char* name, int refnum)
 void JackEngine::NotifyDriverXRun()
 {
     // Use the audio thread => request thread communication channel
+    fXRunRecorder.MarkXRun(fEngineControl->fXrunDelayedUsecs);
     fChannel.Notify(ALL_CLIENTS, kXRunCallback, 0);
 }
 
+JackXRunDump* JackEngine::PrepareXRunDump()
+{
+    return fXRunRecorder.PrepareDump(fClientTable, fEngineControl->fServerName, fEngineControl->fBufferSize,
+                                     fEngineControl->fSampleRate, fEngineControl->fPeriodUsecs);
+}
+
+void JackEngine::WriteXRunDump(JackXRunDump* dump)
+{
+    fXRunRecorder.WriteDump(dump);
+}
+
 void JackEngine::NotifyClientXRun(int refnum)
 {
     if (refnum == ALL_CLIENTS) {
@@ -355,7 +393,11 @@ void JackEngine::NotifyClientXRun(int refnum)
 void JackEngine::NotifyGraphReorder()
 {
     ComputeTotalLatencies();
+    fPlacement.Update(fClientTable, fGraphManager, fEngineControl->fDriverNum);
     NotifyClients(kGraphOrderCallback, false, "", 0, 0);
+    if (fPlacement.IsActive()) {
+        NotifyClients(kPlacementCallback, false, "", 0, 0);
+    }
 }
 
 void JackEngine::NotifyBufferSize(jack_nframes_t buffer_size)
@@ -399,6 +441,11 @@ void JackEngine::NotifyPortRename(jack_port_id_t port, const char* old_name)
 
 void JackEngine::NotifyPortConnect(jack_port_id_t src, jack_port_id_t dst, bool onoff)
 {
+    if (fConnectionTransaction) {
+        JackPortConnectNotify notify = { src, dst, onoff };
+        fPendingConnections.push_back(notify);
+        return;
+    }
     NotifyClients((onoff ? kPortConnectCallback : kPortDisconnectCallback), false, "", src, dst);
 }
 
@@ -1036,11 +1083,43 @@ int JackEngine::PortDisconnect(int refnum, jack_port_id_t src, jack_port_id_t ds
     return res;
 }
 
+int JackEngine::PortConnectionTransaction(int refnum, std::list<JackConnectionOp>& ops)
+{
+    jack_log("JackEngine::PortConnectionTransaction ref = %d count = %d", refnum, ops.size());
+    int fail = 0;
+
+    // All changes are written in the same next state (WriteNextStateStart/Stop calls are nested),
+    // so that the RT thread sees a single graph switch, and a single graph reorder is notified.
+    fGraphManager->WriteNextStateStart();
+    fConnectionTransaction = true;
+
+    for (std::list<JackConnectionOp>::iterator i = ops.begin(); i != ops.end(); i++) {
+        i->fResult = (i->fConnect)
+            ? PortConnect(refnum, i->fSrc, i->fDst)
+            : PortDisconnect(refnum, i->fSrc, i->fDst);
+        if (i->fResult != 0) {
+            fail++;
+        }
+    }
+
+    fConnectionTransaction = false;
+    fGraphManager->WriteNextStateStop();
+
+    // Port connection notifications are sent once the new state is ready to be used
+    for (std::list<JackPortConnectNotify>::iterator i = fPendingConnections.begin(); i != fPendingConnections.end(); i++) {
+        NotifyPortConnect(i->fSrc, i->fDst, i->fOnOff);
+    }
+    fPendingConnections.clear();
+
+    jack_log("JackEngine::PortConnectionTransaction ref = %d failed = %d", refnum, fail);
+    return fail;
+}
+
 int JackEngine::PortRename(int refnum, jack_port_id_t port, const char* name)
 {
     char old_name[REAL_JACK_PORT_NAME_SIZE+1];
     strcpy(old_name, fGraphManager->GetPort(port)->GetName());
-    fGraphManager->GetPort(port)->SetName(name);
+    fGraphManager->SetPortName(port, name);
     NotifyPortRename(port, old_name);
     return 0;
 }
@@ -28,7 +28,10 @@ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
 #include "JackPlatformPlug.h"
 #include "JackRequest.h"
 #include "JackChannel.h"
+#include "JackClientPlacement.h"
+#include "JackXRunRecorder.h"
 #include <map>
+#include <list>
 
 namespace Jack
 {
@@ -37,6 +40,17 @@ class JackClientInterface;
 struct JackEngineControl;
 class JackExternalClient;
 
+/*!
+\brief Port connection change whose notification is delayed until the end of a connection transaction.
+*/
+
+struct JackPortConnectNotify
+{
+    jack_port_id_t fSrc;
+    jack_port_id_t fDst;
+    bool fOnOff;
+};
+
 /*!
 \brief Engine description.
 */
@@ -61,6 +75,10 @@ class SERVER_EXPORT JackEngine : public JackLockAble
         JackSessionNotifyResult* fSessionResult;
         std::map<int,std::string> fReservationMap;
         int fMaxUUID;
+        JackClientPlacement fPlacement;
+        JackXRunRecorder fXRunRecorder;
+        bool fConnectionTransaction;
+        std::list<JackPortConnectNotify> fPendingConnections;
 
         int ClientCloseAux(int refnum, bool wait);
         void CheckXRun(jack_time_t callback_usecs);
@@ -137,16 +155,24 @@ class SERVER_EXPORT JackEngine : public JackLockAble
         int PortConnect(int refnum, jack_port_id_t src, jack_port_id_t dst);
         int PortDisconnect(int refnum, jack_port_id_t src, jack_port_id_t dst);
 
+        int PortConnectionTransaction(int refnum, std::list<JackConnectionOp>& ops);
+
         int PortRename(int refnum, jack_port_id_t port, const char* name);
 
         int ComputeTotalLatencies();
 
+        int SetClientPlacement(bool automatic, const char* rules, bool priority_boost);
+        int SetXRunDump(const char* path);
+        int SetSpinWait(long usecs);
+
         // Graph
         bool Process(jack_time_t cur_cycle_begin, jack_time_t prev_cycle_end);
 
         // Notifications
         void NotifyDriverXRun();
         void NotifyClientXRun(int refnum);
+        JackXRunDump* PrepareXRunDump();
+        void WriteXRunDump(JackXRunDump* dump);
         void NotifyFailure(int code, const char* reason);
         void NotifyGraphReorder();
         void NotifyBufferSize(jack_nframes_t buffer_size);
@@ -68,6 +68,7 @@ struct SERVER_EXPORT JackEngineControl : public JackShmMem
     jack_timer_type_t fClockSource;
     int fDriverNum;
     bool fVerbose;
+    long fSpinUsecs;    // Maximum spin time of client waits, 0 when disabled
 
     // CPU Load
     jack_time_t fPrevCycleTime;
@@ -126,6 +127,7 @@ struct SERVER_EXPORT JackEngineControl : public JackShmMem
         fXrunDelayedUsecs = 0.f;
         fClockSource = clock;
         fDriverNum = 0;
+        fSpinUsecs = 0;
     }
 
     ~JackEngineControl()
@@ -180,6 +180,19 @@ void JackGenericClientChannel::PortDisconnect(int refnum, jack_port_id_t src, ja
     ServerSyncCall(&req, &res, result);
 }
 
+void JackGenericClientChannel::PortConnectionTransaction(int refnum, std::list<JackConnectionOp>& ops, int* result)
+{
+    JackConnectionTransactionRequest req(refnum, ops);
+    JackConnectionTransactionResult res;
+    ServerSyncCall(&req, &res, result);
+
+    // Give back the result of each operation, in the order they were queued
+    std::list<int>::iterator res_it = res.fResults.begin();
+    for (std::list<JackConnectionOp>::iterator i = ops.begin(); i != ops.end(); i++) {
+        i->fResult = (res_it != res.fResults.end()) ? *res_it++ : -1;
+    }
+}
+
 void JackGenericClientChannel::PortRename(int refnum, jack_port_id_t port, const char* name, int* result)
 {
     JackPortRenameRequest req(refnum, port, name);
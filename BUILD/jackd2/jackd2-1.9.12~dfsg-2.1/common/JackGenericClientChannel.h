@@ -71,6 +71,8 @@ class JackGenericClientChannel : public detail::JackClientChannelInterface
         void PortConnect(int refnum, jack_port_id_t src, jack_port_id_t dst, int* result);
         void PortDisconnect(int refnum, jack_port_id_t src, jack_port_id_t dst, int* result);
 
+        void PortConnectionTransaction(int refnum, std::list<JackConnectionOp>& ops, int* result);
+
         void PortRename(int refnum, jack_port_id_t port, const char* name, int* result);
 
         void SetBufferSize(jack_nframes_t buffer_size, int* result);
@@ -21,6 +21,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 #include "JackGraphManager.h"
 #include "JackConstants.h"
 #include "JackError.h"
+#include "JackMutex.h"
 #include <assert.h>
 #include <stdlib.h>
 #include <algorithm>
@@ -120,10 +121,10 @@ int JackGraphManager::ResumeRefNum(JackClientControl* control, JackSynchro* tabl
 }
 
 // RT
-int JackGraphManager::SuspendRefNum(JackClientControl* control, JackSynchro* table, long usec)
+int JackGraphManager::SuspendRefNum(JackClientControl* control, JackSynchro* table, long usec, JackEngineControl* engine_control)
 {
     JackConnectionManager* manager = ReadCurrentState();
-    return manager->SuspendRefNum(control, table, fClientTiming, usec);
+    return manager->SuspendRefNum(control, table, fClientTiming, usec, engine_control);
 }
 
 void JackGraphManager::TopologicalSort(std::vector<jack_int_t>& sorted)
@@ -365,24 +366,59 @@ void JackGraphManager::SetBufferSize(jack_nframes_t buffer_size)
     }
 }
 
+/*
+The buffers of a client's ports are kept next to each other in the port array,
+so that the client touches as few pages (or TLB entries) as possible in its cycle:
+a new port goes right after one of the client's ports if possible. The first port
+of a client starts PORT_GROUP_GAP slots after the ports of the previous client,
+leaving it room to grow. When the array is too full for this, any free slot is used.
+*/
+
 // Server
-jack_port_id_t JackGraphManager::AllocatePortAux(int refnum, const char* port_name, const char* port_type, JackPortFlags flags)
+jack_port_id_t JackGraphManager::FindFreePortAux(int refnum)
 {
     jack_port_id_t port_index;
+    jack_port_id_t first_free = NO_PORT;
+    unsigned int free_run = 0;
 
     // Available ports start at FIRST_AVAILABLE_PORT (= 1), otherwise a port_index of 0 is "seen" as a NULL port by the external API...
     for (port_index = FIRST_AVAILABLE_PORT; port_index < fPortMax; port_index++) {
         JackPort* port = GetPort(port_index);
-        if (!port->IsUsed()) {
-            jack_log("JackGraphManager::AllocatePortAux port_index = %ld name = %s type = %s", port_index, port_name, port_type);
-            if (!port->Allocate(refnum, port_name, port_type, flags)) {
-                return NO_PORT;
+        if (port->IsUsed()) {
+            if (port->fRefNum == refnum && port_index + 1 < fPortMax && !GetPort(port_index + 1)->IsUsed()) {
+                return port_index + 1;
             }
-            break;
+        } else if (first_free == NO_PORT) {
+            first_free = port_index;
+        }
+    }
+
+    for (port_index = FIRST_AVAILABLE_PORT; port_index < fPortMax; port_index++) {
+        if (GetPort(port_index)->IsUsed()) {
+            free_run = 0;
+        } else if (port_index == FIRST_AVAILABLE_PORT || ++free_run > PORT_GROUP_GAP) {
+            return port_index;
+        }
+    }
+
+    return first_free;
+}
+
+// Server
+jack_port_id_t JackGraphManager::AllocatePortAux(int refnum, const char* port_name, const char* port_type, JackPortFlags flags)
+{
+    jack_port_id_t port_index = FindFreePortAux(refnum);
+
+    if (port_index != NO_PORT) {
+        JackPort* port = GetPort(port_index);
+        jack_log("JackGraphManager::AllocatePortAux port_index = %ld name = %s type = %s", port_index, port_name, port_type);
+        if (!port->Allocate(refnum, port_name, port_type, flags)) {
+            return NO_PORT;
         }
+        fPortIndex.AddPort(fPortArray, port_index, refnum);
     }
 
-    return (port_index < fPortMax) ? port_index : NO_PORT;
+    return port_index;
 }
 
 // Server
@@ -404,6 +440,7 @@ jack_port_id_t JackGraphManager::AllocatePort(int refnum, const char* port_name,
         }
         // Insertion failure
         if (res < 0) {
+            fPortIndex.RemovePort(fPortArray, port_index, refnum);
             port->Release();
             port_index = NO_PORT;
         }
@@ -428,6 +465,13 @@ int JackGraphManager::ReleasePort(int refnum, jack_port_id_t port_index)
         res = manager->RemoveInputPort(refnum, port_index);
     }
 
+    if (port->fAlias1[0] != '\0') {
+        fPortIndex.RemoveAlias(port->fAlias1);
+    }
+    if (port->fAlias2[0] != '\0') {
+        fPortIndex.RemoveAlias(port->fAlias2);
+    }
+    fPortIndex.RemovePort(fPortArray, port_index, port->fRefNum);
     port->Release();
     WriteNextStateStop();
     return res;
@@ -744,6 +788,20 @@ int JackGraphManager::GetTwoPorts(const char* src_name, const char* dst_name, ja
 // Client : port array
 jack_port_id_t JackGraphManager::GetPort(const char* name)
 {
+    char buf[REAL_JACK_PORT_NAME_SIZE+1];
+    const char* target = name;
+
+    // Same "ALSA" kludge as JackPort::NameEquals
+    if (strncmp(name, "ALSA:capture", 12) == 0 || strncmp(name, "ALSA:playback", 13) == 0) {
+        snprintf(buf, sizeof(buf), "alsa_pcm%s", name + 4);
+        target = buf;
+    }
+
+    if (!fPortIndex.MayBeAlias(target)) {
+        return fPortIndex.Find(fPortArray, target);
+    }
+
+    // An alias may match, the first port matching by name or alias is returned
     for (unsigned int i = 0; i < fPortMax; i++) {
         JackPort* port = GetPort(i);
         if (port->IsUsed() && port->NameEquals(name)) {
@@ -753,6 +811,37 @@ jack_port_id_t JackGraphManager::GetPort(const char* name)
     return NO_PORT;
 }
 
+// Server
+void JackGraphManager::SetPortName(jack_port_id_t port_index, const char* name)
+{
+    AssertPort(port_index);
+    fPortIndex.RenamePort(fPortArray, port_index, name);
+}
+
+// Server and client
+int JackGraphManager::SetPortAlias(jack_port_id_t port_index, const char* alias)
+{
+    JackPort* port = GetPort(port_index);
+    const char* slot = (port->fAlias1[0] == '\0') ? port->fAlias1 : port->fAlias2;
+
+    // Count the alias as stored, it may have been truncated
+    int res = port->SetAlias(alias);
+    if (res == 0) {
+        fPortIndex.AddAlias(slot);
+    }
+    return res;
+}
+
+// Server and client
+int JackGraphManager::UnsetPortAlias(jack_port_id_t port_index, const char* alias)
+{
+    int res = GetPort(port_index)->UnsetAlias(alias);
+    if (res == 0) {
+        fPortIndex.RemoveAlias(alias);
+    }
+    return res;
+}
+
 /*!
 \brief Get the connection port name array.
 */
@@ -804,59 +893,265 @@ const char** JackGraphManager::GetConnections(jack_port_id_t port_index)
     }
 }
 
-// Client
-void JackGraphManager::GetPortsAux(const char** matching_ports, const char* port_name_pattern, const char* type_name_pattern, unsigned long flags)
+/*
+jack_get_ports patterns are POSIX extended regular expressions, but most of them are plain names, "^client:" prefixes
+or substrings: those are compared directly, and exact names and prefixes use the port index instead of looking at every
+port. Other patterns are compiled once and kept in a small per-process cache.
+*/
+
+#define PATTERN_ANY         0
+#define PATTERN_EXACT       1
+#define PATTERN_PREFIX      2
+#define PATTERN_SUFFIX      3
+#define PATTERN_SUBSTRING   4
+#define PATTERN_REGEX       5
+
+#define REGEX_CACHE_SIZE    16
+
+struct JackPortPattern
 {
-    int match_cnt = 0;
-    regex_t port_regex, type_regex;
+    int fKind;
+    char fText[REAL_JACK_PORT_NAME_SIZE+1];
+    size_t fLength;
+    regex_t* fRegex;
+};
 
-    if (port_name_pattern && port_name_pattern[0]) {
-        regcomp(&port_regex, port_name_pattern, REG_EXTENDED | REG_NOSUB);
-    }
-    if (type_name_pattern && type_name_pattern[0]) {
-        regcomp(&type_regex, type_name_pattern, REG_EXTENDED | REG_NOSUB);
-    }
+class JackRegexCache : public JackLockAble
+{
 
-    // Cleanup port array
-    memset(matching_ports, 0, sizeof(char*) * fPortMax);
+    private:
 
-    for (unsigned int i = 0; i < fPortMax; i++) {
-        bool matching = true;
-        JackPort* port = GetPort(i);
+        struct Entry
+        {
+            char* fPattern;
+            regex_t fRegex;
+            int fUsers;
+            unsigned long fLastUse;
+        };
 
-        if (port->IsUsed()) {
+        Entry fEntries[REGEX_CACHE_SIZE];
+        unsigned long fClock;
+
+    public:
+
+        JackRegexCache(): fClock(0)
+        {
+            memset(fEntries, 0, sizeof(fEntries));
+        }
 
-            if (flags) {
-                if ((port->fFlags & flags) != flags) {
-                    matching = false;
+        ~JackRegexCache()
+        {
+            for (int i = 0; i < REGEX_CACHE_SIZE; i++) {
+                if (fEntries[i].fPattern) {
+                    regfree(&fEntries[i].fRegex);
+                    free(fEntries[i].fPattern);
                 }
             }
+        }
 
-            if (matching && port_name_pattern && port_name_pattern[0]) {
-                if (regexec(&port_regex, port->GetName(), 0, NULL, 0)) {
-                    matching = false;
+        // Returns NULL if the pattern does not compile
+        regex_t* Acquire(const char* pattern)
+        {
+            JackLock lock(this);
+            Entry* victim = NULL;
+
+            for (int i = 0; i < REGEX_CACHE_SIZE; i++) {
+                Entry* entry = &fEntries[i];
+                if (entry->fPattern && strcmp(entry->fPattern, pattern) == 0) {
+                    entry->fUsers++;
+                    entry->fLastUse = ++fClock;
+                    return &entry->fRegex;
                 }
+                if (entry->fUsers == 0 && (!victim || !entry->fPattern || (victim->fPattern && entry->fLastUse < victim->fLastUse))) {
+                    victim = entry;
+                }
+            }
+
+            regex_t regex;
+            if (regcomp(&regex, pattern, REG_EXTENDED | REG_NOSUB) != 0) {
+                jack_log("JackRegexCache::Acquire cannot compile pattern = %s", pattern);
+                return NULL;
             }
-            if (matching && type_name_pattern && type_name_pattern[0]) {
-                if (regexec(&type_regex, port->GetType(), 0, NULL, 0)) {
-                    matching = false;
+
+            char* copy = strdup(pattern);
+            if (!victim || !copy) {
+                // All entries are used by other threads: not cached
+                free(copy);
+                regex_t* res = (regex_t*)malloc(sizeof(regex_t));
+                if (!res) {
+                    regfree(&regex);
+                    return NULL;
                 }
+                *res = regex;
+                return res;
+            }
+
+            if (victim->fPattern) {
+                regfree(&victim->fRegex);
+                free(victim->fPattern);
             }
+            victim->fPattern = copy;
+            victim->fRegex = regex;
+            victim->fUsers = 1;
+            victim->fLastUse = ++fClock;
+            return &victim->fRegex;
+        }
+
+        void Release(regex_t* regex)
+        {
+            JackLock lock(this);
 
-            if (matching) {
-                matching_ports[match_cnt++] = port->fName;
+            for (int i = 0; i < REGEX_CACHE_SIZE; i++) {
+                if (regex == &fEntries[i].fRegex) {
+                    fEntries[i].fUsers--;
+                    return;
+                }
             }
+            regfree(regex);
+            free(regex);
+        }
+
+};
+
+static JackRegexCache gRegexCache;
+
+static bool IsRegexChar(char c)
+{
+    return strchr(".[]()*+?{}|^$\\", c) != NULL;
+}
+
+static void ParsePattern(const char* pattern, JackPortPattern* res)
+{
+    res->fKind = PATTERN_ANY;
+    res->fLength = 0;
+    res->fRegex = NULL;
+
+    if (!pattern || !pattern[0]) {
+        return;
+    }
+
+    const char* src = pattern;
+    bool start = false;
+    bool end = false;
+
+    if (*src == '^') {
+        start = true;
+        src++;
+    }
+
+    while (*src) {
+        if (src[0] == '.' && src[1] == '*' && (src[2] == '\0' || (src[2] == '$' && src[3] == '\0'))) {
+            // Trailing ".*" or ".*$" matches anything
+            break;
+        } else if (src[0] == '$' && src[1] == '\0') {
+            end = true;
+            break;
+        } else if (src[0] == '\\' && src[1] && IsRegexChar(src[1])) {
+            // Escaped special character
+            src++;
+        } else if (IsRegexChar(src[0])) {
+            goto regex;
+        }
+        if (res->fLength == sizeof(res->fText) - 1) {
+            goto regex;
         }
+        res->fText[res->fLength++] = *src++;
     }
+    res->fText[res->fLength] = '\0';
+
+    if (start && end) {
+        res->fKind = PATTERN_EXACT;
+    } else if (res->fLength == 0) {
+        res->fKind = PATTERN_ANY;
+    } else if (start) {
+        res->fKind = PATTERN_PREFIX;
+    } else if (end) {
+        res->fKind = PATTERN_SUFFIX;
+    } else {
+        res->fKind = PATTERN_SUBSTRING;
+    }
+    return;
 
-    matching_ports[match_cnt] = 0;
+regex:
+    res->fKind = PATTERN_REGEX;
+    res->fRegex = gRegexCache.Acquire(pattern);
+}
 
-    if (port_name_pattern && port_name_pattern[0]) {
-        regfree(&port_regex);
+static void FreePattern(JackPortPattern* pattern)
+{
+    if (pattern->fRegex) {
+        gRegexCache.Release(pattern->fRegex);
+    }
+}
+
+static bool MatchPattern(const JackPortPattern* pattern, const char* str)
+{
+    switch (pattern->fKind) {
+
+        case PATTERN_ANY:
+            return true;
+
+        case PATTERN_EXACT:
+            return strcmp(str, pattern->fText) == 0;
+
+        case PATTERN_PREFIX:
+            return strncmp(str, pattern->fText, pattern->fLength) == 0;
+
+        case PATTERN_SUFFIX: {
+            size_t len = strlen(str);
+            return len >= pattern->fLength && strcmp(str + len - pattern->fLength, pattern->fText) == 0;
+        }
+
+        case PATTERN_SUBSTRING:
+            return strstr(str, pattern->fText) != NULL;
+
+        default:
+            // A pattern that does not compile matches no port
+            return pattern->fRegex && regexec(pattern->fRegex, str, 0, NULL, 0) == 0;
+    }
+}
+
+// Client
+void JackGraphManager::GetPortsAux(const char** matching_ports, const char* port_name_pattern, const char* type_name_pattern, unsigned long flags)
+{
+    int match_cnt = 0;
+    JackPortPattern port_pattern, type_pattern;
+    jack_int_t candidates[PORT_NUM_MAX];
+    int candidate_cnt = -1;
+
+    ParsePattern(port_name_pattern, &port_pattern);
+    ParsePattern(type_name_pattern, &type_pattern);
+
+    // Cleanup port array
+    memset(matching_ports, 0, sizeof(char*) * fPortMax);
+
+    if (port_pattern.fKind == PATTERN_EXACT) {
+        jack_port_id_t port_index = fPortIndex.Find(fPortArray, port_pattern.fText);
+        candidate_cnt = 0;
+        if (port_index != NO_PORT) {
+            candidates[candidate_cnt++] = port_index;
+        }
+    } else if (port_pattern.fKind == PATTERN_PREFIX) {
+        candidate_cnt = fPortIndex.GetClientPorts(fPortArray, port_pattern.fText, candidates, fPortMax);
     }
-    if (type_name_pattern && type_name_pattern[0]) {
-        regfree(&type_regex);
+
+    int count = (candidate_cnt < 0) ? fPortMax : candidate_cnt;
+
+    for (int i = 0; i < count; i++) {
+        JackPort* port = GetPort((candidate_cnt < 0) ? i : candidates[i]);
+
+        if (port->IsUsed()
+            && (port->fFlags & flags) == flags
+            && MatchPattern(&port_pattern, port->GetName())
+            && MatchPattern(&type_pattern, port->GetType())) {
+            matching_ports[match_cnt++] = port->fName;
+        }
     }
+
+    matching_ports[match_cnt] = 0;
+
+    FreePattern(&port_pattern);
+    FreePattern(&type_pattern);
 }
 
 // Client
@@ -23,6 +23,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 
 #include "JackShmMem.h"
 #include "JackPort.h"
+#include "JackPortIndex.h"
 #include "JackConstants.h"
 #include "JackConnectionManager.h"
 #include "JackAtomicState.h"
@@ -32,6 +33,8 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 namespace Jack
 {
 
+struct JackEngineControl;
+
 /*!
 \brief Graph manager: contains the connection manager and the port array.
 */
@@ -44,9 +47,11 @@ class SERVER_EXPORT JackGraphManager : public JackShmMem, public JackAtomicState
 
         unsigned int fPortMax;
         JackClientTiming fClientTiming[CLIENT_NUM];
+        MEM_ALIGN(JackPortIndex fPortIndex, sizeof(SInt32));
         JackPort fPortArray[0];    // The actual size depends of port_max, it will be dynamically computed and allocated using "placement" new
 
         void AssertPort(jack_port_id_t port_index);
+        jack_port_id_t FindFreePortAux(int refnum);
         jack_port_id_t AllocatePortAux(int refnum, const char* port_name, const char* port_type, JackPortFlags flags);
         void GetConnectionsAux(JackConnectionManager* manager, const char** res, jack_port_id_t port_index);
         void GetPortsAux(const char** matching_ports, const char* port_name_pattern, const char* type_name_pattern, unsigned long flags);
@@ -74,6 +79,11 @@ class SERVER_EXPORT JackGraphManager : public JackShmMem, public JackAtomicState
         JackPort* GetPort(jack_port_id_t index);
         jack_port_id_t GetPort(const char* name);
 
+        // Keep the lookup tables up to date, use them instead of the JackPort methods
+        void SetPortName(jack_port_id_t port_index, const char* name);
+        int SetPortAlias(jack_port_id_t port_index, const char* alias);
+        int UnsetPortAlias(jack_port_id_t port_index, const char* alias);
+
         int ComputeTotalLatency(jack_port_id_t port_index);
         int ComputeTotalLatencies();
         void RecalculateLatency(jack_port_id_t port_index, jack_latency_callback_mode_t mode);
@@ -123,7 +133,7 @@ class SERVER_EXPORT JackGraphManager : public JackShmMem, public JackAtomicState
 
         void InitRefNum(int refnum);
         int ResumeRefNum(JackClientControl* control, JackSynchro* table);
-        int SuspendRefNum(JackClientControl* control, JackSynchro* table, long usecs);
+        int SuspendRefNum(JackClientControl* control, JackSynchro* table, long usecs, JackEngineControl* engine_control = NULL);
         void TopologicalSort(std::vector<jack_int_t>& sorted);
 
         JackClientTiming* GetClientTiming(int refnum)
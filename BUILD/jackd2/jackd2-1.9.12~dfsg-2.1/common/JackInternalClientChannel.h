@@ -90,6 +90,10 @@ class JackInternalClientChannel : public detail::JackClientChannelInterface
         {
             *result = fEngine->PortDisconnect(refnum, src, dst);
         }
+        void PortConnectionTransaction(int refnum, std::list<JackConnectionOp>& ops, int* result)
+        {
+            *result = fEngine->PortConnectionTransaction(refnum, ops);
+        }
         void PortRename(int refnum, jack_port_id_t port, const char* name, int* result)
         {
             *result = fEngine->PortRename(refnum, port, name);
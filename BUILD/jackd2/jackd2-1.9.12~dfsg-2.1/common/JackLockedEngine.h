@@ -238,6 +238,14 @@ class SERVER_EXPORT JackLockedEngine
             CATCH_EXCEPTION_RETURN
         }
 
+        int PortConnectionTransaction(int refnum, std::list<JackConnectionOp>& ops)
+        {
+            TRY_CALL
+            JackLock lock(&fEngine);
+            return (fEngine.CheckClient(refnum)) ? fEngine.PortConnectionTransaction(refnum, ops) : -1;
+            CATCH_EXCEPTION_RETURN
+        }
+
         int PortRename(int refnum, jack_port_id_t port, const char* name)
         {
             TRY_CALL
@@ -254,6 +262,30 @@ class SERVER_EXPORT JackLockedEngine
             CATCH_EXCEPTION_RETURN
         }
 
+        int SetXRunDump(const char* path)
+        {
+            TRY_CALL
+            JackLock lock(&fEngine);
+            return fEngine.SetXRunDump(path);
+            CATCH_EXCEPTION_RETURN
+        }
+
+        int SetSpinWait(long usecs)
+        {
+            TRY_CALL
+            JackLock lock(&fEngine);
+            return fEngine.SetSpinWait(usecs);
+            CATCH_EXCEPTION_RETURN
+        }
+
+        int SetClientPlacement(bool automatic, const char* rules, bool priority_boost)
+        {
+            TRY_CALL
+            JackLock lock(&fEngine);
+            return fEngine.SetClientPlacement(automatic, rules, priority_boost);
+            CATCH_EXCEPTION_RETURN
+        }
+
         // Graph
         bool Process(jack_time_t cur_cycle_begin, jack_time_t prev_cycle_end)
         {
@@ -271,8 +303,14 @@ class SERVER_EXPORT JackLockedEngine
         void NotifyClientXRun(int refnum)
         {
             TRY_CALL
-            JackLock lock(&fEngine);
-            fEngine.NotifyClientXRun(refnum);
+            JackXRunDump* dump;
+            {
+                JackLock lock(&fEngine);
+                dump = fEngine.PrepareXRunDump();
+                fEngine.NotifyClientXRun(refnum);
+            }
+            // Waits for the xrun cycle to be recorded and writes the file : no lock
+            fEngine.WriteXRunDump(dump);
             CATCH_EXCEPTION
         }
 
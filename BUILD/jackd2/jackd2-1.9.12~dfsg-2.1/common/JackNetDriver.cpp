@@ -334,7 +334,7 @@ namespace Jack
             }
 
             port = fGraphManager->GetPort(port_index);
-            port->SetAlias(alias);
+            fGraphManager->SetPortAlias(port_index, alias);
             fCapturePortList[audio_port_index] = port_index;
             jack_log("JackNetDriver::AllocPorts() fCapturePortList[%d] audio_port_index = %ld fPortLatency = %ld", audio_port_index, port_index, port->GetLatency());
         }
@@ -349,7 +349,7 @@ namespace Jack
             }
 
             port = fGraphManager->GetPort(port_index);
-            port->SetAlias(alias);
+            fGraphManager->SetPortAlias(port_index, alias);
             fPlaybackPortList[audio_port_index] = port_index;
             jack_log("JackNetDriver::AllocPorts() fPlaybackPortList[%d] audio_port_index = %ld fPortLatency = %ld", audio_port_index, port_index, port->GetLatency());
         }
@@ -47,6 +47,7 @@ enum NotificationType {
     kQUIT = 16,
     kSessionCallback = 17,
     kLatencyCallback = 18,
+    kPlacementCallback = 19,
     kMaxNotification = 64  // To keep some room in JackClientControl fCallback table
 };
 
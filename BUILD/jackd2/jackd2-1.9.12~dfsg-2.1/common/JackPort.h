@@ -40,6 +40,7 @@ class SERVER_EXPORT JackPort
 {
 
         friend class JackGraphManager;
+        friend class JackPortIndex;
 
     private:
 
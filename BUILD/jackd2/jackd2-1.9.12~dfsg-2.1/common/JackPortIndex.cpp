@@ -0,0 +1,286 @@
+/*
+Copyright (C) 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 2.1 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+*/
+
+#include "JackPortIndex.h"
+#include "JackAtomic.h"
+#include "JackError.h"
+#include <string.h>
+#include <algorithm>
+
+namespace Jack
+{
+
+static inline void MemoryBarrier()
+{
+    __sync_synchronize();
+}
+
+void JackPortIndex::Init()
+{
+    fVersion = 0;
+    for (int i = 0; i < PORT_HASH_SIZE; i++) {
+        fNameTable[i] = EMPTY;
+        fNameHash[i] = 0;
+    }
+    for (int i = 0; i < CLIENT_NUM; i++) {
+        fClientFirst[i] = EMPTY;
+    }
+    for (int i = 0; i < PORT_NUM_MAX; i++) {
+        fClientNext[i] = EMPTY;
+    }
+    for (int i = 0; i < PORT_ALIAS_HASH_SIZE; i++) {
+        fAliasCount[i] = 0;
+    }
+}
+
+// FNV-1a
+UInt32 JackPortIndex::Hash(const char* name)
+{
+    UInt32 hash = 2166136261U;
+    while (*name) {
+        hash = (hash ^ (unsigned char)*name++) * 16777619U;
+    }
+    return hash;
+}
+
+UInt32 JackPortIndex::Hash(const char* name, size_t len)
+{
+    UInt32 hash = 2166136261U;
+    while (len-- > 0 && *name) {
+        hash = (hash ^ (unsigned char)*name++) * 16777619U;
+    }
+    return hash;
+}
+
+void JackPortIndex::WriteStart()
+{
+    fVersion++;
+    MemoryBarrier();
+}
+
+void JackPortIndex::WriteStop()
+{
+    MemoryBarrier();
+    fVersion++;
+}
+
+UInt32 JackPortIndex::ReadStart()
+{
+    UInt32 version;
+    while ((version = fVersion) & 1) {
+        // The server is updating the tables, this only lasts a few instructions
+    }
+    MemoryBarrier();
+    return version;
+}
+
+bool JackPortIndex::ReadRetry(UInt32 version)
+{
+    MemoryBarrier();
+    return fVersion != version;
+}
+
+int JackPortIndex::FindSlot(jack_port_id_t port_index, UInt32 hash)
+{
+    for (int i = 0, slot = hash & (PORT_HASH_SIZE - 1); i < PORT_HASH_SIZE; i++, slot = (slot + 1) & (PORT_HASH_SIZE - 1)) {
+        if (fNameTable[slot] == (jack_int_t)port_index) {
+            return slot;
+        } else if (fNameTable[slot] == EMPTY) {
+            break;
+        }
+    }
+    return -1;
+}
+
+void JackPortIndex::InsertName(jack_port_id_t port_index, const char* name)
+{
+    UInt32 hash = Hash(name);
+    int slot = hash & (PORT_HASH_SIZE - 1);
+
+    // Never full since there are at most PORT_NUM_MAX ports
+    while (fNameTable[slot] != EMPTY) {
+        slot = (slot + 1) & (PORT_HASH_SIZE - 1);
+    }
+    fNameHash[slot] = hash;
+    fNameTable[slot] = port_index;
+}
+
+void JackPortIndex::RemoveName(jack_port_id_t port_index, const char* name)
+{
+    int slot = FindSlot(port_index, Hash(name));
+    if (slot < 0) {
+        jack_error("JackPortIndex::RemoveName port_index = %ld name = %s not found", port_index, name);
+        return;
+    }
+
+    // Backward shift deletion: move back the following entries that would not be found anymore
+    int next = slot;
+    for (;;) {
+        next = (next + 1) & (PORT_HASH_SIZE - 1);
+        if (fNameTable[next] == EMPTY) {
+            break;
+        }
+        int home = fNameHash[next] & (PORT_HASH_SIZE - 1);
+        bool movable = (slot <= next) ? (home <= slot || home > next) : (home <= slot && home > next);
+        if (movable) {
+            fNameTable[slot] = fNameTable[next];
+            fNameHash[slot] = fNameHash[next];
+            slot = next;
+        }
+    }
+    fNameTable[slot] = EMPTY;
+}
+
+void JackPortIndex::AddPort(JackPort* port_array, jack_port_id_t port_index, int refnum)
+{
+    WriteStart();
+
+    InsertName(port_index, port_array[port_index].GetName());
+
+    // Client lists are sorted, GetPorts returns ports in index order
+    jack_int_t prev = EMPTY;
+    jack_int_t next = fClientFirst[refnum];
+    while (next != EMPTY && next < (jack_int_t)port_index) {
+        prev = next;
+        next = fClientNext[next];
+    }
+    fClientNext[port_index] = next;
+    if (prev == EMPTY) {
+        fClientFirst[refnum] = port_index;
+    } else {
+        fClientNext[prev] = port_index;
+    }
+
+    WriteStop();
+}
+
+void JackPortIndex::RemovePort(JackPort* port_array, jack_port_id_t port_index, int refnum)
+{
+    WriteStart();
+
+    RemoveName(port_index, port_array[port_index].GetName());
+
+    jack_int_t prev = EMPTY;
+    jack_int_t next = fClientFirst[refnum];
+    while (next != EMPTY && next != (jack_int_t)port_index) {
+        prev = next;
+        next = fClientNext[next];
+    }
+    if (next != EMPTY) {
+        if (prev == EMPTY) {
+            fClientFirst[refnum] = fClientNext[port_index];
+        } else {
+            fClientNext[prev] = fClientNext[port_index];
+        }
+    }
+    fClientNext[port_index] = EMPTY;
+
+    WriteStop();
+}
+
+void JackPortIndex::RenamePort(JackPort* port_array, jack_port_id_t port_index, const char* name)
+{
+    // The client part of the name does not change, so the client lists stay valid
+    WriteStart();
+    RemoveName(port_index, port_array[port_index].GetName());
+    port_array[port_index].SetName(name);
+    InsertName(port_index, port_array[port_index].GetName());
+    WriteStop();
+}
+
+void JackPortIndex::AddAlias(const char* alias)
+{
+    INC_ATOMIC(&fAliasCount[Hash(alias) & (PORT_ALIAS_HASH_SIZE - 1)]);
+}
+
+void JackPortIndex::RemoveAlias(const char* alias)
+{
+    DEC_ATOMIC(&fAliasCount[Hash(alias) & (PORT_ALIAS_HASH_SIZE - 1)]);
+}
+
+bool JackPortIndex::MayBeAlias(const char* name)
+{
+    return fAliasCount[Hash(name) & (PORT_ALIAS_HASH_SIZE - 1)] != 0;
+}
+
+jack_port_id_t JackPortIndex::Find(JackPort* port_array, const char* name)
+{
+    UInt32 hash = Hash(name);
+    UInt32 version;
+    jack_port_id_t res;
+
+    do {
+        version = ReadStart();
+        res = NO_PORT;
+        for (int i = 0, slot = hash & (PORT_HASH_SIZE - 1); i < PORT_HASH_SIZE; i++, slot = (slot + 1) & (PORT_HASH_SIZE - 1)) {
+            jack_int_t port_index = fNameTable[slot];
+            if (port_index == EMPTY) {
+                break;
+            }
+            if (fNameHash[slot] == hash && port_index < PORT_NUM_MAX) {
+                JackPort* port = &port_array[port_index];
+                if (port->IsUsed() && strcmp(port->GetName(), name) == 0) {
+                    res = port_index;
+                    break;
+                }
+            }
+        }
+    } while (ReadRetry(version));
+
+    return res;
+}
+
+int JackPortIndex::GetClientPorts(JackPort* port_array, const char* prefix, jack_int_t* res, int res_size)
+{
+    // All ports of a client share the "client:" part of their name
+    const char* colon = strchr(prefix, ':');
+    size_t prefix_len = strlen(prefix);
+    size_t client_len = (colon) ? (colon - prefix + 1) : prefix_len;
+    UInt32 version;
+    int count;
+
+    do {
+        version = ReadStart();
+        count = 0;
+        int clients = 0;
+        for (int refnum = 0; refnum < CLIENT_NUM; refnum++) {
+            jack_int_t port_index = fClientFirst[refnum];
+            if (port_index == EMPTY || port_index >= PORT_NUM_MAX
+                || strncmp(port_array[port_index].GetName(), prefix, client_len) != 0) {
+                continue;
+            }
+            clients++;
+            for (int ports = 0; port_index != EMPTY && port_index < PORT_NUM_MAX && ports < PORT_NUM_MAX; ports++) {
+                JackPort* port = &port_array[port_index];
+                if (port->IsUsed() && strncmp(port->GetName(), prefix, prefix_len) == 0 && count < res_size) {
+                    res[count++] = port_index;
+                }
+                port_index = fClientNext[port_index];
+            }
+        }
+        // Each list is sorted, several clients may match a prefix without ':'
+        if (clients > 1) {
+            std::sort(res, res + count);
+        }
+    } while (ReadRetry(version));
+
+    return count;
+}
+
+} // end of namespace
@@ -0,0 +1,97 @@
+/*
+Copyright (C) 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation; either version 2.1 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+*/
+
+#ifndef __JackPortIndex__
+#define __JackPortIndex__
+
+#include "JackPort.h"
+#include "JackConstants.h"
+#include "JackTypes.h"
+#include "JackCompilerDeps.h"
+
+namespace Jack
+{
+
+#define PORT_HASH_SIZE (PORT_NUM_MAX * 2)     // Power of two, keeps the name table at most half full
+#define PORT_ALIAS_HASH_SIZE 4096             // Power of two
+
+/*!
+\brief Port lookup tables, kept in the graph manager shared memory next to the port array.
+
+The name table is an open addressing hash table of port full names, and each client has the sorted list of its
+ports, so that "client:prefix" patterns only look at the ports of the matching clients. Both are only written by
+the server: clients read them under a sequence counter, and retry if the server changed them in the meantime.
+
+Aliases are set by clients as well, so they are only counted per hash bucket with atomic operations: a zero count
+tells that no port has a given alias without scanning the port array.
+*/
+
+PRE_PACKED_STRUCTURE
+class SERVER_EXPORT JackPortIndex
+{
+
+    private:
+
+        volatile UInt32 fVersion;                           // Odd while the server updates the tables
+        jack_int_t fNameTable[PORT_HASH_SIZE];              // Port index or EMPTY
+        UInt32 fNameHash[PORT_HASH_SIZE];                   // Hash of the port name, to skip most string compares
+        jack_int_t fClientFirst[CLIENT_NUM];                // First port of each client or EMPTY
+        jack_int_t fClientNext[PORT_NUM_MAX];               // Next port of the same client or EMPTY
+        MEM_ALIGN(volatile SInt32 fAliasCount[PORT_ALIAS_HASH_SIZE], sizeof(SInt32));  // Atomic counters, kept aligned
+
+        int FindSlot(jack_port_id_t port_index, UInt32 hash);
+        void InsertName(jack_port_id_t port_index, const char* name);
+        void RemoveName(jack_port_id_t port_index, const char* name);
+
+        void WriteStart();
+        void WriteStop();
+        UInt32 ReadStart();
+        bool ReadRetry(UInt32 version);
+
+    public:
+
+        JackPortIndex()
+        {
+            Init();
+        }
+
+        void Init();
+
+        static UInt32 Hash(const char* name);
+        static UInt32 Hash(const char* name, size_t len);
+
+        // Server
+        void AddPort(JackPort* port_array, jack_port_id_t port_index, int refnum);
+        void RemovePort(JackPort* port_array, jack_port_id_t port_index, int refnum);
+        void RenamePort(JackPort* port_array, jack_port_id_t port_index, const char* name);
+
+        // Server and clients
+        void AddAlias(const char* alias);
+        void RemoveAlias(const char* alias);
+        bool MayBeAlias(const char* name);
+
+        // Client
+        jack_port_id_t Find(JackPort* port_array, const char* name);
+        int GetClientPorts(JackPort* port_array, const char* prefix, jack_int_t* res, int res_size);
+
+} POST_PACKED_STRUCTURE;
+
+} // end of namespace
+
+#endif
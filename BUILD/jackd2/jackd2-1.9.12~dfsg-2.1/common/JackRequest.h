@@ -89,7 +89,8 @@ struct JackRequest
         kReserveClientName = 36,
         kGetUUIDByClient = 37,
         kClientHasSessionCallback = 38,
-        kComputeTotalLatencies = 39
+        kComputeTotalLatencies = 39,
+        kConnectionTransaction = 40
     };
 
     RequestType fType;
@@ -693,6 +694,133 @@ struct JackPortDisconnectRequest : public JackRequest
     int Size() { return sizeof(int) + sizeof(jack_port_id_t) + sizeof(jack_port_id_t); }
 };
 
+/*!
+\brief Connection or disconnection of two named ports, queued in a connection transaction.
+*/
+
+struct JackConnectionOp
+{
+
+    int fConnect;
+    int fResult;
+    char fSrc[REAL_JACK_PORT_NAME_SIZE+1];    // port full name
+    char fDst[REAL_JACK_PORT_NAME_SIZE+1];    // port full name
+
+    JackConnectionOp() : fConnect(0), fResult(-1)
+    {
+        memset(fSrc, 0, sizeof(fSrc));
+        memset(fDst, 0, sizeof(fDst));
+    }
+    JackConnectionOp(bool connect, const char* src_name, const char* dst_name)
+        : fConnect(connect), fResult(-1)
+    {
+        memset(fSrc, 0, sizeof(fSrc));
+        memset(fDst, 0, sizeof(fDst));
+        strncpy(fSrc, src_name, sizeof(fSrc)-1);
+        strncpy(fDst, dst_name, sizeof(fDst)-1);
+    }
+
+};
+
+/*!
+\brief ConnectionTransaction request: a set of connections/disconnections applied in a single graph state switch.
+*/
+
+struct JackConnectionTransactionRequest : public JackRequest
+{
+
+    int fRefNum;
+    std::list<JackConnectionOp> fOps;
+
+    JackConnectionTransactionRequest() : fRefNum(0)
+    {}
+    JackConnectionTransactionRequest(int refnum, const std::list<JackConnectionOp>& ops)
+        : JackRequest(JackRequest::kConnectionTransaction), fRefNum(refnum), fOps(ops)
+    {}
+
+    int Read(detail::JackChannelTransactionInterface* trans)
+    {
+        int count;
+        CheckRes(trans->Read(&fSize, sizeof(int)));
+        CheckRes(trans->Read(&fRefNum, sizeof(int)));
+        CheckRes(trans->Read(&count, sizeof(int)));
+        if (count < 0 || count > CONNECTION_TRANSACTION_NUM || fSize != Size(count)) {
+            jack_error("CheckSize error size = %d count = %d", fSize, count);
+            return -1;
+        }
+        for (int i = 0; i < count; i++) {
+            JackConnectionOp op;
+            CheckRes(trans->Read(&op.fConnect, sizeof(int)));
+            CheckRes(trans->Read(&op.fSrc, sizeof(op.fSrc)));
+            CheckRes(trans->Read(&op.fDst, sizeof(op.fDst)));
+            op.fSrc[sizeof(op.fSrc)-1] = 0;
+            op.fDst[sizeof(op.fDst)-1] = 0;
+            fOps.push_back(op);
+        }
+        return 0;
+    }
+
+    int Write(detail::JackChannelTransactionInterface* trans)
+    {
+        int count = fOps.size();
+        CheckRes(JackRequest::Write(trans, Size()));
+        CheckRes(trans->Write(&fRefNum, sizeof(int)));
+        CheckRes(trans->Write(&count, sizeof(int)));
+        for (std::list<JackConnectionOp>::iterator i = fOps.begin(); i != fOps.end(); i++) {
+            CheckRes(trans->Write(&i->fConnect, sizeof(int)));
+            CheckRes(trans->Write(&i->fSrc, sizeof(i->fSrc)));
+            CheckRes(trans->Write(&i->fDst, sizeof(i->fDst)));
+        }
+        return 0;
+    }
+
+    int Size(int count) { return 2 * sizeof(int) + count * (sizeof(int) + 2 * (REAL_JACK_PORT_NAME_SIZE+1)); }
+    int Size() { return Size(fOps.size()); }
+
+};
+
+/*!
+\brief ConnectionTransaction result: the number of failed operations and the result of each of them.
+*/
+
+struct JackConnectionTransactionResult : public JackResult
+{
+
+    std::list<int> fResults;
+
+    JackConnectionTransactionResult(): JackResult()
+    {}
+
+    int Read(detail::JackChannelTransactionInterface* trans)
+    {
+        int count;
+        CheckRes(JackResult::Read(trans));
+        CheckRes(trans->Read(&count, sizeof(int)));
+        if (count < 0 || count > CONNECTION_TRANSACTION_NUM) {
+            jack_error("JackConnectionTransactionResult::Read incorrect count = %d", count);
+            return -1;
+        }
+        for (int i = 0; i < count; i++) {
+            int result;
+            CheckRes(trans->Read(&result, sizeof(int)));
+            fResults.push_back(result);
+        }
+        return 0;
+    }
+
+    int Write(detail::JackChannelTransactionInterface* trans)
+    {
+        int count = fResults.size();
+        CheckRes(JackResult::Write(trans));
+        CheckRes(trans->Write(&count, sizeof(int)));
+        for (std::list<int>::iterator i = fResults.begin(); i != fResults.end(); i++) {
+            CheckRes(trans->Write(&(*i), sizeof(int)));
+        }
+        return 0;
+    }
+
+};
+
 /*!
 \brief PortRename request.
 */
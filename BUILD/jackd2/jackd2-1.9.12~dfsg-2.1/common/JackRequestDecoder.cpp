@@ -167,6 +167,19 @@ int JackRequestDecoder::HandleRequest(detail::JackChannelTransactionInterface* s
             break;
         }
 
+        case JackRequest::kConnectionTransaction: {
+            jack_log("JackRequest::ConnectionTransaction");
+            JackConnectionTransactionRequest req;
+            JackConnectionTransactionResult res;
+            CheckRead(req, socket);
+            res.fResult = fServer->GetEngine()->PortConnectionTransaction(req.fRefNum, req.fOps);
+            for (std::list<JackConnectionOp>::iterator i = req.fOps.begin(); i != req.fOps.end(); i++) {
+                res.fResults.push_back(i->fResult);
+            }
+            CheckWriteRefNum("JackRequest::ConnectionTransaction", socket);
+            break;
+        }
+
         case JackRequest::kPortRename: {
             jack_log("JackRequest::PortRename");
             JackPortRenameRequest req;
@@ -63,6 +63,10 @@ class JackSynchro
         {
             return true;
         }
+        bool SpinWait(long sleep_usec, long spin_usec)
+        {
+            return false;   // Not supported, the caller then uses TimedWait
+        }
         bool Allocate(const char* name, const char* server_name, int value)
         {
             return true;
@@ -91,6 +95,11 @@ class JackSynchro
             fFlush = mode;
         }
 
+        static int GetCPU()
+        {
+            return -1;
+        }
+
 };
 
 }
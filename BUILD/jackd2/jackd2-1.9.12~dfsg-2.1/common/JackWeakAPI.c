@@ -224,6 +224,9 @@ DECL_FUNCTION(int, jack_port_monitoring_input, (jack_port_t *port) ,(port));
 DECL_FUNCTION(int, jack_connect, (jack_client_t * client, const char *source_port, const char *destination_port), (client, source_port, destination_port));
 DECL_FUNCTION(int, jack_disconnect, (jack_client_t * client, const char *source_port, const char *destination_port), (client, source_port, destination_port));
 DECL_FUNCTION(int, jack_port_disconnect, (jack_client_t * client, jack_port_t * port), (client, port));
+DECL_FUNCTION(int, jack_connection_transaction_begin, (jack_client_t * client), (client));
+DECL_FUNCTION(int, jack_connection_transaction_commit, (jack_client_t * client, int *results), (client, results));
+DECL_FUNCTION(int, jack_connection_transaction_abort, (jack_client_t * client), (client));
 DECL_FUNCTION(int, jack_port_name_size,(),());
 DECL_FUNCTION(int, jack_port_type_size,(),());
 DECL_FUNCTION(size_t, jack_port_type_get_buffer_size, (jack_client_t *client, const char* port_type), (client, port_type));
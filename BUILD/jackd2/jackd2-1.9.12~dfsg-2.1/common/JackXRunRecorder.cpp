@@ -0,0 +1,272 @@
+/*
+Copyright (C) 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+*/
+
+#include "JackSystemDeps.h"
+#include "JackXRunRecorder.h"
+#include "JackClientInterface.h"
+#include "JackClientControl.h"
+#include "JackGraphManager.h"
+#include "JackTime.h"
+#include "JackError.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+namespace Jack
+{
+
+static inline void XRunMemoryBarrier()
+{
+    __sync_synchronize();
+}
+
+static inline int XRunOffset(jack_time_t date, jack_time_t cycle_begin)
+{
+    return (date == 0) ? -1 : int(date - cycle_begin);
+}
+
+static const char* XRunState2String(int state)
+{
+    switch (state) {
+        case NotTriggered:
+            return "NotTriggered";
+        case Triggered:
+            return "Triggered";
+        case Running:
+            return "Running";
+        case Finished:
+            return "Finished";
+        default:
+            return "Unknown";
+    }
+}
+
+JackXRunRecorder::JackXRunRecorder()
+{
+    fRecords = NULL;
+    fWriteIndex = 0;
+    fPath[0] = 0;
+    fCycle = 0;
+    fCurCycleBegin = 0;
+    fGraphSwitched = false;
+    fXRunMarks = 0;
+    fXRunRecorded = 0;
+    fXRunDelayed = 0.f;
+    fLastDump = 0;
+    fDumpNum = 0;
+}
+
+JackXRunRecorder::~JackXRunRecorder()
+{
+    delete[] fRecords;
+}
+
+int JackXRunRecorder::Init(const char* path)
+{
+    if (!path || path[0] == 0) {
+        return 0;
+    }
+
+    strncpy(fPath, path, XRUN_PATH_SIZE - 1);
+    fPath[XRUN_PATH_SIZE - 1] = 0;
+    fRecords = new JackXRunRecord[XRUN_RECORD_NUM];
+    memset(fRecords, 0, sizeof(JackXRunRecord) * XRUN_RECORD_NUM);
+    jack_info("JackXRunRecorder::Init recording %d cycles, dumps in '%s'", XRUN_RECORD_NUM, fPath);
+    return 0;
+}
+
+// RT
+void JackXRunRecorder::Record(JackClientInterface** table, JackGraphManager* manager, int driver_num,
+                              jack_time_t period_usecs, jack_time_t cur_cycle_begin, jack_time_t prev_cycle_end)
+{
+    if (!fRecords) {
+        return;
+    }
+
+    // Client timings are still the ones of the previous cycle, which is the one recorded
+    if (fCurCycleBegin > 0) {
+        JackXRunRecord* record = &fRecords[fWriteIndex & (XRUN_RECORD_NUM - 1)];
+        unsigned int marks = fXRunMarks;
+
+        record->fCycle = fCycle;
+        record->fBegin = fCurCycleBegin;
+        record->fEnd = (prev_cycle_end > fCurCycleBegin) ? int(prev_cycle_end - fCurCycleBegin) : -1;
+        record->fNext = int(cur_cycle_begin - fCurCycleBegin);
+        record->fPeriodUsecs = int(period_usecs);
+        record->fXRunDelayed = (marks != fXRunRecorded) ? fXRunDelayed : -1.f;
+        record->fGraphSwitched = fGraphSwitched;
+        record->fGraphFinished = manager->IsFinishedGraph();
+        record->fClientNum = 0;
+
+        for (int i = driver_num; i < CLIENT_NUM && record->fClientNum < XRUN_RECORD_CLIENTS; i++) {
+            JackClientInterface* client = table[i];
+            if (client && client->GetClientControl()->fActive) {
+                JackClientTiming* timing = manager->GetClientTiming(i);
+                JackXRunClientRecord* client_record = &record->fClients[record->fClientNum++];
+                client_record->fRefNum = i;
+                client_record->fStatus = timing->fStatus;
+                client_record->fSignaled = XRunOffset(timing->fSignaledAt, fCurCycleBegin);
+                client_record->fAwake = XRunOffset(timing->fAwakeAt, fCurCycleBegin);
+                client_record->fFinished = XRunOffset(timing->fFinishedAt, fCurCycleBegin);
+            }
+        }
+
+        // Publish the record, then tell a waiting dump that the xrun is in the ring
+        XRunMemoryBarrier();
+        fWriteIndex = fWriteIndex + 1;
+        XRunMemoryBarrier();
+        fXRunRecorded = marks;
+    }
+
+    fCycle++;
+    fCurCycleBegin = cur_cycle_begin;
+    fGraphSwitched = false;
+}
+
+// RT
+void JackXRunRecorder::MarkXRun(float delayed_usecs)
+{
+    if (fRecords) {
+        fXRunDelayed = delayed_usecs;
+        XRunMemoryBarrier();
+        fXRunMarks = fXRunMarks + 1;
+    }
+}
+
+int JackXRunRecorder::WaitRecords(jack_time_t period_usecs)
+{
+    // The xrun is recorded at the beginning of the next cycle, wait for it a few periods at most
+    for (int i = 0; i < 8; i++) {
+        if (fXRunRecorded == fXRunMarks) {
+            return 0;
+        }
+        JackSleep(long(period_usecs / 2));
+    }
+    return -1;
+}
+
+JackXRunDump* JackXRunRecorder::PrepareDump(JackClientInterface** table, const char* server_name, jack_nframes_t buffer_size,
+                                           jack_nframes_t sample_rate, jack_time_t period_usecs)
+{
+    if (!fRecords || fDumpNum >= XRUN_DUMP_MAX) {
+        return NULL;
+    }
+
+    // Only one dump per interval when xruns come in bursts, the ring covers several seconds anyway
+    jack_time_t now = GetMicroSeconds();
+    if (fLastDump > 0 && now - fLastDump < XRUN_DUMP_INTERVAL) {
+        return NULL;
+    }
+    fLastDump = now;
+
+    JackXRunDump* dump = new JackXRunDump;
+    strncpy(dump->fServerName, server_name, JACK_SERVER_NAME_SIZE);
+    dump->fServerName[JACK_SERVER_NAME_SIZE] = 0;
+    dump->fBufferSize = buffer_size;
+    dump->fSampleRate = sample_rate;
+    dump->fPeriodUsecs = period_usecs;
+    for (int i = 0; i < CLIENT_NUM; i++) {
+        JackClientInterface* client = table[i];
+        dump->fClientNames[i][0] = 0;
+        if (client) {
+            strncpy(dump->fClientNames[i], client->GetClientControl()->fName, JACK_CLIENT_NAME_SIZE);
+            dump->fClientNames[i][JACK_CLIENT_NAME_SIZE] = 0;
+        }
+    }
+    dump->fDumpNum = fDumpNum++;
+    return dump;
+}
+
+void JackXRunRecorder::WriteDump(JackXRunDump* dump)
+{
+    if (!dump) {
+        return;
+    }
+
+    if (WaitRecords(dump->fPeriodUsecs) < 0) {
+        jack_log("JackXRunRecorder::WriteDump xrun cycle not recorded yet");
+    }
+
+    // Copy the ring, then drop what the RT thread may have overwritten meanwhile
+    JackXRunRecord* records = new JackXRunRecord[XRUN_RECORD_NUM];
+    unsigned int end = fWriteIndex;
+    XRunMemoryBarrier();
+    unsigned int begin = (end > XRUN_RECORD_NUM) ? end - XRUN_RECORD_NUM : 0;
+    for (unsigned int i = begin; i != end; i++) {
+        records[i & (XRUN_RECORD_NUM - 1)] = fRecords[i & (XRUN_RECORD_NUM - 1)];
+    }
+    XRunMemoryBarrier();
+    unsigned int written = fWriteIndex;
+    if (written - begin >= XRUN_RECORD_NUM) {
+        begin = written - XRUN_RECORD_NUM + 1;
+    }
+
+    char date[32];
+    char file_name[XRUN_PATH_SIZE + JACK_SERVER_NAME_SIZE + 64];
+    time_t wall_time = time(NULL);
+    strftime(date, sizeof(date), "%Y%m%d-%H%M%S", localtime(&wall_time));
+    snprintf(file_name, sizeof(file_name), "%s/jack-xrun-%s-%s-%d.txt", fPath, dump->fServerName, date, dump->fDumpNum);
+
+    FILE* file = fopen(file_name, "w");
+    if (!file) {
+        jack_error("JackXRunRecorder::WriteDump cannot open '%s' err = %s", file_name, strerror(errno));
+        delete[] records;
+        delete dump;
+        return;
+    }
+
+    fprintf(file, "# jackd xrun dump\n");
+    fprintf(file, "server %s\n", dump->fServerName);
+    fprintf(file, "buffer_size %u\n", dump->fBufferSize);
+    fprintf(file, "sample_rate %u\n", dump->fSampleRate);
+    fprintf(file, "period %ld\n", long(dump->fPeriodUsecs));
+    for (int i = 0; i < CLIENT_NUM; i++) {
+        if (dump->fClientNames[i][0]) {
+            fprintf(file, "name %d %s\n", i, dump->fClientNames[i]);
+        }
+    }
+
+    int xruns = 0;
+    for (unsigned int i = begin; (int)(end - i) > 0; i++) {
+        JackXRunRecord* record = &records[i & (XRUN_RECORD_NUM - 1)];
+        fprintf(file, "cycle %u begin %lld end %d next %d period %d switched %d finished %d xrun ",
+                record->fCycle, (long long)record->fBegin, record->fEnd, record->fNext, record->fPeriodUsecs,
+                record->fGraphSwitched, record->fGraphFinished);
+        if (record->fXRunDelayed >= 0.f) {
+            fprintf(file, "%.0f\n", record->fXRunDelayed);
+            xruns++;
+        } else {
+            fprintf(file, "-\n");
+        }
+        for (int j = 0; j < record->fClientNum; j++) {
+            JackXRunClientRecord* client_record = &record->fClients[j];
+            fprintf(file, " client %d %s %d %d %d\n", client_record->fRefNum, XRunState2String(client_record->fStatus),
+                    client_record->fSignaled, client_record->fAwake, client_record->fFinished);
+        }
+    }
+
+    fclose(file);
+    delete[] records;
+    delete dump;
+    jack_info("JackXRunRecorder::WriteDump %d cycles, %d xrun(s) written in '%s'", int(end - begin), xruns, file_name);
+}
+
+} // end of namespace
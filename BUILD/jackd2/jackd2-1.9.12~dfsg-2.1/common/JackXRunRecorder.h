@@ -0,0 +1,145 @@
+/*
+Copyright (C) 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+*/
+
+#ifndef __JackXRunRecorder__
+#define __JackXRunRecorder__
+
+#include "types.h"
+#include "JackConstants.h"
+#include "JackCompilerDeps.h"
+
+namespace Jack
+{
+
+class JackClientInterface;
+class JackGraphManager;
+
+#define XRUN_RECORD_NUM 2048            // Must be a power of two
+#define XRUN_RECORD_CLIENTS 32
+#define XRUN_DUMP_INTERVAL 1000000      // In usecs
+#define XRUN_DUMP_MAX 100
+#define XRUN_PATH_SIZE 256
+
+/*!
+\brief Timing of one client in a recorded cycle, in usecs from the cycle begin, -1 when not reached.
+*/
+
+struct JackXRunClientRecord
+{
+    short fRefNum;
+    short fStatus;
+    int fSignaled;
+    int fAwake;
+    int fFinished;
+};
+
+/*!
+\brief One recorded cycle: driver begin and end dates, wait until the next cycle, clients timings.
+*/
+
+struct JackXRunRecord
+{
+    unsigned int fCycle;
+    jack_time_t fBegin;
+    int fEnd;                   // Driver end date, from fBegin
+    int fNext;                  // Next cycle begin, from fBegin
+    int fPeriodUsecs;
+    float fXRunDelayed;         // Delay reported by the driver at the next cycle, -1 when none
+    bool fGraphSwitched;        // The cycle started with a new graph state
+    bool fGraphFinished;        // All clients were finished when the next cycle began
+    int fClientNum;
+    JackXRunClientRecord fClients[XRUN_RECORD_CLIENTS];
+};
+
+/*!
+\brief What a dump needs from the engine, taken with the engine lock held so that the file can be written without it.
+*/
+
+struct JackXRunDump
+{
+    char fServerName[JACK_SERVER_NAME_SIZE + 1];
+    jack_nframes_t fBufferSize;
+    jack_nframes_t fSampleRate;
+    jack_time_t fPeriodUsecs;
+    char fClientNames[CLIENT_NUM][JACK_CLIENT_NAME_SIZE + 1];   // Empty when no client
+    int fDumpNum;
+};
+
+/*!
+\brief Xrun forensics: the RT thread keeps the last seconds of cycle records in a ring, the server thread writes them to a file each time an xrun is notified.
+
+The ring has a single writer (the RT thread) and is read without lock: records that were overwritten while
+being copied are detected using the write index and dropped.
+*/
+
+class SERVER_EXPORT JackXRunRecorder
+{
+
+    private:
+
+        JackXRunRecord* fRecords;
+        volatile unsigned int fWriteIndex;
+        char fPath[XRUN_PATH_SIZE];
+
+        // RT thread state
+        unsigned int fCycle;
+        jack_time_t fCurCycleBegin;
+        bool fGraphSwitched;
+        volatile unsigned int fXRunMarks;
+        volatile unsigned int fXRunRecorded;
+        volatile float fXRunDelayed;
+
+        // Server thread state
+        jack_time_t fLastDump;
+        int fDumpNum;
+
+        int WaitRecords(jack_time_t period_usecs);
+
+    public:
+
+        JackXRunRecorder();
+        ~JackXRunRecorder();
+
+        int Init(const char* path);
+
+        bool IsActive()
+        {
+            return fRecords != NULL;
+        }
+
+        // RT
+        void Record(JackClientInterface** table, JackGraphManager* manager, int driver_num,
+                    jack_time_t period_usecs, jack_time_t cur_cycle_begin, jack_time_t prev_cycle_end);
+        void GraphSwitched()
+        {
+            fGraphSwitched = true;
+        }
+        void MarkXRun(float delayed_usecs);
+
+        // Server, engine locked
+        JackXRunDump* PrepareDump(JackClientInterface** table, const char* server_name, jack_nframes_t buffer_size,
+                                  jack_nframes_t sample_rate, jack_time_t period_usecs);
+        // Server, engine unlocked
+        void WriteDump(JackXRunDump* dump);
+
+};
+
+} // end of namespace
+
+#endif
@@ -37,6 +37,8 @@ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
 #include "JackControlAPIAndroid.h"
 #endif
 
+#define SLAVE_DRIVER_ARGS_MAX 32
+
 #if defined(JACK_DBUS) && defined(__linux__)
 #include <cstdlib>
 #include <dbus/dbus.h>
@@ -200,10 +202,15 @@ static void usage(FILE* file, jackctl_server_t *server, bool full = true)
             "               [ --timeout OR -t client-timeout-in-msecs ]\n"
             "               [ --loopback OR -L loopback-port-number ]\n"
             "               [ --port-max OR -p maximum-number-of-ports]\n"
-            "               [ --slave-backend OR -X slave-backend-name ]\n"
+            "               [ --slave-backend OR -X \"slave-backend-name [ slave-backend-args ]\" ]\n"
             "               [ --internal-client OR -I internal-client-name ]\n"
             "               [ --internal-session-file OR -C internal-session-file ]\n"
             "               [ --verbose OR -v ]\n"
+            "               [ --cpu-placement OR -A [ --cpu-placement-priority ] ]\n"
+            "               [ --cpu-pin OR -N name=cpu[/priority-offset][,...] ]\n"
+            "               [ --xrun-dump OR -x directory ]\n"
+            "               [ --spin-wait OR -W usecs ]\n"
+            "               [ --hugepages OR -H ]\n"
 #ifdef __linux__
             "               [ --clocksource OR -c [ h(pet) | s(ystem) ]\n"
 #endif
@@ -260,13 +267,14 @@ int main(int argc, char** argv)
     jackctl_driver_t * master_driver_ctl;
     jackctl_driver_t * loopback_driver_ctl = NULL;
     int replace_registry = 0;
+    int cpu_placement_priority = 0;
 
     for(int a = 1; a < argc; ++a) {
         if( !strcmp(argv[a], "--version") || !strcmp(argv[a], "-V") ) {
             print_version();
         }
     }
-    const char *options = "-d:X:I:P:uvshrRL:STFl:t:mn:p:C:"
+    const char *options = "-d:X:I:P:uvshrRL:STFl:t:mn:p:C:AN:x:W:H"
         "a:"
 #ifdef __linux__
         "c:"
@@ -298,6 +306,12 @@ int main(int argc, char** argv)
                                        { "silent", 0, 0, 's' },
                                        { "sync", 0, 0, 'S' },
                                        { "autoconnect", 1, 0, 'a' },
+                                       { "cpu-placement", 0, 0, 'A' },
+                                       { "cpu-pin", 1, 0, 'N' },
+                                       { "cpu-placement-priority", 0, &cpu_placement_priority, 1 },
+                                       { "xrun-dump", 1, 0, 'x' },
+                                       { "spin-wait", 1, 0, 'W' },
+                                       { "hugepages", 0, 0, 'H' },
                                        { 0, 0, 0, 0 }
                                    };
 
@@ -387,6 +401,46 @@ int main(int argc, char** argv)
                 }
                 break;
 
+            case 'A':
+                param = jackctl_get_parameter(server_parameters, "cpu-placement");
+                if (param != NULL) {
+                    value.b = true;
+                    jackctl_parameter_set_value(param, &value);
+                }
+                break;
+
+            case 'N':
+                param = jackctl_get_parameter(server_parameters, "cpu-pin");
+                if (param != NULL) {
+                    strncpy(value.str, optarg, JACK_PARAM_STRING_MAX);
+                    jackctl_parameter_set_value(param, &value);
+                }
+                break;
+
+            case 'x':
+                param = jackctl_get_parameter(server_parameters, "xrun-dump");
+                if (param != NULL) {
+                    strncpy(value.str, optarg, JACK_PARAM_STRING_MAX);
+                    jackctl_parameter_set_value(param, &value);
+                }
+                break;
+
+            case 'W':
+                param = jackctl_get_parameter(server_parameters, "spin-wait");
+                if (param != NULL) {
+                    value.ui = atoi(optarg);
+                    jackctl_parameter_set_value(param, &value);
+                }
+                break;
+
+            case 'H':
+                param = jackctl_get_parameter(server_parameters, "hugepages");
+                if (param != NULL) {
+                    value.b = true;
+                    jackctl_parameter_set_value(param, &value);
+                }
+                break;
+
             case 'd':
                 master_driver_name = optarg;
                 break;
@@ -490,6 +544,10 @@ int main(int argc, char** argv)
                 }
                 break;
 
+            case 0:
+                // Long option which only sets a flag
+                break;
+
             default:
                 fprintf(stderr, "unknown option character %c\n", optopt);
                 /*fallthru*/
@@ -507,6 +565,14 @@ int main(int argc, char** argv)
         jackctl_parameter_set_value(param, &value);
     }
 
+    if (cpu_placement_priority) {
+        param = jackctl_get_parameter(server_parameters, "cpu-placement-priority");
+        if (param != NULL) {
+            value.b = true;
+            jackctl_parameter_set_value(param, &value);
+        }
+    }
+
     if (!master_driver_name) {
         usage(stderr, server_ctl, false);
         goto destroy_server;
@@ -558,6 +624,16 @@ int main(int argc, char** argv)
 
     // Slave drivers
     for (it = slaves_list.begin(); it != slaves_list.end(); it++) {
+        // Split "name args..." in place, so that *it is left with the name
+        char* slave_driver_args[SLAVE_DRIVER_ARGS_MAX];
+        int slave_driver_nargs = 0;
+        for (char* arg = strtok(*it, " \t"); arg && slave_driver_nargs < SLAVE_DRIVER_ARGS_MAX; arg = strtok(NULL, " \t")) {
+            slave_driver_args[slave_driver_nargs++] = arg;
+        }
+        if (slave_driver_nargs == 0) {
+            fprintf(stderr, "No slave driver name\n");
+            goto close_server;
+        }
         jackctl_driver_t * slave_driver_ctl = jackctl_server_get_driver(server_ctl, *it);
         if (slave_driver_ctl == NULL) {
             fprintf(stderr, "Unknown driver \"%s\"\n", *it);
@@ -567,6 +643,9 @@ int main(int argc, char** argv)
             fprintf(stderr, "Driver \"%s\" is not a slave \n", *it);
             goto close_server;
         }
+        if (jackctl_driver_params_parse(slave_driver_ctl, slave_driver_nargs, slave_driver_args)) {
+            goto close_server;
+        }
         if (!jackctl_server_add_slave(server_ctl, slave_driver_ctl)) {
             fprintf(stderr, "Driver \"%s\" cannot be loaded\n", *it);
             goto close_server;
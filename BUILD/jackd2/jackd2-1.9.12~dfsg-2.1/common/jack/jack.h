@@ -1022,6 +1022,42 @@ int jack_disconnect (jack_client_t *client,
  */
 int jack_port_disconnect (jack_client_t *client, jack_port_t *port) JACK_OPTIONAL_WEAK_EXPORT;
 
+/**
+ * Start a connection transaction. Until jack_connection_transaction_commit()
+ * or jack_connection_transaction_abort() is called, jack_connect() and
+ * jack_disconnect() calls made by @a client are only queued (and return 0),
+ * up to 4096 of them.
+ *
+ * Committing the transaction applies all queued changes in a single
+ * server request and a single graph state switch, so that restoring a
+ * large set of connections causes only one graph reorder.
+ *
+ * @return 0 on success, otherwise a non-zero error code
+ */
+int jack_connection_transaction_begin (jack_client_t *client) JACK_OPTIONAL_WEAK_EXPORT;
+
+/**
+ * Apply the connections and disconnections queued since
+ * jack_connection_transaction_begin(), in the order they were made.
+ * Port connect callbacks are called once the whole set has been applied.
+ *
+ * @param results if not NULL, an array with one element per queued
+ * operation, that receives the value the corresponding jack_connect() or
+ * jack_disconnect() call would have returned.
+ *
+ * @return 0 if all operations succeeded, the number of failed operations,
+ * or -1 if the transaction could not be sent to the server.
+ */
+int jack_connection_transaction_commit (jack_client_t *client, int *results) JACK_OPTIONAL_WEAK_EXPORT;
+
+/**
+ * Discard the connections and disconnections queued since
+ * jack_connection_transaction_begin().
+ *
+ * @return 0 on success, otherwise a non-zero error code
+ */
+int jack_connection_transaction_abort (jack_client_t *client) JACK_OPTIONAL_WEAK_EXPORT;
+
 /**
  * @return the maximum number of characters in a full JACK port name
  * including the final NULL character.  This value is a constant.
@@ -46,6 +46,15 @@
 #include <arm_neon.h>
 #endif
 
+/* On x86, AVX2 and AVX-512 versions of the most used conversions are built
+   regardless of the compiler flags, and selected at run time from the CPU
+   features (see memops_simd_level()).
+*/
+#if defined (__SSE2__) && !defined (__sun__) && defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+#define MEMOPS_DISPATCH
+#include <immintrin.h>
+#endif
+
 /* Notes about these *_SCALING values.
 
    the MAX_<N>BIT values are floating point. when multiplied by
@@ -236,6 +245,574 @@ static inline unsigned int fast_rand() {
 	return seed;
 }
 
+/* Run time selection of the SIMD code paths.
+
+   The level is detected on first use and can be lowered (but not raised
+   above what the CPU supports) with memops_set_simd_level() or with the
+   JACK_SIMD_LEVEL environment variable ("sse", "avx2" or "avx512"), for
+   instance on CPUs that lower their clock when running AVX-512 code.
+*/
+
+static int simd_level = -1;
+
+static int memops_detect_simd_level (void)
+{
+	int level = MEMOPS_SIMD_NONE;
+#ifdef MEMOPS_DISPATCH
+	const char *max_level = getenv ("JACK_SIMD_LEVEL");
+
+	__builtin_cpu_init ();
+	if (__builtin_cpu_supports ("avx2")) {
+		level = MEMOPS_SIMD_AVX2;
+		if (__builtin_cpu_supports ("avx512f")) {
+			level = MEMOPS_SIMD_AVX512;
+		}
+	}
+
+	if (max_level) {
+		if (strcmp (max_level, "avx2") == 0) {
+			if (level > MEMOPS_SIMD_AVX2) {
+				level = MEMOPS_SIMD_AVX2;
+			}
+		} else if (strcmp (max_level, "avx512") != 0) {
+			level = MEMOPS_SIMD_NONE;
+		}
+	}
+#endif
+	return level;
+}
+
+static inline int get_simd_level (void)
+{
+	if (simd_level < 0) {
+		simd_level = memops_detect_simd_level ();
+	}
+	return simd_level;
+}
+
+int memops_simd_level (void)
+{
+	return get_simd_level ();
+}
+
+int memops_set_simd_level (int level)
+{
+	int supported = memops_detect_simd_level ();
+
+	simd_level = (level < supported) ? level : supported;
+	if (simd_level < MEMOPS_SIMD_NONE) {
+		simd_level = MEMOPS_SIMD_NONE;
+	}
+	return simd_level;
+}
+
+#ifdef MEMOPS_DISPATCH
+
+/* The kernels below only process whole blocks of 8 (AVX2) or 16 (AVX-512)
+   samples and return how many samples they converted, the caller finishes
+   with its SSE and scalar code. They give bit exact results with those. */
+
+#define MEMOPS_AVX2   __attribute__ ((target ("avx2")))
+#define MEMOPS_AVX512 __attribute__ ((target ("avx512f")))
+
+/* the LCG of fast_rand() advanced by n steps: seed = seed * mul + add */
+static void fast_rand_jump (unsigned int n, unsigned int *mul, unsigned int *add)
+{
+	*mul = 1;
+	*add = 0;
+	while (n--) {
+		*mul = *mul * 196314165;
+		*add = *add * 196314165 + 907633515;
+	}
+}
+
+static inline MEMOPS_AVX2 void store_32_avx2 (char *dst, __m256i v, unsigned long dst_skip)
+{
+	if (dst_skip == 4) {
+		_mm256_storeu_si256 ((__m256i *) dst, v);
+	} else {
+		__m128i lo = _mm256_castsi256_si128 (v);
+		__m128i hi = _mm256_extracti128_si256 (v, 1);
+		*((int32_t *) dst)                  = _mm_cvtsi128_si32 (lo);
+		*((int32_t *) (dst + dst_skip))     = _mm_extract_epi32 (lo, 1);
+		*((int32_t *) (dst + 2 * dst_skip)) = _mm_extract_epi32 (lo, 2);
+		*((int32_t *) (dst + 3 * dst_skip)) = _mm_extract_epi32 (lo, 3);
+		*((int32_t *) (dst + 4 * dst_skip)) = _mm_cvtsi128_si32 (hi);
+		*((int32_t *) (dst + 5 * dst_skip)) = _mm_extract_epi32 (hi, 1);
+		*((int32_t *) (dst + 6 * dst_skip)) = _mm_extract_epi32 (hi, 2);
+		*((int32_t *) (dst + 7 * dst_skip)) = _mm_extract_epi32 (hi, 3);
+	}
+}
+
+static inline MEMOPS_AVX2 __m256i load_32_avx2 (char *src, unsigned long src_skip)
+{
+	if (src_skip == 4) {
+		return _mm256_loadu_si256 ((__m256i *) src);
+	}
+	return _mm256_set_epi32 (*((int32_t *) (src + 7 * src_skip)),
+				 *((int32_t *) (src + 6 * src_skip)),
+				 *((int32_t *) (src + 5 * src_skip)),
+				 *((int32_t *) (src + 4 * src_skip)),
+				 *((int32_t *) (src + 3 * src_skip)),
+				 *((int32_t *) (src + 2 * src_skip)),
+				 *((int32_t *) (src + src_skip)),
+				 *((int32_t *) src));
+}
+
+static inline MEMOPS_AVX2 void store_packed_16_avx2 (char *dst, __m128i packed, unsigned long dst_skip)
+{
+	if (dst_skip == 2) {
+		_mm_storeu_si128 ((__m128i *) dst, packed);
+	} else {
+		*((int16_t *) dst)                  = _mm_extract_epi16 (packed, 0);
+		*((int16_t *) (dst + dst_skip))     = _mm_extract_epi16 (packed, 1);
+		*((int16_t *) (dst + 2 * dst_skip)) = _mm_extract_epi16 (packed, 2);
+		*((int16_t *) (dst + 3 * dst_skip)) = _mm_extract_epi16 (packed, 3);
+		*((int16_t *) (dst + 4 * dst_skip)) = _mm_extract_epi16 (packed, 4);
+		*((int16_t *) (dst + 5 * dst_skip)) = _mm_extract_epi16 (packed, 5);
+		*((int16_t *) (dst + 6 * dst_skip)) = _mm_extract_epi16 (packed, 6);
+		*((int16_t *) (dst + 7 * dst_skip)) = _mm_extract_epi16 (packed, 7);
+	}
+}
+
+static inline MEMOPS_AVX2 void store_16_avx2 (char *dst, __m256i v, unsigned long dst_skip)
+{
+	/* values are already in the 16 bit range */
+	store_packed_16_avx2 (dst, _mm_packs_epi32 (_mm256_castsi256_si128 (v), _mm256_extracti128_si256 (v, 1)), dst_skip);
+}
+
+static inline MEMOPS_AVX2 __m256 uint_to_float_avx2 (__m256i v)
+{
+	/* both halves convert exactly, so the sum is rounded only once,
+	   like the scalar (float) conversion */
+	__m256 hi = _mm256_cvtepi32_ps (_mm256_srli_epi32 (v, 16));
+	__m256 lo = _mm256_cvtepi32_ps (_mm256_and_si256 (v, _mm256_set1_epi32 (0xffff)));
+	return _mm256_add_ps (_mm256_mul_ps (hi, _mm256_set1_ps (65536.0f)), lo);
+}
+
+static inline MEMOPS_AVX2 __m256i float_16_scaled_avx2 (__m256 s)
+{
+	const __m256 int_max = _mm256_set1_ps (SAMPLE_16BIT_MAX_F);
+	const __m256 int_min = _mm256_set1_ps (SAMPLE_16BIT_MIN_F);
+
+	return _mm256_cvtps_epi32 (_mm256_min_ps (int_max, _mm256_max_ps (s, int_min)));
+}
+
+static MEMOPS_AVX2 unsigned long d32u24_sS_avx2 (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip)
+{
+	const __m256 int_max = _mm256_set1_ps (SAMPLE_24BIT_MAX_F);
+	const __m256 int_min = _mm256_set1_ps (SAMPLE_24BIT_MIN_F);
+	unsigned long done = nsamples & ~7UL;
+	unsigned long n;
+
+	for (n = 0; n != done; n += 8) {
+		__m256 scaled = _mm256_mul_ps (_mm256_loadu_ps (src + n), int_max);
+		__m256 clipped = _mm256_min_ps (int_max, _mm256_max_ps (scaled, int_min));
+		store_32_avx2 (dst, _mm256_slli_epi32 (_mm256_cvttps_epi32 (clipped), 8), dst_skip);
+		dst += 8 * dst_skip;
+	}
+	return done;
+}
+
+static MEMOPS_AVX2 unsigned long dS_s32u24_avx2 (jack_default_audio_sample_t *dst, char *src, unsigned long nsamples, unsigned long src_skip)
+{
+	const __m256 factor = _mm256_set1_ps (1.0 / SAMPLE_24BIT_SCALING);
+	unsigned long done = nsamples & ~7UL;
+	unsigned long n;
+
+	for (n = 0; n != done; n += 8) {
+		__m256i shifted = _mm256_srai_epi32 (load_32_avx2 (src, src_skip), 8);
+		_mm256_storeu_ps (dst + n, _mm256_mul_ps (_mm256_cvtepi32_ps (shifted), factor));
+		src += 8 * src_skip;
+	}
+	return done;
+}
+
+static MEMOPS_AVX2 unsigned long d24_sS_avx2 (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip)
+{
+	const __m256 upper_bound = _mm256_set1_ps (NORMALIZED_FLOAT_MAX);
+	const __m256 lower_bound = _mm256_set1_ps (NORMALIZED_FLOAT_MIN);
+	const __m256 factor = _mm256_set1_ps (SAMPLE_24BIT_SCALING);
+	unsigned long done = nsamples & ~7UL;
+	unsigned long n;
+	int32_t z[8];
+	int i;
+
+	for (n = 0; n != done; n += 8) {
+		__m256 clipped = _mm256_min_ps (upper_bound, _mm256_max_ps (_mm256_loadu_ps (src + n), lower_bound));
+		_mm256_storeu_si256 ((__m256i *) z, _mm256_cvtps_epi32 (_mm256_mul_ps (clipped, factor)));
+		for (i = 0; i != 8; ++i) {
+			memcpy (dst, z + i, 3);
+			dst += dst_skip;
+		}
+	}
+	return done;
+}
+
+static MEMOPS_AVX2 unsigned long dS_s24_avx2 (jack_default_audio_sample_t *dst, char *src, unsigned long nsamples, unsigned long src_skip)
+{
+	/* moves each 3 byte sample to the upper bytes of a 32 bit lane */
+	const __m256i expand = _mm256_setr_epi8 (
+		-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11,
+		-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11);
+	const __m256 factor = _mm256_set1_ps (1.f / SAMPLE_24BIT_SCALING);
+	unsigned long done = nsamples & ~7UL;
+	unsigned long n;
+
+	for (n = 0; n != done; n += 8) {
+		__m256i block;
+		if (src_skip == 3) {
+			/* 24 bytes, split 12/12 over the two 128 bit lanes */
+			__m128i lo = _mm_loadu_si128 ((__m128i *) src);
+			__m128i hi = _mm_loadl_epi64 ((__m128i *) (src + 16));
+			block = _mm256_inserti128_si256 (_mm256_castsi128_si256 (lo), _mm_alignr_epi8 (hi, lo, 12), 1);
+			block = _mm256_shuffle_epi8 (block, expand);
+		} else {
+			int x[8];
+			int i;
+			for (i = 0; i != 8; ++i) {
+				x[i] = 0;
+				memcpy ((char *) (x + i) + 1, src + i * src_skip, 3);
+			}
+			block = _mm256_loadu_si256 ((__m256i *) x);
+		}
+		__m256i shifted = _mm256_srai_epi32 (block, 8);
+		_mm256_storeu_ps (dst + n, _mm256_mul_ps (_mm256_cvtepi32_ps (shifted), factor));
+		src += 8 * src_skip;
+	}
+	return done;
+}
+
+static MEMOPS_AVX2 unsigned long d16_sS_avx2 (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip)
+{
+	const __m256 upper_bound = _mm256_set1_ps (NORMALIZED_FLOAT_MAX);
+	const __m256 lower_bound = _mm256_set1_ps (NORMALIZED_FLOAT_MIN);
+	const __m256 factor = _mm256_set1_ps (SAMPLE_16BIT_SCALING);
+	unsigned long done = nsamples & ~7UL;
+	unsigned long n;
+
+	for (n = 0; n != done; n += 8) {
+		__m256 clipped = _mm256_min_ps (upper_bound, _mm256_max_ps (_mm256_loadu_ps (src + n), lower_bound));
+		store_16_avx2 (dst, _mm256_cvtps_epi32 (_mm256_mul_ps (clipped, factor)), dst_skip);
+		dst += 8 * dst_skip;
+	}
+	return done;
+}
+
+static MEMOPS_AVX2 unsigned long dS_s16_avx2 (jack_default_audio_sample_t *dst, char *src, unsigned long nsamples, unsigned long src_skip)
+{
+	const __m256 factor = _mm256_set1_ps (1.0 / SAMPLE_16BIT_SCALING);
+	unsigned long done = nsamples & ~7UL;
+	unsigned long n;
+
+	for (n = 0; n != done; n += 8) {
+		__m256i block;
+		if (src_skip == 2) {
+			block = _mm256_cvtepi16_epi32 (_mm_loadu_si128 ((__m128i *) src));
+		} else {
+			block = _mm256_set_epi32 (*((short *) (src + 7 * src_skip)),
+						  *((short *) (src + 6 * src_skip)),
+						  *((short *) (src + 5 * src_skip)),
+						  *((short *) (src + 4 * src_skip)),
+						  *((short *) (src + 3 * src_skip)),
+						  *((short *) (src + 2 * src_skip)),
+						  *((short *) (src + src_skip)),
+						  *((short *) src));
+		}
+		_mm256_storeu_ps (dst + n, _mm256_mul_ps (_mm256_cvtepi32_ps (block), factor));
+		src += 8 * src_skip;
+	}
+	return done;
+}
+
+/* The dithering kernels draw the same noise as the scalar code: lane i of
+   the seed vector holds the value fast_rand() would return for sample i. */
+
+static MEMOPS_AVX2 unsigned long dither_rect_d16_sS_avx2 (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip)
+{
+	const __m256 scaling = _mm256_set1_ps (SAMPLE_16BIT_SCALING);
+	const __m256 inv_uint_max = _mm256_set1_ps (1.0f / (float) UINT_MAX);
+	const __m256 half = _mm256_set1_ps (0.5f);
+	unsigned long done = nsamples & ~7UL;
+	unsigned long n;
+	unsigned int mul, add;
+	unsigned int z[8];
+	__m256i seeds;
+	int i;
+
+	if (!done) {
+		return 0;
+	}
+	for (i = 0; i != 8; ++i) {
+		z[i] = fast_rand ();
+	}
+	seeds = _mm256_loadu_si256 ((__m256i *) z);
+	fast_rand_jump (8, &mul, &add);
+
+	for (n = 0; n != done; n += 8) {
+		if (n) {
+			seeds = _mm256_add_epi32 (_mm256_mullo_epi32 (seeds, _mm256_set1_epi32 (mul)), _mm256_set1_epi32 (add));
+		}
+		__m256 r = _mm256_mul_ps (uint_to_float_avx2 (seeds), inv_uint_max);
+		__m256 val = _mm256_sub_ps (_mm256_add_ps (_mm256_mul_ps (_mm256_loadu_ps (src + n), scaling), r), half);
+		store_16_avx2 (dst, float_16_scaled_avx2 (val), dst_skip);
+		dst += 8 * dst_skip;
+	}
+
+	_mm256_storeu_si256 ((__m256i *) z, seeds);
+	seed = z[7];
+	return done;
+}
+
+static MEMOPS_AVX2 unsigned long dither_tri_d16_sS_avx2 (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip)
+{
+	const __m256 scaling = _mm256_set1_ps (SAMPLE_16BIT_SCALING);
+	const __m256 inv_uint_max = _mm256_set1_ps (1.0f / (float) UINT_MAX);
+	const __m256 one = _mm256_set1_ps (1.0f);
+	unsigned long done = nsamples & ~7UL;
+	unsigned long n;
+	unsigned int mul, add;
+	unsigned int z1[8], z2[8];
+	__m256i seeds1, seeds2;
+	int i;
+
+	if (!done) {
+		return 0;
+	}
+	for (i = 0; i != 8; ++i) {
+		z1[i] = fast_rand ();
+		z2[i] = fast_rand ();
+	}
+	seeds1 = _mm256_loadu_si256 ((__m256i *) z1);
+	seeds2 = _mm256_loadu_si256 ((__m256i *) z2);
+	fast_rand_jump (16, &mul, &add);
+
+	for (n = 0; n != done; n += 8) {
+		if (n) {
+			seeds1 = _mm256_add_epi32 (_mm256_mullo_epi32 (seeds1, _mm256_set1_epi32 (mul)), _mm256_set1_epi32 (add));
+			seeds2 = _mm256_add_epi32 (_mm256_mullo_epi32 (seeds2, _mm256_set1_epi32 (mul)), _mm256_set1_epi32 (add));
+		}
+		__m256 r = _mm256_mul_ps (_mm256_add_ps (uint_to_float_avx2 (seeds1), uint_to_float_avx2 (seeds2)), inv_uint_max);
+		__m256 val = _mm256_sub_ps (_mm256_add_ps (_mm256_mul_ps (_mm256_loadu_ps (src + n), scaling), r), one);
+		store_16_avx2 (dst, float_16_scaled_avx2 (val), dst_skip);
+		dst += 8 * dst_skip;
+	}
+
+	_mm256_storeu_si256 ((__m256i *) z2, seeds2);
+	seed = z2[7];
+	return done;
+}
+
+static inline MEMOPS_AVX512 void store_32_avx512 (char *dst, __m512i v, unsigned long dst_skip)
+{
+	if (dst_skip == 4) {
+		_mm512_storeu_si512 (dst, v);
+	} else {
+		/* faster than a scatter */
+		store_32_avx2 (dst, _mm512_castsi512_si256 (v), dst_skip);
+		store_32_avx2 (dst + 8 * dst_skip, _mm512_extracti64x4_epi64 (v, 1), dst_skip);
+	}
+}
+
+static inline MEMOPS_AVX512 void store_16_avx512 (char *dst, __m512i v, unsigned long dst_skip)
+{
+	/* values are already in the 16 bit range */
+	__m256i packed = _mm512_cvtsepi32_epi16 (v);
+
+	store_packed_16_avx2 (dst, _mm256_castsi256_si128 (packed), dst_skip);
+	store_packed_16_avx2 (dst + 8 * dst_skip, _mm256_extracti128_si256 (packed, 1), dst_skip);
+}
+
+static inline MEMOPS_AVX512 __m512i float_16_scaled_avx512 (__m512 s)
+{
+	const __m512 int_max = _mm512_set1_ps (SAMPLE_16BIT_MAX_F);
+	const __m512 int_min = _mm512_set1_ps (SAMPLE_16BIT_MIN_F);
+
+	return _mm512_cvtps_epi32 (_mm512_min_ps (int_max, _mm512_max_ps (s, int_min)));
+}
+
+static MEMOPS_AVX512 unsigned long d32u24_sS_avx512 (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip)
+{
+	const __m512 int_max = _mm512_set1_ps (SAMPLE_24BIT_MAX_F);
+	const __m512 int_min = _mm512_set1_ps (SAMPLE_24BIT_MIN_F);
+	unsigned long done = nsamples & ~15UL;
+	unsigned long n;
+
+	for (n = 0; n != done; n += 16) {
+		__m512 scaled = _mm512_mul_ps (_mm512_loadu_ps (src + n), int_max);
+		__m512 clipped = _mm512_min_ps (int_max, _mm512_max_ps (scaled, int_min));
+		store_32_avx512 (dst, _mm512_slli_epi32 (_mm512_cvttps_epi32 (clipped), 8), dst_skip);
+		dst += 16 * dst_skip;
+	}
+	return done;
+}
+
+static MEMOPS_AVX512 unsigned long dS_s32u24_avx512 (jack_default_audio_sample_t *dst, char *src, unsigned long nsamples, unsigned long src_skip)
+{
+	const __m512 factor = _mm512_set1_ps (1.0 / SAMPLE_24BIT_SCALING);
+	const __m512i offsets = _mm512_mullo_epi32 (_mm512_setr_epi32 (0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+						     _mm512_set1_epi32 ((int) src_skip));
+	unsigned long done = nsamples & ~15UL;
+	unsigned long n;
+
+	for (n = 0; n != done; n += 16) {
+		__m512i block;
+		if (src_skip == 4) {
+			block = _mm512_loadu_si512 (src);
+		} else {
+			block = _mm512_i32gather_epi32 (offsets, src, 1);
+		}
+		_mm512_storeu_ps (dst + n, _mm512_mul_ps (_mm512_cvtepi32_ps (_mm512_srai_epi32 (block, 8)), factor));
+		src += 16 * src_skip;
+	}
+	return done;
+}
+
+static MEMOPS_AVX512 unsigned long d24_sS_avx512 (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip)
+{
+	const __m512 upper_bound = _mm512_set1_ps (NORMALIZED_FLOAT_MAX);
+	const __m512 lower_bound = _mm512_set1_ps (NORMALIZED_FLOAT_MIN);
+	const __m512 factor = _mm512_set1_ps (SAMPLE_24BIT_SCALING);
+	unsigned long done = nsamples & ~15UL;
+	unsigned long n;
+	int32_t z[16];
+	int i;
+
+	for (n = 0; n != done; n += 16) {
+		__m512 clipped = _mm512_min_ps (upper_bound, _mm512_max_ps (_mm512_loadu_ps (src + n), lower_bound));
+		_mm512_storeu_si512 (z, _mm512_cvtps_epi32 (_mm512_mul_ps (clipped, factor)));
+		for (i = 0; i != 16; ++i) {
+			memcpy (dst, z + i, 3);
+			dst += dst_skip;
+		}
+	}
+	return done;
+}
+
+static MEMOPS_AVX512 unsigned long d16_sS_avx512 (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip)
+{
+	const __m512 upper_bound = _mm512_set1_ps (NORMALIZED_FLOAT_MAX);
+	const __m512 lower_bound = _mm512_set1_ps (NORMALIZED_FLOAT_MIN);
+	const __m512 factor = _mm512_set1_ps (SAMPLE_16BIT_SCALING);
+	unsigned long done = nsamples & ~15UL;
+	unsigned long n;
+
+	for (n = 0; n != done; n += 16) {
+		__m512 clipped = _mm512_min_ps (upper_bound, _mm512_max_ps (_mm512_loadu_ps (src + n), lower_bound));
+		store_16_avx512 (dst, _mm512_cvtps_epi32 (_mm512_mul_ps (clipped, factor)), dst_skip);
+		dst += 16 * dst_skip;
+	}
+	return done;
+}
+
+static MEMOPS_AVX512 unsigned long dS_s16_avx512 (jack_default_audio_sample_t *dst, char *src, unsigned long nsamples, unsigned long src_skip)
+{
+	const __m512 factor = _mm512_set1_ps (1.0 / SAMPLE_16BIT_SCALING);
+	const __m512i offsets = _mm512_mullo_epi32 (_mm512_setr_epi32 (0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+						     _mm512_set1_epi32 ((int) src_skip));
+	unsigned long done;
+	unsigned long n;
+
+	if (src_skip == 2) {
+		done = nsamples & ~15UL;
+	} else {
+		/* the gather reads 4 bytes per sample, keep the last sample out of it */
+		done = (nsamples - 1) & ~15UL;
+		if (nsamples == 0) {
+			done = 0;
+		}
+	}
+
+	for (n = 0; n != done; n += 16) {
+		__m512i block;
+		if (src_skip == 2) {
+			block = _mm512_cvtepi16_epi32 (_mm256_loadu_si256 ((__m256i *) src));
+		} else {
+			block = _mm512_srai_epi32 (_mm512_slli_epi32 (_mm512_i32gather_epi32 (offsets, src, 1), 16), 16);
+		}
+		_mm512_storeu_ps (dst + n, _mm512_mul_ps (_mm512_cvtepi32_ps (block), factor));
+		src += 16 * src_skip;
+	}
+	return done;
+}
+
+static MEMOPS_AVX512 unsigned long dither_rect_d16_sS_avx512 (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip)
+{
+	const __m512 scaling = _mm512_set1_ps (SAMPLE_16BIT_SCALING);
+	const __m512 inv_uint_max = _mm512_set1_ps (1.0f / (float) UINT_MAX);
+	const __m512 half = _mm512_set1_ps (0.5f);
+	unsigned long done = nsamples & ~15UL;
+	unsigned long n;
+	unsigned int mul, add;
+	unsigned int z[16];
+	__m512i seeds;
+	int i;
+
+	if (!done) {
+		return 0;
+	}
+	for (i = 0; i != 16; ++i) {
+		z[i] = fast_rand ();
+	}
+	seeds = _mm512_loadu_si512 (z);
+	fast_rand_jump (16, &mul, &add);
+
+	for (n = 0; n != done; n += 16) {
+		if (n) {
+			seeds = _mm512_add_epi32 (_mm512_mullo_epi32 (seeds, _mm512_set1_epi32 (mul)), _mm512_set1_epi32 (add));
+		}
+		__m512 r = _mm512_mul_ps (_mm512_cvtepu32_ps (seeds), inv_uint_max);
+		__m512 val = _mm512_sub_ps (_mm512_add_ps (_mm512_mul_ps (_mm512_loadu_ps (src + n), scaling), r), half);
+		store_16_avx512 (dst, float_16_scaled_avx512 (val), dst_skip);
+		dst += 16 * dst_skip;
+	}
+
+	_mm512_storeu_si512 (z, seeds);
+	seed = z[15];
+	return done;
+}
+
+static MEMOPS_AVX512 unsigned long dither_tri_d16_sS_avx512 (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip)
+{
+	const __m512 scaling = _mm512_set1_ps (SAMPLE_16BIT_SCALING);
+	const __m512 inv_uint_max = _mm512_set1_ps (1.0f / (float) UINT_MAX);
+	const __m512 one = _mm512_set1_ps (1.0f);
+	unsigned long done = nsamples & ~15UL;
+	unsigned long n;
+	unsigned int mul, add;
+	unsigned int z1[16], z2[16];
+	__m512i seeds1, seeds2;
+	int i;
+
+	if (!done) {
+		return 0;
+	}
+	for (i = 0; i != 16; ++i) {
+		z1[i] = fast_rand ();
+		z2[i] = fast_rand ();
+	}
+	seeds1 = _mm512_loadu_si512 (z1);
+	seeds2 = _mm512_loadu_si512 (z2);
+	fast_rand_jump (32, &mul, &add);
+
+	for (n = 0; n != done; n += 16) {
+		if (n) {
+			seeds1 = _mm512_add_epi32 (_mm512_mullo_epi32 (seeds1, _mm512_set1_epi32 (mul)), _mm512_set1_epi32 (add));
+			seeds2 = _mm512_add_epi32 (_mm512_mullo_epi32 (seeds2, _mm512_set1_epi32 (mul)), _mm512_set1_epi32 (add));
+		}
+		__m512 r = _mm512_mul_ps (_mm512_add_ps (_mm512_cvtepu32_ps (seeds1), _mm512_cvtepu32_ps (seeds2)), inv_uint_max);
+		__m512 val = _mm512_sub_ps (_mm512_add_ps (_mm512_mul_ps (_mm512_loadu_ps (src + n), scaling), r), one);
+		store_16_avx512 (dst, float_16_scaled_avx512 (val), dst_skip);
+		dst += 16 * dst_skip;
+	}
+
+	_mm512_storeu_si512 (z2, seeds2);
+	seed = z2[15];
+	return done;
+}
+
+#endif /* MEMOPS_DISPATCH */
+
 /* functions for native float sample data */
 
 void sample_move_floatLE_sSs (jack_default_audio_sample_t *dst, char *src, unsigned long nsamples, unsigned long src_skip) {
@@ -331,6 +908,16 @@ void sample_move_d32u24_sSs (char *dst, jack_default_audio_sample_t *src, unsign
 
 void sample_move_d32u24_sS (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip, dither_state_t *state)
 {
+#ifdef MEMOPS_DISPATCH
+	if (get_simd_level () >= MEMOPS_SIMD_AVX2) {
+		unsigned long done = (get_simd_level () >= MEMOPS_SIMD_AVX512)
+			? d32u24_sS_avx512 (dst, src, nsamples, dst_skip)
+			: d32u24_sS_avx2 (dst, src, nsamples, dst_skip);
+		dst += done * dst_skip;
+		src += done;
+		nsamples -= done;
+	}
+#endif
 #if defined (__SSE2__) && !defined (__sun__)
 	__m128 int_max = _mm_set1_ps(SAMPLE_24BIT_MAX_F);
 	__m128 int_min = _mm_sub_ps(_mm_setzero_ps(), int_max);
@@ -480,6 +1067,16 @@ void sample_move_dS_s32u24s (jack_default_audio_sample_t *dst, char *src, unsign
 
 void sample_move_dS_s32u24 (jack_default_audio_sample_t *dst, char *src, unsigned long nsamples, unsigned long src_skip)
 {
+#ifdef MEMOPS_DISPATCH
+	if (get_simd_level () >= MEMOPS_SIMD_AVX2) {
+		unsigned long done = (get_simd_level () >= MEMOPS_SIMD_AVX512)
+			? dS_s32u24_avx512 (dst, src, nsamples, src_skip)
+			: dS_s32u24_avx2 (dst, src, nsamples, src_skip);
+		dst += done;
+		src += done * src_skip;
+		nsamples -= done;
+	}
+#endif
 #if defined (__SSE2__) && !defined (__sun__)
 	unsigned long unrolled = nsamples / 4;
 	static float inv_sample_max_24bit = 1.0 / SAMPLE_24BIT_SCALING;
@@ -587,6 +1184,16 @@ void sample_move_d24_sSs (char *dst, jack_default_audio_sample_t *src, unsigned
 
 void sample_move_d24_sS (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip, dither_state_t *state)
 {
+#ifdef MEMOPS_DISPATCH
+	if (get_simd_level () >= MEMOPS_SIMD_AVX2) {
+		unsigned long done = (get_simd_level () >= MEMOPS_SIMD_AVX512)
+			? d24_sS_avx512 (dst, src, nsamples, dst_skip)
+			: d24_sS_avx2 (dst, src, nsamples, dst_skip);
+		dst += done * dst_skip;
+		src += done;
+		nsamples -= done;
+	}
+#endif
 #if defined (__SSE2__) && !defined (__sun__)
 	_MM_SET_ROUNDING_MODE(_MM_ROUND_NEAREST);
 	while (nsamples >= 4) {
@@ -719,6 +1326,14 @@ void sample_move_dS_s24s (jack_default_audio_sample_t *dst, char *src, unsigned
 
 void sample_move_dS_s24 (jack_default_audio_sample_t *dst, char *src, unsigned long nsamples, unsigned long src_skip)
 {
+#ifdef MEMOPS_DISPATCH
+	if (get_simd_level () >= MEMOPS_SIMD_AVX2) {
+		unsigned long done = dS_s24_avx2 (dst, src, nsamples, src_skip);
+		dst += done;
+		src += done * src_skip;
+		nsamples -= done;
+	}
+#endif
 	const jack_default_audio_sample_t scaling = 1.f/SAMPLE_24BIT_SCALING;
 
 #if defined (__SSE2__) && !defined (__sun__)
@@ -838,6 +1453,16 @@ void sample_move_d16_sSs (char *dst,  jack_default_audio_sample_t *src, unsigned
 
 void sample_move_d16_sS (char *dst,  jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip, dither_state_t *state)	
 {
+#ifdef MEMOPS_DISPATCH
+	if (get_simd_level () >= MEMOPS_SIMD_AVX2) {
+		unsigned long done = (get_simd_level () >= MEMOPS_SIMD_AVX512)
+			? d16_sS_avx512 (dst, src, nsamples, dst_skip)
+			: d16_sS_avx2 (dst, src, nsamples, dst_skip);
+		dst += done * dst_skip;
+		src += done;
+		nsamples -= done;
+	}
+#endif
 #ifdef __ARM_NEON__
 	unsigned long unrolled = nsamples / 4;
 	nsamples = nsamples & 3;
@@ -890,6 +1515,16 @@ void sample_move_dither_rect_d16_sSs (char *dst,  jack_default_audio_sample_t *s
 
 void sample_move_dither_rect_d16_sS (char *dst,  jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip, dither_state_t *state)	
 {
+#ifdef MEMOPS_DISPATCH
+	if (get_simd_level () >= MEMOPS_SIMD_AVX2) {
+		unsigned long done = (get_simd_level () >= MEMOPS_SIMD_AVX512)
+			? dither_rect_d16_sS_avx512 (dst, src, nsamples, dst_skip)
+			: dither_rect_d16_sS_avx2 (dst, src, nsamples, dst_skip);
+		dst += done * dst_skip;
+		src += done;
+		nsamples -= done;
+	}
+#endif
 	jack_default_audio_sample_t val;
 
 	while (nsamples--) {
@@ -923,6 +1558,16 @@ void sample_move_dither_tri_d16_sSs (char *dst,  jack_default_audio_sample_t *sr
 
 void sample_move_dither_tri_d16_sS (char *dst,  jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip, dither_state_t *state)	
 {
+#ifdef MEMOPS_DISPATCH
+	if (get_simd_level () >= MEMOPS_SIMD_AVX2) {
+		unsigned long done = (get_simd_level () >= MEMOPS_SIMD_AVX512)
+			? dither_tri_d16_sS_avx512 (dst, src, nsamples, dst_skip)
+			: dither_tri_d16_sS_avx2 (dst, src, nsamples, dst_skip);
+		dst += done * dst_skip;
+		src += done;
+		nsamples -= done;
+	}
+#endif
 	jack_default_audio_sample_t val;
 
 	while (nsamples--) {
@@ -1067,6 +1712,16 @@ void sample_move_dS_s16s (jack_default_audio_sample_t *dst, char *src, unsigned
 
 void sample_move_dS_s16 (jack_default_audio_sample_t *dst, char *src, unsigned long nsamples, unsigned long src_skip) 
 {
+#ifdef MEMOPS_DISPATCH
+	if (get_simd_level () >= MEMOPS_SIMD_AVX2) {
+		unsigned long done = (get_simd_level () >= MEMOPS_SIMD_AVX512)
+			? dS_s16_avx512 (dst, src, nsamples, src_skip)
+			: dS_s16_avx2 (dst, src, nsamples, src_skip);
+		dst += done;
+		src += done * src_skip;
+		nsamples -= done;
+	}
+#endif
 	/* ALERT: signed sign-extension portability !!! */
 	const jack_default_audio_sample_t scaling = 1.0/SAMPLE_16BIT_SCALING;
 #ifdef __ARM_NEON__
@@ -48,6 +48,14 @@ typedef struct {
     float e[DITHER_BUF_SIZE];
 } dither_state_t;
 
+/* SIMD code paths selected at run time, see memops.c */
+#define MEMOPS_SIMD_NONE   0	/* only what the compiler flags enable (SSE2, NEON or plain C) */
+#define MEMOPS_SIMD_AVX2   1
+#define MEMOPS_SIMD_AVX512 2
+
+int memops_simd_level (void);
+int memops_set_simd_level (int level);
+
 /* float functions */
 void sample_move_floatLE_sSs (jack_default_audio_sample_t *dst, char *src, unsigned long nsamples, unsigned long dst_skip);
 void sample_move_dS_floatLE (char *dst, jack_default_audio_sample_t *src, unsigned long nsamples, unsigned long dst_skip, dither_state_t *state);
@@ -53,6 +53,10 @@
 #include <sys/sem.h>
 #include <stdlib.h>
 #include "promiscuous.h"
+#ifdef __linux__
+#include <mntent.h>
+#include <sys/vfs.h>
+#endif
 
 #endif
 
@@ -122,6 +126,10 @@ static jack_shm_header_t   *jack_shm_header = NULL;
 static jack_shm_registry_t *jack_shm_registry = NULL;
 static char jack_shm_server_prefix[JACK_SERVER_NAME_SIZE+1] = "";
 
+/* if set, large segments allocated by this process are backed by huge
+ * pages where the system supports it (see jack_shm_set_hugepages) */
+static int jack_shm_hugepages = 0;
+
 /* jack_shm_lock_registry() serializes updates to the shared memory
  * segment JACK uses to keep track of the SHM segments allocated to
  * all its processes, including multiple servers.
@@ -383,6 +391,18 @@ jack_server_initialize_shm (int new_registry)
 	return rc;
 }
 
+/* request huge pages for the segments allocated from now on
+ *
+ * Only the server allocates segments, clients attach to them in
+ * whatever way the server created them. Segments that can not be
+ * given huge pages use normal shared memory.
+ */
+void
+jack_shm_set_hugepages (int enable)
+{
+	jack_shm_hugepages = enable;
+}
+
 /* gain client addressability to shared memory registration segment
  *
  * NOTE: this function is no longer used for server initialization,
@@ -805,11 +825,158 @@ jack_create_registry (jack_shm_info_t *ri)
 	return 0;
 }
 
+/* Huge page segments are files on a hugetlbfs mount, and their
+ * registry id is the full path of the file. Normal segments have an
+ * id of the form "/jack-UID-INDEX", without any further slash.
+ */
+#define JACK_HUGEPAGE_DEFAULT (2 * 1024 * 1024)
+
+static int
+jack_shm_is_file (const char *id)
+{
+	return strchr (id + 1, '/') != NULL;
+}
+
+static int
+jack_shm_open (const char *id, int flags)
+{
+	if (jack_shm_is_file (id)) {
+		return open (id, flags, 0666);
+	}
+	return shm_open (id, flags, 0666);
+}
+
+#ifdef __linux__
+
+#ifndef HUGETLBFS_MAGIC
+#define HUGETLBFS_MAGIC 0x958458f6
+#endif
+
+/* find a writable hugetlbfs mount, JACK_HUGETLBFS overrides the search
+ *
+ * returns: the huge page size, or 0 if there is no usable mount
+ */
+static long
+jack_find_hugetlbfs (char *dir, size_t len)
+{
+	static int done = 0;
+	static char found[PATH_MAX] = "";
+	static long page_size = 0;
+	const char *env;
+	struct statfs st;
+	struct mntent *ent;
+	FILE *fp;
+
+	if (!done) {
+		done = 1;
+		env = getenv ("JACK_HUGETLBFS");
+		if (env != NULL) {
+			strncpy (found, env, sizeof (found) - 1);
+		} else if ((fp = setmntent ("/proc/mounts", "r")) != NULL) {
+			while ((ent = getmntent (fp)) != NULL) {
+				if (strcmp (ent->mnt_type, "hugetlbfs") == 0
+				    && access (ent->mnt_dir, W_OK) == 0) {
+					strncpy (found, ent->mnt_dir, sizeof (found) - 1);
+					break;
+				}
+			}
+			endmntent (fp);
+		}
+		if (found[0] != '\0') {
+			if (statfs (found, &st) == 0 && st.f_type == HUGETLBFS_MAGIC) {
+				page_size = st.f_bsize;
+				jack_info ("Using huge pages of %ld kB from %s",
+					   page_size / 1024, found);
+			} else {
+				jack_error ("%s is not a hugetlbfs mount", found);
+			}
+		} else {
+			jack_info ("No hugetlbfs mount found, huge pages are not used");
+		}
+	}
+
+	if (page_size) {
+		strncpy (dir, found, len - 1);
+		dir[len - 1] = '\0';
+	}
+	return page_size;
+}
+
+/* create a segment on hugetlbfs, populating it so that running out of
+ * huge pages is detected here, and not as a SIGBUS later on
+ *
+ * returns: the open file descriptor, or -1 if normal shared memory
+ *          should be used instead. On success the segment size is
+ *          rounded up to a multiple of the huge page size.
+ */
+static int
+jack_hugetlb_open (int index, jack_shmsize_t *size, char *name, size_t len)
+{
+	char dir[PATH_MAX];
+	long page_size;
+	size_t rounded;
+	void *addr;
+	int fd;
+
+	if ((page_size = jack_find_hugetlbfs (dir, sizeof (dir))) == 0) {
+		return -1;
+	}
+
+	/* small segments such as the engine and client controls
+	 * would waste most of a huge page */
+	if (*size < page_size / 2) {
+		return -1;
+	}
+
+	rounded = ((*size + page_size - 1) / page_size) * page_size;
+	if (snprintf (name, len, "%s/jack-%d-%d", dir, GetUID(), index) >= (int) len) {
+		jack_error ("huge page segment name too long");
+		return -1;
+	}
+
+	unlink (name);
+	if ((fd = open (name, O_RDWR|O_CREAT|O_EXCL, 0666)) < 0) {
+		jack_error ("Cannot create huge page segment %s (%s)",
+			    name, strerror (errno));
+		return -1;
+	}
+
+	if (ftruncate (fd, rounded) < 0) {
+		jack_error ("Cannot set size of huge page segment %s (%s)",
+			    name, strerror (errno));
+		goto fail;
+	}
+
+	addr = mmap (0, rounded, PROT_READ|PROT_WRITE,
+		     MAP_SHARED|MAP_POPULATE, fd, 0);
+	if (addr == MAP_FAILED) {
+		jack_error ("Cannot map %ld bytes of huge pages (%s), "
+			    "using normal shared memory", (long) rounded,
+			    strerror (errno));
+		goto fail;
+	}
+	munmap (addr, rounded);
+
+	*size = rounded;
+	return fd;
+
+ fail:
+	close (fd);
+	unlink (name);
+	return -1;
+}
+
+#endif /* __linux__ */
+
 static void
 jack_remove_shm (jack_shm_id_t *id)
 {
 	/* registry may or may not be locked */
-	shm_unlink ((char *) id);
+	if (jack_shm_is_file ((char *) id)) {
+		unlink ((char *) id);
+	} else {
+		shm_unlink ((char *) id);
+	}
 }
 
 void
@@ -858,25 +1025,35 @@ jack_shmalloc (const char *shm_name, jack_shmsize_t size, jack_shm_info_t* si)
 	 * registry index for uniqueness and ignore the shm_name
 	 * parameter.  Bah!
 	 */
-	snprintf (name, sizeof (name), "/jack-%d-%d", GetUID(), registry->index);
-
-	if (strlen (name) >= sizeof (registry->id)) {
-		jack_error ("shm segment name too long %s", name);
-		goto unlock;
+	shm_fd = -1;
+#ifdef __linux__
+	if (jack_shm_hugepages) {
+		shm_fd = jack_hugetlb_open (registry->index, &size,
+					    name, sizeof (registry->id));
 	}
+#endif
 
-	if ((shm_fd = shm_open (name, O_RDWR|O_CREAT, 0666)) < 0) {
-		jack_error ("Cannot create shm segment %s (%s)",
-			    name, strerror (errno));
-		goto unlock;
-	}
+	if (shm_fd < 0) {
+		snprintf (name, sizeof (name), "/jack-%d-%d", GetUID(), registry->index);
 
-	if (ftruncate (shm_fd, size) < 0) {
-		jack_error ("Cannot set size of engine shm "
-			    "registry 0 (%s)",
-			    strerror (errno));
-		close (shm_fd);
-		goto unlock;
+		if (strlen (name) >= sizeof (registry->id)) {
+			jack_error ("shm segment name too long %s", name);
+			goto unlock;
+		}
+
+		if ((shm_fd = shm_open (name, O_RDWR|O_CREAT, 0666)) < 0) {
+			jack_error ("Cannot create shm segment %s (%s)",
+				    name, strerror (errno));
+			goto unlock;
+		}
+
+		if (ftruncate (shm_fd, size) < 0) {
+			jack_error ("Cannot set size of engine shm "
+				    "registry 0 (%s)",
+				    strerror (errno));
+			close (shm_fd);
+			goto unlock;
+		}
 	}
 
 	promiscuous = getenv("JACK_PROMISCUOUS_SERVER");
@@ -900,17 +1077,23 @@ int
 jack_attach_shm (jack_shm_info_t* si)
 {
 	int shm_fd;
+	int flags = MAP_SHARED;
 	jack_shm_registry_t *registry = &jack_shm_registry[si->index];
 
-	if ((shm_fd = shm_open (registry->id,
-				O_RDWR, 0666)) < 0) {
+	if ((shm_fd = jack_shm_open (registry->id, O_RDWR)) < 0) {
 		jack_error ("Cannot open shm segment %s (%s)", registry->id,
 			    strerror (errno));
 		return -1;
 	}
 
+#ifdef MAP_POPULATE
+	/* huge pages are already there, map them all right away */
+	if (jack_shm_is_file (registry->id))
+		flags |= MAP_POPULATE;
+#endif
+
 	if ((si->ptr.attached_at = mmap (0, registry->size, PROT_READ|PROT_WRITE,
-				     MAP_SHARED, shm_fd, 0)) == MAP_FAILED) {
+				     flags, shm_fd, 0)) == MAP_FAILED) {
 		jack_error ("Cannot mmap shm segment %s (%s)",
 			    registry->id,
 			    strerror (errno));
@@ -918,6 +1101,15 @@ jack_attach_shm (jack_shm_info_t* si)
 		return -1;
 	}
 
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	/* without hugetlbfs, ask for transparent huge pages, this has
+	 * effect only if the system enables them for shared memory */
+	if (jack_shm_hugepages && !jack_shm_is_file (registry->id)
+	    && registry->size >= JACK_HUGEPAGE_DEFAULT) {
+		madvise (si->ptr.attached_at, registry->size, MADV_HUGEPAGE);
+	}
+#endif
+
 	close (shm_fd);
 	return 0;
 }
@@ -928,8 +1120,7 @@ jack_attach_shm_read (jack_shm_info_t* si)
 	int shm_fd;
 	jack_shm_registry_t *registry = &jack_shm_registry[si->index];
 
-	if ((shm_fd = shm_open (registry->id,
-				O_RDONLY, 0666)) < 0) {
+	if ((shm_fd = jack_shm_open (registry->id, O_RDONLY)) < 0) {
 		jack_error ("Cannot open shm segment %s (%s)", registry->id,
 			    strerror (errno));
 		return -1;
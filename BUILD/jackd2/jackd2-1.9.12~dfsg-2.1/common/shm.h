@@ -209,6 +209,7 @@ extern "C"
     int jack_attach_shm_read (jack_shm_info_t*);
     int jack_attach_lib_shm_read (jack_shm_info_t*);
     int jack_resize_shm (jack_shm_info_t*, jack_shmsize_t size);
+    void jack_shm_set_hugepages (int enable);
 
 #ifdef __cplusplus
 }
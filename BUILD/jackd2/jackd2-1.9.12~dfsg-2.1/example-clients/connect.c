@@ -34,6 +34,7 @@ int connecting, disconnecting;
 volatile int done = 0;
 #define TRUE 1
 #define FALSE 0
+#define MAX_BATCH 4096
 
 void port_connect_callback(jack_port_id_t a, jack_port_id_t b, int connect, void* arg)
 {
@@ -51,19 +52,152 @@ show_usage (char *my_name)
 {
 	show_version (my_name);
 	fprintf (stderr, "\nusage: %s [options] port1 port2\n", my_name);
+	fprintf (stderr, "       %s [options] -f <file>\n", my_name);
 	fprintf (stderr, "Connects two JACK ports together.\n\n");
 	fprintf (stderr, "        -s, --server <name>   Connect to the jack server named <name>\n");
+	fprintf (stderr, "        -f, --file <file>     Read port pairs from <file> ('-' for stdin), one pair per line\n");
+	fprintf (stderr, "                              separated by a tab (or a space if there is no tab), and apply\n");
+	fprintf (stderr, "                              them all in a single connection transaction\n");
 	fprintf (stderr, "        -v, --version         Output version information and exit\n");
 	fprintf (stderr, "        -h, --help            Display this help message\n\n");
 	fprintf (stderr, "For more information see http://jackaudio.org/\n");
 }
 
+static int
+split_port_pair (char *line, char **port1, char **port2)
+{
+	char *sep;
+	char *end;
+
+	line[strcspn (line, "\r\n")] = '\0';
+	while (*line == ' ' || *line == '\t') {
+		line++;
+	}
+	if (*line == '\0' || *line == '#') {
+		return 0;
+	}
+	if ((sep = strchr (line, '\t')) == NULL && (sep = strchr (line, ' ')) == NULL) {
+		return -1;
+	}
+	*sep++ = '\0';
+	while (*sep == ' ' || *sep == '\t') {
+		sep++;
+	}
+	end = sep + strlen (sep);
+	while (end > sep && (end[-1] == ' ' || end[-1] == '\t')) {
+		*--end = '\0';
+	}
+	if (*sep == '\0') {
+		return -1;
+	}
+	*port1 = line;
+	*port2 = sep;
+	return 1;
+}
+
+static int
+connect_from_file (jack_client_t *client, const char *file_name, int do_connect)
+{
+	static jack_port_t *src_ports[MAX_BATCH];
+	static jack_port_t *dst_ports[MAX_BATCH];
+	static int lines[MAX_BATCH];
+	static int results[MAX_BATCH];
+	char line[1024];
+	char *name1, *name2;
+	jack_port_t *port1, *port2;
+	FILE *file;
+	int line_num = 0;
+	int count = 0;
+	int errors = 0;
+	int i, res;
+
+	if (strcmp (file_name, "-") == 0) {
+		file = stdin;
+	} else if ((file = fopen (file_name, "r")) == NULL) {
+		fprintf (stderr, "cannot open %s: %s\n", file_name, strerror (errno));
+		return 1;
+	}
+
+	/* resolve all pairs first, so that the transaction only holds valid ports */
+
+	while (fgets (line, sizeof (line), file)) {
+		line_num++;
+		if ((res = split_port_pair (line, &name1, &name2)) == 0) {
+			continue;
+		} else if (res < 0) {
+			fprintf (stderr, "%s:%d: expected two port names\n", file_name, line_num);
+			errors++;
+			continue;
+		}
+		if (count == MAX_BATCH) {
+			fprintf (stderr, "%s:%d: too many port pairs (max %d)\n", file_name, line_num, MAX_BATCH);
+			errors++;
+			break;
+		}
+		if ((port1 = jack_port_by_name (client, name1)) == 0) {
+			fprintf (stderr, "%s:%d: ERROR %s not a valid port\n", file_name, line_num, name1);
+			errors++;
+			continue;
+		}
+		if ((port2 = jack_port_by_name (client, name2)) == 0) {
+			fprintf (stderr, "%s:%d: ERROR %s not a valid port\n", file_name, line_num, name2);
+			errors++;
+			continue;
+		}
+		if ((jack_port_flags (port1) & JackPortIsOutput) && (jack_port_flags (port2) & JackPortIsInput)) {
+			src_ports[count] = port1;
+			dst_ports[count] = port2;
+		} else if ((jack_port_flags (port1) & JackPortIsInput) && (jack_port_flags (port2) & JackPortIsOutput)) {
+			src_ports[count] = port2;
+			dst_ports[count] = port1;
+		} else {
+			fprintf (stderr, "%s:%d: arguments must include 1 input port and 1 output port\n", file_name, line_num);
+			errors++;
+			continue;
+		}
+		lines[count++] = line_num;
+	}
+
+	if (file != stdin) {
+		fclose (file);
+	}
+
+	if (jack_connection_transaction_begin (client)) {
+		fprintf (stderr, "cannot start connection transaction\n");
+		return 1;
+	}
+	for (i = 0; i < count; i++) {
+		if (do_connect) {
+			jack_connect (client, jack_port_name (src_ports[i]), jack_port_name (dst_ports[i]));
+		} else {
+			jack_disconnect (client, jack_port_name (src_ports[i]), jack_port_name (dst_ports[i]));
+		}
+	}
+	if (jack_connection_transaction_commit (client, results) < 0) {
+		fprintf (stderr, "cannot commit connection transaction\n");
+		return 1;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (results[i] == 0 || (do_connect && results[i] == EEXIST)) {
+			continue;
+		}
+		fprintf (stderr, "%s:%d: cannot %s %s and %s\n", file_name, lines[i],
+			(do_connect ? "connect" : "disconnect"),
+			jack_port_name (src_ports[i]), jack_port_name (dst_ports[i]));
+		errors++;
+	}
+
+	return (errors > 0) ? 1 : 0;
+}
+
 int
 main (int argc, char *argv[])
 {
 	jack_client_t *client;
 	jack_status_t status;
 	char *server_name = NULL;
+	char *file_name = NULL;
 	int c;
 	int option_index;
 	jack_options_t options = JackNoStartServer;
@@ -84,10 +218,11 @@ main (int argc, char *argv[])
 	    { "help", 0, 0, 'h' },
 	    { "version", 0, 0, 'v' },
 	    { "uuid", 0, 0, 'u' },
+	    { "file", 1, 0, 'f' },
 	    { 0, 0, 0, 0 }
 	};
 
-	while ((c = getopt_long (argc, argv, "s:hvu", long_options, &option_index)) >= 0) {
+	while ((c = getopt_long (argc, argv, "s:hvuf:", long_options, &option_index)) >= 0) {
 		switch (c) {
 		case 's':
 			server_name = (char *) malloc (sizeof (char) * strlen(optarg));
@@ -97,6 +232,9 @@ main (int argc, char *argv[])
 		case 'u':
 			use_uuid = 1;
 			break;
+		case 'f':
+			file_name = optarg;
+			break;
 		case 'h':
 			show_usage (my_name);
 			return 1;
@@ -128,7 +266,7 @@ main (int argc, char *argv[])
 		return 1;
 	}
 
-	if (argc < 3) {
+	if (argc < 3 && file_name == NULL) {
 		show_usage(my_name);
 		return 1;
 	}
@@ -142,6 +280,15 @@ main (int argc, char *argv[])
 
     jack_set_port_connect_callback(client, port_connect_callback, NULL);
 
+	if (file_name) {
+		if (jack_activate (client)) {
+			fprintf (stderr, "cannot activate client");
+			goto exit;
+		}
+		rc = connect_from_file (client, file_name, connecting);
+		goto exit;
+	}
+
 	/* find the two ports */
 
 	if( use_uuid ) {
@@ -0,0 +1,233 @@
+/** @file hop_latency.c
+ *
+ * @brief Runs a chain of clients, each one feeding the next one, and measures
+ * the time between the end of a client process callback and the start of the
+ * next client one, to compare the wakeup latency per graph hop of the server
+ * synchronisation modes (see jackd --spin-wait).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <sys/resource.h>
+#include <jack/jack.h>
+
+#define MAX_CLIENTS 64
+#define NAME_SIZE 64
+
+typedef struct {
+	jack_time_t start;
+	jack_time_t end;
+} cycle_record_t;
+
+typedef struct {
+	jack_client_t *client;
+	jack_port_t *input;
+	jack_port_t *output;
+	cycle_record_t *cycles;
+} hop_client_t;
+
+static hop_client_t clients[MAX_CLIENTS];
+static int client_num = 8;
+static int work_usecs = 50;
+static int duration = 10;
+static int cycle_num;
+static jack_nframes_t buffer_size;
+static volatile int recording = 0;
+static volatile jack_nframes_t base_frame;
+
+static void
+show_usage (void)
+{
+	fprintf (stderr, "\nUsage: jack_hop_latency [options]\n");
+	fprintf (stderr, "Measure the wakeup latency of each hop of a chain of clients.\n\n");
+	fprintf (stderr, "Options:\n");
+	fprintf (stderr, "        -c, --clients <n>    Number of clients in the chain (default 8)\n");
+	fprintf (stderr, "        -w, --work <usecs>   Time spent in each process callback (default 50)\n");
+	fprintf (stderr, "        -d, --duration <s>   Measurement duration (default 10)\n");
+	fprintf (stderr, "        -h, --help           Display this help message\n\n");
+}
+
+static int
+process (jack_nframes_t nframes, void *arg)
+{
+	hop_client_t *hop = (hop_client_t *) arg;
+	jack_time_t start = jack_get_time ();
+	jack_nframes_t frame = jack_last_frame_time (hop->client);
+	int cycle;
+
+	memcpy (jack_port_get_buffer (hop->output, nframes), jack_port_get_buffer (hop->input, nframes),
+	        nframes * sizeof (jack_default_audio_sample_t));
+
+	while (jack_get_time () < start + work_usecs) {
+	}
+
+	if (recording) {
+		cycle = (int) (frame - base_frame) / (int) buffer_size;
+		if (cycle >= 0 && cycle < cycle_num) {
+			hop->cycles[cycle].start = start;
+			hop->cycles[cycle].end = jack_get_time ();
+		}
+	}
+	return 0;
+}
+
+static int
+compare_times (const void *a, const void *b)
+{
+	long long diff = *(const long long *) a - *(const long long *) b;
+	return (diff < 0) ? -1 : (diff > 0);
+}
+
+static void
+report (const char *name, long long *values, int count)
+{
+	long long sum = 0;
+	int i;
+
+	if (count == 0) {
+		printf ("%-12s no complete cycle\n", name);
+		return;
+	}
+	qsort (values, count, sizeof (long long), compare_times);
+	for (i = 0; i < count; i++) {
+		sum += values[i];
+	}
+	printf ("%-12s mean %7.1f  median %5lld  p99 %5lld  max %6lld usecs\n", name,
+	        (double) sum / count, values[count / 2], values[(count * 99) / 100], values[count - 1]);
+}
+
+static double
+cpu_seconds (void)
+{
+	struct rusage usage;
+	getrusage (RUSAGE_SELF, &usage);
+	return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+int
+main (int argc, char *argv[])
+{
+	const char *options = "c:w:d:h";
+	struct option long_options[] = {
+		{"clients", 1, 0, 'c'},
+		{"work", 1, 0, 'w'},
+		{"duration", 1, 0, 'd'},
+		{"help", 0, 0, 'h'},
+		{0, 0, 0, 0}
+	};
+	char name[NAME_SIZE];
+	long long *hops, *chains;
+	int hop_count = 0, chain_count = 0;
+	double cpu;
+	int opt, i, c;
+
+	while ((opt = getopt_long (argc, argv, options, long_options, NULL)) != -1) {
+		switch (opt) {
+		case 'c':
+			client_num = atoi (optarg);
+			break;
+		case 'w':
+			work_usecs = atoi (optarg);
+			break;
+		case 'd':
+			duration = atoi (optarg);
+			break;
+		case 'h':
+		default:
+			show_usage ();
+			return 1;
+		}
+	}
+
+	if (client_num < 2 || client_num > MAX_CLIENTS || work_usecs < 0 || duration < 1) {
+		show_usage ();
+		return 1;
+	}
+
+	for (c = 0; c < client_num; c++) {
+		hop_client_t *hop = &clients[c];
+		snprintf (name, sizeof (name), "hop-%d", c);
+		if ((hop->client = jack_client_open (name, JackNoStartServer | JackUseExactName, NULL)) == NULL) {
+			fprintf (stderr, "cannot open client %s, is the server running?\n", name);
+			return 1;
+		}
+		hop->input = jack_port_register (hop->client, "in", JACK_DEFAULT_AUDIO_TYPE, JackPortIsInput, 0);
+		hop->output = jack_port_register (hop->client, "out", JACK_DEFAULT_AUDIO_TYPE, JackPortIsOutput, 0);
+		if (hop->input == NULL || hop->output == NULL) {
+			fprintf (stderr, "cannot register ports of %s\n", name);
+			return 1;
+		}
+		jack_set_process_callback (hop->client, process, hop);
+	}
+
+	buffer_size = jack_get_buffer_size (clients[0].client);
+	cycle_num = (int) ((double) duration * jack_get_sample_rate (clients[0].client) / buffer_size) + 1;
+	for (c = 0; c < client_num; c++) {
+		clients[c].cycles = (cycle_record_t *) calloc (cycle_num, sizeof (cycle_record_t));
+		if (clients[c].cycles == NULL) {
+			fprintf (stderr, "cannot allocate %d cycles\n", cycle_num);
+			return 1;
+		}
+	}
+
+	for (c = 0; c < client_num; c++) {
+		if (jack_activate (clients[c].client)) {
+			fprintf (stderr, "cannot activate client %d\n", c);
+			return 1;
+		}
+	}
+	for (c = 0; c + 1 < client_num; c++) {
+		jack_connect (clients[c].client, jack_port_name (clients[c].output), jack_port_name (clients[c + 1].input));
+	}
+
+	/* Let the chain and the spin predictions settle */
+	sleep (1);
+	base_frame = jack_frame_time (clients[0].client) + 2 * buffer_size;
+	cpu = cpu_seconds ();
+	recording = 1;
+	sleep (duration);
+	recording = 0;
+	cpu = cpu_seconds () - cpu;
+
+	for (c = client_num - 1; c >= 0; c--) {
+		jack_deactivate (clients[c].client);
+	}
+
+	hops = (long long *) malloc (sizeof (long long) * cycle_num * (client_num - 1));
+	chains = (long long *) malloc (sizeof (long long) * cycle_num);
+	if (hops == NULL || chains == NULL) {
+		return 1;
+	}
+
+	for (i = 0; i < cycle_num; i++) {
+		int complete = 1;
+		for (c = 0; c < client_num; c++) {
+			if (clients[c].cycles[i].start == 0) {
+				complete = 0;
+			}
+		}
+		if (!complete) {
+			continue;
+		}
+		for (c = 0; c + 1 < client_num; c++) {
+			hops[hop_count++] = (long long) clients[c + 1].cycles[i].start - (long long) clients[c].cycles[i].end;
+		}
+		chains[chain_count++] = (long long) clients[client_num - 1].cycles[i].end - (long long) clients[0].cycles[i].start;
+	}
+
+	printf ("%d clients, %d usecs of work each, %d frames, %d cycles\n", client_num, work_usecs, buffer_size, chain_count);
+	report ("hop", hops, hop_count);
+	report ("chain", chains, chain_count);
+	printf ("%-12s %.1f%% of one CPU\n", "cpu", 100.0 * cpu / duration);
+
+	for (c = client_num - 1; c >= 0; c--) {
+		jack_client_close (clients[c].client);
+		free (clients[c].cycles);
+	}
+	free (hops);
+	free (chains);
+	return 0;
+}
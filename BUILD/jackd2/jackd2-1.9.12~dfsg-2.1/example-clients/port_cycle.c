@@ -0,0 +1,235 @@
+/** @file port_cycle.c
+ *
+ * @brief Runs a chain of clients with many ports each, every client reading
+ * all its input buffers and writing all its output buffers, and measures the
+ * time spent in the process callbacks and the span of the whole graph in each
+ * cycle, to compare the variance of the cycle time with and without huge pages
+ * for the port buffers (see jackd --hugepages).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <jack/jack.h>
+
+#define MAX_CLIENTS 64
+#define MAX_PORTS 256
+#define NAME_SIZE 64
+
+typedef struct {
+	jack_time_t start;
+	jack_time_t end;
+} cycle_record_t;
+
+typedef struct {
+	jack_client_t *client;
+	jack_port_t *inputs[MAX_PORTS];
+	jack_port_t *outputs[MAX_PORTS];
+	cycle_record_t *cycles;
+} port_client_t;
+
+static port_client_t clients[MAX_CLIENTS];
+static int client_num = 16;
+static int port_num = 32;
+static int duration = 10;
+static int cycle_num;
+static jack_nframes_t buffer_size;
+static volatile int recording = 0;
+static volatile jack_nframes_t base_frame;
+
+static void
+show_usage (void)
+{
+	fprintf (stderr, "\nUsage: jack_port_cycle [options]\n");
+	fprintf (stderr, "Measure the cycle time of a chain of clients with many ports.\n\n");
+	fprintf (stderr, "Options:\n");
+	fprintf (stderr, "        -c, --clients <n>    Number of clients in the chain (default 16)\n");
+	fprintf (stderr, "        -p, --ports <n>      Input and output ports of each client (default 32)\n");
+	fprintf (stderr, "        -d, --duration <s>   Measurement duration (default 10)\n");
+	fprintf (stderr, "        -h, --help           Display this help message\n\n");
+}
+
+static int
+process (jack_nframes_t nframes, void *arg)
+{
+	port_client_t *pc = (port_client_t *) arg;
+	jack_time_t start = jack_get_time ();
+	jack_nframes_t frame = jack_last_frame_time (pc->client);
+	jack_default_audio_sample_t *in, *out;
+	jack_nframes_t k;
+	int cycle, p;
+
+	for (p = 0; p < port_num; p++) {
+		in = (jack_default_audio_sample_t *) jack_port_get_buffer (pc->inputs[p], nframes);
+		out = (jack_default_audio_sample_t *) jack_port_get_buffer (pc->outputs[p], nframes);
+		for (k = 0; k < nframes; k++) {
+			out[k] = 0.5f * in[k] + 1e-3f;
+		}
+	}
+
+	if (recording) {
+		cycle = (int) (frame - base_frame) / (int) buffer_size;
+		if (cycle >= 0 && cycle < cycle_num) {
+			pc->cycles[cycle].start = start;
+			pc->cycles[cycle].end = jack_get_time ();
+		}
+	}
+	return 0;
+}
+
+static int
+compare_times (const void *a, const void *b)
+{
+	long long diff = *(const long long *) a - *(const long long *) b;
+	return (diff < 0) ? -1 : (diff > 0);
+}
+
+static void
+report (const char *name, long long *values, int count)
+{
+	double sum = 0, sum2 = 0, mean;
+	int i;
+
+	if (count == 0) {
+		printf ("%-12s no complete cycle\n", name);
+		return;
+	}
+	qsort (values, count, sizeof (long long), compare_times);
+	for (i = 0; i < count; i++) {
+		sum += values[i];
+		sum2 += (double) values[i] * values[i];
+	}
+	mean = sum / count;
+	printf ("%-12s mean %7.1f  stddev %6.1f  median %5lld  p99 %5lld  max %6lld usecs\n", name,
+	        mean, sqrt (sum2 / count - mean * mean), values[count / 2], values[(count * 99) / 100], values[count - 1]);
+}
+
+int
+main (int argc, char *argv[])
+{
+	const char *options = "c:p:d:h";
+	struct option long_options[] = {
+		{"clients", 1, 0, 'c'},
+		{"ports", 1, 0, 'p'},
+		{"duration", 1, 0, 'd'},
+		{"help", 0, 0, 'h'},
+		{0, 0, 0, 0}
+	};
+	char name[NAME_SIZE];
+	long long *process_times, *spans;
+	int count = 0;
+	int opt, i, c, p;
+
+	while ((opt = getopt_long (argc, argv, options, long_options, NULL)) != -1) {
+		switch (opt) {
+		case 'c':
+			client_num = atoi (optarg);
+			break;
+		case 'p':
+			port_num = atoi (optarg);
+			break;
+		case 'd':
+			duration = atoi (optarg);
+			break;
+		case 'h':
+		default:
+			show_usage ();
+			return 1;
+		}
+	}
+
+	if (client_num < 1 || client_num > MAX_CLIENTS || port_num < 1 || port_num > MAX_PORTS || duration < 1) {
+		show_usage ();
+		return 1;
+	}
+
+	for (c = 0; c < client_num; c++) {
+		port_client_t *pc = &clients[c];
+		snprintf (name, sizeof (name), "cycle-%d", c);
+		if ((pc->client = jack_client_open (name, JackNoStartServer | JackUseExactName, NULL)) == NULL) {
+			fprintf (stderr, "cannot open client %s, is the server running?\n", name);
+			return 1;
+		}
+		for (p = 0; p < port_num; p++) {
+			snprintf (name, sizeof (name), "in_%d", p + 1);
+			pc->inputs[p] = jack_port_register (pc->client, name, JACK_DEFAULT_AUDIO_TYPE, JackPortIsInput, 0);
+			snprintf (name, sizeof (name), "out_%d", p + 1);
+			pc->outputs[p] = jack_port_register (pc->client, name, JACK_DEFAULT_AUDIO_TYPE, JackPortIsOutput, 0);
+			if (pc->inputs[p] == NULL || pc->outputs[p] == NULL) {
+				fprintf (stderr, "cannot register ports of client %d, raise the server port-max?\n", c);
+				return 1;
+			}
+		}
+		jack_set_process_callback (pc->client, process, pc);
+	}
+
+	buffer_size = jack_get_buffer_size (clients[0].client);
+	cycle_num = (int) ((double) duration * jack_get_sample_rate (clients[0].client) / buffer_size) + 1;
+	for (c = 0; c < client_num; c++) {
+		clients[c].cycles = (cycle_record_t *) calloc (cycle_num, sizeof (cycle_record_t));
+		if (clients[c].cycles == NULL) {
+			fprintf (stderr, "cannot allocate %d cycles\n", cycle_num);
+			return 1;
+		}
+	}
+
+	for (c = 0; c < client_num; c++) {
+		if (jack_activate (clients[c].client)) {
+			fprintf (stderr, "cannot activate client %d\n", c);
+			return 1;
+		}
+	}
+	for (c = 0; c + 1 < client_num; c++) {
+		for (p = 0; p < port_num; p++) {
+			jack_connect (clients[c].client, jack_port_name (clients[c].outputs[p]), jack_port_name (clients[c + 1].inputs[p]));
+		}
+	}
+
+	sleep (1);
+	base_frame = jack_frame_time (clients[0].client) + 2 * buffer_size;
+	recording = 1;
+	sleep (duration);
+	recording = 0;
+
+	for (c = client_num - 1; c >= 0; c--) {
+		jack_deactivate (clients[c].client);
+	}
+
+	process_times = (long long *) malloc (sizeof (long long) * cycle_num);
+	spans = (long long *) malloc (sizeof (long long) * cycle_num);
+	if (process_times == NULL || spans == NULL) {
+		return 1;
+	}
+
+	for (i = 0; i < cycle_num; i++) {
+		long long sum = 0;
+		int complete = 1;
+		for (c = 0; c < client_num; c++) {
+			if (clients[c].cycles[i].start == 0) {
+				complete = 0;
+				break;
+			}
+			sum += (long long) clients[c].cycles[i].end - (long long) clients[c].cycles[i].start;
+		}
+		if (!complete) {
+			continue;
+		}
+		process_times[count] = sum;
+		spans[count++] = (long long) clients[client_num - 1].cycles[i].end - (long long) clients[0].cycles[i].start;
+	}
+
+	printf ("%d clients, %d ports each, %d frames, %d cycles\n", client_num, 2 * port_num, buffer_size, count);
+	report ("process", process_times, count);
+	report ("cycle", spans, count);
+
+	for (c = client_num - 1; c >= 0; c--) {
+		jack_client_close (clients[c].client);
+		free (clients[c].cycles);
+	}
+	free (process_times);
+	free (spans);
+	return 0;
+}
@@ -0,0 +1,201 @@
+/** @file port_lookup.c
+ *
+ * @brief Registers many ports and times jack_port_by_name and jack_get_ports
+ * with the kinds of patterns clients commonly use.  The results of
+ * jack_get_ports are also checked against a regex match of the full port
+ * list done in this process.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <regex.h>
+#include <jack/jack.h>
+
+#define MAX_CLIENTS 32
+#define NAME_SIZE 256
+
+static jack_client_t *clients[MAX_CLIENTS];
+static int client_num = 6;
+static int port_num = 256;
+static int iterations = 1000;
+static int errors = 0;
+
+static void
+show_usage (void)
+{
+	fprintf (stderr, "\nUsage: jack_port_lookup [options]\n");
+	fprintf (stderr, "Time port name lookups with many registered ports.\n\n");
+	fprintf (stderr, "Options:\n");
+	fprintf (stderr, "        -c, --clients <n>     Number of clients (default 6)\n");
+	fprintf (stderr, "        -p, --ports <n>       Ports per client, half inputs half outputs (default 256)\n");
+	fprintf (stderr, "        -n, --iterations <n>  Lookups per test (default 1000)\n");
+	fprintf (stderr, "        -h, --help            Display this help message\n\n");
+}
+
+static void
+port_name (char *buf, size_t size, int client, int port)
+{
+	snprintf (buf, size, "lookup-%d:%s_%d", client, (port & 1) ? "out" : "in", port / 2);
+}
+
+static void
+report (const char *test, jack_time_t start, int count)
+{
+	double usecs = (double) (jack_get_time () - start) / count;
+	printf ("%-40s %10.2f usecs\n", test, usecs);
+}
+
+static void
+time_port_by_name (jack_client_t *client, int hit)
+{
+	char name[NAME_SIZE];
+	jack_time_t start = jack_get_time ();
+	int i;
+
+	for (i = 0; i < iterations; i++) {
+		int c = rand () % client_num;
+		int p = rand () % port_num;
+		port_name (name, sizeof (name), c, p);
+		if (!hit) {
+			strcat (name, "_none");
+		}
+		if ((jack_port_by_name (client, name) != NULL) != hit) {
+			fprintf (stderr, "jack_port_by_name %s: wrong result\n", name);
+			errors++;
+		}
+	}
+	report (hit ? "jack_port_by_name (hit)" : "jack_port_by_name (miss)", start, iterations);
+}
+
+/* Expected result of a port name pattern, using the full port list */
+static int
+check_get_ports (const char **all, const char *pattern, const char **ports)
+{
+	regex_t regex;
+	int i, n = 0;
+
+	if (regcomp (&regex, pattern, REG_EXTENDED | REG_NOSUB) != 0) {
+		return -1;
+	}
+	for (i = 0; all[i]; i++) {
+		if (regexec (&regex, all[i], 0, NULL, 0) == 0) {
+			if (!ports || !ports[n] || strcmp (ports[n], all[i]) != 0) {
+				regfree (&regex);
+				return -1;
+			}
+			n++;
+		}
+	}
+	regfree (&regex);
+	return (ports && ports[n]) ? -1 : n;
+}
+
+static void
+time_get_ports (jack_client_t *client, const char *test, const char *pattern)
+{
+	const char **all = jack_get_ports (client, NULL, NULL, 0);
+	const char **ports;
+	char label[64];
+	jack_time_t start;
+	int i, count;
+
+	ports = jack_get_ports (client, pattern, NULL, 0);
+	count = check_get_ports (all, pattern, ports);
+	if (count < 0) {
+		fprintf (stderr, "jack_get_ports \"%s\": wrong result\n", pattern);
+		errors++;
+	}
+	jack_free (ports);
+	jack_free (all);
+
+	start = jack_get_time ();
+	for (i = 0; i < iterations; i++) {
+		jack_free (jack_get_ports (client, pattern, NULL, 0));
+	}
+	snprintf (label, sizeof (label), "jack_get_ports %s (%d)", test, count);
+	report (label, start, iterations);
+}
+
+int
+main (int argc, char *argv[])
+{
+	const char *options = "c:p:n:h";
+	struct option long_options[] = {
+		{"clients", 1, 0, 'c'},
+		{"ports", 1, 0, 'p'},
+		{"iterations", 1, 0, 'n'},
+		{"help", 0, 0, 'h'},
+		{0, 0, 0, 0}
+	};
+	char name[NAME_SIZE];
+	char pattern[NAME_SIZE + 8];
+	int opt, c, p;
+
+	while ((opt = getopt_long (argc, argv, options, long_options, NULL)) != -1) {
+		switch (opt) {
+		case 'c':
+			client_num = atoi (optarg);
+			break;
+		case 'p':
+			port_num = atoi (optarg);
+			break;
+		case 'n':
+			iterations = atoi (optarg);
+			break;
+		case 'h':
+		default:
+			show_usage ();
+			return 1;
+		}
+	}
+
+	if (client_num < 1 || client_num > MAX_CLIENTS || port_num < 2 || iterations < 1) {
+		show_usage ();
+		return 1;
+	}
+
+	for (c = 0; c < client_num; c++) {
+		snprintf (name, sizeof (name), "lookup-%d", c);
+		if ((clients[c] = jack_client_open (name, JackNoStartServer | JackUseExactName, NULL)) == NULL) {
+			fprintf (stderr, "cannot open client %s, is the server running?\n", name);
+			return 1;
+		}
+		for (p = 0; p < port_num; p++) {
+			port_name (name, sizeof (name), c, p);
+			if (jack_port_register (clients[c], strchr (name, ':') + 1, JACK_DEFAULT_AUDIO_TYPE,
+			                        (p & 1) ? JackPortIsOutput : JackPortIsInput, 0) == NULL) {
+				fprintf (stderr, "cannot register port %s, try a higher server port maximum (-p)\n", name);
+				return 1;
+			}
+		}
+	}
+
+	printf ("%d clients, %d ports each\n", client_num, port_num);
+
+	time_port_by_name (clients[0], 1);
+	time_port_by_name (clients[0], 0);
+
+	port_name (name, sizeof (name), client_num - 1, port_num - 1);
+	snprintf (pattern, sizeof (pattern), "^%s$", name);
+	time_get_ports (clients[0], "exact", pattern);
+	snprintf (pattern, sizeof (pattern), "^lookup-%d:", client_num - 1);
+	time_get_ports (clients[0], "client prefix", pattern);
+	snprintf (pattern, sizeof (pattern), "^lookup-%d:out_.*$", client_num / 2);
+	time_get_ports (clients[0], "port prefix", pattern);
+	time_get_ports (clients[0], "substring", ":in_1");
+	time_get_ports (clients[0], "suffix", "_1$");
+	time_get_ports (clients[0], "regex", "lookup-[0-9]+:out_1[0-9]$");
+	time_get_ports (clients[0], "regex (alternation)", "^(system|lookup-0):(in|capture)_");
+
+	for (c = client_num - 1; c >= 0; c--) {
+		jack_client_close (clients[c]);
+	}
+
+	if (errors) {
+		fprintf (stderr, "%d errors\n", errors);
+		return 1;
+	}
+	return 0;
+}
@@ -38,6 +38,9 @@
 #ifdef __SSE4_1__
 #include <smmintrin.h>
 #endif
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+#include <immintrin.h>
+#endif
 #endif
 
 #ifdef __ARM_NEON__
@@ -46,6 +49,8 @@
 
 // our additional headers
 #include <time.h>
+#include <getopt.h>
+#include "../common/JackAudioMixdown.h"
 
 /* Dirty: include mempos.c twice the second time with SIMD disabled
  * so we can compare aceelerated non accelerated
@@ -63,6 +68,10 @@ namespace origerated {
 #undef __ARM_NEON__
 #endif
 
+#ifdef MEMOPS_DISPATCH
+#undef MEMOPS_DISPATCH
+#endif
+
 #include "../common/memops.c"
 }
 
@@ -154,20 +163,90 @@ test_case_data_t test_cases[] = {
 		origerated::sample_move_dS_s16,
 		NULL,
 		"16" },
+	{
+		2,
+		2,
+		false,
+		accelerated::sample_move_dither_rect_d16_sS,
+		origerated::sample_move_dither_rect_d16_sS,
+		accelerated::sample_move_dS_s16,
+		origerated::sample_move_dS_s16,
+		NULL,
+		"16rect" },
+	{
+		2,
+		2,
+		false,
+		accelerated::sample_move_dither_tri_d16_sS,
+		origerated::sample_move_dither_tri_d16_sS,
+		accelerated::sample_move_dS_s16,
+		origerated::sample_move_dS_s16,
+		NULL,
+		"16tri" },
 };
 
+const char *simd_level_names[] = { "sse", "avx2", "avx512" };
+
 // we need to repeat for better accuracy at time measurement
-const uint32_t retry_per_case = 1000;
+uint32_t retry_per_case = 1000;
+// and keep the best of several runs
+uint32_t runs_per_case = 5;
+uint32_t frames = 1024;
 
 // setup test buffers
-#define TESTBUFF_SIZE 1024
-jack_default_audio_sample_t jackbuffer_source[TESTBUFF_SIZE];
+#define TESTBUFF_SIZE 8192
+#define MIXDOWN_SOURCES_MAX 32
+#define ALIGNED __attribute__((aligned(64)))
+jack_default_audio_sample_t jackbuffer_source[TESTBUFF_SIZE] ALIGNED;
 // integer buffers: max 4 bytes per value / * 2 for stereo
-char integerbuffer_accel[TESTBUFF_SIZE*4*2];
-char integerbuffer_orig[TESTBUFF_SIZE*4*2];
+char integerbuffer_accel[TESTBUFF_SIZE*4*2] ALIGNED;
+char integerbuffer_orig[TESTBUFF_SIZE*4*2] ALIGNED;
 // float buffers
-jack_default_audio_sample_t jackfloatbuffer_accel[TESTBUFF_SIZE];
-jack_default_audio_sample_t jackfloatbuffer_orig[TESTBUFF_SIZE];
+jack_default_audio_sample_t jackfloatbuffer_accel[TESTBUFF_SIZE] ALIGNED;
+jack_default_audio_sample_t jackfloatbuffer_orig[TESTBUFF_SIZE] ALIGNED;
+// mixdown buffers
+jack_default_audio_sample_t mixdown_sources[MIXDOWN_SOURCES_MAX][TESTBUFF_SIZE] ALIGNED;
+
+static double now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// returns the best time of all runs, for retry_per_case calls
+static double time_to_integer(t_jack_to_integer func, uint32_t skip, dither_state_t *state, char *dst)
+{
+	double best = 0.0;
+	for(uint32_t run=0; run<runs_per_case; run++) {
+		double start = now();
+		for(uint32_t repetition=0; repetition<retry_per_case; repetition++)
+			func(dst, jackbuffer_source, frames, skip, state);
+		double elapsed = now() - start;
+		if(run == 0 || elapsed < best)
+			best = elapsed;
+	}
+	return best;
+}
+
+static double time_to_float(t_integer_to_jack func, uint32_t skip, jack_default_audio_sample_t *dst)
+{
+	double best = 0.0;
+	for(uint32_t run=0; run<runs_per_case; run++) {
+		double start = now();
+		for(uint32_t repetition=0; repetition<retry_per_case; repetition++)
+			func(dst, integerbuffer_orig, frames, skip);
+		double elapsed = now() - start;
+		if(run == 0 || elapsed < best)
+			best = elapsed;
+	}
+	return best;
+}
+
+static double throughput(double seconds, uint32_t samples)
+{
+	return ((double)samples * retry_per_case) / seconds / 1e6;
+}
 
 // comparing unsigned makes life easier
 uint32_t extract_integer(
@@ -197,194 +276,302 @@ uint32_t extract_integer(
 	return retval;
 }
 
-int main(int argc, char *argv[])
+static void compare_integer(const test_case_data_t *test_case, uint32_t channels, const char *level_name, uint32_t maxerr_displayed)
 {
-//	parse_arguments(argc, argv);
-	uint32_t maxerr_displayed = 10;
+	uint32_t int_deviation_max = 0;
+	uint32_t int_error_count = 0;
+	// output error (avoid spam -> limit error lines per test case)
+	for(uint32_t sample=0; sample<frames; sample++) {
+		uint32_t sample_offset = sample*test_case->frame_size*channels;
+		// compare both results
+		uint32_t intval_accel=extract_integer(
+			integerbuffer_accel,
+			sample_offset,
+			test_case->frame_size,
+			test_case->sample_size,
+#if __BYTE_ORDER == __BIG_ENDIAN
+			!test_case->reverse);
+#else
+			test_case->reverse);
+#endif
+		uint32_t intval_orig=extract_integer(
+			integerbuffer_orig,
+			sample_offset,
+			test_case->frame_size,
+			test_case->sample_size,
+#if __BYTE_ORDER == __BIG_ENDIAN
+			!test_case->reverse);
+#else
+			test_case->reverse);
+#endif
+		if(intval_accel != intval_orig) {
+			if(int_error_count<maxerr_displayed) {
+				printf("Value error sample %u:", sample);
+				printf(" Orig 0x");
+				char formatstr[10];
+				sprintf(formatstr, "%%0%uX", test_case->sample_size*2);
+				printf(formatstr, intval_orig);
+				printf(" Accel 0x");
+				printf(formatstr, intval_accel);
+				printf("\n");
+			}
+			int_error_count++;
+			uint32_t int_deviation;
+			if(intval_accel > intval_orig)
+				int_deviation = intval_accel-intval_orig;
+			else
+				int_deviation = intval_orig-intval_accel;
+			if(int_deviation > int_deviation_max)
+				int_deviation_max = int_deviation;
+		}
+	}
+	printf(
+		"JackFloat->Integer @%7.7s/%u %6s: Errors: %u Max deviation %u\n",
+		test_case->name,
+		channels,
+		level_name,
+		int_error_count,
+		int_deviation_max);
+}
 
-	// fill jackbuffer
-	for(int i=0; i<TESTBUFF_SIZE; i++) {
-		// ramp
-		jack_default_audio_sample_t value =
-			((jack_default_audio_sample_t)((i % TESTBUFF_SIZE) - TESTBUFF_SIZE/2)) / (TESTBUFF_SIZE/2);
-		// force clipping
-		value *= 1.02;
-		jackbuffer_source[i] = value;
+static void compare_float(const test_case_data_t *test_case, uint32_t channels, const char *level_name, uint32_t maxerr_displayed)
+{
+	jack_default_audio_sample_t float_deviation_max = 0.0;
+	uint32_t float_error_count = 0;
+	// output error (avoid spam -> limit error lines per test case)
+	for(uint32_t sample=0; sample<frames; sample++) {
+		// For easier estimation/readabilty we scale floats back to integer
+		jack_default_audio_sample_t sample_scaling;
+		switch(test_case->sample_size) {
+			case 2:
+				sample_scaling = SAMPLE_16BIT_SCALING;
+				break;
+			default:
+				sample_scaling = SAMPLE_24BIT_SCALING;
+				break;
+		}
+		jack_default_audio_sample_t floatval_accel = jackfloatbuffer_accel[sample] * sample_scaling;
+		jack_default_audio_sample_t floatval_orig = jackfloatbuffer_orig[sample] * sample_scaling;
+		// compare both results
+		jack_default_audio_sample_t float_deviation;
+		if(floatval_accel > floatval_orig)
+			float_deviation = floatval_accel-floatval_orig;
+		else
+			float_deviation = floatval_orig-floatval_accel;
+		if(float_deviation > float_deviation_max)
+			float_deviation_max = float_deviation;
+		// deviation > half bit => error
+		if(float_deviation > 0.5) {
+			if(float_error_count<maxerr_displayed) {
+				printf("Value error sample %u:", sample);
+				printf(" Orig %8.1f Accel %8.1f\n", floatval_orig, floatval_accel);
+			}
+			float_error_count++;
+		}
 	}
+	printf(
+		"Integer->JackFloat @%7.7s/%u %6s: Errors: %u Max deviation %f\n",
+		test_case->name,
+		channels,
+		level_name,
+		float_error_count,
+		float_deviation_max);
+}
 
+static void test_conversions(int max_level, uint32_t maxerr_displayed)
+{
 	for(uint32_t testcase=0; testcase<sizeof(test_cases)/sizeof(test_case_data_t); testcase++) {
+		test_case_data_t *test_case = &test_cases[testcase];
 		// test mono/stereo
 		for(uint32_t channels=1; channels<=2; channels++) {
+			uint32_t skip = test_case->frame_size*channels;
+
 			//////////////////////////////////////////////////////////////////////////////
 			// jackfloat -> integer
 
-			// clean target buffers
-			memset(integerbuffer_accel, 0, sizeof(integerbuffer_accel));
 			memset(integerbuffer_orig, 0, sizeof(integerbuffer_orig));
-			// accel
-			clock_t time_to_integer_accel = clock();
-			for(uint32_t repetition=0; repetition<retry_per_case; repetition++)
-			{
-				test_cases[testcase].jack_to_integer_accel(
-					integerbuffer_accel,
-					jackbuffer_source,
-					TESTBUFF_SIZE,
-					test_cases[testcase].frame_size*channels,
-					test_cases[testcase].ditherstate);
-			}
-			float timediff_to_integer_accel = ((float)(clock() - time_to_integer_accel)) / CLOCKS_PER_SEC;
-			// orig
-			clock_t time_to_integer_orig = clock();
-			for(uint32_t repetition=0; repetition<retry_per_case; repetition++)
-			{
-				test_cases[testcase].jack_to_integer_orig(
-					integerbuffer_orig,
-					jackbuffer_source,
-					TESTBUFF_SIZE,
-					test_cases[testcase].frame_size*channels,
-					test_cases[testcase].ditherstate);
-			}
-			float timediff_to_integer_orig = ((float)(clock() - time_to_integer_orig)) / CLOCKS_PER_SEC;
-			// output performance results
+			double orig = time_to_integer(test_case->jack_to_integer_orig, skip, test_case->ditherstate, integerbuffer_orig);
 			printf(
-				"JackFloat->Integer @%7.7s/%u: Orig %7.6f sec / Accel %7.6f sec -> Win: %5.2f %%\n",
-				test_cases[testcase].name,
+				"JackFloat->Integer @%7.7s/%u %6s: %8.1f Msamples/s\n",
+				test_case->name,
 				channels,
-				timediff_to_integer_orig,
-				timediff_to_integer_accel,
-				(timediff_to_integer_orig/timediff_to_integer_accel-1)*100.0);
-			uint32_t int_deviation_max = 0;
-			uint32_t int_error_count = 0;
-			// output error (avoid spam -> limit error lines per test case)
-			for(uint32_t sample=0; sample<TESTBUFF_SIZE; sample++) {
-				uint32_t sample_offset = sample*test_cases[testcase].frame_size*channels;
-				// compare both results
-				uint32_t intval_accel=extract_integer(
-					integerbuffer_accel,
-					sample_offset,
-					test_cases[testcase].frame_size,
-					test_cases[testcase].sample_size,
-#if __BYTE_ORDER == __BIG_ENDIAN
-					!test_cases[testcase].reverse);
-#else
-					test_cases[testcase].reverse);
-#endif
-				uint32_t intval_orig=extract_integer(
-					integerbuffer_orig,
-					sample_offset,
-					test_cases[testcase].frame_size,
-					test_cases[testcase].sample_size,
-#if __BYTE_ORDER == __BIG_ENDIAN
-					!test_cases[testcase].reverse);
-#else
-					test_cases[testcase].reverse);
-#endif
-				if(intval_accel != intval_orig) {
-					if(int_error_count<maxerr_displayed) {
-						printf("Value error sample %u:", sample);
-						printf(" Orig 0x");
-						char formatstr[10];
-						sprintf(formatstr, "%%0%uX", test_cases[testcase].sample_size*2);
-						printf(formatstr, intval_orig);
-						printf(" Accel 0x");
-						printf(formatstr, intval_accel);
-						printf("\n");
-					}
-					int_error_count++;
-					uint32_t int_deviation;
-					if(intval_accel > intval_orig)
-						int_deviation = intval_accel-intval_orig;
-					else
-						int_deviation = intval_orig-intval_accel;
-					if(int_deviation > int_deviation_max)
-						int_deviation_max = int_deviation;
-				}
+				"scalar",
+				throughput(orig, frames));
+			for(int level=MEMOPS_SIMD_NONE; level<=max_level; level++) {
+				accelerated::memops_set_simd_level(level);
+				memset(integerbuffer_accel, 0, sizeof(integerbuffer_accel));
+				double accel = time_to_integer(test_case->jack_to_integer_accel, skip, test_case->ditherstate, integerbuffer_accel);
+				printf(
+					"JackFloat->Integer @%7.7s/%u %6s: %8.1f Msamples/s -> Win: %5.2f %%\n",
+					test_case->name,
+					channels,
+					simd_level_names[level],
+					throughput(accel, frames),
+					(orig/accel-1)*100.0);
+				// dithering draws noise: compare one call from the same seed
+				accelerated::seed = origerated::seed = 22222;
+				test_case->jack_to_integer_orig(integerbuffer_orig, jackbuffer_source, frames, skip, test_case->ditherstate);
+				test_case->jack_to_integer_accel(integerbuffer_accel, jackbuffer_source, frames, skip, test_case->ditherstate);
+				compare_integer(test_case, channels, simd_level_names[level], maxerr_displayed);
 			}
-			printf(
-				"JackFloat->Integer @%7.7s/%u: Errors: %u Max deviation %u\n",
-				test_cases[testcase].name,
-				channels,
-				int_error_count,
-				int_deviation_max);
 
 			//////////////////////////////////////////////////////////////////////////////
 			// integer -> jackfloat
 
-			// clean target buffers
-			memset(jackfloatbuffer_accel, 0, sizeof(jackfloatbuffer_accel));
 			memset(jackfloatbuffer_orig, 0, sizeof(jackfloatbuffer_orig));
-			// accel
-			clock_t time_to_float_accel = clock();
-			for(uint32_t repetition=0; repetition<retry_per_case; repetition++)
-			{
-				test_cases[testcase].integer_to_jack_accel(
-					jackfloatbuffer_accel,
-					integerbuffer_orig,
-					TESTBUFF_SIZE,
-					test_cases[testcase].frame_size*channels);
-			}
-			float timediff_to_float_accel = ((float)(clock() - time_to_float_accel)) / CLOCKS_PER_SEC;
-			// orig
-			clock_t time_to_float_orig = clock();
-			for(uint32_t repetition=0; repetition<retry_per_case; repetition++)
-			{
-				test_cases[testcase].integer_to_jack_orig(
-					jackfloatbuffer_orig,
-					integerbuffer_orig,
-					TESTBUFF_SIZE,
-					test_cases[testcase].frame_size*channels);
-			}
-			float timediff_to_float_orig = ((float)(clock() - time_to_float_orig)) / CLOCKS_PER_SEC;
-			// output performance results
+			orig = time_to_float(test_case->integer_to_jack_orig, skip, jackfloatbuffer_orig);
 			printf(
-				"Integer->JackFloat @%7.7s/%u: Orig %7.6f sec / Accel %7.6f sec -> Win: %5.2f %%\n",
-				test_cases[testcase].name,
+				"Integer->JackFloat @%7.7s/%u %6s: %8.1f Msamples/s\n",
+				test_case->name,
 				channels,
-				timediff_to_float_orig,
-				timediff_to_float_accel,
-				(timediff_to_float_orig/timediff_to_float_accel-1)*100.0);
-			jack_default_audio_sample_t float_deviation_max = 0.0;
-			uint32_t float_error_count = 0;
-			// output error (avoid spam -> limit error lines per test case)
-			for(uint32_t sample=0; sample<TESTBUFF_SIZE; sample++) {
-				// For easier estimation/readabilty we scale floats back to integer
-				jack_default_audio_sample_t sample_scaling;
-				switch(test_cases[testcase].sample_size) {
-					case 2:
-						sample_scaling = SAMPLE_16BIT_SCALING;
-						break;
-					default:
-						sample_scaling = SAMPLE_24BIT_SCALING;
-						break;
-				}
-				jack_default_audio_sample_t floatval_accel = jackfloatbuffer_accel[sample] * sample_scaling;
-				jack_default_audio_sample_t floatval_orig = jackfloatbuffer_orig[sample] * sample_scaling;
-				// compare both results
-				jack_default_audio_sample_t float_deviation;
-				if(floatval_accel > floatval_orig)
-					float_deviation = floatval_accel-floatval_orig;
-				else
-					float_deviation = floatval_orig-floatval_accel;
-				if(float_deviation > float_deviation_max)
-					float_deviation_max = float_deviation;
-				// deviation > half bit => error
-				if(float_deviation > 0.5) {
-					if(float_error_count<maxerr_displayed) {
-						printf("Value error sample %u:", sample);
-						printf(" Orig %8.1f Accel %8.1f\n", floatval_orig, floatval_accel);
-					}
-					float_error_count++;
-				}
+				"scalar",
+				throughput(orig, frames));
+			for(int level=MEMOPS_SIMD_NONE; level<=max_level; level++) {
+				accelerated::memops_set_simd_level(level);
+				memset(jackfloatbuffer_accel, 0, sizeof(jackfloatbuffer_accel));
+				double accel = time_to_float(test_case->integer_to_jack_accel, skip, jackfloatbuffer_accel);
+				printf(
+					"Integer->JackFloat @%7.7s/%u %6s: %8.1f Msamples/s -> Win: %5.2f %%\n",
+					test_case->name,
+					channels,
+					simd_level_names[level],
+					throughput(accel, frames),
+					(orig/accel-1)*100.0);
+				compare_float(test_case, channels, simd_level_names[level], maxerr_displayed);
 			}
-			printf(
-				"Integer->JackFloat @%7.7s/%u: Errors: %u Max deviation %f\n",
-				test_cases[testcase].name,
-				channels,
-				float_error_count,
-				float_deviation_max);
 
 			printf("\n");
 		}
 	}
+}
+
+static void test_mixdown(int max_level)
+{
+	static jack_default_audio_sample_t mix_generic[TESTBUFF_SIZE] ALIGNED;
+	static jack_default_audio_sample_t mix_accel[TESTBUFF_SIZE] ALIGNED;
+	jack_default_audio_sample_t *sources[MIXDOWN_SOURCES_MAX];
+
+	for(uint32_t i=0; i<MIXDOWN_SOURCES_MAX; i++) {
+		sources[i] = mixdown_sources[i];
+		for(uint32_t frame=0; frame<frames; frame++)
+			mixdown_sources[i][frame] = (jack_default_audio_sample_t)rand() / RAND_MAX * 2.0f - 1.0f;
+	}
+
+	for(int src_count=2; src_count<=MIXDOWN_SOURCES_MAX; src_count*=2) {
+		double generic = 0.0;
+		for(int level=MIXDOWN_GENERIC; level<=max_level; level++) {
+			jack_default_audio_sample_t *mix = (level == MIXDOWN_GENERIC) ? mix_generic : mix_accel;
+			double best = 0.0;
+			for(uint32_t run=0; run<runs_per_case; run++) {
+				double start = now();
+				for(uint32_t repetition=0; repetition<retry_per_case; repetition++)
+					Jack::AudioBufferMixdownLevel(level, mix, sources, src_count, frames);
+				double elapsed = now() - start;
+				if(run == 0 || elapsed < best)
+					best = elapsed;
+			}
+			if(level == MIXDOWN_GENERIC) {
+				generic = best;
+				printf(
+					"Mixdown @%2d sources %7s: %8.1f Mframes/s\n",
+					src_count,
+					"generic",
+					throughput(best, frames));
+				continue;
+			}
+			uint32_t error_count = 0;
+			for(uint32_t frame=0; frame<frames; frame++) {
+				if(mix_accel[frame] != mix_generic[frame])
+					error_count++;
+			}
+			printf(
+				"Mixdown @%2d sources %7s: %8.1f Mframes/s -> Win: %5.2f %% Errors: %u\n",
+				src_count,
+				simd_level_names[level],
+				throughput(best, frames),
+				(generic/best-1)*100.0,
+				error_count);
+		}
+	}
+	printf("\n");
+}
+
+static void usage()
+{
+	fprintf(stderr, "usage: jack_simdtests [ -f frames ] [ -r repetitions ] [ -n runs ] [ -c | -m ]\n");
+	fprintf(stderr, "  -f, --frames       samples per call (default 1024, max %d)\n", TESTBUFF_SIZE);
+	fprintf(stderr, "  -r, --repetitions  calls per timed run (default 1000)\n");
+	fprintf(stderr, "  -n, --runs         timed runs, the best one is kept (default 5)\n");
+	fprintf(stderr, "  -c, --conversions  only test the sample conversions\n");
+	fprintf(stderr, "  -m, --mixdown      only test the port mixdown\n");
+	fprintf(stderr, "Set JACK_SIMD_LEVEL=sse|avx2 to leave out the wider code paths.\n");
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t maxerr_displayed = 10;
+	bool conversions = true;
+	bool mixdown = true;
+	int c;
+	int option_index;
+	struct option long_options[] = {
+		{"frames", 1, 0, 'f'},
+		{"repetitions", 1, 0, 'r'},
+		{"runs", 1, 0, 'n'},
+		{"conversions", 0, 0, 'c'},
+		{"mixdown", 0, 0, 'm'},
+		{"help", 0, 0, 'h'},
+		{0, 0, 0, 0}
+	};
+
+	while ((c = getopt_long(argc, argv, "f:r:n:cmh", long_options, &option_index)) != -1) {
+		switch (c) {
+			case 'f':
+				frames = atoi(optarg);
+				if (frames < 1 || frames > TESTBUFF_SIZE) {
+					fprintf(stderr, "frames must be between 1 and %d\n", TESTBUFF_SIZE);
+					return 1;
+				}
+				break;
+			case 'r':
+				retry_per_case = atoi(optarg);
+				break;
+			case 'n':
+				runs_per_case = atoi(optarg);
+				break;
+			case 'c':
+				mixdown = false;
+				break;
+			case 'm':
+				conversions = false;
+				break;
+			default:
+				usage();
+				return (c == 'h') ? 0 : 1;
+		}
+	}
+	if (retry_per_case < 1)
+		retry_per_case = 1;
+	if (runs_per_case < 1)
+		runs_per_case = 1;
+
+	// fill jackbuffer
+	for(uint32_t i=0; i<frames; i++) {
+		// ramp
+		jack_default_audio_sample_t value =
+			((jack_default_audio_sample_t)((int)(i % frames) - (int)frames/2)) / (frames/2 ? frames/2 : 1);
+		// force clipping
+		value *= 1.02;
+		jackbuffer_source[i] = value;
+	}
+
+	int max_level = accelerated::memops_set_simd_level(MEMOPS_SIMD_AVX512);
+	printf("%u frames, best of %u runs of %u calls, SIMD up to %s\n\n",
+		frames, runs_per_case, retry_per_case, simd_level_names[max_level]);
+
+	if (conversions)
+		test_conversions(max_level, maxerr_displayed);
+	if (mixdown)
+		test_mixdown(Jack::DetectMixdownLevel());
 	return 0;
 }
@@ -0,0 +1,424 @@
+/** @file xrun_report.c
+ *
+ * @brief Reads the xrun dumps written by jackd (--xrun-dump) and shows which
+ * stage of the overrunning cycles took longer than usual.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#define MAX_CYCLES 8192
+#define MAX_CLIENTS 32
+#define MAX_REFNUM 256
+#define NAME_SIZE 128
+
+/* Stages of a cycle, clients have two stages each starting at STAGE_CLIENT */
+#define STAGE_READ 0
+#define STAGE_WRITE 1
+#define STAGE_WAIT 2
+#define STAGE_CYCLE 3
+#define STAGE_CLIENT 4
+#define STAGE_NUM (STAGE_CLIENT + 2 * MAX_REFNUM)
+
+#define NOT_REACHED -1
+
+typedef struct {
+	int refnum;
+	char status[16];
+	int signaled;
+	int awake;
+	int finished;
+} client_record_t;
+
+typedef struct {
+	unsigned int cycle;
+	long long begin;
+	int end;
+	int next;
+	int period;
+	int switched;
+	int finished;
+	int xrun;		/* -1 when none */
+	int client_num;
+	client_record_t clients[MAX_CLIENTS];
+} cycle_record_t;
+
+static cycle_record_t cycles[MAX_CYCLES];
+static int cycle_num;
+static char names[MAX_REFNUM][NAME_SIZE];
+static char server_name[NAME_SIZE];
+static unsigned int buffer_size;
+static unsigned int sample_rate;
+static long period;
+static int context = 0;
+
+static int *stage_values[STAGE_NUM];
+static int stage_count[STAGE_NUM];
+
+static void
+show_usage (void)
+{
+	fprintf (stderr, "\nUsage: jack_xrun_report [options] dump-file...\n");
+	fprintf (stderr, "Show which stage of the cycles reported in jackd xrun dumps overran.\n\n");
+	fprintf (stderr, "Options:\n");
+	fprintf (stderr, "        -c, --context <n>    Also print the n cycles before each xrun\n");
+	fprintf (stderr, "        -h, --help           Display this help message\n\n");
+}
+
+static const char *
+client_name (int refnum)
+{
+	if (refnum >= 0 && refnum < MAX_REFNUM && names[refnum][0]) {
+		return names[refnum];
+	}
+	return "(gone)";
+}
+
+static void
+stage_name (int stage, char *buffer, size_t size)
+{
+	switch (stage) {
+	case STAGE_READ:
+		snprintf (buffer, size, "driver read");
+		break;
+	case STAGE_WRITE:
+		snprintf (buffer, size, "driver write");
+		break;
+	case STAGE_WAIT:
+		snprintf (buffer, size, "driver wait");
+		break;
+	case STAGE_CYCLE:
+		snprintf (buffer, size, "driver cycle");
+		break;
+	default:
+		snprintf (buffer, size, "%s %s", client_name ((stage - STAGE_CLIENT) / 2),
+			  ((stage - STAGE_CLIENT) % 2) ? "process" : "wakeup");
+	}
+}
+
+/* Returns the duration of each stage of a cycle, NOT_REACHED when unknown */
+static void
+cycle_stages (cycle_record_t *record, int *stages)
+{
+	int first_signaled = -1;
+	int last_finished = -1;
+	int i;
+
+	for (i = 0; i < STAGE_NUM; i++) {
+		stages[i] = NOT_REACHED;
+	}
+
+	for (i = 0; i < record->client_num; i++) {
+		client_record_t *client = &record->clients[i];
+		int stage = STAGE_CLIENT + 2 * client->refnum;
+		if (client->refnum < 0 || client->refnum >= MAX_REFNUM) {
+			continue;
+		}
+		if (client->signaled >= 0 && (first_signaled < 0 || client->signaled < first_signaled)) {
+			first_signaled = client->signaled;
+		}
+		if (client->finished > last_finished) {
+			last_finished = client->finished;
+		}
+		if (client->signaled >= 0 && client->awake >= 0) {
+			stages[stage] = client->awake - client->signaled;
+		} else if (client->signaled >= 0 && !strcmp (client->status, "Triggered")) {
+			/* Not awake yet when the next cycle began */
+			stages[stage] = record->next - client->signaled;
+		}
+		if (client->awake >= 0 && client->finished >= 0) {
+			stages[stage + 1] = client->finished - client->awake;
+		} else if (client->awake >= 0 && !strcmp (client->status, "Running")) {
+			/* Still running when the next cycle began */
+			stages[stage + 1] = record->next - client->awake;
+		}
+	}
+
+	if (record->end >= 0) {
+		stages[STAGE_CYCLE] = record->end;
+		stages[STAGE_WAIT] = record->next - record->end;
+		stages[STAGE_READ] = (first_signaled >= 0) ? first_signaled : record->end;
+		if (last_finished >= 0 && last_finished <= record->end) {
+			stages[STAGE_WRITE] = record->end - last_finished;
+		}
+	}
+}
+
+static int
+compare_int (const void *a, const void *b)
+{
+	return *(const int *) a - *(const int *) b;
+}
+
+static int
+percentile (int stage, int percent)
+{
+	if (stage_count[stage] == 0) {
+		return NOT_REACHED;
+	}
+	return stage_values[stage][(stage_count[stage] - 1) * percent / 100];
+}
+
+static int
+is_xrun (cycle_record_t *record)
+{
+	return record->xrun >= 0 || !record->finished;
+}
+
+static int
+read_dump (const char *file_name)
+{
+	char line[512];
+	FILE *file;
+	int refnum;
+
+	if ((file = fopen (file_name, "r")) == NULL) {
+		perror (file_name);
+		return -1;
+	}
+
+	cycle_num = 0;
+	memset (names, 0, sizeof (names));
+	while (fgets (line, sizeof (line), file)) {
+		cycle_record_t *record = (cycle_num > 0) ? &cycles[cycle_num - 1] : NULL;
+		char xrun[32];
+		int offset;
+
+		line[strcspn (line, "\n")] = 0;
+		if (line[0] == '#') {
+			continue;
+		} else if (sscanf (line, "server %127s", server_name) == 1) {
+			continue;
+		} else if (sscanf (line, "buffer_size %u", &buffer_size) == 1) {
+			continue;
+		} else if (sscanf (line, "sample_rate %u", &sample_rate) == 1) {
+			continue;
+		} else if (sscanf (line, "period %ld", &period) == 1) {
+			continue;
+		} else if (sscanf (line, "name %d %n", &refnum, &offset) == 1) {
+			if (refnum >= 0 && refnum < MAX_REFNUM) {
+				snprintf (names[refnum], NAME_SIZE, "%s", line + offset);
+			}
+		} else if (strncmp (line, "cycle ", 6) == 0) {
+			if (cycle_num == MAX_CYCLES) {
+				fprintf (stderr, "%s: too many cycles, ignoring the last ones\n", file_name);
+				break;
+			}
+			record = &cycles[cycle_num];
+			if (sscanf (line, "cycle %u begin %lld end %d next %d period %d switched %d finished %d xrun %31s",
+				    &record->cycle, &record->begin, &record->end, &record->next, &record->period,
+				    &record->switched, &record->finished, xrun) != 8) {
+				fprintf (stderr, "%s: malformed line '%s'\n", file_name, line);
+				continue;
+			}
+			record->xrun = (xrun[0] == '-') ? -1 : atoi (xrun);
+			record->client_num = 0;
+			cycle_num++;
+		} else if (strncmp (line, " client ", 8) == 0 && record && record->client_num < MAX_CLIENTS) {
+			client_record_t *client = &record->clients[record->client_num];
+			if (sscanf (line, " client %d %15s %d %d %d", &client->refnum, client->status,
+				    &client->signaled, &client->awake, &client->finished) == 5) {
+				record->client_num++;
+			}
+		}
+	}
+
+	fclose (file);
+	return 0;
+}
+
+static void
+print_cycle (cycle_record_t *record)
+{
+	int i;
+
+	printf ("  cycle %u: driver cycle %d us, wait %d us%s%s\n", record->cycle, record->end,
+		record->next - record->end, record->switched ? ", new graph" : "",
+		record->finished ? "" : ", graph not finished");
+	for (i = 0; i < record->client_num; i++) {
+		client_record_t *client = &record->clients[i];
+		printf ("    %-24s %-12s signaled %6d awake %6d finished %6d\n", client_name (client->refnum),
+			client->status, client->signaled, client->awake, client->finished);
+	}
+}
+
+/* Prints the stages of a cycle compared to the usual ones, returns the stage with the largest excess */
+static int
+report_stages (cycle_record_t *record, int *culprit_excess)
+{
+	int stages[STAGE_NUM];
+	int culprit = NOT_REACHED;
+	char name[NAME_SIZE * 2];
+	int i;
+
+	*culprit_excess = 0;
+	cycle_stages (record, stages);
+	printf ("  cycle %u\n", record->cycle);
+	printf ("  %-32s %8s %8s %8s %8s\n", "stage", "this", "median", "p99", "excess");
+	for (i = 0; i < STAGE_NUM; i++) {
+		int median = percentile (i, 50);
+		int excess;
+		if (stages[i] == NOT_REACHED) {
+			continue;
+		}
+		stage_name (i, name, sizeof (name));
+		if (median == NOT_REACHED) {
+			printf ("  %-32s %8d %8s %8s %8s\n", name, stages[i], "-", "-", "-");
+			continue;
+		}
+		excess = stages[i] - median;
+		printf ("  %-32s %8d %8d %8d %+8d\n", name, stages[i], median, percentile (i, 99), excess);
+		if (i != STAGE_CYCLE && excess > *culprit_excess) {
+			culprit = i;
+			*culprit_excess = excess;
+		}
+	}
+	return culprit;
+}
+
+static void
+report_xrun (int index)
+{
+	cycle_record_t *record = &cycles[index];
+	cycle_record_t *culprit_record;
+	int culprit, culprit_excess;
+	int previous, previous_excess;
+	char name[NAME_SIZE * 2];
+	int i;
+
+	printf ("\nxrun at cycle %u", record->cycle);
+	if (record->xrun >= 0) {
+		printf (" (driver reports %d us late)", record->xrun);
+	}
+	printf (", driver cycle %d us for a %d us period%s\n", record->end, record->period,
+		record->switched ? ", graph changed in this cycle" : "");
+
+	for (i = (index > context) ? index - context : 0; i < index; i++) {
+		print_cycle (&cycles[i]);
+	}
+
+	/* Clients which did not finish are the first suspects */
+	for (i = 0; i < record->client_num; i++) {
+		client_record_t *client = &record->clients[i];
+		if (strcmp (client->status, "Finished") && strcmp (client->status, "NotTriggered")) {
+			printf ("  client %s did not finish (%s)\n", client_name (client->refnum), client->status);
+		}
+	}
+
+	/* Depending on the driver, the xrun is reported in the cycle which overran or in the next one */
+	culprit_record = record;
+	culprit = report_stages (record, &culprit_excess);
+	if (index > 0 && !is_xrun (&cycles[index - 1])) {
+		previous = report_stages (&cycles[index - 1], &previous_excess);
+		if (previous_excess > culprit_excess) {
+			culprit_record = &cycles[index - 1];
+			culprit = previous;
+			culprit_excess = previous_excess;
+		}
+	}
+
+	if (culprit != NOT_REACHED) {
+		stage_name (culprit, name, sizeof (name));
+		printf ("  => %s took %d us more than usual in cycle %u\n", name, culprit_excess,
+			culprit_record->cycle);
+	} else {
+		printf ("  => no stage took longer than usual, the delay is outside of the JACK cycle "
+			"(interrupts, other RT threads, hardware)\n");
+	}
+}
+
+static void
+report (const char *file_name)
+{
+	int stages[STAGE_NUM];
+	int xruns = 0;
+	int i, j;
+
+	if (read_dump (file_name) < 0) {
+		return;
+	}
+	if (cycle_num == 0) {
+		printf ("%s: no cycle recorded\n", file_name);
+		return;
+	}
+
+	/* Usual duration of each stage, from the cycles without xrun */
+	memset (stage_count, 0, sizeof (stage_count));
+	for (i = 0; i < cycle_num; i++) {
+		if (is_xrun (&cycles[i])) {
+			xruns++;
+			continue;
+		}
+		cycle_stages (&cycles[i], stages);
+		for (j = 0; j < STAGE_NUM; j++) {
+			if (stages[j] != NOT_REACHED) {
+				stage_values[j][stage_count[j]++] = stages[j];
+			}
+		}
+	}
+	for (j = 0; j < STAGE_NUM; j++) {
+		qsort (stage_values[j], stage_count[j], sizeof (int), compare_int);
+	}
+
+	printf ("%s: server '%s', %u frames at %u Hz (period %ld us)\n", file_name, server_name,
+		buffer_size, sample_rate, period);
+	printf ("%d cycles recorded over %.1f s, %d xrun(s)\n", cycle_num,
+		(cycles[cycle_num - 1].begin - cycles[0].begin) / 1000000.0, xruns);
+
+	for (i = 0; i < cycle_num; i++) {
+		if (is_xrun (&cycles[i])) {
+			report_xrun (i);
+		}
+	}
+	printf ("\n");
+}
+
+int
+main (int argc, char *argv[])
+{
+	int option_index;
+	int opt;
+	int i;
+	struct option long_options[] = {
+		{ "context", 1, 0, 'c' },
+		{ "help", 0, 0, 'h' },
+		{ 0, 0, 0, 0 }
+	};
+
+	while ((opt = getopt_long (argc, argv, "c:h", long_options, &option_index)) != -1) {
+		switch (opt) {
+		case 'c':
+			context = atoi (optarg);
+			break;
+		case 'h':
+			show_usage ();
+			return 0;
+		default:
+			show_usage ();
+			return 1;
+		}
+	}
+
+	if (optind == argc) {
+		show_usage ();
+		return 1;
+	}
+
+	for (i = 0; i < STAGE_NUM; i++) {
+		if ((stage_values[i] = malloc (MAX_CYCLES * sizeof (int))) == NULL) {
+			fprintf (stderr, "Out of memory\n");
+			return 1;
+		}
+	}
+
+	for (i = optind; i < argc; i++) {
+		report (argv[i]);
+	}
+
+	for (i = 0; i < STAGE_NUM; i++) {
+		free (stage_values[i]);
+	}
+	return 0;
+}
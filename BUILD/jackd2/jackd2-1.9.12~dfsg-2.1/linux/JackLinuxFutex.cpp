@@ -22,16 +22,31 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 #include "JackTools.h"
 #include "JackConstants.h"
 #include "JackError.h"
+#include "JackTime.h"
 #include "promiscuous.h"
 #include <fcntl.h>
+#include <sched.h>
 #include <stdio.h>
 #include <sys/mman.h>
 #include <syscall.h>
 #include <linux/futex.h>
 
+#define FUTEX_SPIN_POLL 64     // Polls between two clock reads
+
 namespace Jack
 {
 
+static inline void CpuRelax()
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || (defined(__arm__) && __ARM_ARCH >= 7)
+    __asm__ __volatile__("yield" ::: "memory");
+#else
+    __sync_synchronize();
+#endif
+}
+
 JackLinuxFutex::JackLinuxFutex() : JackSynchro(), fSharedMem(-1), fFutex(NULL), fPrivate(false)
 {
     const char* promiscuous = getenv("JACK_PROMISCUOUS_SERVER");
@@ -99,6 +114,56 @@ bool JackLinuxFutex::Wait()
     }
 }
 
+bool JackLinuxFutex::SpinWait(long sleep_usec, long spin_usec)
+{
+    if (!fFutex) {
+        return false;
+    }
+
+    if (fFutex->needsChange)
+    {
+        fFutex->needsChange = false;
+        fFutex->internal = !fFutex->internal;
+    }
+
+    if (sleep_usec > 0)
+    {
+        const timespec timeout = { static_cast<time_t>(sleep_usec / 1000000), (sleep_usec % 1000000) * 1000 };
+
+        for (;;)
+        {
+            if (__sync_bool_compare_and_swap(&fFutex->futex, 1, 0))
+                return true;
+
+            // Timeout or interrupted: go on with spinning
+            if (::syscall(__NR_futex, fFutex, fFutex->internal ? FUTEX_WAIT_PRIVATE : FUTEX_WAIT, 0, &timeout, NULL, 0) != 0 && errno != EWOULDBLOCK)
+                break;
+        }
+    }
+
+    if (spin_usec > 0)
+    {
+        const jack_time_t end = GetMicroSeconds() + spin_usec;
+
+        do {
+            for (int i = 0; i < FUTEX_SPIN_POLL; i++)
+            {
+                // Only try the atomic operation when the value changed, to keep the cache line shared
+                if (*(volatile int*)&fFutex->futex == 1 && __sync_bool_compare_and_swap(&fFutex->futex, 1, 0))
+                    return true;
+                CpuRelax();
+            }
+        } while (GetMicroSeconds() < end);
+    }
+
+    return false;
+}
+
+int JackLinuxFutex::GetCPU()
+{
+    return sched_getcpu();
+}
+
 bool JackLinuxFutex::TimedWait(long usec)
 {
     if (!fFutex) {
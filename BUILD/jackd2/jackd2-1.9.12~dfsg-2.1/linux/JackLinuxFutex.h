@@ -36,6 +36,9 @@ namespace Jack
 
  Adds a new 'MakePrivate' function that makes the sync happen in the local process only,
  making it even faster for internal clients.
+
+ 'SpinWait' first sleeps on the futex for at most sleep_usec, then polls it for at most spin_usec,
+ so that a signal expected soon does not go through a scheduler wakeup.
 */
 
 class SERVER_EXPORT JackLinuxFutex : public detail::JackSynchro
@@ -68,6 +71,7 @@ class SERVER_EXPORT JackLinuxFutex : public detail::JackSynchro
         bool SignalAll();
         bool Wait();
         bool TimedWait(long usec);
+        bool SpinWait(long sleep_usec, long spin_usec);
 
         bool Allocate(const char* name, const char* server_name, int value, bool internal = false);
         bool Connect(const char* name, const char* server_name);
@@ -77,6 +81,8 @@ class SERVER_EXPORT JackLinuxFutex : public detail::JackSynchro
         void Destroy();
 
         void MakePrivate(bool priv);
+
+        static int GetCPU();
 };
 
 } // end of namespace
@@ -141,7 +141,7 @@ int JackAlsaDriver::Attach()
             return -1;
         }
         port = fGraphManager->GetPort(port_index);
-        port->SetAlias(alias);
+        fGraphManager->SetPortAlias(port_index, alias);
         fCapturePortList[i] = port_index;
         jack_log("JackAlsaDriver::Attach fCapturePortList[i] %ld ", port_index);
     }
@@ -156,7 +156,7 @@ int JackAlsaDriver::Attach()
             return -1;
         }
         port = fGraphManager->GetPort(port_index);
-        port->SetAlias(alias);
+        fGraphManager->SetPortAlias(port_index, alias);
         fPlaybackPortList[i] = port_index;
         jack_log("JackAlsaDriver::Attach fPlaybackPortList[i] %ld ", port_index);
 
@@ -520,7 +520,7 @@ void* JackAlsaDriver::port_get_buffer(int port, jack_nframes_t nframes)
 
 int  JackAlsaDriver::port_set_alias(int port, const char* name)
 {
-    return fGraphManager->GetPort(port)->SetAlias(name);
+    return fGraphManager->SetPortAlias(port, name);
 }
 
 jack_nframes_t JackAlsaDriver::get_sample_rate() const
@@ -17,6 +17,7 @@ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
 
 */
 
+#include <cstring>
 #include <memory>
 #include <new>
 #include <stdexcept>
@@ -45,11 +46,13 @@ JackALSARawMidiDriver::JackALSARawMidiDriver(const char *name,
     output_ports = 0;
     output_port_timeouts = 0;
     poll_fds = 0;
+    share = 0;
 }
 
 JackALSARawMidiDriver::~JackALSARawMidiDriver()
 {
     delete thread;
+    delete share;
 }
 
 int
@@ -78,7 +81,7 @@ JackALSARawMidiDriver::Attach()
         }
         alias = input_port->GetAlias();
         port = fGraphManager->GetPort(index);
-        port->SetAlias(alias);
+        fGraphManager->SetPortAlias(index, alias);
         port->SetLatencyRange(JackCaptureLatency, &latency_range);
         fCapturePortList[i] = index;
 
@@ -104,7 +107,7 @@ JackALSARawMidiDriver::Attach()
         }
         alias = output_port->GetAlias();
         port = fGraphManager->GetPort(index);
-        port->SetAlias(alias);
+        fGraphManager->SetPortAlias(index, alias);
         port->SetLatencyRange(JackPlaybackLatency, &latency_range);
         fPlaybackPortList[i] = index;
 
@@ -344,6 +347,18 @@ JackALSARawMidiDriver::Init()
     return true;
 }
 
+int
+JackALSARawMidiDriver::OpenShare(const char *name)
+{
+    share = new JackMidiShareQueue();
+    if (share->Open(name, true)) {
+        delete share;
+        share = 0;
+        return -1;
+    }
+    return 0;
+}
+
 int
 JackALSARawMidiDriver::Open(bool capturing, bool playing, int in_channels,
                             int out_channels, bool monitor,
@@ -428,7 +443,8 @@ JackALSARawMidiDriver::Open(bool capturing, bool playing, int in_channels,
     for (size_t i = 0; i < potential_inputs; i++) {
         snd_rawmidi_info_t *info = in_info_list.at(i);
         try {
-            input_ports[num_inputs] = new JackALSARawMidiInputPort(info, i);
+            input_ports[num_inputs] =
+                new JackALSARawMidiInputPort(info, i, 4096, 1024, share);
             num_inputs++;
         } catch (std::exception e) {
             jack_error("JackALSARawMidiDriver::Open - while creating new "
@@ -632,19 +648,47 @@ extern "C" {
     driver_get_descriptor()
     {
         // X: There could be parameters here regarding setting I/O buffer
-        // sizes.  I don't think MIDI drivers can accept parameters right
-        // now without being set as the main driver.
+        // sizes.
+
+        jack_driver_desc_t * desc;
+        jack_driver_desc_filler_t filler;
+        jack_driver_param_value_t value;
+
+        desc = jack_driver_descriptor_construct("alsarawmidi", JackDriverSlave, "Alternative ALSA raw MIDI backend.", &filler);
+
+        strcpy(value.str, "");
+        jack_driver_descriptor_add_parameter(desc, &filler, "share", 's', JackDriverParamString, &value, NULL, "Also publish input events to this shared queue", "Also publish input events to this shared queue, for the 'midishare' driver of other servers (ports are numbered in ALSA order)");
 
-        return jack_driver_descriptor_construct("alsarawmidi", JackDriverSlave, "Alternative ALSA raw MIDI backend.", NULL);
+        return desc;
     }
 
     SERVER_EXPORT Jack::JackDriverClientInterface *
     driver_initialize(Jack::JackLockedEngine *engine, Jack::JackSynchro *table,
                       const JSList *params)
     {
+        const JSList * node;
+        const jack_driver_param_t * param;
+        const char *share_name = "";
+
+        for (node = params; node; node = jack_slist_next (node)) {
+            param = (const jack_driver_param_t *) node->data;
+
+            switch (param->character) {
+
+                case 's':
+                    share_name = param->value.str;
+                    break;
+            }
+        }
+
         // singleton kind of driver
         if (!driver) {
             driver = new Jack::JackALSARawMidiDriver("system_midi", "alsarawmidi", engine, table);
+            if (share_name[0] && driver->OpenShare(share_name)) {
+                delete driver;
+                driver = NULL;
+                return NULL;
+            }
             if (driver->Open(1, 1, 0, 0, false, "midi in", "midi out", 0, 0) == 0) {
                 return driver;
             } else {
@@ -44,6 +44,7 @@ namespace Jack {
         nfds_t poll_fd_count;
         struct pollfd *poll_fds;
         JackThread *thread;
+        JackMidiShareQueue *share;
 
         void
         FreeDeviceInfo(std::vector<snd_rawmidi_info_t *> *in_info_list,
@@ -75,6 +76,9 @@ namespace Jack {
         bool
         Init();
 
+        int
+        OpenShare(const char *name);
+
         int
         Open(bool capturing, bool playing, int in_channels, int out_channels,
              bool monitoring, const char *capture_driver_name,
@@ -29,7 +29,8 @@ using Jack::JackALSARawMidiInputPort;
 JackALSARawMidiInputPort::JackALSARawMidiInputPort(snd_rawmidi_info_t *info,
                                                    size_t index,
                                                    size_t max_bytes,
-                                                   size_t max_messages):
+                                                   size_t max_messages,
+                                                   JackMidiShareQueue *share):
     JackALSARawMidiPort(info, index, POLLIN)
 {
     alsa_event = 0;
@@ -40,8 +41,17 @@ JackALSARawMidiInputPort::JackALSARawMidiInputPort(snd_rawmidi_info_t *info,
     std::auto_ptr<JackMidiAsyncQueue> thread_ptr(thread_queue);
     write_queue = new JackMidiBufferWriteQueue();
     std::auto_ptr<JackMidiBufferWriteQueue> write_ptr(write_queue);
-    raw_queue = new JackMidiRawInputWriteQueue(thread_queue, max_bytes,
+    JackMidiWriteQueue *parsed_queue = thread_queue;
+    share_queue = 0;
+    if (share) {
+        // Parsed messages are also published to the shared queue.
+        share_queue = new JackMidiShareWriteQueue(share, index, thread_queue);
+        parsed_queue = share_queue;
+    }
+    std::auto_ptr<JackMidiShareWriteQueue> share_ptr(share_queue);
+    raw_queue = new JackMidiRawInputWriteQueue(parsed_queue, max_bytes,
                                                max_messages);
+    share_ptr.release();
     write_ptr.release();
     thread_ptr.release();
     receive_ptr.release();
@@ -50,6 +60,7 @@ JackALSARawMidiInputPort::JackALSARawMidiInputPort(snd_rawmidi_info_t *info,
 JackALSARawMidiInputPort::~JackALSARawMidiInputPort()
 {
     delete raw_queue;
+    delete share_queue;
     delete receive_queue;
     delete thread_queue;
     delete write_queue;
@@ -25,6 +25,7 @@ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
 #include "JackMidiAsyncQueue.h"
 #include "JackMidiBufferWriteQueue.h"
 #include "JackMidiRawInputWriteQueue.h"
+#include "midishare/JackMidiShareQueue.h"
 
 namespace Jack {
 
@@ -37,13 +38,15 @@ namespace Jack {
         JackMidiRawInputWriteQueue *raw_queue;
         JackALSARawMidiReceiveQueue *receive_queue;
         JackMidiAsyncQueue *thread_queue;
+        JackMidiShareWriteQueue *share_queue;
         JackMidiBufferWriteQueue *write_queue;
 
     public:
 
         JackALSARawMidiInputPort(snd_rawmidi_info_t *info, size_t index,
                                  size_t max_bytes=4096,
-                                 size_t max_messages=1024);
+                                 size_t max_messages=1024,
+                                 JackMidiShareQueue *share=0);
 
         ~JackALSARawMidiInputPort();
 
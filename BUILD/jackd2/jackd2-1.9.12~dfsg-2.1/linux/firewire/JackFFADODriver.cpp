@@ -526,7 +526,7 @@ int JackFFADODriver::Attach()
             port = fGraphManager->GetPort(port_index);
             // capture port aliases (jackd1 style port names)
             snprintf(buf, sizeof(buf), "%s:capture_%i", fClientControl.fName, (int) chn + 1);
-            port->SetAlias(buf);
+            fGraphManager->SetPortAlias(port_index, buf);
             fCapturePortList[chn] = port_index;
             jack_log("JackFFADODriver::Attach fCapturePortList[i] %ld ", port_index);
             fCaptureChannels++;
@@ -598,7 +598,7 @@ int JackFFADODriver::Attach()
             // Add one buffer more latency if "async" mode is used...
             // playback port aliases (jackd1 style port names)
             snprintf(buf, sizeof(buf), "%s:playback_%i", fClientControl.fName, (int) chn + 1);
-            port->SetAlias(buf);
+            fGraphManager->SetPortAlias(port_index, buf);
             fPlaybackPortList[chn] = port_index;
             jack_log("JackFFADODriver::Attach fPlaybackPortList[i] %ld ", port_index);
             fPlaybackChannels++;
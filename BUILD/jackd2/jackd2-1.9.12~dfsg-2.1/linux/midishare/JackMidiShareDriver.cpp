@@ -0,0 +1,307 @@
+/*
+Copyright (C) 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+*/
+
+#include <cstring>
+
+#include "JackEngineControl.h"
+#include "JackError.h"
+#include "JackGraphManager.h"
+#include "JackMidiShareDriver.h"
+#include "JackMidiUtil.h"
+#include "driver_interface.h"
+
+#define MIDI_SHARE_MAX_PORTS 16
+
+using Jack::JackMidiShareDriver;
+
+JackMidiShareDriver::JackMidiShareDriver(const char *name, const char *alias,
+                                         JackLockedEngine *engine,
+                                         JackSynchro *table):
+    JackMidiDriver(name, alias, engine, table)
+{
+    export_queues = 0;
+    import_queues = 0;
+    import_events = 0;
+    latency = 0;
+    latency_set = false;
+    late_events = 0;
+}
+
+JackMidiShareDriver::~JackMidiShareDriver()
+{
+    FreeQueues();
+}
+
+void
+JackMidiShareDriver::FreeQueues()
+{
+    if (export_queues) {
+        for (int i = 0; i < fPlaybackChannels; i++) {
+            delete export_queues[i];
+        }
+        delete[] export_queues;
+        export_queues = 0;
+    }
+    if (import_queues) {
+        for (int i = 0; i < fCaptureChannels; i++) {
+            delete import_queues[i];
+        }
+        delete[] import_queues;
+        import_queues = 0;
+    }
+    delete[] import_events;
+    import_events = 0;
+    export_queue.Close();
+}
+
+int
+JackMidiShareDriver::Close()
+{
+    // Generic MIDI driver close
+    int result = JackMidiDriver::Close();
+
+    if (late_events) {
+        jack_info("JackMidiShareDriver::Close - %u events were delivered "
+                  "late, consider increasing the latency", late_events);
+    }
+    FreeQueues();
+    return result;
+}
+
+int
+JackMidiShareDriver::Open(const char *export_name, const char *import_name,
+                          int ports, jack_nframes_t latency, bool latency_set)
+{
+    int capture_channels = import_name[0] ? ports : 0;
+    int playback_channels = export_name[0] ? ports : 0;
+    int i;
+
+    if (! (capture_channels || playback_channels)) {
+        jack_error("JackMidiShareDriver::Open - no queue to import or "
+                   "export");
+        return -1;
+    }
+    if ((ports < 1) || (ports > MIDI_SHARE_MAX_PORTS)) {
+        jack_error("JackMidiShareDriver::Open - the number of ports must be "
+                   "between 1 and %d", MIDI_SHARE_MAX_PORTS);
+        return -1;
+    }
+    this->latency = latency;
+    this->latency_set = latency_set;
+
+    if (playback_channels) {
+        if (export_queue.Open(export_name, true)) {
+            return -1;
+        }
+        export_queues = new JackMidiShareWriteQueue *[playback_channels];
+        for (i = 0; i < playback_channels; i++) {
+            export_queues[i] = new JackMidiShareWriteQueue(&export_queue, i);
+        }
+    }
+    if (capture_channels) {
+        import_queues = new JackMidiShareReadQueue *[capture_channels];
+        import_events = new jack_midi_event_t *[capture_channels];
+        for (i = 0; i < capture_channels; i++) {
+            import_queues[i] = new JackMidiShareReadQueue(i);
+            import_events[i] = 0;
+        }
+        for (i = 0; i < capture_channels; i++) {
+            if (import_queues[i]->Open(import_name)) {
+                goto free_queues;
+            }
+        }
+    }
+
+    if (! JackMidiDriver::Open(capture_channels != 0, playback_channels != 0,
+                               capture_channels, playback_channels, false,
+                               import_name[0] ? import_name : "none",
+                               export_name[0] ? export_name : "none",
+                               latency, 0)) {
+        jack_info("JackMidiShareDriver::Open - %d port(s), export queue "
+                  "'%s', import queue '%s'", ports, export_name, import_name);
+        return 0;
+    }
+    jack_error("JackMidiShareDriver::Open - JackMidiDriver::Open error");
+
+ free_queues:
+    fCaptureChannels = capture_channels;
+    fPlaybackChannels = playback_channels;
+    FreeQueues();
+    fCaptureChannels = 0;
+    fPlaybackChannels = 0;
+    return -1;
+}
+
+int
+JackMidiShareDriver::Read()
+{
+    jack_nframes_t buffer_size = fEngineControl->fBufferSize;
+    jack_nframes_t cycle_start = GetLastFrame();
+    for (int i = 0; i < fCaptureChannels; i++) {
+        JackMidiShareReadQueue *queue = import_queues[i];
+        queue->SetLatency(latency_set ? latency : buffer_size);
+        write_queue.ResetMidiBuffer(GetInputBuffer(i), buffer_size);
+
+        // An event that is due in a later cycle stays in `import_events`
+        // until then, as the queue event it points to is only overwritten
+        // by the next dequeue.
+        jack_midi_event_t *event = import_events[i];
+        if (! event) {
+            event = queue->DequeueEvent();
+        }
+        for (; event; event = queue->DequeueEvent()) {
+            if (((int32_t) (event->time - cycle_start)) < 0) {
+                late_events++;
+            }
+            switch (write_queue.EnqueueEvent(event)) {
+            case JackMidiWriteQueue::BUFFER_TOO_SMALL:
+                jack_error("JackMidiShareDriver::Read - the port buffer is "
+                           "too small to hold a %d-byte event.  Dropping "
+                           "event.", event->size);
+                // Fallthrough on purpose
+            case JackMidiWriteQueue::OK:
+                continue;
+            default:
+                ;
+            }
+            break;
+        }
+        import_events[i] = event;
+
+        uint32_t lost = queue->GetLostEvents();
+        if (lost) {
+            jack_error("JackMidiShareDriver::Read - %u events were lost on "
+                       "queue '%s', capture port %d", lost,
+                       fCaptureDriverName, i + 1);
+        }
+    }
+    return 0;
+}
+
+void
+JackMidiShareDriver::UpdateLatencies()
+{
+    JackMidiDriver::UpdateLatencies();
+
+    // Imported events are delayed by the configured latency, not by the
+    // period that reads them.
+    jack_latency_range_t range;
+    range.min = range.max = latency_set ? latency : fEngineControl->fBufferSize;
+    for (int i = 0; i < fCaptureChannels; i++) {
+        fGraphManager->GetPort(fCapturePortList[i])->
+            SetLatencyRange(JackCaptureLatency, &range);
+    }
+}
+
+int
+JackMidiShareDriver::Write()
+{
+    for (int i = 0; i < fPlaybackChannels; i++) {
+        read_queue.ResetMidiBuffer(GetOutputBuffer(i));
+        for (jack_midi_event_t *event = read_queue.DequeueEvent(); event;
+             event = read_queue.DequeueEvent()) {
+            export_queues[i]->EnqueueEvent(event);
+        }
+    }
+    return 0;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // singleton kind of driver
+    static Jack::JackMidiShareDriver *driver = NULL;
+
+    SERVER_EXPORT jack_driver_desc_t *
+    driver_get_descriptor()
+    {
+        jack_driver_desc_t * desc;
+        jack_driver_desc_filler_t filler;
+        jack_driver_param_value_t value;
+
+        desc = jack_driver_descriptor_construct("midishare", JackDriverSlave, "Shared memory MIDI queues between servers", &filler);
+
+        strcpy(value.str, "");
+        jack_driver_descriptor_add_parameter(desc, &filler, "export", 'e', JackDriverParamString, &value, NULL, "Queue the playback ports are published to", NULL);
+        jack_driver_descriptor_add_parameter(desc, &filler, "import", 'i', JackDriverParamString, &value, NULL, "Queue the capture ports are read from", NULL);
+
+        value.ui = 1U;
+        jack_driver_descriptor_add_parameter(desc, &filler, "ports", 'p', JackDriverParamUInt, &value, NULL, "Number of MIDI ports in each direction", NULL);
+
+        value.ui = 0U;
+        jack_driver_descriptor_add_parameter(desc, &filler, "latency", 'l', JackDriverParamUInt, &value, NULL, "Delay of imported events in frames", "Delay of imported events in frames (default: one period, use two periods for queues published from a driver)");
+
+        return desc;
+    }
+
+    SERVER_EXPORT Jack::JackDriverClientInterface *
+    driver_initialize(Jack::JackLockedEngine *engine, Jack::JackSynchro *table,
+                      const JSList *params)
+    {
+        const JSList * node;
+        const jack_driver_param_t * param;
+        const char *export_name = "";
+        const char *import_name = "";
+        int ports = 1;
+        jack_nframes_t latency = 0;
+        bool latency_set = false;
+
+        for (node = params; node; node = jack_slist_next (node)) {
+            param = (const jack_driver_param_t *) node->data;
+
+            switch (param->character) {
+
+                case 'e':
+                    export_name = param->value.str;
+                    break;
+
+                case 'i':
+                    import_name = param->value.str;
+                    break;
+
+                case 'p':
+                    ports = param->value.ui;
+                    break;
+
+                case 'l':
+                    latency = param->value.ui;
+                    latency_set = true;
+                    break;
+            }
+        }
+
+        if (!driver) {
+            driver = new Jack::JackMidiShareDriver("midishare", "midishare", engine, table);
+            if (driver->Open(export_name, import_name, ports, latency, latency_set) == 0) {
+                return driver;
+            } else {
+                delete driver;
+                driver = NULL;
+                return NULL;
+            }
+        } else {
+            jack_info("JackMidiShareDriver already allocated, cannot be loaded twice");
+            return NULL;
+        }
+    }
+
+#ifdef __cplusplus
+}
+#endif
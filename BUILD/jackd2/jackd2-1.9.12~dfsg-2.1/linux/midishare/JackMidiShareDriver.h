@@ -0,0 +1,86 @@
+/*
+Copyright (C) 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+*/
+
+#ifndef __JackMidiShareDriver__
+#define __JackMidiShareDriver__
+
+#include "JackMidiBufferReadQueue.h"
+#include "JackMidiBufferWriteQueue.h"
+#include "JackMidiDriver.h"
+#include "JackMidiShareQueue.h"
+
+namespace Jack {
+
+    /**
+     * MIDI driver connecting the JACK graph to shared MIDI queues, so that
+     * MIDI can be fanned out from one server to several others on the same
+     * host without any JACK client in between.
+     *
+     * Events written to the playback ports are published to the 'export'
+     * queue, events published on the 'import' queue are delivered on the
+     * capture ports, `latency` frames after the time they were received.
+     */
+
+    class JackMidiShareDriver: public JackMidiDriver {
+
+    private:
+
+        JackMidiShareQueue export_queue;
+        JackMidiShareWriteQueue **export_queues;
+        JackMidiShareReadQueue **import_queues;
+        jack_midi_event_t **import_events;
+        JackMidiBufferReadQueue read_queue;
+        JackMidiBufferWriteQueue write_queue;
+        jack_nframes_t latency;
+        bool latency_set;
+        uint32_t late_events;
+
+        void
+        FreeQueues();
+
+    protected:
+
+        void
+        UpdateLatencies();
+
+    public:
+
+        JackMidiShareDriver(const char *name, const char *alias,
+                            JackLockedEngine *engine, JackSynchro *table);
+
+        ~JackMidiShareDriver();
+
+        int
+        Close();
+
+        int
+        Open(const char *export_name, const char *import_name,
+             int ports, jack_nframes_t latency, bool latency_set);
+
+        int
+        Read();
+
+        int
+        Write();
+
+    };
+
+}
+
+#endif
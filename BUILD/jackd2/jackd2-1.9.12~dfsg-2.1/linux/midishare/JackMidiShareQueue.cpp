@@ -0,0 +1,327 @@
+/*
+Copyright (C) 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+*/
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <grp.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "JackError.h"
+#include "JackMidiShareQueue.h"
+#include "JackMidiUtil.h"
+#include "JackTime.h"
+
+#define MIDI_SHARE_OPEN_RETRY 100             // Times 1 ms, while the creator sets the segment up
+
+using Jack::JackMidiShareQueue;
+using Jack::JackMidiShareReadQueue;
+using Jack::JackMidiShareWriteQueue;
+
+static inline void
+MemoryBarrier()
+{
+    __sync_synchronize();
+}
+
+// Same lookup as jack_group2gid(), which the server library doesn't export
+static int
+GetGroupId(const char *group)
+{
+    char buf[4096];
+    char *end;
+    struct group grp;
+    struct group *result = 0;
+
+    if ((! group) || (! *group)) {
+        return -1;
+    }
+    int gid = strtol(group, &end, 10);
+    if (! *end) {
+        return gid;
+    }
+    if (getgrnam_r(group, &grp, buf, sizeof(buf), &result) || (! result)) {
+        return -1;
+    }
+    return result->gr_gid;
+}
+
+JackMidiShareQueue::JackMidiShareQueue()
+{
+    header = 0;
+    name[0] = 0;
+    read_index = 0;
+}
+
+JackMidiShareQueue::~JackMidiShareQueue()
+{
+    Close();
+}
+
+int
+JackMidiShareQueue::Open(const char *name, bool writer)
+{
+    char shm_name[MIDI_SHARE_NAME_SIZE + 32];
+    struct stat st;
+    bool created = true;
+    int retry;
+
+    Close();
+    snprintf(this->name, sizeof(this->name), "%s", name);
+    snprintf(shm_name, sizeof(shm_name), "/jack_midi_share-%s", name);
+
+    int fd = shm_open(shm_name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd == -1 && errno == EEXIST) {
+        created = false;
+        fd = shm_open(shm_name, writer ? O_RDWR : O_RDONLY, 0600);
+    }
+    if (fd == -1) {
+        jack_error("JackMidiShareQueue::Open - cannot open '%s': %s",
+                   shm_name, strerror(errno));
+        return -1;
+    }
+
+    if (created) {
+        // Servers of other users may only share the queue through a group
+        const char* promiscuous = getenv("JACK_PROMISCUOUS_SERVER");
+        int gid = GetGroupId(promiscuous);
+        if (gid >= 0) {
+            if (fchown(fd, -1, gid) == -1 || fchmod(fd, 0660) == -1) {
+                jack_log("JackMidiShareQueue::Open - cannot share '%s' with "
+                         "group %d: %s", shm_name, gid, strerror(errno));
+            }
+        } else if (promiscuous) {
+            jack_log("JackMidiShareQueue::Open - no group '%s', '%s' is "
+                     "private", promiscuous, shm_name);
+        }
+        if (ftruncate(fd, sizeof(JackMidiShareHeader)) == -1) {
+            jack_error("JackMidiShareQueue::Open - cannot set size of '%s': "
+                       "%s", shm_name, strerror(errno));
+            close(fd);
+            shm_unlink(shm_name);
+            return -1;
+        }
+    } else {
+        for (retry = 0; retry < MIDI_SHARE_OPEN_RETRY; retry++) {
+            if (fstat(fd, &st) == 0 &&
+                st.st_size >= (off_t) sizeof(JackMidiShareHeader)) {
+                break;
+            }
+            JackSleep(1000);
+        }
+        if (retry == MIDI_SHARE_OPEN_RETRY) {
+            jack_error("JackMidiShareQueue::Open - '%s' has an incorrect "
+                       "size", shm_name);
+            close(fd);
+            return -1;
+        }
+    }
+
+    // The creator initializes the header, even if it only reads
+    int prot = (writer || created) ? PROT_READ | PROT_WRITE : PROT_READ;
+    void *addr = mmap(0, sizeof(JackMidiShareHeader), prot, MAP_SHARED, fd,
+                      0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        jack_error("JackMidiShareQueue::Open - cannot map '%s': %s",
+                   shm_name, strerror(errno));
+        return -1;
+    }
+    header = (JackMidiShareHeader *) addr;
+
+    if (created) {
+        memset(header, 0, sizeof(JackMidiShareHeader));
+        header->version = MIDI_SHARE_VERSION;
+        header->slot_count = MIDI_SHARE_SLOT_NUM;
+        header->slot_size = sizeof(JackMidiShareSlot);
+        MemoryBarrier();
+        header->magic = MIDI_SHARE_MAGIC;
+        if ((! writer) &&
+            (mprotect(header, sizeof(JackMidiShareHeader), PROT_READ) == -1)) {
+            jack_log("JackMidiShareQueue::Open - cannot make '%s' read-only: "
+                     "%s", shm_name, strerror(errno));
+        }
+    } else {
+        for (retry = 0; retry < MIDI_SHARE_OPEN_RETRY; retry++) {
+            if (header->magic == MIDI_SHARE_MAGIC) {
+                break;
+            }
+            JackSleep(1000);
+        }
+        MemoryBarrier();
+        if ((header->magic != MIDI_SHARE_MAGIC) ||
+            (header->version != MIDI_SHARE_VERSION) ||
+            (header->slot_count != MIDI_SHARE_SLOT_NUM) ||
+            (header->slot_size != sizeof(JackMidiShareSlot))) {
+            jack_error("JackMidiShareQueue::Open - '%s' has an incompatible "
+                       "layout", shm_name);
+            Close();
+            return -1;
+        }
+    }
+
+    // Avoid page faults in the RT thread, failure is not fatal
+    if (mlock(header, sizeof(JackMidiShareHeader)) == -1) {
+        jack_log("JackMidiShareQueue::Open - cannot lock '%s': %s",
+                 shm_name, strerror(errno));
+    }
+
+    read_index = header->write_index;
+    jack_info("JackMidiShareQueue::Open - %s queue '%s'",
+              created ? "created" : "attached to", name);
+    return 0;
+}
+
+void
+JackMidiShareQueue::Close()
+{
+    if (header) {
+        munlock(header, sizeof(JackMidiShareHeader));
+        munmap(header, sizeof(JackMidiShareHeader));
+        header = 0;
+    }
+}
+
+bool
+JackMidiShareQueue::Publish(jack_time_t time, uint32_t port, size_t size,
+                            const jack_midi_data_t *data)
+{
+    if ((! header) || (size > MIDI_SHARE_EVENT_SIZE)) {
+        return false;
+    }
+    uint32_t index = header->write_index;
+    Jack::JackMidiShareSlot *slot =
+        &(header->slots[index & (MIDI_SHARE_SLOT_NUM - 1)]);
+
+    // Readers that see a 0 serial, or a serial change while copying, know
+    // the slot is being overwritten.
+    slot->serial = 0;
+    MemoryBarrier();
+    slot->time = time;
+    slot->port = port;
+    slot->size = size;
+    memcpy(slot->data, data, size);
+    MemoryBarrier();
+    slot->serial = index + 1;
+    MemoryBarrier();
+    header->write_index = index + 1;
+    return true;
+}
+
+bool
+JackMidiShareQueue::Read(JackMidiShareSlot *slot, uint32_t *lost)
+{
+    if (! header) {
+        return false;
+    }
+    for (;;) {
+        uint32_t write_index = header->write_index;
+        MemoryBarrier();
+        uint32_t available = write_index - read_index;
+        if (! available) {
+            return false;
+        }
+        if (available > MIDI_SHARE_SLOT_NUM) {
+            *lost += available - MIDI_SHARE_SLOT_NUM;
+            read_index = write_index - MIDI_SHARE_SLOT_NUM;
+        }
+        Jack::JackMidiShareSlot *src =
+            &(header->slots[read_index & (MIDI_SHARE_SLOT_NUM - 1)]);
+        uint32_t serial = src->serial;
+        MemoryBarrier();
+        if (serial == read_index + 1) {
+            slot->time = src->time;
+            slot->port = src->port;
+            slot->size = src->size;
+            if (slot->size > MIDI_SHARE_EVENT_SIZE) {
+                slot->size = MIDI_SHARE_EVENT_SIZE;
+            }
+            memcpy(slot->data, src->data, slot->size);
+            MemoryBarrier();
+            if (src->serial == serial) {
+                read_index++;
+                return true;
+            }
+        }
+        // The producer wrapped around and overwrote the event
+        (*lost)++;
+        read_index++;
+    }
+}
+
+JackMidiShareWriteQueue::JackMidiShareWriteQueue(JackMidiShareQueue *queue,
+                                                 uint32_t port,
+                                                 JackMidiWriteQueue *next)
+{
+    this->queue = queue;
+    this->next = next;
+    this->port = port;
+}
+
+Jack::JackMidiWriteQueue::EnqueueResult
+JackMidiShareWriteQueue::EnqueueEvent(jack_nframes_t time, size_t size,
+                                      jack_midi_data_t *buffer)
+{
+    EnqueueResult result = next ? next->EnqueueEvent(time, size, buffer) : OK;
+    if (result == OK) {
+        if (! queue->Publish(GetTimeFromFrames(time), port, size, buffer)) {
+            jack_error("JackMidiShareWriteQueue::EnqueueEvent - cannot "
+                       "publish a %d-byte event on queue '%s'.", size,
+                       queue->GetName());
+            if (! next) {
+                result = BUFFER_TOO_SMALL;
+            }
+        }
+    }
+    return result;
+}
+
+JackMidiShareReadQueue::JackMidiShareReadQueue(uint32_t port)
+{
+    this->port = port;
+    latency = 0;
+    lost = 0;
+}
+
+uint32_t
+JackMidiShareReadQueue::GetLostEvents()
+{
+    uint32_t result = lost;
+    lost = 0;
+    return result;
+}
+
+jack_midi_event_t *
+JackMidiShareReadQueue::DequeueEvent()
+{
+    while (queue.Read(&slot, &lost)) {
+        if (slot.port == port) {
+            event.time = GetFramesFromTime(slot.time) + latency;
+            event.size = slot.size;
+            event.buffer = slot.data;
+            return &event;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+Copyright (C) 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+*/
+
+#ifndef __JackMidiShareQueue__
+#define __JackMidiShareQueue__
+
+#include <stdint.h>
+
+#include "JackMidiPort.h"
+#include "JackMidiReadQueue.h"
+#include "JackMidiWriteQueue.h"
+
+#define MIDI_SHARE_MAGIC 0x4a4d5351          // 'JMSQ'
+#define MIDI_SHARE_VERSION 1
+#define MIDI_SHARE_SLOT_NUM 1024             // Must be a power of two
+#define MIDI_SHARE_EVENT_SIZE 232
+#define MIDI_SHARE_NAME_SIZE 64
+
+namespace Jack {
+
+    /**
+     * A MIDI event in the shared ring.  `serial` is the index of the event
+     * plus one once the event is complete, and 0 while it is being written.
+     * 32 bit counters are used so that they are read and written atomically
+     * on all platforms, indexes are compared modulo 2^32.
+     */
+
+    struct JackMidiShareSlot {
+        volatile uint32_t serial;
+        jack_time_t time;
+        uint32_t port;
+        uint32_t size;
+        jack_midi_data_t data[MIDI_SHARE_EVENT_SIZE];
+    };
+
+    struct JackMidiShareHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t slot_count;
+        uint32_t slot_size;
+        volatile uint32_t write_index;
+        JackMidiShareSlot slots[MIDI_SHARE_SLOT_NUM];
+    };
+
+    /**
+     * A single producer, multiple consumer MIDI event ring, living in a
+     * POSIX shared memory segment so that several JACK servers on the same
+     * host can read what one of them publishes.
+     *
+     * Events carry the absolute time (in microseconds, as returned by
+     * `GetMicroSeconds()`) at which they were received, so that each reader
+     * can map them into its own frame time.  All servers sharing a queue
+     * must use the same clock source.
+     *
+     * Consumers never block the producer: a consumer that falls more than
+     * `MIDI_SHARE_SLOT_NUM` events behind loses the overwritten events.
+     * The segment is created by whichever side opens it first, and is not
+     * removed on close, so producers and consumers can be restarted in any
+     * order.  It is only accessible to the user who created it, or to the
+     * group named by `JACK_PROMISCUOUS_SERVER` when that is set.  Consumers
+     * map it read-only, their read position is kept in their own memory.
+     */
+
+    class SERVER_EXPORT JackMidiShareQueue {
+
+    private:
+
+        JackMidiShareHeader *header;
+        char name[MIDI_SHARE_NAME_SIZE];
+        uint32_t read_index;
+
+    public:
+
+        JackMidiShareQueue();
+
+        ~JackMidiShareQueue();
+
+        /**
+         * Creates or attaches to the queue called `name`, for publishing
+         * if `writer` is true and for reading otherwise.  Returns 0 on
+         * success.  Reading starts with the next published event.
+         */
+
+        int
+        Open(const char *name, bool writer);
+
+        void
+        Close();
+
+        const char *
+        GetName()
+        {
+            return name;
+        }
+
+        /**
+         * Publishes an event.  Events bigger than `MIDI_SHARE_EVENT_SIZE`
+         * bytes are rejected.  Only one thread, in one process, should
+         * publish to a given queue.
+         */
+
+        bool
+        Publish(jack_time_t time, uint32_t port, size_t size,
+                const jack_midi_data_t *data);
+
+        /**
+         * Copies the next published event into `slot`.  Returns `false` if
+         * there is no new event.  `lost` is incremented by the number of
+         * events that were overwritten before they could be read.
+         */
+
+        bool
+        Read(JackMidiShareSlot *slot, uint32_t *lost);
+
+    };
+
+    /**
+     * Write queue that publishes the events enqueued for one port to a
+     * shared queue, converting their frame time to microseconds with the
+     * frame timer of this server.  The events can also be forwarded to
+     * another write queue, in which case they are only published once
+     * `next` has accepted them.
+     */
+
+    class SERVER_EXPORT JackMidiShareWriteQueue: public JackMidiWriteQueue {
+
+    private:
+
+        JackMidiShareQueue *queue;
+        JackMidiWriteQueue *next;
+        uint32_t port;
+
+    public:
+
+        using JackMidiWriteQueue::EnqueueEvent;
+
+        JackMidiShareWriteQueue(JackMidiShareQueue *queue, uint32_t port,
+                                JackMidiWriteQueue *next=0);
+
+        EnqueueResult
+        EnqueueEvent(jack_nframes_t time, size_t size,
+                     jack_midi_data_t *buffer);
+
+    };
+
+    /**
+     * Read queue returning the events published on a shared queue for one
+     * port, with their time converted to a frame time of this server, and
+     * delayed by `latency` frames so that events arrive with a constant
+     * delay instead of being quantized to the period they were read in.
+     */
+
+    class SERVER_EXPORT JackMidiShareReadQueue: public JackMidiReadQueue {
+
+    private:
+
+        JackMidiShareQueue queue;
+        JackMidiShareSlot slot;
+        jack_midi_event_t event;
+        jack_nframes_t latency;
+        uint32_t port;
+        uint32_t lost;
+
+    public:
+
+        JackMidiShareReadQueue(uint32_t port);
+
+        int
+        Open(const char *name)
+        {
+            return queue.Open(name, false);
+        }
+
+        void
+        SetLatency(jack_nframes_t latency)
+        {
+            this->latency = latency;
+        }
+
+        /**
+         * Returns the number of events lost since the last call, and
+         * resets the counter.
+         */
+
+        uint32_t
+        GetLostEvents();
+
+        jack_midi_event_t *
+        DequeueEvent();
+
+    };
+
+}
+
+#endif
@@ -267,6 +267,46 @@ int JackPosixThread::DropRealTimeImp(jack_native_thread_t thread)
     return 0;
 }
 
+int JackPosixThread::AcquireAffinity(int cpu)
+{
+    return (fThread != (jack_native_thread_t)NULL) ? AcquireAffinityImp(fThread, cpu) : -1;
+}
+
+int JackPosixThread::AcquireSelfAffinity(int cpu)
+{
+    return AcquireAffinityImp(pthread_self(), cpu);
+}
+
+int JackPosixThread::AcquireAffinityImp(jack_native_thread_t thread, int cpu)
+{
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    int res;
+    CPU_ZERO(&cpu_set);
+
+    if (cpu < 0) {
+        for (int i = 0; i < CPU_SETSIZE; i++) {
+            CPU_SET(i, &cpu_set);
+        }
+    } else if (cpu < CPU_SETSIZE) {
+        CPU_SET(cpu, &cpu_set);
+    } else {
+        jack_error("Cannot set thread affinity to CPU %d", cpu);
+        return -1;
+    }
+
+    jack_log("JackPosixThread::AcquireAffinityImp cpu = %d", cpu);
+
+    if ((res = pthread_setaffinity_np(thread, sizeof(cpu_set), &cpu_set)) != 0) {
+        jack_error("Cannot set thread affinity to CPU %d (%d: %s)", cpu, res, strerror(res));
+        return -1;
+    }
+    return 0;
+#else
+    return -1;
+#endif
+}
+
 jack_native_thread_t JackPosixThread::GetThreadID()
 {
     return fThread;
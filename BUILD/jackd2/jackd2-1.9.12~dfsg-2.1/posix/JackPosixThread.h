@@ -67,6 +67,9 @@ class SERVER_EXPORT JackPosixThread : public detail::JackThreadInterface
         int DropRealTime();                     // Used when called from another thread
         int DropSelfRealTime();                 // Used when called from thread itself
 
+        int AcquireAffinity(int cpu);           // Used when called from another thread, cpu < 0 means all CPUs
+        int AcquireSelfAffinity(int cpu);       // Used when called from thread itself, cpu < 0 means all CPUs
+
         jack_native_thread_t GetThreadID();
         bool IsThread();
 
@@ -76,6 +79,7 @@ class SERVER_EXPORT JackPosixThread : public detail::JackThreadInterface
             return JackPosixThread::AcquireRealTimeImp(thread, priority);
         }
         static int DropRealTimeImp(jack_native_thread_t thread);
+        static int AcquireAffinityImp(jack_native_thread_t thread, int cpu);
         static int StartImp(jack_native_thread_t* thread, int priority, int realtime, void*(*start_routine)(void*), void* arg);
         static int StopImp(jack_native_thread_t thread);
         static int KillImp(jack_native_thread_t thread);
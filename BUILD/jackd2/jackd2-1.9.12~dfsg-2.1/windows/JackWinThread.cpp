@@ -239,6 +239,32 @@ int JackWinThread::DropRealTimeImp(jack_native_thread_t thread)
     }
 }
 
+int JackWinThread::AcquireAffinity(int cpu)
+{
+    return (fThread != (HANDLE)NULL) ? AcquireAffinityImp(fThread, cpu) : -1;
+}
+
+int JackWinThread::AcquireSelfAffinity(int cpu)
+{
+    return AcquireAffinityImp(GetCurrentThread(), cpu);
+}
+
+int JackWinThread::AcquireAffinityImp(jack_native_thread_t thread, int cpu)
+{
+    if (cpu >= int(sizeof(DWORD_PTR) * 8)) {
+        jack_error("Cannot set thread affinity to CPU %d", cpu);
+        return -1;
+    }
+
+    DWORD_PTR mask = (cpu < 0) ? ~DWORD_PTR(0) : (DWORD_PTR(1) << cpu);
+    if (SetThreadAffinityMask(thread, mask) != 0) {
+        return 0;
+    } else {
+        jack_error("Cannot set thread affinity = %d", GetLastError());
+        return -1;
+    }
+}
+
 jack_native_thread_t JackWinThread::GetThreadID()
 {
     return fThread;
@@ -65,6 +65,9 @@ class SERVER_EXPORT JackWinThread : public JackMMCSS, public detail::JackThreadI
         int DropRealTime();                     // Used when called from another thread
         int DropSelfRealTime();                 // Used when called from thread itself
 
+        int AcquireAffinity(int cpu);           // Used when called from another thread, cpu < 0 means all CPUs
+        int AcquireSelfAffinity(int cpu);       // Used when called from thread itself, cpu < 0 means all CPUs
+
         jack_native_thread_t GetThreadID();
         bool IsThread();
 
@@ -74,6 +77,7 @@ class SERVER_EXPORT JackWinThread : public JackMMCSS, public detail::JackThreadI
             return JackWinThread::AcquireRealTimeImp(thread, priority);
         }
         static int DropRealTimeImp(jack_native_thread_t thread);
+        static int AcquireAffinityImp(jack_native_thread_t thread, int cpu);
         static int StartImp(jack_native_thread_t* thread, int priority, int realtime, void*(*start_routine)(void*), void* arg)
         {
             return JackWinThread::StartImp(thread, priority, realtime, (ThreadCallback) start_routine, arg);
@@ -275,8 +275,7 @@ int JackPortAudioDriver::Attach()
         if (fInputDevice != paNoDevice && fPaDevices->GetHostFromDevice(fInputDevice) == "ASIO") {
             for (int i = 0; i < fCaptureChannels; i++) {
                 if (PaAsio_GetInputChannelName(fInputDevice, i, &alias) == paNoError) {
-                    JackPort* port = fGraphManager->GetPort(fCapturePortList[i]);
-                    port->SetAlias(alias);
+                    fGraphManager->SetPortAlias(fCapturePortList[i], alias);
                 }
             }
         }
@@ -284,8 +283,7 @@ int JackPortAudioDriver::Attach()
         if (fOutputDevice != paNoDevice && fPaDevices->GetHostFromDevice(fOutputDevice) == "ASIO") {
             for (int i = 0; i < fPlaybackChannels; i++) {
                 if (PaAsio_GetOutputChannelName(fOutputDevice, i, &alias) == paNoError) {
-                    JackPort* port = fGraphManager->GetPort(fPlaybackPortList[i]);
-                    port->SetAlias(alias);
+                    fGraphManager->SetPortAlias(fPlaybackPortList[i], alias);
                 }
             }
         }
@@ -69,7 +69,7 @@ JackWinMMEDriver::Attach()
             return -1;
         }
         port = fGraphManager->GetPort(index);
-        port->SetAlias(input_port->GetAlias());
+        fGraphManager->SetPortAlias(index, input_port->GetAlias());
         port->SetLatencyRange(JackCaptureLatency, &latency_range);
         fCapturePortList[i] = index;
     }
@@ -93,7 +93,7 @@ JackWinMMEDriver::Attach()
             return -1;
         }
         port = fGraphManager->GetPort(index);
-        port->SetAlias(output_port->GetAlias());
+        fGraphManager->SetPortAlias(index, output_port->GetAlias());
         port->SetLatencyRange(JackPlaybackLatency, &latency_range);
         fPlaybackPortList[i] = index;
     }
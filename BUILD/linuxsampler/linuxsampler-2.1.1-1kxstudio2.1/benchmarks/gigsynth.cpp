@@ -8,6 +8,10 @@
     fake audio outputs, so we don't have to load a .gig file or care about
     drivers.
 
+    Each mode is run with the C++ implementation and with every vectorized
+    implementation (SSE2, AVX2) the CPU supports. The output of the
+    vectorized implementations is checked against the C++ one.
+
     Copyright (C) 2005,2006 Christian Schoenebeck <cuse@users.sf.net>
 */
 
@@ -21,9 +25,11 @@
 
 #include "../src/engines/gig/SynthesisParam.h"
 #include "../src/engines/gig/Synthesizer.h"
+#include "../src/common/Features.h"
 
 #define FRAGMENTSIZE	200
 #define RUNS            100000
+#define INPUTSIZE       (FRAGMENTSIZE*6 + 100) // enough for 24 bit stereo without pitching
 
 using namespace LinuxSampler;
 using namespace LinuxSampler::gig;
@@ -33,6 +39,11 @@ int16_t* pSampleInputBuf; // just a buffer with random data
 float* pOutputL;
 float* pOutputR;
 
+float* pReferenceL; // output of the C++ implementation
+float* pReferenceR;
+
+static const char* implName[] = { "C++", "SSE2", "AVX2" };
+
 void printmode(int mode) {
     printf("Synthesis Mode: %d ",mode);
     printf("(BITDEPTH=%s,%s,DOLOOP=%s,FILTER=%s,INTERPOLATE=%s)\n",
@@ -45,22 +56,61 @@ void printmode(int mode) {
     fflush(stdout);
 }
 
+void render(SynthesizeFragment_Fn* f, SynthesisParam* pParam, Loop* pLoop, int runs) {
+    // zero out output buffers
+    memset(pOutputL,0,FRAGMENTSIZE*sizeof(float));
+    memset(pOutputR,0,FRAGMENTSIZE*sizeof(float));
+
+    pParam->filterLeft.Reset();
+    pParam->filterRight.Reset();
+
+    for (int i = 0; i < runs; i++) {
+        pParam->dPos      = 0.0;
+        pParam->fFinalVolumeLeft  = 1.0f;
+        pParam->fFinalVolumeRight = 1.0f;
+        pParam->pOutLeft  = pOutputL;
+        pParam->pOutRight = pOutputR;
+        pParam->uiToGo    = FRAGMENTSIZE;
+        // now actually render audio
+        f(pParam, pLoop);
+    }
+}
+
+// returns the largest difference to the reference output, relative to the largest reference value
+float compare() {
+    float maxValue = 0.0f, maxDiff = 0.0f;
+    for (int i = 0; i < FRAGMENTSIZE; i++) {
+        maxValue = fmaxf(maxValue, fmaxf(fabsf(pReferenceL[i]), fabsf(pReferenceR[i])));
+        maxDiff  = fmaxf(maxDiff, fmaxf(fabsf(pOutputL[i] - pReferenceL[i]), fabsf(pOutputR[i] - pReferenceR[i])));
+    }
+    return (maxValue > 0.0f) ? maxDiff / maxValue : maxDiff;
+}
+
 int main() {
-    pSampleInputBuf = new int16_t[FRAGMENTSIZE*2 + 100];
+    Features::detect();
+    printf("CPU features: %s\n", Features::featuresAsString().c_str());
+
+    int impls = 1;
+    #if CONFIG_ASM && ARCH_X86
+    if (Features::supportsSSE2()) impls = 2;
+    if (Features::supportsSSE2() && Features::supportsAVX2()) impls = 3;
+    #endif
+
+    pSampleInputBuf = new int16_t[INPUTSIZE];
     pOutputL = (float*) memalign(16,FRAGMENTSIZE*sizeof(float));
     pOutputR = (float*) memalign(16,FRAGMENTSIZE*sizeof(float));
+    pReferenceL = new float[FRAGMENTSIZE];
+    pReferenceR = new float[FRAGMENTSIZE];
 
     // prepare some input data for simulation
-    for (int i = 0; i < FRAGMENTSIZE*2; i++) {
-        pSampleInputBuf[i] = i;
+    for (int i = 0; i < INPUTSIZE; i++) {
+        pSampleInputBuf[i] = (i * 7919) ^ (i << 3);
     }
 
     SynthesisParam* pParam = new SynthesisParam;
     pParam->filterLeft.SetParameters(5.26f, 127.0f, 44100);
     pParam->filterRight.SetParameters(5.26f, 127.0f, 44100);
-    pParam->fFinalPitch = 0.5f;
-    pParam->fFinalVolumeLeft = 1.0f;
-    pParam->fFinalVolumeRight = 1.0f;
+    pParam->fFinalPitch = 0.7312f; // not a power of two, so position rounding matters
     pParam->fFinalVolumeDeltaLeft = 0;
     pParam->fFinalVolumeDeltaRight = 0;
     pParam->pSrc = pSampleInputBuf;
@@ -72,31 +122,46 @@ int main() {
     pLoop->uiSize  = 16;
     pLoop->uiTotalCycles = 0; // infinity
 
+    int failures = 0;
     for (int mode = 0; mode < 32; mode++) {
-            // zero out output buffers
-            memset(pOutputL,0,FRAGMENTSIZE*sizeof(float));
-            memset(pOutputR,0,FRAGMENTSIZE*sizeof(float));
-
-            pParam->filterLeft.Reset();
-            pParam->filterRight.Reset();
-
             printf("Benchmarking ");
             printmode(mode);
 
-            clock_t stop_time;
-            clock_t start_time = clock();
-
-            for (uint i = 0; i < RUNS; i++) {
-                pParam->dPos      = 0.0;
-                pParam->pOutLeft  = pOutputL;
-                pParam->pOutRight = pOutputR;
-                pParam->uiToGo    = FRAGMENTSIZE;
-                // now actually render audio
-                RunSynthesisFunction(mode, pParam, pLoop);
+            float cppTime = 0.0f;
+            for (int impl = 0; impl < impls; impl++) {
+                SynthesizeFragment_Fn* f =
+                    (SynthesizeFragment_Fn*) GetSynthesisFunction(mode, (synthesis_impl_t) impl);
+
+                // render a single fragment first to verify the result
+                render(f, pParam, pLoop, 1);
+                float error = 0.0f;
+                bool identical = true;
+                if (impl == 0) {
+                    memcpy(pReferenceL, pOutputL, FRAGMENTSIZE*sizeof(float));
+                    memcpy(pReferenceR, pOutputR, FRAGMENTSIZE*sizeof(float));
+                } else {
+                    // without a volume ramp the kernels must match the C++ code bit for bit
+                    error = compare();
+                    identical = memcmp(pOutputL, pReferenceL, FRAGMENTSIZE*sizeof(float)) == 0 &&
+                                memcmp(pOutputR, pReferenceR, FRAGMENTSIZE*sizeof(float)) == 0;
+                }
+
+                clock_t start_time = clock();
+                render(f, pParam, pLoop, RUNS);
+                clock_t stop_time = clock();
+
+                float elapsed_time = (stop_time - start_time) / (double(CLOCKS_PER_SEC) / 1000.0);
+                if (impl == 0) {
+                    cppTime = elapsed_time;
+                    printf("\t%-4s: %1.0f ms\n", implName[impl], elapsed_time);
+                } else {
+                    if (!identical) failures++;
+                    printf("\t%-4s: %1.0f ms (%1.2fx, error %g%s)\n", implName[impl], elapsed_time,
+                           (elapsed_time > 0.0f) ? cppTime / elapsed_time : 0.0f, error,
+                           identical ? "" : " MISMATCH");
+                }
             }
-
-            stop_time = clock();
-            float elapsed_time = (stop_time - start_time) / (double(CLOCKS_PER_SEC) / 1000.0);
-            printf("\t: %1.0f ms\n", elapsed_time);
     }
+    if (failures) printf("%d mode(s) with mismatching output!\n", failures);
+    return failures ? 1 : 0;
 }
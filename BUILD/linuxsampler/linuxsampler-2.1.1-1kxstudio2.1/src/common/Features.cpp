@@ -27,32 +27,65 @@
 bool Features::bMMX(false);
 bool Features::bSSE(false);
 bool Features::bSSE2(false);
+bool Features::bAVX2(false);
+bool Features::bFMA(false);
 
-void Features::detect() {
+static void cpuid(int leaf, int subleaf, int* eax, int* ebx, int* ecx, int* edx) {
 #ifdef __x86_64__
-    int64_t edx;
+    int64_t a, b, c, d;
     __asm__ __volatile__ (
         "mov %%rbx,%%rdi\n\t" /*save PIC register*/
-        "movl $1,%%eax\n\t"
         "cpuid\n\t"
-        "mov %%rdi,%%rbx\n\t" /*restore PIC register*/
-        : "=d" (edx)
-        : : "%rax", "%rcx", "%rdi"
+        "xchg %%rdi,%%rbx\n\t" /*restore PIC register*/
+        : "=a" (a), "=D" (b), "=c" (c), "=d" (d)
+        : "a" ((int64_t) leaf), "c" ((int64_t) subleaf)
     );
 #else
-    int edx;
+    int a, b, c, d;
     __asm__ __volatile__ (
         "movl %%ebx,%%edi\n\t" /*save PIC register*/
-        "movl $1,%%eax\n\t"
         "cpuid\n\t"
-        "movl %%edi,%%ebx\n\t" /*restore PIC register*/
-        : "=d" (edx)
-        : : "%eax", "%ecx", "%edi"
+        "xchgl %%edi,%%ebx\n\t" /*restore PIC register*/
+        : "=a" (a), "=D" (b), "=c" (c), "=d" (d)
+        : "a" (leaf), "c" (subleaf)
     );
 #endif
+    *eax = (int) a;
+    *ebx = (int) b;
+    *ecx = (int) c;
+    *edx = (int) d;
+}
+
+void Features::detect() {
+    int eax, ebx, ecx, edx;
+    cpuid(0, 0, &eax, &ebx, &ecx, &edx);
+    const int maxLeaf = eax;
+
+    cpuid(1, 0, &eax, &ebx, &ecx, &edx);
     bMMX = (edx & 0x00800000);
     bSSE = (edx & 0x02000000);
     bSSE2 = (edx & 0x04000000);
+
+    // AVX registers are only usable if the OS saves them on context
+    // switches (OSXSAVE set and XMM + YMM state enabled in XCR0)
+    bool bAVX = false;
+    if ((ecx & 0x18000000) == 0x18000000) { // OSXSAVE and AVX
+        int xcr0;
+        __asm__ __volatile__ (
+            ".byte 0x0f, 0x01, 0xd0\n\t" /*xgetbv*/
+            : "=a" (xcr0)
+            : "c" (0)
+            : "%edx"
+        );
+        bAVX = ((xcr0 & 0x6) == 0x6);
+    }
+    bFMA = bAVX && (ecx & 0x00001000);
+
+    bAVX2 = false;
+    if (bAVX && maxLeaf >= 7) {
+        cpuid(7, 0, &eax, &ebx, &ecx, &edx);
+        bAVX2 = (ebx & 0x00000020);
+    }
 }
 #else
 void Features::detect() {}
@@ -86,6 +119,8 @@ String Features::featuresAsString() {
     if (supportsMMX())  sFeatures  =  "MMX";
     if (supportsSSE())  sFeatures += " SSE";
     if (supportsSSE2()) sFeatures += " SSE2";
+    if (supportsAVX2()) sFeatures += " AVX2";
+    if (supportsFMA())  sFeatures += " FMA";
     #else
     sFeatures = "disabled at compile time";
     #endif // CONFIG_ASM && ARCH_X86
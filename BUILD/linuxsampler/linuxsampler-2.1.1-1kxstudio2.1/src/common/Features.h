@@ -39,12 +39,16 @@ class Features {
         inline static bool supportsMMX() { return bMMX; }
         inline static bool supportsSSE() { return bSSE; }
         inline static bool supportsSSE2() { return bSSE2; }
+        inline static bool supportsAVX2() { return bAVX2; }
+        inline static bool supportsFMA() { return bFMA; }
         #endif // CONFIG_ASM && ARCH_X86
     private:
         #if CONFIG_ASM && ARCH_X86
         static bool bMMX;
         static bool bSSE;
         static bool bSSE2;
+        static bool bAVX2;
+        static bool bFMA;
         #endif // CONFIG_ASM && ARCH_X86
 };
 
@@ -0,0 +1,144 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the Free Software           *
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,                *
+ *   MA  02110-1301  USA                                                   *
+ ***************************************************************************/
+
+#include "RTThreadPool.h"
+
+namespace LinuxSampler {
+
+    // The workers start as normal threads and switch to the scheduling
+    // of the audio thread the first time they are woken up by Run().
+    RTThreadPool::Worker::Worker(RTThreadPool* pPool) : Thread(true, false, 0, 0) {
+        this->pPool = pPool;
+        schedSerial = 0;
+    }
+
+    // Entry point for the worker threads.
+    int RTThreadPool::Worker::Main() {
+        while (true) {
+
+            #if CONFIG_PTHREAD_TESTCANCEL
+            TestCancel();
+            #endif
+
+            // sleep until Run() hands out new jobs
+            wakeup.WaitIf(false);
+            wakeup.PreLockedSet(false);
+            wakeup.Unlock();
+
+            #if !defined(WIN32)
+            const int serial = pPool->schedSerial.load(memory_order_acquire);
+            if (serial != schedSerial) {
+                schedSerial = serial;
+                struct sched_param param;
+                param.sched_priority = pPool->schedPriority;
+                if (pthread_setschedparam(pthread_self(), pPool->schedPolicy, &param)) {
+                    std::cerr << "RTThreadPool: WARNING, could not adopt scheduling of the audio thread!\n" << std::flush;
+                }
+            }
+            #endif
+
+            while (pPool->RunNextJob());
+        }
+        return 0;
+    }
+
+    RTThreadPool::RTThreadPool(int Threads)
+        : ppJobs(NULL), state(0), jobsDone(0), schedSerial(0), schedPolicy(0), schedPriority(0)
+    {
+        for (int i = 0; i < Threads; ++i) {
+            Worker* pWorker = new Worker(this);
+            workers.push_back(pWorker);
+            pWorker->StartThread();
+        }
+    }
+
+    RTThreadPool::~RTThreadPool() {
+        for (int i = 0; i < (int) workers.size(); ++i) {
+            workers[i]->StopThread();
+            delete workers[i];
+        }
+    }
+
+    void RTThreadPool::Run(Runnable** ppJobs, int Count) {
+        if (Count <= 0) return;
+        if (Count > MAX_JOBS) Count = MAX_JOBS;
+
+        AdoptScheduling();
+
+        // publish the jobs, the new generation makes claims of workers
+        // still looking at the previous run fail
+        this->ppJobs = ppJobs;
+        jobsDone.store(0, memory_order_relaxed);
+        const int gen = ((state.load(memory_order_relaxed) >> 24) + 1) & 0x7f;
+        state.store((gen << 24) | (Count << 12), memory_order_release);
+
+        // wake up as many workers as there are jobs left for them
+        const int n = (Count - 1 < (int) workers.size()) ? Count - 1 : (int) workers.size();
+        for (int i = 0; i < n; ++i) workers[i]->wakeup.Set(true);
+
+        // the calling thread works on the jobs as well
+        while (RunNextJob());
+
+        // wait for the jobs still being executed by workers
+        while (jobsDone.load(memory_order_acquire) < Count) {
+            #if defined(WIN32)
+            SwitchToThread();
+            #else
+            sched_yield();
+            #endif
+        }
+    }
+
+    /**
+     * Claims the next job of the current run and executes it.
+     *
+     * @returns false if there was no job left
+     */
+    bool RTThreadPool::RunNextJob() {
+        int s = state.load(memory_order_acquire);
+        while (true) {
+            const int next  = s & 0xfff;
+            const int count = (s >> 12) & 0xfff;
+            if (next >= count) return false;
+            if (state.compare_exchange_strong(s, s + 1)) {
+                ppJobs[next]->Run();
+                jobsDone.fetch_add(1);
+                return true;
+            }
+        }
+    }
+
+    /**
+     * Remembers the scheduling policy and priority of the calling thread,
+     * which will be applied by the workers the next time they wake up.
+     */
+    void RTThreadPool::AdoptScheduling() {
+        #if !defined(WIN32)
+        int policy;
+        struct sched_param param;
+        if (pthread_getschedparam(pthread_self(), &policy, &param)) return;
+        if (policy == schedPolicy && param.sched_priority == schedPriority) return;
+        schedPolicy   = policy;
+        schedPriority = param.sched_priority;
+        schedSerial.fetch_add(1);
+        #endif
+    }
+
+} // namespace LinuxSampler
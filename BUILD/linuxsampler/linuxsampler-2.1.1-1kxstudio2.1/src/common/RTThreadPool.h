@@ -0,0 +1,103 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the Free Software           *
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,                *
+ *   MA  02110-1301  USA                                                   *
+ ***************************************************************************/
+
+#ifndef __LS_RTTHREADPOOL_H__
+#define __LS_RTTHREADPOOL_H__
+
+#include <vector>
+
+#include "Condition.h"
+#include "global_private.h"
+#include "lsatomic.h"
+#include "Thread.h"
+
+namespace LinuxSampler {
+
+    /**
+     * Pool of real-time worker threads, used to run a set of independent
+     * jobs in parallel from within the audio thread.
+     *
+     * Run() hands out the given jobs to the worker threads, executes jobs
+     * itself as well and only returns after all jobs were finished. It
+     * neither allocates memory nor takes locks other than for waking up
+     * sleeping workers, so it can be called from the audio thread. The
+     * workers adopt the scheduling policy and priority of the thread that
+     * calls Run().
+     */
+    class RTThreadPool {
+        public:
+            /**
+             * Maximum amount of jobs that can be passed to a single
+             * Run() call.
+             */
+            enum { MAX_JOBS = 4095 };
+
+            /**
+             * Creates a pool with the given amount of worker threads. The
+             * threads are started immediately.
+             *
+             * @param Threads - amount of worker threads, the calling thread
+             *                  of Run() is not counted
+             */
+            RTThreadPool(int Threads);
+            virtual ~RTThreadPool();
+
+            /**
+             * Executes the given jobs in parallel and returns when all of
+             * them are finished. The order in which the jobs are executed
+             * is undefined. Jobs are not deleted.
+             *
+             * @param ppJobs - array of jobs to be executed
+             * @param Count  - amount of jobs in the array (at most MAX_JOBS)
+             */
+            void Run(Runnable** ppJobs, int Count);
+
+            /**
+             * Returns the amount of worker threads of this pool.
+             */
+            int GetThreadCount() const { return (int) workers.size(); }
+
+        private:
+            class Worker : public Thread {
+                public:
+                    Worker(RTThreadPool* pPool);
+                    virtual int Main() OVERRIDE;
+
+                    Condition wakeup; ///< set by Run() to wake up this worker
+                private:
+                    RTThreadPool* pPool;
+                    int           schedSerial; ///< scheduling parameters currently applied by this worker
+            };
+
+            bool RunNextJob();
+            void AdoptScheduling();
+
+            std::vector<Worker*> workers;
+            Runnable** volatile  ppJobs;
+            atomic<int>          state;       ///< generation (bits 24..30), job count (bits 12..23), next job (bits 0..11)
+            atomic<int>          jobsDone;
+            atomic<int>          schedSerial; ///< incremented whenever the caller's scheduling parameters changed
+            int                  schedPolicy;
+            int                  schedPriority;
+    };
+
+} // namespace LinuxSampler
+
+#endif // __LS_RTTHREADPOOL_H__
@@ -28,8 +28,10 @@
 #include <map>
 #include <vector>
 
+#include "global.h"
 #include "Exception.h"
 #include "Mutex.h"
+#include "Condition.h"
 
 namespace LinuxSampler {
 
@@ -94,6 +96,9 @@ class ResourceConsumer {
  *
  * Descendants of this base class have to implement the (protected)
  * Create() and Destroy() methods to create and destroy a resource.
+ * Borrow() calls Create() without holding the lock, so different resources
+ * may be created by different threads at the same time, while borrowers of
+ * a resource which is just being created wait for its creation.
  *
  * This class is thread safe (by default). Its methods should however not
  * be called in a realtime context due to this! Alternatively one can 
@@ -122,10 +127,22 @@ class ResourceManager {
             ConsumerSet consumers; ///< list of all consumers who currently use the resource
             void*       lifearg;   ///< optional pointer the descendant might use to store informations about a created resource
             void*       entryarg;  ///< optional pointer the descendant might use to store informations about an entry
+            bool        creating;  ///< true while Borrow() creates the resource without holding the lock
+
+            resource_entry_t() : resource(NULL), mode(ON_DEMAND), lifearg(NULL), entryarg(NULL), creating(false) {}
         };
         typedef std::map<T_key, resource_entry_t> ResourceMap;
         ResourceMap ResourceEntries;
         Mutex       ResourceEntriesMutex; // Mutex for protecting the ResourceEntries map
+        Condition   ResourceCreated;      // Toggled whenever Borrow() finished creating a resource
+
+        // Wakes up the borrowers waiting for a resource being created.
+        // Called with ResourceEntriesMutex locked.
+        void NotifyResourceCreated() {
+            ResourceCreated.Lock();
+            ResourceCreated.PreLockedSet(!ResourceCreated.GetUnsafe());
+            ResourceCreated.Unlock();
+        }
 
     public:
         /**
@@ -201,6 +218,17 @@ class ResourceManager {
             if (bLock) ResourceEntriesMutex.Lock();
             // search for an entry for this resource
             typename ResourceMap::iterator iterEntry = ResourceEntries.find(Key);
+            // if another thread is just creating it, wait for that thread
+            // instead of creating the same resource twice
+            while (bLock && iterEntry != ResourceEntries.end() && iterEntry->second.creating) {
+                // locked before unlocking the entries, so the creator
+                // cannot toggle the condition before we wait for it
+                ResourceCreated.Lock();
+                ResourceEntriesMutex.Unlock();
+                ResourceCreated.PreLockedWaitAndUnlockIf(ResourceCreated.GetUnsafe());
+                ResourceEntriesMutex.Lock();
+                iterEntry = ResourceEntries.find(Key);
+            }
             if (iterEntry == ResourceEntries.end()) { // entry doesn't exist yet
                 // already create an entry for the resource
                 resource_entry_t entry;
@@ -209,23 +237,36 @@ class ResourceManager {
                 entry.mode     = ON_DEMAND; // default mode
                 entry.lifearg  = NULL;
                 entry.entryarg = NULL;
+                entry.creating = bLock;
                 entry.consumers.insert(pConsumer);
                 ResourceEntries[Key] = entry;
+                // the (usually lengthy) creation is done without holding
+                // the lock, so other resources can be created meanwhile
+                if (bLock) ResourceEntriesMutex.Unlock();
                 try {
                     // actually create the resource
                     entry.resource = Create(Key, pConsumer, entry.lifearg);
                 } catch (...) {
                     // creating the resource failed, so remove the entry
+                    if (bLock) ResourceEntriesMutex.Lock();
                     ResourceEntries.erase(Key);
+                    if (bLock) NotifyResourceCreated();
                     if (bLock) ResourceEntriesMutex.Unlock();
                     // rethrow the same exception
                     throw;
                 }
-                // now update the entry with the created resource
-                ResourceEntries[Key] = entry;
-                OnBorrow(entry.resource, pConsumer, entry.lifearg);
+                if (bLock) ResourceEntriesMutex.Lock();
+                // now update the entry with the created resource (its mode
+                // might have been changed by another thread meanwhile)
+                resource_entry_t& created = ResourceEntries[Key];
+                created.resource = entry.resource;
+                created.lifearg  = entry.lifearg;
+                created.creating = false;
+                if (bLock) NotifyResourceCreated();
+                OnBorrow(created.resource, pConsumer, created.lifearg);
+                T_res* pResource = created.resource;
                 if (bLock) ResourceEntriesMutex.Unlock();
-                return entry.resource;
+                return pResource;
             } else { // entry already exists
                 resource_entry_t& entry = iterEntry->second;
                 if (!entry.resource) { // create resource if not created already
@@ -393,8 +434,9 @@ class ResourceManager {
                 pEntry->mode = Mode; // apply new mode
             }
 
-            // already create the resource if necessary
-            if (pEntry->mode == PERSISTENT && !pEntry->resource) {
+            // already create the resource if necessary (unless Borrow() is
+            // just creating it)
+            if (pEntry->mode == PERSISTENT && !pEntry->resource && !pEntry->creating) {
                 try {
                     // actually create the resource
                     pEntry->resource = Create(Key, NULL /*no consumer yet*/, pEntry->lifearg);
@@ -564,7 +606,10 @@ class ResourceManager {
          *                    process as value between 0.0 and 1.0
          */
         void DispatchResourceProgressEvent(T_key Key, float fProgress) {
-            // no Mutex here, since Create() is already protected
+            // Borrow() calls Create() without holding the lock, so we have
+            // to lock here, but rather skip this progress event than
+            // waiting for another thread (which might wait for us)
+            if (!ResourceEntriesMutex.Trylock()) return;
             typename ResourceMap::iterator iterEntry = ResourceEntries.find(Key);
             if (iterEntry != ResourceEntries.end()) {
                 resource_entry_t& entry = iterEntry->second;
@@ -575,6 +620,7 @@ class ResourceManager {
                     (*iterCons)->OnResourceProgress(fProgress);
                 }
             }
+            ResourceEntriesMutex.Unlock();
         }
 
         /**
@@ -98,6 +98,26 @@ int GLOBAL_MAX_VOICES = CONFIG_DEFAULT_MAX_VOICES;
 // this is the sampler global setting for maximum disk streams
 int GLOBAL_MAX_STREAMS = CONFIG_DEFAULT_MAX_STREAMS;
 
+// this is the sampler global setting for the amount of additional threads
+// used by sampler engines to render voices in parallel (0: no extra threads)
+int GLOBAL_RENDER_THREADS = 0;
+
+// this is the sampler global setting for the amount of additional threads
+// used by the disk threads to refill disk streams in parallel
+int GLOBAL_DISK_READER_THREADS = 2;
+
+// this is the sampler global setting for the max. RAM (in MB) used for
+// preloading the beginning of samples (0: no limit)
+int GLOBAL_PRELOAD_BUDGET = 0;
+
+// this is the sampler global setting whether cached sample data is kept in
+// shared memory, to be shared with other sampler processes on this host
+bool GLOBAL_SHARED_SAMPLES = false;
+
+// this is the sampler global setting for the amount of additional threads
+// used to load instruments in parallel (0: one instrument after another)
+int GLOBAL_LOADER_THREADS = 2;
+
 //TODO: (hopefully) just a temporary nasty hack for launching gigedit on the main thread on Mac (see comments in gigedit.cpp for details)
 #if defined(__APPLE__)
 bool g_mainThreadCallbackSupported = false;
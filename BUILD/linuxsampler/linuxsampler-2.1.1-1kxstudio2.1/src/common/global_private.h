@@ -130,6 +130,11 @@ class Runnable {
 extern double GLOBAL_VOLUME;
 extern int GLOBAL_MAX_VOICES;
 extern int GLOBAL_MAX_STREAMS;
+extern int GLOBAL_RENDER_THREADS;
+extern int GLOBAL_DISK_READER_THREADS;
+extern int GLOBAL_PRELOAD_BUDGET;
+extern bool GLOBAL_SHARED_SAMPLES;
+extern int GLOBAL_LOADER_THREADS;
 
 //TODO: (hopefully) just a temporary nasty hack for launching gigedit on the main thread on Mac (see comments in gigedit.cpp for details)
 #if defined(__APPLE__)
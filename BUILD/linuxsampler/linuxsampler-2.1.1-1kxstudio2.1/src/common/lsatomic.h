@@ -201,6 +201,19 @@ namespace LinuxSampler {
                 break;
             }
         }
+
+        // read-modify-write operations are always sequentially consistent
+        int fetch_add(int m, memory_order order = memory_order_seq_cst) volatile {
+            return __sync_fetch_and_add(&f, m);
+        }
+
+        bool compare_exchange_strong(int& expected, int desired,
+                                     memory_order order = memory_order_seq_cst) volatile {
+            const int old = __sync_val_compare_and_swap(&f, expected, desired);
+            if (old == expected) return true;
+            expected = old;
+            return false;
+        }
     private:
         int f;
         atomic(const atomic&); // not allowed
@@ -23,6 +23,7 @@
 #include "../common/File.h"
 #include "../common/Path.h"
 #include "../common/global_private.h"
+#include "../common/RTMath.h"
 
 #include <iostream>
 #include <sstream>
@@ -92,15 +93,25 @@ namespace LinuxSampler {
             "  );                                                        ";
         
         ExecSql(sql);
+
+        CreateIndexes();
+    }
+
+    void InstrumentsDb::CreateIndexes() {
+        // used when checking whether an instrument file was already added
+        // and when looking up instruments by file
+        ExecSql("CREATE INDEX IF NOT EXISTS instr_file_idx ON instruments (instr_file,instr_nr)");
     }
 
     InstrumentsDb::InstrumentsDb() {
         db = NULL;
         InTransaction = false;
+        NestedTransactions = 0;
     }
 
     InstrumentsDb::~InstrumentsDb() {
         InstrumentsDbThread.StopThread();
+        FinalizeStatements();
         if (db != NULL) sqlite3_close(db);
     }
     
@@ -214,6 +225,11 @@ namespace LinuxSampler {
             if(i != -2) ExecSql("UPDATE instr_dirs SET parent_dir_id=-2 WHERE dir_id=0");
         } catch(Exception e) { }
         ////////////////////////////////////////
+
+        // databases created by older versions lack the indexes
+        try {
+            CreateIndexes();
+        } catch(Exception e) { }
         
         return db;
     }
@@ -222,10 +238,7 @@ namespace LinuxSampler {
         dmsg(2,("InstrumentsDb: GetDirectoryCount(DirId=%d)\n", DirId));
         if(DirId == -1) return -1;
 
-        std::stringstream sql;
-        sql << "SELECT COUNT(*) FROM instr_dirs WHERE parent_dir_id=" <<  DirId;
-        
-        int count = ExecSqlInt(sql.str());
+        int count = ExecSqlInt("SELECT COUNT(*) FROM instr_dirs WHERE parent_dir_id=?", ToString(DirId));
 
         return count;
     }
@@ -327,11 +340,10 @@ namespace LinuxSampler {
 
     int InstrumentsDb::GetDirectoryId(int ParentDirId, String DirName) {
         dmsg(2,("InstrumentsDb: GetDirectoryId(ParentDirId=%d, DirName=%s)\n", ParentDirId, DirName.c_str()));
-        DirName = toDbName(DirName);
-        std::stringstream sql;
-        sql << "SELECT dir_id FROM instr_dirs WHERE parent_dir_id=";
-        sql << ParentDirId << " AND dir_name=?";
-        return ExecSqlInt(sql.str(), DirName);
+        std::vector<String> params;
+        params.push_back(ToString(ParentDirId));
+        params.push_back(toDbName(DirName));
+        return ExecSqlInt("SELECT dir_id FROM instr_dirs WHERE parent_dir_id=? AND dir_name=?", params);
     }
 
     int InstrumentsDb::GetDirectoryId(int InstrId) {
@@ -781,6 +793,7 @@ namespace LinuxSampler {
         dmsg(2,("InstrumentsDb: AddInstrumentsNonrecursive(DbDir=%s,FsDir=%s,insDir=%d)\n", DbDir.c_str(), FsDir.c_str(), insDir));
         if (DbDir.empty() || FsDir.empty()) return;
         
+        ScanItemList items;
         {
             LockGuard lock(DbInstrumentsMutex);
 
@@ -805,34 +818,122 @@ namespace LinuxSampler {
             try {
                 FileListPtr fileList = File::GetFiles(FsDir);
                 for (int i = 0; i < fileList->size(); i++) {
-                    String dir = insDir ? PrepareSubdirectory(DbDir, fileList->at(i)) : DbDir;
-					AddInstrumentsFromFile(dir, FsDir + fileList->at(i), -1, pProgress);
+                    if (!InstrumentFileInfo::isSupportedFile(fileList->at(i))) continue;
+                    items.push_back(new ScanItem(DbDir, FsDir + fileList->at(i)));
                 }
             } catch(Exception e) {
                 e.PrintMessage();
             }
         }
+
+        try {
+            AddInstrumentFiles(items, insDir, pProgress);
+        } catch (Exception e) {
+            for (int i = 0; i < items.size(); i++) delete items[i];
+            throw e;
+        }
+        for (int i = 0; i < items.size(); i++) delete items[i];
     }
 
     void InstrumentsDb::AddInstrumentsRecursive(String DbDir, String FsDir, bool Flat, bool insDir, ScanProgress* pProgress) {
         dmsg(2,("InstrumentsDb: AddInstrumentsRecursive(DbDir=%s,FsDir=%s,Flat=%d,insDir=%d)\n", DbDir.c_str(), FsDir.c_str(), Flat, insDir));
-        if (pProgress != NULL) {
-            InstrumentFileCounter c;
-            pProgress->SetTotalFileCount(c.Count(FsDir));
-        }
-
         DirectoryScanner d;
         d.Scan(DbDir, FsDir, Flat, insDir, pProgress);
     }
 
+    void InstrumentsDb::AddInstrumentFiles(ScanItemList& Items, bool insDir, ScanProgress* pProgress) {
+        dmsg(2,("InstrumentsDb: AddInstrumentFiles(Items=%d,insDir=%d)\n", (int)Items.size(), insDir));
+        if (Items.empty()) return;
+
+        // Max. amount of instruments added in one transaction. Also when
+        // the writer has to wait for a file to be parsed, the transaction
+        // is committed, so that other clients can use the database meanwhile.
+        const int maxBatchSize = 1000;
+
+        RTMath::usecs_t start = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+        int instrCount = 0;
+        int batchSize = 0;
+        std::set<String> changedDirs;
+        String lastDir;
+        int lastDirId = -1;
+
+        InstrumentFileScanner scanner(Items);
+
+        BeginTransaction();
+        try {
+            for (int i = 0; i < Items.size(); i++) {
+                if (batchSize >= maxBatchSize || !scanner.IsParsed(i)) {
+                    // commit, so that the database can be used by others
+                    // while waiting for the file to be parsed
+                    EndTransaction();
+                    FireInstrumentCountChanged(changedDirs);
+                    batchSize = 0;
+                    scanner.Get(i);
+                    BeginTransaction();
+                }
+                ScanItem* pItem = scanner.Get(i);
+
+                if (pProgress != NULL) {
+                    pProgress->CurrentFile = pItem->FilePath;
+                }
+
+                String dir = pItem->DbDir;
+                if (dir != lastDir) {
+                    EnsureDirectoryExist(dir);
+                    lastDir = dir;
+                    lastDirId = GetDirectoryId(dir);
+                    if (lastDirId == -1) throw Exception("Invalid DB directory: " + toEscapedPath(dir));
+                }
+                int dirId = lastDirId;
+
+                if (!pItem->Instruments.empty() && insDir) {
+                    dir = PrepareSubdirectory(dir, pItem->FilePath);
+                    dirId = GetDirectoryId(dir);
+                }
+
+                for (int j = 0; j < pItem->Instruments.size(); j++) {
+                    int instrIndex = (pItem->Index == -1) ? j : pItem->Index;
+                    if (AddInstrumentPriv(
+                            dirId, pItem->FilePath, instrIndex,
+                            pItem->FormatName, pItem->FormatVersion,
+                            pItem->FileSize, pItem->Instruments[j]))
+                    {
+                        changedDirs.insert(dir);
+                        instrCount++;
+                        batchSize++;
+                    }
+                }
+
+                if (!pItem->Error.empty()) std::cerr << pItem->Error << std::endl;
+                scanner.Release(i);
+
+                if (pProgress != NULL) {
+                    pProgress->SetScannedFileCount(pProgress->GetScannedFileCount() + 1);
+                }
+            }
+        } catch (Exception e) {
+            EndTransaction();
+            FireInstrumentCountChanged(changedDirs);
+            throw e;
+        }
+        EndTransaction();
+        FireInstrumentCountChanged(changedDirs);
+
+        double secs = double(RTMath::unsafeMicroSeconds(RTMath::real_clock) - start) / 1000000.0;
+        dmsg(2,("InstrumentsDb: Added %d instruments from %d files in %.3f s\n", instrCount, (int)Items.size(), secs));
+    }
+
+    void InstrumentsDb::EnsureDirectoryExist(String Dir) {
+        if (Dir.empty() || DirectoryExist(Dir)) return;
+        EnsureDirectoryExist(GetParentDirectory(Dir));
+        AddDirectory(Dir);
+    }
+
     int InstrumentsDb::GetInstrumentCount(int DirId) {
         dmsg(2,("InstrumentsDb: GetInstrumentCount(DirId=%d)\n", DirId));
         if(DirId == -1) return -1;
         
-        std::stringstream sql;
-        sql << "SELECT COUNT(*) FROM instruments WHERE dir_id=" <<  DirId;
-        
-        return ExecSqlInt(sql.str());
+        return ExecSqlInt("SELECT COUNT(*) FROM instruments WHERE dir_id=?", ToString(DirId));
     }
 
     int InstrumentsDb::GetInstrumentCount(String Dir, bool Recursive) {
@@ -911,10 +1012,10 @@ namespace LinuxSampler {
         dmsg(2,("InstrumentsDb: GetInstrumentId(DirId=%d,InstrName=%s)\n", DirId, InstrName.c_str()));
         if (DirId == -1 || InstrName.empty()) return -1;
         
-        std::stringstream sql;
-        sql << "SELECT instr_id FROM instruments WHERE dir_id=";
-        sql << DirId << " AND instr_name=?";
-        return ExecSqlInt(sql.str(), toDbName(InstrName));
+        std::vector<String> params;
+        params.push_back(ToString(DirId));
+        params.push_back(toDbName(InstrName));
+        return ExecSqlInt("SELECT instr_id FROM instruments WHERE dir_id=? AND instr_name=?", params);
     }
 
     String InstrumentsDb::GetInstrumentName(int InstrId) {
@@ -1234,36 +1335,13 @@ namespace LinuxSampler {
 
         bool unlocked = false;
         InstrumentFileInfo* fileInfo = NULL;
-        sqlite3_stmt* pStmt = NULL;
         try {
             fileInfo = InstrumentFileInfo::getFileInfoFor(FilePath);
             if (!fileInfo) return;
 
-            std::stringstream sql;
-            sql << "INSERT INTO instruments (dir_id,instr_name,instr_file,";
-            sql << "instr_nr,format_family,format_version,instr_size,";
-            sql << "description,is_drum,product,artists,keywords) VALUES (";
-            sql << dirId << ",?,?,?,?,?," << file.GetSize() << ",?,?,?,?,?)";
-
-            // instr_name 1
-            // instr_file 2
-            // instr_nr 3
-            // format_family 4
-            // format_version 5
-            // description 6
-            // is_drum 7
-            // product 8
-            // artists 9
-            // keywords 10
-
-            int res = sqlite3_prepare(GetDb(), sql.str().c_str(), -1, &pStmt, NULL);
-            if (res != SQLITE_OK) {
-                throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
-            }
-
-            BindTextParam(pStmt, 2, toEscapedFsPath(FilePath));
-            BindTextParam(pStmt, 4, fileInfo->formatName());
-            BindTextParam(pStmt, 5, fileInfo->formatVersion());
+            String formatName = fileInfo->formatName();
+            String formatVersion = fileInfo->formatVersion();
+            unsigned long size = file.GetSize();
 
             int instrIndex = (Index == -1) ? 0 : Index;
 
@@ -1279,58 +1357,74 @@ namespace LinuxSampler {
             optional<InstrumentInfo> info = fileInfo->getInstrumentInfo(0, pProgress);
             if (!InTransaction) DbInstrumentsMutex.Lock();
             while (info) {
-                String instrumentName = info->instrumentName;
-                if (instrumentName.empty())
-                    instrumentName = Path::getBaseName(FilePath);
-                instrumentName = GetUniqueName(dirId, instrumentName);
-
-                BindTextParam(pStmt, 8, info->product);
-                BindTextParam(pStmt, 9, info->artists);
-                BindTextParam(pStmt, 10, info->keywords);
-
-                std::stringstream sql2;
-                sql2 << "SELECT COUNT(*) FROM instruments WHERE instr_file=? AND ";
-                sql2 << "instr_nr=" << instrIndex;
-                String s = toEscapedFsPath(FilePath);
-                if (ExecSqlInt(sql2.str(), s) > 0) goto next;
-
-                BindTextParam(pStmt, 1, instrumentName);
-                BindIntParam(pStmt, 3, instrIndex);
-
-                BindTextParam(pStmt, 6, info->comments);
-                BindIntParam(pStmt, 7, info->isDrum);
-
-                res = sqlite3_step(pStmt);
-                if (res != SQLITE_DONE) {
-                    throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
+                if (AddInstrumentPriv(dirId, FilePath, instrIndex, formatName, formatVersion, size, *info)) {
+                    FireInstrumentCountChanged(DbDir);
                 }
-                res = sqlite3_reset(pStmt);
-                FireInstrumentCountChanged(DbDir);
 
-            next:
                 if (Index != -1) break;
 
                 instrIndex++;
                 info = fileInfo->getInstrumentInfo(instrIndex, pProgress);
             }
         } catch (Exception e) {
-            if (pStmt) sqlite3_finalize(pStmt);
             if (fileInfo) delete fileInfo;
             if (unlocked) DbInstrumentsMutex.Lock();
             std::stringstream ss;
             ss << "Failed to scan `" << FilePath << "`: " << e.Message();
             throw Exception(ss.str());
         } catch (...) {
-            if (pStmt) sqlite3_finalize(pStmt);
             if (fileInfo) delete fileInfo;
             if (unlocked) DbInstrumentsMutex.Lock();
             throw Exception("Failed to scan `" + FilePath + "`");
         }
-        if (pStmt) sqlite3_finalize(pStmt);
         if (fileInfo) delete fileInfo;
         if (unlocked) DbInstrumentsMutex.Lock();
     }
 
+    bool InstrumentsDb::AddInstrumentPriv(int DirId, String FilePath, int InstrIndex, String FormatName, String FormatVersion, unsigned long FileSize, const InstrumentInfo& Info) {
+        LockGuard lock(DbInstrumentsMutex);
+        String file = toEscapedFsPath(FilePath);
+
+        std::vector<String> params;
+        params.push_back(file);
+        params.push_back(ToString(InstrIndex));
+        if (ExecSqlInt("SELECT COUNT(*) FROM instruments WHERE instr_file=? AND instr_nr=?", params) > 0) {
+            return false;
+        }
+
+        String instrumentName = Info.instrumentName;
+        if (instrumentName.empty())
+            instrumentName = Path::getBaseName(FilePath);
+        instrumentName = GetUniqueName(DirId, instrumentName);
+
+        sqlite3_stmt* pStmt = GetStatement(
+            "INSERT INTO instruments (dir_id,instr_name,instr_file,"
+            "instr_nr,format_family,format_version,instr_size,"
+            "description,is_drum,product,artists,keywords) "
+            "VALUES (?,?,?,?,?,?,?,?,?,?,?,?)"
+        );
+
+        BindIntParam(pStmt, 1, DirId);
+        BindTextParam(pStmt, 2, instrumentName);
+        BindTextParam(pStmt, 3, file);
+        BindIntParam(pStmt, 4, InstrIndex);
+        BindTextParam(pStmt, 5, FormatName);
+        BindTextParam(pStmt, 6, FormatVersion);
+        sqlite3_bind_int64(pStmt, 7, FileSize);
+        BindTextParam(pStmt, 8, Info.comments);
+        BindIntParam(pStmt, 9, Info.isDrum);
+        BindTextParam(pStmt, 10, Info.product);
+        BindTextParam(pStmt, 11, Info.artists);
+        BindTextParam(pStmt, 12, Info.keywords);
+
+        int res = sqlite3_step(pStmt);
+        sqlite3_reset(pStmt);
+        if (res != SQLITE_DONE) {
+            throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
+        }
+        return true;
+    }
+
     void InstrumentsDb::DirectoryTreeWalk(String AbstractPath, DirectoryHandler* pHandler) {
         int DirId = GetDirectoryId(AbstractPath);
         if(DirId == -1) throw Exception("Unknown DB directory: " + toEscapedPath(AbstractPath));
@@ -1340,16 +1434,38 @@ namespace LinuxSampler {
     void InstrumentsDb::DirectoryTreeWalk(DirectoryHandler* pHandler, String AbstractPath, int DirId, int Level) {
         if(Level == 1000) throw Exception("Possible infinite loop detected");
         pHandler->ProcessDirectory(AbstractPath, DirId);
-        
+
+        // fetch IDs and names of the subdirectories with a single query
+        std::vector<int> ids;
+        std::vector<String> names;
+        {
+            LockGuard lock(DbInstrumentsMutex);
+            sqlite3_stmt* pStmt = GetStatement(
+                "SELECT dir_id,dir_name FROM instr_dirs WHERE parent_dir_id=? AND dir_id!=0"
+            );
+            BindIntParam(pStmt, 1, DirId);
+
+            int res = sqlite3_step(pStmt);
+            while(res == SQLITE_ROW) {
+                ids.push_back(sqlite3_column_int(pStmt, 0));
+                names.push_back(toAbstractName(ToString(sqlite3_column_text(pStmt, 1))));
+                res = sqlite3_step(pStmt);
+            }
+
+            sqlite3_reset(pStmt);
+            if (res != SQLITE_DONE) {
+                throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
+            }
+        }
+
         String s;
-        StringListPtr pDirs = GetDirectories(DirId);
-        for(int i = 0; i < pDirs->size(); i++) {
+        for(int i = 0; i < ids.size(); i++) {
             if (AbstractPath.length() == 1 && AbstractPath.at(0) == '/') {
-                s = "/" + pDirs->at(i);
+                s = "/" + names[i];
             } else {
-                s = AbstractPath + "/" + pDirs->at(i);
+                s = AbstractPath + "/" + names[i];
             }
-            DirectoryTreeWalk(pHandler, s, GetDirectoryId(DirId, pDirs->at(i)), Level + 1);
+            DirectoryTreeWalk(pHandler, s, ids[i], Level + 1);
         }
     }
 
@@ -1436,7 +1552,11 @@ namespace LinuxSampler {
     void InstrumentsDb::BeginTransaction() {
         dmsg(2,("InstrumentsDb: BeginTransaction(InTransaction=%d)\n", InTransaction));
         DbInstrumentsMutex.Lock();
-        if (InTransaction) return;
+        if (InTransaction) {
+            // only the outermost transaction is committed
+            NestedTransactions++;
+            return;
+        }
         
         if(db == NULL) return;
         sqlite3_stmt *pStmt = NULL;
@@ -1464,6 +1584,11 @@ namespace LinuxSampler {
             DbInstrumentsMutex.Unlock();
             return;
         }
+        if (NestedTransactions > 0) {
+            NestedTransactions--;
+            DbInstrumentsMutex.Unlock();
+            return;
+        }
         InTransaction = false;
         
         if (db == NULL) {
@@ -1506,93 +1631,85 @@ namespace LinuxSampler {
 
     void InstrumentsDb::ExecSql(String Sql, std::vector<String>& Params) {
         dmsg(2,("InstrumentsDb: ExecSql(Sql=%s,Params)\n", Sql.c_str()));
-        sqlite3_stmt *pStmt = NULL;
-        
-        int res = sqlite3_prepare(GetDb(), Sql.c_str(), -1, &pStmt, NULL);
-        if (res != SQLITE_OK) {
-            sqlite3_finalize(pStmt);
-            throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
-        }
+        LockGuard lock(DbInstrumentsMutex);
+        sqlite3_stmt *pStmt = GetStatement(Sql);
 
         for(int i = 0; i < Params.size(); i++) {
             BindTextParam(pStmt, i + 1, Params[i]);
         }
 
-        res = sqlite3_step(pStmt);
+        int res = sqlite3_step(pStmt);
         if (res != SQLITE_DONE) {
-            sqlite3_finalize(pStmt);
+            sqlite3_reset(pStmt);
             throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
         }
 
-        sqlite3_finalize(pStmt);
+        sqlite3_reset(pStmt);
     }
 
     int InstrumentsDb::ExecSqlInt(String Sql) {
         dmsg(2,("InstrumentsDb: ExecSqlInt(Sql=%s)\n", Sql.c_str()));
-        sqlite3_stmt *pStmt = NULL;
-
-        int res = sqlite3_prepare(GetDb(), Sql.c_str(), -1, &pStmt, NULL);
-        if (res != SQLITE_OK) {
-            throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
-        }
+        LockGuard lock(DbInstrumentsMutex);
+        sqlite3_stmt *pStmt = GetStatement(Sql);
         
         int i = -1;
-        res = sqlite3_step(pStmt);
+        int res = sqlite3_step(pStmt);
         if(res == SQLITE_ROW) {
             i = sqlite3_column_int(pStmt, 0);
         } else if (res != SQLITE_DONE) {
-            sqlite3_finalize(pStmt);
+            sqlite3_reset(pStmt);
             throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
         }
 
-        sqlite3_finalize(pStmt);
+        sqlite3_reset(pStmt);
         
         return i;
     }
 
     int InstrumentsDb::ExecSqlInt(String Sql, String Param) {
         dmsg(2,("InstrumentsDb: ExecSqlInt(Sql=%s,Param=%s)\n", Sql.c_str(), Param.c_str()));
-        sqlite3_stmt *pStmt = NULL;
+        std::vector<String> Params;
+        Params.push_back(Param);
+        return ExecSqlInt(Sql, Params);
+    }
 
-        int res = sqlite3_prepare(GetDb(), Sql.c_str(), -1, &pStmt, NULL);
-        if (res != SQLITE_OK) {
-            throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
-        }
+    int InstrumentsDb::ExecSqlInt(String Sql, std::vector<String>& Params) {
+        dmsg(2,("InstrumentsDb: ExecSqlInt(Sql=%s,Params)\n", Sql.c_str()));
+        LockGuard lock(DbInstrumentsMutex);
+        sqlite3_stmt *pStmt = GetStatement(Sql);
 
-        BindTextParam(pStmt, 1, Param);
+        for(int i = 0; i < Params.size(); i++) {
+            BindTextParam(pStmt, i + 1, Params[i]);
+        }
 
         int i = -1;
-        res = sqlite3_step(pStmt);
+        int res = sqlite3_step(pStmt);
         if(res == SQLITE_ROW) {
             i = sqlite3_column_int(pStmt, 0);
         } else if (res != SQLITE_DONE) {
-            sqlite3_finalize(pStmt);
+            sqlite3_reset(pStmt);
             throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
         }
 
-        sqlite3_finalize(pStmt);
+        sqlite3_reset(pStmt);
         return i;
     }
 
     String InstrumentsDb::ExecSqlString(String Sql) {
         dmsg(2,("InstrumentsDb: ExecSqlString(Sql=%s)\n", Sql.c_str()));
-        sqlite3_stmt *pStmt = NULL;
-
-        int res = sqlite3_prepare(GetDb(), Sql.c_str(), -1, &pStmt, NULL);
-        if (res != SQLITE_OK) {
-            throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
-        }
+        LockGuard lock(DbInstrumentsMutex);
+        sqlite3_stmt *pStmt = GetStatement(Sql);
         
         String s;
-        res = sqlite3_step(pStmt);
+        int res = sqlite3_step(pStmt);
         if(res == SQLITE_ROW) {
             s = ToString(sqlite3_column_text(pStmt, 0));
         } else if (res != SQLITE_DONE) {
-            sqlite3_finalize(pStmt);
+            sqlite3_reset(pStmt);
             throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
         }
 
-        sqlite3_finalize(pStmt);
+        sqlite3_reset(pStmt);
         
         return s;
     }
@@ -1614,29 +1731,25 @@ namespace LinuxSampler {
         dmsg(2,("InstrumentsDb: ExecSqlIntList(Sql=%s)\n", Sql.c_str()));
         IntListPtr intList(new std::vector<int>);
         
-        sqlite3_stmt *pStmt = NULL;
-
-        int res = sqlite3_prepare(GetDb(), Sql.c_str(), -1, &pStmt, NULL);
-        if (res != SQLITE_OK) {
-            throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
-        }
+        LockGuard lock(DbInstrumentsMutex);
+        sqlite3_stmt *pStmt = GetStatement(Sql);
         
         for(int i = 0; i < Params.size(); i++) {
             BindTextParam(pStmt, i + 1, Params[i]);
         }
         
-        res = sqlite3_step(pStmt);
+        int res = sqlite3_step(pStmt);
         while(res == SQLITE_ROW) {
             intList->push_back(sqlite3_column_int(pStmt, 0));
             res = sqlite3_step(pStmt);
         }
         
         if (res != SQLITE_DONE) {
-            sqlite3_finalize(pStmt);
+            sqlite3_reset(pStmt);
             throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
         }
 
-        sqlite3_finalize(pStmt);
+        sqlite3_reset(pStmt);
         
         return intList;
     }
@@ -1645,34 +1758,61 @@ namespace LinuxSampler {
         dmsg(2,("InstrumentsDb: ExecSqlStringList(Sql=%s)\n", Sql.c_str()));
         StringListPtr stringList(new std::vector<String>);
         
-        sqlite3_stmt *pStmt = NULL;
-
-        int res = sqlite3_prepare(GetDb(), Sql.c_str(), -1, &pStmt, NULL);
-        if (res != SQLITE_OK) {
-            throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
-        }
+        LockGuard lock(DbInstrumentsMutex);
+        sqlite3_stmt *pStmt = GetStatement(Sql);
         
-        res = sqlite3_step(pStmt);
+        int res = sqlite3_step(pStmt);
         while(res == SQLITE_ROW) {
             stringList->push_back(ToString(sqlite3_column_text(pStmt, 0)));
             res = sqlite3_step(pStmt);
         }
         
         if (res != SQLITE_DONE) {
-            sqlite3_finalize(pStmt);
+            sqlite3_reset(pStmt);
             throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
         }
 
-        sqlite3_finalize(pStmt);
+        sqlite3_reset(pStmt);
         
         return stringList;
     }
 
+    sqlite3_stmt* InstrumentsDb::GetStatement(String Sql) {
+        sqlite3* pDb = GetDb();
+
+        std::map<String, sqlite3_stmt*>::iterator it = Statements.find(Sql);
+        if (it != Statements.end()) {
+            sqlite3_reset(it->second);
+            sqlite3_clear_bindings(it->second);
+            return it->second;
+        }
+
+        // Statements with literal values are cached as well, so make sure
+        // that those don't accumulate. No cached statement is in use when
+        // a new one is requested.
+        if (Statements.size() >= 256) FinalizeStatements();
+
+        sqlite3_stmt* pStmt = NULL;
+        int res = sqlite3_prepare_v2(pDb, Sql.c_str(), -1, &pStmt, NULL);
+        if (res != SQLITE_OK) {
+            sqlite3_finalize(pStmt);
+            throw Exception("DB error: " + ToString(sqlite3_errmsg(pDb)));
+        }
+
+        Statements[Sql] = pStmt;
+        return pStmt;
+    }
+
+    void InstrumentsDb::FinalizeStatements() {
+        std::map<String, sqlite3_stmt*>::iterator it = Statements.begin();
+        for (; it != Statements.end(); ++it) sqlite3_finalize(it->second);
+        Statements.clear();
+    }
+
     void InstrumentsDb::BindTextParam(sqlite3_stmt* pStmt, int Index, String Text) {
         if (pStmt == NULL) return;
         int res = sqlite3_bind_text(pStmt, Index, Text.c_str(), -1, SQLITE_TRANSIENT);
         if (res != SQLITE_OK) {
-            sqlite3_finalize(pStmt);
             throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
         }
     }
@@ -1681,7 +1821,6 @@ namespace LinuxSampler {
         if (pStmt == NULL) return;
         int res = sqlite3_bind_int(pStmt, Index, Param);
         if (res != SQLITE_OK) {
-            sqlite3_finalize(pStmt);
             throw Exception("DB error: " + ToString(sqlite3_errmsg(db)));
         }
     }
@@ -1745,6 +1884,7 @@ namespace LinuxSampler {
             LockGuard lock(DbInstrumentsMutex);
 
             if (db != NULL) {
+                FinalizeStatements();
                 sqlite3_close(db);
                 db = NULL;
             }
@@ -1776,7 +1916,7 @@ namespace LinuxSampler {
         for(int i = 2; i < 1001; i++) {
             ss.str("");
             ss << Name << '[' << i << ']';
-            if (GetInstrumentId(DirId, ss.str()) == -1 && GetInstrumentId(DirId, ss.str()) == -1) {
+            if (GetInstrumentId(DirId, ss.str()) == -1 && GetDirectoryId(DirId, ss.str()) == -1) {
                 return ss.str();
             }
         }
@@ -1893,6 +2033,12 @@ namespace LinuxSampler {
         }
     }
 
+    void InstrumentsDb::FireInstrumentCountChanged(std::set<String>& Dirs) {
+        std::set<String>::iterator it = Dirs.begin();
+        for (; it != Dirs.end(); ++it) FireInstrumentCountChanged(*it);
+        Dirs.clear();
+    }
+
     void InstrumentsDb::FireInstrumentCountChanged(String Dir) {
         for (int i = 0; i < llInstrumentsDbListeners.GetListenerCount(); i++) {
             llInstrumentsDbListeners.GetListener(i)->InstrumentCountChanged(Dir);
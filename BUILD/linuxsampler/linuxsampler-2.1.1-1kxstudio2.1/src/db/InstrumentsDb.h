@@ -23,6 +23,8 @@
 #ifndef __LS_INSTRUMENTSDB_H__
 #define __LS_INSTRUMENTSDB_H__
 
+#include <map>
+#include <set>
 #include <sqlite3.h>
 #if AC_APPLE_UNIVERSAL_BUILD
 # include <libgig/gig.h>
@@ -492,7 +494,9 @@ namespace LinuxSampler {
             Mutex DbInstrumentsMutex;
             ListenerList<InstrumentsDb::Listener*> llInstrumentsDbListeners;
             bool InTransaction;
+            int NestedTransactions;
             WorkerThread InstrumentsDbThread;
+            std::map<String, sqlite3_stmt*> Statements;
             
             InstrumentsDb();
             ~InstrumentsDb();
@@ -763,6 +767,38 @@ namespace LinuxSampler {
              */
             void AddInstrumentsFromFilePriv(String DbDir, const int dirId, String FilePath, File file, int Index = -1, ScanProgress* pProgress = NULL);
 
+            /**
+             * Adds the instruments of the specified instrument files to
+             * the instruments database. The files are parsed on a pool of
+             * threads, while the calling thread writes the instruments to
+             * the database in the order of the list, in transactions of up
+             * to 1000 instruments each. Missing database directories are
+             * created.
+             * @param Items The files to add and the database directories
+             * in which their instruments should be added.
+             * @param insDir If true, a separate directory will be created
+             * for each file.
+             * @param pProgress The progress used to monitor the scan process.
+             * Specify NULL if you don't want to monitor the scanning process.
+             * @throws Exception if a database error occurred.
+             */
+            void AddInstrumentFiles(ScanItemList& Items, bool insDir = false, ScanProgress* pProgress = NULL);
+
+            /**
+             * Adds a single instrument of the specified file to the
+             * specified instruments database directory, unless that
+             * instrument is already in the database.
+             * @returns true if the instrument has been added.
+             * @throws Exception if a database error occurred.
+             */
+            bool AddInstrumentPriv(int DirId, String FilePath, int InstrIndex, String FormatName, String FormatVersion, unsigned long FileSize, const InstrumentInfo& Info);
+
+            /**
+             * Creates the specified instruments database directory and
+             * all its missing parent directories.
+             */
+            void EnsureDirectoryExist(String Dir);
+
             void DirectoryTreeWalk(String AbstractPath, DirectoryHandler* pHandler);
 
             void DirectoryTreeWalk(DirectoryHandler* pHandler, String AbstractPath, int DirId, int Level);
@@ -798,6 +834,11 @@ namespace LinuxSampler {
              */
             int ExecSqlInt(String Sql, String Param);
 
+            /**
+             * Used to execute SQL commands which returns integer.
+             */
+            int ExecSqlInt(String Sql, std::vector<String>& Params);
+
             /**
              * Used to execute SQL commands which returns string.
              */
@@ -823,6 +864,28 @@ namespace LinuxSampler {
              */
             StringListPtr ExecSqlStringList(String Sql);
             
+            /**
+             * Returns a prepared statement for the specified SQL command,
+             * which is reset and has no parameters bound. Statements are
+             * prepared only once and kept until the database is closed.
+             * The caller must hold the DbInstrumentsMutex until it is done
+             * with the statement.
+             * @throws Exception if the statement could not be prepared.
+             */
+            sqlite3_stmt* GetStatement(String Sql);
+
+            /**
+             * Finalizes all cached statements. Must be called before
+             * closing the database.
+             */
+            void FinalizeStatements();
+
+            /**
+             * Creates the indexes used by instrument lookups and searches,
+             * if they don't exist yet.
+             */
+            void CreateIndexes();
+
             /**
              * Binds the specified text parameter.
              */
@@ -882,6 +945,7 @@ namespace LinuxSampler {
             void FireDirectoryInfoChanged(String Dir);
             void FireDirectoryNameChanged(String Dir, String NewName);
             void FireInstrumentCountChanged(String Dir);
+            void FireInstrumentCountChanged(std::set<String>& Dirs);
             void FireInstrumentInfoChanged(String Instr);
             void FireInstrumentNameChanged(String Instr, String NewName);
             void FireJobStatusChanged(int JobId);
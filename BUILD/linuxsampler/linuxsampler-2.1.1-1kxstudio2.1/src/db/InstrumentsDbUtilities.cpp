@@ -24,7 +24,11 @@
 #include "../common/global_private.h"
 
 #include <algorithm>
+#include <sstream>
 #include <errno.h>
+#ifndef WIN32
+#include <unistd.h>
+#endif
 
 #include "../common/Exception.h"
 #include "InstrumentsDb.h"
@@ -728,6 +732,15 @@ namespace LinuxSampler {
     }
 
 
+    DirectoryScanner::~DirectoryScanner() {
+        ClearItems();
+    }
+
+    void DirectoryScanner::ClearItems() {
+        for (int i = 0; i < Items.size(); i++) delete Items[i];
+        Items.clear();
+    }
+
     void DirectoryScanner::Scan(String DbDir, String FsDir, bool Flat, bool insDir, ScanProgress* pProgress) {
         dmsg(2,("DirectoryScanner: Scan(DbDir=%s,FsDir=%s,Flat=%d,insDir=%d)\n", DbDir.c_str(), FsDir.c_str(), Flat, insDir));
         if (DbDir.empty() || FsDir.empty()) throw Exception("Directory expected");
@@ -744,7 +757,20 @@ namespace LinuxSampler {
         this->Flat = Flat;
         this->pProgress = pProgress;
         
+        // first collect all instrument files, so that they can be parsed
+        // in parallel and the total file count is known without walking
+        // the directory tree a second time
+        ClearItems();
         File::WalkDirectoryTree(FsDir, this);
+        if (pProgress != NULL) pProgress->SetTotalFileCount(Items.size());
+
+        try {
+            InstrumentsDb::GetInstrumentsDb()->AddInstrumentFiles(Items, insDir, pProgress);
+        } catch (Exception e) {
+            ClearItems();
+            throw e;
+        }
+        ClearItems();
     }
 
     void DirectoryScanner::DirectoryEntry(std::string Path) {
@@ -761,19 +787,23 @@ namespace LinuxSampler {
                 dir += subdir;
             }
         }
-        
-        InstrumentsDb* db = InstrumentsDb::GetInstrumentsDb();
 
-        if (HasInstrumentFiles(Path)) {
-            if (!db->DirectoryExist(dir)) db->AddDirectory(dir);
-            db->AddInstrumentsNonrecursive(dir, Path, insDir, pProgress);
+        if (Path.at(Path.length() - 1) != File::DirSeparator) {
+            Path.push_back(File::DirSeparator);
         }
-    };
 
-    bool DirectoryScanner::HasInstrumentFiles(String Dir) {
-        InstrumentFileCounter c;
-        return c.Count(Dir) > 0;
-    }
+        // the DB directory is created by the writer once the first
+        // instrument file of its subtree is added
+        try {
+            FileListPtr fileList = File::GetFiles(Path);
+            for (int i = 0; i < fileList->size(); i++) {
+                if (!InstrumentFileInfo::isSupportedFile(fileList->at(i))) continue;
+                Items.push_back(new ScanItem(dir, Path + fileList->at(i)));
+            }
+        } catch(Exception e) {
+            e.PrintMessage();
+        }
+    };
 
     int InstrumentFileCounter::Count(String FsDir) {
         dmsg(2,("InstrumentFileCounter: Count(FsDir=%s)\n", FsDir.c_str()));
@@ -815,4 +845,143 @@ namespace LinuxSampler {
         return false;
     }
 
+    /**
+     * Blocks until @a cond is set, waiting again after spurious wakeups.
+     */
+    static void WaitUntilSet(Condition& cond) {
+        cond.Lock();
+        while (!cond.GetUnsafe()) cond.PreLockedWaitIf(false);
+        cond.Unlock();
+    }
+
+    ScanItem::ScanItem(String DbDir, String FilePath, int Index) :
+        DbDir(DbDir), FilePath(FilePath), Index(Index), FileSize(0)
+    {
+    }
+
+    InstrumentFileScanner::InstrumentFileScanner(ScanItemList& Items) : Items(Items) {
+        NextItem = 0;
+        Aborted = false;
+
+        int threads = 2;
+        #if defined(_SC_NPROCESSORS_ONLN)
+        threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+        #endif
+        if (threads < 1) threads = 1;
+        if (threads > 4) threads = 4;
+        if (threads > Items.size()) threads = (int) Items.size();
+        LookAhead = threads * 8;
+
+        dmsg(2,("InstrumentFileScanner: parsing %d files on %d threads\n", (int)Items.size(), threads));
+        for (int i = 0; i < threads; i++) {
+            ParserThread* pThread = new ParserThread(this);
+            if (pThread->StartThread()) {
+                delete pThread;
+                break;
+            }
+            Threads.push_back(pThread);
+        }
+    }
+
+    InstrumentFileScanner::~InstrumentFileScanner() {
+        {
+            LockGuard lock(NextItemMutex);
+            Aborted = true;
+        }
+        // wake up parser threads waiting for the writer to catch up
+        for (int i = 0; i < Items.size(); i++) Items[i]->Consumed.Set(true);
+
+        for (int i = 0; i < Threads.size(); i++) {
+            WaitUntilSet(Threads[i]->Finished);
+            Threads[i]->StopThread();
+            delete Threads[i];
+        }
+    }
+
+    bool InstrumentFileScanner::IsParsed(int Index) {
+        return Items[Index]->Parsed.GetUnsafe();
+    }
+
+    ScanItem* InstrumentFileScanner::Get(int Index) {
+        if (Threads.empty() && !IsParsed(Index)) {
+            // no parser thread could be started, so parse it right here
+            Parse(Items[Index]);
+            Items[Index]->Parsed.Set(true);
+        }
+        WaitUntilSet(Items[Index]->Parsed);
+        return Items[Index];
+    }
+
+    void InstrumentFileScanner::Release(int Index) {
+        std::vector<InstrumentInfo>().swap(Items[Index]->Instruments);
+        Items[Index]->Consumed.Set(true);
+    }
+
+    int InstrumentFileScanner::NextItemToParse() {
+        int i;
+        {
+            LockGuard lock(NextItemMutex);
+            if (Aborted || NextItem >= Items.size()) return -1;
+            i = NextItem++;
+        }
+        // don't get too far ahead of the writer
+        if (i >= LookAhead) WaitUntilSet(Items[i - LookAhead]->Consumed);
+
+        LockGuard lock(NextItemMutex);
+        return Aborted ? -1 : i;
+    }
+
+    void InstrumentFileScanner::Parse(ScanItem* pItem) {
+        dmsg(2,("InstrumentFileScanner: Parse(FilePath=%s)\n", pItem->FilePath.c_str()));
+        InstrumentFileInfo* fileInfo = NULL;
+        try {
+            File f = File(pItem->FilePath);
+            if (!f.Exist()) {
+                std::stringstream ss;
+                ss << "Fail to stat `" << pItem->FilePath << "`: " << f.GetErrorMsg();
+                throw Exception(ss.str());
+            }
+
+            if (!f.IsFile()) {
+                std::stringstream ss;
+                ss << "`" << pItem->FilePath << "` is not a regular file";
+                throw Exception(ss.str());
+            }
+            pItem->FileSize = f.GetSize();
+
+            fileInfo = InstrumentFileInfo::getFileInfoFor(pItem->FilePath);
+            if (fileInfo) {
+                pItem->FormatName = fileInfo->formatName();
+                pItem->FormatVersion = fileInfo->formatVersion();
+
+                int instrIndex = (pItem->Index == -1) ? 0 : pItem->Index;
+                optional<InstrumentInfo> info = fileInfo->getInstrumentInfo(instrIndex, NULL);
+                while (info) {
+                    pItem->Instruments.push_back(*info);
+                    if (pItem->Index != -1) break;
+                    info = fileInfo->getInstrumentInfo(++instrIndex, NULL);
+                }
+            }
+        } catch (Exception e) {
+            pItem->Error = "Failed to scan `" + pItem->FilePath + "`: " + e.Message();
+        } catch (...) {
+            pItem->Error = "Failed to scan `" + pItem->FilePath + "`";
+        }
+        if (fileInfo) delete fileInfo;
+    }
+
+    InstrumentFileScanner::ParserThread::ParserThread(InstrumentFileScanner* pScanner) :
+        Thread(false, false, 0, -4), pScanner(pScanner)
+    {
+    }
+
+    int InstrumentFileScanner::ParserThread::Main() {
+        for (int i = pScanner->NextItemToParse(); i != -1; i = pScanner->NextItemToParse()) {
+            pScanner->Parse(pScanner->Items[i]);
+            pScanner->Items[i]->Parsed.Set(true);
+        }
+        Finished.Set(true);
+        return 0;
+    }
+
 } // namespace LinuxSampler
@@ -34,6 +34,9 @@
 
 #include "../common/File.h"
 #include "../common/optional.h"
+#include "../common/Condition.h"
+#include "../common/Mutex.h"
+#include "../common/Thread.h"
 
 namespace LinuxSampler {
 
@@ -377,8 +380,13 @@ namespace LinuxSampler {
                 int GetFileCount();
     };
     
+    class ScanItem;
+    typedef std::vector<ScanItem*> ScanItemList;
+
     class DirectoryScanner: public File::DirectoryWalker {
         public:
+            ~DirectoryScanner();
+
             /**
              * Recursively scans all subdirectories of the specified file
              * system directory and adds the supported instruments to the database.
@@ -396,8 +404,10 @@ namespace LinuxSampler {
             String FsDir;
             bool Flat;
             ScanProgress* pProgress;
-            bool HasInstrumentFiles(String Dir);
 			bool insDir;
+            ScanItemList Items;
+
+            void ClearItems();
     };
     
     class InstrumentFileCounter: public File::DirectoryWalker {
@@ -444,6 +454,104 @@ namespace LinuxSampler {
         String m_fileName;
     };
 
+    /**
+     * An instrument file which is part of a directory scan. The file is
+     * parsed by one of the threads of an InstrumentFileScanner and the
+     * gathered information is then written to the instruments database
+     * by the thread which runs the scan.
+     */
+    class ScanItem {
+        public:
+            /**
+             * @param DbDir The absolute path name of the instruments database
+             * directory in which the instruments of the file should be added.
+             * @param FilePath The absolute path name of the instrument file.
+             * @param Index The index of the instrument to add, or -1 to add
+             * all instruments of the file.
+             */
+            ScanItem(String DbDir, String FilePath, int Index = -1);
+
+            String DbDir;
+            String FilePath;
+            int    Index;
+
+            // The following members are only valid after the item was parsed.
+            String FormatName;
+            String FormatVersion;
+            unsigned long FileSize;
+            std::vector<InstrumentInfo> Instruments;
+            String Error; ///< Empty if the whole file could be parsed.
+
+        private:
+            friend class InstrumentFileScanner;
+
+            Condition Parsed;
+            Condition Consumed;
+    };
+
+    /**
+     * Parses the instrument files of a list of scan items on a small pool
+     * of threads, so that file parsing (which is mostly waiting for the
+     * disk) of several files overlaps, while the results are still handed
+     * to the single thread writing to the database in the order of the
+     * list. The parser threads only work a limited number of items ahead
+     * of the writer, which bounds the memory used for parsed results.
+     */
+    class InstrumentFileScanner {
+        public:
+            /**
+             * Starts parsing the supplied items. The list must remain valid
+             * and unchanged until this scanner is destroyed.
+             */
+            InstrumentFileScanner(ScanItemList& Items);
+
+            /**
+             * Stops parsing of any remaining items and waits for all
+             * parser threads to finish.
+             */
+            ~InstrumentFileScanner();
+
+            /**
+             * Returns true if the item with the specified index is already
+             * parsed, so that Get() would not block.
+             */
+            bool IsParsed(int Index);
+
+            /**
+             * Waits until the item with the specified index is parsed and
+             * returns it.
+             */
+            ScanItem* Get(int Index);
+
+            /**
+             * Must be called once the caller is done with the item with the
+             * specified index. Frees the parsed instrument information and
+             * allows the parser threads to advance to further items.
+             */
+            void Release(int Index);
+
+        private:
+            class ParserThread : public Thread {
+                public:
+                    ParserThread(InstrumentFileScanner* pScanner);
+                    Condition Finished;
+                protected:
+                    int Main();
+                private:
+                    InstrumentFileScanner* pScanner;
+            };
+
+            ScanItemList& Items;
+            std::vector<ParserThread*> Threads;
+            Mutex NextItemMutex;
+            int NextItem;
+            bool Aborted;
+            int LookAhead;
+
+            int  NextItemToParse();
+            void Parse(ScanItem* pItem);
+    };
+
 } // namespace LinuxSampler
 
 #endif // __LS_INSTRUMENTSDBUTILITIES_H__
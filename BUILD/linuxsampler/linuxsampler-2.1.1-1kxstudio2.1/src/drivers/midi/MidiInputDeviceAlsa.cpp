@@ -26,11 +26,17 @@
 
 #define perm_ok(pinfo,bits) ((snd_seq_port_info_get_capability(pinfo) & (bits)) == (bits))
 
+// upper bound for the 'LATENCY' MIDI port parameter (in milliseconds)
+#define MAX_LATENCY_MS  100.0f
+
 namespace LinuxSampler {
 
     /// number of currently existing ALSA midi input devices in LinuxSampler
     static int existingAlsaDevices = 0;
 
+    /// upper bounds (in microseconds) of the latency histogram bins, the last bin takes everything above
+    static const int latencyHistogramBinsUs[] = { 250, 500, 1000, 2000, 4000, 8000, 16000 };
+
 // *************** ParameterName ***************
 // *
 
@@ -122,6 +128,86 @@ namespace LinuxSampler {
 
 
 
+// *************** ParameterLatency ***************
+// *
+
+    MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatency::ParameterLatency(MidiInputPortAlsa* pPort) : DeviceRuntimeParameterFloat(0.0f) {
+        this->pPort = pPort;
+    }
+
+    String MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatency::Description() {
+        return "Constant latency of events in ms (0: as early as possible)";
+    }
+
+    bool MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatency::Fix() {
+        return false;
+    }
+
+    optional<float> MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatency::RangeMinAsFloat() {
+        return 0.0f;
+    }
+
+    optional<float> MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatency::RangeMaxAsFloat() {
+        return MAX_LATENCY_MS;
+    }
+
+    std::vector<float> MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatency::PossibilitiesAsFloat() {
+        return std::vector<float>();
+    }
+
+    void MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatency::OnSetValue(float f) {
+        pPort->latencyUs.store(int(f * 1000.0f));
+        pPort->ResetLatencyHistogram();
+    }
+
+
+
+// *************** ParameterLatencyHistogram ***************
+// *
+
+    MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatencyHistogram::ParameterLatencyHistogram(MidiInputPortAlsa* pPort) : DeviceRuntimeParameterString("") {
+        this->pPort = pPort;
+    }
+
+    String MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatencyHistogram::Description() {
+        return "Time events waited for the MIDI input thread";
+    }
+
+    bool MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatencyHistogram::Fix() {
+        return true;
+    }
+
+    std::vector<String> MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatencyHistogram::PossibilitiesAsString() {
+        return std::vector<String>(); // nothing
+    }
+
+    static String MilliSeconds(int us) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%g", float(us) / 1000.0f);
+        return buf;
+    }
+
+    String MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatencyHistogram::ValueAsString() {
+        char max[32];
+        snprintf(max, sizeof(max), "%.3f", float(pPort->maxWaitUs.load(memory_order_relaxed)) / 1000.0f);
+        String s = "EVENTS=" + ToString(pPort->eventCount.load(memory_order_relaxed)) +
+                   " LATE=" + ToString(pPort->lateCount.load(memory_order_relaxed)) +
+                   " MAX=" + max + "ms";
+        for (int i = 0; i < LATENCY_HISTOGRAM_BINS; i++) {
+            const String from = (i) ? MilliSeconds(latencyHistogramBinsUs[i-1]) : "0";
+            const String bin = (i < LATENCY_HISTOGRAM_BINS - 1) ?
+                from + "-" + MilliSeconds(latencyHistogramBinsUs[i]) + "ms" : from + "ms+";
+            s += " " + bin + "=" + ToString(pPort->histogram[i].load(memory_order_relaxed));
+        }
+        return s;
+    }
+
+    void MidiInputDeviceAlsa::MidiInputPortAlsa::ParameterLatencyHistogram::OnSetValue(String s) {
+        // not possible as parameter is 'fix'
+    }
+
+
+
 // *************** MidiInputDeviceAlsa::ParameterName ***************
 // *
 
@@ -171,18 +257,33 @@ namespace LinuxSampler {
 
     MidiInputDeviceAlsa::MidiInputPortAlsa::MidiInputPortAlsa(MidiInputDeviceAlsa* pDevice) throw (MidiInputException) : MidiInputPort(pDevice, -1) {
         this->pDevice = pDevice;
+        latencyUs.store(0);
+        ResetLatencyHistogram();
 
         // create Alsa sequencer port
-        int alsaPort = snd_seq_create_simple_port(pDevice->hAlsaSeq, "unnamed port",
-                                                  SND_SEQ_PORT_CAP_WRITE|SND_SEQ_PORT_CAP_SUBS_WRITE,
-                                                  SND_SEQ_PORT_TYPE_APPLICATION);
-        if (alsaPort < 0) throw MidiInputException("Error creating sequencer port");
-        this->portNumber = alsaPort;
+        snd_seq_port_info_t* pinfo;
+        snd_seq_port_info_alloca(&pinfo);
+        snd_seq_port_info_set_name(pinfo, "unnamed port");
+        snd_seq_port_info_set_capability(pinfo, SND_SEQ_PORT_CAP_WRITE|SND_SEQ_PORT_CAP_SUBS_WRITE);
+        snd_seq_port_info_set_type(pinfo, SND_SEQ_PORT_TYPE_APPLICATION);
+        snd_seq_port_info_set_midi_channels(pinfo, 16);
+        if (pDevice->hAlsaQueue >= 0) {
+            // let the kernel stamp every incoming event with the real time
+            // of our queue, no matter who subscribed to the port
+            snd_seq_port_info_set_timestamping(pinfo, 1);
+            snd_seq_port_info_set_timestamp_real(pinfo, 1);
+            snd_seq_port_info_set_timestamp_queue(pinfo, pDevice->hAlsaQueue);
+        }
+        if (snd_seq_create_port(pDevice->hAlsaSeq, pinfo) < 0)
+            throw MidiInputException("Error creating sequencer port");
+        this->portNumber = snd_seq_port_info_get_port(pinfo);
 
         delete Parameters["NAME"];
         Parameters["NAME"]              = new ParameterName(this);
         Parameters["ALSA_SEQ_BINDINGS"] = new ParameterAlsaSeqBindings(this);
         Parameters["ALSA_SEQ_ID"]       = new ParameterAlsaSeqId(this);
+        Parameters["LATENCY"]           = new ParameterLatency(this);
+        Parameters["LATENCY_HISTOGRAM"] = new ParameterLatencyHistogram(this);
     }
 
     MidiInputDeviceAlsa::MidiInputPortAlsa::~MidiInputPortAlsa() {
@@ -210,9 +311,11 @@ namespace LinuxSampler {
         snd_seq_port_subscribe_malloc(&subs);
         snd_seq_port_subscribe_set_sender(subs, &sender);
         snd_seq_port_subscribe_set_dest(subs, &dest);
-        snd_seq_port_subscribe_set_queue(subs, 1);
-        snd_seq_port_subscribe_set_time_update(subs, 1);
-        snd_seq_port_subscribe_set_time_real(subs, 1);
+        if (pDevice->hAlsaQueue >= 0) {
+            snd_seq_port_subscribe_set_queue(subs, pDevice->hAlsaQueue);
+            snd_seq_port_subscribe_set_time_update(subs, 1);
+            snd_seq_port_subscribe_set_time_real(subs, 1);
+        }
         if (snd_seq_subscribe_port(pDevice->hAlsaSeq, subs) < 0) {
             snd_seq_port_subscribe_free(subs);
             throw MidiInputException(String("Unable to connect to Alsa seq client \'") + MidiSource + "\' (" + snd_strerror(errno) + ")");
@@ -232,16 +335,65 @@ namespace LinuxSampler {
         subscriptions.clear();
     }
 
+    /**
+     * Returns the time of the given event relative to now, as it shall be
+     * passed to the sampler engines. That is the time the event waited
+     * since the kernel received it, compensated by the configured constant
+     * latency. Also accounts the event in the latency histogram.
+     *
+     * @param ev   - event just read from the sequencer
+     * @param pNow - current real time of the device's queue, or NULL if
+     *               not known
+     */
+    midi_time_offset_t MidiInputDeviceAlsa::MidiInputPortAlsa::TimeOffset(const snd_seq_event_t* ev, const snd_seq_real_time_t* pNow) {
+        const int latency = latencyUs.load(memory_order_relaxed);
+        if (!pNow || ev->queue != pDevice->hAlsaQueue ||
+            (ev->flags & SND_SEQ_TIME_STAMP_MASK) != SND_SEQ_TIME_STAMP_REAL)
+            return midi_time_offset_t(latency); // not time stamped by the kernel
+
+        int64_t waitUs = int64_t(pNow->tv_sec - ev->time.time.tv_sec) * 1000000 +
+                         (int64_t(pNow->tv_nsec) - int64_t(ev->time.time.tv_nsec)) / 1000;
+        if (waitUs < 0) waitUs = 0;
+        if (waitUs > 1000000) waitUs = 1000000; // anything beyond is lost anyway
+        const int wait = int(waitUs);
+
+        int bin = 0;
+        while (bin < LATENCY_HISTOGRAM_BINS - 1 && wait >= latencyHistogramBinsUs[bin]) bin++;
+        histogram[bin].fetch_add(1, memory_order_relaxed);
+        eventCount.fetch_add(1, memory_order_relaxed);
+        if (latency && wait > latency) lateCount.fetch_add(1, memory_order_relaxed);
+        if (wait > maxWaitUs.load(memory_order_relaxed)) maxWaitUs.store(wait, memory_order_relaxed);
+
+        return midi_time_offset_t(latency - wait);
+    }
+
+    void MidiInputDeviceAlsa::MidiInputPortAlsa::ResetLatencyHistogram() {
+        eventCount.store(0);
+        lateCount.store(0);
+        maxWaitUs.store(0);
+        for (int i = 0; i < LATENCY_HISTOGRAM_BINS; i++) histogram[i].store(0);
+    }
+
 // *************** MidiInputDeviceAlsa ***************
 // *
 
     MidiInputDeviceAlsa::MidiInputDeviceAlsa(std::map<String,DeviceCreationParameter*> Parameters, void* pSampler) : MidiInputDevice(Parameters, pSampler), Thread(true, true, 1, -1) {
-        if (snd_seq_open(&hAlsaSeq, "default", SND_SEQ_OPEN_INPUT, 0) < 0) {
+        // (output is only needed for starting the queue)
+        if (snd_seq_open(&hAlsaSeq, "default", SND_SEQ_OPEN_DUPLEX, 0) < 0) {
             throw MidiInputException("Error opening ALSA sequencer");
         }
         existingAlsaDevices++;
         this->hAlsaSeqClient = snd_seq_client_id(hAlsaSeq);
         snd_seq_set_client_name(hAlsaSeq, ((DeviceCreationParameterString*)Parameters["NAME"])->ValueAsString().c_str());
+        // the real time clock of this queue is used to time stamp incoming
+        // events, so we know how long they waited for the MIDI input thread
+        this->hAlsaQueue = snd_seq_alloc_queue(hAlsaSeq);
+        if (hAlsaQueue >= 0) {
+            snd_seq_start_queue(hAlsaSeq, hAlsaQueue, NULL);
+            snd_seq_drain_output(hAlsaSeq);
+        } else {
+            dmsg(1,("MidiInputDeviceAlsa: Could not allocate sequencer queue, MIDI events won't be time stamped.\n"));
+        }
         AcquirePorts(((DeviceCreationParameterInt*)Parameters["PORTS"])->ValueAsInt());
         if (((DeviceCreationParameterBool*)Parameters["ACTIVE"])->ValueAsBool()) {
             Listen();
@@ -257,6 +409,7 @@ namespace LinuxSampler {
         }
         Ports.clear();
 
+        if (hAlsaQueue >= 0) snd_seq_free_queue(hAlsaSeq, hAlsaQueue);
         snd_seq_close(hAlsaSeq);
         existingAlsaDevices--; //FIXME: this is too simple, can lead to multiple clients with the same name
     }
@@ -294,7 +447,10 @@ namespace LinuxSampler {
         int npfd;
         struct pollfd* pfd;
         snd_seq_event_t* ev;
+        snd_seq_queue_status_t* queueStatus;
+        snd_seq_real_time_t now;
 
+        snd_seq_queue_status_alloca(&queueStatus);
         npfd = snd_seq_poll_descriptors_count(hAlsaSeq, POLLIN);
         pfd = (struct pollfd*) alloca(npfd * sizeof(struct pollfd));
         snd_seq_poll_descriptors(hAlsaSeq, pfd, npfd, POLLIN);
@@ -303,7 +459,18 @@ namespace LinuxSampler {
                 do {
                     snd_seq_event_input(hAlsaSeq, &ev);
                     int port = (int) ev->dest.port;
-                    MidiInputPort* pMidiInputPort = Ports[port];
+                    MidiInputPortAlsa* pMidiInputPort = static_cast<MidiInputPortAlsa*>(Ports[port]);
+
+                    // current queue time, to find out how long the event
+                    // was waiting for us since the kernel received it
+                    const snd_seq_real_time_t* pNow = NULL;
+                    if (snd_seq_ev_is_channel_type(ev) && hAlsaQueue >= 0 && ev->queue == hAlsaQueue &&
+                        snd_seq_get_queue_status(hAlsaSeq, hAlsaQueue, queueStatus) >= 0)
+                    {
+                        now  = *snd_seq_queue_status_get_real_time(queueStatus);
+                        pNow = &now;
+                    }
+                    const midi_time_offset_t offset = pMidiInputPort->TimeOffset(ev, pNow);
 
                     switch (ev->type) {
                         case SND_SEQ_EVENT_CONTROLLER:
@@ -311,32 +478,32 @@ namespace LinuxSampler {
                                 pMidiInputPort->DispatchBankSelectMsb(ev->data.control.value, ev->data.control.channel);
                             else if (ev->data.control.param == 32)
                                 pMidiInputPort->DispatchBankSelectLsb(ev->data.control.value, ev->data.control.channel);
-                            pMidiInputPort->DispatchControlChange(ev->data.control.param, ev->data.control.value, ev->data.control.channel);
+                            pMidiInputPort->DispatchControlChange(ev->data.control.param, ev->data.control.value, ev->data.control.channel, offset);
                             break;
 
                         case SND_SEQ_EVENT_CHANPRESS:
-                            pMidiInputPort->DispatchChannelPressure(ev->data.control.value, ev->data.control.channel);
+                            pMidiInputPort->DispatchChannelPressure(ev->data.control.value, ev->data.control.channel, offset);
                             break;
 
                         case SND_SEQ_EVENT_KEYPRESS:
-                            pMidiInputPort->DispatchPolyphonicKeyPressure(ev->data.note.note, ev->data.note.velocity, ev->data.control.channel);
+                            pMidiInputPort->DispatchPolyphonicKeyPressure(ev->data.note.note, ev->data.note.velocity, ev->data.control.channel, offset);
                             break;
 
                         case SND_SEQ_EVENT_PITCHBEND:
-                            pMidiInputPort->DispatchPitchbend(ev->data.control.value, ev->data.control.channel);
+                            pMidiInputPort->DispatchPitchbend(ev->data.control.value, ev->data.control.channel, offset);
                             break;
 
                         case SND_SEQ_EVENT_NOTEON:
                             if (ev->data.note.velocity != 0) {
-                                pMidiInputPort->DispatchNoteOn(ev->data.note.note, ev->data.note.velocity, ev->data.control.channel);
+                                pMidiInputPort->DispatchNoteOn(ev->data.note.note, ev->data.note.velocity, ev->data.control.channel, offset);
                             }
                             else {
-                                pMidiInputPort->DispatchNoteOff(ev->data.note.note, 0, ev->data.control.channel);
+                                pMidiInputPort->DispatchNoteOff(ev->data.note.note, 0, ev->data.control.channel, offset);
                             }
                             break;
 
                         case SND_SEQ_EVENT_NOTEOFF:
-                            pMidiInputPort->DispatchNoteOff(ev->data.note.note, ev->data.note.velocity, ev->data.control.channel);
+                            pMidiInputPort->DispatchNoteOff(ev->data.note.note, ev->data.note.velocity, ev->data.control.channel, offset);
                             break;
 
                         case SND_SEQ_EVENT_SYSEX:
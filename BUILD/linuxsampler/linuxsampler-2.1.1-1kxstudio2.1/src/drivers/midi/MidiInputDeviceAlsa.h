@@ -28,6 +28,7 @@
 
 #include "../../common/global_private.h"
 #include "../../common/Thread.h"
+#include "../../common/lsatomic.h"
 #include "MidiInputDevice.h"
 
 namespace LinuxSampler {
@@ -84,7 +85,51 @@ namespace LinuxSampler {
                             virtual void                OnSetValue(String s) OVERRIDE;
                     };
 
+                    /** MIDI Port Parameter 'LATENCY'
+                     *
+                     * Constant latency (in milliseconds) by which all
+                     * events are delayed after the kernel received them.
+                     * As long as the MIDI input thread wakes up within this
+                     * time, events are played without any timing jitter.
+                     * Zero means events are played as early as possible.
+                     */
+                    class ParameterLatency : public DeviceRuntimeParameterFloat {
+                        public:
+                            ParameterLatency(MidiInputPortAlsa* pPort);
+                            virtual String             Description() OVERRIDE;
+                            virtual bool               Fix() OVERRIDE;
+                            virtual optional<float>    RangeMinAsFloat() OVERRIDE;
+                            virtual optional<float>    RangeMaxAsFloat() OVERRIDE;
+                            virtual std::vector<float> PossibilitiesAsFloat() OVERRIDE;
+                            virtual void               OnSetValue(float f) OVERRIDE;
+                        protected:
+                            MidiInputPortAlsa* pPort;
+                    };
+
+                    /** MIDI Port Parameter 'LATENCY_HISTOGRAM'
+                     *
+                     * Reflects how long events were waiting between their
+                     * arrival in the kernel and being dispatched by the
+                     * MIDI input thread, e.g. "EVENTS=120 LATE=0 MAX=0.731ms
+                     * 0-0.25ms=101 0.25-0.5ms=17 0.5-1ms=2 ...". Events
+                     * counted as LATE waited longer than the configured
+                     * constant latency and were thus played too late.
+                     */
+                    class ParameterLatencyHistogram : public DeviceRuntimeParameterString {
+                        public:
+                            ParameterLatencyHistogram(MidiInputPortAlsa* pPort);
+                            virtual String              Description() OVERRIDE;
+                            virtual bool                Fix() OVERRIDE;
+                            virtual std::vector<String> PossibilitiesAsString() OVERRIDE;
+                            virtual String              ValueAsString() OVERRIDE;
+                            virtual void                OnSetValue(String s) OVERRIDE;
+                        protected:
+                            MidiInputPortAlsa* pPort;
+                    };
+
                     void ConnectToAlsaMidiSource(const char* MidiSource);
+                    midi_time_offset_t TimeOffset(const snd_seq_event_t* ev, const snd_seq_real_time_t* pNow);
+                    void ResetLatencyHistogram();
                 protected:
                     std::vector<snd_seq_port_subscribe_t*> subscriptions;
 
@@ -92,7 +137,14 @@ namespace LinuxSampler {
                     ~MidiInputPortAlsa();
                     friend class MidiInputDeviceAlsa;
                 private:
+                    enum { LATENCY_HISTOGRAM_BINS = 8 };
+
                     MidiInputDeviceAlsa* pDevice;
+                    atomic<int> latencyUs;     ///< constant latency in microseconds (0: play events as early as possible)
+                    atomic<int> eventCount;    ///< time stamped events since the histogram was reset
+                    atomic<int> lateCount;     ///< events which waited longer than @c latencyUs
+                    atomic<int> maxWaitUs;     ///< longest time an event waited for the MIDI input thread
+                    atomic<int> histogram[LATENCY_HISTOGRAM_BINS];
 
                     friend class ParameterName;
                     friend class ParameterAlsaSeqBindings;
@@ -135,6 +187,7 @@ namespace LinuxSampler {
         private:
             snd_seq_t* hAlsaSeq;
             int        hAlsaSeqClient;       ///< Alsa Sequencer client ID
+            int        hAlsaQueue;           ///< Alsa Sequencer queue whose real time clock stamps incoming events (-1 if none)
 
             friend class MidiInputPortAlsa;
             friend class MidiInputPortAlsa::ParameterName;
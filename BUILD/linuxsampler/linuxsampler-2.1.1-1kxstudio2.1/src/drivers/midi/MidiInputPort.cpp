@@ -99,6 +99,10 @@ namespace LinuxSampler {
     }
 
     void MidiInputPort::DispatchNoteOn(uint8_t Key, uint8_t Velocity, uint MidiChannel) {
+        DispatchNoteOn(Key, Velocity, MidiChannel, midi_time_offset_t(0));
+    }
+
+    void MidiInputPort::DispatchNoteOn(uint8_t Key, uint8_t Velocity, uint MidiChannel, const midi_time_offset_t& TimeOffset) {
         if (Key > 127 || Velocity > 127 || MidiChannel > 16) return;
         
         // apply velocity filter (if any)
@@ -111,13 +115,13 @@ namespace LinuxSampler {
         {
             std::set<EngineChannel*>::iterator engineiter = midiChannelMap[MidiChannel].begin();
             std::set<EngineChannel*>::iterator end        = midiChannelMap[MidiChannel].end();
-            for (; engineiter != end; engineiter++) (*engineiter)->SendNoteOn(Key, Velocity, MidiChannel);
+            for (; engineiter != end; engineiter++) (*engineiter)->SendNoteOn(Key, Velocity, MidiChannel, TimeOffset);
         }
         // dispatch event for engines listening to ALL MIDI channels
         {
             std::set<EngineChannel*>::iterator engineiter = midiChannelMap[midi_chan_all].begin();
             std::set<EngineChannel*>::iterator end        = midiChannelMap[midi_chan_all].end();
-            for (; engineiter != end; engineiter++) (*engineiter)->SendNoteOn(Key, Velocity, MidiChannel);
+            for (; engineiter != end; engineiter++) (*engineiter)->SendNoteOn(Key, Velocity, MidiChannel, TimeOffset);
         }
         MidiChannelMapReader.Unlock();
 
@@ -161,19 +165,23 @@ namespace LinuxSampler {
     }
 
     void MidiInputPort::DispatchNoteOff(uint8_t Key, uint8_t Velocity, uint MidiChannel) {
+        DispatchNoteOff(Key, Velocity, MidiChannel, midi_time_offset_t(0));
+    }
+
+    void MidiInputPort::DispatchNoteOff(uint8_t Key, uint8_t Velocity, uint MidiChannel, const midi_time_offset_t& TimeOffset) {
         if (Key > 127 || Velocity > 127 || MidiChannel > 16) return;
         const MidiChannelMap_t& midiChannelMap = MidiChannelMapReader.Lock();
         // dispatch event for engines listening to the same MIDI channel
         {
             std::set<EngineChannel*>::iterator engineiter = midiChannelMap[MidiChannel].begin();
             std::set<EngineChannel*>::iterator end        = midiChannelMap[MidiChannel].end();
-            for (; engineiter != end; engineiter++) (*engineiter)->SendNoteOff(Key, Velocity, MidiChannel);
+            for (; engineiter != end; engineiter++) (*engineiter)->SendNoteOff(Key, Velocity, MidiChannel, TimeOffset);
         }
         // dispatch event for engines listening to ALL MIDI channels
         {
             std::set<EngineChannel*>::iterator engineiter = midiChannelMap[midi_chan_all].begin();
             std::set<EngineChannel*>::iterator end        = midiChannelMap[midi_chan_all].end();
-            for (; engineiter != end; engineiter++) (*engineiter)->SendNoteOff(Key, Velocity, MidiChannel);
+            for (; engineiter != end; engineiter++) (*engineiter)->SendNoteOff(Key, Velocity, MidiChannel, TimeOffset);
         }
         MidiChannelMapReader.Unlock();
 
@@ -211,19 +219,23 @@ namespace LinuxSampler {
     }
 
     void MidiInputPort::DispatchPitchbend(int Pitch, uint MidiChannel) {
+        DispatchPitchbend(Pitch, MidiChannel, midi_time_offset_t(0));
+    }
+
+    void MidiInputPort::DispatchPitchbend(int Pitch, uint MidiChannel, const midi_time_offset_t& TimeOffset) {
         if (Pitch < -8192 || Pitch > 8191 || MidiChannel > 16) return;
         const MidiChannelMap_t& midiChannelMap = MidiChannelMapReader.Lock();
         // dispatch event for engines listening to the same MIDI channel
         {
             std::set<EngineChannel*>::iterator engineiter = midiChannelMap[MidiChannel].begin();
             std::set<EngineChannel*>::iterator end        = midiChannelMap[MidiChannel].end();
-            for (; engineiter != end; engineiter++) (*engineiter)->SendPitchbend(Pitch, MidiChannel);
+            for (; engineiter != end; engineiter++) (*engineiter)->SendPitchbend(Pitch, MidiChannel, TimeOffset);
         }
         // dispatch event for engines listening to ALL MIDI channels
         {
             std::set<EngineChannel*>::iterator engineiter = midiChannelMap[midi_chan_all].begin();
             std::set<EngineChannel*>::iterator end        = midiChannelMap[midi_chan_all].end();
-            for (; engineiter != end; engineiter++) (*engineiter)->SendPitchbend(Pitch, MidiChannel);
+            for (; engineiter != end; engineiter++) (*engineiter)->SendPitchbend(Pitch, MidiChannel, TimeOffset);
         }
         MidiChannelMapReader.Unlock();
     }
@@ -247,19 +259,23 @@ namespace LinuxSampler {
     }
 
     void MidiInputPort::DispatchChannelPressure(uint8_t Value, uint MidiChannel) {
+        DispatchChannelPressure(Value, MidiChannel, midi_time_offset_t(0));
+    }
+
+    void MidiInputPort::DispatchChannelPressure(uint8_t Value, uint MidiChannel, const midi_time_offset_t& TimeOffset) {
         if (Value > 127 || MidiChannel > 16) return;
         const MidiChannelMap_t& midiChannelMap = MidiChannelMapReader.Lock();
         // dispatch event for engines listening to the same MIDI channel
         {
             std::set<EngineChannel*>::iterator engineiter = midiChannelMap[MidiChannel].begin();
             std::set<EngineChannel*>::iterator end        = midiChannelMap[MidiChannel].end();
-            for (; engineiter != end; engineiter++) (*engineiter)->SendChannelPressure(Value, MidiChannel);
+            for (; engineiter != end; engineiter++) (*engineiter)->SendChannelPressure(Value, MidiChannel, TimeOffset);
         }
         // dispatch event for engines listening to ALL MIDI channels
         {
             std::set<EngineChannel*>::iterator engineiter = midiChannelMap[midi_chan_all].begin();
             std::set<EngineChannel*>::iterator end        = midiChannelMap[midi_chan_all].end();
-            for (; engineiter != end; engineiter++) (*engineiter)->SendChannelPressure(Value, MidiChannel);
+            for (; engineiter != end; engineiter++) (*engineiter)->SendChannelPressure(Value, MidiChannel, TimeOffset);
         }
         MidiChannelMapReader.Unlock();
     }
@@ -283,19 +299,23 @@ namespace LinuxSampler {
     }
 
     void MidiInputPort::DispatchPolyphonicKeyPressure(uint8_t Key, uint8_t Value, uint MidiChannel) {
+        DispatchPolyphonicKeyPressure(Key, Value, MidiChannel, midi_time_offset_t(0));
+    }
+
+    void MidiInputPort::DispatchPolyphonicKeyPressure(uint8_t Key, uint8_t Value, uint MidiChannel, const midi_time_offset_t& TimeOffset) {
         if (Key > 127 || Value > 127 || MidiChannel > 16) return;
         const MidiChannelMap_t& midiChannelMap = MidiChannelMapReader.Lock();
         // dispatch event for engines listening to the same MIDI channel
         {
             std::set<EngineChannel*>::iterator engineiter = midiChannelMap[MidiChannel].begin();
             std::set<EngineChannel*>::iterator end        = midiChannelMap[MidiChannel].end();
-            for (; engineiter != end; engineiter++) (*engineiter)->SendPolyphonicKeyPressure(Key, Value, MidiChannel);
+            for (; engineiter != end; engineiter++) (*engineiter)->SendPolyphonicKeyPressure(Key, Value, MidiChannel, TimeOffset);
         }
         // dispatch event for engines listening to ALL MIDI channels
         {
             std::set<EngineChannel*>::iterator engineiter = midiChannelMap[midi_chan_all].begin();
             std::set<EngineChannel*>::iterator end        = midiChannelMap[midi_chan_all].end();
-            for (; engineiter != end; engineiter++) (*engineiter)->SendPolyphonicKeyPressure(Key, Value, MidiChannel);
+            for (; engineiter != end; engineiter++) (*engineiter)->SendPolyphonicKeyPressure(Key, Value, MidiChannel, TimeOffset);
         }
         MidiChannelMapReader.Unlock();
     }
@@ -319,19 +339,23 @@ namespace LinuxSampler {
     }
 
     void MidiInputPort::DispatchControlChange(uint8_t Controller, uint8_t Value, uint MidiChannel) {
+        DispatchControlChange(Controller, Value, MidiChannel, midi_time_offset_t(0));
+    }
+
+    void MidiInputPort::DispatchControlChange(uint8_t Controller, uint8_t Value, uint MidiChannel, const midi_time_offset_t& TimeOffset) {
         if (Controller > 128 || Value > 127 || MidiChannel > 16) return;
         const MidiChannelMap_t& midiChannelMap = MidiChannelMapReader.Lock();
         // dispatch event for engines listening to the same MIDI channel
         {
             std::set<EngineChannel*>::iterator engineiter = midiChannelMap[MidiChannel].begin();
             std::set<EngineChannel*>::iterator end        = midiChannelMap[MidiChannel].end();
-            for (; engineiter != end; engineiter++) (*engineiter)->SendControlChange(Controller, Value, MidiChannel);
+            for (; engineiter != end; engineiter++) (*engineiter)->SendControlChange(Controller, Value, MidiChannel, TimeOffset);
         }
         // dispatch event for engines listening to ALL MIDI channels
         {
             std::set<EngineChannel*>::iterator engineiter = midiChannelMap[midi_chan_all].begin();
             std::set<EngineChannel*>::iterator end        = midiChannelMap[midi_chan_all].end();
-            for (; engineiter != end; engineiter++) (*engineiter)->SendControlChange(Controller, Value, MidiChannel);
+            for (; engineiter != end; engineiter++) (*engineiter)->SendControlChange(Controller, Value, MidiChannel, TimeOffset);
         }
         MidiChannelMapReader.Unlock();
         
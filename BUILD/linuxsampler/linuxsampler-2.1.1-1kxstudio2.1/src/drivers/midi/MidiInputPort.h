@@ -179,6 +179,17 @@ namespace LinuxSampler {
              */
             void DispatchNoteOn(uint8_t Key, uint8_t Velocity, uint MidiChannel);
 
+            /**
+             * Same as above, but the event is processed at the given time
+             * offset from now. Meant for MIDI drivers which know when the
+             * note on event actually arrived (e.g. by a time stamp
+             * of the kernel), or which deliberately delay events by a
+             * constant latency to avoid timing jitter.
+             *
+             * @param TimeOffset - time of the event relative to now
+             */
+            void DispatchNoteOn(uint8_t Key, uint8_t Velocity, uint MidiChannel, const midi_time_offset_t& TimeOffset);
+
             /**
              * Should be called by the implementing MIDI input device
              * whenever a note on event arrived, this will cause the note on
@@ -214,6 +225,17 @@ namespace LinuxSampler {
              */
             void DispatchNoteOff(uint8_t Key, uint8_t Velocity, uint MidiChannel);
 
+            /**
+             * Same as above, but the event is processed at the given time
+             * offset from now. Meant for MIDI drivers which know when the
+             * note off event actually arrived (e.g. by a time stamp
+             * of the kernel), or which deliberately delay events by a
+             * constant latency to avoid timing jitter.
+             *
+             * @param TimeOffset - time of the event relative to now
+             */
+            void DispatchNoteOff(uint8_t Key, uint8_t Velocity, uint MidiChannel, const midi_time_offset_t& TimeOffset);
+
             /**
              * Should be called by the implementing MIDI input device
              * whenever a note off event arrived, this will cause the note
@@ -247,6 +269,17 @@ namespace LinuxSampler {
              */
             void DispatchPitchbend(int Pitch, uint MidiChannel);
 
+            /**
+             * Same as above, but the event is processed at the given time
+             * offset from now. Meant for MIDI drivers which know when the
+             * pitchbend event actually arrived (e.g. by a time stamp
+             * of the kernel), or which deliberately delay events by a
+             * constant latency to avoid timing jitter.
+             *
+             * @param TimeOffset - time of the event relative to now
+             */
+            void DispatchPitchbend(int Pitch, uint MidiChannel, const midi_time_offset_t& TimeOffset);
+
             /**
              * Should be called by the implementing MIDI input device
              * whenever a pitchbend event arrived, this will cause the
@@ -280,6 +313,17 @@ namespace LinuxSampler {
              */
             void DispatchControlChange(uint8_t Controller, uint8_t Value, uint MidiChannel);
 
+            /**
+             * Same as above, but the event is processed at the given time
+             * offset from now. Meant for MIDI drivers which know when the
+             * control change event actually arrived (e.g. by a time stamp
+             * of the kernel), or which deliberately delay events by a
+             * constant latency to avoid timing jitter.
+             *
+             * @param TimeOffset - time of the event relative to now
+             */
+            void DispatchControlChange(uint8_t Controller, uint8_t Value, uint MidiChannel, const midi_time_offset_t& TimeOffset);
+
             /**
              * Should be called by the implementing MIDI input device
              * whenever a control change event arrived, this will cause the
@@ -315,6 +359,17 @@ namespace LinuxSampler {
              */
             void DispatchChannelPressure(uint8_t Value, uint MidiChannel);
 
+            /**
+             * Same as above, but the event is processed at the given time
+             * offset from now. Meant for MIDI drivers which know when the
+             * channel pressure event actually arrived (e.g. by a time stamp
+             * of the kernel), or which deliberately delay events by a
+             * constant latency to avoid timing jitter.
+             *
+             * @param TimeOffset - time of the event relative to now
+             */
+            void DispatchChannelPressure(uint8_t Value, uint MidiChannel, const midi_time_offset_t& TimeOffset);
+
             /**
              * Should be called by the implementing MIDI input device whenever
              * a channel pressure event arrived (a.k.a. aftertouch), this will
@@ -351,6 +406,17 @@ namespace LinuxSampler {
              */
             void DispatchPolyphonicKeyPressure(uint8_t Key, uint8_t Value, uint MidiChannel);
 
+            /**
+             * Same as above, but the event is processed at the given time
+             * offset from now. Meant for MIDI drivers which know when the
+             * polyphonic key pressure event actually arrived (e.g. by a time stamp
+             * of the kernel), or which deliberately delay events by a
+             * constant latency to avoid timing jitter.
+             *
+             * @param TimeOffset - time of the event relative to now
+             */
+            void DispatchPolyphonicKeyPressure(uint8_t Key, uint8_t Value, uint MidiChannel, const midi_time_offset_t& TimeOffset);
+
             /**
              * Should be called by the implementing MIDI input device whenever
              * a polyphonic key pressure event arrived (a.k.a. polyphonic
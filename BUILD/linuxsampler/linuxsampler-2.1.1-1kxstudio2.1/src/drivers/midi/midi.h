@@ -64,6 +64,19 @@ namespace LinuxSampler {
         }
     };
 
+    /**
+     * Time of a MIDI event relative to the moment it is dispatched to the
+     * sampler engines (in microseconds). Negative values refer to an event
+     * which actually occurred earlier (e.g. one which was time stamped by
+     * the kernel while the MIDI input thread was not yet scheduled),
+     * positive values delay the event.
+     */
+    struct midi_time_offset_t {
+        int32_t us;
+
+        explicit midi_time_offset_t(int32_t us) : us(us) {}
+    };
+
     inline bool isValidMidiChan(const midi_chan_t& ch) {
         return ch >= 0 && ch <= midi_chan_all;
     }
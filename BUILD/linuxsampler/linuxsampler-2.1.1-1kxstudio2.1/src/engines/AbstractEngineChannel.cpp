@@ -373,12 +373,23 @@ namespace LinuxSampler {
      *  @param Velocity - MIDI velocity value of the triggered key
      */
     void AbstractEngineChannel::SendNoteOn(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel) {
+        SendNoteOn(Key, Velocity, MidiChannel, midi_time_offset_t(0));
+    }
+
+    /**
+     *  Same as above, but the event is processed at the given time offset
+     *  from now, e.g. at the time the event was actually received by the
+     *  MIDI driver.
+     *
+     *  @param TimeOffset - time of the event relative to now
+     */
+    void AbstractEngineChannel::SendNoteOn(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) {
         if (pEngine) {
             // protection in case there are more than 1 MIDI input threads sending MIDI events to this EngineChannel
             LockGuard g;
             if (hasMultipleMIDIInputs()) g = LockGuard(MidiInputMutex);
 
-            Event event               = pEngine->pEventGenerator->CreateEvent();
+            Event event               = pEngine->pEventGenerator->CreateEvent(TimeOffset);
             event.Type                = Event::type_note_on;
             event.Param.Note.Key      = Key;
             event.Param.Note.Velocity = Velocity;
@@ -450,12 +461,23 @@ namespace LinuxSampler {
      *  @param Velocity - MIDI release velocity value of the released key
      */
     void AbstractEngineChannel::SendNoteOff(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel) {
+        SendNoteOff(Key, Velocity, MidiChannel, midi_time_offset_t(0));
+    }
+
+    /**
+     *  Same as above, but the event is processed at the given time offset
+     *  from now, e.g. at the time the event was actually received by the
+     *  MIDI driver.
+     *
+     *  @param TimeOffset - time of the event relative to now
+     */
+    void AbstractEngineChannel::SendNoteOff(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) {
         if (pEngine) {
             // protection in case there are more than 1 MIDI input threads sending MIDI events to this EngineChannel
             LockGuard g;
             if (hasMultipleMIDIInputs()) g = LockGuard(MidiInputMutex);
 
-            Event event               = pEngine->pEventGenerator->CreateEvent();
+            Event event               = pEngine->pEventGenerator->CreateEvent(TimeOffset);
             event.Type                = Event::type_note_off;
             event.Param.Note.Key      = Key;
             event.Param.Note.Velocity = Velocity;
@@ -526,12 +548,23 @@ namespace LinuxSampler {
      *  @param Pitch - MIDI pitch value (-8192 ... +8191)
      */
     void AbstractEngineChannel::SendPitchbend(int Pitch, uint8_t MidiChannel) {
+        SendPitchbend(Pitch, MidiChannel, midi_time_offset_t(0));
+    }
+
+    /**
+     *  Same as above, but the event is processed at the given time offset
+     *  from now, e.g. at the time the event was actually received by the
+     *  MIDI driver.
+     *
+     *  @param TimeOffset - time of the event relative to now
+     */
+    void AbstractEngineChannel::SendPitchbend(int Pitch, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) {
         if (pEngine) {
             // protection in case there are more than 1 MIDI input threads sending MIDI events to this EngineChannel
             LockGuard g;
             if (hasMultipleMIDIInputs()) g = LockGuard(MidiInputMutex);
 
-            Event event             = pEngine->pEventGenerator->CreateEvent();
+            Event event             = pEngine->pEventGenerator->CreateEvent(TimeOffset);
             event.Type              = Event::type_pitchbend;
             event.Param.Pitch.Pitch = Pitch;
             event.Param.Pitch.Channel = MidiChannel;
@@ -580,12 +613,23 @@ namespace LinuxSampler {
      *  @param Value      - value of the control change
      */
     void AbstractEngineChannel::SendControlChange(uint8_t Controller, uint8_t Value, uint8_t MidiChannel) {
+        SendControlChange(Controller, Value, MidiChannel, midi_time_offset_t(0));
+    }
+
+    /**
+     *  Same as above, but the event is processed at the given time offset
+     *  from now, e.g. at the time the event was actually received by the
+     *  MIDI driver.
+     *
+     *  @param TimeOffset - time of the event relative to now
+     */
+    void AbstractEngineChannel::SendControlChange(uint8_t Controller, uint8_t Value, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) {
         if (pEngine) {
             // protection in case there are more than 1 MIDI input threads sending MIDI events to this EngineChannel
             LockGuard g;
             if (hasMultipleMIDIInputs()) g = LockGuard(MidiInputMutex);
 
-            Event event               = pEngine->pEventGenerator->CreateEvent();
+            Event event               = pEngine->pEventGenerator->CreateEvent(TimeOffset);
             event.Type                = Event::type_control_change;
             event.Param.CC.Controller = Controller;
             event.Param.CC.Value      = Value;
@@ -628,12 +672,23 @@ namespace LinuxSampler {
     }
 
     void AbstractEngineChannel::SendChannelPressure(uint8_t Value, uint8_t MidiChannel) {
+        SendChannelPressure(Value, MidiChannel, midi_time_offset_t(0));
+    }
+
+    /**
+     *  Same as above, but the event is processed at the given time offset
+     *  from now, e.g. at the time the event was actually received by the
+     *  MIDI driver.
+     *
+     *  @param TimeOffset - time of the event relative to now
+     */
+    void AbstractEngineChannel::SendChannelPressure(uint8_t Value, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) {
         if (pEngine) {
             // protection in case there are more than 1 MIDI input threads sending MIDI events to this EngineChannel
             LockGuard g;
             if (hasMultipleMIDIInputs()) g = LockGuard(MidiInputMutex);
 
-            Event event = pEngine->pEventGenerator->CreateEvent();
+            Event event = pEngine->pEventGenerator->CreateEvent(TimeOffset);
             event.Type                          = Event::type_channel_pressure;
             event.Param.ChannelPressure.Controller = CTRL_TABLE_IDX_AFTERTOUCH; // required for instrument scripts
             event.Param.ChannelPressure.Value   = Value;
@@ -662,12 +717,23 @@ namespace LinuxSampler {
     }
 
     void AbstractEngineChannel::SendPolyphonicKeyPressure(uint8_t Key, uint8_t Value, uint8_t MidiChannel) {
+        SendPolyphonicKeyPressure(Key, Value, MidiChannel, midi_time_offset_t(0));
+    }
+
+    /**
+     *  Same as above, but the event is processed at the given time offset
+     *  from now, e.g. at the time the event was actually received by the
+     *  MIDI driver.
+     *
+     *  @param TimeOffset - time of the event relative to now
+     */
+    void AbstractEngineChannel::SendPolyphonicKeyPressure(uint8_t Key, uint8_t Value, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) {
         if (pEngine) {
             // protection in case there are more than 1 MIDI input threads sending MIDI events to this EngineChannel
             LockGuard g;
             if (hasMultipleMIDIInputs()) g = LockGuard(MidiInputMutex);
 
-            Event event = pEngine->pEventGenerator->CreateEvent();
+            Event event = pEngine->pEventGenerator->CreateEvent(TimeOffset);
             event.Type                       = Event::type_note_pressure;
             event.Param.NotePressure.Key     = Key;
             event.Param.NotePressure.Value   = Value;
@@ -49,16 +49,22 @@ namespace LinuxSampler {
             virtual void    PrepareLoadInstrument(const char* FileName, uint Instrument) OVERRIDE;
             virtual void    Reset() OVERRIDE;
             virtual void    SendNoteOn(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel) OVERRIDE;
+            virtual void    SendNoteOn(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) OVERRIDE;
             virtual void    SendNoteOn(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel, int32_t FragmentPos) OVERRIDE;
             virtual void    SendNoteOff(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel) OVERRIDE;
+            virtual void    SendNoteOff(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) OVERRIDE;
             virtual void    SendNoteOff(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel, int32_t FragmentPos) OVERRIDE;
             virtual void    SendPitchbend(int Pitch, uint8_t MidiChannel) OVERRIDE;
+            virtual void    SendPitchbend(int Pitch, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) OVERRIDE;
             virtual void    SendPitchbend(int Pitch, uint8_t MidiChannel, int32_t FragmentPos) OVERRIDE;
             virtual void    SendControlChange(uint8_t Controller, uint8_t Value, uint8_t MidiChannel) OVERRIDE;
+            virtual void    SendControlChange(uint8_t Controller, uint8_t Value, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) OVERRIDE;
             virtual void    SendControlChange(uint8_t Controller, uint8_t Value, uint8_t MidiChannel, int32_t FragmentPos) OVERRIDE;            
             virtual void    SendChannelPressure(uint8_t Value, uint8_t MidiChannel) OVERRIDE;
+            virtual void    SendChannelPressure(uint8_t Value, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) OVERRIDE;
             virtual void    SendChannelPressure(uint8_t Value, uint8_t MidiChannel, int32_t FragmentPos) OVERRIDE;
             virtual void    SendPolyphonicKeyPressure(uint8_t Key, uint8_t Value, uint8_t MidiChannel) OVERRIDE;
+            virtual void    SendPolyphonicKeyPressure(uint8_t Key, uint8_t Value, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) OVERRIDE;
             virtual void    SendPolyphonicKeyPressure(uint8_t Key, uint8_t Value, uint8_t MidiChannel, int32_t FragmentPos) OVERRIDE;
             virtual bool    StatusChanged(bool bNewStatus = false) OVERRIDE;
             virtual float   Volume() OVERRIDE;
@@ -61,6 +61,13 @@ namespace LinuxSampler {
             virtual void   SetMaxDiskStreams(int iStreams) throw (Exception) = 0;
             virtual String DiskStreamBufferFillBytes() = 0;
             virtual String DiskStreamBufferFillPercentage() = 0;
+            virtual uint   DiskStreamUnderruns() = 0;
+            virtual uint   DiskStreamQueueDepth() = 0;
+            virtual uint   DiskStreamQueueDepthMax() = 0;
+            virtual uint   DiskStreamReaderThreads() = 0;
+            virtual int64_t DiskStreamPreloadBytes() = 0;
+            virtual int64_t DiskStreamPreloadBudget() = 0;
+            virtual float  DiskStreamLatency() = 0;
             virtual String Description() = 0;
             virtual String Version() = 0;
             virtual String EngineName() = 0;
@@ -32,11 +32,17 @@
 #include "common/MidiKeyboardManager.h"
 #include "InstrumentManager.h"
 #include "../common/global_private.h"
+#include "../common/RTThreadPool.h"
 
 // a bit headroom over CONFIG_MAX_VOICES to avoid minor complications i.e. under voice stealing conditions
 #define MAX_NOTES_HEADROOM  3
 #define GLOBAL_MAX_NOTES    (GLOBAL_MAX_VOICES * MAX_NOTES_HEADROOM)
 
+// maximum amount of engine channels / key ranges rendered in parallel, any further ones are rendered by the audio thread
+#define MAX_RENDER_JOBS     32
+// minimum amount of active keys per job when splitting an engine channel into several jobs
+#define MIN_RENDER_JOB_KEYS 4
+
 namespace LinuxSampler {
 
     class AbstractEngineChannel;
@@ -68,6 +74,12 @@ namespace LinuxSampler {
                 pVoiceStealingQueue  = new RTList<Event>(pEventPool);
                 iMaxDiskStreams      = GLOBAL_MAX_STREAMS;
 
+                // worker threads for rendering the engine channels in parallel
+                pRenderThreadPool = (GLOBAL_RENDER_THREADS > 0) ? new RTThreadPool(GLOBAL_RENDER_THREADS) : NULL;
+                pRenderJobs       = new RenderJob[MAX_RENDER_JOBS];
+                ppRenderJobs      = new Runnable*[MAX_RENDER_JOBS];
+                for (int i = 0; i < MAX_RENDER_JOBS; i++) ppRenderJobs[i] = &pRenderJobs[i];
+
                 // init all Voice objects in voice pool
                 for (VoiceIterator iterVoice = pVoicePool->allocAppend();
                      iterVoice; iterVoice = pVoicePool->allocAppend())
@@ -109,6 +121,14 @@ namespace LinuxSampler {
 
                 if (pVoiceStealingQueue) delete pVoiceStealingQueue;
 
+                if (pRenderThreadPool) delete pRenderThreadPool;
+                for (int i = 0; i < MAX_RENDER_JOBS; i++) {
+                    if (pRenderJobs[i].pLeft)  delete pRenderJobs[i].pLeft;
+                    if (pRenderJobs[i].pRight) delete pRenderJobs[i].pRight;
+                }
+                delete[] pRenderJobs;
+                delete[] ppRenderJobs;
+
                 if (pRegionPool[0]) delete pRegionPool[0];
                 if (pRegionPool[1]) delete pRegionPool[1];
                 ResetSuspendedRegions();
@@ -183,8 +203,12 @@ namespace LinuxSampler {
                 }
 
                 // render all 'normal', active voices on all engine channels
-                for (int i = 0; i < engineChannels.size(); i++) {
-                    RenderActiveVoices(engineChannels[i], Samples);
+                if (pRenderThreadPool) {
+                    RenderActiveVoicesParallel(Samples);
+                } else {
+                    for (int i = 0; i < engineChannels.size(); i++) {
+                        RenderActiveVoices(engineChannels[i], Samples);
+                    }
                 }
 
                 // now that all ordinary voices on ALL engine channels are rendered, render new stolen voices
@@ -328,6 +352,13 @@ namespace LinuxSampler {
 
             virtual String DiskStreamBufferFillBytes() OVERRIDE { return (pDiskThread) ? pDiskThread->GetBufferFillBytes() : ""; }
             virtual String DiskStreamBufferFillPercentage() OVERRIDE { return (pDiskThread) ? pDiskThread->GetBufferFillPercentage() : ""; }
+            virtual uint DiskStreamUnderruns() OVERRIDE { return (pDiskThread) ? pDiskThread->GetUnderrunCount() : 0; }
+            virtual uint DiskStreamQueueDepth() OVERRIDE { return (pDiskThread) ? pDiskThread->GetQueueDepth() : 0; }
+            virtual uint DiskStreamQueueDepthMax() OVERRIDE { return (pDiskThread) ? pDiskThread->GetQueueDepthMax() : 0; }
+            virtual uint DiskStreamReaderThreads() OVERRIDE { return (pDiskThread) ? pDiskThread->GetReaderThreadCount() : 0; }
+            virtual int64_t DiskStreamPreloadBytes() OVERRIDE { return SamplePreload::GetPreloadedBytes(); }
+            virtual int64_t DiskStreamPreloadBudget() OVERRIDE { return SamplePreload::GetBudget(); }
+            virtual float DiskStreamLatency() OVERRIDE { return SamplePreload::GetStreamingLatency(); }
             virtual InstrumentManager* GetInstrumentManager() OVERRIDE { return &instruments; }
 
             /**
@@ -425,6 +456,16 @@ namespace LinuxSampler {
                 if (pDedicatedVoiceChannelRight) delete pDedicatedVoiceChannelRight;
                 pDedicatedVoiceChannelLeft  = new AudioChannel(0, MaxSamplesPerCycle);
                 pDedicatedVoiceChannelRight = new AudioChannel(1, MaxSamplesPerCycle);
+
+                // (re)create the private buffers of the parallel render jobs
+                if (pRenderThreadPool) {
+                    for (int i = 0; i < MAX_RENDER_JOBS; i++) {
+                        if (pRenderJobs[i].pLeft)  delete pRenderJobs[i].pLeft;
+                        if (pRenderJobs[i].pRight) delete pRenderJobs[i].pRight;
+                        pRenderJobs[i].pLeft  = new AudioChannel(0, MaxSamplesPerCycle);
+                        pRenderJobs[i].pRight = new AudioChannel(1, MaxSamplesPerCycle);
+                    }
+                }
             }
         
             // Implementattion for abstract method derived from Engine.
@@ -672,6 +713,30 @@ namespace LinuxSampler {
             NoteIterator                 itLastStolenNoteGlobally; ///< Same as itLastStolenNote, but engine globally
             RTList<uint>::Iterator       iuiLastStolenKeyGlobally;  ///< Same as iuiLastStolenKey, but engine globally
             RTList<Event>*               pVoiceStealingQueue;   ///< All voice-launching events which had to be postponed due to free voice shortage.
+
+            /**
+             * Renders a range of active keys of an engine channel into the
+             * job's own buffers (see RenderActiveVoicesParallel()).
+             */
+            class RenderJob : public Runnable {
+                public:
+                    EngineChannelBase<V, R, I>* pChannel;
+                    uint          Samples;
+                    int           FirstKey;
+                    int           Keys;
+                    AudioChannel* pLeft;
+                    AudioChannel* pRight;
+
+                    RenderJob() : pChannel(NULL), Samples(0), FirstKey(0), Keys(0), pLeft(NULL), pRight(NULL) { }
+
+                    virtual void Run() OVERRIDE {
+                        pChannel->RenderActiveVoices(Samples, FirstKey, Keys, pLeft, pRight);
+                    }
+            };
+
+            RTThreadPool*                pRenderThreadPool;     ///< Worker threads for rendering the engine channels in parallel (NULL if all voices are rendered by the audio thread).
+            RenderJob*                   pRenderJobs;           ///< Jobs of the parallel render phase, each one with its own pair of audio buffers.
+            Runnable**                   ppRenderJobs;          ///< Pointers to the elements of pRenderJobs, as passed to the thread pool.
             Mutex                        ResetInternalMutex;    ///< Mutex to protect the ResetInternal function for concurrent usage (e.g. by the lscp and instrument loader threads).
             int iMaxDiskStreams;
 
@@ -1385,6 +1450,74 @@ namespace LinuxSampler {
                 ActiveVoiceCountTemp += pEngineChannel->GetVoiceCount();
             }
 
+            /**
+             * Render all 'normal' voices on all engine channels like
+             * RenderActiveVoices(), but in parallel on the worker threads of
+             * the render thread pool. Each engine channel, or each range of
+             * active keys of an engine channel with many active keys, is
+             * rendered into its own pair of buffers, which are then mixed in a
+             * fixed order into the engine channels' buffers by this thread.
+             * Voices which finished are freed by this thread afterwards.
+             *
+             * Engine channels with FX sends and key specific effect send
+             * levels are rendered by this thread before the parallel phase,
+             * because such voices are routed through the engine's dedicated
+             * voice buffers.
+             *
+             * @param Samples - amount of sample points to be rendered in
+             *                  this audio fragment cycle
+             */
+            void RenderActiveVoicesParallel(uint Samples) {
+                const int maxParts = pRenderThreadPool->GetThreadCount() + 1;
+                int jobs = 0;
+
+                for (int i = 0; i < engineChannels.size(); i++) {
+                    EngineChannelBase<V, R, I>* pChannel =
+                        static_cast<EngineChannelBase<V, R, I>*>(engineChannels[i]);
+                    #if !CONFIG_PROCESS_MUTED_CHANNELS
+                    if (pChannel->GetMute()) continue; // skip if sampler channel is muted
+                    #endif
+
+                    const int keys = pChannel->GetActiveKeyCount();
+                    int parts = keys / MIN_RENDER_JOB_KEYS;
+                    if (parts < 1) parts = 1;
+                    if (parts > maxParts) parts = maxParts;
+                    if (parts > MAX_RENDER_JOBS - jobs) parts = MAX_RENDER_JOBS - jobs;
+
+                    if (!keys || !parts ||
+                        (pChannel->GetFxSendCount() > 0 && pChannel->HasKeyEffectSends()))
+                    {
+                        RenderActiveVoices(pChannel, Samples);
+                        continue;
+                    }
+
+                    // split the active keys of this channel into 'parts' jobs
+                    for (int p = 0; p < parts; p++) {
+                        RenderJob& job = pRenderJobs[jobs++];
+                        job.pChannel = pChannel;
+                        job.Samples  = Samples;
+                        job.FirstKey = keys * p / parts;
+                        job.Keys     = keys * (p + 1) / parts - job.FirstKey;
+                    }
+                }
+
+                pRenderThreadPool->Run(ppRenderJobs, jobs);
+
+                for (int j = 0; j < jobs; j++) {
+                    RenderJob& job = pRenderJobs[j];
+                    job.pLeft->MixTo(job.pChannel->pChannelLeft, Samples);
+                    job.pRight->MixTo(job.pChannel->pChannelRight, Samples);
+                    job.pLeft->Clear(Samples);
+                    job.pRight->Clear(Samples);
+
+                    // all jobs of this channel done, free its finished voices
+                    if (j + 1 == jobs || pRenderJobs[j + 1].pChannel != job.pChannel) {
+                        job.pChannel->FinishRenderedVoices();
+                        ActiveVoiceCountTemp += job.pChannel->GetVoiceCount();
+                    }
+                }
+            }
+
             /**
              * Render all stolen voices (only voices which were stolen in this
              * fragment) on the given engine channel. Stolen voices are rendered
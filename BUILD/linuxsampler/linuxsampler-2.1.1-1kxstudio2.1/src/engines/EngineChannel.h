@@ -61,17 +61,23 @@ namespace LinuxSampler {
             // general sampler part management
             virtual void    Reset() = 0;
             virtual void    SendNoteOn(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel) = 0;
+            virtual void    SendNoteOn(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) = 0;
             virtual void    SendNoteOn(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel, int32_t FragmentPos) = 0;
             virtual void    SendNoteOff(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel) = 0;
+            virtual void    SendNoteOff(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) = 0;
             virtual void    SendNoteOff(uint8_t Key, uint8_t Velocity, uint8_t MidiChannel, int32_t FragmentPos) = 0;
             virtual void    SendPitchbend(int Pitch, uint8_t MidiChannel) = 0;
+            virtual void    SendPitchbend(int Pitch, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) = 0;
             virtual void    SendPitchbend(int Pitch, uint8_t MidiChannel, int32_t FragmentPos) = 0;
             virtual void    SendControlChange(uint8_t Controller, uint8_t Value, uint8_t MidiChannel) = 0;
+            virtual void    SendControlChange(uint8_t Controller, uint8_t Value, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) = 0;
             virtual void    SendControlChange(uint8_t Controller, uint8_t Value, uint8_t MidiChannel, int32_t FragmentPos) = 0;
             virtual void    SendProgramChange(uint8_t Program) = 0;
             virtual void    SendChannelPressure(uint8_t Value, uint8_t MidiChannel) = 0;
+            virtual void    SendChannelPressure(uint8_t Value, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) = 0;
             virtual void    SendChannelPressure(uint8_t Value, uint8_t MidiChannel, int32_t FragmentPos) = 0;
             virtual void    SendPolyphonicKeyPressure(uint8_t Key, uint8_t Value, uint8_t MidiChannel) = 0;
+            virtual void    SendPolyphonicKeyPressure(uint8_t Key, uint8_t Value, uint8_t MidiChannel, const midi_time_offset_t& TimeOffset) = 0;
             virtual void    SendPolyphonicKeyPressure(uint8_t Key, uint8_t Value, uint8_t MidiChannel, int32_t FragmentPos) = 0;
             virtual bool    StatusChanged(bool bNewStatus = false) = 0;
             virtual float   Volume() = 0;
@@ -327,6 +327,57 @@ namespace LinuxSampler {
                 SetDiskStreamCount(handler.StreamCount);
             }
 
+            /**
+             * Renders the voices on the given range of active keys into the
+             * given buffers instead of this channel's buffers. This is used by
+             * the engine's parallel render phase and may be called by a worker
+             * thread, so voices which finished are not freed here, see
+             * FinishRenderedVoices().
+             *
+             * @param Samples  - amount of sample points to be rendered
+             * @param FirstKey - position of the first key in the list of
+             *                   active keys
+             * @param Keys     - amount of active keys to be rendered
+             * @param pLeft    - left output buffer
+             * @param pRight   - right output buffer
+             */
+            void RenderActiveVoices(uint Samples, int FirstKey, int Keys, AudioChannel* pLeft, AudioChannel* pRight) {
+                RenderKeyRangeHandler handler(Samples, FirstKey, Keys, pLeft, pRight);
+                this->ProcessActiveVoices(&handler);
+            }
+
+            /**
+             * Frees the voices which finished in the parallel render phase and
+             * updates the voice and disk stream statistics of this channel.
+             * Must be called by the audio thread after all key ranges of this
+             * channel were rendered.
+             */
+            void FinishRenderedVoices() {
+                FinishVoicesHandler handler(this);
+                this->ProcessActiveVoices(&handler);
+
+                SetVoiceCount(handler.VoiceCount);
+                SetDiskStreamCount(handler.StreamCount);
+            }
+
+            /// Amount of keys which currently have active voices.
+            int GetActiveKeyCount() {
+                return this->pActiveKeys->count();
+            }
+
+            /**
+             * Returns true if any key has an individual reverb or chorus send
+             * level, in which case the voices of that key are routed through
+             * the engine's dedicated voice buffers.
+             */
+            bool HasKeyEffectSends() {
+                for (int i = 0; i < 128; i++) {
+                    if (this->pMIDIKeyInfo[i].ReverbSend || this->pMIDIKeyInfo[i].ChorusSend)
+                        return true;
+                }
+                return false;
+            }
+
             /**
              * Called by real-time instrument script functions to schedule a
              * new note (new note-on event and a new @c Note object linked to it)
@@ -504,6 +555,59 @@ namespace LinuxSampler {
                     }
             };
 
+            class RenderKeyRangeHandler : public MidiKeyboardManager<V>::VoiceHandlerBase {
+                public:
+                    uint Samples;
+                    int  FirstKey;
+                    int  Keys;
+                    int  Key;
+                    AudioChannel* pLeft;
+                    AudioChannel* pRight;
+
+                    RenderKeyRangeHandler(uint samples, int firstKey, int keys, AudioChannel* left, AudioChannel* right) :
+                        Samples(samples), FirstKey(firstKey), Keys(keys), Key(0), pLeft(left), pRight(right) { }
+
+                    virtual bool Process(MidiKey* pMidiKey) {
+                        const int key = Key++;
+                        return key >= FirstKey && key < FirstKey + Keys;
+                    }
+
+                    virtual void Process(RTListVoiceIterator& itVoice) {
+                        itVoice->pRenderChannelLeft  = pLeft;
+                        itVoice->pRenderChannelRight = pRight;
+                        itVoice->Render(Samples);
+                        itVoice->pRenderChannelLeft  = NULL;
+                        itVoice->pRenderChannelRight = NULL;
+                    }
+            };
+
+            class FinishVoicesHandler : public MidiKeyboardManager<V>::VoiceHandlerBase {
+                public:
+                    uint VoiceCount;
+                    uint StreamCount;
+                    EngineChannelBase<V, R, I>* pChannel;
+
+                    FinishVoicesHandler(EngineChannelBase<V, R, I>* channel) :
+                        VoiceCount(0), StreamCount(0), pChannel(channel) { }
+
+                    virtual void Process(RTListVoiceIterator& itVoice) {
+                        if (itVoice->IsActive()) { // still active
+                            if (!itVoice->Orphan) {
+                                *(pChannel->pRegionsInUse->allocAppend()) = itVoice->GetRegion();
+                            }
+                            VoiceCount++;
+
+                            if (itVoice->PlaybackState == Voice::playback_state_disk) {
+                                if ((itVoice->DiskStreamRef).State != Stream::state_unused) StreamCount++;
+                            }
+                        }  else { // voice reached end, is now inactive
+                            itVoice->KillImmediately(); // order deletion of its disk stream
+                            itVoice->VoiceFreed();
+                            pChannel->FreeVoice(itVoice); // remove voice from the list of active voices
+                        }
+                    }
+            };
+
             typedef typename SynchronizedConfig<InstrumentChangeCmd<R, I> >::Reader SyncConfInstrChangeCmdReader;
 
             SynchronizedConfig<InstrumentChangeCmd<R, I> > InstrumentChangeCommand;
@@ -39,6 +39,19 @@ namespace LinuxSampler {
         thread.StartNewLoad(ID.FileName, ID.Index, pEngineChannel);
     }
 
+    int InstrumentManager::StartBackgroundLoad(InstrumentManager::instrument_id_t ID, EngineChannel* pEngineChannel) {
+        LockGuard lock(loaderMutex);
+        return thread.StartNewLoad(ID.FileName, ID.Index, pEngineChannel, true);
+    }
+
+    bool InstrumentManager::BackgroundLoadFinished(int LoadID, String& Error) {
+        return thread.LoadFinished(LoadID, Error);
+    }
+
+    void InstrumentManager::ForgetBackgroundLoad(int LoadID) {
+        thread.ForgetLoad(LoadID);
+    }
+
     void InstrumentManager::SetModeInBackground(const instrument_id_t& ID, mode_t Mode) {
         LockGuard lock(loaderMutex);
         thread.StartSettingMode(this, ID, Mode);
@@ -129,6 +129,36 @@ namespace LinuxSampler {
              */
             static void LoadInstrumentInBackground(instrument_id_t ID, EngineChannel* pEngineChannel);
 
+            /**
+             * Same as LoadInstrumentInBackground(), but the outcome of the
+             * load can be queried with BackgroundLoadFinished().
+             *
+             * @param ID - the instrument to be loaded
+             * @param pEngineChannel - on which engine channel the instrument
+             *                         should be loaded
+             * @returns ID of the background load
+             */
+            static int StartBackgroundLoad(instrument_id_t ID, EngineChannel* pEngineChannel);
+
+            /**
+             * Checks whether the given background load, started by
+             * StartBackgroundLoad(), is finished. Once this method returned
+             * true, the load is forgotten.
+             *
+             * @param LoadID - ID returned by StartBackgroundLoad()
+             * @param Error - output: error message if the load failed, empty
+             *                string on success
+             * @returns true if the load is finished
+             */
+            static bool BackgroundLoadFinished(int LoadID, String& Error);
+
+            /**
+             * Forgets about the given background load, i.e. if the caller
+             * won't call BackgroundLoadFinished() for it anymore. The load
+             * itself is not cancelled.
+             */
+            static void ForgetBackgroundLoad(int LoadID);
+
             /**
              * Stops the background thread that has been started by
              * LoadInstrumentInBackground.
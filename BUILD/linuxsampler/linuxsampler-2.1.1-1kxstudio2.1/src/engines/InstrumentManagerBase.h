@@ -30,6 +30,7 @@
 #include "../drivers/audio/AudioOutputDeviceFactory.h"
 #include "AbstractEngine.h"
 #include "AbstractEngineChannel.h"
+#include "common/SamplePreload.h"
 
 // We need to know the maximum number of sample points which are going to
 // be processed for each render cycle of the audio output driver, to know
@@ -132,6 +133,9 @@ namespace LinuxSampler {
                 InstrumentManager::instrument_id_t ID;
                 F*                                 pFile;
                 uint                               MaxSamplesPerCycle; ///< if some engine requests an already allocated instrument with a higher value, we have to reallocate the instrument
+                int64_t                            PreloadedBytes;     ///< RAM newly allocated for caching the samples of this instrument
+
+                instr_entry_t() : pFile(NULL), MaxSamplesPerCycle(0), PreloadedBytes(0) { }
             };
 
 
@@ -175,6 +179,40 @@ namespace LinuxSampler {
             std::map< R*, region_info_t> RegionInfo; ///< contains dimension regions that are still in use but belong to released instrument
             std::map< S*, int> SampleRefCount; ///< contains samples that are still in use but belong to a released instrument
 
+            /**
+             * Held by Create() of the implementing instrument managers for
+             * the file of the instrument. Different instruments may be
+             * created concurrently (see ResourceManager::Borrow()), but the
+             * file objects of the instrument libraries are not thread safe,
+             * so instruments of the same file are still created one after
+             * another.
+             */
+            class FileGuard {
+                public:
+                    FileGuard(InstrumentManagerBase* pManager, const String& FileName) : pManager(pManager), FileName(FileName) {
+                        Condition& cond = pManager->BusyFilesCondition;
+                        cond.Lock();
+                        while (pManager->BusyFiles.count(FileName))
+                            cond.PreLockedWaitIf(cond.GetUnsafe());
+                        pManager->BusyFiles.insert(FileName);
+                        cond.Unlock();
+                    }
+
+                    ~FileGuard() {
+                        Condition& cond = pManager->BusyFilesCondition;
+                        cond.Lock();
+                        pManager->BusyFiles.erase(FileName);
+                        cond.PreLockedSet(!cond.GetUnsafe()); // wake up the waiting guards
+                        cond.Unlock();
+                    }
+                private:
+                    InstrumentManagerBase* pManager;
+                    String FileName;
+            };
+
+            Condition BusyFilesCondition; ///< protects BusyFiles, toggled whenever a file is released
+            std::set<String> BusyFiles; ///< files currently held by a FileGuard
+
             virtual void DeleteRegionIfNotUsed(R* pRegion, region_info_t* pRegInfo) = 0;
             virtual void DeleteSampleIfNotUsed(S* pSample, region_info_t* pRegInfo) = 0;
 
@@ -189,22 +227,33 @@ namespace LinuxSampler {
             }
 
             /**
-             *  Caches a certain size at the beginning of the given sample in RAM. If the
-             *  sample is very short, the whole sample will be loaded into RAM and thus
-             *  no disk streaming is needed for this sample. Caching an initial part of
-             *  samples is needed to compensate disk reading latency.
+             *  Caches the given amount of sample points at the beginning of the given
+             *  sample in RAM (see SamplePreload). If that covers the whole sample, it
+             *  is cached completely, followed by silence, so that no disk streaming is
+             *  needed for it. Samples already cached are left alone, as voices might
+             *  currently be reading their cache.
              *
              *  @param pSample - points to the sample to be cached
              *  @param maxSamplesPerCycle - max samples per cycle
+             *  @param preloadFrames - amount of sample points to be cached
+             *  @returns amount of bytes newly allocated for the cache
              */
-            void CacheInitialSamples(S* pSample, uint maxSamplesPerCycle)  {
+            int64_t CacheInitialSamples(S* pSample, uint maxSamplesPerCycle, unsigned long preloadFrames)  {
                 if (!pSample) {
                     dmsg(4,("InstrumentManagerBase: Skipping sample (pSample == NULL)\n"));
-                    return;
+                    return 0;
                 }
-                if (!pSample->GetTotalFrameCount()) return; // skip zero size samples
+                if (!pSample->GetTotalFrameCount()) return 0; // skip zero size samples
+
+                const typename S::buffer_t cache = pSample->GetCache();
+                const int64_t cachedBytes = int64_t(cache.Size) + cache.NullExtensionSize;
+                // Another instrument may already have cached the beginning of
+                // the sample, with a smaller preload. Its voices may be reading
+                // that cache, so it is kept and the rest is streamed. Only a
+                // cache of the whole sample may be reallocated for more silence.
+                const bool bCachedWhole = (unsigned long) cache.Size >= (unsigned long) pSample->GetTotalFrameCount() * pSample->GetFrameSize();
 
-                if (pSample->GetTotalFrameCount() <= CONFIG_PRELOAD_SAMPLES) {
+                if ((unsigned long) pSample->GetTotalFrameCount() <= preloadFrames && (!cache.Size || bCachedWhole)) {
                     // Sample is too short for disk streaming, so we load the whole
                     // sample into RAM and place 'pAudioIO->FragmentSize << CONFIG_MAX_PITCH'
                     // number of '0' samples (silence samples) behind the official buffer
@@ -218,11 +267,14 @@ namespace LinuxSampler {
                         dmsg(4,("Cached %lu Bytes, %lu silence bytes.\n", buf.Size, buf.NullExtensionSize));
                     }
                 }
-                else { // we only cache CONFIG_PRELOAD_SAMPLES and stream the other sample points from disk
-                    if (!pSample->GetCache().Size) pSample->LoadSampleData(CONFIG_PRELOAD_SAMPLES);
+                else { // we only cache the beginning and stream the other sample points from disk
+                    if (!cache.Size) pSample->LoadSampleData(preloadFrames);
                 }
 
                 if (!pSample->GetCache().Size) std::cerr << "Unable to cache sample - maybe memory full!" << std::endl << std::flush;
+
+                const int64_t newBytes = int64_t(pSample->GetCache().Size) + pSample->GetCache().NullExtensionSize - cachedBytes;
+                return (newBytes > 0) ? newBytes : 0;
             }
 
             // implementation of derived abstract methods from 'InstrumentManager'
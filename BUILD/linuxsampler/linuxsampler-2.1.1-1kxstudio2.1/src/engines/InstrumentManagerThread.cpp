@@ -20,16 +20,25 @@
 
 #include "InstrumentManagerThread.h"
 
+#include <set>
+
 #include "../common/global_private.h"
+#include "../common/RTMath.h"
 #include "EngineChannelFactory.h"
 
 namespace LinuxSampler {
 
-    InstrumentManagerThread::InstrumentManagerThread() : Thread(true, false, 0, -4) {
+    InstrumentManagerThread::InstrumentManagerThread()
+        : Thread(true, false, 0, -4), lastLoadId(0), busySince(0), busyLoadTime(0), busyLoads(0)
+    {
         eventHandler.pThread = this;
     }
 
     InstrumentManagerThread::~InstrumentManagerThread() {
+        for (size_t i = 0; i < loaders.size(); ++i) {
+            loaders[i]->StopThread();
+            delete loaders[i];
+        }
         Thread::StopThread();
     }
 
@@ -43,8 +52,10 @@ namespace LinuxSampler {
      * @param Filename - file name of the instrument
      * @param uiInstrumentIndex - index of the instrument within the file
      * @param pEngineChannel - engine channel on which the instrument should be loaded
+     * @param bTrack - whether the outcome shall be available by LoadFinished()
+     * @returns ID of the load if @a bTrack is true, 0 otherwise
      */
-    void InstrumentManagerThread::StartNewLoad(String Filename, uint uiInstrumentIndex, EngineChannel* pEngineChannel) {
+    int InstrumentManagerThread::StartNewLoad(String Filename, uint uiInstrumentIndex, EngineChannel* pEngineChannel, bool bTrack) {
         dmsg(1,("Scheduling '%s' (Index=%d) to be loaded in background (if not loaded yet).\n",Filename.c_str(),uiInstrumentIndex));
 
         // the listener only needs to be registered once in the
@@ -58,14 +69,70 @@ namespace LinuxSampler {
         cmd.pEngineChannel = pEngineChannel;
         cmd.instrumentId.Index = uiInstrumentIndex;
         cmd.instrumentId.FileName = Filename;
+        cmd.loadId = 0;
+        cmd.queuedAt = RTMath::unsafeMicroSeconds(RTMath::real_clock);
 
         {
             LockGuard lock(mutex);
+            if (bTrack) {
+                if (++lastLoadId <= 0) lastLoadId = 1;
+                cmd.loadId = lastLoadId;
+                loadResults[cmd.loadId].bFinished = false;
+            }
+            if (queue.empty() && running.empty()) {
+                busySince    = cmd.queuedAt;
+                busyLoadTime = 0;
+                busyLoads    = 0;
+            }
             queue.push_back(cmd);
         }
 
-        StartThread(); // ensure thread is running
-        conditionJobsLeft.Set(true); // wake up thread
+        StartThreads(); // ensure threads are running
+        conditionJobsLeft.Set(true); // wake up threads
+        return cmd.loadId;
+    }
+
+    /**
+     * @brief Check whether a tracked load is finished.
+     *
+     * Once the load is reported as finished, it is forgotten.
+     *
+     * @param LoadID - ID returned by StartNewLoad()
+     * @param Error - output: error message if loading failed, empty string
+     *                otherwise
+     * @returns true if the load is finished (or unknown)
+     */
+    bool InstrumentManagerThread::LoadFinished(int LoadID, String& Error) {
+        LockGuard lock(mutex);
+        std::map<int,load_result_t>::iterator it = loadResults.find(LoadID);
+        if (it == loadResults.end()) {
+            Error = "Unknown instrument load";
+            return true;
+        }
+        if (!it->second.bFinished) return false;
+        Error = it->second.error;
+        loadResults.erase(it);
+        return true;
+    }
+
+    /**
+     * @brief Stop tracking the given load.
+     *
+     * The load itself is not cancelled, its outcome is just not recorded
+     * anymore.
+     */
+    void InstrumentManagerThread::ForgetLoad(int LoadID) {
+        LockGuard lock(mutex);
+        loadResults.erase(LoadID);
+    }
+
+    // records the outcome of a tracked load, caller must hold the mutex
+    void InstrumentManagerThread::FinishLoad(int LoadID, const String& Error) {
+        if (!LoadID) return;
+        std::map<int,load_result_t>::iterator it = loadResults.find(LoadID);
+        if (it == loadResults.end()) return; // forgotten meanwhile
+        it->second.bFinished = true;
+        it->second.error     = Error;
     }
 
     /**
@@ -86,14 +153,153 @@ namespace LinuxSampler {
         cmd.pManager     = pManager;
         cmd.instrumentId = ID;
         cmd.mode         = Mode;
+        cmd.pEngineChannel = NULL;
+        cmd.loadId       = 0;
+        cmd.queuedAt     = RTMath::unsafeMicroSeconds(RTMath::real_clock);
 
         {
             LockGuard lock(mutex);
             queue.push_back(cmd);
         }
 
-        StartThread(); // ensure thread is running
-        conditionJobsLeft.Set(true); // wake up thread
+        StartThreads(); // ensure threads are running
+        conditionJobsLeft.Set(true); // wake up threads
+    }
+
+    // starts this thread and the additional loader threads if not running yet
+    void InstrumentManagerThread::StartThreads() {
+        {
+            LockGuard lock(mutex);
+            if (loaders.empty())
+                for (int i = 0; i < GLOBAL_LOADER_THREADS; ++i)
+                    loaders.push_back(new LoaderThread(this));
+        }
+        StartThread();
+        for (size_t i = 0; i < loaders.size(); ++i)
+            loaders[i]->StartThread();
+    }
+
+    /**
+     * Takes the oldest command from the queue which may be executed now,
+     * that is which neither affects an engine channel nor an instrument
+     * file of a command currently executed or queued before. Caller must
+     * hold the mutex.
+     *
+     * @returns false if there is no such command (currently)
+     */
+    bool InstrumentManagerThread::NextCommand(command_t& cmd) {
+        std::set<EngineChannel*> busyChannels;
+        std::set<String> busyFiles;
+        for (std::list<command_t>::iterator it = running.begin(); it != running.end(); ++it) {
+            if (it->pEngineChannel) busyChannels.insert(it->pEngineChannel);
+            busyFiles.insert(it->instrumentId.FileName);
+        }
+        for (std::list<command_t>::iterator it = queue.begin(); it != queue.end(); ++it) {
+            const bool bBusy = (it->pEngineChannel && busyChannels.count(it->pEngineChannel)) ||
+                               busyFiles.count(it->instrumentId.FileName);
+            if (bBusy) {
+                // keep following commands behind this one
+                if (it->pEngineChannel) busyChannels.insert(it->pEngineChannel);
+                busyFiles.insert(it->instrumentId.FileName);
+                continue;
+            }
+            cmd = *it;
+            queue.erase(it);
+            running.push_back(cmd);
+            if (cmd.type == command_t::DIRECT_LOAD) {
+                EngineChannelFactory::SetDeleteEnabled(cmd.pEngineChannel, false);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    // executes the given command, the mutex must not be held by the caller
+    void InstrumentManagerThread::Execute(command_t& cmd) {
+        const uint64_t startedAt = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+        try {
+            switch (cmd.type) {
+                case command_t::DIRECT_LOAD:
+                    cmd.pEngineChannel->PrepareLoadInstrument(cmd.instrumentId.FileName.c_str(), cmd.instrumentId.Index);
+                    cmd.pEngineChannel->LoadInstrument();
+                    EngineChannelFactory::SetDeleteEnabled(cmd.pEngineChannel, true);
+                    if (cmd.loadId) {
+                        LockGuard lock(mutex);
+                        FinishLoad(cmd.loadId, "");
+                    }
+                    break;
+                case command_t::INSTR_MODE:
+                    cmd.pManager->SetMode(cmd.instrumentId, cmd.mode);
+                    break;
+                default:
+                    std::cerr << "InstrumentManagerThread: unknown command - BUG!\n" << std::flush;
+            }
+        } catch (Exception e) {
+            e.PrintMessage();
+            if (cmd.type == command_t::DIRECT_LOAD) {
+                EngineChannelFactory::SetDeleteEnabled(cmd.pEngineChannel, true);
+                LockGuard lock(mutex);
+                FinishLoad(cmd.loadId, e.Message());
+            }
+        } catch (...) {
+            std::cerr << "InstrumentManagerThread: some exception occured, could not finish task\n" << std::flush;
+            if (cmd.type == command_t::DIRECT_LOAD) {
+                EngineChannelFactory::SetDeleteEnabled(cmd.pEngineChannel, true);
+                LockGuard lock(mutex);
+                FinishLoad(cmd.loadId, "Unknown exception while loading instrument");
+            }
+        }
+        if (cmd.type != command_t::DIRECT_LOAD) return;
+
+        const uint64_t finishedAt = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+        dmsg(1,("InstrumentManagerThread: '%s' (Index=%d) done after %.3f s in queue and %.3f s loading\n",
+                cmd.instrumentId.FileName.c_str(), cmd.instrumentId.Index,
+                float(startedAt - cmd.queuedAt) / 1000000.f, float(finishedAt - startedAt) / 1000000.f));
+        LockGuard lock(mutex);
+        busyLoadTime += finishedAt - startedAt;
+        busyLoads++;
+    }
+
+    // executes commands until there is none left which may be executed now
+    void InstrumentManagerThread::ProcessCommands() {
+        while (true) {
+            command_t cmd;
+            {
+                LockGuard lock(mutex);
+                if (!NextCommand(cmd)) return;
+            }
+
+            Execute(cmd);
+
+            LockGuard lock(mutex);
+            for (std::list<command_t>::iterator it = running.begin(); it != running.end(); ++it) {
+                if (it->pEngineChannel == cmd.pEngineChannel && it->instrumentId == cmd.instrumentId) {
+                    running.erase(it);
+                    break;
+                }
+            }
+            if (queue.empty() && running.empty()) {
+                if (busyLoads) {
+                    const uint64_t now = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+                    dmsg(1,("InstrumentManagerThread: %d instrument(s) loaded in %.3f s (%.3f s loading time, %d threads)\n",
+                            busyLoads, float(now - busySince) / 1000000.f, float(busyLoadTime) / 1000000.f,
+                            int(loaders.size()) + 1));
+                }
+                busyLoads = 0;
+            } else if (!queue.empty()) {
+                // commands held back by this one may be executed now
+                conditionJobsLeft.Set(true);
+            }
+        }
+    }
+
+    // sleeps until new commands arrive (or running ones finished)
+    void InstrumentManagerThread::WaitForCommands() {
+        conditionJobsLeft.WaitIf(false);
+        // reset flag
+        conditionJobsLeft.Set(false);
+        // unlock condition object so it can be turned again by other thread
+        conditionJobsLeft.Unlock();
     }
 
     // Entry point for the task thread.
@@ -104,54 +310,29 @@ namespace LinuxSampler {
             TestCancel();
             #endif
 
-            while (true) {
-                command_t cmd;
+            ProcessCommands();
 
-                // grab a new command from the queue
-                {
-                    LockGuard lock(mutex);
-                    if (queue.empty()) break;
+            // nothing left to do, sleep until new jobs arrive
+            WaitForCommands();
+        }
+        return 0;
+    }
 
-                    cmd = queue.front();
-                    queue.pop_front();
+    InstrumentManagerThread::LoaderThread::LoaderThread(InstrumentManagerThread* pParent)
+        : Thread(true, false, 0, -4), pParent(pParent)
+    {
+    }
 
-                    if (cmd.type == command_t::DIRECT_LOAD) {
-                        EngineChannelFactory::SetDeleteEnabled(cmd.pEngineChannel, false);
-                    }
-                }
+    // Entry point for the additional loader threads.
+    int InstrumentManagerThread::LoaderThread::Main() {
+        while (true) {
 
-                try {
-                    switch (cmd.type) {
-                        case command_t::DIRECT_LOAD:
-                            cmd.pEngineChannel->PrepareLoadInstrument(cmd.instrumentId.FileName.c_str(), cmd.instrumentId.Index);
-                            cmd.pEngineChannel->LoadInstrument();
-                            EngineChannelFactory::SetDeleteEnabled(cmd.pEngineChannel, true);
-                            break;
-                        case command_t::INSTR_MODE:
-                            cmd.pManager->SetMode(cmd.instrumentId, cmd.mode);
-                            break;
-                        default:
-                            std::cerr << "InstrumentManagerThread: unknown command - BUG!\n" << std::flush;
-                    }
-                } catch (Exception e) {
-                    e.PrintMessage();
-                    if (cmd.type == command_t::DIRECT_LOAD) {
-                        EngineChannelFactory::SetDeleteEnabled(cmd.pEngineChannel, true);
-                    }
-                } catch (...) {
-                    std::cerr << "InstrumentManagerThread: some exception occured, could not finish task\n" << std::flush;
-                    if (cmd.type == command_t::DIRECT_LOAD) {
-                        EngineChannelFactory::SetDeleteEnabled(cmd.pEngineChannel, true);
-                    }
-                }
-            }
+            #if CONFIG_PTHREAD_TESTCANCEL
+            TestCancel();
+            #endif
 
-            // nothing left to do, sleep until new jobs arrive
-            conditionJobsLeft.WaitIf(false);
-            // reset flag
-            conditionJobsLeft.Set(false);
-            // unlock condition object so it can be turned again by other thread
-            conditionJobsLeft.Unlock();
+            pParent->ProcessCommands();
+            pParent->WaitForCommands();
         }
         return 0;
     }
@@ -166,6 +347,7 @@ namespace LinuxSampler {
         for (it = pThread->queue.begin(); it != pThread->queue.end();){
             if ((*it).type != command_t::DIRECT_LOAD) { ++it; continue; }
             if ((*it).pEngineChannel == pChannel->GetEngineChannel()) {
+                pThread->FinishLoad((*it).loadId, "Sampler channel removed");
                 it = pThread->queue.erase(it);
                 // we don't break here because the same engine channel could
                 // occur more than once in the queue, so don't make optimizations
@@ -175,22 +357,28 @@ namespace LinuxSampler {
         } 
     }
 
-#if defined(__APPLE__) && !defined(__x86_64__)
     int InstrumentManagerThread::StopThread() {
+        for (size_t i = 0; i < loaders.size(); ++i) {
+            #if defined(__APPLE__) && !defined(__x86_64__)
+            // see below
+            loaders[i]->SignalStopThread();
+            conditionJobsLeft.Set(true);
+            #endif
+            loaders[i]->StopThread();
+        }
+#if defined(__APPLE__) && !defined(__x86_64__)
         // This is a fix for Mac OS X 32 bit, where SignalStopThread
         // doesn't wake up a thread waiting for a condition variable.
         SignalStopThread(); // send stop signal, but don't wait
         conditionJobsLeft.Set(true); // wake thread
         return Thread::StopThread(); // then wait for it to cancel
-    }
-#endif
-
-#ifdef WIN32
-    int InstrumentManagerThread::StopThread() {
+#elif defined(WIN32)
         int res = Thread::StopThread();
         conditionJobsLeft.Reset();
         return res;
-    }
+#else
+        return Thread::StopThread();
 #endif
+    }
 
 } // namespace LinuxSampler
@@ -30,6 +30,8 @@
 #include "InstrumentManager.h"
 
 #include <list>
+#include <map>
+#include <vector>
 
 namespace LinuxSampler {
 
@@ -39,18 +41,27 @@ namespace LinuxSampler {
      * the InstrumentManager in the background, that is in a separate thread
      * without blocking the calling thread. This class is thus not exported
      * to the API.
+     *
+     * Commands are executed by this thread and GLOBAL_LOADER_THREADS
+     * additional loader threads. Commands on different sampler channels and
+     * different files run concurrently, whereas commands on the same engine
+     * channel or on the same instrument file are executed one after another
+     * in the order they were queued. So engine channels still get their
+     * instruments in command order, and a file requested by several commands
+     * is only loaded once, the later commands just pick up the instrument
+     * already loaded by the first one.
      */
     class InstrumentManagerThread : public Thread {
         friend class EventHandler;
         
         public:
             InstrumentManagerThread();
-            void StartNewLoad(String Filename, uint uiInstrumentIndex, EngineChannel* pEngineChannel);
+            int  StartNewLoad(String Filename, uint uiInstrumentIndex, EngineChannel* pEngineChannel, bool bTrack = false);
+            bool LoadFinished(int LoadID, String& Error);
+            void ForgetLoad(int LoadID);
             void StartSettingMode(InstrumentManager* pManager, const InstrumentManager::instrument_id_t& ID, InstrumentManager::mode_t Mode);
             virtual ~InstrumentManagerThread();
-#if (defined(__APPLE__) && !defined(__x86_64__)) || defined(WIN32)
-            int StopThread();
-#endif
+            int StopThread() OVERRIDE;
         protected:
             struct command_t {
                 enum cmd_type_t {
@@ -61,15 +72,47 @@ namespace LinuxSampler {
                 InstrumentManager*                 pManager;     ///< only for INSTR_MODE commands
                 InstrumentManager::instrument_id_t instrumentId; ///< for both DIRECT_LOAD and INSTR_MODE
                 InstrumentManager::mode_t          mode;         ///< only for INSTR_MODE commands
+                int                                loadId;       ///< only for DIRECT_LOAD commands, 0 if the outcome is not tracked
+                uint64_t                           queuedAt;     ///< time (in us) the command was queued
+            };
+
+            struct load_result_t {
+                bool   bFinished;
+                String error; ///< empty if the instrument was loaded successfully
             };
 
             // Instance variables.
             std::list<command_t> queue; ///< queue with commands for loading new instruments.
             Mutex                mutex; ///< for making the queue thread safe 
             Condition            conditionJobsLeft; ///< synchronizer to block this thread until a new job arrives
+            std::map<int,load_result_t> loadResults; ///< tracked loads (protected by mutex)
+            int                  lastLoadId;
+            std::list<command_t> running; ///< commands currently executed by one of the threads (protected by mutex)
+
+            // load statistics since the queue was idle the last time (protected by mutex)
+            uint64_t             busySince; ///< time (in us) the first command was queued
+            uint64_t             busyLoadTime; ///< sum of the execution times (in us) of all loads
+            int                  busyLoads;
+
+            void FinishLoad(int LoadID, const String& Error);
+            void StartThreads();
+            bool NextCommand(command_t& cmd);
+            void Execute(command_t& cmd);
+            void ProcessCommands();
+            void WaitForCommands();
 
             int Main(); ///< Implementation of virtual method from class Thread.
         private:
+            class LoaderThread : public Thread {
+                public:
+                    LoaderThread(InstrumentManagerThread* pParent);
+                    int Main() OVERRIDE;
+                private:
+                    InstrumentManagerThread* pParent;
+            };
+
+            std::vector<LoaderThread*> loaders; ///< additional threads executing commands
+
             class EventHandler : public ChannelCountAdapter {
                 public:
                     InstrumentManagerThread* pThread;
@@ -34,9 +34,10 @@ namespace LinuxSampler {
         pLFO3 = new LFOSigned(1200.0f); // pitch LFO (-1200..+1200 range)
         PlaybackState = playback_state_end;
         SynthesisMode = 0; // set all mode bits to 0 first
-        // select synthesis implementation (asm core is not supported ATM)
-        #if 0 // CONFIG_ASM && ARCH_X86
-        SYNTHESIS_MODE_SET_IMPLEMENTATION(SynthesisMode, Features::supportsMMX() && Features::supportsSSE());
+        // select synthesis implementation (the vectorized kernels matching
+        // the CPU are picked by GetSynthesisFunction() at runtime)
+        #if CONFIG_ASM && ARCH_X86
+        SYNTHESIS_MODE_SET_IMPLEMENTATION(SynthesisMode, true);
         #else
         SYNTHESIS_MODE_SET_IMPLEMENTATION(SynthesisMode, false);
         #endif
@@ -47,6 +48,9 @@ namespace LinuxSampler {
         
         pEq          = NULL;
         bEqSupport   = false;
+
+        pRenderChannelLeft  = NULL;
+        pRenderChannelRight = NULL;
     }
 
     AbstractVoice::~AbstractVoice() {
@@ -403,6 +407,10 @@ namespace LinuxSampler {
         AbstractEngineChannel* pChannel = pEngineChannel;
         MidiKeyBase* pMidiKeyInfo = GetMidiKeyInfo(MIDIKey());
 
+        // output buffers of this voice, unless it requires dedicated routing
+        AudioChannel* pOutLeft  = (pRenderChannelLeft)  ? pRenderChannelLeft  : pChannel->pChannelLeft;
+        AudioChannel* pOutRight = (pRenderChannelRight) ? pRenderChannelRight : pChannel->pChannelRight;
+
         const bool bVoiceRequiresDedicatedRouting =
             pEngineChannel->GetFxSendCount() > 0 &&
             (pMidiKeyInfo->ReverbSend || pMidiKeyInfo->ChorusSend);
@@ -420,8 +428,8 @@ namespace LinuxSampler {
             finalSynthesisParameters.pOutLeft  = &GetEngine()->pDedicatedVoiceChannelLeft->Buffer()[Skip];
             finalSynthesisParameters.pOutRight = &GetEngine()->pDedicatedVoiceChannelRight->Buffer()[Skip];
         } else {
-            finalSynthesisParameters.pOutLeft  = &pChannel->pChannelLeft->Buffer()[Skip];
-            finalSynthesisParameters.pOutRight = &pChannel->pChannelRight->Buffer()[Skip];
+            finalSynthesisParameters.pOutLeft  = &pOutLeft->Buffer()[Skip];
+            finalSynthesisParameters.pOutRight = &pOutRight->Buffer()[Skip];
         }
         finalSynthesisParameters.pSrc = pSrc;
 
@@ -657,8 +665,8 @@ namespace LinuxSampler {
             GetEngine()->RouteDedicatedVoiceChannels(pEngineChannel, effectSendLevels, Samples);
         } else if (bEq) {
             pEq->RenderAudio(Samples);
-            pEq->GetOutChannelLeft()->MixTo(pChannel->pChannelLeft, Samples);
-            pEq->GetOutChannelRight()->MixTo(pChannel->pChannelRight, Samples);
+            pEq->GetOutChannelLeft()->MixTo(pOutLeft, Samples);
+            pEq->GetOutChannelRight()->MixTo(pOutRight, Samples);
         }
     }
 
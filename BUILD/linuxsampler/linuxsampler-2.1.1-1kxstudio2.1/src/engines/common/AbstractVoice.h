@@ -137,6 +137,8 @@ namespace LinuxSampler {
             bool                Orphan;             ///< true if this voice is playing a sample from an instrument that is unloaded. When the voice dies, the sample (and dimension region) will be handed back to the instrument resource manager.
             playback_state_t    PlaybackState;      ///< When a sample will be triggered, it will be first played from RAM cache and after a couple of sample points it will switch to disk streaming and at the end of a disk stream we have to add null samples, so the interpolator can do it's work correctly
             Stream::reference_t DiskStreamRef;      ///< Reference / link to the disk stream
+            AudioChannel*       pRenderChannelLeft;  ///< If not NULL, the voice renders into this buffer instead of the engine channel's left one (used while rendering on a worker thread).
+            AudioChannel*       pRenderChannelRight; ///< If not NULL, the voice renders into this buffer instead of the engine channel's right one (used while rendering on a worker thread).
 
             template<class TV, class TRR, class TR, class TD, class TIM, class TI> friend class EngineBase;
 
@@ -0,0 +1,113 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the Free Software           *
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,                *
+ *   MA  02110-1301  USA                                                   *
+ ***************************************************************************/
+
+#include "DiskReaderPool.h"
+
+namespace LinuxSampler {
+
+    // same scheduling as the disk thread itself
+    DiskReaderPool::Reader::Reader(DiskReaderPool* pPool) : Thread(true, false, 1, -2) {
+        this->pPool = pPool;
+    }
+
+    // Entry point for the reader threads.
+    int DiskReaderPool::Reader::Main() {
+        while (true) {
+
+            #if CONFIG_PTHREAD_TESTCANCEL
+            TestCancel();
+            #endif
+
+            // sleep until Run() hands out new jobs
+            wakeup.WaitIf(false);
+            wakeup.PreLockedSet(false);
+            wakeup.Unlock();
+
+            while (pPool->RunNextJob());
+        }
+        return 0;
+    }
+
+    DiskReaderPool::DiskReaderPool(int Threads)
+        : ppJobs(NULL), jobCount(0), nextJob(0), jobsDone(0), finished(true)
+    {
+        for (int i = 0; i < Threads; ++i) {
+            Reader* pReader = new Reader(this);
+            readers.push_back(pReader);
+            pReader->StartThread();
+        }
+    }
+
+    DiskReaderPool::~DiskReaderPool() {
+        for (int i = 0; i < (int) readers.size(); ++i) {
+            readers[i]->StopThread();
+            delete readers[i];
+        }
+    }
+
+    void DiskReaderPool::Run(Runnable** ppJobs, int Count) {
+        if (Count <= 0) return;
+
+        // must be reset before publishing the jobs, a reader still
+        // looking for work of the previous run might finish them all
+        finished.Set(false);
+
+        jobsMutex.Lock();
+        this->ppJobs = ppJobs;
+        jobCount = Count;
+        nextJob  = 0;
+        jobsDone = 0;
+        jobsMutex.Unlock();
+
+        // wake up as many readers as there are jobs left for them
+        const int n = (Count - 1 < (int) readers.size()) ? Count - 1 : (int) readers.size();
+        for (int i = 0; i < n; ++i) readers[i]->wakeup.Set(true);
+
+        // the calling thread works on the jobs as well
+        while (RunNextJob());
+
+        // sleep until the jobs still being executed by readers are done
+        finished.WaitAndUnlockIf(false);
+    }
+
+    /**
+     * Claims the next job of the current run and executes it.
+     *
+     * @returns false if there was no job left
+     */
+    bool DiskReaderPool::RunNextJob() {
+        jobsMutex.Lock();
+        if (nextJob >= jobCount) {
+            jobsMutex.Unlock();
+            return false;
+        }
+        Runnable* pJob = ppJobs[nextJob++];
+        jobsMutex.Unlock();
+
+        pJob->Run();
+
+        jobsMutex.Lock();
+        const bool bLast = (++jobsDone == jobCount);
+        jobsMutex.Unlock();
+        if (bLast) finished.Set(true);
+        return true;
+    }
+
+} // namespace LinuxSampler
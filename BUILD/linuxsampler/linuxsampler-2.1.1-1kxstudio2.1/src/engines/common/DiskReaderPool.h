@@ -0,0 +1,95 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the Free Software           *
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,                *
+ *   MA  02110-1301  USA                                                   *
+ ***************************************************************************/
+
+#ifndef __LS_DISKREADERPOOL_H__
+#define __LS_DISKREADERPOOL_H__
+
+#include <vector>
+
+#include "../../common/Condition.h"
+#include "../../common/Mutex.h"
+#include "../../common/global_private.h"
+#include "../../common/Thread.h"
+
+namespace LinuxSampler {
+
+    /** @brief Disk Reader Threads
+     *
+     * Pool of threads used by the disk thread to refill several disk
+     * streams at the same time, so that the reads of independent streams
+     * overlap instead of waiting for each other.
+     *
+     * Run() hands out the given jobs to the reader threads, executes jobs
+     * itself as well and blocks until all of them were finished. Unlike
+     * RTThreadPool the waiting threads sleep, as the jobs block on disk
+     * I/O for a long time compared to an audio fragment.
+     */
+    class DiskReaderPool {
+        public:
+            /**
+             * Creates a pool with the given amount of reader threads. The
+             * threads are started immediately.
+             *
+             * @param Threads - amount of reader threads, the calling thread
+             *                  of Run() is not counted
+             */
+            DiskReaderPool(int Threads);
+            virtual ~DiskReaderPool();
+
+            /**
+             * Executes the given jobs in parallel and returns when all of
+             * them are finished. The order in which the jobs are executed
+             * is undefined. Jobs are not deleted.
+             *
+             * @param ppJobs - array of jobs to be executed
+             * @param Count  - amount of jobs in the array
+             */
+            void Run(Runnable** ppJobs, int Count);
+
+            /**
+             * Returns the amount of reader threads of this pool.
+             */
+            int GetThreadCount() const { return (int) readers.size(); }
+
+        private:
+            class Reader : public Thread {
+                public:
+                    Reader(DiskReaderPool* pPool);
+                    virtual int Main() OVERRIDE;
+
+                    Condition wakeup; ///< set by Run() to wake up this reader
+                private:
+                    DiskReaderPool* pPool;
+            };
+
+            bool RunNextJob();
+
+            std::vector<Reader*> readers;
+            Mutex                jobsMutex; ///< protects the job fields below
+            Runnable**           ppJobs;
+            int                  jobCount;
+            int                  nextJob;
+            int                  jobsDone;
+            Condition            finished;  ///< set when all jobs of the current run are done
+    };
+
+} // namespace LinuxSampler
+
+#endif // __LS_DISKREADERPOOL_H__
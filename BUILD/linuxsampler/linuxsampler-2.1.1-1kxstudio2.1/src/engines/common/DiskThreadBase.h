@@ -26,15 +26,19 @@
 #ifndef __LS_DISKTHREADBASE_H__
 #define __LS_DISKTHREADBASE_H__
 
+#include <algorithm>
 #include <map>
 
 #include "StreamBase.h"
+#include "DiskReaderPool.h"
+#include "SamplePreload.h"
 #include "../EngineChannel.h"
 #include "../InstrumentManagerBase.h"
 
 #include "../../common/global_private.h"
 
 #include "../../common/Thread.h"
+#include "../../common/RTMath.h"
 #include "../../common/RingBuffer.h"
 #include "../../common/atomic.h"
 
@@ -42,6 +46,20 @@ namespace LinuxSampler {
 
     int CompareStreamWriteSpace(const void* A, const void* B);
 
+    /**
+     * A refill candidate as kept in the disk thread's heap of most empty
+     * streams.
+     */
+    struct refill_candidate_t {
+        Stream* pStream;
+        int     WriteSpace;
+
+        /// heap order, the candidate with the least write space on top
+        inline bool operator<(const refill_candidate_t& other) const {
+            return WriteSpace > other.WriteSpace;
+        }
+    };
+
     /** @brief Disk Reader Thread
      *
      * The disk reader thread is responsible for periodically refilling
@@ -73,6 +91,19 @@ namespace LinuxSampler {
                 uint32_t Program;
                 EngineChannel* pEngineChannel;
             };
+            /// Refills a group of streams sharing read resources, one after another.
+            class RefillJob : public Runnable {
+                public:
+                    Stream** ppStreams;
+                    int      StreamCount;
+                    bool     Refilled; ///< true if any stream got refilled by more than CONFIG_STREAM_MIN_REFILL_SIZE
+
+                    virtual void Run() OVERRIDE {
+                        Refilled = false;
+                        for (int i = 0; i < StreamCount; i++)
+                            if (RefillStream(ppStreams[i])) Refilled = true;
+                    }
+            };
             // Attributes
             bool                           IsIdle;
             uint                           Streams;
@@ -86,6 +117,11 @@ namespace LinuxSampler {
             Stream**                       pStreams; ///< Contains all disk streams (whether used or unused)
             Stream**                       pCreatedStreams; ///< This is where the voice (audio thread) picks up it's meanwhile hopefully created disk stream.
             static Stream*                 SLOT_RESERVED;                          ///< This value is used to mark an entry in pCreatedStreams[] as reserved.
+            DiskReaderPool*                pReaderPool;                            ///< Additional threads refilling streams in parallel to the disk thread
+            refill_candidate_t*            pCandidates;                            ///< Heap of the most empty streams selected in the current loop run (RefillStreamsPerRun entries)
+            int*                           pGroupOf;                               ///< Union-find forest grouping the selected streams by shared read resources
+            RefillJob*                     pRefillJobs;                            ///< One job per group of selected streams
+            Runnable**                     ppRefillJobs;
 
             // Methods
 
@@ -144,32 +180,103 @@ namespace LinuxSampler {
                 }
             }
 
-            void RefillStreams() {
-                // sort the streams by most empty stream
-                qsort(pStreams, Streams, sizeof(Stream*), CompareStreamWriteSpace);
+            /**
+             * Refills the given stream as far as possible. Called by the
+             * disk thread and the reader threads.
+             *
+             * @returns true if the stream got refilled by more than
+             *          CONFIG_STREAM_MIN_REFILL_SIZE
+             */
+            static bool RefillStream(Stream* pStream) {
+                //float filledpercentage = (float) pStream->GetReadSpace() / 131072.0 * 100.0;
+                //dmsg(("\nbuffer fill: %.1f%\n", filledpercentage));
 
-                // refill the most empty streams
-                for (uint i = 0; i < RefillStreamsPerRun; i++) {
-                    if (pStreams[i]->GetState() == Stream::state_active) {
+                int writespace = pStream->GetWriteSpaceToEnd();
+                if (writespace == 0) return false;
 
-                        //float filledpercentage = (float) pStreams[i]->GetReadSpace() / 131072.0 * 100.0;
-                        //dmsg(("\nbuffer fill: %.1f%\n", filledpercentage));
+                int capped_writespace = writespace;
+                // if there is too much buffer space available then cut the read/write
+                // size to CONFIG_STREAM_MAX_REFILL_SIZE which is by default 65536 samples = 256KBytes
+                if (writespace > CONFIG_STREAM_MAX_REFILL_SIZE) capped_writespace = CONFIG_STREAM_MAX_REFILL_SIZE;
 
-                        int writespace = pStreams[i]->GetWriteSpaceToEnd();
-                        if (writespace == 0) break;
+                // adjust the amount to read in order to ensure that the buffer wraps correctly
+                int read_amount = pStream->AdjustWriteSpaceToAvoidBoundary(writespace, capped_writespace);
+                return pStream->ReadAhead(read_amount) > CONFIG_STREAM_MIN_REFILL_SIZE;
+            }
 
-                        int capped_writespace = writespace;
-                        // if there is too much buffer space available then cut the read/write
-                        // size to CONFIG_STREAM_MAX_REFILL_SIZE which is by default 65536 samples = 256KBytes
-                        if (writespace > CONFIG_STREAM_MAX_REFILL_SIZE) capped_writespace = CONFIG_STREAM_MAX_REFILL_SIZE;
+            int FindGroup(int i) {
+                while (pGroupOf[i] != i) i = pGroupOf[i] = pGroupOf[pGroupOf[i]];
+                return i;
+            }
 
-                        // adjust the amount to read in order to ensure that the buffer wraps correctly
-                        int read_amount = pStreams[i]->AdjustWriteSpaceToAvoidBoundary(writespace, capped_writespace);
-                        // if we wasn't able to refill one of the stream buffers by more than
-                        // CONFIG_STREAM_MIN_REFILL_SIZE we'll send the disk thread to sleep later
-                        if (pStreams[i]->ReadAhead(read_amount) > CONFIG_STREAM_MIN_REFILL_SIZE) this->IsIdle = false;
+            void RefillStreams() {
+                // select the most empty streams, keeping the RefillStreamsPerRun
+                // ones with the most write space in a heap instead of sorting
+                // all streams
+                uint selected = 0;
+                int  waiting  = 0;
+                for (uint i = 0; i < Streams; i++) {
+                    if (pStreams[i]->GetState() != Stream::state_active) continue;
+                    refill_candidate_t candidate;
+                    candidate.pStream    = pStreams[i];
+                    candidate.WriteSpace = pStreams[i]->GetWriteSpace();
+                    if (candidate.WriteSpace == 0) continue;
+                    if (candidate.WriteSpace > CONFIG_STREAM_MIN_REFILL_SIZE) waiting++;
+                    if (selected < RefillStreamsPerRun) {
+                        pCandidates[selected++] = candidate;
+                        std::push_heap(pCandidates, pCandidates + selected);
+                    } else if (pCandidates[0].WriteSpace < candidate.WriteSpace) {
+                        std::pop_heap(pCandidates, pCandidates + selected);
+                        pCandidates[selected - 1] = candidate;
+                        std::push_heap(pCandidates, pCandidates + selected);
                     }
                 }
+                atomic_set(&QueueDepth, waiting);
+                if (waiting > atomic_read(&QueueDepthMax)) atomic_set(&QueueDepthMax, waiting);
+                if (!selected) return;
+
+                // streams sharing a file handle, sample position or decoding
+                // buffer must not be read at the same time, so group them
+                const void* resources[RefillStreamsPerRunMax][Stream::MAX_READ_RESOURCES];
+                int resourceCount[RefillStreamsPerRunMax];
+                for (int i = 0; i < (int) selected; i++) {
+                    pGroupOf[i] = i;
+                    resourceCount[i] = pCandidates[i].pStream->GetReadResources(resources[i]);
+                    for (int j = 0; j < i; j++) {
+                        for (int a = 0; a < resourceCount[i]; a++) {
+                            for (int b = 0; b < resourceCount[j]; b++) {
+                                if (resources[i][a] == resources[j][b])
+                                    pGroupOf[FindGroup(i)] = FindGroup(j);
+                            }
+                        }
+                    }
+                }
+
+                // one refill job per group, streams of a group are refilled
+                // one after another by the same thread
+                int jobs = 0;
+                for (uint i = 0; i < selected; i++) pRefillJobs[i].StreamCount = 0;
+                for (uint i = 0; i < selected; i++) {
+                    RefillJob& job = pRefillJobs[FindGroup(i)];
+                    if (!job.StreamCount) ppRefillJobs[jobs++] = &job;
+                    job.ppStreams[job.StreamCount++] = pCandidates[i].pStream;
+                }
+
+                // StopThread() may cancel us anywhere, but not while the readers
+                // are busy with our streams and the pool's locks may be held
+                #if !defined(WIN32)
+                int cancelState;
+                pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &cancelState);
+                #endif
+                pReaderPool->Run(ppRefillJobs, jobs);
+                #if !defined(WIN32)
+                pthread_setcancelstate(cancelState, NULL);
+                #endif
+
+                // if we wasn't able to refill one of the stream buffers by more than
+                // CONFIG_STREAM_MIN_REFILL_SIZE we'll send the disk thread to sleep later
+                for (int i = 0; i < jobs; i++)
+                    if (static_cast<RefillJob*>(ppRefillJobs[i])->Refilled) this->IsIdle = false;
             }
 
             Stream::Handle CreateHandle() {
@@ -193,6 +300,12 @@ namespace LinuxSampler {
             }
 
             atomic_t ActiveStreamCount;
+            atomic_t Underruns;
+            atomic_t QueueDepth;
+            atomic_t QueueDepthMax;
+
+            /// Upper limit for RefillStreamsPerRun.
+            enum { RefillStreamsPerRunMax = 64 };
         public:
             // Methods
             DiskThreadBase(int MaxStreams, uint BufferWrapElements, IM* pInstruments) :
@@ -208,12 +321,26 @@ namespace LinuxSampler {
                 pStreams            = new Stream*[MaxStreams];
                 pCreatedStreams     = new Stream*[MaxStreams + 1];
                 Streams             = MaxStreams;
-                RefillStreamsPerRun = CONFIG_REFILL_STREAMS_PER_RUN;
+                pReaderPool         = new DiskReaderPool(GLOBAL_DISK_READER_THREADS);
+                // with reader threads each of them gets as many streams
+                // per loop run as the disk thread used to refill alone
+                RefillStreamsPerRun = CONFIG_REFILL_STREAMS_PER_RUN * (GLOBAL_DISK_READER_THREADS + 1);
+                if (RefillStreamsPerRun > RefillStreamsPerRunMax) RefillStreamsPerRun = RefillStreamsPerRunMax;
+                pCandidates         = new refill_candidate_t[RefillStreamsPerRun];
+                pGroupOf            = new int[RefillStreamsPerRun];
+                pRefillJobs         = new RefillJob[RefillStreamsPerRun];
+                ppRefillJobs        = new Runnable*[RefillStreamsPerRun];
+                for (uint i = 0; i < RefillStreamsPerRun; i++) {
+                    pRefillJobs[i].ppStreams = new Stream*[RefillStreamsPerRun];
+                }
 
                 for (int i = 1; i <= MaxStreams; i++) {
                     pCreatedStreams[i] = NULL;
                 }
                 ActiveStreamCountMax = 0;
+                atomic_set(&Underruns, 0);
+                atomic_set(&QueueDepth, 0);
+                atomic_set(&QueueDepthMax, 0);
             }
 
             virtual ~DiskThreadBase() {
@@ -226,6 +353,14 @@ namespace LinuxSampler {
                 if (DeleteRegionQueue) delete DeleteRegionQueue;
                 if (pStreams)        delete[] pStreams;
                 if (pCreatedStreams) delete[] pCreatedStreams;
+                if (pReaderPool)     delete pReaderPool;
+                for (uint i = 0; i < RefillStreamsPerRun; i++) {
+                    delete[] pRefillJobs[i].ppStreams;
+                }
+                delete[] pRefillJobs;
+                delete[] ppRefillJobs;
+                delete[] pGroupOf;
+                delete[] pCandidates;
             }
 
 
@@ -262,6 +397,9 @@ namespace LinuxSampler {
                 DeleteRegionQueue->init();
                 SetActiveStreamCount(0);
                 ActiveStreamCountMax = 0;
+                atomic_set(&Underruns, 0);
+                atomic_set(&QueueDepth, 0);
+                atomic_set(&QueueDepthMax, 0);
                 if (running) this->StartThread(); // start thread only if it was running before
             }
 
@@ -446,6 +584,29 @@ namespace LinuxSampler {
             void SetActiveStreamCount(uint Streams) { atomic_set(&ActiveStreamCount, Streams); }
             int ActiveStreamCountMax;
 
+            /**
+             * Called by voices (in the audio thread or a render thread)
+             * whenever a disk stream did not provide the sample data in
+             * time.
+             */
+            void ReportUnderrun() { atomic_inc(&Underruns); }
+
+            /// Amount of underruns reported since the last Reset().
+            uint GetUnderrunCount() { return atomic_read(&Underruns); }
+
+            /**
+             * Amount of active streams which were waiting to be refilled
+             * by more than CONFIG_STREAM_MIN_REFILL_SIZE samples in the
+             * latest loop run of the disk thread.
+             */
+            uint GetQueueDepth() { return atomic_read(&QueueDepth); }
+
+            /// Maximum queue depth since the last Reset().
+            uint GetQueueDepthMax() { return atomic_read(&QueueDepthMax); }
+
+            /// Amount of reader threads, the disk thread itself not counted.
+            uint GetReaderThreadCount() { return pReaderPool->GetThreadCount(); }
+
         protected:
             IM* pInstruments;   ///< The instrument resource manager of the engine that is using this disk thread. Used by the dimension region deletion feature.
 
@@ -456,6 +617,10 @@ namespace LinuxSampler {
             // Implementation of virtual method from class Thread
             int Main() {
                 dmsg(3,("Disk thread running\n"));
+                // slowly decaying peak of the loop duration, a new stream
+                // waits at most about one iteration for its first refill
+                float peakIterationTime = 0.0f;
+                RTMath::usecs_t iterationStart = RTMath::unsafeMicroSeconds(RTMath::real_clock);
                 while (true) {
                     #if !defined(WIN32)
                     pthread_testcancel(); // mandatory for OSX
@@ -536,6 +701,15 @@ namespace LinuxSampler {
                     }
                     SetActiveStreamCount(streamsInUsage);
                     if (streamsInUsage > ActiveStreamCountMax) ActiveStreamCountMax = streamsInUsage;
+
+                    // let the instrument managers size the sample preload
+                    // by the time the disk thread takes to serve a stream
+                    const RTMath::usecs_t now = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+                    const float iterationTime = float(now - iterationStart) / 1000000.0f;
+                    iterationStart = now;
+                    peakIterationTime = (iterationTime > peakIterationTime)
+                        ? iterationTime : peakIterationTime * 0.99f + iterationTime * 0.01f;
+                    SamplePreload::ReportStreamingLatency(2.0f * peakIterationTime);
                 }
 
                 return EXIT_FAILURE;
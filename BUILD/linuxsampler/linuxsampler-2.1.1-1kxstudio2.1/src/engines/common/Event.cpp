@@ -157,6 +157,21 @@ namespace LinuxSampler {
         return Event(this, FragmentPos);
     }
 
+    /**
+     * Create a new event with the current time as time stamp, which shall
+     * however be processed at the given time offset from now. Events ending
+     * up behind the current audio fragment are postponed by the engine to
+     * the respective subsequent audio fragment, events ending up before it
+     * are processed at its beginning.
+     *
+     * @param TimeOffset - time of the event relative to now
+     */
+    Event EventGenerator::CreateEvent(const midi_time_offset_t& TimeOffset) {
+        Event e(this, RTMath::CreateTimeStamp());
+        e.iTimeOffset = int32_t(int64_t(TimeOffset.us) * uiSampleRate / 1000000);
+        return e;
+    }
+
     /**
      * Will be called by an EventGenerator to create a new Event.
      * This Constructor expects a time stamp. The actual sample point
@@ -170,6 +185,7 @@ namespace LinuxSampler {
         Init();
         pEventGenerator = pGenerator;
         TimeStamp       = Time;
+        iTimeOffset     = 0;
         iFragmentPos    = -1;
     }
 
@@ -185,6 +201,7 @@ namespace LinuxSampler {
     Event::Event(EventGenerator* pGenerator, int32_t FragmentPos) {
         Init();
         pEventGenerator = pGenerator;
+        iTimeOffset     = 0;
         iFragmentPos    = FragmentPos;
     }
 
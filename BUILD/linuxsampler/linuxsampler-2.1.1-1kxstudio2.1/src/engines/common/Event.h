@@ -61,6 +61,7 @@ namespace LinuxSampler {
             void SetSampleRate(uint SampleRate);
             Event CreateEvent();
             Event CreateEvent(int32_t FragmentPos);
+            Event CreateEvent(const midi_time_offset_t& TimeOffset);
 
             template<typename T>
             void scheduleAheadMicroSec(RTAVLTree<T>& queue, T& node, int32_t fragmentPosBase, uint64_t microseconds);
@@ -255,7 +256,7 @@ namespace LinuxSampler {
             }
             inline int32_t FragmentPos() {
                 if (iFragmentPos >= 0) return iFragmentPos;
-                iFragmentPos = pEventGenerator->ToFragmentPos(TimeStamp);
+                iFragmentPos = pEventGenerator->ToFragmentPos(TimeStamp) + iTimeOffset;
                 if (iFragmentPos < 0) iFragmentPos = 0; // if event arrived shortly before the beginning of current fragment
                 return iFragmentPos;
             }
@@ -264,6 +265,7 @@ namespace LinuxSampler {
             }
             inline void CopyTimeFrom(const Event& other) {
                 TimeStamp = other.TimeStamp;
+                iTimeOffset = other.iTimeOffset;
                 iFragmentPos = other.iFragmentPos;
             }
             inline sched_time_t SchedTime() {
@@ -277,6 +279,7 @@ namespace LinuxSampler {
         private:
             EventGenerator* pEventGenerator; ///< Creator of the event.
             time_stamp_t    TimeStamp;       ///< Time stamp of the event's occurence.
+            int32_t         iTimeOffset;     ///< Sample points the event's actual position differs from the one of its time stamp (e.g. for MIDI drivers which know when the event really occurred).
             int32_t         iFragmentPos;    ///< Position in the current fragment this event refers to.
     };
 
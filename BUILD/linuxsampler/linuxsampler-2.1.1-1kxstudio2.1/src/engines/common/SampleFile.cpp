@@ -26,6 +26,10 @@
 #include "../../common/Exception.h"
 
 #include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <climits>
+#include <sys/stat.h>
 
 #define CONVERT_BUFFER_SIZE 4096
 
@@ -34,10 +38,29 @@ namespace LinuxSampler {
     int SampleFile_OpenFilesCount = 0;
     #endif
 
+    namespace {
+        // fills a shared memory segment of the SharedSampleStore
+        class CacheLoader : public SharedSampleStore::Loader {
+            public:
+                CacheLoader(SampleFile* pSample, unsigned long Offset, unsigned long FrameCount)
+                    : pSample(pSample), Offset(Offset), FrameCount(FrameCount) {}
+
+                virtual unsigned long Load(void* pBuffer, unsigned long /*Size*/) {
+                    pSample->SetPos(Offset);
+                    return pSample->Read(pBuffer, FrameCount) * pSample->GetFrameSize();
+                }
+            private:
+                SampleFile*   pSample;
+                unsigned long Offset;
+                unsigned long FrameCount;
+        };
+    }
+
     SampleFile::SampleFile(String File, bool DontClose) {
         this->File      = File;
         this->pSndFile  = NULL;
         pConvertBuffer  = NULL;
+        pSharedCache    = NULL;
 
         SF_INFO sfInfo;
         sfInfo.format = 0;
@@ -167,8 +190,25 @@ namespace LinuxSampler {
             // Offset the RAM cache
             RAMCacheOffset = Offset;
         }
-        if (RAMCache.pStart) delete[] (int8_t*) RAMCache.pStart;
+        ReleaseSampleData();
         unsigned long allocationsize = (FrameCount + NullFramesCount) * this->FrameSize;
+
+        // map the cache of another sampler process which loaded the same
+        // sample part already, if enabled
+        if (SharedSampleStore::Enabled()) {
+            String key = SharedCacheKey(FrameCount, NullFramesCount);
+            CacheLoader loader(this, RAMCacheOffset, FrameCount);
+            if (!key.empty())
+                pSharedCache = SharedSampleStore::Acquire(key, allocationsize, &loader);
+        }
+        if (pSharedCache) {
+            RAMCache.pStart            = pSharedCache->Data();
+            RAMCache.Size              = pSharedCache->ValidSize();
+            RAMCache.NullExtensionSize = allocationsize - RAMCache.Size;
+            Close();
+            return GetCache();
+        }
+
         SetPos(RAMCacheOffset, SEEK_SET); // reset read position to playback start point
         RAMCache.pStart            = new int8_t[allocationsize];
 
@@ -254,12 +294,40 @@ namespace LinuxSampler {
     }
 
     void SampleFile::ReleaseSampleData() {
-        if (RAMCache.pStart) delete[] (int8_t*) RAMCache.pStart;
+        if (pSharedCache) {
+            SharedSampleStore::Release(pSharedCache);
+            pSharedCache = NULL;
+        } else if (RAMCache.pStart) delete[] (int8_t*) RAMCache.pStart;
         RAMCache.pStart = NULL;
         RAMCache.Size   = 0;
         RAMCache.NullExtensionSize = 0;
     }
 
+    /**
+     * Returns the key identifying the cached part of this sample in the
+     * SharedSampleStore, or an empty string if the file can't be identified.
+     * Besides the cached range, the key contains the file's identity and
+     * modification time, so that a changed file is never mapped from an
+     * outdated segment.
+     */
+    String SampleFile::SharedCacheKey(unsigned long FrameCount, uint NullFramesCount) {
+        #if defined(WIN32)
+        return ""; // no shared sample store on Windows
+        #else
+        char path[PATH_MAX];
+        struct stat st;
+        if (!realpath(File.c_str(), path) || stat(path, &st)) return "";
+        char info[256];
+        snprintf(
+            info, sizeof(info), "|%llu:%llu|%lld|%lld|%x|%d|%ld|%u|%lu|%u",
+            (unsigned long long) st.st_dev, (unsigned long long) st.st_ino,
+            (long long) st.st_size, (long long) st.st_mtime, Format, FrameSize,
+            TotalFrameCount, RAMCacheOffset, FrameCount, NullFramesCount
+        );
+        return String(path) + info;
+        #endif
+    }
+
     Sample::buffer_t SampleFile::GetCache() {
         // return a copy of the buffer_t structure
         buffer_t result;
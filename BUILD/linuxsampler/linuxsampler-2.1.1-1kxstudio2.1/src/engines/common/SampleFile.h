@@ -25,6 +25,7 @@
 #define __LS_SAMPLEFILE_H__
 
 #include "Sample.h"
+#include "SharedSampleStore.h"
 
 #include <sndfile.h>
 #include "../../common/global.h"
@@ -80,10 +81,12 @@ namespace LinuxSampler {
             SNDFILE* pSndFile;
 
             buffer_t RAMCache;        ///< Buffers samples (already uncompressed) in RAM.
+            SharedSampleStore::Segment* pSharedCache; ///< Shared memory holding RAMCache, if any.
 
             int* pConvertBuffer;
 
             long SetPos(unsigned long FrameCount, int Whence);
+            String SharedCacheKey(unsigned long FrameCount, uint NullFramesCount);
     };
 
     template <class R>
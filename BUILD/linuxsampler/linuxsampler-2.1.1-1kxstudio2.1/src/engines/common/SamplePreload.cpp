@@ -0,0 +1,202 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the Free Software           *
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,                *
+ *   MA  02110-1301  USA                                                   *
+ ***************************************************************************/
+
+#include <algorithm>
+
+#include "SamplePreload.h"
+#include "../../common/global_private.h"
+
+// Streaming latency assumed as long as no disk thread measured it yet.
+#define DEFAULT_STREAMING_LATENCY_S     0.25f
+
+// Lower bound for the streaming latency the preload is based on.
+#define MIN_STREAMING_LATENCY_S         0.05f
+
+// The cached part covers the measured latency this many times.
+#define LATENCY_SAFETY_FACTOR           2.0f
+
+// Upper bound for the preload size of streamed samples (in sample points).
+#define MAX_PRELOAD_SAMPLES             (4 * CONFIG_PRELOAD_SAMPLES)
+
+// Samples or loops ending at most this much after the preload are cached
+// completely (resp. up to the loop end).
+#define WHOLE_SAMPLE_TOLERANCE          1.25f
+
+namespace LinuxSampler {
+
+    atomic<int> SamplePreload::latencyUs(0);
+    atomic<int> SamplePreload::preloadedKiB(0);
+    Mutex SamplePreload::planMutex;
+    int64_t SamplePreload::reservedBytes = 0;
+
+    SamplePreload::sample_info_t::sample_info_t()
+        : TotalFrames(0), FrameSize(0), ChannelCount(1), SampleRate(44100), LoopEnd(0), MaxPitch(1.0f)
+    {
+    }
+
+    // Sample points the voice has to keep in reserve at the end of the
+    // cache before switching to its disk stream (see AbstractVoice).
+    static unsigned long VoiceMargin(const SamplePreload::sample_info_t& Info, uint MaxSamplesPerCycle) {
+        const uint channels = Info.ChannelCount ? Info.ChannelCount : 1;
+        return ((unsigned long) MaxSamplesPerCycle << CONFIG_MAX_PITCH) / channels + 3;
+    }
+
+    // Sample points consumed during the streaming latency at the given pitch.
+    static unsigned long LatencyFrames(const SamplePreload::sample_info_t& Info, float Pitch) {
+        if (Pitch < 1.0f) Pitch = 1.0f;
+        if (Pitch > float(1 << CONFIG_MAX_PITCH)) Pitch = float(1 << CONFIG_MAX_PITCH);
+        return (unsigned long) (SamplePreload::GetStreamingLatency() * LATENCY_SAFETY_FACTOR * Info.SampleRate * Pitch);
+    }
+
+    // Rounds the preload up to the whole sample or the loop end if that
+    // is just a little more. Short samples are always cached completely.
+    static unsigned long ExtendToSampleEnd(const SamplePreload::sample_info_t& Info, unsigned long Frames, unsigned long Margin) {
+        if (Info.TotalFrames <= CONFIG_PRELOAD_SAMPLES) return Info.TotalFrames;
+        if (Info.TotalFrames <= Frames * WHOLE_SAMPLE_TOLERANCE) return Info.TotalFrames;
+        const unsigned long loopFrames = Info.LoopEnd + Margin;
+        if (Info.LoopEnd && loopFrames > Frames && loopFrames <= Frames * WHOLE_SAMPLE_TOLERANCE) return loopFrames;
+        return Frames;
+    }
+
+    unsigned long SamplePreload::MinFrames(const sample_info_t& Info, uint MaxSamplesPerCycle) {
+        if (Info.TotalFrames <= CONFIG_PRELOAD_SAMPLES) return Info.TotalFrames; // as without budget
+        const unsigned long margin = VoiceMargin(Info, MaxSamplesPerCycle);
+        unsigned long frames = margin + LatencyFrames(Info, 1.0f);
+        if (frames > MAX_PRELOAD_SAMPLES) frames = std::max(margin, (unsigned long) MAX_PRELOAD_SAMPLES);
+        return (Info.TotalFrames <= frames) ? Info.TotalFrames : frames;
+    }
+
+    unsigned long SamplePreload::Frames(const sample_info_t& Info, uint MaxSamplesPerCycle) {
+        const unsigned long margin = VoiceMargin(Info, MaxSamplesPerCycle);
+        unsigned long frames = margin + LatencyFrames(Info, Info.MaxPitch);
+        if (frames > MAX_PRELOAD_SAMPLES) frames = std::max(margin, (unsigned long) MAX_PRELOAD_SAMPLES);
+        return ExtendToSampleEnd(Info, frames, margin);
+    }
+
+    namespace {
+        struct upgrade_t {
+            SamplePreload::request_t* pRequest;
+            unsigned long             Frames;      ///< preload without budget
+            int64_t                   ExtraBytes;  ///< RAM needed in addition to the minimum preload
+            bool                      SavesStream; ///< whether the upgrade caches the whole sample or its loop
+
+            bool operator<(const upgrade_t& other) const {
+                if (SavesStream != other.SavesStream) return SavesStream;
+                return ExtraBytes < other.ExtraBytes;
+            }
+        };
+    }
+
+    int64_t SamplePreload::Plan(std::vector<request_t>& Requests, uint MaxSamplesPerCycle) {
+        const int64_t budget = GetBudget();
+        if (!budget) {
+            for (size_t i = 0; i < Requests.size(); ++i)
+                Requests[i].Frames = Frames(Requests[i].Info, MaxSamplesPerCycle);
+            return 0;
+        }
+
+        // instruments may be loaded by several threads at the same time,
+        // each plan has to see what the others are about to cache
+        LockGuard lock(planMutex);
+        Distribute(Requests, MaxSamplesPerCycle, budget - GetPreloadedBytes() - reservedBytes);
+        int64_t bytes = 0;
+        for (size_t i = 0; i < Requests.size(); ++i)
+            bytes += int64_t(Requests[i].Frames) * Requests[i].Info.FrameSize;
+        reservedBytes += bytes;
+        return bytes;
+    }
+
+    void SamplePreload::Distribute(std::vector<request_t>& Requests, uint MaxSamplesPerCycle, int64_t Available) {
+        // every sample gets its minimum preload, whether within the budget or not
+        std::vector<upgrade_t> upgrades;
+        int64_t available = Available;
+        for (size_t i = 0; i < Requests.size(); ++i) {
+            request_t& req = Requests[i];
+            const unsigned long ideal = Frames(req.Info, MaxSamplesPerCycle);
+            req.Frames = std::min(MinFrames(req.Info, MaxSamplesPerCycle), ideal);
+            available -= int64_t(req.Frames) * req.Info.FrameSize;
+            if (ideal <= req.Frames) continue;
+
+            upgrade_t upgrade;
+            upgrade.pRequest    = &req;
+            upgrade.Frames      = ideal;
+            upgrade.ExtraBytes  = int64_t(ideal - req.Frames) * req.Info.FrameSize;
+            upgrade.SavesStream = ideal == req.Info.TotalFrames ||
+                                  (req.Info.LoopEnd && ideal > req.Info.LoopEnd && req.Frames <= req.Info.LoopEnd);
+            upgrades.push_back(upgrade);
+        }
+        if (available <= 0) {
+            if (!upgrades.empty())
+                dmsg(1,("SamplePreload: preload budget exhausted, caching minimum preload only\n"));
+            return;
+        }
+
+        // spend the rest of the budget, first on samples which then don't
+        // need to be streamed anymore, cheapest first
+        std::sort(upgrades.begin(), upgrades.end());
+        for (size_t i = 0; i < upgrades.size() && available > 0; ++i) {
+            request_t& req = *upgrades[i].pRequest;
+            if (upgrades[i].ExtraBytes <= available) {
+                req.Frames = upgrades[i].Frames;
+                available -= upgrades[i].ExtraBytes;
+            } else if (!upgrades[i].SavesStream && req.Info.FrameSize) {
+                // partial pitch headroom is still better than none
+                req.Frames += (unsigned long) (available / req.Info.FrameSize);
+                available = 0;
+            }
+        }
+    }
+
+    void SamplePreload::AddPreloadedBytes(int64_t Bytes, int64_t ReservedBytes) {
+        // rounded the same way for both signs, so that releasing the
+        // amount added before exactly reverts it
+        const int kib = int((Bytes < 0 ? -Bytes + 1023 : Bytes + 1023) / 1024);
+        preloadedKiB.fetch_add(Bytes < 0 ? -kib : kib);
+        if (ReservedBytes) {
+            LockGuard lock(planMutex);
+            reservedBytes -= ReservedBytes;
+        }
+    }
+
+    int64_t SamplePreload::GetPreloadedBytes() {
+        return int64_t(preloadedKiB.load(memory_order_relaxed)) * 1024;
+    }
+
+    int64_t SamplePreload::GetBudget() {
+        return int64_t(GLOBAL_PRELOAD_BUDGET) * 1024 * 1024;
+    }
+
+    void SamplePreload::ReportStreamingLatency(float Seconds) {
+        // follow increases immediately, decreases slowly, so a single
+        // quiet period doesn't shrink the preload of the next instrument
+        const int us = int(Seconds * 1000000.0f);
+        int current = latencyUs.load(memory_order_relaxed);
+        int next = (us >= current) ? us : current - (current - us) / 64;
+        latencyUs.store(next, memory_order_relaxed);
+    }
+
+    float SamplePreload::GetStreamingLatency() {
+        const int us = latencyUs.load(memory_order_relaxed);
+        if (!us) return DEFAULT_STREAMING_LATENCY_S;
+        const float s = float(us) / 1000000.0f;
+        return (s < MIN_STREAMING_LATENCY_S) ? MIN_STREAMING_LATENCY_S : s;
+    }
+
+} // namespace LinuxSampler
@@ -0,0 +1,147 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the Free Software           *
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,                *
+ *   MA  02110-1301  USA                                                   *
+ ***************************************************************************/
+
+#ifndef __LS_SAMPLEPRELOAD_H__
+#define __LS_SAMPLEPRELOAD_H__
+
+#include <vector>
+
+#include "../../common/global.h"
+#include "../../common/lsatomic.h"
+#include "../../common/Mutex.h"
+
+namespace LinuxSampler {
+
+    /** @brief Preload Size Calculation
+     *
+     * Decides how many sample points at the beginning of each sample are
+     * cached in RAM by the instrument resource managers. The cached part
+     * has to bridge the time until the disk thread delivered the first
+     * data of the voice's disk stream, so it depends on how fast the
+     * sample is played back and on the streaming latency measured by the
+     * disk threads. Samples which are only a bit longer than that, or
+     * whose loop ends shortly after it, are cached completely (or up to
+     * the loop end) so that they never need a disk stream at all.
+     *
+     * With a preload budget (see GLOBAL_PRELOAD_BUDGET) every sample
+     * first gets its minimum preload, which is what it needs when played
+     * at its original pitch. The remaining budget is then handed out to
+     * the samples for which the extra RAM saves a disk stream, cheapest
+     * first, and after that to the pitch headroom of the others.
+     */
+    class SamplePreload {
+        public:
+            /// Describes how a sample is used by an instrument.
+            struct sample_info_t {
+                unsigned long TotalFrames;  ///< length of the sample in sample points
+                uint          FrameSize;    ///< size of one sample point (all channels) in bytes
+                uint          ChannelCount;
+                uint          SampleRate;
+                unsigned long LoopEnd;      ///< end of the sample's loop in sample points, 0 if the sample is not looped
+                float         MaxPitch;     ///< highest factor the sample is pitched up with by the instrument (1.0 = original pitch)
+
+                sample_info_t();
+            };
+
+            /// Preload decision for one sample.
+            struct request_t {
+                sample_info_t Info;
+                unsigned long Frames;       ///< amount of sample points to be cached, TotalFrames for caching the whole sample
+            };
+
+            /**
+             * Calculates the preload size of the given sample, ignoring
+             * the preload budget.
+             *
+             * @param Info - the sample and how it is played
+             * @param MaxSamplesPerCycle - max. audio fragment size of the
+             *                             engines using the sample
+             * @returns amount of sample points to be cached, TotalFrames
+             *          if the whole sample should be cached
+             */
+            static unsigned long Frames(const sample_info_t& Info, uint MaxSamplesPerCycle);
+
+            /**
+             * Calculates the preload sizes of all samples of an instrument
+             * about to be loaded, distributing the preload budget among
+             * them if one is set.
+             *
+             * @param Requests - samples to be cached, the Frames field of
+             *                   each entry is set by this call
+             * @param MaxSamplesPerCycle - max. audio fragment size of the
+             *                             engines using the instrument
+             * @returns RAM reserved for the planned preloads (in bytes), to
+             *          be passed to AddPreloadedBytes() after caching, so
+             *          that instruments loaded at the same time don't
+             *          overdraw the budget
+             */
+            static int64_t Plan(std::vector<request_t>& Requests, uint MaxSamplesPerCycle);
+
+            /**
+             * Called by the instrument resource managers whenever they
+             * cached samples for an instrument (positive amount) or
+             * destroyed that instrument again (the same amount, negated).
+             * Samples shared by several instruments are accounted to the
+             * instrument which cached them first.
+             *
+             * @param Bytes - RAM allocated (> 0) or released (< 0)
+             * @param ReservedBytes - reservation returned by Plan() for
+             *                        the cached samples, which is released
+             */
+            static void AddPreloadedBytes(int64_t Bytes, int64_t ReservedBytes = 0);
+
+            /**
+             * Returns the RAM currently used for preloading samples of all
+             * loaded instruments (in bytes).
+             */
+            static int64_t GetPreloadedBytes();
+
+            /**
+             * Returns the preload budget (in bytes), 0 if unlimited.
+             */
+            static int64_t GetBudget();
+
+            /**
+             * Called by the disk threads with the time a newly ordered disk
+             * stream currently takes at most until it delivers data.
+             *
+             * @param Seconds - measured latency
+             */
+            static void ReportStreamingLatency(float Seconds);
+
+            /**
+             * Returns the streaming latency the preload sizes are based on
+             * (in seconds).
+             */
+            static float GetStreamingLatency();
+
+        private:
+            static unsigned long MinFrames(const sample_info_t& Info, uint MaxSamplesPerCycle);
+            static void Distribute(std::vector<request_t>& Requests, uint MaxSamplesPerCycle, int64_t Available);
+
+            static atomic<int> latencyUs;    ///< measured streaming latency in microseconds, 0 if not measured yet
+            static atomic<int> preloadedKiB; ///< RAM used for preloading in KiB
+            static Mutex       planMutex;    ///< protects reservedBytes
+            static int64_t     reservedBytes; ///< planned by Plan(), but not cached yet
+    };
+
+} // namespace LinuxSampler
+
+#endif // __LS_SAMPLEPRELOAD_H__
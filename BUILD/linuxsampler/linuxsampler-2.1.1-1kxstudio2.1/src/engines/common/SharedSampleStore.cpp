@@ -0,0 +1,269 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the Free Software           *
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,                *
+ *   MA  02110-1301  USA                                                   *
+ ***************************************************************************/
+
+#include "SharedSampleStore.h"
+#include "../../common/global_private.h"
+#include "../../common/Mutex.h"
+
+#if !defined(WIN32)
+# include <string.h>
+# include <stdio.h>
+# include <errno.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <dirent.h>
+# include <sys/file.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+#endif
+
+// All segments of the store are named with this prefix.
+#define SEGMENT_PREFIX      "linuxsampler-sample-"
+
+// Directory the shared memory objects show up in, only needed for removing
+// stale segments.
+#define SHM_DIR             "/dev/shm"
+
+#define SEGMENT_MAGIC       0x4c535353 // "LSSS"
+#define SEGMENT_VERSION     1
+
+// Sample data starts at this offset, behind the header.
+#define HEADER_SIZE         4096
+
+// Max. length of a segment key (including terminating zero).
+#define MAX_KEY_SIZE        2048
+
+// How often Acquire() tries again if a segment vanished or was found stale
+// while opening it.
+#define MAX_ATTEMPTS        3
+
+namespace LinuxSampler {
+
+#if !defined(WIN32)
+
+    namespace {
+        struct header_t {
+            uint32_t          Magic;
+            uint32_t          Version;
+            volatile uint32_t Ready;     ///< set after the creator filled the segment
+            uint32_t          Reserved;
+            uint64_t          Size;      ///< size of the sample data (in bytes)
+            uint64_t          ValidSize; ///< bytes read from the sample, the rest is silence
+            char              Key[MAX_KEY_SIZE]; ///< for detecting hash collisions
+        };
+
+        // FNV-1a, the segment name only needs to be unique among the
+        // samples loaded at the same time
+        String SegmentName(const String& Key) {
+            uint64_t hash = 14695981039346656037ULL;
+            for (size_t i = 0; i < Key.size(); ++i) {
+                hash ^= (unsigned char) Key[i];
+                hash *= 1099511628211ULL;
+            }
+            char name[64];
+            snprintf(name, sizeof(name), "/" SEGMENT_PREFIX "%016llx", (unsigned long long) hash);
+            return name;
+        }
+
+        // whether the shared memory object behind fd was removed meanwhile
+        bool IsUnlinked(int fd) {
+            struct stat st;
+            return fstat(fd, &st) || st.st_nlink == 0;
+        }
+
+        Mutex staleMutex;
+        bool staleRemoved = false;
+    }
+
+    bool SharedSampleStore::Enabled() {
+        return GLOBAL_SHARED_SAMPLES;
+    }
+
+    SharedSampleStore::Segment* SharedSampleStore::Acquire(const String& Key, unsigned long Size, Loader* pLoader) {
+        if (!Enabled() || Key.size() >= MAX_KEY_SIZE) return NULL;
+        {
+            LockGuard lock(staleMutex);
+            if (!staleRemoved) {
+                RemoveStaleSegments();
+                staleRemoved = true;
+            }
+        }
+
+        const String name = SegmentName(Key);
+        const unsigned long mapSize = HEADER_SIZE + Size;
+
+        for (int attempt = 0; attempt < MAX_ATTEMPTS; ++attempt) {
+            int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+            if (fd >= 0) {
+                // we create it, other processes block on their shared lock
+                // until the segment is filled
+                if (flock(fd, LOCK_EX)) {
+                    shm_unlink(name.c_str());
+                    close(fd);
+                    return NULL;
+                }
+                if (IsUnlinked(fd)) { // taken for a stale one before we got the lock
+                    close(fd);
+                    continue;
+                }
+                void* pMap = MAP_FAILED;
+                if (!ftruncate(fd, mapSize))
+                    pMap = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (pMap == MAP_FAILED) {
+                    dmsg(1,("SharedSampleStore: could not create segment of %lu bytes\n", mapSize));
+                    shm_unlink(name.c_str());
+                    close(fd);
+                    return NULL;
+                }
+                header_t* pHeader = (header_t*) pMap;
+                int8_t* pData = (int8_t*) pMap + HEADER_SIZE;
+                unsigned long validSize;
+                try {
+                    validSize = pLoader->Load(pData, Size);
+                } catch (...) {
+                    munmap(pMap, mapSize);
+                    shm_unlink(name.c_str());
+                    close(fd);
+                    throw;
+                }
+                if (validSize > Size) validSize = Size;
+                memset(pData + validSize, 0, Size - validSize);
+                pHeader->Magic     = SEGMENT_MAGIC;
+                pHeader->Version   = SEGMENT_VERSION;
+                pHeader->Size      = Size;
+                pHeader->ValidSize = validSize;
+                strcpy(pHeader->Key, Key.c_str());
+                __sync_synchronize();
+                pHeader->Ready     = 1;
+                mprotect(pMap, mapSize, PROT_READ);
+                // not atomic, if another process meanwhile considers the
+                // segment unused and removes it, we just don't share it
+                flock(fd, LOCK_SH);
+
+                Segment* pSegment = new Segment;
+                pSegment->fd        = fd;
+                pSegment->name      = name;
+                pSegment->pMap      = pMap;
+                pSegment->mapSize   = mapSize;
+                pSegment->pData     = pData;
+                pSegment->size      = Size;
+                pSegment->validSize = validSize;
+                return pSegment;
+            }
+            if (errno != EEXIST) return NULL;
+
+            // segment exists, map it as soon as its creator filled it
+            fd = shm_open(name.c_str(), O_RDONLY, 0);
+            if (fd < 0) {
+                if (errno == ENOENT) continue; // removed meanwhile
+                return NULL;
+            }
+            if (flock(fd, LOCK_SH)) {
+                close(fd);
+                return NULL;
+            }
+            if (IsUnlinked(fd)) {
+                close(fd);
+                continue;
+            }
+            struct stat st;
+            void* pMap = MAP_FAILED;
+            if (!fstat(fd, &st) && (unsigned long) st.st_size == mapSize)
+                pMap = mmap(NULL, mapSize, PROT_READ, MAP_SHARED, fd, 0);
+            header_t* pHeader = (header_t*) pMap;
+            if (pMap != MAP_FAILED &&
+                pHeader->Magic == SEGMENT_MAGIC && pHeader->Version == SEGMENT_VERSION &&
+                pHeader->Ready && pHeader->Size == Size && pHeader->ValidSize <= Size &&
+                !strncmp(pHeader->Key, Key.c_str(), MAX_KEY_SIZE))
+            {
+                Segment* pSegment = new Segment;
+                pSegment->fd        = fd;
+                pSegment->name      = name;
+                pSegment->pMap      = pMap;
+                pSegment->mapSize   = mapSize;
+                pSegment->pData     = (int8_t*) pMap + HEADER_SIZE;
+                pSegment->size      = Size;
+                pSegment->validSize = pHeader->ValidSize;
+                return pSegment;
+            }
+            if (pMap != MAP_FAILED) munmap(pMap, mapSize);
+
+            // Left behind by a creator which crashed while filling it, or
+            // another sample with the same hash. Only the former is unused.
+            if (flock(fd, LOCK_EX | LOCK_NB)) {
+                dmsg(2,("SharedSampleStore: segment %s in use by other sample\n", name.c_str()));
+                close(fd);
+                return NULL;
+            }
+            if (!IsUnlinked(fd)) shm_unlink(name.c_str());
+            close(fd);
+        }
+        return NULL;
+    }
+
+    void SharedSampleStore::Release(Segment* pSegment) {
+        if (!pSegment) return;
+        munmap(pSegment->pMap, pSegment->mapSize);
+        // last user removes the segment
+        if (!flock(pSegment->fd, LOCK_EX | LOCK_NB) && !IsUnlinked(pSegment->fd))
+            shm_unlink(pSegment->name.c_str());
+        close(pSegment->fd); // drops our lock
+        delete pSegment;
+    }
+
+    void SharedSampleStore::RemoveStaleSegments() {
+        DIR* pDir = opendir(SHM_DIR);
+        if (!pDir) return;
+        int removed = 0;
+        for (struct dirent* pEntry = readdir(pDir); pEntry; pEntry = readdir(pDir)) {
+            if (strncmp(pEntry->d_name, SEGMENT_PREFIX, strlen(SEGMENT_PREFIX))) continue;
+            const String name = String("/") + pEntry->d_name;
+            int fd = shm_open(name.c_str(), O_RDONLY, 0);
+            if (fd < 0) continue; // e.g. owned by another user
+            if (!flock(fd, LOCK_EX | LOCK_NB) && !IsUnlinked(fd)) {
+                shm_unlink(name.c_str());
+                removed++;
+            }
+            close(fd);
+        }
+        closedir(pDir);
+        if (removed)
+            dmsg(1,("SharedSampleStore: removed %d stale sample segments\n", removed));
+    }
+
+#else // WIN32
+
+    bool SharedSampleStore::Enabled() {
+        return false;
+    }
+
+    SharedSampleStore::Segment* SharedSampleStore::Acquire(const String& Key, unsigned long Size, Loader* pLoader) {
+        return NULL;
+    }
+
+    void SharedSampleStore::Release(Segment* pSegment) {
+    }
+
+    void SharedSampleStore::RemoveStaleSegments() {
+    }
+
+#endif // WIN32
+
+} // namespace LinuxSampler
@@ -0,0 +1,118 @@
+/***************************************************************************
+ *                                                                         *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the Free Software           *
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,                *
+ *   MA  02110-1301  USA                                                   *
+ ***************************************************************************/
+
+#ifndef __LS_SHAREDSAMPLESTORE_H__
+#define __LS_SHAREDSAMPLESTORE_H__
+
+#include "../../common/global.h"
+
+namespace LinuxSampler {
+
+    /** @brief Sample cache shared between sampler processes
+     *
+     * Keeps the RAM cached part of samples in POSIX shared memory, so that
+     * several sampler instances on the same host which load the same
+     * samples map the same physical memory instead of each holding a
+     * private copy. Segments are identified by a key which has to describe
+     * the cached content exactly (file, file version, offset, size and
+     * format of the cached sample points).
+     *
+     * Each process mapping a segment holds a shared file lock on it. The
+     * locks are the reference count across processes: the last process
+     * releasing a segment (i.e. the one able to lock it exclusively)
+     * removes it. As the kernel drops the locks of crashed processes, their
+     * segments are removed by the next process using the store.
+     *
+     * The store is only used if enabled by the --shared-samples command
+     * line option. If a segment can't be created or opened, callers fall
+     * back to a private allocation.
+     */
+    class SharedSampleStore {
+        public:
+            /**
+             * Fills a newly created segment with the sample data.
+             */
+            class Loader {
+                public:
+                    virtual ~Loader() {}
+
+                    /**
+                     * Writes the cached content to @a pBuffer and returns
+                     * the amount of valid bytes. The rest of the buffer is
+                     * zeroed by the store.
+                     */
+                    virtual unsigned long Load(void* pBuffer, unsigned long Size) = 0;
+            };
+
+            /**
+             * Mapping of one segment in this process. The sample data is
+             * mapped read-only.
+             */
+            class Segment {
+                public:
+                    void* Data() const { return pData; }
+                    unsigned long Size() const { return size; }
+                    unsigned long ValidSize() const { return validSize; }
+                private:
+                    Segment() : fd(-1), pMap(NULL), mapSize(0), pData(NULL), size(0), validSize(0) {}
+
+                    int           fd;
+                    String        name;
+                    void*         pMap;
+                    unsigned long mapSize;
+                    void*         pData;
+                    unsigned long size;
+                    unsigned long validSize;
+
+                friend class SharedSampleStore;
+            };
+
+            /**
+             * Returns whether samples shall be cached in shared memory.
+             */
+            static bool Enabled();
+
+            /**
+             * Maps the segment with the given key, which must provide
+             * @a Size bytes. If no other process created it yet, the
+             * segment is created and filled by @a pLoader.
+             *
+             * @returns mapped segment or NULL if the store is disabled or
+             *          the segment couldn't be created or opened
+             */
+            static Segment* Acquire(const String& Key, unsigned long Size, Loader* pLoader);
+
+            /**
+             * Unmaps the given segment and removes it if no other process
+             * uses it anymore.
+             */
+            static void Release(Segment* pSegment);
+
+            /**
+             * Removes all segments no process uses anymore, i.e. those left
+             * behind by crashed processes. Called automatically on the
+             * first Acquire() call of the process.
+             */
+            static void RemoveStaleSegments();
+    };
+
+} // namespace LinuxSampler
+
+#endif // __LS_SHAREDSAMPLESTORE_H__
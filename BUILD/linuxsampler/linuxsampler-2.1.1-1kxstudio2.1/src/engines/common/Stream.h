@@ -44,6 +44,7 @@ namespace LinuxSampler {
             typedef uint32_t OrderID_t;
             typedef uint32_t Handle; ///< unique identifier of a relationship between one stream and a consumer (Voice)
             enum { INVALID_HANDLE = 0 };
+            enum { MAX_READ_RESOURCES = 2 }; ///< maximum amount of objects returned by GetReadResources()
             enum state_t {           ///< streams go through severe cyclic state transition (unused->active->end->unused->...)
                 state_unused,        ///< stream is not in use, thus can still be launched
                 state_active,        ///< stream provides data in it's buffer to be read and hasn't reached the end yet (this is the usual case)
@@ -146,6 +147,23 @@ namespace LinuxSampler {
             virtual long Read(uint8_t* pBuf, long SamplesToRead) = 0;
             virtual void Reset() = 0;
 
+            /**
+             * Returns the objects shared with other streams (i.e. file
+             * handles, sample positions or decoding buffers) which are
+             * used by Read(). The disk thread never refills two streams
+             * sharing any of these objects at the same time. By default
+             * all streams share one object, so they are refilled one
+             * after another.
+             *
+             * @param ppResources - array of MAX_READ_RESOURCES entries
+             *                      receiving the objects
+             * @returns amount of objects written to @a ppResources
+             */
+            virtual int GetReadResources(const void** ppResources) {
+                ppResources[0] = &TotalStreams;
+                return 1;
+            }
+
         private:
 
             // Methods
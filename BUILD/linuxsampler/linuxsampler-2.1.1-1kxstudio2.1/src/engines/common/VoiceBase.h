@@ -140,7 +140,8 @@ namespace LinuxSampler {
                                 DiskStreamRef.pStream = pDiskThread->AskForCreatedStream(DiskStreamRef.OrderID);
                                 if (!DiskStreamRef.pStream) {
                                     std::cerr << "Disk stream not available in time!\n" << std::flush;
-                                    KillImmediately();
+                                    pDiskThread->ReportUnderrun();
+                                    KillFinished();
                                     return;
                                 }
                                 DiskStreamRef.pStream->IncrementReadPos(uint(
@@ -169,6 +170,9 @@ namespace LinuxSampler {
 
                             const int iPos = (int) finalSynthesisParameters.dPos;
                             const int readSampleWords = iPos * SmplInfo.ChannelCount; // amount of sample words actually been read
+                            // the disk thread did not refill the stream in time
+                            if (readSampleWords > sampleWordsLeftToRead && DiskStreamRef.State != Stream::state_end)
+                                pDiskThread->ReportUnderrun();
                             DiskStreamRef.pStream->IncrementReadPos(readSampleWords);
                             finalSynthesisParameters.dPos -= iPos; // just keep fractional part of playback position
 
@@ -192,10 +196,22 @@ namespace LinuxSampler {
 
                 // If sample stream or release stage finished, kill the voice
                 if (PlaybackState == Voice::playback_state_end || EG1Finished()) {
-                    KillImmediately();
+                    KillFinished();
                 }
             }
 
+            /**
+             *  Kills the voice at the end of Render(). If the voice is rendered
+             *  on a worker thread of the engine (that is if it renders into
+             *  private buffers), it must not order the deletion of its disk
+             *  stream by itself. In that case it is only marked as finished
+             *  here and killed by the engine after the parallel render phase.
+             */
+            void KillFinished() {
+                if (pRenderChannelLeft) this->PlaybackState = Voice::playback_state_end;
+                else KillImmediately();
+            }
+
             /**
              *  Immediately kill the voice. This method should not be used to kill
              *  a normal, active voice, because it doesn't take care of things like
@@ -22,12 +22,14 @@
  ***************************************************************************/
 
 #include <sstream>
+#include <map>
 
 #include "InstrumentResourceManager.h"
 #include "EngineChannel.h"
 #include "Engine.h"
 
 #include "../../common/global_private.h"
+#include "../../common/RTMath.h"
 #include "../../plugins/InstrumentEditorFactory.h"
 
 namespace LinuxSampler { namespace gig {
@@ -570,6 +572,10 @@ namespace LinuxSampler { namespace gig {
     }
 
     ::gig::Instrument* InstrumentResourceManager::Create(instrument_id_t Key, InstrumentConsumer* pConsumer, void*& pArg) {
+        // instruments of the same file are created one after another
+        FileGuard fileGuard(this, Key.FileName);
+        const uint64_t t0 = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+
         // get gig file from internal gig file manager
         ::gig::File* pGig = Gigs.Borrow(Key.FileName, reinterpret_cast<GigConsumer*>(Key.Index)); // conversion kinda hackish :/
 
@@ -582,39 +588,86 @@ namespace LinuxSampler { namespace gig {
         progress.callback = OnInstrumentLoadingProgress;
         progress.custom   = &callbackArg;
 
-        dmsg(1,("Loading gig instrument ('%s',%d)...",Key.FileName.c_str(),Key.Index));
-        ::gig::Instrument* pInstrument = pGig->GetInstrument(Key.Index, &progress);
-        if (!pInstrument) {
-            std::stringstream msg;
-            msg << "There's no instrument with index " << Key.Index << ".";
-            throw InstrumentManagerException(msg.str());
+        ::gig::Instrument* pInstrument;
+        {
+            // this creates the file's samples (see LibGigMutex)
+            LockGuard lock(LibGigMutex);
+            pInstrument = pGig->GetInstrument(Key.Index, &progress);
+            if (!pInstrument) {
+                std::stringstream msg;
+                msg << "There's no instrument with index " << Key.Index << ".";
+                throw InstrumentManagerException(msg.str());
+            }
+            pGig->GetFirstSample(); // just to force complete instrument loading
         }
-        pGig->GetFirstSample(); // just to force complete instrument loading
-        dmsg(1,("OK\n"));
+        const uint64_t t1 = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+        dmsg(1,("Loaded gig instrument ('%s',%d) in %.3f s\n",Key.FileName.c_str(),Key.Index,float(t1 - t0) / 1000000.f));
 
         uint maxSamplesPerCycle = GetMaxSamplesPerCycle(pConsumer);
 
-        // cache initial samples points (for actually needed samples)
-        dmsg(1,("Caching initial samples..."));
-        uint iRegion = 0; // just for progress calculation
-        ::gig::Region* pRgn = pInstrument->GetFirstRegion();
-        while (pRgn) {
-            // we randomly schedule 90% for the .gig file loading and the remaining 10% now for sample caching
-            const float localProgress = 0.9f + 0.1f * (float) iRegion / (float) pInstrument->Regions;
-            DispatchResourceProgressEvent(Key, localProgress);
-
-            if (pRgn->GetSample() && !pRgn->GetSample()->GetCache().Size) {
-                dmsg(2,("C"));
-                CacheInitialSamples(pRgn->GetSample(), maxSamplesPerCycle);
-            }
+        // decide how much of each sample to cache, depending on how far
+        // the dimension regions using it pitch it up
+        std::vector<SamplePreload::request_t> preloads;
+        std::vector< ::gig::Sample*> samples;
+        std::map< ::gig::Sample*,size_t> sampleIndex;
+        for (::gig::Region* pRgn = pInstrument->GetFirstRegion(); pRgn; pRgn = pInstrument->GetNextRegion()) {
             for (uint i = 0; i < pRgn->DimensionRegions; i++) {
-                CacheInitialSamples(pRgn->pDimensionRegions[i]->pSample, maxSamplesPerCycle);
+                ::gig::DimensionRegion* pDimRgn = pRgn->pDimensionRegions[i];
+                ::gig::Sample* pSample = pDimRgn->pSample;
+                if (!pSample) continue;
+                int cents = pDimRgn->FineTune + pInstrument->PitchbendRange * 100;
+                if (pDimRgn->PitchTrack) cents += (pRgn->KeyRange.high - pDimRgn->UnityNote) * 100;
+                const float pitch = (float) RTMath::CentsToFreqRatioUnlimited(cents);
+                const unsigned long loopEnd = (pDimRgn->SampleLoops) ?
+                    pDimRgn->pSampleLoops[0].LoopStart + pDimRgn->pSampleLoops[0].LoopLength : 0;
+
+                std::map< ::gig::Sample*,size_t>::iterator it = sampleIndex.find(pSample);
+                if (it == sampleIndex.end()) {
+                    SamplePreload::request_t req;
+                    req.Info.TotalFrames  = pSample->SamplesTotal;
+                    req.Info.FrameSize    = pSample->FrameSize;
+                    req.Info.ChannelCount = pSample->Channels;
+                    req.Info.SampleRate   = pSample->SamplesPerSecond;
+                    req.Info.LoopEnd      = loopEnd;
+                    req.Info.MaxPitch     = pitch;
+                    req.Frames            = 0;
+                    sampleIndex[pSample] = preloads.size();
+                    preloads.push_back(req);
+                    samples.push_back(pSample);
+                } else {
+                    SamplePreload::sample_info_t& info = preloads[it->second].Info;
+                    if (pitch > info.MaxPitch) info.MaxPitch = pitch;
+                    if (loopEnd > info.LoopEnd) info.LoopEnd = loopEnd;
+                }
             }
+            // the region's own sample reference, in case no dimension region uses it
+            ::gig::Sample* pSample = pRgn->GetSample();
+            if (pSample && !sampleIndex.count(pSample)) {
+                SamplePreload::request_t req;
+                req.Info.TotalFrames  = pSample->SamplesTotal;
+                req.Info.FrameSize    = pSample->FrameSize;
+                req.Info.ChannelCount = pSample->Channels;
+                req.Info.SampleRate   = pSample->SamplesPerSecond;
+                req.Info.MaxPitch     = 2.0f;
+                req.Frames            = 0;
+                sampleIndex[pSample] = preloads.size();
+                preloads.push_back(req);
+                samples.push_back(pSample);
+            }
+        }
+        const int64_t reservedBytes = SamplePreload::Plan(preloads, maxSamplesPerCycle);
 
-            pRgn = pInstrument->GetNextRegion();
-            iRegion++;
+        // cache initial samples points (for actually needed samples)
+        int64_t preloadedBytes = 0;
+        for (size_t i = 0; i < samples.size(); i++) {
+            // we randomly schedule 90% for the .gig file loading and the remaining 10% now for sample caching
+            const float localProgress = 0.9f + 0.1f * (float) i / (float) samples.size();
+            DispatchResourceProgressEvent(Key, localProgress);
+            preloadedBytes += CacheInitialSamples(samples[i], maxSamplesPerCycle, preloads[i].Frames);
         }
-        dmsg(1,("OK\n"));
+        SamplePreload::AddPreloadedBytes(preloadedBytes, reservedBytes);
+        dmsg(1,("Cached initial samples of ('%s',%d) in %.3f s\n",Key.FileName.c_str(),Key.Index,
+                float(RTMath::unsafeMicroSeconds(RTMath::real_clock) - t1) / 1000000.f));
         DispatchResourceProgressEvent(Key, 1.0f); // done; notify all consumers about progress 100%
 
         // we need the following for destruction later
@@ -622,6 +675,7 @@ namespace LinuxSampler { namespace gig {
         pEntry->ID.FileName   = Key.FileName;
         pEntry->ID.Index      = Key.Index;
         pEntry->pFile         = pGig;
+        pEntry->PreloadedBytes = preloadedBytes;
 
         // and we save this to check if we need to reallocate for an engine with higher value of 'MaxSamplesPerSecond'
         pEntry->MaxSamplesPerCycle = maxSamplesPerCycle;
@@ -635,6 +689,7 @@ namespace LinuxSampler { namespace gig {
         instr_entry_t* pEntry = (instr_entry_t*) pArg;
         // we don't need the .gig file here anymore
         Gigs.HandBack(pEntry->pFile, reinterpret_cast<GigConsumer*>(pEntry->ID.Index)); // conversion kinda hackish :/
+        SamplePreload::AddPreloadedBytes(-pEntry->PreloadedBytes);
         delete pEntry;
     }
 
@@ -643,6 +698,7 @@ namespace LinuxSampler { namespace gig {
     }
 
     void InstrumentResourceManager::DeleteSampleIfNotUsed(::gig::Sample* pSample, region_info_t* pRegInfo) {
+        LockGuard lock(LibGigMutex);
         ::gig::File* gig = pRegInfo->file;
         ::RIFF::File* riff = static_cast< ::RIFF::File*>(pRegInfo->pArg);
         if (gig) {
@@ -688,14 +744,55 @@ namespace LinuxSampler { namespace gig {
         CacheInitialSamples(pSample, maxSamplesPerCycle);
     }
 
+    /**
+     * Caches the beginning of the given sample without knowing how it is
+     * used by the instrument, i.e. assuming it is pitched up by at most one
+     * octave.
+     */
     void InstrumentResourceManager::CacheInitialSamples(::gig::Sample* pSample, uint maxSamplesPerCycle) {
         if (!pSample) {
             dmsg(4,("gig::InstrumentResourceManager: Skipping sample (pSample == NULL)\n"));
             return;
         }
-        if (!pSample->SamplesTotal) return; // skip zero size samples
+        SamplePreload::sample_info_t info;
+        info.TotalFrames  = pSample->SamplesTotal;
+        info.FrameSize    = pSample->FrameSize;
+        info.ChannelCount = pSample->Channels;
+        info.SampleRate   = pSample->SamplesPerSecond;
+        info.MaxPitch     = 2.0f;
+        CacheInitialSamples(pSample, maxSamplesPerCycle, SamplePreload::Frames(info, maxSamplesPerCycle));
+    }
+
+    /**
+     *  Caches the given amount of sample points at the beginning of the given
+     *  sample in RAM (see SamplePreload). If that covers the whole sample, it
+     *  is cached completely, followed by silence, so that no disk streaming is
+     *  needed for it.
+     *
+     *  @param pSample - points to the sample to be cached
+     *  @param maxSamplesPerCycle - max samples per cycle
+     *  @param preloadFrames - amount of sample points to be cached
+     *  @returns amount of bytes newly allocated for the cache
+     */
+    int64_t InstrumentResourceManager::CacheInitialSamples(::gig::Sample* pSample, uint maxSamplesPerCycle, unsigned long preloadFrames) {
+        if (!pSample) {
+            dmsg(4,("gig::InstrumentResourceManager: Skipping sample (pSample == NULL)\n"));
+            return 0;
+        }
+        if (!pSample->SamplesTotal) return 0; // skip zero size samples
+
+        // loading sample data uses libgig's decompression buffer
+        LockGuard lock(LibGigMutex);
 
-        if (pSample->SamplesTotal <= CONFIG_PRELOAD_SAMPLES) {
+        const ::gig::buffer_t cache = pSample->GetCache();
+        const int64_t cachedBytes = int64_t(cache.Size) + cache.NullExtensionSize;
+        // Another instrument may already have cached the beginning of the
+        // sample, with a smaller preload. Its voices may be reading that
+        // cache, so it is kept and the rest is streamed. Only a cache of the
+        // whole sample may be reallocated for more silence samples.
+        const bool bCachedWhole = cache.Size >= (unsigned long) pSample->SamplesTotal * pSample->FrameSize;
+
+        if (pSample->SamplesTotal <= preloadFrames && (!cache.Size || bCachedWhole)) {
             // Sample is too short for disk streaming, so we load the whole
             // sample into RAM and place 'pAudioIO->FragmentSize << CONFIG_MAX_PITCH'
             // number of '0' samples (silence samples) behind the official buffer
@@ -709,11 +806,14 @@ namespace LinuxSampler { namespace gig {
                 dmsg(4,("Cached %llu Bytes, %llu silence bytes.\n", (long long)buf.Size, (long long)buf.NullExtensionSize));
             }
         }
-        else { // we only cache CONFIG_PRELOAD_SAMPLES and stream the other sample points from disk
-            if (!pSample->GetCache().Size) pSample->LoadSampleData(CONFIG_PRELOAD_SAMPLES);
+        else { // we only cache the beginning and stream the other sample points from disk
+            if (!cache.Size) pSample->LoadSampleData(preloadFrames);
         }
 
         if (!pSample->GetCache().Size) std::cerr << "Unable to cache sample - maybe memory full!" << std::endl << std::flush;
+
+        const int64_t newBytes = int64_t(pSample->GetCache().Size) + pSample->GetCache().NullExtensionSize - cachedBytes;
+        return (newBytes > 0) ? newBytes : 0;
     }
 
     void InstrumentResourceManager::UncacheInitialSamples(::gig::Sample* pSample) {
@@ -952,6 +1052,7 @@ namespace LinuxSampler { namespace gig {
 
     void InstrumentResourceManager::GigResourceManager::Destroy(::gig::File* pResource, void* pArg) {
         dmsg(1,("Freeing gig file '%s' from memory ...", pResource->GetFileName().c_str()));
+        LockGuard lock(parent->LibGigMutex);
 
         // Delete as much as possible of the gig file. Some of the
         // dimension regions and samples may still be in use - these
@@ -102,6 +102,7 @@ namespace LinuxSampler { namespace gig {
             void                       CacheInitialSamples(::gig::Sample* pSample, AbstractEngine* pEngine);
             void                       CacheInitialSamples(::gig::Sample* pSample, EngineChannel* pEngineChannel);
             void                       CacheInitialSamples(::gig::Sample* pSample, uint maxSamplesPerCycle);
+            int64_t                    CacheInitialSamples(::gig::Sample* pSample, uint maxSamplesPerCycle, unsigned long preloadFrames);
 
             typedef ResourceConsumer< ::gig::File> GigConsumer;
 
@@ -135,6 +136,7 @@ namespace LinuxSampler { namespace gig {
             Mutex             suspendedEnginesMutex; ///< protects 'suspendedEngines' set
             std::map< ::gig::Script*,String> pendingScriptUpdates; ///< Used to prepare updates of instrument scripts (value of the map is the original source code of the script before it is modified).
             Mutex                            pendingScriptUpdatesMutex; ///< Protectes 'pendingScriptUpdates'.
+            Mutex LibGigMutex; ///< libgig's sample decompression buffer and sample instance count are process wide, so creating, caching and deleting samples is serialized by this for all gig files
     };
 
 }} // namespace LinuxSampler::gig
@@ -79,6 +79,17 @@ namespace LinuxSampler { namespace gig {
         return total_readsamples;
     }
 
+    int Stream::GetReadResources(const void** ppResources) {
+        ::gig::Sample* pSample = pRegion->pSample;
+        // all samples of a gig file are read through the file's RIFF
+        // handles, compressed ones also share the disk thread's
+        // decompression buffer
+        ppResources[0] = pSample->GetParent();
+        if (!pSample->Compressed) return 1;
+        ppResources[1] = pDecompressionBuffer;
+        return 2;
+    }
+
     void Stream::Launch (
         Stream::Handle           hStream,
         reference_t*             pExportReference,
@@ -42,6 +42,7 @@ namespace LinuxSampler { namespace gig {
         public:
             Stream( ::gig::buffer_t* pDecompressionBuffer, uint BufferSize, uint BufferWrapElements);
             virtual long Read(uint8_t* pBuf, long SamplesToRead);
+            virtual int GetReadResources(const void** ppResources);
 
             void Launch (
                 Stream::Handle           hStream,
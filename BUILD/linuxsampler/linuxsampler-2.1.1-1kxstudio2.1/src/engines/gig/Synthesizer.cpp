@@ -26,6 +26,7 @@
 #include <stdio.h>
 
 #include "Synthesizer.h"
+#include "../../common/Features.h"
 
 #define SYNTHESIZE(CHAN,LOOP,FILTER,INTERPOLATE,BITDEPTH24)                           \
         Synthesizer<CHAN,LOOP,FILTER,INTERPOLATE,BITDEPTH24>::SynthesizeSubFragment(  \
@@ -161,8 +162,60 @@ namespace LinuxSampler { namespace gig {
         SYNTHESIZE(STEREO,1,1,1,1);
     }
 
+#if CONFIG_ASM && ARCH_X86
+    template<int MODE, synthesis_impl_t IMPL>
+    void SynthesizeFragment(SynthesisParam* pFinalParam, Loop* pLoop) {
+        Synthesizer<
+            (SYNTHESIS_MODE_GET_CHANNELS(MODE)) ? STEREO : MONO,
+            SYNTHESIS_MODE_GET_LOOP(MODE),
+            SYNTHESIS_MODE_GET_FILTER(MODE),
+            SYNTHESIS_MODE_GET_INTERPOLATE(MODE),
+            SYNTHESIS_MODE_GET_BITDEPTH24(MODE),
+            IMPL
+        >::SynthesizeSubFragment(pFinalParam, pLoop);
+    }
+
+    #define SYNTHESIZE_FRAGMENT_4(IMPL,MODE)       \
+        SynthesizeFragment<MODE + 0, IMPL>,      \
+        SynthesizeFragment<MODE + 1, IMPL>,      \
+        SynthesizeFragment<MODE + 2, IMPL>,      \
+        SynthesizeFragment<MODE + 3, IMPL>
+
+    #define SYNTHESIZE_FRAGMENT_32(IMPL)                                               \
+        SYNTHESIZE_FRAGMENT_4(IMPL,0x00), SYNTHESIZE_FRAGMENT_4(IMPL,0x04),          \
+        SYNTHESIZE_FRAGMENT_4(IMPL,0x08), SYNTHESIZE_FRAGMENT_4(IMPL,0x0c),          \
+        SYNTHESIZE_FRAGMENT_4(IMPL,0x10), SYNTHESIZE_FRAGMENT_4(IMPL,0x14),          \
+        SYNTHESIZE_FRAGMENT_4(IMPL,0x18), SYNTHESIZE_FRAGMENT_4(IMPL,0x1c)
+
+    static SynthesizeFragment_Fn* const SynthesizeFragmentSSE2[0x20] = { SYNTHESIZE_FRAGMENT_32(IMPL_SSE2) };
+    static SynthesizeFragment_Fn* const SynthesizeFragmentAVX2[0x20] = { SYNTHESIZE_FRAGMENT_32(IMPL_AVX2) };
+#endif // CONFIG_ASM && ARCH_X86
+
     void* GetSynthesisFunction(int SynthesisMode) {
-        // Mode Bits: (PROF),(IMPL),24BIT,CHAN,LOOP,FILT,INTERP
+        // Mode Bits: (PROF),IMPL,24BIT,CHAN,LOOP,FILT,INTERP
+        if (SYNTHESIS_MODE_GET_IMPLEMENTATION(SynthesisMode)) {
+            synthesis_impl_t impl = IMPL_CPP;
+            #if CONFIG_ASM && ARCH_X86
+            if (Features::supportsAVX2())
+                impl = IMPL_AVX2;
+            else if (Features::supportsSSE2())
+                impl = IMPL_SSE2;
+            #endif
+            return GetSynthesisFunction(SynthesisMode & ~0x20, impl);
+        }
+        return GetSynthesisFunction(SynthesisMode, IMPL_CPP);
+    }
+
+    void* GetSynthesisFunction(int SynthesisMode, synthesis_impl_t Implementation) {
+        #if CONFIG_ASM && ARCH_X86
+        if (SynthesisMode >= 0 && SynthesisMode < 0x20) {
+            switch (Implementation) {
+                case IMPL_AVX2: return (void*) SynthesizeFragmentAVX2[SynthesisMode];
+                case IMPL_SSE2: return (void*) SynthesizeFragmentSSE2[SynthesisMode];
+                default: break;
+            }
+        }
+        #endif
         switch (SynthesisMode) {
             case 0x00: return (void*) SynthesizeFragment_mode00;
             case 0x01: return (void*) SynthesizeFragment_mode01;
@@ -29,13 +29,14 @@
 #include "../common/Resampler.h"
 #include "Filter.h"
 #include "SynthesisParam.h"
+#include "SynthesizerSIMD.h"
 
 #define SYNTHESIS_MODE_SET_INTERPOLATE(iMode,bVal)      { if (bVal) iMode |= 0x01; else iMode &= ~0x01; }  /* (un)set mode bit 0 */
 #define SYNTHESIS_MODE_SET_FILTER(iMode,bVal)           { if (bVal) iMode |= 0x02; else iMode &= ~0x02; }   /* (un)set mode bit 1 */
 #define SYNTHESIS_MODE_SET_LOOP(iMode,bVal)             { if (bVal) iMode |= 0x04; else iMode &= ~0x04; }   /* (un)set mode bit 2 */
 #define SYNTHESIS_MODE_SET_CHANNELS(iMode,bVal)         { if (bVal) iMode |= 0x08; else iMode &= ~0x08; }   /* (un)set mode bit 3 */
 #define SYNTHESIS_MODE_SET_BITDEPTH24(iMode,bVal)       { if (bVal) iMode |= 0x10; else iMode &= ~0x10; }   /* (un)set mode bit 4 */
-//TODO: the Asm implementation mode is currently not implemented anymore, since Asm synthesis code is currently broken!
+// implementation bit: use the vectorized (SSE2 / AVX2) synthesis kernels if the CPU supports them
 #define SYNTHESIS_MODE_SET_IMPLEMENTATION(iMode,bVal)   { if (bVal) iMode |= 0x20; else iMode &= ~0x20; }   /* (un)set mode bit 5 */
 //TODO: the profiling mode is currently not implemented anymore!
 #define SYNTHESIS_MODE_SET_PROFILING(iMode,bVal)        { if (bVal) iMode |= 0x40; else iMode &= ~0x40; }   /* (un)set mode bit 6 */
@@ -53,6 +54,7 @@ namespace LinuxSampler { namespace gig {
     typedef void SynthesizeFragment_Fn(SynthesisParam* pFinalParam, Loop* pLoop);
 
     void* GetSynthesisFunction(const int SynthesisMode);
+    void* GetSynthesisFunction(const int SynthesisMode, synthesis_impl_t Implementation);
     void RunSynthesisFunction(const int SynthesisMode, SynthesisParam* pFinalParam, Loop* pLoop);
 
     enum channels_t {
@@ -65,8 +67,12 @@ namespace LinuxSampler { namespace gig {
      * Implementation of the main synthesis algorithms of the Gigasampler
      * format capable sampler engine. This means resampling / interpolation
      * for pitching the audio signal, looping, filter and amplification.
+     *
+     * With @a IMPL other than IMPL_CPP the sample conversion /
+     * interpolation and the amplification are done by the vectorized
+     * kernels of SynthesizerSIMD.h, block by block.
      */
-    template<channels_t CHANNELS, bool DOLOOP, bool USEFILTER, bool INTERPOLATE, bool BITDEPTH24>
+    template<channels_t CHANNELS, bool DOLOOP, bool USEFILTER, bool INTERPOLATE, bool BITDEPTH24, synthesis_impl_t IMPL = IMPL_CPP>
     class Synthesizer : public __RTMath<CPP>, public LinuxSampler::Resampler<INTERPOLATE,BITDEPTH24> {
 
             // declarations of derived functions (see "Name lookup,
@@ -81,6 +87,16 @@ namespace LinuxSampler { namespace gig {
         public:
         //protected:
 
+            /**
+             * Whether the vectorized kernels are used. The C++ loops for 16
+             * bit samples without pitching are vectorized by the compiler
+             * already, and with the (scalar) filter the 4 wide SSE2
+             * interpolation does not pay off.
+             */
+            enum {
+                VECTORIZED = IMPL != IMPL_CPP && (INTERPOLATE || BITDEPTH24) && !(IMPL == IMPL_SSE2 && USEFILTER)
+            };
+
             static void SynthesizeSubFragment(SynthesisParam* pFinalParam, Loop* pLoop) {
                 if (DOLOOP) {
                     const float fLoopEnd   = Float(pLoop->uiEnd);
@@ -153,6 +169,12 @@ namespace LinuxSampler { namespace gig {
             }
 
             static void SynthesizeSubSubFragment(SynthesisParam* pFinalParam, uint uiToGo) {
+#if CONFIG_ASM && ARCH_X86
+                if (VECTORIZED) {
+                    SynthesizeSubSubFragmentSIMD(pFinalParam, uiToGo);
+                    return;
+                }
+#endif
                 float fVolumeL = pFinalParam->fFinalVolumeLeft;
                 float fVolumeR = pFinalParam->fFinalVolumeRight;
                 sample_t* pSrc = pFinalParam->pSrc;
@@ -292,6 +314,85 @@ namespace LinuxSampler { namespace gig {
                 pFinalParam->pOutLeft  += uiToGo;
                 pFinalParam->uiToGo    -= uiToGo;
             }
+
+#if CONFIG_ASM && ARCH_X86
+            /**
+             * Same as SynthesizeSubSubFragment(), but using the vectorized
+             * kernels. The samples are converted / interpolated into a
+             * temporary buffer first and then mixed to the output buffers
+             * with the volume ramp, or filtered and mixed by scalar code if
+             * the filter is used.
+             */
+            static void SynthesizeSubSubFragmentSIMD(SynthesisParam* pFinalParam, uint uiToGo) {
+                // (never called without VECTORIZED, but still instantiated
+                // for IMPL_CPP, hence the dummy kernel choice)
+                typedef SynthesisKernel<IMPL == IMPL_CPP ? IMPL_SSE2 : IMPL> K;
+                enum { BLOCK = 64 };
+                const bool STEREO_SAMPLE = (CHANNELS == STEREO);
+                float bufL[BLOCK];
+                float bufR[BLOCK];
+                float fVolumeL = pFinalParam->fFinalVolumeLeft;
+                float fVolumeR = pFinalParam->fFinalVolumeRight;
+#ifdef CONFIG_INTERPOLATE_VOLUME
+                const float fDeltaL = pFinalParam->fFinalVolumeDeltaLeft;
+                const float fDeltaR = pFinalParam->fFinalVolumeDeltaRight;
+#else
+                const float fDeltaL = 0.0f;
+                const float fDeltaR = 0.0f;
+#endif
+                sample_t* pSrc = pFinalParam->pSrc;
+                float* pOutL   = pFinalParam->pOutLeft;
+                float* pOutR   = pFinalParam->pOutRight;
+                double dPos        = pFinalParam->dPos;
+                float fPitch       = pFinalParam->fFinalPitch;
+                Filter& filterL = pFinalParam->filterLeft;
+                Filter& filterR = pFinalParam->filterRight;
+
+                for (uint i = 0; i < uiToGo; i += BLOCK) {
+                    const int n = Min(uiToGo - i, uint(BLOCK));
+                    if (INTERPOLATE) {
+                        #if USE_LINEAR_INTERPOLATION
+                        K::template Interpolate<STEREO_SAMPLE,BITDEPTH24>(pSrc, &dPos, fPitch, n, bufL, bufR);
+                        #else
+                        // cubic interpolation has no vectorized kernel
+                        for (int k = 0; k < n; ++k) {
+                            if (STEREO_SAMPLE) {
+                                stereo_sample_t samplePoint = Interpolate1StepStereoCPP(pSrc, &dPos, fPitch);
+                                bufL[k] = samplePoint.left;
+                                bufR[k] = samplePoint.right;
+                            } else {
+                                bufL[k] = Interpolate1StepMonoCPP(pSrc, &dPos, fPitch);
+                            }
+                        }
+                        #endif
+                    } else {
+                        K::template Convert<STEREO_SAMPLE,BITDEPTH24>(pSrc, int(dPos) + i, n, bufL, bufR);
+                    }
+                    if (USEFILTER) {
+                        // the filter is recursive, so filter and amplify in one scalar pass
+                        for (int k = 0; k < n; ++k) {
+                            const float sampleL = filterL.Apply(bufL[k]);
+                            const float sampleR = (STEREO_SAMPLE) ? filterR.Apply(bufR[k]) : sampleL;
+                            fVolumeL += fDeltaL;
+                            fVolumeR += fDeltaR;
+                            pOutL[i + k] += sampleL * fVolumeL;
+                            pOutR[i + k] += sampleR * fVolumeR;
+                        }
+                    } else {
+                        fVolumeL = K::MixRamp(bufL, pOutL + i, n, fVolumeL, fDeltaL);
+                        fVolumeR = K::MixRamp(STEREO_SAMPLE ? bufR : bufL, pOutR + i, n, fVolumeR, fDeltaR);
+                    }
+                }
+
+                if (INTERPOLATE) pFinalParam->dPos = dPos; // advanced by the kernel
+                else pFinalParam->dPos += uiToGo;
+                pFinalParam->fFinalVolumeLeft = fVolumeL;
+                pFinalParam->fFinalVolumeRight = fVolumeR;
+                pFinalParam->pOutRight += uiToGo;
+                pFinalParam->pOutLeft  += uiToGo;
+                pFinalParam->uiToGo    -= uiToGo;
+            }
+#endif // CONFIG_ASM && ARCH_X86
     };
 
 }} // namespace LinuxSampler::gig
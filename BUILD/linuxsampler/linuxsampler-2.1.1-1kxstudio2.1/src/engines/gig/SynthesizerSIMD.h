@@ -0,0 +1,331 @@
+/***************************************************************************
+ *                                                                         *
+ *   LinuxSampler - modular, streaming capable sampler                     *
+ *                                                                         *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the Free Software           *
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston,                 *
+ *   MA  02111-1307  USA                                                   *
+ ***************************************************************************/
+
+#ifndef __LS_GIG_SYNTHESIZER_SIMD_H__
+#define __LS_GIG_SYNTHESIZER_SIMD_H__
+
+#include "../../common/global_private.h"
+
+namespace LinuxSampler { namespace gig {
+
+    /**
+     * Implementations of the synthesis inner loops, selected at runtime by
+     * GetSynthesisFunction() (see synthesis mode bit 5).
+     */
+    enum synthesis_impl_t {
+        IMPL_CPP,  ///< portable C++ implementation
+        IMPL_SSE2, ///< 4 samples per step
+        IMPL_AVX2  ///< 8 samples per step, requires AVX2
+    };
+
+}} // namespace LinuxSampler::gig
+
+#if CONFIG_ASM && ARCH_X86
+
+#include <immintrin.h>
+
+// The kernels are compiled for their instruction set regardless of the
+// compiler flags used for the rest of the sampler, the Synthesizer selects
+// one of them at runtime depending on what the CPU supports.
+#define LS_TARGET_SSE2  __attribute__((target("sse2")))
+#define LS_TARGET_AVX2  __attribute__((target("avx2")))
+
+namespace LinuxSampler { namespace gig {
+
+    /** @brief Vectorized synthesis kernels
+     *
+     * Each kernel works on a block of samples of a single voice and
+     * provides:
+     *
+     * - Interpolate(): linear interpolation of @a n output samples, starting
+     *   at playback position @a pPos and advancing it by @a fPitch per sample
+     * - Convert(): conversion of @a n samples starting at sample @a pos
+     *   without any pitching
+     * - MixRamp(): adds @a n samples multiplied with a linear volume ramp
+     *   to an output buffer and returns the resulting volume
+     *
+     * For mono samples only the left channel buffer is written. The playback
+     * position is accumulated sample by sample and the interpolation does the
+     * same float operations in the same order as the C++ implementation in
+     * Synthesizer and Resampler (no FMA), so Interpolate() and Convert() give
+     * exactly the same results. MixRamp() computes the volume of each sample
+     * directly instead of accumulating it, so with a volume ramp its result
+     * may differ from the C++ one by float rounding.
+     */
+    template<synthesis_impl_t IMPL> struct SynthesisKernel;
+
+    template<bool BITDEPTH24>
+    inline static int32_t SimdGetSample(const sample_t* src, int pos) {
+        if (BITDEPTH24) // x86 is little endian, same misaligned read as Synthesizer::getSample()
+            return (*((const int32_t*)(&((const char*)(src))[pos * 3]))) << 8;
+        else
+            return src[pos];
+    }
+
+    template<bool STEREO, bool BITDEPTH24>
+    inline static void SimdInterpolate1Step(const sample_t* pSrc, double dPos, float* pLeft, float* pRight) {
+        int   pos_int   = (int) dPos;
+        float pos_fract = dPos - pos_int;
+        if (STEREO) {
+            pos_int <<= 1;
+            int x1 = SimdGetSample<BITDEPTH24>(pSrc, pos_int);
+            int x2 = SimdGetSample<BITDEPTH24>(pSrc, pos_int + 2);
+            *pLeft = (x1 + pos_fract * (x2 - x1));
+            x1 = SimdGetSample<BITDEPTH24>(pSrc, pos_int + 1);
+            x2 = SimdGetSample<BITDEPTH24>(pSrc, pos_int + 3);
+            *pRight = (x1 + pos_fract * (x2 - x1));
+        } else {
+            int x1 = SimdGetSample<BITDEPTH24>(pSrc, pos_int);
+            int x2 = SimdGetSample<BITDEPTH24>(pSrc, pos_int + 1);
+            *pLeft = (x1 + pos_fract * (x2 - x1));
+        }
+    }
+
+    template<> struct SynthesisKernel<IMPL_SSE2> {
+        enum { WIDTH = 4 };
+
+        template<bool STEREO, bool BITDEPTH24>
+        LS_TARGET_SSE2 static void Interpolate(const sample_t* pSrc, double* pPos, float fPitch, int n, float* pLeft, float* pRight) {
+            int i = 0;
+            for (; i + WIDTH <= n; i += WIDTH) {
+                // accumulated like the C++ implementation, pos + i * pitch would round differently
+                double pos[WIDTH] __attribute__((aligned(16)));
+                for (int k = 0; k < WIDTH; ++k) {
+                    pos[k] = *pPos;
+                    *pPos += fPitch;
+                }
+                const __m128d pos01 = _mm_load_pd(pos);
+                const __m128d pos23 = _mm_load_pd(pos + 2);
+                const __m128i int01 = _mm_cvttpd_epi32(pos01);
+                const __m128i int23 = _mm_cvttpd_epi32(pos23);
+                const __m128 fract = _mm_movelh_ps(
+                    _mm_cvtpd_ps(_mm_sub_pd(pos01, _mm_cvtepi32_pd(int01))),
+                    _mm_cvtpd_ps(_mm_sub_pd(pos23, _mm_cvtepi32_pd(int23)))
+                );
+                int idx[WIDTH] __attribute__((aligned(16)));
+                _mm_store_si128((__m128i*) idx, _mm_unpacklo_epi64(int01, int23));
+                int x1[WIDTH] __attribute__((aligned(16)));
+                int x2[WIDTH] __attribute__((aligned(16)));
+                if (STEREO) {
+                    int y1[WIDTH] __attribute__((aligned(16)));
+                    int y2[WIDTH] __attribute__((aligned(16)));
+                    for (int k = 0; k < WIDTH; ++k) {
+                        const int p = idx[k] << 1;
+                        x1[k] = SimdGetSample<BITDEPTH24>(pSrc, p);
+                        y1[k] = SimdGetSample<BITDEPTH24>(pSrc, p + 1);
+                        x2[k] = SimdGetSample<BITDEPTH24>(pSrc, p + 2);
+                        y2[k] = SimdGetSample<BITDEPTH24>(pSrc, p + 3);
+                    }
+                    const __m128i r1 = _mm_load_si128((__m128i*) y1);
+                    const __m128i r2 = _mm_load_si128((__m128i*) y2);
+                    _mm_storeu_ps(pRight + i, _mm_add_ps(_mm_cvtepi32_ps(r1), _mm_mul_ps(fract, _mm_cvtepi32_ps(_mm_sub_epi32(r2, r1)))));
+                } else {
+                    for (int k = 0; k < WIDTH; ++k) {
+                        x1[k] = SimdGetSample<BITDEPTH24>(pSrc, idx[k]);
+                        x2[k] = SimdGetSample<BITDEPTH24>(pSrc, idx[k] + 1);
+                    }
+                }
+                // difference in integer arithmetic, like the C++ implementation
+                const __m128i l1 = _mm_load_si128((__m128i*) x1);
+                const __m128i l2 = _mm_load_si128((__m128i*) x2);
+                _mm_storeu_ps(pLeft + i, _mm_add_ps(_mm_cvtepi32_ps(l1), _mm_mul_ps(fract, _mm_cvtepi32_ps(_mm_sub_epi32(l2, l1)))));
+            }
+            for (; i < n; ++i) {
+                SimdInterpolate1Step<STEREO,BITDEPTH24>(pSrc, *pPos, pLeft + i, pRight + i);
+                *pPos += fPitch;
+            }
+        }
+
+        template<bool STEREO, bool BITDEPTH24>
+        LS_TARGET_SSE2 static void Convert(const sample_t* pSrc, int pos, int n, float* pLeft, float* pRight) {
+            int i = 0;
+            if (!BITDEPTH24) {
+                if (STEREO) {
+                    const sample_t* p = pSrc + (pos << 1);
+                    for (; i + WIDTH <= n; i += WIDTH) {
+                        const __m128i w = _mm_loadu_si128((const __m128i*)(p + (i << 1)));
+                        _mm_storeu_ps(pLeft  + i, _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(w, 16), 16)));
+                        _mm_storeu_ps(pRight + i, _mm_cvtepi32_ps(_mm_srai_epi32(w, 16)));
+                    }
+                } else {
+                    const sample_t* p = pSrc + pos;
+                    for (; i + 2 * WIDTH <= n; i += 2 * WIDTH) {
+                        const __m128i w = _mm_loadu_si128((const __m128i*)(p + i));
+                        // sign extend to 32 bits
+                        _mm_storeu_ps(pLeft + i,         _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(w, w), 16)));
+                        _mm_storeu_ps(pLeft + i + WIDTH, _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(w, w), 16)));
+                    }
+                }
+            }
+            // 24 bit samples: SSE2 has no gather, packed conversion is scalar
+            for (; i < n; ++i) {
+                if (STEREO) {
+                    pLeft[i]  = SimdGetSample<BITDEPTH24>(pSrc, ((pos + i) << 1));
+                    pRight[i] = SimdGetSample<BITDEPTH24>(pSrc, ((pos + i) << 1) + 1);
+                } else {
+                    pLeft[i]  = SimdGetSample<BITDEPTH24>(pSrc, pos + i);
+                }
+            }
+        }
+
+        LS_TARGET_SSE2 static float MixRamp(const float* pIn, float* pOut, int n, float fVolume, float fDelta) {
+            const __m128 vVolume = _mm_set1_ps(fVolume);
+            const __m128 vDelta  = _mm_set1_ps(fDelta);
+            const __m128 vStep   = _mm_set1_ps(WIDTH);
+            __m128 vIdx = _mm_set_ps(4.0f, 3.0f, 2.0f, 1.0f);
+            int i = 0;
+            for (; i + WIDTH <= n; i += WIDTH) {
+                const __m128 vol = _mm_add_ps(vVolume, _mm_mul_ps(vIdx, vDelta));
+                _mm_storeu_ps(pOut + i, _mm_add_ps(_mm_loadu_ps(pOut + i), _mm_mul_ps(_mm_loadu_ps(pIn + i), vol)));
+                vIdx = _mm_add_ps(vIdx, vStep);
+            }
+            for (; i < n; ++i)
+                pOut[i] += pIn[i] * (fVolume + (i + 1) * fDelta);
+            return fVolume + n * fDelta;
+        }
+    };
+
+    template<> struct SynthesisKernel<IMPL_AVX2> {
+        enum { WIDTH = 8 };
+
+        template<bool STEREO, bool BITDEPTH24>
+        LS_TARGET_AVX2 static void Interpolate(const sample_t* pSrc, double* pPos, float fPitch, int n, float* pLeft, float* pRight) {
+            int i = 0;
+            for (; i + WIDTH <= n; i += WIDTH) {
+                // accumulated like the C++ implementation, pos + i * pitch would round differently
+                double pos[WIDTH] __attribute__((aligned(32)));
+                for (int k = 0; k < WIDTH; ++k) {
+                    pos[k] = *pPos;
+                    *pPos += fPitch;
+                }
+                const __m256d posLo = _mm256_load_pd(pos);
+                const __m256d posHi = _mm256_load_pd(pos + 4);
+                const __m128i intLo = _mm256_cvttpd_epi32(posLo);
+                const __m128i intHi = _mm256_cvttpd_epi32(posHi);
+                const __m256i idx = _mm256_inserti128_si256(_mm256_castsi128_si256(intLo), intHi, 1);
+                const __m256 fract = _mm256_insertf128_ps(
+                    _mm256_castps128_ps256(_mm256_cvtpd_ps(_mm256_sub_pd(posLo, _mm256_cvtepi32_pd(intLo)))),
+                    _mm256_cvtpd_ps(_mm256_sub_pd(posHi, _mm256_cvtepi32_pd(intHi))), 1
+                );
+                __m256i x1, x2, y1, y2;
+                if (BITDEPTH24) {
+                    // misaligned 32 bit reads of 3 byte samples, shifted into the upper 24 bits
+                    const char* p = (const char*) pSrc;
+                    if (STEREO) {
+                        const __m256i off = _mm256_slli_epi32(_mm256_add_epi32(_mm256_add_epi32(idx, idx), idx), 1); // idx * 6
+                        x1 = _mm256_slli_epi32(_mm256_i32gather_epi32((const int*)(p),     off, 1), 8);
+                        y1 = _mm256_slli_epi32(_mm256_i32gather_epi32((const int*)(p + 3), off, 1), 8);
+                        x2 = _mm256_slli_epi32(_mm256_i32gather_epi32((const int*)(p + 6), off, 1), 8);
+                        y2 = _mm256_slli_epi32(_mm256_i32gather_epi32((const int*)(p + 9), off, 1), 8);
+                    } else {
+                        const __m256i off = _mm256_add_epi32(_mm256_add_epi32(idx, idx), idx); // idx * 3
+                        x1 = _mm256_slli_epi32(_mm256_i32gather_epi32((const int*)(p),     off, 1), 8);
+                        x2 = _mm256_slli_epi32(_mm256_i32gather_epi32((const int*)(p + 3), off, 1), 8);
+                    }
+                } else {
+                    if (STEREO) {
+                        // one 32 bit read gets the left and right sample of a frame
+                        const __m256i w1 = _mm256_i32gather_epi32((const int*)(pSrc),     idx, 4);
+                        const __m256i w2 = _mm256_i32gather_epi32((const int*)(pSrc + 2), idx, 4);
+                        x1 = _mm256_srai_epi32(_mm256_slli_epi32(w1, 16), 16);
+                        y1 = _mm256_srai_epi32(w1, 16);
+                        x2 = _mm256_srai_epi32(_mm256_slli_epi32(w2, 16), 16);
+                        y2 = _mm256_srai_epi32(w2, 16);
+                    } else {
+                        // one 32 bit read gets both neighbour samples
+                        const __m256i w = _mm256_i32gather_epi32((const int*)(pSrc), idx, 2);
+                        x1 = _mm256_srai_epi32(_mm256_slli_epi32(w, 16), 16);
+                        x2 = _mm256_srai_epi32(w, 16);
+                    }
+                }
+                // difference in integer arithmetic and no FMA, like the C++ implementation
+                _mm256_storeu_ps(pLeft + i, _mm256_add_ps(_mm256_cvtepi32_ps(x1), _mm256_mul_ps(fract, _mm256_cvtepi32_ps(_mm256_sub_epi32(x2, x1)))));
+                if (STEREO)
+                    _mm256_storeu_ps(pRight + i, _mm256_add_ps(_mm256_cvtepi32_ps(y1), _mm256_mul_ps(fract, _mm256_cvtepi32_ps(_mm256_sub_epi32(y2, y1)))));
+            }
+            for (; i < n; ++i) {
+                SimdInterpolate1Step<STEREO,BITDEPTH24>(pSrc, *pPos, pLeft + i, pRight + i);
+                *pPos += fPitch;
+            }
+        }
+
+        template<bool STEREO, bool BITDEPTH24>
+        LS_TARGET_AVX2 static void Convert(const sample_t* pSrc, int pos, int n, float* pLeft, float* pRight) {
+            int i = 0;
+            if (BITDEPTH24) {
+                const char* p = (const char*) pSrc;
+                const int stride = STEREO ? 6 : 3;
+                const __m256i vStep = _mm256_set1_epi32(WIDTH * stride);
+                __m256i off = _mm256_set1_epi32(pos * stride);
+                off = _mm256_add_epi32(off, _mm256_set_epi32(7 * stride, 6 * stride, 5 * stride, 4 * stride, 3 * stride, 2 * stride, stride, 0));
+                for (; i + WIDTH <= n; i += WIDTH) {
+                    _mm256_storeu_ps(pLeft + i, _mm256_cvtepi32_ps(_mm256_slli_epi32(_mm256_i32gather_epi32((const int*)(p), off, 1), 8)));
+                    if (STEREO)
+                        _mm256_storeu_ps(pRight + i, _mm256_cvtepi32_ps(_mm256_slli_epi32(_mm256_i32gather_epi32((const int*)(p + 3), off, 1), 8)));
+                    off = _mm256_add_epi32(off, vStep);
+                }
+            } else if (STEREO) {
+                const sample_t* p = pSrc + (pos << 1);
+                for (; i + WIDTH <= n; i += WIDTH) {
+                    const __m256i w = _mm256_loadu_si256((const __m256i*)(p + (i << 1)));
+                    _mm256_storeu_ps(pLeft  + i, _mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(w, 16), 16)));
+                    _mm256_storeu_ps(pRight + i, _mm256_cvtepi32_ps(_mm256_srai_epi32(w, 16)));
+                }
+            } else {
+                const sample_t* p = pSrc + pos;
+                for (; i + WIDTH <= n; i += WIDTH) {
+                    const __m128i w = _mm_loadu_si128((const __m128i*)(p + i));
+                    _mm256_storeu_ps(pLeft + i, _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(w)));
+                }
+            }
+            for (; i < n; ++i) {
+                if (STEREO) {
+                    pLeft[i]  = SimdGetSample<BITDEPTH24>(pSrc, ((pos + i) << 1));
+                    pRight[i] = SimdGetSample<BITDEPTH24>(pSrc, ((pos + i) << 1) + 1);
+                } else {
+                    pLeft[i]  = SimdGetSample<BITDEPTH24>(pSrc, pos + i);
+                }
+            }
+        }
+
+        LS_TARGET_AVX2 static float MixRamp(const float* pIn, float* pOut, int n, float fVolume, float fDelta) {
+            const __m256 vVolume = _mm256_set1_ps(fVolume);
+            const __m256 vDelta  = _mm256_set1_ps(fDelta);
+            const __m256 vStep   = _mm256_set1_ps(WIDTH);
+            __m256 vIdx = _mm256_set_ps(8.0f, 7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+            int i = 0;
+            for (; i + WIDTH <= n; i += WIDTH) {
+                const __m256 vol = _mm256_add_ps(vVolume, _mm256_mul_ps(vIdx, vDelta));
+                _mm256_storeu_ps(pOut + i, _mm256_add_ps(_mm256_loadu_ps(pOut + i), _mm256_mul_ps(_mm256_loadu_ps(pIn + i), vol)));
+                vIdx = _mm256_add_ps(vIdx, vStep);
+            }
+            for (; i < n; ++i)
+                pOut[i] += pIn[i] * (fVolume + (i + 1) * fDelta);
+            return fVolume + n * fDelta;
+        }
+    };
+
+}} // namespace LinuxSampler::gig
+
+#endif // CONFIG_ASM && ARCH_X86
+
+#endif // __LS_GIG_SYNTHESIZER_SIMD_H__
@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 #include <sstream>
+#include <map>
 
 #include "InstrumentResourceManager.h"
 #include "EngineChannel.h"
@@ -30,6 +31,7 @@
 
 #include "../../common/global_private.h"
 #include "../../common/Path.h"
+#include "../../common/RTMath.h"
 #include "../../plugins/InstrumentEditorFactory.h"
 
 
@@ -130,33 +132,71 @@ namespace LinuxSampler { namespace sf2 {
     }
 
     ::sf2::Preset* InstrumentResourceManager::Create(instrument_id_t Key, InstrumentConsumer* pConsumer, void*& pArg) {
+        // instruments of the same file are created one after another
+        FileGuard fileGuard(this, Key.FileName);
+        const uint64_t t0 = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+
         // get sfz file from internal sfz file manager
         ::sf2::File* pSf2 = Sf2s.Borrow(Key.FileName, reinterpret_cast<Sf2Consumer*>(Key.Index)); // conversion kinda hackish :/
 
-        dmsg(1,("Loading sf2 instrument ('%s',%d)...",Key.FileName.c_str(),Key.Index));
         ::sf2::Preset* pInstrument = GetSfInstrument(pSf2, Key.Index);
-        dmsg(1,("OK\n"));
+        const uint64_t t1 = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+        dmsg(1,("Loaded sf2 instrument ('%s',%d) in %.3f s\n",Key.FileName.c_str(),Key.Index,float(t1 - t0) / 1000000.f));
 
-        // cache initial samples points (for actually needed samples)
-        dmsg(1,("Caching initial samples..."));
-        float regTotal = 0, regCurrent = 0;
-        for (int i = 0 ; i < pInstrument->GetRegionCount() ; i++) {
-            ::sf2::Instrument* sf2Instr = pInstrument->GetRegion(i)->pInstrument;
-            if (sf2Instr) regTotal += sf2Instr->GetRegionCount();
-        }
+        // decide how much of each sample to cache, depending on how far
+        // the regions using it pitch it up
         uint maxSamplesPerCycle = GetMaxSamplesPerCycle(pConsumer);
+        std::vector<SamplePreload::request_t> preloads;
+        std::vector< ::sf2::Sample*> samples;
+        std::map< ::sf2::Sample*,size_t> sampleIndex;
         for (int i = 0 ; i < pInstrument->GetRegionCount() ; i++) {
-            ::sf2::Instrument* sf2Instr = pInstrument->GetRegion(i)->pInstrument;
-            if (sf2Instr) {
-                // pInstrument is ::sf2::Preset
-                for (int j = 0 ; j < sf2Instr->GetRegionCount() ; j++) {
-                    float localProgress = regCurrent++ / regTotal;
-                    DispatchResourceProgressEvent(Key, localProgress);
-                    CacheInitialSamples(sf2Instr->GetRegion(j)->GetSample(), maxSamplesPerCycle);
+            ::sf2::Region* pPresetRegion = pInstrument->GetRegion(i);
+            ::sf2::Instrument* sf2Instr = pPresetRegion->pInstrument;
+            if (!sf2Instr) continue;
+            // pInstrument is ::sf2::Preset
+            for (int j = 0 ; j < sf2Instr->GetRegionCount() ; j++) {
+                ::sf2::Region* pRegion = sf2Instr->GetRegion(j);
+                ::sf2::Sample* pSample = pRegion->GetSample();
+                if (!pSample) continue;
+                // the sf2 engine uses a fixed pitch bend range of 2 semitones
+                const int cents = (pRegion->hiKey - pRegion->GetUnityNote()) * 100 +
+                                  pRegion->GetCoarseTune(pPresetRegion) * 100 +
+                                  pRegion->GetFineTune(pPresetRegion) + 200;
+                const float pitch = (float) RTMath::CentsToFreqRatioUnlimited(cents);
+                const unsigned long loopEnd = pRegion->HasLoop ? pRegion->LoopEnd : 0;
+
+                std::map< ::sf2::Sample*,size_t>::iterator it = sampleIndex.find(pSample);
+                if (it == sampleIndex.end()) {
+                    SamplePreload::request_t req;
+                    req.Info.TotalFrames  = pSample->GetTotalFrameCount();
+                    req.Info.FrameSize    = pSample->GetFrameSize();
+                    req.Info.ChannelCount = pSample->GetChannelCount();
+                    req.Info.SampleRate   = pSample->SampleRate;
+                    req.Info.LoopEnd      = loopEnd;
+                    req.Info.MaxPitch     = pitch;
+                    req.Frames            = 0;
+                    sampleIndex[pSample] = preloads.size();
+                    preloads.push_back(req);
+                    samples.push_back(pSample);
+                } else {
+                    SamplePreload::sample_info_t& info = preloads[it->second].Info;
+                    if (pitch > info.MaxPitch) info.MaxPitch = pitch;
+                    if (loopEnd > info.LoopEnd) info.LoopEnd = loopEnd;
                 }
             }
         }
-        dmsg(1,("OK\n"));
+        const int64_t reservedBytes = SamplePreload::Plan(preloads, maxSamplesPerCycle);
+
+        // cache initial samples points (for actually needed samples)
+        int64_t preloadedBytes = 0;
+        for (size_t i = 0 ; i < samples.size() ; i++) {
+            float localProgress = (float) i / (float) samples.size();
+            DispatchResourceProgressEvent(Key, localProgress);
+            preloadedBytes += CacheInitialSamples(samples[i], maxSamplesPerCycle, preloads[i].Frames);
+        }
+        SamplePreload::AddPreloadedBytes(preloadedBytes, reservedBytes);
+        dmsg(1,("Cached initial samples of ('%s',%d) in %.3f s\n",Key.FileName.c_str(),Key.Index,
+                float(RTMath::unsafeMicroSeconds(RTMath::real_clock) - t1) / 1000000.f));
         DispatchResourceProgressEvent(Key, 1.0f); // done; notify all consumers about progress 100%
 
         // we need the following for destruction later
@@ -164,6 +204,7 @@ namespace LinuxSampler { namespace sf2 {
         pEntry->ID.FileName   = Key.FileName;
         pEntry->ID.Index      = Key.Index;
         pEntry->pFile         = pSf2;
+        pEntry->PreloadedBytes = preloadedBytes;
 
         // and we save this to check if we need to reallocate for an engine with higher value of 'MaxSamplesPerSecond'
         pEntry->MaxSamplesPerCycle = maxSamplesPerCycle;
@@ -177,6 +218,7 @@ namespace LinuxSampler { namespace sf2 {
         instr_entry_t* pEntry = (instr_entry_t*) pArg;
         // we don't need the .sf2 file here anymore
         Sf2s.HandBack(pEntry->pFile, reinterpret_cast<Sf2Consumer*>(pEntry->ID.Index)); // conversion kinda hackish :/
+        SamplePreload::AddPreloadedBytes(-pEntry->PreloadedBytes);
         delete pEntry;
     }
 
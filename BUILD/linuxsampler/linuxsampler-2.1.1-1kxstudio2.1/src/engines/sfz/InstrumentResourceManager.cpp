@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 #include <sstream>
+#include <map>
 
 #include "InstrumentResourceManager.h"
 #include "EngineChannel.h"
@@ -30,6 +31,7 @@
 
 #include "../../common/global_private.h"
 #include "../../common/Path.h"
+#include "../../common/RTMath.h"
 #include "../../plugins/InstrumentEditorFactory.h"
 
 
@@ -92,10 +94,13 @@ namespace LinuxSampler { namespace sfz {
     }
 
     ::sfz::Instrument* InstrumentResourceManager::Create(instrument_id_t Key, InstrumentConsumer* pConsumer, void*& pArg) {
+        // instruments of the same file are created one after another
+        FileGuard fileGuard(this, Key.FileName);
+        const uint64_t t0 = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+
         // get sfz file from internal sfz file manager
         ::sfz::File* pSfz = Sfzs.Borrow(Key.FileName, reinterpret_cast<SfzConsumer*>(Key.Index)); // conversion kinda hackish :/
 
-        dmsg(1,("Loading sfz instrument ('%s',%d)...",Key.FileName.c_str(),Key.Index));
         if (Key.Index) {
             std::stringstream msg;
             msg << "There's no instrument with index " << Key.Index << ".";
@@ -107,19 +112,55 @@ namespace LinuxSampler { namespace sfz {
             msg << "There's no instrument with index " << Key.Index << ".";
             throw InstrumentManagerException(msg.str());
         }
-        dmsg(1,("OK\n"));
+        const uint64_t t1 = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+        dmsg(1,("Loaded sfz instrument ('%s',%d) in %.3f s\n",Key.FileName.c_str(),Key.Index,float(t1 - t0) / 1000000.f));
 
-        // cache initial samples points (for actually needed samples)
-        dmsg(1,("Caching initial samples..."));
+        // decide how much of each sample to cache, depending on how far
+        // the regions using it pitch it up
         int regionCount = (int) pInstrument->regions.size();
         uint maxSamplesPerCycle = GetMaxSamplesPerCycle(pConsumer);
+        std::vector<SamplePreload::request_t> preloads;
+        std::vector<Sample*> samples;
+        std::map<Sample*,size_t> sampleIndex;
         for (int i = 0 ; i < regionCount ; i++) {
-            float localProgress = (float) i / (float) regionCount;
+            ::sfz::Region* pRegion = pInstrument->regions[i];
+            Sample* pSample = pRegion->GetSample();
+            if (!pSample) continue;
+            const int cents = (pRegion->hikey - pRegion->pitch_keycenter) * pRegion->pitch_keytrack +
+                              pRegion->transpose * 100 + pRegion->tune + std::max(pRegion->bend_up, 0);
+            const float pitch = (float) RTMath::CentsToFreqRatioUnlimited(cents);
+
+            std::map<Sample*,size_t>::iterator it = sampleIndex.find(pSample);
+            if (it == sampleIndex.end()) {
+                SamplePreload::request_t req;
+                req.Info.TotalFrames  = pSample->GetTotalFrameCount();
+                req.Info.FrameSize    = pSample->GetFrameSize();
+                req.Info.ChannelCount = pSample->GetChannelCount();
+                req.Info.SampleRate   = pSample->GetSampleRate();
+                req.Info.LoopEnd      = pRegion->HasLoop() ? pRegion->GetLoopEnd() : 0;
+                req.Info.MaxPitch     = pitch;
+                req.Frames            = 0;
+                sampleIndex[pSample] = preloads.size();
+                preloads.push_back(req);
+                samples.push_back(pSample);
+            } else {
+                SamplePreload::sample_info_t& info = preloads[it->second].Info;
+                if (pitch > info.MaxPitch) info.MaxPitch = pitch;
+                if (pRegion->HasLoop() && pRegion->GetLoopEnd() > info.LoopEnd) info.LoopEnd = pRegion->GetLoopEnd();
+            }
+        }
+        const int64_t reservedBytes = SamplePreload::Plan(preloads, maxSamplesPerCycle);
+
+        // cache initial samples points (for actually needed samples)
+        int64_t preloadedBytes = 0;
+        for (size_t i = 0 ; i < samples.size() ; i++) {
+            float localProgress = (float) i / (float) samples.size();
             DispatchResourceProgressEvent(Key, localProgress);
-            CacheInitialSamples(pInstrument->regions[i]->GetSample(), maxSamplesPerCycle);
-            //pInstrument->regions[i]->GetSample()->Close();
+            preloadedBytes += CacheInitialSamples(samples[i], maxSamplesPerCycle, preloads[i].Frames);
         }
-        dmsg(1,("OK\n"));
+        SamplePreload::AddPreloadedBytes(preloadedBytes, reservedBytes);
+        dmsg(1,("Cached initial samples of ('%s',%d) in %.3f s\n",Key.FileName.c_str(),Key.Index,
+                float(RTMath::unsafeMicroSeconds(RTMath::real_clock) - t1) / 1000000.f));
         DispatchResourceProgressEvent(Key, 1.0f); // done; notify all consumers about progress 100%
 
         // we need the following for destruction later
@@ -127,6 +168,7 @@ namespace LinuxSampler { namespace sfz {
         pEntry->ID.FileName   = Key.FileName;
         pEntry->ID.Index      = Key.Index;
         pEntry->pFile         = pSfz;
+        pEntry->PreloadedBytes = preloadedBytes;
 
         // and we save this to check if we need to reallocate for an engine with higher value of 'MaxSamplesPerSecond'
         pEntry->MaxSamplesPerCycle = maxSamplesPerCycle;
@@ -140,6 +182,7 @@ namespace LinuxSampler { namespace sfz {
         instr_entry_t* pEntry = (instr_entry_t*) pArg;
         // we don't need the .sfz file here anymore
         Sfzs.HandBack(pEntry->pFile, reinterpret_cast<SfzConsumer*>(pEntry->ID.Index)); // conversion kinda hackish :/
+        SamplePreload::AddPreloadedBytes(-pEntry->PreloadedBytes);
         delete pEntry;
     }
 
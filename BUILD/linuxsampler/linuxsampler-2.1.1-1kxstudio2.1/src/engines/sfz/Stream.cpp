@@ -73,6 +73,12 @@ namespace LinuxSampler { namespace sfz {
         return total_readsamples;
     }
 
+    int Stream::GetReadResources(const void** ppResources) {
+        // every sample file has its own sound file handle and position
+        ppResources[0] = pRegion->pSample;
+        return 1;
+    }
+
     void Stream::Kill() {
         if(pRegion) pSampleManager->SetSampleNotInUse(pRegion->pSample, pRegion);
         StreamBase< ::sfz::Region>::Kill();
@@ -34,6 +34,7 @@ namespace LinuxSampler { namespace sfz {
         public:
             Stream(uint BufferSize, uint BufferWrapElements, ::sfz::SampleManager* pSampleManager);
             virtual long Read(uint8_t* pBuf, long SamplesToRead);
+            virtual int GetReadResources(const void** ppResources);
             virtual void Kill();
 
             void Launch (
@@ -351,6 +351,11 @@ void parse_options(int argc, char **argv) {
             {"lscp-port",required_argument,0,0},
             {"stacktrace",no_argument,0,0},
             {"exec-after-init",required_argument,0,0},
+            {"render-threads",required_argument,0,0},
+            {"disk-reader-threads",required_argument,0,0},
+            {"preload-budget",required_argument,0,0},
+            {"shared-samples",no_argument,0,0},
+            {"loader-threads",required_argument,0,0},
             {0,0,0,0}
         };
 
@@ -377,6 +382,16 @@ void parse_options(int argc, char **argv) {
                     printf("--stacktrace                automatically shows stacktrace if crashes\n");
                     printf("                            (broken on most systems at the moment)\n");
                     printf("--exec-after-init           executes a command after initialization\n");
+                    printf("--render-threads            additional threads for rendering voices\n");
+                    printf("                            (default: 0)\n");
+                    printf("--disk-reader-threads       additional threads for refilling disk streams\n");
+                    printf("                            (default: 2)\n");
+                    printf("--preload-budget            max. RAM in MB for preloading samples\n");
+                    printf("                            (default: 0 = unlimited)\n");
+                    printf("--shared-samples            share cached sample data with other\n");
+                    printf("                            sampler processes on this host\n");
+                    printf("--loader-threads            additional threads for loading instruments\n");
+                    printf("                            (default: 2)\n");
                     exit(EXIT_SUCCESS);
                     break;
                 case 1: // --version
@@ -475,6 +490,41 @@ void parse_options(int argc, char **argv) {
                 case 10: // --exec-after-init
                     ExecAfterInit = optarg;
                     break;
+                case 11: { // --render-threads
+                    int threads = 0;
+                    if ((sscanf(optarg, "%d", &threads) != 1) || (threads < 0) || (threads > 64))
+                        printf("WARNING: Failed to parse render-threads argument, ignoring!\n");
+                    else
+                        GLOBAL_RENDER_THREADS = threads;
+                    break;
+                }
+                case 12: { // --disk-reader-threads
+                    int threads = 0;
+                    if ((sscanf(optarg, "%d", &threads) != 1) || (threads < 0) || (threads > 64))
+                        printf("WARNING: Failed to parse disk-reader-threads argument, ignoring!\n");
+                    else
+                        GLOBAL_DISK_READER_THREADS = threads;
+                    break;
+                }
+                case 13: { // --preload-budget
+                    int mb = 0;
+                    if ((sscanf(optarg, "%d", &mb) != 1) || (mb < 0))
+                        printf("WARNING: Failed to parse preload-budget argument, ignoring!\n");
+                    else
+                        GLOBAL_PRELOAD_BUDGET = mb;
+                    break;
+                }
+                case 14: // --shared-samples
+                    GLOBAL_SHARED_SAMPLES = true;
+                    break;
+                case 15: { // --loader-threads
+                    int threads = 0;
+                    if ((sscanf(optarg, "%d", &threads) != 1) || (threads < 0) || (threads > 64))
+                        printf("WARNING: Failed to parse loader-threads argument, ignoring!\n");
+                    else
+                        GLOBAL_LOADER_THREADS = threads;
+                    break;
+                }
             }
         }
     }
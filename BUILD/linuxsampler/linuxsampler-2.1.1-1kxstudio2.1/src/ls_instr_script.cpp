@@ -10,10 +10,13 @@
 #include "common/global.h"
 #include "scriptvm/ScriptVM.h"
 #include "shell/CFmt.h"
+#include "common/RTMath.h"
 #include "engines/common/InstrumentScriptVM.h"
 #include "engines/gig/InstrumentScriptVM.h"
 #include <iostream>
 #include <fstream>
+#include <unistd.h>
+#include <fcntl.h>
 
 /*
   This command line tool is currently merely for development and testing
@@ -29,6 +32,11 @@
   2. It dumps the parsed VM tree (only interesting for LS developers).
   3. If there were not parser errors, it will run each event handler defined in
      the script.
+
+  With --benchmark each event handler is executed repeatedly instead, once by
+  walking the parsed VM tree and once as bytecode, i.e.:
+
+  for f in src/scriptvm/examples/*.txt; do ls_instr_script core -f $f --benchmark; done
  */
 
 using namespace LinuxSampler;
@@ -61,6 +69,15 @@ static void printUsage() {
     cout << "            i.e. bench marking tasks and the like. By providing this " << endl;
     cout << "            argument auto suspension will be enabled." << endl;
     cout << endl;
+    cout << "        --tree" << endl;
+    cout << "            Execute the event handlers by walking the parsed VM tree" << endl;
+    cout << "            instead of executing their bytecode." << endl;
+    cout << endl;
+    cout << "        --benchmark [N]" << endl;
+    cout << "            Run each event handler N times (default: 1000) with both the" << endl;
+    cout << "            tree walking and the bytecode executor of the VM and print" << endl;
+    cout << "            the average execution times. Only for ENGINE \"core\"." << endl;
+    cout << endl;
     cout << "If you pass \"core\" as argument, only the core language built-in" << endl;
     cout << "variables and functions are available. However in this particular" << endl;
     cout << "mode the program will not just parse the given script, but also" << endl;
@@ -72,6 +89,7 @@ static void printUsage() {
 }
 
 static void printCodeWithSyntaxHighlighting(ScriptVM* vm);
+static void benchmark(ScriptVM* vm, VMParserContext* parserContext, int runs);
 static void dumpSyntaxHighlighting(ScriptVM* vm);
 static String readTxtFromFile(String path);
 
@@ -83,6 +101,7 @@ int main(int argc, char *argv[]) {
     String engine = argv[1];
     String path;
     bool runScript = false;
+    int benchmarkRuns = 0;
 
     ScriptVM* vm;
     if (engine == "core") {
@@ -116,6 +135,12 @@ int main(int argc, char *argv[]) {
             return 0;
         } else if (opt == "--auto-suspend") {
             vm->setAutoSuspendEnabled(true);
+        } else if (opt == "--tree") {
+            vm->setBytecodeEnabled(false);
+        } else if (opt == "--benchmark") {
+            benchmarkRuns = 1000;
+            if (iArg + 1 < argc && isdigit(argv[iArg + 1][0]))
+                benchmarkRuns = atoi(argv[++iArg]);
         } else if (opt == "-f" || opt == "--file") {
             if (++iArg < argc)
                 path = argv[iArg];
@@ -176,6 +201,13 @@ int main(int argc, char *argv[]) {
         return 0;
     }
 
+    if (benchmarkRuns > 0) {
+        benchmark(vm, parserContext, benchmarkRuns);
+        if (parserContext) delete parserContext;
+        if (vm) delete vm;
+        return 0;
+    }
+
     printf("Preparing execution of script.\n");
     VMExecContext* execContext = vm->createExecContext(parserContext);
     for (int i = 0; parserContext->eventHandler(i); ++i) {
@@ -209,6 +241,49 @@ int main(int argc, char *argv[]) {
     return 0;
 }
 
+static float averageExecTime(ScriptVM* vm, VMParserContext* parserContext,
+                             VMEventHandler* handler, int runs)
+{
+    VMExecContext* execContext = vm->createExecContext(parserContext);
+    RTMath::usecs_t t = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+    for (int i = 0; i < runs; ++i) {
+        // suspended handlers (i.e. by wait()) are resumed immediately
+        while (vm->exec(parserContext, execContext, handler) & VM_EXEC_SUSPENDED);
+    }
+    t = RTMath::unsafeMicroSeconds(RTMath::real_clock) - t;
+    delete execContext;
+    return float(t) / runs;
+}
+
+static void benchmark(ScriptVM* vm, VMParserContext* parserContext, int runs) {
+    const bool bytecode = vm->isBytecodeEnabled();
+
+    printf("[Benchmark: %d runs per event handler]\n", runs);
+    for (int i = 0; parserContext->eventHandler(i); ++i) {
+        VMEventHandler* handler = parserContext->eventHandler(i);
+
+        // don't measure the output of message() calls
+        fflush(stdout);
+        const int out = dup(STDOUT_FILENO);
+        const int null = open("/dev/null", O_WRONLY);
+        dup2(null, STDOUT_FILENO);
+
+        vm->setBytecodeEnabled(false);
+        const float tree = averageExecTime(vm, parserContext, handler, runs);
+        vm->setBytecodeEnabled(true);
+        const float bc = averageExecTime(vm, parserContext, handler, runs);
+
+        fflush(stdout);
+        dup2(out, STDOUT_FILENO);
+        close(null);
+        close(out);
+
+        printf("%-12s tree: %10.2f us  bytecode: %10.2f us  speedup: %5.2fx\n",
+               handler->eventHandlerName().c_str(), tree, bc, (bc > 0.f) ? tree / bc : 0.f);
+    }
+    vm->setBytecodeEnabled(bytecode);
+}
+
 static void printCodeWithSyntaxHighlighting(ScriptVM* vm) {
     vector<VMSourceToken> tokens = vm->syntaxHighlighting(&std::cin);
 
@@ -267,6 +267,8 @@ command               :  ADD SP add_instruction                { $$ = $3;
                       |  APPEND SP append_instruction          { $$ = $3;                                                }
                       |  INSERT SP insert_instruction          { $$ = $3;                                                }
                       |  RESET                                 { $$ = LSCPSERVER->ResetSampler();                        }
+                      |  BEGIN SP BATCH                        { $$ = LSCPSERVER->BeginBatch((yyparse_param_t*) yyparse_param); }
+                      |  END SP BATCH                          { $$ = LSCPSERVER->EndBatch((yyparse_param_t*) yyparse_param); }
                       |  QUIT                                  { LSCPSERVER->AnswerClient("Bye!\r\n"); return LSCP_QUIT; }
                       ;
 
@@ -402,6 +404,7 @@ get_instruction       :  AVAILABLE_ENGINES
                       |  CHANNEL SP INFO SP sampler_channel                                         { $$ = LSCPSERVER->GetChannelInfo($5);                             }
                       |  CHANNEL SP BUFFER_FILL SP buffer_size_type SP sampler_channel              { $$ = LSCPSERVER->GetBufferFill($5, $7);                          }
                       |  CHANNEL SP STREAM_COUNT SP sampler_channel                                 { $$ = LSCPSERVER->GetStreamCount($5);                             }
+                      |  CHANNEL SP STREAM_STATS SP sampler_channel                                 { $$ = LSCPSERVER->GetStreamStats($5);                             }
                       |  CHANNEL SP VOICE_COUNT SP sampler_channel                                  { $$ = LSCPSERVER->GetVoiceCount($5);                              }
                       |  ENGINE SP INFO SP engine_name                                              { $$ = LSCPSERVER->GetEngineInfo($5);                              }
                       |  SERVER SP INFO                                                             { $$ = LSCPSERVER->GetServerInfo();                                }
@@ -1045,6 +1048,9 @@ BUFFER_FILL          :  'B''U''F''F''E''R''_''F''I''L''L'
 STREAM_COUNT         :  'S''T''R''E''A''M''_''C''O''U''N''T'
                      ;
 
+STREAM_STATS         :  'S''T''R''E''A''M''_''S''T''A''T''S'
+                     ;
+
 VOICE_COUNT          :  'V''O''I''C''E''_''C''O''U''N''T'
                      ;
 
@@ -1294,6 +1300,15 @@ DOC                   :  'D''O''C'
 QUIT                  :  'Q''U''I''T'
                       ;
 
+BEGIN                 :  'B''E''G''I''N'
+                      ;
+
+END                   :  'E''N''D'
+                      ;
+
+BATCH                 :  'B''A''T''C''H'
+                      ;
+
 %%
 
 // TODO: actually would be fine to have the following bunch of source code in a separate file, however those functions are a) accessing private Bison tables like yytable and b) including the functions from another file here would make the line numbers incorrect on compile errors in auto generated lscpparser.cpp
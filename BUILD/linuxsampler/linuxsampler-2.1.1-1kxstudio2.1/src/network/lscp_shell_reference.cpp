@@ -2508,9 +2508,19 @@ static lscp_ref_entry_t lscp_reference[] = {
       "ed:\n\nNAME - arbitrary character string naming the port\n\nThe field"
       "above is only the one which is returned by all MIDI ports regardless o"
       "f the MIDI driver and port. Every MIDI port might have its own, additi"
-      "onal driver and port specific parameters.\n\nExample:\n\nC: \"GET MIDI"
-      "_INPUT_PORT INFO 0 0\"\n\nS: \"NAME: 'Masterkeyboard'\"\n\n\"ALSA_SEQ_"
-      "BINDINGS: '64:0'\"\n\n\".\"\n\n"
+      "onal driver and port specific parameters.\n\nThe ALSA MIDI driver for"
+      "example adds the port parameters LATENCY and LATENCY_HISTOGRAM. LATENC"
+      "Y is a constant delay (in milliseconds, default 0) applied to all even"
+      "ts after the kernel received them. As long as the MIDI input thread ge"
+      "ts scheduled within that time, events are played without any timing ji"
+      "tter. With 0, events are played as early as possible, corrected only b"
+      "y the time they were waiting for the MIDI input thread. LATENCY_HISTOG"
+      "RAM is read only and reports how long events were waiting for the MIDI"
+      " input thread, e.g. 'EVENTS=120 LATE=0 MAX=0.731ms 0-0.25ms=101 0.25-0"
+      ".5ms=17 ...', where LATE counts events which waited longer than LATENC"
+      "Y. Setting LATENCY resets the histogram.\n\nExample:\n\nC: \"GET MIDI_"
+      "INPUT_PORT INFO 0 0\"\n\nS: \"NAME: 'Masterkeyboard'\"\n\n\"ALSA_SEQ_B"
+      "INDINGS: '64:0'\"\n\n\".\"\n\n"
     },
     { "ADD SEND_EFFECT_CHAIN",
       "The front-end can add a send effect chain by sending the following com"
@@ -2801,6 +2811,72 @@ static lscp_ref_entry_t lscp_reference[] = {
       "r will answer by returning the number of active voices on that channel"
       ".\n\nExample:\n\n\n\n"
     },
+    { "GET CHANNEL STREAM_STATS",
+      "The front-end can ask for statistics of the disk streaming engine serv"
+      "ing a sampler channel by sending the following command:\n\nGET CHANNEL"
+      " STREAM_STATS <sampler-channel>\n\nWhere <sampler-channel> is the samp"
+      "ler channel number the front-end is interested in as returned by the "
+      "\"ADD CHANNEL\" or \"LIST CHANNELS\" command. The disk streams are shar"
+      "ed by all sampler channels using the same engine type and audio output"
+      " device, so are these statistics.\n\nPossible Answers:\n\nLinuxSampler"
+      " will answer by sending a <CRLF> separated list. Each answer line begi"
+      "ns with the information category name followed by a colon and then a s"
+      "pace character <SP> and finally the info character string to that info"
+      " category. At the moment the following categories are defined:\n\nUNDE"
+      "RRUNS - number of times a voice did not find the sample data it needed"
+      " in its disk stream since the engine was (re)connected\n\nQUEUE_DEPTH"
+      "- number of disk streams currently waiting to be refilled\n\nQUEUE_DEP"
+      "TH_MAX - maximum number of disk streams that were waiting to be refill"
+      "ed at the same time\n\nREADER_THREADS - number of threads refilling di"
+      "sk streams in parallel to the disk thread\n\nPRELOAD_BYTES - amount of"
+      " RAM (in bytes) currently used for caching the beginning of the sample"
+      "s of all loaded instruments\n\nPRELOAD_BUDGET - maximum amount of RAM"
+      "(in bytes) to be used for caching samples, 0 if unlimited\n\nSTREAMING"
+      "_LATENCY - time (in seconds) a new disk stream is assumed to take unti"
+      "l it delivers its first data, the size of the cached part of each samp"
+      "le is based on it\n\nThe mentioned fields above don't have to be in pa"
+      "rticular order. If the engine doesn't support disk streaming an error"
+      "message is returned instead.\n\nExample:\n\nC: \"GET CHANNEL STREAM_ST"
+      "ATS 0\"\n\nS: \"UNDERRUNS: 0\"\n\n\"QUEUE_DEPTH: 3\"\n\n\"QUEUE_DEPTH_"
+      "MAX: 41\"\n\n\"READER_THREADS: 2\"\n\n\"PRELOAD_BYTES: 183500800\"\n\n"
+      "\"PRELOAD_BUDGET: 0\"\n\n\"STREAMING_LATENCY: 0.062\"\n\n\".\"\n\n"
+    },
+    { "END BATCH",
+      "The client ends a batch started by \"BEGIN BATCH\" by sending the foll"
+      "owing command:\n\nEND BATCH\n\nLinuxSampler waits until all instrument"
+      " loads of the batch completed and then sends the answers of all comman"
+      "ds of the batch in their original order. If an instrument load of the"
+      "batch failed, the answer of the respective \"LOAD INSTRUMENT\" command"
+      " is replaced by the error of the load. Finally a summary of the batch"
+      "is sent as multi-line response.\n\nPossible Answers:\n\nThe answers of"
+      " all commands of the batch, followed by the following summary, each on"
+      " a separate line: COMMANDS - number of commands executed within the ba"
+      "tch\n\nERRORS - number of commands which failed\n\nWARNINGS - number o"
+      "f commands which answered with a warning\n\nINSTRUMENT_LOADS - number"
+      "of instrument loads requested within the batch\n\nFAILED_LOADS - numbe"
+      "r of those instrument loads which failed\n\nTIME - seconds elapsed bet"
+      "ween \"BEGIN BATCH\" and the completion of the batch\n\n\"ERR:<error-c"
+      "ode>:<error-message>\" - if no batch was started on this connection\n"
+      "\nExample:\n\nC: \"END BATCH\"\n\nS: \"OK\"\n\n\"OK\"\n\n\"COMMANDS: 2"
+      "\"\n\n\"ERRORS: 0\"\n\n\"WARNINGS: 0\"\n\n\"INSTRUMENT_LOADS: 1\"\n\n\""
+      "FAILED_LOADS: 0\"\n\n\"TIME: 1.204\"\n\n\".\"\n\n"
+    },
+    { "BEGIN BATCH",
+      "The client can send a whole session setup, e.g. the content of a .lscp"
+      " file, as one batch of commands by sending the following command first"
+      ":\n\nBEGIN BATCH\n\nAll following commands of the client connection ar"
+      "e executed as usual, but their answers are held back until the batch i"
+      "s ended by \"END BATCH\" . Instrument loads requested within the batch"
+      " are executed in the background, so the sampler already processes the"
+      "next commands while instruments are loading. Loads on the same sampler"
+      " channel are still executed in the order they were requested, and comm"
+      "ands which replace or remove the engine of a sampler channel wait for"
+      "the pending loads of that channel first.\n\nBatches are not available"
+      "while the LSCP shell interaction mode is enabled (\"SET SHELL INTERACT"
+      "\").\n\nPossible Answers:\n\n\"OK\" - on success\n\n\"ERR:<error-code>"
+      ":<error-message>\" - if a batch was already started on this connection"
+      "\n\nExample:\n\nC: \"BEGIN BATCH\"\n\nS: \"OK\"\n\n"
+    },
 };
 
 lscp_ref_entry_t* lscp_reference_for_command(const char* cmd) {
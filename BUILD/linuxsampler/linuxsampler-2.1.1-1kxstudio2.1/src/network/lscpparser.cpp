@@ -497,18 +497,18 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  64
+#define YYFINAL  69
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   5021
+#define YYLAST   5053
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  100
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  233
+#define YYNNTS  237
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  669
+#define YYNRULES  676
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  2662
+#define YYNSTATES  2694
 
 #define YYUNDEFTOK  2
 #define YYMAXUTOK   258
@@ -557,70 +557,71 @@ static const yytype_uint16 yyrline[] =
        0,   227,   227,   228,   231,   232,   235,   236,   237,   240,
      241,   242,   243,   244,   247,   248,   249,   250,   251,   252,
      253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
-     263,   264,   265,   266,   267,   268,   269,   270,   273,   274,
+     263,   264,   265,   266,   267,   268,   269,   270,   271,   272,
      275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   290,   291,   292,   293,   294,   295,   296,
+     285,   286,   287,   288,   289,   292,   293,   294,   295,   296,
      297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
      307,   308,   309,   310,   311,   312,   313,   314,   315,   316,
-     317,   318,   319,   322,   323,   324,   325,   326,   327,   328,
+     317,   318,   319,   320,   321,   324,   325,   326,   327,   328,
      329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
      339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
-     349,   350,   351,   354,   355,   356,   357,   360,   363,   364,
+     349,   350,   351,   352,   353,   356,   357,   358,   359,   362,
      365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     377,   378,   379,   380,   381,   382,   383,   384,   385,   386,
+     375,   376,   379,   380,   381,   382,   383,   384,   385,   386,
      387,   388,   389,   390,   391,   392,   393,   394,   395,   396,
      397,   398,   399,   400,   401,   402,   403,   404,   405,   406,
      407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
      417,   418,   419,   420,   421,   422,   423,   424,   425,   426,
-     427,   428,   429,   432,   433,   434,   435,   436,   437,   438,
+     427,   428,   429,   430,   431,   432,   435,   436,   437,   438,
      439,   440,   441,   442,   443,   444,   445,   446,   447,   448,
-     449,   450,   451,   452,   453,   454,   455,   456,   459,   460,
-     461,   462,   463,   464,   465,   466,   469,   472,   473,   476,
-     477,   478,   479,   480,   483,   484,   487,   488,   491,   492,
-     493,   494,   497,   498,   501,   504,   507,   508,   509,   510,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,   458,
+     459,   462,   463,   464,   465,   466,   467,   468,   469,   472,
+     475,   476,   479,   480,   481,   482,   483,   486,   487,   490,
+     491,   494,   495,   496,   497,   500,   501,   504,   507,   510,
      511,   512,   513,   514,   515,   516,   517,   518,   519,   520,
-     523,   526,   529,   530,   533,   534,   537,   538,   541,   542,
-     543,   544,   545,   546,   547,   548,   549,   550,   551,   552,
-     553,   554,   555,   556,   557,   558,   559,   562,   565,   566,
-     569,   572,   573,   574,   577,   580,   583,   586,   589,   592,
-     593,   596,   599,   602,   605,   608,   611,   612,   615,   618,
-     621,   624,   627,   630,   640,   643,   646,   649,   652,   655,
-     658,   661,   664,   667,   668,   672,   673,   674,   675,   678,
-     679,   682,   683,   686,   687,   688,   691,   694,   702,   703,
-     706,   707,   708,   711,   712,   713,   714,   715,   716,   720,
-     721,   724,   725,   726,   727,   728,   729,   730,   731,   732,
-     733,   736,   737,   738,   739,   740,   741,   742,   743,   746,
-     747,   748,   749,   750,   751,   752,   753,   754,   755,   756,
+     521,   522,   523,   526,   529,   532,   533,   536,   537,   540,
+     541,   544,   545,   546,   547,   548,   549,   550,   551,   552,
+     553,   554,   555,   556,   557,   558,   559,   560,   561,   562,
+     565,   568,   569,   572,   575,   576,   577,   580,   583,   586,
+     589,   592,   595,   596,   599,   602,   605,   608,   611,   614,
+     615,   618,   621,   624,   627,   630,   633,   643,   646,   649,
+     652,   655,   658,   661,   664,   667,   670,   671,   675,   676,
+     677,   678,   681,   682,   685,   686,   689,   690,   691,   694,
+     697,   705,   706,   709,   710,   711,   714,   715,   716,   717,
+     718,   719,   723,   724,   727,   728,   729,   730,   731,   732,
+     733,   734,   735,   736,   739,   740,   741,   742,   743,   744,
+     745,   746,   749,   750,   751,   752,   753,   754,   755,   756,
      757,   758,   759,   760,   761,   762,   763,   764,   765,   766,
-     767,   770,   771,   772,   773,   774,   775,   776,   777,   778,
-     779,   782,   783,   786,   789,   790,   793,   794,   795,   798,
-     799,   802,   803,   806,   807,   808,   809,   813,   814,   815,
-     816,   819,   820,   821,   822,   825,   826,   829,   830,   831,
-     832,   836,   837,   838,   842,   842,   842,   842,   842,   842,
-     842,   842,   842,   842,   842,   842,   842,   842,   842,   842,
-     842,   842,   842,   842,   842,   842,   842,   842,   842,   842,
-     843,   843,   843,   843,   843,   843,   843,   843,   843,   843,
-     843,   843,   843,   843,   843,   843,   843,   843,   843,   843,
-     843,   843,   843,   843,   843,   843,   847,   848,   848,   848,
-     848,   848,   848,   848,   848,   848,   848,   849,   849,   849,
-     849,   849,   849,   849,   849,   849,   849,   849,   849,   850,
-     850,   850,   850,   850,   850,   850,   851,   851,   851,   851,
-     852,   852,   852,   852,   853,   856,   857,   858,   859,   860,
-     861,   862,   863,   864,   865,   866,   869,   870,   871,   874,
-     875,   880,   883,   886,   889,   892,   895,   898,   901,   904,
-     907,   910,   913,   916,   919,   922,   925,   928,   931,   934,
-     937,   940,   943,   946,   949,   952,   955,   958,   961,   964,
-     967,   970,   973,   976,   979,   982,   985,   988,   991,   994,
-     997,  1000,  1003,  1006,  1009,  1012,  1015,  1018,  1021,  1024,
-    1027,  1030,  1033,  1036,  1039,  1042,  1045,  1048,  1051,  1054,
-    1057,  1060,  1063,  1066,  1069,  1072,  1075,  1078,  1081,  1084,
-    1087,  1090,  1093,  1096,  1099,  1102,  1105,  1108,  1111,  1114,
-    1117,  1120,  1123,  1126,  1129,  1132,  1135,  1138,  1141,  1144,
-    1147,  1150,  1153,  1156,  1159,  1162,  1165,  1168,  1171,  1174,
-    1177,  1180,  1183,  1186,  1189,  1192,  1195,  1198,  1201,  1204,
-    1207,  1210,  1213,  1216,  1219,  1222,  1225,  1228,  1231,  1234,
-    1237,  1240,  1243,  1246,  1249,  1252,  1255,  1258,  1261,  1264,
-    1267,  1270,  1273,  1276,  1279,  1282,  1285,  1288,  1291,  1294
+     767,   768,   769,   770,   773,   774,   775,   776,   777,   778,
+     779,   780,   781,   782,   785,   786,   789,   792,   793,   796,
+     797,   798,   801,   802,   805,   806,   809,   810,   811,   812,
+     816,   817,   818,   819,   822,   823,   824,   825,   828,   829,
+     832,   833,   834,   835,   839,   840,   841,   845,   845,   845,
+     845,   845,   845,   845,   845,   845,   845,   845,   845,   845,
+     845,   845,   845,   845,   845,   845,   845,   845,   845,   845,
+     845,   845,   845,   846,   846,   846,   846,   846,   846,   846,
+     846,   846,   846,   846,   846,   846,   846,   846,   846,   846,
+     846,   846,   846,   846,   846,   846,   846,   846,   846,   850,
+     851,   851,   851,   851,   851,   851,   851,   851,   851,   851,
+     852,   852,   852,   852,   852,   852,   852,   852,   852,   852,
+     852,   852,   853,   853,   853,   853,   853,   853,   853,   854,
+     854,   854,   854,   855,   855,   855,   855,   856,   859,   860,
+     861,   862,   863,   864,   865,   866,   867,   868,   869,   872,
+     873,   874,   877,   878,   883,   886,   889,   892,   895,   898,
+     901,   904,   907,   910,   913,   916,   919,   922,   925,   928,
+     931,   934,   937,   940,   943,   946,   949,   952,   955,   958,
+     961,   964,   967,   970,   973,   976,   979,   982,   985,   988,
+     991,   994,   997,  1000,  1003,  1006,  1009,  1012,  1015,  1018,
+    1021,  1024,  1027,  1030,  1033,  1036,  1039,  1042,  1045,  1048,
+    1051,  1054,  1057,  1060,  1063,  1066,  1069,  1072,  1075,  1078,
+    1081,  1084,  1087,  1090,  1093,  1096,  1099,  1102,  1105,  1108,
+    1111,  1114,  1117,  1120,  1123,  1126,  1129,  1132,  1135,  1138,
+    1141,  1144,  1147,  1150,  1153,  1156,  1159,  1162,  1165,  1168,
+    1171,  1174,  1177,  1180,  1183,  1186,  1189,  1192,  1195,  1198,
+    1201,  1204,  1207,  1210,  1213,  1216,  1219,  1222,  1225,  1228,
+    1231,  1234,  1237,  1240,  1243,  1246,  1249,  1252,  1255,  1258,
+    1261,  1264,  1267,  1270,  1273,  1276,  1279,  1282,  1285,  1288,
+    1291,  1294,  1297,  1300,  1303,  1306,  1309
 };
 #endif
 
@@ -676,9 +677,9 @@ static const char *const yytname[] =
   "DB_INSTRUMENT_COUNT", "DB_INSTRUMENT_INFO", "DB_INSTRUMENT_FILES",
   "DB_INSTRUMENTS_JOB_INFO", "CHANNEL_COUNT", "CHANNEL_MIDI",
   "DEVICE_MIDI", "CHANNEL_INFO", "FX_SEND_COUNT", "FX_SEND_INFO",
-  "BUFFER_FILL", "STREAM_COUNT", "VOICE_COUNT", "TOTAL_STREAM_COUNT",
-  "TOTAL_VOICE_COUNT", "TOTAL_VOICE_COUNT_MAX", "GLOBAL_INFO",
-  "EFFECT_INSTANCE_COUNT", "EFFECT_INSTANCE_INFO",
+  "BUFFER_FILL", "STREAM_COUNT", "STREAM_STATS", "VOICE_COUNT",
+  "TOTAL_STREAM_COUNT", "TOTAL_VOICE_COUNT", "TOTAL_VOICE_COUNT_MAX",
+  "GLOBAL_INFO", "EFFECT_INSTANCE_COUNT", "EFFECT_INSTANCE_INFO",
   "SEND_EFFECT_CHAIN_COUNT", "SEND_EFFECT_CHAIN_INFO", "INSTRUMENT",
   "INSTRUMENTS", "ENGINE", "ON_DEMAND", "ON_DEMAND_HOLD", "PERSISTENT",
   "AUDIO_OUTPUT_DEVICE_PARAMETER", "AUDIO_OUTPUT_DEVICES",
@@ -699,7 +700,8 @@ static const char *const yytname[] =
   "FORCE", "FLAT", "RECURSIVE", "NON_RECURSIVE", "LOST", "FILE_PATH",
   "SERVER", "VOLUME", "LEVEL", "VALUE", "MUTE", "SOLO", "VOICES",
   "STREAMS", "BYTES", "PERCENTAGE", "FILE", "EDIT", "FORMAT", "MIDI_DATA",
-  "RESET", "MISCELLANEOUS", "NAME", "ECHO", "DOC", "QUIT", YY_NULLPTR
+  "RESET", "MISCELLANEOUS", "NAME", "ECHO", "DOC", "QUIT", "BEGIN", "END",
+  "BATCH", YY_NULLPTR
 };
 #endif
 
@@ -721,12 +723,12 @@ static const yytype_uint16 yytoknum[] =
 };
 # endif
 
-#define YYPACT_NINF -1718
+#define YYPACT_NINF -1730
 
 #define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-1718)))
+  (!!((Yystate) == (-1730)))
 
-#define YYTABLE_NINF -382
+#define YYTABLE_NINF -385
 
 #define yytable_value_is_error(Yytable_value) \
   0
@@ -735,273 +737,276 @@ static const yytype_uint16 yytoknum[] =
      STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     893, -1718, -1718,   116,   128,    47,    75,    95,   145,   246,
-     379,   148,   194,   268,    91,   381,   395, -1718,   358,  3095,
-   -1718,   411,   411,   411,   411,   411,   411,   411,   411,   411,
-     411,   411,   411,   411,   411,   411,   411,   411,   411,   411,
-     411,   411,   411, -1718,   492,   482,   510,   503,   592,   594,
-     587,   601,   605,   651,   670,   674,   702,   698,   716,   715,
-     548,   455,   742,   555, -1718, -1718, -1718, -1718,   673, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718,   892,   892,   892,
-     892,   892,   892,   892,   892,   892, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718,  3853, -1718, -1718, -1718, -1718,   201,
-     496,   729,   729,   730,   174,   745,   745,   422,   422,   301,
-     138,   415,   580,   726,   726,   466,   466,   749,   749,   740,
-     749, -1718,   751,   756,   736,   768,   747,   748,   766,   765,
-   -1718,   782,   763,   785, -1718,   801,   788,   770,   815,   819,
-   -1718,   803,   827,   804, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718,   892, -1718,   892,   892,   892,
-     892,   892,   892,   892,   892, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718,   818,   830,   820,
-     831, -1718,   411,   411,   411,   411,   411,   161,   822,   835,
-     355,   215,   824,   102,   821,   828, -1718,   411, -1718, -1718,
-   -1718, -1718, -1718, -1718,   411, -1718,   411,   411,   411,   411,
-     411, -1718,   411,   411, -1718,   411,   411,   411, -1718,   411,
-   -1718,   411,   411,   411,   411,   411, -1718,   411,   411,   411,
-     411,   411,   411,   411,   411,   411,   411, -1718, -1718, -1718,
-     411,   833, -1718,   411, -1718,   411,   836, -1718,   411,   840,
-     829, -1718,   411,   411,   411,   842, -1718,   411,   411, -1718,
-     411,   411,   825,   846,   839,   856, -1718,   411,   411,   411,
-     411, -1718,   411,   411,   411,   411,   544,   847,   295,   857,
-     868, -1718,   411, -1718, -1718, -1718, -1718, -1718, -1718,   411,
-   -1718, -1718,   411, -1718,   411,   411,   411,   411,   869,   871,
-   -1718,   411,   411, -1718,   411,   411,   411,   411,   411,   411,
-     849,   333,   877,   278, -1718,   411,   411,   411,   411,   411,
-     411,   411,   411,   411,   411,   411,   411,   411,   411,   411,
-   -1718,   411, -1718,   411,   866,   867,   887,   335,   895,   875,
-     885,   894,   107,   886,   889, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,   411, -1718,
-     411,   899, -1718, -1718, -1718,   411,   901,   890, -1718,   896,
-     891, -1718, -1718,   911,   900, -1718, -1718, -1718, -1718,   897,
-     913, -1718,   923,   918,   938, -1718,   941,   876,   942,   931,
-     945,  1195,   598,   653,   269,   955,   960,   964,   902,   962,
-     959,   956,   905,   971,   167,   953,   952,   433,   114,   965,
-     965,   965,   965,   965,   965,   965,   965,   965,   965,  1195,
-     965,   965,   965,   965,   873,   965,   965,   965,   965,  1195,
-     965,   208,   208,   965,   965,   965,   966,   977,   963,  1195,
-     979,   873,   917,   961,   382,   382,   982,   929,   653,   653,
-     653,   653,   993,   992,   932,   999,  3853,  3947,  3853,  1195,
-    1195,  1195,  1195,  1195,  1000,  1001,   939,  1004,   986,   994,
-    1195,   873,  1195,   208,   208,   996,   987,   500,  3853,   394,
-     547,   873,  1008,   627,   653,  1011,  1003,  1012,  1013,  1016,
-     491,    81,  1195,  1195,   995,  1195,  1195,  1017,   359,   310,
-     416,  1507,  1195,  1195,  3947,  1008,  1008,  1027,  1029,  1036,
-     972,  1014,  1034,   975,  1023,   130,  1031,  1025,  1026,  1040,
-    1042,  1044,  1028,  1195,  1052, -1718,  1056,  1043,  1037,  1039,
-    1060, -1718,  1045, -1718,  1046,  1047,  1055,  1057,  1068,  1062,
-     411,   892,   892,   892,   892,   892,   892,   892,   892,   892,
-   -1718, -1718,  3190,  3190, -1718, -1718,  2355,  2355, -1718, -1718,
-    1063,  1054,  1077,   411,   411,   411, -1718, -1718, -1718,  1070,
-    1072,  1069,  1075,  1085,  1078,  1086,  1071,  1080,  1092,  1073,
-    1096,  1101,  1102,  1081,  1087,  1079,   411,   411,   411,   411,
-     411,   411,   411,   411,   411,   411,   411,   411,   411,   411,
-   -1718,   411,   411,   411,   411,  1091, -1718, -1718, -1718,   411,
-     411,   411,   411, -1718, -1718,   411, -1718,   411, -1718,   411,
-     411,   411, -1718,  1090,   411,   411,  1097,  1098,  1195,   411,
-     411,  1103, -1718, -1718,  1107,  1094,  1104,   411,   411,   411,
-     411,  1114, -1718,  1109,   411,   411,   411,   411,  1111,  1121,
-    1106,  1113,  3285, -1718,   411, -1718,  3853,  3285,   411, -1718,
-   -1718, -1718,   411,  1115,  1126,  1108,  1119,  1131,  1122,   411,
-   -1718, -1718, -1718, -1718, -1718,   411, -1718,   411,  1118,   411,
-    1117, -1718,   411, -1718,   411, -1718,   411,  3853, -1718,   411,
-    1133,   411,   411, -1718, -1718,   411,  1120, -1718,   411, -1718,
-    1132,  1125,  1142,  1137,  1138,  1128,  1136,  1140,   411,   411,
-     411,  1134,   349,  1141,  1143, -1718,   411,   411,   411,   411,
-     411,   411,   411,   411,   411,   411,   411,   411,   411,   411,
-    1161,   411,   411,   411,  1163,   411,  1145,  1162,  1152,   411,
-     411,   411,   411,   411,  1164,   411,   411,  1154,   411,   411,
-     411,   892,   892, -1718, -1718,   943,    57, -1718, -1718, -1718,
-   -1718, -1718,  3853,   411,   411,  1158,  1167,  1155,  1178,  1182,
-    1171,  1180,  1200,  1191,  1203,  1204,  1202,  1208,  1207,  1198,
-     411,   411,  1189, -1718, -1718, -1718,  1186, -1718, -1718, -1718,
-    1217,  1214,  1213,  1215,  1166,  1168,  1232,  1195, -1718,  1038,
-    3570,  2710,  4793, -1718, -1718, -1718, -1718, -1718,  2810, -1718,
-    1242, -1718,  1241,  1245,  1254,  1238,  1255,   653,   676,   456,
-    1239,  1248,  1249,  1253,  1270,  1268, -1718,  1283,  1222,  1223,
-    1286,  1293,  1276,  1290,  1278,  1291,  1195,   225,  1195,  1195,
-    3853,  1195,  3853,  3853,  1195,  1195,  1195,  1195,  1195,  1195,
-    1195,  1195,  3853,  1195,  1294,  1195,  3853,  1195,  1195,   653,
-     653,   653,   653,  1195,  1288,   965,   653,  1246,  1295,   411,
-   -1718,  1195,  1250,  1296, -1718,  1297,  3853,   653,  3853,   653,
-    1251,  1300,   653,   653,   653,   653,  1303,  1321,  1320,  1259,
-    3853,   653,  3853,  1195,  1195,  1307,  1326,  1325,  1264,  1265,
-    1330,  1195,   653,   653,  1312,   653,  1314,  1195,   653,  1195,
-    1195,  1332,  1195,  1195,  1195,  1318,   653,  1319, -1718,  1350,
-    1287,  1338,  1331,  1354,  1333,  3947,  3947,  3947,  1355,  1356,
-    1336,  1345,  1346,  1195,  1195,  1195,  1195,  1195,  1195,  1195,
-    1195,  1195,  1195,  1195,  1195,  3853,  1195,  1348,  1195,  3853,
-    1195,  1349,  1195,  1362,  1343,  1378,  1195,  1195,  1195,  1195,
-    1195,  1359,   653,   653,  1367,   653,   653,   653,  1236,  1292,
-     892,  1195,  1195,  1365,  1381,  1368,  1369,  1391,  1395,  1394,
-    1399,  1334,  1397,  1337,  1404,  1389,  1402,  1405,  3853,  1195,
-    1385, -1718,  1408,  1388,  1407,  1393,  1406,  1414,  1409,   411,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718,  1980,   790,  4793,
-   -1718, -1718, -1718,  3570, -1718, -1718, -1718, -1718,  3380,  1412,
-   -1718,  1400,  1357,  1396,   411,  1413,   411,   411,   411,   411,
-    1370,  1425,  1424,  1411,  1415,  1427,  1417,  1428,  1433,  1390,
-    1421,  1374,  1419,  1439,  1432, -1718,  1429,  1442,   411, -1718,
-   -1718, -1718, -1718, -1718, -1718,  3285,  3853,   411,   411, -1718,
-   -1718, -1718,   411,   411,   411, -1718,  3285,   411, -1718, -1718,
-    3853,   411,   411, -1718, -1718, -1718, -1718, -1718,  1437,   411,
-   -1718,  1444,  1398,  1195,   411, -1718,  1449,  1440,  1418,   411,
-    4041,   411,   411,   411,  1452,  1443, -1718, -1718, -1718, -1718,
-    1435,  1448,  1455,  1461,   411,  4135, -1718,   411,   411,   411,
-   -1718, -1718, -1718,  1436,  1451,  1459,  1465,  1475,  1467, -1718,
-   -1718, -1718,  1483, -1718,  1458,   411, -1718,   411, -1718,   411,
-    1504, -1718, -1718,   411,   411,  1510, -1718,  1447,  1490,  1505,
-   -1718,  1498, -1718,  1515, -1718, -1718, -1718,  1508,  1509,  1519,
-    1506,   411,   411,   411,   411,   411,   411,   411,   411,   411,
-     411,   411,   411,  4229,   411,  1499,   411,  4323,   411,  1524,
-     411,  1516,  1526,  1518,   411,   411,   411,   411,   411,  1530,
-     411,   411,  1529,   411,   411,   411,   892,   892,   892,   411,
-     411,  1468,  1513,  1532,  1520,  1535,  1517,  1527,  1528,  1533,
-    1531,  1538,  1534,  1484,  1486,  1536,  3285, -1718,  1539,  1549,
-    1541,  1540,  1542,  1547,  1552,  1494,  1195, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,  1980,
-     790, -1718,  3570, -1718, -1718,   294,  1545,  1195,  1553,   653,
-     653,   653,   676,  1551,  1567,  1555,  1561,  1521, -1718,  1583,
-    1570,  1585, -1718,  1568,   501, -1718, -1718, -1718,  1569,  1572,
-    1195,  3853,  1195,  1195,  1195,  1195,  1195,  3853,  1195,  1195,
-    1195,  1573,   653,  1574,  1580,   411,  1195,  1581,  1576,  1579,
-    3853,  2615,  3853,  3853,  1584,  1586,  1589,  1543,  1595,  1593,
-    3853,  3665,   598,   598,  1599,  1546,  1611,  1601,  1615,  1556,
-    1602,  1604,  1195,  1195,  1195,  1621,  1195,  1195,  1622,  1606,
-    1562,  1609,  1563,  1608,  1614,  1571, -1718, -1718,  1195,  1195,
-    3853,  1195,   209,  1195,   873,  3853,  1195,  1507,  3947,  3947,
-    3665,  3853,  1630,  1195,  3665,  3853, -1718,   598,  1616,  1620,
-    1578,  1195,  1195,  1195,  1195,  1195,  1617,   598,   598,  1582,
-     598,   653,   598,   892,   892,  1195,  1195,  1619,  1587,  1624,
-    1623,  1588,  1594,  1642,  1597,  1628,  1633,  1645,  1598,   518,
-    1649,  1600,  1195,  1635, -1718,  1654, -1718,  1637,  1634,  1656,
-    1652,   411, -1718, -1718,  1648,  1664,  1650, -1718,  1668, -1718,
-     411,   411,   411,   411,  1655,  1658,  1660,  1653,  1671,  1662,
-     523,  1672, -1718,  1657,  1667,  1683,  1686, -1718,  3285,   411,
-   -1718, -1718, -1718, -1718,   411,  3285,   411, -1718, -1718,  1665,
-     411,  1666,  1195, -1718, -1718,  1669,  1673,  4417, -1718, -1718,
-    3475,   411,   411,  1670,  1675,  1674,  1678, -1718,  1680,  4511,
-     892,   892,  3285,  3285,  1714, -1718, -1718, -1718, -1718,  3853,
-   -1718, -1718, -1718, -1718,  1676,  1689,  1662,   632,  1699,  1694,
-    1685,  1704, -1718,   411,   411,  1687,   411, -1718, -1718,  1688,
-    1703,   633,  1710,  1717,  1659,  1705, -1718,   411, -1718, -1718,
-    3853, -1718,  1716,  1702, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718,  3853,   411, -1718, -1718, -1718,  1714,  4605,
-   -1718,   411,  1714,  4699, -1718,  1661, -1718,  1721,   411,   411,
-     411,   411,   411,  1715, -1718, -1718,  1709, -1718, -1718, -1718,
-     411,   411,  1706,  1725,  1681,  1711,  1719,  1729,  1682,  1736,
-     634,  1732,  1749,  1755,  1739,  1740,  1757,   411,  1758,  1759,
-    1741,  1737,  1761,  1751,  1195,  1767,  1769,  1760,  1708,   653,
-    1195,   653,   653,  1748,  1771, -1718,  1752,  1762, -1718,  1753,
-    1763,  1772,  1764,  1766,  1768,  1777,  3853,  3853,  3853,  3853,
-    1195,  1765,  1195,  1770,   411,  1773,  1775,  2615,  1774,  1776,
-    1778,  1785,  1779,  3665,  2905,  3853, -1718,  3000,  3665,  1781,
-    1788,  1782,  1786,  1780,  1793,  1796,  1797,  1195,  1195, -1718,
-    1195,  1790,  1798,  1792,  1801,  1783,  1804,  1806,  1195,  1791,
-    1807,  1195,  3665,  1591,  3759,  1808,  1809,  1195,  1195,  1195,
-    1507,   598,  1810,  1826,  1195,  1195,  1811,  1818,   353,  1812,
-    1819,  1815,   452,  1816,  1817,  1820,  1822,  1789,  1824,  1823,
-    1821,  1841,  1195,  1827, -1718,  1830,  1828,  1846,  1832, -1718,
-    1853,  1829,  1831,  1855, -1718, -1718, -1718,   411,  1836,  1794,
-    1842,  1835,  1837,  1840,  1861,  1860,  1863, -1718,  1848,   411,
-    3853,  3853,   411, -1718,  1865, -1718,  1845,  3853,  1849,  1856,
-   -1718,  1852,  1859,  1850,  1854,  1857,  1714, -1718,  3853, -1718,
-   -1718, -1718,  1858,  1862,  1864,  1867,  1877,  1866,  1876,  1868,
-   -1718, -1718, -1718, -1718,  1870,  1871,  1869,  1873,  1872,  1875,
-     683, -1718,  1882,  1879,   411,  1714,   892,   892, -1718, -1718,
-    1316,  1702,  1714, -1718,  1878,  1880,   411,   411, -1718, -1718,
-   -1718,  1883,  1884, -1718,   411,  1881,  1886,  1885,  1892,  1898,
-    1874,  1894,  1889,  1895,  1897,  1908,  1893,  1896,  1912,  1917,
-    1899,  1918,  1903,  1901,   411,  1902,  1919,  1904,  1906,  1907,
-    1915,  1900,  1929,  1913,   653,  1914,   476,  1933,  1920,  1888,
-    1916,  1921,  1942,  1939,  1922,  1930,  1924,   411,  1925,  1943,
-    1926,  1948,  1931,  1936,  1891,  1937,  1962,  1923,  1963,  1966,
-    1967,  1969, -1718,  1968,  1970,  1932,  1973, -1718,  1975,  1972,
-    1976, -1718,   873,  1358,  1387,   892,  1981,  1982,  1195,  1195,
-    1978,  1949,  1195,  1979,  1984,  1983,  1950,  2004,  2005,  1997,
-    1987,  1988,  2007,  1995,  1951,  1990,  1999,  1992,  2001,  2016,
-    1998,  2021,  1195,  2000,  2006,  2008,  1960,  2003, -1718,  2009,
-   -1718,  1964, -1718,  2010,  2011,   419,  2018,  2015,  2029,   132,
-    2022,  1974,  2024,  1977,  2042,  2020,  2030,   653,  2032,  2028,
-    2033,  2034,  2027,  2054,  2052,  2035,  2056,  2055,  2043,  1996,
-    2037,  2039,  2040,  2065,   260,  2062,  2047,  2044,  2053, -1718,
-     892,   892,   892,  2050,  2049, -1718, -1718,  2057, -1718, -1718,
-    2048, -1718,  2063,  2061,  2060,  2064, -1718,  2074,  2066,  2067,
-   -1718,  2072,  2070,  2058,  2023,  2068,  2025, -1718, -1718, -1718,
-    2031,  2069,  2084,  2088, -1718,  2081,  2092,  2036,  2093,  2094,
-    2087,  2098,  2079,  2086,   247,  2091,  2101,  2104,  2041,  2109,
-    2103,  2089,  2111,   411,  2112,  2095,  2113,  2096,  2059,  2100,
-    2117,  2080,  2105,  2118,  2122,  2125,  2106,  2089,  2083,  2110,
-    2141,  2128,  2149,  2127,  2102,  2130,   892,   892,  2135,  2142,
-    2144,  2108,  2140, -1718, -1718,  2143,  2151,  2146, -1718,  2167,
-    2168,  2152,  2174, -1718,  2175,  2176,    19,  2160,  2171,  2154,
-    2173,   686,  2177,  2180,  2178,  2179,    24,  2185,  2163,  2181,
-    2182,  2183,  2184,  2191,  2186,  2193, -1718,  2188,  1195,  2189,
-      27,  2192,  2129,  2195,  2197,  2187,  2199,  2198,  2190,  2201,
-    2203, -1718,   708,  2207,  2194,  2200,  2202,  2204,   264, -1718,
-    2205,  2208, -1718,  2214, -1718,    30,  2219, -1718,  2206,  2209,
-   -1718,  2211,  2212,  2224, -1718,  2227,  2210,  2233,  2231,  2215,
-    2226,   267,  2217,  2237,  2223,  2196,  2213,  2239,  2240,  2230,
-    2220,  2221,  2225,  2247,  2229,  2228, -1718,  2232,   411,  2234,
-    2248,  2235,  2246,  2250,  2242,  2253,  2256,  2252,  2243,  2261,
-    2251,  2262,  2267,  2259,  2249, -1718,  2216,  2263,  2255,  1754,
-    2218,  2236,  2272,  2222,    41,  2273,  2265,  2257,  2280,  2258,
-   -1718,  2274,  2238,  2276, -1718, -1718,  2285,  2260,  2277,  2241,
-    2268,  2287,  2281,  2279,  2282,    46,  2294,  2293,  2244,    66,
-    2286,  2275,  2283, -1718,  1507,  2288,  2289,  2254,  2290, -1718,
-    2296,  2291,  2292,  2301,    68,  2295,  2305,  2297,  2264,  2304,
-    2244,   189,  2309,  2299,  2298,  2310,  2315,  2302,  2300,  2303,
-    2311,  2313,  2266,  2325,  2269,  2316,  2318,  2312,  2320,  2321,
-    2322,  2328,  2307,  2319,  2338,  2341,  2324,  2329,  2343, -1718,
-    2330,  2340,  2384,  2387, -1718,  2391,  2392,  2393,  2385,   411,
-    2390,  2308,  2400,  2410,  2402,  2412,  2401,  2399,  2405,  2406,
-    2416,  2413,  2395,  2408,  2403,  2424,  2407,  2417,  2414,  2409,
-    2415,  2426,   462,  2428,   412,  2418,  2411,  2434,  2439, -1718,
-    2422,  2440,  2437,  2419, -1718, -1718,  2423,  2444,  2442,  2429,
-    2425,  2388,  2453,  2455,  2433,  2435,  2394,   542,  2454,  2448,
-    2460, -1718,  2461,  2425,  2457,  2433,  2446,  2463,  2420,  2466,
-    2449,  2450, -1718, -1718, -1718,  2469,  2471,  2456,  2472,  2458,
-    2459,  2462,  2421,  2464,  2467,  2473,  2427, -1718,  2479,  2468,
-    2478,  2480,  2470,  2451,  2465, -1718,  2487,  2474, -1718,  2475,
-    2476,  2477, -1718, -1718,  2482,  2483,  2492,   411, -1718, -1718,
-   -1718, -1718, -1718,  2489,  2484,  2498,  2499,  2485,  2500,  2502,
-    2488,  2491,  2503,  2506,  2507,  2447,  2490,  2510, -1718,  2493,
-    2511,   562,  2494,  2512,  2495,   577,  2496, -1718,  2508,  2504,
-    2481,  2505,  2509,  2513,  2497,  2523,  2526,  2515,  2528,  2486,
-    2514,   598,  2516,  2525, -1718,  2504,  2515,  2518,  2501,  2530,
-    2517, -1718,  2527,  2519,  2529, -1718,  2520,  2521,  2522,  2531,
-    2533,  2535,  2536,  2524,  2537,  2539,  2540,  2651, -1718,  2534,
-    2538,  2716,  2542,  2541,  2544,  2532, -1718,  2543,  2545,  2546,
-   -1718,  2549,  2547,  2651,  2552,  2551,  2554, -1718,   612,  2556,
-    2557,  2553, -1718,  2550,  2559,  2558, -1718,   624,  2555,  2573,
-    2561,  2564,  2562,  2563,  2578,  2566,  2717,  2586,  2585, -1718,
-    2780,  2772,  2764, -1718,  2912,  3006,  3085,  3083,  3178,  3192,
-    3269, -1718,  3274,  3367, -1718,  3368,  3463,  3464,  3557,  3548,
-    3578,  3837,  3794,  3931,   296,  3952,  4030,  4024,  4124,  4119,
-    4222,  4214,  4312, -1718,  4305,  4418,  4405,  4488,  4494, -1718,
-    4586,  4607,  4681, -1718, -1718,  4684,  4799,  4797,  4788,  4860,
-    4846,  4862,  4863,  4868,  4845,  4870,  4867,  4854,  4855, -1718,
-    4807, -1718,  4857,  4858, -1718,  4876,  4861,  4859,  4853,  4864,
-    4865,  4856,  4866,  4871,  4878,  4869,  4872,  4873, -1718,   678,
-    4874, -1718,  4875,  4880,  4877,  4881, -1718,  4879,  4887, -1718,
-    4890,  4882,  4891,  4895, -1718,  4883,  4886, -1718,  4897,  4884,
-    4885,  4888,  4892,  4893,  4828,  4889,  4894,  4898,  4896,  4900,
-    4899,  4902,  4903,  4901,  4906, -1718,  4904, -1718,  4905, -1718,
-    4908,  4909,  4913,  4907,  4910, -1718,  4911,  4912,  4914,  4915,
-   -1718,  4916, -1718,  4917, -1718,  4918, -1718, -1718, -1718, -1718,
-    4919, -1718
+     907, -1730, -1730,   218,    51,   526,   141,   279,   130,   143,
+     192,   453,   183,   176,   249,   126,   254,   412, -1730,   102,
+    3107, -1730,   296,   296,   296,   296,   296,   296,   296,   296,
+     296,   296,   296,   296,   296,   296,   296,   296,   296,   296,
+     296,   296,   296,   296, -1730,   296,   296,   390,   375,   434,
+     487,   524,   592,   480,   598,   653,   627,   644,   650,   667,
+     681,   708,   692,   691,   711,   550,   565,   732,   569, -1730,
+   -1730, -1730, -1730,   671, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730,  1089,  1089,  1089,  1089,  1089,  1089,  1089,  1089,
+    1089, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,  3865,
+   -1730, -1730, -1730, -1730,   281,   511,   734,   734,   747,   134,
+     743,   743,   316,   316,   309,    76,   272,   209,   745,   745,
+     478,   478,   764,   764,   762,   764,   776,   776, -1730,   779,
+     767,   784,   757,   787,   773,   777, -1730,   799,   786, -1730,
+     800,   781,   821, -1730,   830,   813,   822,   838,   840, -1730,
+     823,   844,   820, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730,  1089, -1730,  1089,  1089,  1089,  1089,
+    1089,  1089,  1089,  1089, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730,   837,   849,   839,   847,
+   -1730,   296,   296,   296,   296,   296,   292,   843,   855,   229,
+     318,   845,   180,   842,   846, -1730,   296, -1730, -1730, -1730,
+   -1730, -1730, -1730,   296, -1730,   296,   296,   296,   296,   296,
+   -1730,   296,   296, -1730,   296,   296,   296, -1730,   296, -1730,
+     296,   296,   296,   296,   296, -1730,   296,   296,   296,   296,
+     296,   296,   296,   296,   296,   296, -1730, -1730, -1730,   296,
+     851, -1730,   296, -1730,   296,   853, -1730,   296,   856,   848,
+   -1730,   296,   296,   296,   861, -1730,   296,   296, -1730,   296,
+     296,   850,   863,   841,   859, -1730,   296,   296,   296,   296,
+   -1730,   296,   296,   296,   296,   499,   868,   398,   864,   870,
+   -1730,   296, -1730, -1730, -1730, -1730, -1730, -1730,   296, -1730,
+   -1730,   296, -1730,   296,   296,   296,   296,   858,   860, -1730,
+     296,   296, -1730,   296,   296,   296,   296,   296,   296,   862,
+     465,   867,    66, -1730,   296,   296,   296,   296,   296,   296,
+     296,   296,   296,   296,   296,   296,   296,   296,   296, -1730,
+     296, -1730,   296,   865,   880,   871,   486,   879,   885,   872,
+     873,   181,   874,   895, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730,   296, -1730,   296,
+     898, -1730, -1730, -1730,   296,   889, -1730, -1730,   899,   901,
+     900, -1730,   897,   903, -1730, -1730,   892,   905, -1730, -1730,
+   -1730, -1730,   908,   909, -1730,   929,   915,   935, -1730,   937,
+     875,   939,   920,   928,  1372,   619,   690,   367,   943,   949,
+     950,   886,   946,   942,   940,   891,   952,   347,   936,   948,
+     575,   115,   947,   947,   947,   947,   947,   947,   947,   947,
+     947,   947,  1372,   947,   947,   947,   947,  1050,   947,   947,
+     947,   947,  1372,   947,   222,   222,   947,   947,   947,   961,
+     956,   945,  1372,   973,  1050,   912,   958,   514,   514,   979,
+     918,   690,   690,   690,   690,   982,   981,   921,   986,  3865,
+    3959,  3865,  1372,  1372,  1372,  1372,  1372,   987,   988,   926,
+     991,   977,   989,  1372,  1050,  1372,   222,   222,   992,   984,
+     642,  3865,   432,   911,  1050,  1004,   338,   690,  1006,   999,
+    1007,  1012,  1014,   509,    74,  1372,  1372,   990,  1372,  1372,
+    1001,   380,   409,   396,  1318,  1372,  1372,  3959,  1004,  1004,
+    1017,  1016,  1022,   957,   998,  1020,   960,  1009,   197,  1011,
+    1008,  1025,  1018,  1027,  1048,  1039,  1372,  1040,  1060, -1730,
+   -1730,  1061,  1052,  1043,  1062,  1080, -1730,  1063, -1730,  1064,
+    1070,  1076,  1077,  1093,  1084,   296,  1089,  1089,  1089,  1089,
+    1089,  1089,  1089,  1089,  1089, -1730, -1730,  3202,  3202, -1730,
+   -1730,  2437,  2437, -1730, -1730,  1092,  1090,  1106,   296,   296,
+     296, -1730, -1730, -1730,  1103,  1116,  1117,  1123,  1133,  1128,
+    1148,  1132,  1143,  1154,  1136,  1155,  1165,  1156,  1141,  1149,
+    1147,   296,   296,   296,   296,   296,   296,   296,   296,   296,
+     296,   296,   296,   296,   296,   296, -1730,   296,   296,   296,
+     296,  1159, -1730, -1730, -1730,   296,   296,   296,   296, -1730,
+   -1730,   296, -1730,   296, -1730,   296,   296,   296, -1730,  1161,
+     296,   296,  1163,  1162,  1372,   296,   296,  1167, -1730, -1730,
+    1169,  1150,  1164,   296,   296,   296,   296,  1183, -1730,  1173,
+     296,   296,   296,   296,  1174,  1184,  1166,  1178,  3297, -1730,
+     296, -1730,  3865,  3297,   296, -1730, -1730, -1730,   296,  1179,
+    1190,  1177,  1188,  1193,  1189,   296, -1730, -1730, -1730, -1730,
+   -1730,   296, -1730,   296,  1185,   296,  1180, -1730,   296, -1730,
+     296, -1730,   296,  3865, -1730,   296,  1200,   296,   296, -1730,
+   -1730,   296,  1187, -1730,   296, -1730,  1196,  1199,  1208,  1206,
+    1214,  1207,  1215,  1218,   296,   296,   296,  1212,   267,  1219,
+    1224, -1730,   296,   296,   296,   296,   296,   296,   296,   296,
+     296,   296,   296,   296,   296,   296,  1254,   296,   296,   296,
+    1255,   296,  1231,  1265,  1258,   296,   296,   296,   296,   296,
+    1269,   296,   296,  1262,   296,   296,   296,  1089,  1089, -1730,
+   -1730,  1067,    52, -1730, -1730, -1730, -1730, -1730,  3865,   296,
+     296,  1264,  1273,  1261,  1272,  1275,  1288,  1270,  1293,  1284,
+    1345,  1348,  1344,  1352,  1351,  1341,   296,   296,  1342, -1730,
+    1365, -1730, -1730,  1339, -1730, -1730, -1730,  1356,  1368,  1354,
+    1355,  1305,  1308,  1373,  1372, -1730,   613,  3582,  2725,  4805,
+   -1730, -1730, -1730, -1730, -1730,  2822, -1730,  1369, -1730,  1370,
+    1371,  1377,  1362,  1380,   690,   559,   501,  1364,  1374,  1366,
+    1367,  1384,  1376, -1730,  1383,  1322,  1323,  1387,  1392,  1379,
+    1393,  1381,  1391,  1378,  1372,   187,  1372,  1372,  1372,  3865,
+    1372,  3865,  3865,  1372,  1372,  1372,  1372,  1372,  1372,  1372,
+    1372,  3865,  1372,  1385,  1372,  3865,  1372,  1372,   690,   690,
+     690,   690,  1372,  1382,   947,   690,  1333,  1386,   296, -1730,
+    1372,  1336,  1388, -1730,  1394,  3865,   690,  3865,   690,  1337,
+    1398,   690,   690,   690,   690,  1399,  1415,  1416,  1357,  3865,
+     690,  3865,  1372,  1372,  1400,  1420,  1421,  1358,  1360,  1427,
+    1372,   690,   690,  1408,   690,  1410,  1372,   690,  1372,  1372,
+    1428,  1372,  1372,  1372,  1412,   690,  1418, -1730,  1433,  1375,
+    1422,  1419,  1437,  1423,  3959,  3959,  3959,  1439,  1441,  1429,
+    1424,  1430,  1372,  1372,  1372,  1372,  1372,  1372,  1372,  1372,
+    1372,  1372,  1372,  1372,  3865,  1372,  1438,  1372,  3865,  1372,
+    1440,  1372,  1442,  1432,  1452,  1372,  1372,  1372,  1372,  1372,
+    1436,   690,   690,  1444,   690,   690,   690,  1114,  1134,  1089,
+    1372,  1372,  1443,  1457,  1447,  1458,  1454,  1468,  1473,  1480,
+    1417,  1477,  1425,  1482,  1469,  1488,  1481,  3865,  1372,  1471,
+    1483, -1730,  1493,  1474,  1494,  1484,  1490,  1502,  1499,   296,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730,  1329,   805,  4805,
+   -1730, -1730, -1730,  3582, -1730, -1730, -1730, -1730,  3392,  1489,
+   -1730,  1491,  1450,  1492,   296,  1500,   296,   296,   296,   296,
+    1453,  1520,  1517,  1501,  1498,  1519,  1508,  1518,  1528,  1514,
+    1524,  1476,  1521,  1533,  1526,  1539, -1730,  1527,  1542,   296,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730,  3297,  3865,   296,
+     296, -1730, -1730, -1730,   296,   296,   296, -1730,  3297,   296,
+   -1730, -1730,  3865,   296,   296, -1730, -1730, -1730, -1730, -1730,
+    1523,   296, -1730,  1535,  1487,  1372,   296, -1730,  1536,  1532,
+    1497,   296,  4053,   296,   296,   296,  1544,  1541, -1730, -1730,
+   -1730, -1730,  1503,  1534,  1549,  1546,   296,  4147, -1730,   296,
+     296,   296, -1730, -1730, -1730,  1504,  1547,  1554,  1560,  1570,
+    1562, -1730, -1730, -1730,  1552, -1730,  1553,   296, -1730,   296,
+   -1730,   296,  1573, -1730, -1730,   296,   296,  1577, -1730,  1515,
+    1556,  1571, -1730,  1567, -1730,  1586, -1730, -1730, -1730,  1578,
+    1579,  1589,  1575,   296,   296,   296,   296,   296,   296,   296,
+     296,   296,   296,   296,   296,  4241,   296,  1572,   296,  4335,
+     296,  1591,   296,  1585,  1595,  1587,   296,   296,   296,   296,
+     296,  1599,   296,   296,  1598,   296,   296,   296,  1089,  1089,
+    1089,   296,   296,  1537,  1582,  1601,  1583,  1604,  1588,  1592,
+    1593,  1602,  1600,  1610,  1605,  1551,  1555,  1606,  3297, -1730,
+    1607, -1730,  1614,  1611,  1609,  1612,  1608,  1618,  1568,  1372,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730,  1329,   805, -1730,  3582, -1730, -1730,   413,  1615,
+    1372,  1617,   690,   690,   690,   559,  1619,  1640,  1626,  1620,
+    1580, -1730,  1642,  1625,  1643, -1730,  1624,   582, -1730, -1730,
+   -1730,  1649,  1627,  1630,  1372,  3865,  1372,  1372,  1372,  1372,
+    1372,  3865,  1372,  1372,  1372,  1631,   690,  1637,  1645,   296,
+    1372,  1646,  1639,  1644,  3865,  2630,  3865,  3865,  1647,  1648,
+    1650,  1613,  1664,  1653,  3865,  3677,   619,   619,  1654,  1616,
+    1665,  1656,  1670,  1621,  1658,  1659,  1372,  1372,  1372,  1676,
+    1372,  1372,  1677,  1666,  1622,  1668,  1623,  1661,  1672,  1629,
+   -1730, -1730,  1372,  1372,  3865,  1372,   205,  1372,  1050,  3865,
+    1372,  1318,  3959,  3959,  3677,  3865,  1680,  1372,  3677,  3865,
+   -1730,   619,  1673,  1681,  1632,  1372,  1372,  1372,  1372,  1372,
+    1671,   619,   619,  1633,   619,   690,   619,  1089,  1089,  1372,
+    1372,  1682,  1634,  1686,  1679,  1652,  1657,  1702,  1660,  1688,
+    1692,  1704,  1662,   624,  1708,  1663,  1372,  1694, -1730,  1711,
+   -1730,  1691,  1693,  1709,  1707,   296, -1730, -1730,  1696,  1718,
+    1701, -1730,  1721, -1730,   296,   296,   296,   296,  1706,  1716,
+    1710,  1705,  1723,  1714,   675,  1729, -1730,  1717,  1719,  1725,
+    1736,  1741, -1730,  3297,   296, -1730, -1730, -1730, -1730,   296,
+    3297,   296, -1730, -1730,  1724,   296,  1727,  1372, -1730, -1730,
+    1728,  1722,  4429, -1730, -1730,  3487,   296,   296,  1730,  1726,
+    1731,  1733, -1730,  1732,  4523,  1089,  1089,  3297,  3297,  1774,
+   -1730, -1730, -1730, -1730,  3865, -1730, -1730, -1730, -1730,  1735,
+    1744,  1714,   683,  1757,  1750,  1743,  1765, -1730,   296,   296,
+    1746,   296, -1730, -1730,  1748,  1761,   698,  1776,  1779,  1715,
+    1763, -1730,   296, -1730, -1730,  3865, -1730,  1778,  1764, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,  3865,   296,
+   -1730, -1730, -1730,  1774,  4617, -1730,   296,  1774,  4711, -1730,
+    1720, -1730,  1782,   296,   296,   296,   296,   296,  1767, -1730,
+   -1730,  1768, -1730, -1730, -1730,   296,   296,  1760,  1786,  1734,
+    1770,  1777,  1783,  1737,  1784,   702,  1787,  1790,  1796,  1780,
+    1785,  1798,   296,  1801,  1802,  1788,  1791,  1803,  1792,  1372,
+    1799,  1806,  1804,  1753,   690,  1372,   690,   690,  1797,  1805,
+   -1730,  1795,  1794, -1730,  1800,  1807,  1812,  1808,  1809,  1758,
+    1810,  1819,  3865,  3865,  3865,  3865,  1372,  1811,  1372,  1815,
+     296,  1816,  1817,  2630,  1821,  1824,  1822,  1814,  1825,  3677,
+    2917,  3865, -1730,  3012,  3677,  1827,  1818,  1828,  1830,  1823,
+    1834,  1839,  1840,  1372,  1372, -1730,  1372,  1833,  1841,  1835,
+    1842,  1832,  1843,  1845,  1372,  1836,  1846,  1372,  3677,  1353,
+    3771,  1847,  1848,  1372,  1372,  1372,  1318,   619,  1849,  1826,
+    1372,  1372,  1844,  1852,   445,  1851,  1857,  1853,   297,  1854,
+    1855,  1850,  1859,  1869,  1860,  1865,  1856,  1829,  1372,  1864,
+   -1730,  1866,  1862,  1883,  1867, -1730,  1886,  1863,  1868,  1889,
+   -1730, -1730, -1730,   296,  1870,  1831,  1874,  1872,  1876,  1871,
+    1890,  1892,  1896,   144, -1730,  1884,   296,  3865,  3865,   296,
+   -1730,  1897, -1730,  1881,  3865,  1882,  1888, -1730,  1885,  1891,
+    1893,  1887,  1894,  1774, -1730,  3865, -1730, -1730, -1730,  1895,
+    1898,  1899,  1900,  1904,  1907,  1905,  1906, -1730, -1730, -1730,
+   -1730,  1908,  1901,  1910,  1909,  1911,  1912,   703, -1730,  1914,
+    1913,   296,  1774,  1089,  1089, -1730, -1730,  1158,  1764,  1774,
+   -1730,  1915,  1902,   296,   296, -1730, -1730, -1730,  1917,  1918,
+   -1730,   296,  1916,  1903,  1919,  1921,  1930,  1929,  1926,  1924,
+    1931,  1934,  1927,  1925,  1938,  1949,  1954,  1937,  1961,  1946,
+    1941,   296,  1942,  1964,  1947,  1950,  1948,  1955,  1953,  1972,
+    1957,   690,  1958,   319,  1974,  1960,  1920,  1962,  1965,  1982,
+    1981,  1966,  1967,  1970,  1968,   296,  1971,  1988,  1973,  1991,
+    1975,  1977,  1936,  1978,  1980,  1939,  1983,  1987,  1989,  1979,
+   -1730,  1992,  1995,  1940,  1998, -1730,  1997,  1999,  2000, -1730,
+    1050,  1236,  1260,  1089,  2002,  2003,  1372,  1372,  2010,  2001,
+    1372,  2004,  2012,  2005,  2026,  2029,  2030,  2020,  2011,  2013,
+    2031,  2018,  1984,  2015,  2025,  2021,  2028,  2043,  2024,  2049,
+    1372,  2032,  2033,  2036,  1993,  2034, -1730,  2037, -1730,  2006,
+   -1730,  2039,  2040,   395,  2041,  2046,  2061,   268,  2050,  2007,
+    2051,  2009,  2066,  2070,  2047,  2059,   690,  2060,  2062,  2064,
+    2065,  2054,  2079,  2081,  2058,  2085,  2083,  2071,  2023,  2063,
+    2067,  2068,  2090,   276,  2089,  2074,  2072,  2086, -1730,  1089,
+    1089,  1089,  2077,  2082, -1730, -1730,  2084, -1730, -1730,  2087,
+   -1730,  2091,  2088,  2095,  2092, -1730,  2101,  2094,  2096, -1730,
+    2113,  2100,  2097,  2053,  2099,  2055, -1730, -1730, -1730,  2069,
+    2102,  2116,  2122, -1730,  2112,  2124,  2093,  2125,  2127,  2118,
+    2130,  2110,  2131,    92,  2117,  2147,  2150,  2103,  2151,  2132,
+    2143,  2134,  2154,   296,  2161,  2142,  2163,  2144,  2104,  2137,
+    2167,  2106,  2155,  2170,  2171,  2174,  2156,  2134,  2111,  2160,
+    2176,  2162,  2180,  2158,  2119,  2164,  1089,  1089,  2165,  2168,
+    2173,  2120,  2172, -1730, -1730,  2175,  2177,  2178, -1730,  2185,
+    2188,  2182,  2192, -1730,  2195,  2197,    28,  2183,  2186,  2184,
+    2193,   729,  2196,  2204,  2198,  2199,    33,  2211,  2189,  2201,
+    2194,  2200,  2205,  2217,  2202,  2203,  2216, -1730,  2206,  1372,
+    2207,    40,  2209,  2157,  2219,  2226,  2208,  2227,  2229,  2210,
+    2214,  2221, -1730,   736,  2233,  2212,  2215,  2218,  2220,   179,
+   -1730,  2222,  2213, -1730,  2236, -1730,    47,  2238, -1730,  2223,
+    2225, -1730,  2235,  2231,  2240, -1730,  2242,  2224,  2251,  2248,
+    2232,  2241,   202,  2243,  2257,  2245,  2228,  2230,  2258,  2256,
+    2252,  2244,  2247,  2250,  2264,  2249,  2253, -1730, -1730,  2255,
+     296,  2259,  2263,  2260,  2265,  2268,  2262,  2273,  2276,  2269,
+    2261,  2281,  2274,  2283,  2284,  2277,  2275, -1730,  2234,  2285,
+    2270,  2272,  2237,  2282,  2298,  2239,   483,  2300,  2293,  2287,
+    2307,  2288, -1730,  2295,  2246,  2296, -1730, -1730,  2314,  2289,
+    2303,  2254,  2294,  2315,  2308,  2309,  2311,    49,  2320,  2321,
+    2266,    63,  2313,  2302,  2310, -1730,  1318,  2312,  2317,  2267,
+    2305, -1730,  2332,  2316,  2322,  2334,    65,  2324,  2338,  2318,
+    2280,  2337,  2266,   124,  2340,  2325,  2323,  2346,  2345,  2326,
+    2336,  2335,  2342,  2339,  2290,  2351,  2292,  2347,  2341,  2343,
+    2344,  2348,  2350,  2349,  2352,  2353,  2354,  2356,  2355,  2357,
+    2358, -1730,  2361,  2359,  2362,  2363, -1730,  2364,  2367,  2368,
+    2365,   296,  2366,  2370,  2374,  2360,  2377,  2387,  2375,  2376,
+    2378,  2384,  2394,  2388,  2373,  2381,  2379,  2400,  2385,  2393,
+    2389,  2386,  2390,  2404,   437,  2406,   471,  2395,  2391,  2410,
+    2416, -1730,  2399,  2417,  2414,  2396, -1730, -1730,  2402,  2419,
+    2420,  2405,  2403,  2424,  2425,  2427,  2407,  2467,  2426,   520,
+    2439,  2415,  2442, -1730,  2491,  2403,  2429,  2407,  2476,  2493,
+    2430,  2497,  2478,  2481, -1730, -1730, -1730,  2498,  2500,  2484,
+    2499,  2485,  2486,  2488,  2441,  2489,  2492,  2509,  2445, -1730,
+    2510,  2494,  2511,  2512,  2495,  2496,  2501, -1730,  2516,  2502,
+   -1730,  2503,  2505,  2504, -1730, -1730,  2508,  2514,  2515,   296,
+   -1730, -1730, -1730, -1730, -1730,  2519,  2513,  2524,  2526,  2517,
+    2529,  2530,  2518,  2521,  2531,  2532,  2536,  2447,  2520,  2539,
+   -1730,  2522,  2537,   528,  2523,  2538,  2525,   568,  2527, -1730,
+    2533,  2534,  2480,  2535,  2528,  2540,  2541,  2550,  2553,  2542,
+    2554,  2490,  2545,   619,  2544,  2555, -1730,  2534,  2542,  2546,
+    2506,  2558,  2543, -1730,  2547,  2507,  2556, -1730,  2552,  2559,
+    2551,  2560,  2562,  2563,  2564,  2666,  2565,  2567,  2568,  2731,
+   -1730,  2566,  2557,  2732,  2569,  2570,  2549,  2561, -1730,  2571,
+    2586,  2572, -1730,  2574,  2573,  2731,  2577,  2576,  2587, -1730,
+     577,  2582,  2583,  2579, -1730,  2580,  2585,  2900, -1730,   611,
+    2993,  2599,  3091,  3094,  3208,  3185,  3300,  3282,  3332,  3399,
+    3489, -1730,  3490,  3575,  3567, -1730,  3590,  3871,  3856,  3946,
+    3948,  4054,  4038, -1730,  4135,  4228, -1730,  4229,  4136,  4323,
+    4416,  4313,  4436,  4507,  4464,  4601,   362,  4622,  4700,  4694,
+    4794,  4789,  4800,  4854,  4860, -1730,  4853,  4874,  4861,  4852,
+    4858, -1730,  4859,  4878,  4862, -1730, -1730,  4863,  4887,  4885,
+    4876,  4886,  4872,  4888,  4889,  4894,  4871,  4896,  4893,  4880,
+    4881, -1730,  4833, -1730,  4883,  4884, -1730,  4902,  4890,  4882,
+    4879,  4891,  4892,  4895,  4898,  4897,  4904,  4899,  4900,  4901,
+   -1730,   633,  4903, -1730,  4905,  4907,  4908,  4909, -1730,  4906,
+    4913, -1730,  4915,  4910,  4919,  4922, -1730,  4912,  4911, -1730,
+    4928,  4914,  4916,  4917,  4918,  4921,  4840,  4920,  4923,  4924,
+    4925,  4929,  4927,  4931,  4932,  4926,  4933, -1730,  2548, -1730,
+    4937, -1730,  4930,  4934,  4941,  4935,  4936, -1730,  4938,  4940,
+    4939,  4942, -1730,  4943, -1730,  4944, -1730,  4946, -1730, -1730,
+   -1730, -1730,  4952, -1730
 };
 
   /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1010,330 +1015,333 @@ static const yytype_int16 yypact[] =
 static const yytype_uint16 yydefact[] =
 {
        0,     3,     9,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     2,     0,     7,
-       8,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     2,     0,
+       7,     8,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    36,    37,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    36,    39,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     1,   532,   533,     4,     0,   514,
-      10,   502,   498,   497,   495,   496,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   450,   451,   452,   453,
-     454,   455,   424,   425,   426,   427,   428,   429,   423,   499,
-     422,   430,   431,   432,   433,   434,   435,   436,   437,   438,
-     439,   440,   441,   442,   443,   444,   445,   446,   447,   448,
-     449,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   487,   489,   490,   491,   492,   493,   494,   500,   501,
-     503,   504,   505,   506,   507,   508,   509,   510,   511,   512,
-     513,   531,   381,    12,    13,   415,   476,   421,    11,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     1,
+     535,   536,     4,     0,   517,    10,   505,   501,   500,   498,
+     499,   344,   345,   346,   347,   348,   349,   350,   351,   352,
+     353,   453,   454,   455,   456,   457,   458,   427,   428,   429,
+     430,   431,   432,   426,   502,   425,   433,   434,   435,   436,
+     437,   438,   439,   440,   441,   442,   443,   444,   445,   446,
+     447,   448,   449,   450,   451,   452,   459,   460,   461,   462,
+     463,   464,   465,   466,   467,   468,   469,   470,   471,   472,
+     473,   474,   475,   476,   477,   478,   490,   492,   493,   494,
+     495,   496,   497,   503,   504,   506,   507,   508,   509,   510,
+     511,   512,   513,   514,   515,   516,   534,   384,    12,    13,
+     418,   479,   424,    11,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   537,     0,
+       0,     0,     0,     0,     0,     0,   675,     0,     0,   538,
+       0,     0,     0,   539,     0,     0,     0,     0,     0,   555,
+       0,     0,     0,     5,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   385,   342,   386,   387,   388,   389,
+     390,   391,   392,   393,   491,   480,   481,   482,   483,   484,
+     485,   486,   487,   488,   489,   419,     0,     0,     0,     0,
+      14,    40,     0,    52,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    17,     0,   132,   144,   156,
+     164,   165,   166,     0,   148,     0,     0,     0,     0,     0,
+     133,     0,     0,   134,     0,     0,     0,   140,     0,   149,
+       0,     0,     0,     0,     0,   170,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   181,   182,   183,     0,
+       0,    15,     0,    16,     0,     0,    27,     0,     0,     0,
+      28,     0,     0,     0,     0,    29,     0,     0,    30,     0,
+       0,     0,     0,     0,     0,    18,     0,     0,     0,     0,
+      19,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      20,     0,   265,   270,   263,   261,   266,   267,     0,   269,
+     262,     0,   273,     0,     0,     0,     0,     0,     0,    21,
+       0,     0,    22,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    23,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    34,
+       0,    35,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    24,    55,    56,    57,    58,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    59,    60,
+      61,    65,    66,    67,    64,    63,    62,    78,    79,    80,
+      81,    82,    83,    84,    77,    25,    85,    86,    87,    88,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,    89,
+      90,    91,    95,    96,    97,    94,    93,    92,   108,   109,
+     110,   111,   112,   113,   114,   107,    33,     0,    31,     0,
+       0,    32,   254,    26,     0,     0,    37,    38,     0,     0,
+       0,   545,     0,     0,   665,   542,     0,     0,   548,   549,
+     544,   673,     0,     0,   638,     0,     0,     0,   343,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   534,     0,     0,     0,     0,     0,     0,     0,     0,
-     535,     0,     0,     0,   536,     0,     0,     0,     0,     0,
-     552,     0,     0,     0,     5,   341,   342,   343,   344,   345,
-     346,   347,   348,   349,   350,   382,   339,   383,   384,   385,
-     386,   387,   388,   389,   390,   488,   477,   478,   479,   480,
-     481,   482,   483,   484,   485,   486,   416,     0,     0,     0,
-       0,    14,    38,     0,    50,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    17,     0,   130,   142,
-     154,   161,   162,   163,     0,   146,     0,     0,     0,     0,
-       0,   131,     0,     0,   132,     0,     0,     0,   138,     0,
-     147,     0,     0,     0,     0,     0,   167,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   178,   179,   180,
-       0,     0,    15,     0,    16,     0,     0,    27,     0,     0,
-       0,    28,     0,     0,     0,     0,    29,     0,     0,    30,
-       0,     0,     0,     0,     0,     0,    18,     0,     0,     0,
-       0,    19,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    20,     0,   262,   267,   260,   258,   263,   264,     0,
-     266,   259,     0,   270,     0,     0,     0,     0,     0,     0,
-      21,     0,     0,    22,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    23,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      34,     0,    35,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    24,    53,    54,    55,    56,
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    57,
-      58,    59,    63,    64,    65,    62,    61,    60,    76,    77,
-      78,    79,    80,    81,    82,    75,    25,    83,    84,    85,
-      86,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-      87,    88,    89,    93,    94,    95,    92,    91,    90,   106,
-     107,   108,   109,   110,   111,   112,   105,    33,     0,    31,
-       0,     0,    32,   251,    26,     0,     0,     0,   542,     0,
-       0,   661,   539,     0,     0,   545,   546,   541,   669,     0,
-       0,   634,     0,     0,     0,   340,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   255,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   252,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   674,
+     541,     0,     0,     0,     0,     0,   668,     0,   540,     0,
+       0,     0,     0,     0,     0,     0,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,    54,   288,     0,     0,    53,
+     308,     0,     0,    43,   307,     0,     0,     0,     0,     0,
+       0,   328,   326,   327,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   538,     0,     0,     0,     0,
-       0,   664,     0,   537,     0,     0,     0,     0,     0,     0,
-       0,   342,   343,   344,   345,   346,   347,   348,   349,   350,
-      52,   285,     0,     0,    51,   305,     0,     0,    41,   304,
-       0,     0,     0,     0,     0,     0,   325,   323,   324,     0,
+       0,     0,     0,     0,     0,     0,   138,     0,     0,     0,
+       0,     0,   167,   295,   168,     0,     0,     0,     0,   172,
+     302,     0,   175,     0,   178,     0,     0,     0,   163,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   220,   221,
+       0,     0,     0,     0,     0,     0,     0,     0,   226,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   212,   217,
+       0,   312,   329,   214,     0,   231,   234,   232,     0,     0,
+       0,     0,     0,     0,     0,     0,   268,   271,   272,   274,
+     276,     0,   278,     0,     0,     0,     0,   235,     0,   306,
+       0,   236,     0,   305,   120,     0,     0,     0,     0,   124,
+     125,     0,     0,   130,     0,   131,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   192,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     136,     0,     0,     0,     0,     0,   164,   292,   165,     0,
-       0,     0,     0,   169,   299,     0,   172,     0,   175,     0,
-       0,     0,   160,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   217,   218,     0,     0,     0,     0,     0,     0,
-       0,     0,   223,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   209,   214,     0,   309,   326,   211,     0,   228,
-     231,   229,     0,     0,     0,     0,     0,     0,     0,     0,
-     265,   268,   269,   271,   273,     0,   275,     0,     0,     0,
-       0,   232,     0,   303,     0,   233,     0,   302,   118,     0,
-       0,     0,     0,   122,   123,     0,     0,   128,     0,   129,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   208,
+     299,     0,   342,   300,   209,   210,   204,   331,   332,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   189,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   219,
+       0,   559,   546,     0,   666,   560,   554,     0,     0,     0,
+       0,     0,     0,     0,     0,   414,     0,   415,     0,   411,
+     420,   421,   527,   528,   410,     0,   397,     0,   399,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   664,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   205,   296,     0,   339,   297,   206,   207,
-     201,   328,   329,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   216,   556,   543,     0,   662,   557,   551,
-       0,     0,     0,     0,     0,     0,     0,     0,   411,     0,
-     412,     0,   408,   417,   418,   524,   525,   407,     0,   394,
-       0,   396,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   660,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   256,
+       0,     0,     0,   652,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   671,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     253,     0,     0,     0,   648,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   667,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   547,     0,     0,     0,     0,     0,     0,     0,     0,
+     354,   355,   356,   357,   358,   359,   360,   361,   524,   518,
+     519,   521,   520,   522,   523,   525,   526,     0,   529,   413,
+     412,   404,   416,   417,   422,   423,   405,   394,   396,     0,
+     395,     0,     0,     0,    50,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   157,     0,     0,     0,
+     259,   260,   159,   160,   161,   162,   150,     0,   145,     0,
+       0,   135,   136,   287,     0,     0,     0,   151,     0,     0,
+     550,   171,   141,     0,     0,   176,   174,   177,   179,   180,
+       0,     0,   184,     0,     0,     0,     0,   296,     0,     0,
+       0,   225,     0,     0,   223,     0,     0,     0,   227,   228,
+     229,   230,     0,     0,     0,     0,   211,     0,   330,     0,
+     213,   215,   298,   233,   304,     0,     0,     0,     0,     0,
+       0,   264,   275,   277,     0,   279,     0,     0,   303,     0,
+     283,   121,     0,   126,   313,     0,     0,     0,   129,     0,
+       0,     0,   556,     0,   672,     0,   205,   206,   207,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   544,     0,     0,     0,     0,     0,     0,     0,     0,
-     351,   352,   353,   354,   355,   356,   357,   358,   521,   515,
-     516,   518,   517,   519,   520,   522,   523,     0,   526,   410,
-     409,   401,   413,   414,   419,   420,   402,   391,   393,     0,
-     392,     0,     0,     0,    48,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   155,     0,     0,     0,   256,
-     257,   157,   158,   159,   148,     0,   143,     0,     0,   133,
-     134,   284,     0,     0,     0,   149,     0,     0,   547,   168,
-     139,     0,     0,   173,   171,   174,   176,   177,     0,     0,
-     181,     0,     0,     0,     0,   293,     0,     0,     0,   222,
-       0,     0,   220,     0,     0,     0,   224,   225,   226,   227,
-       0,     0,     0,     0,   208,     0,   327,     0,   210,   212,
-     295,   230,   301,     0,     0,     0,     0,     0,     0,   261,
-     272,   274,     0,   276,     0,     0,   300,     0,   280,   119,
-       0,   124,   310,     0,     0,     0,   127,     0,     0,     0,
-     553,     0,   668,     0,   202,   203,   204,     0,     0,     0,
+     333,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   253,
+       0,   676,     0,     0,     0,     0,     0,     0,     0,     0,
+     362,   363,   364,   365,   366,   367,   368,   369,   370,   371,
+     372,   373,   374,   375,   376,   377,   378,   379,   380,   381,
+     382,   383,   532,   530,   400,   401,   398,   649,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     615,   602,     0,     0,     0,   654,     0,     0,   660,   655,
+     567,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   330,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   250,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   359,   360,   361,
-     362,   363,   364,   365,   366,   367,   368,   369,   370,   371,
-     372,   373,   374,   375,   376,   377,   378,   379,   380,   529,
-     527,   397,   398,   395,   645,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   611,   598,     0,
-       0,     0,   650,     0,     0,   656,   651,   564,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     658,   659,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     670,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   334,   335,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   561,     0,
+     563,     0,     0,     0,     0,    41,   533,   531,     0,     0,
+       0,    51,     0,    46,     0,    48,     0,     0,     0,     0,
+     563,     0,     0,   639,     0,     0,   661,     0,     0,     0,
+       0,     0,   158,   146,     0,   154,   137,   315,   139,     0,
+     142,     0,   152,   173,     0,     0,     0,     0,   119,   297,
+       0,     0,     0,   322,   325,   324,   224,   222,     0,     0,
+       0,     0,   639,     0,     0,   498,   499,     0,     0,   257,
+     316,   321,   320,   319,   318,   218,   311,   216,   310,     0,
+       0,     0,     0,     0,     0,     0,     0,   281,     0,   122,
+       0,     0,   128,   648,     0,     0,     0,     0,     0,     0,
+       0,   239,     0,   289,   241,   290,   243,     0,     0,   250,
+     251,   252,   244,   291,   245,   292,   293,   246,   294,     0,
+     247,   248,   249,   186,     0,   657,     0,   188,     0,   193,
+       0,   656,     0,     0,     0,     0,     0,     0,     0,   200,
+     199,     0,   202,   203,   201,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   654,   655,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   666,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   331,   332,     0,     0,     0,     0,     0,
+     566,     0,     0,   640,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   558,     0,   560,     0,     0,     0,
-       0,    39,   530,   528,     0,     0,     0,    49,     0,    44,
-       0,    46,     0,     0,     0,     0,   560,     0,     0,   635,
-       0,     0,   657,     0,     0,     0,     0,   156,   144,     0,
-     152,   135,   312,   137,     0,   140,     0,   150,   170,     0,
-       0,     0,     0,   117,   294,     0,     0,     0,   319,   322,
-     321,   221,   219,     0,     0,     0,     0,   635,     0,     0,
-     495,   496,     0,     0,   254,   313,   318,   317,   316,   315,
-     215,   308,   213,   307,     0,     0,     0,     0,     0,     0,
-       0,     0,   278,     0,   120,     0,     0,   126,   644,     0,
-       0,     0,     0,     0,     0,     0,   236,     0,   286,   238,
-     287,   240,     0,     0,   247,   248,   249,   241,   288,   242,
-     289,   290,   243,   291,     0,   244,   245,   246,   183,     0,
-     653,     0,   185,     0,   190,     0,   652,     0,     0,     0,
-       0,     0,     0,     0,   197,   196,     0,   199,   200,   198,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   407,   406,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   615,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   563,     0,     0,   636,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   404,   403,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   611,
+     562,     0,     0,     0,     0,    42,     0,     0,     0,     0,
+      47,    49,    44,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   662,     0,   147,   155,   153,   143,
+     169,     0,   185,     0,     0,     0,     0,   323,     0,     0,
+       0,     0,     0,   258,   402,   409,   408,   403,   317,     0,
+       0,     0,     0,     0,     0,     0,     0,   282,   123,   127,
+     314,     0,     0,     0,     0,     0,     0,     0,   240,     0,
+       0,     0,   187,     0,     0,   191,   301,   339,   440,   190,
+     189,     0,     0,     0,     0,   196,   197,   194,     0,     0,
+     237,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   559,     0,     0,     0,     0,    40,
-       0,     0,     0,     0,    45,    47,    42,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   658,     0,   145,
-     153,   151,   141,   166,     0,   182,     0,     0,     0,     0,
-     320,     0,     0,     0,     0,     0,   255,   399,   406,   405,
-     400,   314,     0,     0,     0,     0,     0,     0,     0,     0,
-     279,   121,   125,   311,     0,     0,     0,     0,     0,     0,
-       0,   237,     0,     0,     0,   184,     0,     0,   188,   298,
-     336,   437,   187,   186,     0,     0,     0,     0,   193,   194,
-     191,     0,     0,   234,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     600,     0,     0,     0,     0,   557,     0,     0,     0,   551,
+       0,   340,   341,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   553,     0,   650,     0,
+      45,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   596,     0,     0,     0,     0,   554,     0,     0,
-       0,   548,     0,   337,   338,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   242,     0,
+       0,   336,     0,     0,   195,   198,     0,   653,   238,     0,
+     588,     0,     0,     0,     0,   584,     0,     0,     0,   595,
+       0,     0,     0,     0,     0,     0,   591,   667,   280,     0,
+       0,     0,     0,   635,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   600,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   550,     0,
-     646,     0,    43,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   635,     0,   337,   338,     0,     0,
+       0,     0,     0,   585,   583,     0,     0,     0,   587,     0,
+       0,     0,     0,   589,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   644,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   601,     0,     0,
+       0,     0,     0,   644,     0,     0,     0,     0,     0,     0,
+       0,     0,   636,     0,     0,     0,     0,     0,     0,     0,
+     552,     0,     0,   647,     0,   582,     0,     0,   586,     0,
+       0,   669,     0,     0,     0,   643,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   643,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   590,   663,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   558,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   239,
-       0,     0,   333,     0,     0,   192,   195,     0,   649,   235,
-       0,   585,     0,     0,     0,     0,   581,     0,     0,     0,
-     591,     0,     0,     0,     0,     0,     0,   587,   663,   277,
-       0,     0,     0,     0,   631,     0,     0,     0,     0,     0,
+       0,     0,   646,     0,     0,     0,   651,   543,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   616,     0,     0,
+     632,   627,     0,     0,     0,   627,     0,     0,     0,     0,
+       0,   616,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   596,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   631,     0,   334,   335,     0,     0,
-       0,     0,     0,   582,   580,     0,     0,     0,   584,     0,
-       0,     0,     0,   586,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   640,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   597,     0,     0,     0,
-       0,     0,   640,     0,     0,     0,     0,     0,     0,     0,
-       0,   632,     0,     0,     0,     0,     0,     0,     0,   549,
-       0,     0,   643,     0,   579,     0,     0,   583,     0,     0,
-     665,     0,     0,     0,   639,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   639,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   659,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   555,     0,     0,     0,     0,
+       0,   617,     0,     0,     0,     0,   628,     0,     0,     0,
+       0,   115,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     642,     0,     0,     0,   647,   540,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   612,     0,     0,   628,   623,
-       0,     0,     0,   623,     0,     0,     0,     0,     0,   612,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   619,     0,     0,     0,     0,   614,   564,     0,     0,
+       0,     0,   625,   631,     0,     0,   619,     0,   593,     0,
+       0,     0,     0,   625,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   632,   634,   637,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   593,
+       0,     0,     0,     0,     0,     0,     0,   645,     0,     0,
+     624,     0,     0,     0,   620,   592,     0,     0,     0,   116,
+     117,   309,   284,   285,   286,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     579,     0,     0,     0,     0,     0,     0,     0,     0,   629,
+       0,   608,   610,     0,     0,     0,     0,     0,     0,   629,
+       0,     0,     0,     0,     0,     0,   608,     0,     0,     0,
+       0,     0,     0,   613,     0,     0,     0,   578,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   612,
+     607,     0,     0,     0,     0,     0,     0,     0,   630,     0,
+       0,     0,   118,     0,     0,     0,     0,     0,     0,   633,
+       0,     0,     0,     0,   597,     0,     0,     0,   575,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   613,
-       0,     0,     0,     0,   624,     0,     0,     0,     0,   113,
+       0,   594,     0,     0,     0,   580,     0,     0,     0,     0,
+       0,     0,     0,   596,     0,     0,   574,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   612,     0,     0,     0,     0,
+       0,   571,     0,     0,     0,   599,   641,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   615,
-       0,     0,     0,     0,   610,   561,     0,     0,     0,     0,
-     621,   627,     0,     0,   615,     0,   589,     0,     0,     0,
-       0,   621,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   628,   630,   633,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   589,     0,     0,
-       0,     0,     0,     0,     0,   641,     0,     0,   620,     0,
-       0,     0,   616,   588,     0,     0,     0,   114,   115,   306,
-     281,   282,   283,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   576,     0,
-       0,     0,     0,     0,     0,     0,     0,   625,     0,   604,
-     606,     0,     0,     0,     0,     0,     0,   625,     0,     0,
-       0,     0,     0,     0,   604,     0,     0,     0,     0,     0,
-       0,   609,     0,     0,     0,   575,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   608,   603,     0,
-       0,     0,     0,     0,     0,     0,   626,     0,     0,     0,
-     116,     0,     0,     0,     0,     0,     0,   629,     0,     0,
-       0,     0,   593,     0,     0,     0,   572,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   590,
-       0,     0,     0,   577,     0,     0,     0,     0,     0,     0,
-       0,   592,     0,     0,   571,     0,     0,     0,     0,     0,
+       0,   581,     0,   570,     0,     0,   598,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   608,     0,     0,     0,     0,     0,   568,
-       0,     0,     0,   595,   637,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   578,
-       0,   567,     0,     0,   594,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   566,     0,
-       0,   570,     0,     0,     0,     0,   638,     0,     0,   619,
-       0,     0,     0,     0,   565,     0,     0,   569,     0,     0,
-       0,     0,     0,     0,   599,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   622,     0,   601,     0,   618,
-       0,     0,     0,     0,     0,   617,     0,     0,     0,     0,
-     574,     0,   605,     0,   614,     0,   602,   573,   607,   562,
-       0,   600
+     569,     0,     0,   573,     0,     0,     0,     0,   642,     0,
+       0,   623,     0,     0,     0,     0,   568,     0,     0,   572,
+       0,     0,     0,     0,     0,     0,   603,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   626,     0,   605,
+       0,   622,     0,     0,     0,     0,     0,   621,     0,     0,
+       0,     0,   577,     0,   609,     0,   618,     0,   606,   576,
+     611,   565,     0,   604
 };
 
   /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718, -1718, -1718, -1718, -1718, -1718,  -982, -1718,
-   -1718, -1718, -1718, -1718, -1718,  -925,  -492, -1683, -1718, -1620,
-     -32, -1718,  -534, -1177, -1500,   798, -1438, -1718,  1105, -1349,
-   -1335,  -959,  -905,  -468,  1095,   120,   797, -1718,  3972, -1368,
-   -1717,  3472, -1416,  3228,  -954,  3242,  4022, -1718, -1718,  -986,
-    -597, -1718,     8,   351, -1082,  3594,    12,  -544,  4290, -1718,
-   -1718, -1718, -1323,  3385,  -886,    70,   769,  -894,   346,    73,
-    -501,  -888, -1718, -1718,   -19,  4920, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718,  3587, -1718, -1718, -1718, -1718, -1718, -1718,
-    -462,  3216, -1718,  -453, -1718, -1718, -1718, -1718, -1718, -1718,
-   -1718, -1718, -1718,   467,  4792,  4794,  4795,  -346,  4786,  4789,
-    4790,  4791,  4796,  4798,  4800,  4801,  4803,  4804,  4805,  4806,
-   -1718,  4808,  4809,  4810,  4811,  4812,  4813,  4814,  -145,  -141,
-    -131,   566,   571, -1718,  4815,  4816,  4817,  4818,  4819,  -490,
-    4383,  4826, -1718, -1718, -1718, -1718,  4802,  -138, -1718, -1718,
-    4825,  -220, -1718,  4829,  -420,   584,  4830,  4831,   437,  4832,
-    4833, -1718,  4834,  4835,  -126, -1718,   593,   471,  -132,  4836,
-   -1718,  4368, -1718, -1718,  -113, -1718, -1718, -1718,    65,  4838,
-     486,   275,   373,   241, -1718, -1718,  4360, -1718, -1718,  -480,
-     202, -1718, -1718, -1718,  -149, -1718, -1718, -1718, -1718,  4837,
-    4839, -1718, -1718,  4841, -1718, -1718, -1718, -1718,  4824,   115,
-   -1718, -1718, -1718
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730, -1730, -1730, -1730, -1730, -1730,  -993, -1730,
+   -1730, -1730, -1730, -1730, -1730,  -944,  -516, -1719, -1730, -1631,
+     -33, -1730,  -513, -1179, -1530,   153, -1490, -1730,  1091, -1365,
+   -1347,  -955,  -917,  -498,   441,  2452,  3151, -1730,  3974, -1375,
+   -1729,  3466, -1360,  3228,  -987,  3243,  4033, -1730, -1730, -1015,
+    -606, -1730,   -14,   346, -1116,  3598,     7,  -550,  4302, -1730,
+   -1730, -1730, -1346,  3387,  -906,    79,   549,  -904,   763,    84,
+    -475,  -874, -1730, -1730,   -20,  4945, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730,  3591, -1730, -1730, -1730, -1730, -1730, -1730,
+    -467,  3217, -1730,  -479, -1730, -1730, -1730, -1730, -1730, -1730,
+   -1730, -1730, -1730,   221,  4814,  4815,  4816,  -364,  4810,  4811,
+    4812,  4813,  4817,  4818,  4819,  4820,  4821,  4822,  4823,  4824,
+   -1730,  4825,  4826,  4828,  4829,  4830,  4831,  4832,  -147,  -139,
+   -1730,  -138,   589,   591, -1730,  4834,  4835,  4836,  4837,  4838,
+    -506,  4397,  4839, -1730, -1730, -1730, -1730,  4846,  -142, -1730,
+   -1730,  4844,  -426, -1730,  4848,  -510,   601,  4849,  4847,   387,
+    4851,  4855, -1730,  4850,  4856,  -135, -1730,   610,   435,  -141,
+    4857, -1730,  4382, -1730, -1730,  -158, -1730, -1730, -1730,   512,
+    4864,   473,   393,   311,   510, -1730, -1730,  4374, -1730, -1730,
+    -471,   211, -1730, -1730, -1730,  -156, -1730, -1730, -1730, -1730,
+    4865,  4866, -1730, -1730,  4867, -1730, -1730, -1730, -1730,  4845,
+      25, -1730, -1730, -1730, -1730, -1730,  4841
 };
 
   /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,    16,    17,    18,    19,    20,   251,   415,   446,   312,
-     314,   373,   266,   384,   336,   484,   317,   321,   326,   329,
-     341,   370,   400,   402,   835,   479,   482,   748,  1234,  1178,
-     351,   477,   801,   805,  2407,  1190,   670,  1617,  1619,  1627,
-    1629,  1632,   726,  1214,  1563,  1239,   873,  1858,   733,  1255,
-    1241,   806,   802,   678,   674,  2408,  1592,  1590,   773,  1261,
-    1842,  1551,  1584,  1585,  1219,  1568,   684,   774,  1237,   880,
-    1586,  1859,   875,   162,  1138,  1369,   734,   679,   930,   931,
-    1148,  1588,   675,  1724,   920,  1570,  1589,   922,   165,   166,
-     167,   924,   925,   926,   927,    67,    68,    21,    22,    23,
-      24,    25,    26,  1157,    27,    28,    29,    30,    31,    32,
-    1631,  1625,  1626,   685,    33,    34,   385,   828,   829,    35,
-      36,    37,    38,   252,   268,   269,   270,   706,   416,   417,
-     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
-     762,   428,   429,   430,   431,   432,   433,   434,   435,   436,
-     437,   271,   272,   273,   440,   441,   442,   443,   444,   371,
-     745,   274,  2410,  2411,  2412,   387,   275,   276,   277,   278,
-     279,   280,   838,   281,   282,   283,   284,   285,   253,   287,
-     288,   390,   289,   290,   291,   292,   293,   294,   254,   296,
-     297,   298,   842,   843,   660,   789,   861,    39,   299,   300,
-     255,   302,   256,   304,   305,   483,   865,   818,   686,   687,
-     688,   324,   869,   306,   307,   862,   851,   846,   847,   308,
-     309,  1179,  1180,   310,    40,    41,   900,    42,   445,   855,
-     399,   830,    43
+      -1,    17,    18,    19,    20,    21,   260,   424,   455,   321,
+     323,   382,   275,   393,   345,   493,   326,   330,   335,   338,
+     350,   379,   409,   411,   851,   488,   491,   764,  1256,  1199,
+     360,   486,   817,   821,  2439,  1212,   685,  1642,  1644,  1652,
+    1654,  1657,   742,  1236,  1588,  1261,   889,  1885,   749,  1277,
+    1263,   822,   818,   693,   689,  2440,  1617,  1615,   789,  1283,
+    1869,  1576,  1609,  1610,  1241,  1593,   699,   790,  1259,   896,
+    1611,  1886,   891,   167,  1158,  1392,   750,   694,   947,   948,
+    1168,  1613,   690,  1750,   937,  1595,  1614,   939,   170,   171,
+     172,   941,   942,   943,   944,    72,    73,    22,    23,    24,
+      25,    26,    27,  1177,    28,    29,    30,    31,    32,    33,
+    1656,  1650,  1651,   700,    34,    35,   394,   844,   845,    36,
+      37,    38,    39,   261,   277,   278,   279,   721,   425,   426,
+     427,   428,   429,   430,   431,   432,   433,   434,   435,   436,
+     778,   437,   438,   439,   440,   441,   442,   443,   444,   445,
+     724,   446,   280,   281,   282,   449,   450,   451,   452,   453,
+     380,   761,   283,  2442,  2443,  2444,   396,   284,   285,   286,
+     287,   288,   289,   854,   290,   291,   292,   293,   294,   262,
+     296,   297,   399,   298,   299,   300,   301,   302,   303,   263,
+     305,   306,   307,   858,   859,   675,   805,   877,    40,   308,
+     309,   264,   311,   265,   313,   314,   492,   881,   834,   701,
+     702,   703,   333,   885,   315,   316,   878,   867,   862,   863,
+     317,   318,  1200,  1201,   319,    41,    42,   916,    43,   454,
+     871,   408,   846,    44,    45,    46,   496
 };
 
   /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1341,855 +1349,783 @@ static const yytype_int16 yydefgoto[] =
      number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     168,  1183,   169,   170,   171,   172,   173,   174,   175,   176,
-     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
-     187,   188,   189,   190,   874,   750,  1139,   752,  1527,  1635,
-    1238,   163,  1154,   396,  1145,  1143,  1415,  1553,   295,   337,
-     342,   466,  1143,  1192,  1222,   467,   683,   720,  1874,   376,
-     392,   339,   344,   803,  1638,   468,  1370,   791,  1642,  1274,
-    1275,  1276,  1714,  -381,  1789,  1851,   744,   813,  2174,  2279,
-    2280,   737,   739,  2186,  1866,  1558,  2174,    49,  1606,  2223,
-    2281,  1210,   728,   736,   738,   225,   227,   228,   229,   230,
-     231,   232,   233,   234,  1603,  2299,   757,   759,  1569,   753,
-     764,   765,   766,   767,    50,   749,  1236,   831,   811,  1591,
-    1593,  2175,  1607,   795,   797,  2304,  2187,  2304,  1841,  2200,
-    1253,    61,  2224,  1257,   832,   794,   796,  1660,  1661,   792,
-     833,  1854,   524,   834,    51,   817,   819,   636,  2300,   814,
-      52,   405,    62,  1296,   804,    44,  1648,  1649,  1650,  1651,
-    1652,   901,   525,   704,  -381,  -381,  -381,   637,  2305,   893,
-    2316,  2064,    45,   705,  1654,  1655,   414,  1657,   368,  1659,
-      46,   923,   923,    47,    57,    53,    48,   369,  2065,   894,
-     812,  1314,   815,   710,   711,   712,   713,   714,   715,   716,
-     717,   718,   719,    58,   721,   722,   723,   724,   860,   729,
-     730,   731,   732,   319,   735,   883,   884,   740,   741,   742,
-    1813,   698,   515,   516,   989,   699,   320,  2321,  2202,   215,
-     661,   662,   663,   664,   665,   666,   667,   668,   669,   247,
-     248,  1556,  2026,   510,   511,   512,   513,   514,  1622,  2322,
-     676,   677,   340,   345,   249,    59,   377,   393,   528,  1139,
-     250,  1145,  1176,  1623,   521,   529,   682,   530,   531,   532,
-     533,   534,  1372,   535,   536,  2025,   537,   538,   539,   522,
-     540,  1177,   541,   542,   543,   544,   545,  2128,   546,   547,
-     548,   549,   550,   551,   552,   553,   554,   555,  1523,  2090,
-      54,   556,  2217,  2080,   558,  2129,   559,  2237,    60,   561,
-     680,   676,   677,   564,   565,   566,  2091,  1826,   568,   569,
-    2218,   570,   571,   681,  2219,  2238,   609,   682,   576,   577,
-     578,   579,  1869,   580,   581,   582,   583,   346,   525,   258,
-     319,   347,   348,   589,   521,  2569,  1855,  1524,  1862,   864,
-     590,  1795,  1525,   591,   349,   592,   593,   594,   595,   586,
-     350,  2564,   597,   598,   854,   599,   600,   601,   602,   603,
-     604,   606,   630,  1815,   607,   631,   610,   611,   612,   613,
-     614,   615,   616,   617,   618,   619,   620,   621,   622,   623,
-     624,  1877,   625,   707,   626,   856,   519,   708,  1049,   810,
-    1867,   837,  1878,   803,  1569,    64,  1879,   709,   859,   520,
-    1050,   857,   858,   854,   215,   661,   662,   663,   664,   665,
-     666,   667,   668,   669,   676,   677,   328,   331,    55,   923,
-     923,  1144,   379,   395,    56,    63,   756,   923,   226,   226,
-     226,   226,   226,   226,   226,   226,   226,   659,  1593,  1197,
-    2383,  1199,   803,   247,   325,   864,   334,   867,   332,   322,
-    2059,  2384,   333,   334,   365,  2385,    65,    66,   249,   640,
-     854,   641,   845,  2060,   250,   335,   643,   803,  1571,  1572,
-    1156,  1158,   702,   836,  1529,   703,  1531,  1193,  1139,   840,
-    1883,   803,  1636,  1637,   803,   839,   809,   680,   676,   677,
-    2380,  1884,   404,   405,   406,   407,   408,   409,   844,   209,
-     756,  2381,  1984,   410,   682,   210,  1985,  1560,   161,   411,
-     246,  1203,  1204,  1205,  1206,   412,   413,   825,   414,  1986,
-     826,   191,   257,   671,   258,   259,   260,   261,   192,  1221,
-     827,  1223,   676,   677,  1226,  1227,  1228,  1229,  1300,   262,
-     193,  1263,   803,   303,   747,   263,   264,   323,   265,   194,
-    1543,   671,   366,  1544,  1250,  1251,   727,   215,   661,   662,
-     663,   664,   665,   666,   667,   668,   669,  1543,  1266,  1699,
-    1674,   727,  1700,   727,   672,   673,   505,   810,   505,   505,
-     505,   505,   505,   505,   505,   505,  1658,  2405,  2406,   775,
-    2469,   207,   779,   780,   781,   584,   516,   208,   212,  1319,
-    1320,  2470,   790,   727,   213,  2474,   380,   286,   247,   325,
-     381,   334,   671,   727,  1310,  1311,  2475,  1313,   375,  1315,
-     401,   403,   195,   382,   848,   849,   197,   852,   853,   383,
-     672,   673,   265,   877,   878,   879,   881,   267,  1144,  1209,
-    2527,   917,   923,   196,   318,   198,   352,   923,   374,   386,
-     362,  2528,  2535,   199,   478,   480,   301,   485,   816,   676,
-     677,   327,   330,  2536,   937,   938,   939,   378,   394,   225,
-     227,   228,   229,   230,   231,   232,   233,   234,  1731,  1743,
-    1774,  1732,  1681,  1775,  1143,   676,   677,   956,   957,   958,
-     959,   960,   961,   962,   963,   964,   965,   966,   967,   968,
-     969,   200,   970,   971,   972,   973,  2615,  1155,   676,   677,
-     975,   976,   977,   978,  2180,  2181,   979,  2616,   980,   201,
-     981,   982,   983,   202,  1809,   985,   986,  1812,   203,  1939,
-     990,   991,  1681,   863,   866,   870,  2210,  2211,   996,   997,
-     998,   999,   921,   928,   204,  1002,  1003,  1004,  1005,   932,
-     932,   438,   469,  1010,   206,  1011,   439,   470,  1012,  1013,
-     727,   338,   343,  1014,   313,   315,   758,   760,   205,   211,
-    1021,    65,   311,   316,   325,   250,  1022,   247,  1023,   481,
-    1025,   486,   487,  1027,  1794,  1028,  1796,  1029,   164,  2198,
-    1030,   488,  1032,  1033,   489,   492,  1034,   490,   491,  1036,
-    1120,  1121,  1122,  1123,  1124,  1125,  1126,  1127,   493,  1045,
-    1046,  1047,   494,   495,   496,   499,  2309,  1053,  1054,  1055,
-    1056,  1057,  1058,  1059,  1060,  1061,  1062,  1063,  1064,  1065,
-    1066,   497,  1068,  1069,  1070,   803,  1072,   803,   498,  1873,
-    1076,  1077,  1078,  1079,  1080,   500,  1082,  1083,   501,  1085,
-    1086,  1087,   502,   503,  1521,   504,   506,   507,  1917,   508,
-     517,   509,   518,   523,  1091,  1092,   526,   562,   803,   567,
-     874,   923,   557,   527,   563,   560,   572,   573,   585,  1088,
-    1089,  1108,  1109,   215,   661,   662,   663,   664,   665,   666,
-     667,   668,   669,   574,     1,   575,   587,     2,   588,   725,
-     605,  1140,   215,   216,   217,   218,   219,   220,   221,   222,
-     223,   224,  1530,   520,  1532,   596,   608,   627,   628,     3,
-     923,     4,     5,     6,     7,   629,   632,   634,  1624,   633,
-       8,   638,     9,   635,   639,    10,    11,   648,   645,   647,
-      12,    13,    14,   642,    15,   644,   646,   803,   649,   650,
-    1090,   652,  1604,   215,   216,   217,   218,   219,   220,   221,
-     222,   223,   224,   651,   653,   654,  1616,   655,   656,  1621,
-    1213,   657,   876,  1184,  1634,   658,  1187,  1188,   775,  1191,
-    1191,   671,  1194,  1195,   689,   727,   690,   727,   659,  1201,
-     691,    -6,    -6,   693,   692,  1207,   694,   696,   695,  1982,
-     697,   700,   701,  1215,   704,   743,   746,   747,   751,   754,
-     755,   761,   226,   226,   226,   226,   226,   226,   226,   226,
-     226,   763,   768,   769,   770,  1240,  1242,  2029,   771,   783,
-     787,   785,   784,   786,  2409,   798,   800,   788,   810,  1256,
-     820,   821,   823,   822,  1262,   671,   824,   850,  1120,  1121,
-    1122,  1123,  1124,  1125,  1126,  1127,   885,   881,   881,   881,
-     886,   854,   887,  1128,   888,   890,   889,   891,   892,   923,
-    1129,  1130,  1131,   896,  1132,   895,   897,   902,  1294,   898,
-    1191,   904,  1298,   369,   727,   899,   905,   907,   906,   908,
-     909,   912,  2073,   910,   913,   911,   914,   915,  1318,   935,
-    1346,   916,  1133,   671,   671,   934,  1134,   936,  1135,   940,
-    1136,   941,  1137,   942,   943,   944,   946,   945,   246,   948,
-     947,   949,   246,   246,  1140,   950,   951,   952,  2409,   637,
-     953,   955,   954,   974,   984,  1377,   987,  1379,  1380,  1381,
-    1382,  1000,   992,   988,   994,   803,   993,   803,  1001,   995,
-    1006,  1007,  1009,   246,  1015,  1008,  1016,  1017,  1018,  1400,
-    1019,  1020,  1024,   874,  1031,  1035,  1401,  1026,  1402,  1403,
-    1038,  1037,  1039,  1404,  1405,  1406,  1040,  1407,  1408,  1042,
-    1041,  1043,  1409,  1410,  1044,  1048,  1051,  1067,  1052,  1071,
-    1412,  1075,  1074,  1084,  1081,  1416,  1073,  1093,  1094,  1095,
-    1420,  1098,  1422,  1420,  1423,   215,   661,   662,   663,   664,
-     665,   666,   667,   668,   669,  1430,   923,  1096,  1432,  1430,
-    1433,  1097,   226,   226,  1797,  1215,   505,  1100,   246,  1099,
-    1101,  1102,  1104,  1103,  1105,  1106,  1442,  1107,  1443,  1110,
-    1444,  1111,  1113,  1316,  1446,  1447,   215,   216,   217,   218,
-     219,   220,   221,   222,   223,   224,  1112,  1114,  1116,  1115,
-    1117,  1118,  1458,  1459,  1460,  1461,  1462,  1463,  1464,  1465,
-    1466,  1467,  1468,  1469,  1147,  1471,  1149,  1473,  1150,  1475,
-    1151,  1477,  1152,  1153,  1160,  1481,  1482,  1483,  1484,  1485,
-    1161,  1487,  1488,  1162,  1490,  1491,  1492,  1163,  1164,  1317,
-    1495,  1496,   215,   216,   217,   218,   219,   220,   221,   222,
-     223,   224,  1165,  1166,  1167,  1168,  1169,  1512,  1171,  1170,
-    1172,  1173,  1174,  1945,  1493,  1494,   215,   216,   217,   218,
-     219,   220,   221,   222,   223,   224,  1198,  1208,  1211,  1212,
-    1217,  1218,  1216,  1224,  1225,   772,   776,   777,  1230,  1231,
-    1232,  1233,  1243,  1140,  1244,  1245,  1246,  1247,   671,  1248,
-     803,  1252,  1254,  1260,  1267,  2020,  1265,   807,   215,   216,
-     217,   218,   219,   220,   221,   222,   223,   224,  1268,  1269,
-    1270,  1271,  1272,  1273,  1277,  1278,  1279,  1280,   703,  1256,
-    1295,  1301,  1299,   882,  2021,  1302,  1562,   215,   216,   217,
-     218,   219,   220,   221,   222,   223,   224,  1303,  1309,  1312,
-    1321,  1322,  1323,  1324,  1549,  1550,  1552,  1262,  1554,  1325,
-    1215,  1557,  1242,  1326,  1327,  1328,  1329,  1330,  1564,  1331,
-    1332,  1333,  1334,  1338,  1335,  1339,  1340,  1341,  1392,   505,
-     505,   226,  1342,  1587,  1344,  1343,  1373,  1376,  1345,  1375,
-    1374,  1384,  1378,   803,  1385,  1256,   671,  1388,  1262,  1242,
-    1386,  1389,  1383,  1391,  1393,  1387,  1394,  1390,  1395,  1396,
-     671,  1618,  1399,   671,   727,  1628,  1630,  1397,   671,   877,
-     881,   881,  1587,  1413,  1398,  1552,  1587,  1411,  1417,  1418,
-    1414,  1424,  1425,  1242,  1242,  1242,  1242,  1242,  1427,  1428,
-    1429,  1435,  1684,  1436,  1437,  1438,  1439,  1262,  1262,  1441,
-    1419,  1689,  1690,  1691,  1692,   871,   872,   215,   661,   662,
-     663,   664,   665,   666,   667,   668,   669,  1426,  1434,  1706,
-    1707,   246,   246,  1440,  1445,  1708,  1709,  1710,  1448,  1449,
-    1450,  1712,   246,  1452,  1451,  1453,   246,  1454,  1455,  1456,
-    1472,  1457,  1420,  1420,  1476,  1478,  1479,  1480,  1486,  1489,
-    1497,  1498,  1499,  1726,  1726,  1501,   246,  1502,  1507,  1500,
-    1504,  1503,  1505,  1506,  1564,  1511,  1509,  1508,  1510,  1514,
-    1515,   246,  1516,  1519,  1737,  1738,  1520,  1740,  1088,  1089,
-    1513,  1518,  1517,  1526,  1535,  1528,  1534,  1536,  1748,  1856,
-    1857,   215,   216,   217,   218,   219,   220,   221,   222,   223,
-     224,  1537,  1539,  1538,  1540,  1751,  1541,  1542,  1561,  1545,
-    1546,  1559,  1753,  1524,  1577,  1565,  1566,  1525,  1573,  1757,
-    1758,  1759,  1760,  1761,  1575,  1576,  1574,  1578,  1595,   246,
-    1596,  1764,  1765,   246,  1594,  1597,  1598,  1601,  1599,  1605,
-    1600,  1609,  1608,  1611,  1610,  1612,  1613,   874,  1782,  1614,
-    1640,  1645,  1646,  1615,  1662,  1653,  1664,   226,   226,   505,
-    1647,  1668,  1670,  1665,  1656,  1671,  1672,  1675,  1678,  1663,
-    1666,  1679,   246,  1681,   778,  1680,  1667,  1682,   782,  1669,
-    1673,  1683,  1676,  1685,  1686,  1817,  1628,   793,  1688,  1687,
-    1694,  1696,  1256,  1701,   808,  1829,  1693,  1702,  1829,  1695,
-    1697,  1698,  1703,  1704,  1705,  1713,  1711,  1721,  1715,  1718,
-    1728,  1716,  1564,  1719,  1256,  1720,  1722,  1729,  1730,   807,
-    1733,  1185,  1186,  1734,  1736,  1587,  1735,  1739,  1744,  1741,
-    1587,  1196,  1742,  1745,  1747,  1200,  1749,  1750,   903,  1756,
-    1628,  1746,  1843,  1755,  1762,  1763,  1767,  1766,  1776,  1769,
-    1618,  1860,  1770,  1628,  1587,  1220,  1587,  1220,  1771,  1618,
-    1262,  1240,   877,  1768,  1772,  1773,  1191,  1843,  1904,  1235,
-    1777,  1235,   876,  1778,  1779,  1780,  1781,  1786,  1783,  1784,
-    1430,  1787,  1785,  1430,  1894,  1788,  1790,  1791,  1798,  1792,
-    1793,  1799,  1804,  1800,  1802,  1806,  1801,  1808,  1814,  2274,
-    1836,  1848,  1805,  1803,   882,   882,   882,  1807,   876,  1889,
-    1816,   876,  1852,  1818,  1821,   876,  1819,  1822,  1823,  1824,
-    1825,  1832,  1833,  1834,  1293,  1942,  1835,  1837,  1297,  1838,
-    1844,  1839,  1845,  1846,   505,   505,  1847,  1948,  1949,  1849,
-    1850,  1853,  1872,  1864,  1865,  1952,  1871,  1876,  1881,  1882,
-    1885,  1875,  1891,  1880,  1943,  1944,  1888,  1893,  1886,  1890,
-    1887,  1895,  1892,  1896,  1898,  1972,  1897,  1336,  1899,  1900,
-    1901,  1903,  1905,  1902,  1908,  1907,  1906,  1909,  1910,  1911,
-    1912,  1913,  1914,  1916,   246,  1915,  1922,  1918,  1997,  1919,
-    1920,   246,  1921,  1923,  1925,  1929,  1931,  1924,  1940,  1941,
-    2019,  1926,  1930,   246,  1927,  1928,  1933,  1958,  1932,  1935,
-    1934,  1936,  1937,  1959,  1947,   246,  1938,  1953,  1954,  1946,
-    1955,   226,   226,  1950,  1951,   246,  1956,  1957,  1960,  1963,
-    1961,  1962,  1966,  1964,  1965,  1967,  1969,  1970,  1979,  1974,
-    1968,  1971,  1973,  2022,  1630,  1975,  1976,  1978,  1977,  1980,
-    1618,  1843,  1981,  1987,  1191,  1983,   246,  1990,  1992,  1993,
-    1988,  1991,  1994,  1999,  1995,  1996,  1998,  2000,  2001,   246,
-    1989,  2033,  2002,  2004,  2049,   246,  2003,  2028,  2005,   246,
-    1347,  1348,  1349,  1350,  1351,  1352,  1353,  1354,  1355,  1356,
-    1357,  1358,  1359,  1360,  1361,  1362,  1363,  1364,  1365,  1366,
-    1367,  1368,  2006,  2011,  2008,  2007,  2009,  2027,  2010,  2012,
-    2013,  2015,  1119,  2017,  2014,  2016,  2031,  2018,  2096,  2097,
-    2030,  2023,  2024,  2034,  2032,  2035,  2036,  2037,  2039,  2038,
-    2040,  2042,  2044,  2041,  2043,  2045,  2046,  2048,  2047,  2050,
-    2051,  2052,  2053,  2054,  2138,  2063,  2056,  2061,  2055,  2062,
-    2057,  1175,  2058,  1181,  1182,  2066,  2067,  2068,  2070,  2069,
-    2071,   246,  2075,  2072,   876,  2074,  2076,  2078,  2077,   876,
-    2079,  2080,  2082,  1202,  2083,  2081,  2084,  2086,  2085,  2087,
-    2088,  2089,  2092,  2093,  2094,  2095,  2098,  2099,  2101,  2104,
-    2106,  2109,  2100,   876,   226,   876,  2103,  2102,  2105,  2111,
-    2107,   876,  2108,  2110,  2117,  2112,  2118,  2114,  2113,  2116,
-    2119,  2120,  2122,  2115,  2124,  2123,  1249,  2125,  2121,  2126,
-    2127,  2131,  2132,  2133,  1258,  1259,  2130,  2134,  2136,  1264,
-    2135,  2137,  2139,  2141,  2144,  2140,  2142,  2145,  2148,  2147,
-    1256,  2143,  2149,  2150,  2153,  2151,   246,   246,  1281,  1282,
-    1283,  1284,  1285,  1286,  1287,  1288,  1289,  1290,  1291,  1292,
-    1548,  2154,  2146,  2155,   246,  2152,  1555,  2156,  2157,  2254,
-    2159,  1304,  1305,  1306,  1307,  1308,  2160,  2161,  2162,  1567,
-    2164,  1220,  1220,  2165,  2158,  2166,  2167,  2168,  2169,  1579,
-    2163,  2170,  2171,  2172,  2176,  2173,  2178,   226,   226,  2177,
-    2183,   505,  2179,  2188,  1337,  2189,  2182,  2184,  2185,  2194,
-    2190,  2175,  2193,  2196,  2202,  2203,  2206,  2192,  2205,  1620,
-    2191,  2195,  2197,  2199,  1633,  2212,  2201,   882,   882,  2204,
-    1639,  2209,  2207,  2222,  1643,  2208,  2213,  2225,  2214,  2228,
-    2221,  2230,  2215,  2227,  2216,  2220,  2231,  2229,  2226,  2233,
-    2232,  2234,  2239,  2235,  2236,  2240,   877,  2241,  2244,  2246,
-    2245,  2248,  2247,  2250,  2251,  2249,  2258,  2256,  2276,  2252,
-    2259,  2260,  2253,  2261,  2255,  2257,  2262,  2265,  2242,  2266,
-    2357,  2263,  2267,  2264,   505,   505,   226,  2268,  2269,  2270,
-    2273,  2272,  2277,  2282,  2283,  2243,  2285,  2284,  2271,  2286,
-    2275,  2290,  2291,  2287,  2278,  2289,  2292,  2295,  2294,  2297,
-    2296,  2298,  2301,  2302,  2313,  2306,  2307,  2308,  2310,  2315,
-    2288,  2318,  2320,  2293,  2317,  2323,  2303,  2304,  2321,  2359,
-    2328,  2299,  2312,  2314,  2325,  2326,  2311,  2324,  2329,  2319,
-    2330,  1725,  1725,  2333,  2327,  2335,  2300,  2331,  2332,  2342,
-    2337,  2334,  2336,  2338,  2343,  2339,  2340,  2341,  2346,  2349,
-    2350,   226,   226,   505,  2347,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,  2344,  2451,   929,
-    2345,  2348,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
-     139,   140,  2351,  2352,  2353,  2356,  2354,  2355,  2358,  2360,
-    2361,  2362,  2363,  2365,  2364,  2367,  2368,   505,   505,  2366,
-    2370,  2369,  2371,  2372,  2373,  2374,  2375,  2379,  2382,  2376,
-    2377,  2387,  2386,  2378,  2388,  2389,  2390,  2392,  2391,  2394,
-    2393,  2395,  2396,  2397,  2398,  1235,  1810,  1811,  1235,  2400,
-    2399,  2401,  2402,  2417,  2413,  2403,  2404,  2414,  2415,  2416,
-    2418,  2419,  2421,  1828,  2423,  2422,  1828,  2424,  2425,  2434,
-    2426,  2441,  2427,  2428,  2429,  1547,  2430,  2436,  2438,  2432,
-    2439,  2433,  2420,  2431,  2437,  2443,  2442,  2452,  2440,  2435,
-    2444,  2445,  2450,  2447,  2446,  2448,  2453,  2449,  2454,  2455,
-    2457,  2456,  2458,  2461,  2459,  2460,  2462,  2463,  2466,  2464,
-    2465,  2473,  2468,  2472,  2467,  2471,  2476,  1602,  2483,  2484,
-    2477,  2480,  2485,  2478,  2487,  2492,  2495,  1868,  1870,  2481,
-    2493,  2496,  2489,  2482,  2486,  2501,  2491,  2502,  2499,  2497,
-    2500,  2490,  1644,  2479,  2520,  2518,  2503,  2504,  2488,  2505,
-    2512,  2506,  2508,  2509,  2526,  2510,   807,  2515,  2541,  2513,
-    2533,  2516,  2517,  2494,  2522,  2521,  2523,  2519,  2524,  2525,
-    2529,  2532,  2530,  2531,  2538,   876,  2537,  2543,  2534,  2539,
-    2540,  2498,  2546,  2542,  2544,  2547,  2507,  1677,    69,   235,
-      71,    72,    73,    74,    75,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,   672,   673,   918,
-      99,   919,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,   161,    69,   235,    71,    72,    73,    74,    75,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,  1141,  2511,  1142,    99,   919,   101,   102,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
-     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
-     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
-     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
-     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   161,  2514,  2545,
-    2548,  2549,  2550,    69,   235,    71,    72,    73,    74,    75,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,  1840,  1146,  1142,    99,   919,   101,   102,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
-     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
-     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
-     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
-     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   161,    69,   235,
-      71,    72,    73,    74,    75,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,  1827,  2551,    98,
-      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     173,  1660,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,  1205,   196,   197,   168,   890,   698,
+    1244,   405,  1163,  1159,   304,  1551,   736,  1174,  1260,  1163,
+     346,   351,  1393,  1214,   475,   385,   401,   348,   353,  1296,
+    1297,  1298,   476,   477,  1578,  1878,  1439,  1740,  -384,   766,
+     819,   768,  1901,   760,  1893,  1165,   752,   754,   234,   236,
+     237,   238,   239,   240,   241,   242,   243,  2205,  1815,   773,
+     775,    49,  2217,   780,   781,   782,   783,  1583,  1232,  2205,
+     744,   807,   765,   753,   755,  1631,  2255,   827,  2331,  1594,
+     847,   829,  1628,   828,   622,   831,   377,   769,   810,   812,
+    1616,  1618,  2336,  1258,  2336,   378,   538,   848,   833,   835,
+    2206,   876,  2158,   849,  1632,  2218,   850,  1275,   899,   900,
+    1279,   820,  2232,  1868,  1663,   811,   813,   808,  1667,  2256,
+    2159,  2332,   414,  1318,  1685,  1686,  1881,   830,   917,  -384,
+    -384,  -384,  2353,  2234,   719,  2337,    66,  2348,  1673,  1674,
+    1675,  1676,  1677,   328,   720,  1679,  1680,   423,  1682,    56,
+    1684,    53,  1804,    58,  2354,    57,   329,    67,   726,   727,
+     728,   729,   730,   731,   732,   733,   734,   735,  1336,   737,
+     738,   739,   740,  1941,   745,   746,   747,   748,   853,   751,
+      70,    71,   756,   757,   758,   875,  1840,  2249,  2110,    62,
+     537,   649,   940,   940,  1197,   224,   676,   677,   678,   679,
+     680,   681,   682,   683,   684,  2250,   909,    64,    63,  2251,
+     538,   650,  2269,  1198,  1647,   389,    59,   256,   334,   390,
+     343,   523,   524,   525,   526,   527,   910,    47,  2055,  1648,
+    2270,  1008,   391,  1581,   691,   692,   541,  2054,   392,  1159,
+     532,   274,  1395,   542,    48,   543,   544,   545,   546,   547,
+     697,   548,   549,   533,   550,   551,   552,  1547,   553,    65,
+     554,   555,   556,   557,   558,  1165,   559,   560,   561,   562,
+     563,   564,   565,   566,   567,   568,  1896,  2093,    68,   569,
+     256,   334,   571,   343,   572,  2120,  1068,   574,    54,   256,
+     257,   577,   578,   579,  2094,   258,   581,   582,  1069,   583,
+     584,   259,  2121,    55,   258,  1910,   589,   590,   591,   592,
+     259,   593,   594,   595,   596,   355,  1911,   267,   328,   356,
+     357,   602,   341,   528,   529,  2012,   342,   343,   603,  2013,
+    1821,   604,   358,   605,   606,   607,   608,   534,   359,   344,
+     610,   611,  2014,   612,   613,   614,   615,   616,   617,   832,
+     691,   692,   535,  1842,   623,   624,   625,   626,   627,   628,
+     629,   630,   631,   632,   633,   634,   635,   636,   637,  1853,
+     638,   713,   639,   166,   722,   714,   276,  1594,   695,   691,
+     692,  2601,   723,   725,   819,   361,   872,   383,   395,  1894,
+     826,   696,    69,   487,   489,   697,   494,  2596,  1882,   198,
+    1889,   199,   873,   874,   870,   880,  2088,   883,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   534,   880,  2089,
+     870,  1618,   224,   676,   677,   678,   679,   680,   681,   682,
+     683,   684,   599,   870,   825,   819,  1548,  1176,  1178,  1596,
+    1597,  1549,   940,   940,  1164,  2412,   860,   653,   861,   654,
+     940,   200,  1215,  1904,   656,   674,  2413,  1661,  1662,  1219,
+     819,  1221,   852,   856,  1905,  1553,   312,  1555,  1906,   855,
+     332,  1159,    60,   619,   819,   375,   620,   819,    61,  2415,
+    1225,  1226,  1227,  1228,   413,   414,   415,   416,   417,   418,
+    2416,  2311,  2312,   643,  2417,   419,   644,   201,  1243,  1585,
+    1245,   420,  2313,  1248,  1249,  1250,  1251,   421,   422,   204,
+     423,   686,   695,   691,   692,   841,  1285,   266,   842,   267,
+     268,   269,   270,  1272,  1273,   772,   691,   692,   843,   697,
+     597,   529,   687,   688,   271,   819,  2501,  1288,   772,   686,
+     272,   273,   295,   274,   743,  2437,  2438,  2502,    50,   169,
+     202,    51,   331,   384,    52,   410,   412,   374,  1322,   743,
+     518,   743,   518,   518,   518,   518,   518,   518,   518,   518,
+    1175,   691,   692,   216,  1341,  1342,  2506,   791,  1683,   217,
+     795,   796,   797,  1332,  1333,  2559,  1335,  2507,  1337,   218,
+     806,   743,   221,   327,   717,   219,  2560,   718,   222,   371,
+     686,   743,   203,  1140,  1141,  1142,  1143,  1144,  1145,  1146,
+    1147,  1567,   864,   865,  1568,   868,   869,   205,  1148,  2567,
+    1231,   893,   894,   895,   897,  1149,  1150,  1151,   310,  1152,
+    2568,   687,   688,   336,   339,   934,   879,   882,   886,   387,
+     403,  2647,   234,   236,   237,   238,   239,   240,   241,   242,
+     243,   207,  2648,  1567,   691,   692,  1699,  1153,   954,   955,
+     956,  1154,   206,  1155,  1164,  1156,   763,  1157,   940,  1163,
+     337,   340,   208,   940,   349,   354,   388,   404,   386,   402,
+     209,   974,   975,   976,   977,   978,   979,   980,   981,   982,
+     983,   984,   985,   986,   987,   988,   210,   989,   990,   991,
+     992,  1724,   691,   692,  1725,   994,   995,   996,   997,  1757,
+     211,   998,  1758,   999,   212,  1000,  1001,  1002,   213,  1836,
+    1004,  1005,  1839,   214,  1769,  1009,  1010,  1706,  1800,  1967,
+     215,  1801,  1706,  1015,  1016,  1017,  1018,  2211,  2212,   220,
+    1021,  1022,  1023,  1024,  2242,  2243,   938,   945,  1029,    70,
+    1030,   743,   334,  1031,  1032,   949,   949,   320,  1033,   447,
+     478,   448,   479,   347,   352,  1040,   322,   324,   774,   776,
+     325,  1041,   256,  1042,   259,  1044,  2341,  1820,  1046,  1822,
+    1047,   490,  1048,   495,  2230,  1049,   499,  1051,  1052,   498,
+     500,  1053,   501,   502,  1055,  1140,  1141,  1142,  1143,  1144,
+    1145,  1146,  1147,   503,  1064,  1065,  1066,   504,   505,   506,
+     507,   508,  1072,  1073,  1074,  1075,  1076,  1077,  1078,  1079,
+    1080,  1081,  1082,  1083,  1084,  1085,  1900,  1087,  1088,  1089,
+     509,  1091,   819,  1545,   819,  1095,  1096,  1097,  1098,  1099,
+     510,  1101,  1102,   511,  1104,  1105,  1106,   512,   513,   514,
+     516,   517,   515,  1107,  1108,   519,   520,   522,   521,  1110,
+    1111,   530,   531,   575,   536,   890,   819,   539,   580,  1945,
+     570,   540,   573,   576,   586,   587,  1127,  1128,   588,   598,
+     601,   585,   533,   600,   609,  1554,   621,  1556,     1,   642,
+     645,     2,   648,   618,   647,   657,   640,  1160,   663,   651,
+     940,   224,   676,   677,   678,   679,   680,   681,   682,   683,
+     684,   641,   255,     3,     4,     5,     6,     7,     8,   646,
+     652,   826,   655,   658,     9,   659,    10,   661,   660,    11,
+      12,   662,  1629,   664,    13,    14,    15,   667,    16,   666,
+     665,   668,   669,   670,   673,   819,  1641,   671,   672,  1646,
+     940,   674,   704,  1649,  1659,   705,   706,   708,   707,   709,
+     892,   712,   710,   711,   715,   762,   719,  1206,  1235,   763,
+    1209,  1210,   791,  1213,  1213,   686,  1216,  1217,   716,   743,
+     759,   743,   767,  1223,   770,    -6,    -6,   771,   777,  1229,
+     779,   784,   785,   786,  2010,   787,   799,  1237,   801,   800,
+     802,   803,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   814,   804,   816,   826,   836,  2058,   837,   838,  1262,
+    1264,   839,   866,  2441,   840,   870,   901,   902,   903,   904,
+     905,   906,   907,  1278,   908,   911,   912,   914,  1284,   686,
+     224,   676,   677,   678,   679,   680,   681,   682,   683,   684,
+     915,   897,   897,   897,  1109,   913,   741,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   378,   918,   921,
+     920,   922,  1316,   924,  1213,  1340,  1320,   923,   743,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,  2103,
+     926,   927,   925,   928,   929,   930,   931,   686,   686,  1369,
+     940,  1338,   932,   933,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,   233,   951,   952,   953,  2441,   788,   792,
+     793,  1339,   957,  1160,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,   233,  1400,   958,  1402,  1403,  1404,  1405,
+     823,   959,   960,   961,   819,  1973,   819,   962,   224,   225,
+     226,   227,   228,   229,   230,   231,   232,   233,   963,  1424,
+     890,   964,   965,   966,   970,   968,   898,  1425,   967,  1426,
+    1427,   969,   971,   972,  1428,  1429,  1430,   973,  1431,  1432,
+    1013,   993,  1006,  1433,  1434,  1003,  1011,  1007,  1012,  1014,
+    1019,  1436,  1020,  1025,  1026,  1027,  1440,  1028,  1034,  1823,
+    1035,  1444,  1038,  1446,  1444,  1447,  1036,  1037,  1039,  1043,
+    1045,  1050,  1054,   235,   235,  1056,  1454,   518,  1058,  1456,
+    1454,  1457,  1237,  2049,  1057,  1059,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,  1060,  1466,  1061,  1467,
+    1062,  1468,  1063,  1067,  1070,  1470,  1471,  2050,   940,  1071,
+     224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
+    1086,  1090,  1092,  1482,  1483,  1484,  1485,  1486,  1487,  1488,
+    1489,  1490,  1491,  1492,  1493,  1093,  1495,  1094,  1497,  1100,
+    1499,  1103,  1501,  1112,  1113,  1114,  1505,  1506,  1507,  1508,
+    1509,  1115,  1511,  1512,  1116,  1514,  1515,  1516,  1117,  1118,
+    1119,  1519,  1520,  1120,  1517,  1518,   887,   888,   224,   676,
+     677,   678,   679,   680,   681,   682,   683,   684,  1536,  1370,
+    1371,  1372,  1373,  1374,  1375,  1376,  1377,  1378,  1379,  1380,
+    1381,  1382,  1383,  1384,  1385,  1386,  1387,  1388,  1389,  1390,
+    1391,  1883,  1884,   224,   225,   226,   227,   228,   229,   230,
+     231,   232,   233,  1121,  1123,  1160,   686,  1122,  1124,  1125,
+    1126,   819,   224,   676,   677,   678,   679,   680,   681,   682,
+     683,   684,  1129,  1130,  1131,  1132,  1133,  1136,  1134,  1135,
+    1137,  1167,  1138,  1171,  1170,  1169,  1172,  1278,  1173,  1180,
+    1182,  1183,  1184,  1186,  1187,  1188,  1181,  1189,  1190,  1587,
+    1185,  1191,  1194,  1192,  1193,  1233,  1195,  1220,  1238,  1246,
+    1234,  1230,  1239,  1574,  1575,  1577,  1284,  1579,  1240,  1237,
+    1582,  1264,  1247,  1253,  1252,  1265,  1254,  1589,  1266,  1255,
+    1268,  1267,  1269,   518,   518,   235,  1270,  1274,  1276,  1282,
+    1287,  1290,  1612,  1289,  1292,  1294,  1302,  1291,  1299,  1293,
+    1300,  1323,   718,  1295,  1278,   686,   819,  1284,  1264,  1301,
+    1317,  1325,  1347,  1321,  1324,  1331,  1334,  1344,  1343,   686,
+    1643,  1345,   686,   743,  1653,  1655,  1348,   686,   893,   897,
+     897,  1612,  1346,  1349,  1577,  1612,  1350,  1352,  1354,  1351,
+    1357,  1355,  1264,  1264,  1264,  1264,  1264,  1353,  1356,  1360,
+    1362,  1361,  1363,  1396,  1364,  1709,  1284,  1284,   823,  1366,
+    1207,  1208,  1367,  1365,  1714,  1715,  1716,  1717,  1368,  1401,
+    1218,  1397,  1398,  1399,  1222,  1406,  1407,  1408,  1410,  1411,
+    1409,   255,  1412,  1732,  1733,   255,   255,  1413,  1414,  1734,
+    1735,  1736,  1415,  1419,  1242,  1738,  1242,  1416,  1417,  1421,
+    1418,  1420,  1423,  1435,  1437,  1441,  1444,  1444,  1257,  1438,
+    1257,  1442,  1422,  1448,  1451,  1453,   255,  1752,  1752,  1443,
+    1449,  1107,  1108,  1452,  1589,  1450,  1458,  1459,  1460,  1461,
+    1462,  1463,  1464,  1469,  1465,  1472,  1474,  1473,  1763,  1764,
+    1475,  1766,  1476,   898,   898,   898,  1477,  1478,  1479,  1480,
+    1481,  1500,  1774,  1496,  1502,  1503,  1504,  1510,  1513,  1521,
+    1522,  1523,  1524,  1315,  1525,  1528,  1527,  1319,  1526,  1777,
+    1531,  1529,  1530,  1533,  1538,  1535,  1779,  1534,  1532,  1543,
+    1539,  1540,  1542,  1783,  1784,  1785,  1786,  1787,  1537,  1552,
+    1544,   255,  1541,  1550,  1558,  1790,  1791,  1559,  1560,  1564,
+    1561,  1563,  1562,  1566,  1565,  1569,  1358,  1570,  1571,  1584,
+     890,  1586,  1808,   794,   235,   235,   518,   798,  1548,  1591,
+    1590,  1598,  1549,  1602,  1621,  1600,   809,  1603,  1599,  1619,
+    1622,  1623,  1626,   824,  1630,  1601,  1625,  1633,  1620,  1638,
+    1665,  1634,  1636,  1624,  1635,  1637,  1653,  1639,  1670,  1678,
+    1844,  1640,  1278,  1671,  1672,  1681,  1688,  1687,  1689,  1690,
+    1856,  1693,  1695,  1856,  1696,  1697,  1700,  1703,  1704,  1705,
+    1707,  1710,  1706,  1589,  1691,  1278,  1708,   919,  1711,  1692,
+    1712,  1713,  1694,  1721,  1698,  1701,  1612,  1718,  1719,  1720,
+    1726,  1612,  1722,  1723,  1728,  1887,  1730,  1727,  1729,  1731,
+    1742,  1653,  1747,  1870,  1745,  1737,  1739,  1741,  1748,  1744,
+    1754,  1643,  1746,  1756,  1653,  1612,  1755,  1612,  1759,  1760,
+    1643,  1284,  1262,   893,  1761,  1762,  1765,  1213,  1870,  1767,
+    1768,   892,  1773,  1931,  1770,  1771,  1788,  1772,  1775,  1776,
+    1782,  1792,  1781,  1802,  1789,  1921,  1454,  1793,  1795,  1454,
+    1796,  1803,  1797,  1799,  1804,  1805,  1794,  1807,  1816,  1798,
+    1806,  1809,  1810,  1813,  1817,  1825,  1814,   892,  1827,  1811,
+     892,  1812,  1830,  1818,   892,  1819,  1826,  1824,  1832,  1835,
+    1833,  1828,  1899,  1863,  1841,  1920,  1831,  1829,  1851,  1834,
+    1875,  1970,  1860,   518,   518,  1843,  1845,  1879,  1846,  1971,
+    1972,  1848,  1850,  1976,  1977,  1849,  1852,  1859,  1864,  1861,
+    1862,  1980,  1865,  1871,  1866,  1872,  1873,  1874,  1876,  1877,
+    1880,  1903,  1891,  1892,  1902,  1898,  1908,  1909,  1912,  1916,
+    1914,  2000,  1907,  1915,  1918,  1917,  1913,  1919,  1922,  1923,
+    1924,  1925,  1927,  1926,  1928,  1930,  1932,  1934,  1938,  1937,
+    1929,  1935,  1939,  1933,  1940,  2026,  1936,  1943,  1942,  1944,
+    1946,  1947,  1957,  1948,  1949,  1959,  1951,  2048,  1895,  1950,
+    1968,  1953,  1669,  1969,  1952,  1982,  1975,  1954,  1956,  1955,
+    1962,   235,   235,  1958,  1961,  1987,  1960,  1964,  1991,  2051,
+    1963,  1965,  1981,  1966,  1983,  1984,  1974,  1978,  1979,  1985,
+     255,   255,  1986,  1988,  1573,  1992,  1989,  1655,  1990,  1994,
+    1580,   255,  1995,  1643,  1870,   255,  1993,  1213,  1996,  1997,
+    1998,  1999,  2001,  1592,  2002,  1242,  1242,  2006,  2003,  2005,
+    2004,  2007,  2008,  1604,  2015,   255,  2009,  2078,  2020,  2011,
+    2016,  2021,  2017,  2018,  2024,  2019,  2022,  2023,  2028,  2025,
+     255,  2030,  2027,  2040,  2029,  1139,  2031,  2032,  2033,  2034,
+    2035,  2036,  2043,  1645,  2037,  2126,  2127,  2038,  1658,  2057,
+    2039,   898,   898,  2041,  1664,  2042,  2044,  2045,  1668,  2056,
+    2046,  2047,  2052,  2053,  2060,  2059,  2061,  2062,  2063,  2065,
+    2064,  2066,  2068,  2069,  2067,  1196,  2071,  1202,  1203,  1204,
+    2072,  2073,  2074,  2075,  2076,  2077,  2070,  2080,   255,  2081,
+    2090,  2079,   255,  2169,  2083,  2082,  2084,  2092,  1224,  2086,
+    2091,  2087,  2099,  2095,  2097,   892,  2100,  2101,  2085,  2096,
+     892,  2098,  2102,  2104,  2108,  2109,  2105,  2106,  2111,  2107,
+    2110,  2112,  2113,  2116,  2114,  2115,  2119,  2117,  2118,  2122,
+    2123,   255,  2124,  2128,   892,   235,   892,  2136,  2125,  2130,
+    2129,  1271,   892,  2133,  2134,  2132,  2135,  2131,  2137,  1280,
+    1281,  2138,  2139,  2140,  1286,  2142,  2147,  2144,  2141,  2143,
+    2148,  2149,  2146,  2150,  2152,  2154,  1751,  1751,  2153,  2155,
+    2156,  2145,  2160,  1303,  1304,  1305,  1306,  1307,  1308,  1309,
+    1310,  1311,  1312,  1313,  1314,  2157,  1278,  2161,  2162,  2164,
+    2166,  2175,  2165,  2167,  2168,  2151,  1326,  1327,  1328,  1329,
+    1330,  2170,  2171,  2172,  2173,  2163,  2174,  2176,  2177,  2178,
+    2179,  2180,  2181,  2183,  2184,  2182,  2185,  2186,  2187,  2188,
+    2286,  2189,  2194,  2192,  2190,  2199,  2191,  2193,  2200,  1359,
+    2202,  2197,  2195,  2203,  2208,  2196,  2204,  2207,  2198,   235,
+     235,  2201,  2210,   518,  2214,  2213,  2209,  2215,  2216,  2219,
+    2221,  2220,  2222,  2224,  2223,  2225,  2228,  2226,  2234,  2206,
+    2229,  2231,  2227,  2233,  2235,  2253,  2237,  2238,  2240,  2241,
+    2236,  2244,  2239,  2246,  2245,  2254,  2257,  2262,  2247,  2259,
+    2248,  2263,  2252,  2260,  2264,  2258,  2261,  2265,  2266,  2268,
+    2267,  1257,  1837,  1838,  1257,  2272,  2277,  2276,  2271,  2273,
+    2282,  2278,  2288,   893,  2283,  2290,  2279,  2280,  2291,  1855,
+    2281,  2292,  1855,  2293,  2284,  2285,  2294,  2297,  2295,  2287,
+    2289,  2296,  2298,  2299,  2300,  2305,  2301,   518,   518,   235,
+    2274,  2389,  2275,  2304,  2308,  2302,  2303,  2306,  2309,  2307,
+    2314,  2310,  2315,  2317,  2319,  2321,   255,  2316,  2320,  2318,
+    2322,  2323,  2324,   255,  2326,  2327,  2325,  2328,  2333,  2329,
+    2330,  2334,  2338,  2339,  2340,   255,  2342,  2344,  2335,  2343,
+    2345,  2336,  2347,  2349,  2350,  2352,  2355,   255,  2346,  2357,
+    2351,  2331,  2332,  2356,  2353,  2358,  2360,   255,  2359,  2365,
+    2361,  2362,  2364,  2363,  2366,  2368,  2367,  2370,  2373,  2382,
+    2393,  2369,  2371,   823,  2372,   235,   235,   518,  2375,  2378,
+    2381,  2391,  2379,  2376,  2374,  2377,  2380,  2385,   255,  2384,
+    2383,  2386,  2387,  2392,  2390,  2388,  2394,  2395,  2396,  2483,
+    2397,   255,  2398,  2399,  2400,  2403,  2401,   255,  2402,  2404,
+    2405,   255,  2407,  2406,  2408,  2411,  2414,  2409,  2410,  2418,
+    2420,  2419,  2421,  2422,  2424,  2423,  2427,  2425,  2426,  2429,
+    2428,  2432,  2430,  2433,  2446,  2449,  2434,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,  2445,
+    2447,   946,   518,   518,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   255,  1572,  2431,  2435,  2436,  2448,
+    2450,  2451,  2452,  2453,  2454,  2455,  2456,  2457,  2458,  2459,
+    2460,  2461,  2462,  2463,  2464,  2466,  2465,  2467,  2468,  2496,
+    2469,  2470,  2471,  2472,  2475,  2482,  2473,  2484,  2476,  2477,
+    2479,  2480,  2474,  2478,  2486,  2485,  2487,  1627,  2481,  2489,
+    2490,  2493,  2494,  2488,  2491,  2492,  2495,  2498,  2500,  2504,
+    2497,  2505,  2511,  2499,  2503,  2509,  2516,  2508,  2513,  2517,
+    2519,  2512,  2520,  2510,  2527,  2524,  2679,  2528,  2525,  2529,
+    2514,  2518,  2515,  2521,  2523,  2531,  2534,  2549,  2526,  2530,
+     255,   255,  2532,  2533,  2550,  2535,  2536,  2537,  2545,  2538,
+    2540,  2541,  2544,  2542,  2547,  2552,  2565,  2558,   255,  2554,
+    2548,  2553,  2555,  2556,  2557,  2551,  2561,  1702,  2562,  2563,
+    2570,  2564,   892,    74,   244,    76,    77,    78,    79,    80,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   687,   688,   935,   104,   936,   106,   107,   108,
      109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
      119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
      129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
      139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
      149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,   161,    69,   235,    71,    72,    73,    74,    75,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,  2552,  1830,    98,    99,   100,   101,   102,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     159,   160,   161,   162,   163,   164,   165,   166,    74,   244,
+      76,    77,    78,    79,    80,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,  1161,  2539,  1162,
+     104,   936,   106,   107,   108,   109,   110,   111,   112,   113,
      114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
      124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
      134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
      144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   161,    69,    70,
-      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
-      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,  2553,  2554,    98,
-      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,   161,    69,   235,    71,    72,    73,    74,    75,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,  2555,  2556,   918,    99,   919,   101,   102,   103,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,  2543,  2546,    74,   244,    76,    77,    78,
+      79,    80,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,  1867,  1166,  1162,   104,   936,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+      74,   244,    76,    77,    78,    79,    80,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,  1854,
+    2566,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,    74,   244,    76,    77,    78,
+      79,    80,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,  2569,  1857,   103,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,  2571,
+    2572,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,    74,   244,    76,    77,    78,
+      79,    80,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,  2573,  2574,   935,   104,   936,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+      74,   244,    76,    77,    78,    79,    80,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,  2575,
+    2576,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,    74,   244,    76,    77,    78,
+      79,    80,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,  2577,  2578,  1394,   104,   936,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+      74,   244,    76,    77,    78,    79,    80,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,  2579,
+    2580,  1162,   104,   936,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,    74,   244,    76,    77,    78,
+      79,    80,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,  2581,  2582,  2583,   104,   936,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+      74,   244,    76,    77,    78,  1605,  1606,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,  1607,
+    1608,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,    74,   244,    76,    77,    78,  1605,
+    1606,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,  1607,  1608,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,  1888,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,    74,   244,
+      76,    77,    78,    79,    80,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,  2584,  2585,   103,
      104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
      114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
      124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
      134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
      144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   161,    69,   235,
-      71,    72,    73,    74,    75,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,  2557,  2558,    98,
-      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,   161,    69,   235,    71,    72,    73,    74,    75,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,  2559,  2560,  1371,    99,   919,   101,   102,   103,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,    74,   244,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,  2586,  2587,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,   164,   165,    74,   244,  1445,    77,
+      78,    79,    80,   245,   246,   247,   248,   249,   250,   251,
+     252,   253,   254,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,  2588,  2589,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+      74,   244,  1455,    77,    78,    79,    80,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,  2590,
+    2593,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,    74,   244,  1494,    77,    78,    79,
+      80,   245,   246,   247,   248,   249,   250,   251,   252,   253,
+     254,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,  2591,  2592,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,    74,   244,
+    1498,    77,    78,    79,    80,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,  2594,  2596,   103,
      104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
      114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
      124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
      134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
      144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   161,    69,   235,
-      71,    72,    73,    74,    75,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,  2561,  2562,  1142,
-      99,   919,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,   161,    69,   235,    71,    72,    73,    74,    75,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,  2563,  2564,  2565,    99,   919,   101,   102,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,    74,   244,  1743,    77,    78,    79,    80,   245,
+     246,   247,   248,   249,   250,   251,   252,   253,   254,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,  2595,  2597,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,   164,   165,    74,   244,  1749,    77,
+      78,    79,    80,   245,   246,   247,   248,   249,   250,   251,
+     252,   253,   254,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,  2598,  2599,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+      74,   244,  1778,    77,    78,    79,    80,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,  2600,
+    2602,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,    74,   244,  1780,    77,    78,    79,
+      80,   245,   246,   247,   248,   249,   250,   251,   252,   253,
+     254,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,  2603,  2604,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,    74,   244,
+      76,    77,    78,    79,    80,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,  2605,  2606,  2601,
+     104,   936,   106,   107,   108,   109,   110,   111,   112,   113,
      114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
      124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
      134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
      144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   161,    69,   235,
-      71,    72,    73,  1580,  1581,    76,    77,    78,    79,    80,
-      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,  1582,  1583,    98,
-      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,    69,   235,    71,    72,    73,  1580,  1581,    76,
-      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
-      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
-      97,  1582,  1583,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,  1861,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,    69,   235,    71,    72,
-      73,    74,    75,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,    86,    87,    88,    89,    90,    91,    92,
-      93,    94,    95,    96,    97,  2566,  2567,    98,    99,   100,
-     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
-     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
-      69,   235,    71,    72,    73,    74,    75,    76,    77,    78,
-      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
-      89,    90,    91,    92,    93,    94,    95,    96,    97,  2568,
-    2570,    98,    99,   100,   101,   102,   103,   104,   105,   106,
-     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
-     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
-     157,   158,   159,   160,    69,   235,  1421,    72,    73,    74,
-      75,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,  2571,  2572,    98,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
-     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
-     153,   154,   155,   156,   157,   158,   159,   160,    69,   235,
-    1431,    72,    73,    74,    75,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,  2573,  2574,    98,
-      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,    69,   235,  1470,    72,    73,    74,    75,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,    86,
-      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
-      97,  2569,  2575,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,    69,   235,  1474,    72,
-      73,    74,    75,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,    86,    87,    88,    89,    90,    91,    92,
-      93,    94,    95,    96,    97,  2576,  2577,    98,    99,   100,
-     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
-     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
-      69,   235,  1717,    72,    73,    74,    75,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,    86,    87,    88,
-      89,    90,    91,    92,    93,    94,    95,    96,    97,  2578,
-    2579,    98,    99,   100,   101,   102,   103,   104,   105,   106,
-     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
-     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
-     157,   158,   159,   160,    69,   235,  1723,    72,    73,    74,
-      75,   236,   237,   238,   239,   240,   241,   242,   243,   244,
-     245,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,  2580,  2581,    98,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
-     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
-     153,   154,   155,   156,   157,   158,   159,   160,    69,   235,
-    1752,    72,    73,    74,    75,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,    97,  2582,  2583,    98,
-      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,    69,   235,  1754,    72,    73,    74,    75,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,    86,
-      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
-      97,  2584,  2585,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,    69,   235,    71,    72,
-      73,    74,    75,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,    86,    87,    88,    89,    90,    91,    92,
-      93,    94,    95,    96,    97,  2586,  2587,  2588,    99,   919,
-     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
-     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
-    2589,  2590,  2591,  2592,  2593,  2594,  2595,  2596,  2597,  2599,
-    2598,  2600,  2602,  2601,  2603,  2605,  2608,  2604,  2611,  2607,
-    2619,  2621,  2612,  2606,  2609,  2610,  2620,  2623,  2618,  2624,
-    2636,  2626,  2613,  2614,  2617,  2627,  2625,  2630,  2628,  2622,
-    2629,  2641,  2643,  2644,  2631,  2648,  2633,  2632,  1189,  2637,
-    2634,  2635,  2647,  2651,  2638,  1641,  2639,  2640,  2661,  2642,
-    2645,  2646,  2649,  2654,  2650,  2652,  1831,  2655,  2653,  1820,
-    2660,  1159,  2656,  1522,  2658,  2657,  2659,   933,  1727,  1533,
-    1863,   353,   447,   354,   355,   448,   449,   450,   799,   841,
-     868,   356,   451,     0,   452,     0,   453,   454,   214,   455,
-     456,   457,   458,     0,   459,   460,   461,   462,   463,   464,
-     465,   471,   472,   473,   474,   475,   372,   388,   357,   358,
-     476,   359,   360,   389,   361,   363,   391,   364,     0,   397,
-     367,   398
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,  2607,  2608,  2609,  2610,  2611,  2612,  2613,  2615,
+    2614,  2617,  2616,  2618,  2619,  2620,  2621,  2622,  2623,  2624,
+    2625,  2626,  2627,  2628,  2629,  2631,  2630,  2632,  2634,  2633,
+    2636,  2637,  2668,  2635,  2643,  2522,  2639,  2651,  1897,  2653,
+    2638,  2642,  2644,  2655,  2656,  2640,  2641,  2652,  2650,  2658,
+    2645,  2646,  2659,  2649,  2657,  2661,  2654,  2660,  2662,  1211,
+    2673,  2675,  2676,  1666,  2663,  2665,  2666,  2680,  2664,  2667,
+    2669,  2683,  2671,  2670,  2681,  2677,  2672,  2674,  2678,  2682,
+    2686,  2693,  1858,  2684,  2685,  2687,  1847,  2688,  2692,  1179,
+    1546,  2690,  2689,  2691,   950,  1753,  1557,  1890,   362,   363,
+     364,   456,   457,   458,   459,   815,   857,   884,   460,   461,
+     462,   463,   464,   465,   466,   467,   468,   469,   223,   470,
+     471,   472,   473,   474,   381,   480,   481,   482,   483,   484,
+     365,   397,   366,   367,   398,   368,   485,   400,   497,   369,
+     370,   372,     0,     0,     0,     0,     0,     0,   373,     0,
+       0,   376,   406,   407
 };
 
 static const yytype_int16 yycheck[] =
 {
-      19,   960,    21,    22,    23,    24,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,   621,   559,   920,   561,  1377,  1467,
-    1012,    19,   937,   182,   922,   921,  1213,  1405,   170,   177,
-     178,   186,   928,   968,   998,   186,   514,   539,  1765,   181,
-     182,   177,   178,   597,  1470,   186,  1138,   591,  1474,  1045,
-    1046,  1047,  1562,     6,  1684,  1748,   556,   601,    49,    28,
-      29,   551,   552,    49,  1757,  1410,    49,    30,  1446,    49,
-      39,   986,   544,   551,   552,    77,    78,    79,    80,    81,
-      82,    83,    84,    85,  1443,    49,   564,   565,  1421,   561,
-     568,   569,   570,   571,    29,   558,  1011,    26,   600,  1432,
-    1433,    92,  1447,   593,   594,    49,    92,    49,  1738,    92,
-    1025,    30,    92,  1028,    43,   593,   594,  1495,  1496,   591,
-      49,  1751,    30,    52,    39,   603,   604,    30,    92,   601,
-      45,    27,    51,  1068,   597,    29,  1481,  1482,  1483,  1484,
-    1485,   641,    50,    39,    97,    98,    99,    50,    92,    29,
-      92,    29,    46,    49,  1487,  1488,    52,  1490,    30,  1492,
-      42,   672,   673,    45,    26,    30,    48,    39,    46,    49,
-     600,  1086,   602,   529,   530,   531,   532,   533,   534,   535,
-     536,   537,   538,    45,   540,   541,   542,   543,   618,   545,
-     546,   547,   548,    29,   550,   625,   626,   553,   554,   555,
-    1710,    44,    51,    52,   748,    48,    42,    28,    29,    10,
-      11,    12,    13,    14,    15,    16,    17,    18,    19,    28,
-      29,  1408,  1949,   252,   253,   254,   255,   256,    29,    50,
-      32,    33,   177,   178,    43,    51,   181,   182,   267,  1143,
-      49,  1139,    27,    44,    39,   274,    48,   276,   277,   278,
-     279,   280,  1148,   282,   283,  1948,   285,   286,   287,    54,
-     289,    46,   291,   292,   293,   294,   295,    30,   297,   298,
-     299,   300,   301,   302,   303,   304,   305,   306,  1370,    29,
-      44,   310,    28,    29,   313,    48,   315,    30,    30,   318,
-      31,    32,    33,   322,   323,   324,    46,  1723,   327,   328,
-      46,   330,   331,    44,    50,    48,    38,    48,   337,   338,
-     339,   340,  1760,   342,   343,   344,   345,    26,    50,    28,
-      29,    30,    31,   352,    39,    39,  1752,    43,  1754,    29,
-     359,  1690,    48,   362,    43,   364,   365,   366,   367,    54,
-      49,    55,   371,   372,    44,   374,   375,   376,   377,   378,
-     379,    28,    27,  1712,    31,    30,   385,   386,   387,   388,
-     389,   390,   391,   392,   393,   394,   395,   396,   397,   398,
-     399,    28,   401,   528,   403,    26,    31,   528,    39,    30,
-    1758,   611,    39,   937,  1717,     0,    43,   528,   618,    44,
-      51,    42,    43,    44,    10,    11,    12,    13,    14,    15,
-      16,    17,    18,    19,    32,    33,   175,   176,    39,   920,
-     921,   922,   181,   182,    45,    44,    44,   928,    77,    78,
-      79,    80,    81,    82,    83,    84,    85,    43,  1761,   973,
-      28,   975,   986,    28,    29,    29,    31,    31,    26,   174,
-      31,    39,    30,    31,   179,    43,    98,    99,    43,   478,
-      44,   480,   611,    44,    49,    43,   485,  1011,  1422,  1423,
-     938,   939,    39,   611,  1379,    42,  1381,   969,  1372,   611,
-      28,  1025,  1468,  1469,  1028,   611,   599,    31,    32,    33,
-      28,    39,    26,    27,    28,    29,    30,    31,   611,    44,
-      44,    39,    26,    37,    48,    50,    30,  1412,    97,    43,
-     164,   979,   980,   981,   982,    49,    50,    26,    52,    43,
-      29,    29,    26,   511,    28,    29,    30,    31,    46,   997,
-      39,   999,    32,    33,  1002,  1003,  1004,  1005,  1072,    43,
-      30,  1033,  1086,   170,    44,    49,    50,   174,    52,    46,
-      49,   539,   179,    52,  1022,  1023,   544,    10,    11,    12,
-      13,    14,    15,    16,    17,    18,    19,    49,  1036,    46,
-      52,   559,    49,   561,    32,    33,   225,    30,   227,   228,
-     229,   230,   231,   232,   233,   234,  1491,    45,    46,   577,
-      28,    43,   580,   581,   582,    51,    52,    49,    43,  1091,
-    1092,    39,   590,   591,    49,    28,    26,   170,    28,    29,
-      30,    31,   600,   601,  1082,  1083,    39,  1085,   181,  1087,
-     183,   184,    30,    43,   612,   613,    39,   615,   616,    49,
-      32,    33,    52,   621,   622,   623,   624,   170,  1139,   985,
-      28,   660,  1143,    49,   173,    44,   179,  1148,   181,   182,
-     179,    39,    28,    48,   187,   188,   170,   190,    31,    32,
-      33,   175,   176,    39,   683,   684,   685,   181,   182,   661,
-     662,   663,   664,   665,   666,   667,   668,   669,    46,    46,
-      46,    49,    49,    49,  1570,    32,    33,   706,   707,   708,
-     709,   710,   711,   712,   713,   714,   715,   716,   717,   718,
-     719,    50,   721,   722,   723,   724,    28,    31,    32,    33,
-     729,   730,   731,   732,    28,    29,   735,    39,   737,    49,
-     739,   740,   741,    49,  1706,   744,   745,  1709,    26,    46,
-     749,   750,    49,   618,   619,   620,    28,    29,   757,   758,
-     759,   760,   672,   673,    46,   764,   765,   766,   767,   676,
-     677,   185,   186,   772,    39,   774,   185,   186,   777,   778,
-     748,   177,   178,   782,   171,   172,   564,   565,    52,    27,
-     789,    98,    43,    43,    29,    49,   795,    28,   797,    39,
-     799,    30,    26,   802,  1689,   804,  1691,   806,    19,  2138,
-     809,    55,   811,   812,    26,    29,   815,    50,    50,   818,
-      10,    11,    12,    13,    14,    15,    16,    17,    43,   828,
-     829,   830,    30,    50,    29,    45,  2254,   836,   837,   838,
-     839,   840,   841,   842,   843,   844,   845,   846,   847,   848,
-     849,    30,   851,   852,   853,  1379,   855,  1381,    50,  1764,
-     859,   860,   861,   862,   863,    30,   865,   866,    29,   868,
-     869,   870,    49,    26,  1346,    51,    38,    27,  1817,    39,
-      38,    30,    27,    39,   883,   884,    45,    27,  1412,    27,
-    1467,  1372,    39,    45,    45,    39,    51,    31,    31,   871,
-     872,   900,   901,    10,    11,    12,    13,    14,    15,    16,
-      17,    18,    19,    54,     1,    39,    39,     4,    30,    26,
-      51,   920,    10,    11,    12,    13,    14,    15,    16,    17,
-      18,    19,  1380,    44,  1382,    44,    39,    51,    51,    26,
-    1421,    28,    29,    30,    31,    38,    31,    42,  1462,    54,
-      37,    45,    39,    39,    45,    42,    43,    26,    48,    48,
-      47,    48,    49,    44,    51,    44,    50,  1491,    48,    52,
-       7,    28,  1444,    10,    11,    12,    13,    14,    15,    16,
-      17,    18,    19,    50,    46,    27,  1458,    26,    92,  1461,
-     989,    29,   621,   961,  1466,    44,   964,   965,   966,   967,
-     968,   969,   970,   971,    29,   973,    26,   975,    43,   977,
-      26,    98,    99,    31,    92,   983,    37,    92,    42,  1904,
-      29,    48,    50,   991,    39,    39,    29,    44,    29,    92,
-      49,    29,   661,   662,   663,   664,   665,   666,   667,   668,
-     669,    92,    29,    31,    92,  1013,  1014,  1952,    29,    29,
-      44,    92,    31,    29,  2357,    39,    49,    43,    30,  1027,
-      29,    38,    29,    31,  1032,  1033,    30,    52,    10,    11,
-      12,    13,    14,    15,    16,    17,    29,  1045,  1046,  1047,
-      31,    44,    26,    25,    92,    31,    52,    92,    45,  1570,
-      32,    33,    34,    48,    36,    44,    50,    49,  1066,    39,
-    1068,    29,  1070,    39,  1072,    43,    30,    50,    45,    50,
-      30,    44,  1997,    48,    39,    49,    39,    29,  1090,    45,
-    1119,    39,    64,  1091,  1092,    42,    68,    30,    70,    39,
-      72,    39,    74,    44,    39,    30,    30,    39,   772,    39,
-      49,    29,   776,   777,  1143,    52,    30,    26,  2451,    50,
-      28,    44,    51,    42,    44,  1154,    39,  1156,  1157,  1158,
-    1159,    27,    39,    45,    50,  1689,    39,  1691,    39,    45,
-      39,    30,    39,   807,    39,    49,    30,    49,    39,  1178,
-      29,    39,    44,  1760,    31,    45,  1185,    50,  1187,  1188,
-      45,    39,    30,  1192,  1193,  1194,    39,  1196,  1197,    51,
-      42,    45,  1201,  1202,    44,    51,    45,    26,    45,    26,
-    1209,    39,    30,    39,    30,  1214,    51,    39,    31,    44,
-    1219,    30,  1221,  1222,  1223,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,  1234,  1717,    39,  1237,  1238,
-    1239,    39,   871,   872,  1692,  1213,   875,    27,   882,    49,
-      39,    28,    30,    29,    26,    28,  1255,    39,  1257,    50,
-    1259,    55,    28,     7,  1263,  1264,    10,    11,    12,    13,
-      14,    15,    16,    17,    18,    19,    39,    44,    92,    44,
-      92,    29,  1281,  1282,  1283,  1284,  1285,  1286,  1287,  1288,
-    1289,  1290,  1291,  1292,    32,  1294,    35,  1296,    33,  1298,
-      26,  1300,    44,    28,    45,  1304,  1305,  1306,  1307,  1308,
-      42,  1310,  1311,    44,  1313,  1314,  1315,    44,    28,     7,
-    1319,  1320,    10,    11,    12,    13,    14,    15,    16,    17,
-      18,    19,    44,    30,    92,    92,    30,  1336,    42,    26,
-      30,    43,    31,     7,  1316,  1317,    10,    11,    12,    13,
-      14,    15,    16,    17,    18,    19,    42,    49,    92,    44,
-      44,    44,    92,    92,    44,   576,   577,   578,    45,    28,
-      30,    92,    45,  1372,    28,    30,    92,    92,  1346,    29,
-    1904,    49,    48,    31,    45,     7,    48,   598,    10,    11,
-      12,    13,    14,    15,    16,    17,    18,    19,    28,    92,
-      42,    50,    28,    50,    29,    29,    50,    42,    42,  1377,
-      42,    29,    43,   624,     7,    52,  1415,    10,    11,    12,
-      13,    14,    15,    16,    17,    18,    19,    29,    49,    42,
-      45,    30,    44,    44,  1402,  1403,  1404,  1405,  1406,    28,
-    1408,  1409,  1410,    28,    30,    26,    92,    30,  1416,    92,
-      26,    42,    30,    48,    29,    27,    48,    30,    48,  1088,
-    1089,  1090,    49,  1431,    30,    39,    34,    51,    39,    92,
-      50,    26,    39,  1997,    30,  1443,  1444,    30,  1446,  1447,
-      49,    44,    92,    30,    43,    50,    92,    39,    49,    30,
-    1458,  1459,    30,  1461,  1462,  1463,  1464,    45,  1466,  1467,
-    1468,  1469,  1470,    39,    55,  1473,  1474,    50,    39,    49,
-      92,    39,    49,  1481,  1482,  1483,  1484,  1485,    50,    44,
-      39,    50,  1521,    44,    39,    30,    39,  1495,  1496,    51,
-      92,  1530,  1531,  1532,  1533,     8,     9,    10,    11,    12,
-      13,    14,    15,    16,    17,    18,    19,    92,    92,  1548,
-    1549,  1185,  1186,    50,    30,  1554,  1555,  1556,    28,    92,
-      50,  1560,  1196,    45,    39,    30,  1200,    39,    39,    30,
-      51,    45,  1571,  1572,    30,    39,    30,    39,    28,    30,
-      92,    48,    30,  1582,  1583,    30,  1220,    50,    30,    49,
-      42,    44,    39,    42,  1562,    39,    92,    43,    92,    30,
-      39,  1235,    42,    31,  1603,  1604,    92,  1606,  1580,  1581,
-      51,    44,    50,    48,    27,    42,    45,    42,  1617,     8,
-       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-      19,    50,    29,    92,    44,  1634,    31,    49,    44,    50,
-      48,    48,  1641,    43,    29,    44,    50,    48,    44,  1648,
-    1649,  1650,  1651,  1652,    45,    92,    50,    44,    92,  1293,
-      29,  1660,  1661,  1297,    45,    44,    31,    43,    92,    28,
-      48,    45,    30,    44,    92,    92,    48,  2254,  1677,    45,
-      30,    45,    42,    92,    45,    48,    42,  1316,  1317,  1318,
-      92,    29,    44,    50,    92,    42,    31,    28,    43,    92,
-      92,    27,  1336,    49,   579,    48,    92,    31,   583,    92,
-      92,    39,    92,    45,    30,  1714,  1684,   592,    30,    49,
-      42,    48,  1690,    31,   599,  1724,    51,    50,  1727,    49,
-      39,    49,    45,    30,    28,    49,    51,    39,    49,    49,
-       6,    48,  1710,    48,  1712,    51,    46,    51,    39,   960,
-      31,   962,   963,    39,    30,  1723,    51,    50,    28,    51,
-    1728,   972,    39,    26,    39,   976,    30,    45,   643,    28,
-    1738,    92,  1740,    92,    39,    46,    31,    51,    26,    48,
-    1748,  1753,    43,  1751,  1752,   996,  1754,   998,    39,  1757,
-    1758,  1759,  1760,    92,    92,    39,  1764,  1765,  1797,  1010,
-      31,  1012,  1431,    28,    45,    45,    29,    50,    30,    30,
-    1809,    30,    51,  1812,  1782,    44,    29,    28,    50,    39,
-      92,    30,    30,    51,    51,    39,    44,    30,    43,    55,
-      30,    28,    48,    50,  1045,  1046,  1047,    49,  1467,    30,
-      50,  1470,    31,    50,    50,  1474,    51,    51,    50,    44,
-      51,    50,    44,    51,  1065,  1854,    50,    44,  1069,    43,
-      50,    44,    44,    51,  1493,  1494,    45,  1866,  1867,    45,
-      44,    44,    26,    45,    45,  1874,    46,    39,    39,    44,
-      44,    50,    39,    51,  1856,  1857,    44,    26,    51,    45,
-      50,    44,    51,    43,    28,  1894,    48,  1108,    46,    26,
-      51,    26,    46,    52,    49,    43,    92,    50,    48,    28,
-      30,    28,    44,    48,  1548,    30,    46,    48,  1917,    43,
-      48,  1555,    43,    49,    46,    28,    30,    50,    26,    30,
-    1942,    49,    46,  1567,    50,    48,    46,    43,    50,    50,
-      49,    48,    50,    29,    44,  1579,    51,    46,    42,    51,
-      45,  1580,  1581,    50,    50,  1589,    44,    39,    49,    31,
-      45,    44,    30,    50,    48,    28,    28,    44,    48,    30,
-      51,    50,    50,  1945,  1942,    51,    50,    42,    51,    30,
-    1948,  1949,    49,    30,  1952,    51,  1620,    51,    26,    30,
-      50,    50,    50,    30,    44,    51,    51,    51,    30,  1633,
-      92,    31,    51,    92,  1972,  1639,    50,    38,    51,  1643,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    50,    44,    51,    92,    50,    39,    51,    51,
-      50,    48,   917,    51,    92,    50,    42,    51,  2020,  2021,
-      51,    50,    50,    29,    51,    30,    39,    50,    31,    51,
-      45,    51,    50,    92,    45,    44,    30,    26,    50,    49,
-      44,    43,    92,    50,  2073,    26,    92,    39,    49,    44,
-      50,   956,    51,   958,   959,    43,    92,    43,    26,    92,
-      50,  1725,    44,    43,  1723,    43,    43,    50,    44,  1728,
-      26,    29,    26,   978,    29,    50,    43,    50,    92,    50,
-      50,    26,    30,    46,    50,    42,    46,    48,    50,    39,
-      26,    29,    45,  1752,  1753,  1754,    45,    44,    44,    51,
-      44,  1760,    45,    43,    30,    92,    28,    92,    50,    50,
-      39,    29,    29,    92,    37,    31,  1021,    29,    92,    50,
-      44,    30,    28,    92,  1029,  1030,    45,    28,    49,  1034,
-      37,    30,    30,    30,    44,    50,    50,    30,    30,    44,
-    2138,    92,    30,    28,    44,    49,  1810,  1811,  1053,  1054,
-    1055,  1056,  1057,  1058,  1059,  1060,  1061,  1062,  1063,  1064,
-    1401,    30,    92,    45,  1828,    92,  1407,    28,    51,  2198,
-      50,  1076,  1077,  1078,  1079,  1080,    51,    45,    44,  1420,
-      50,  1422,  1423,    50,    92,    44,    50,    30,    30,  1430,
-      92,    49,    28,    28,    44,    29,    52,  1856,  1857,    38,
-      30,  1860,    39,    28,  1109,    52,    39,    39,    39,    28,
-      39,    92,    38,    30,    29,    28,    28,    44,    29,  1460,
-      48,    45,    44,    44,  1465,    28,    44,  1468,  1469,    52,
-    1471,    38,    52,    29,  1475,    44,    52,    28,    48,    38,
-      42,    27,    50,    44,    50,    50,    29,    45,    52,    26,
-      50,    30,    45,    48,    38,    28,  2254,    44,    29,    39,
-      30,    50,    52,    26,    45,    50,    30,    29,    42,    51,
-      30,    39,    50,    30,    50,    50,    30,    26,    92,    38,
-    2309,    39,    30,    50,  1943,  1944,  1945,    30,    39,    50,
-      45,    38,    30,    30,    39,    92,    26,    50,    92,    51,
-      92,    26,    52,    39,    92,    39,    39,    30,    50,    40,
-      39,    39,    28,    30,    28,    39,    51,    44,    39,    28,
-      92,    26,    28,    92,    39,    26,    92,    49,    28,    31,
-      40,    49,    52,    52,    46,    30,    92,    48,    45,    52,
-      39,  1582,  1583,    28,    52,    39,    92,    44,    92,    52,
-      48,    92,    44,    43,    45,    44,    44,    39,    44,    39,
-      30,  2020,  2021,  2022,    45,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    49,  2407,    34,
-      49,    48,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    48,    46,    43,    50,    44,    44,    48,    39,
-      30,    39,    30,    44,    43,    39,    30,  2096,  2097,    44,
-      55,    38,    44,    50,    30,    48,    39,    31,    30,    45,
-      51,    50,    44,    48,    30,    26,    44,    30,    28,    46,
-      51,    27,    30,    44,    49,  1706,  1707,  1708,  1709,    26,
-      92,    26,    49,    26,    30,    50,    92,    39,    28,    28,
-      44,    28,    26,  1724,    44,    46,  1727,    28,    27,    26,
-      44,    50,    30,    45,    45,  1400,    44,    28,    30,    45,
-      30,    44,    92,    92,    46,    28,    51,    28,    48,    92,
-      46,    46,    30,    46,    48,    43,    42,    44,    30,    30,
-      30,    46,    30,    30,    46,    44,    30,    30,    28,    92,
-      50,    46,    31,    31,    51,    51,    50,  1442,    51,    26,
-      42,    46,    26,    49,    26,    30,    26,  1759,  1761,    50,
-      42,    44,    48,    50,    49,    44,    50,    45,    39,    42,
-      50,  2451,  1477,    92,    29,    43,    45,    44,    92,    44,
-      46,    45,    45,    44,    30,    45,  1817,    45,    26,    51,
-      31,    50,    48,    92,    45,    49,    49,    54,    46,    48,
-      44,    51,    45,    50,    31,  2254,    51,    29,    50,    48,
-      46,    92,    26,    50,    48,    30,    92,  1512,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    92,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,    95,    96,    97,    92,    92,
-      30,    39,    48,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,  1737,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,    95,    96,    97,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    26,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,     3,     4,     5,     6,     7,     8,     9,
+      20,  1491,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,   979,    45,    46,    20,   634,   527,
+    1017,   187,   938,   937,   175,  1400,   552,   954,  1031,   945,
+     182,   183,  1158,   987,   191,   186,   187,   182,   183,  1064,
+    1065,  1066,   191,   191,  1429,  1774,  1235,  1587,     6,   572,
+     610,   574,  1791,   569,  1783,   939,   564,   565,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    49,  1709,   577,
+     578,    30,    49,   581,   582,   583,   584,  1434,  1005,    49,
+     557,   604,   571,   564,   565,  1470,    49,   613,    49,  1445,
+      26,   614,  1467,   613,    38,   615,    30,   574,   606,   607,
+    1456,  1457,    49,  1030,    49,    39,    50,    43,   616,   617,
+      92,   631,    30,    49,  1471,    92,    52,  1044,   638,   639,
+    1047,   610,    92,  1764,  1494,   606,   607,   604,  1498,    92,
+      48,    92,    27,  1087,  1519,  1520,  1777,   614,   654,    97,
+      98,    99,    28,    29,    39,    92,    30,    92,  1505,  1506,
+    1507,  1508,  1509,    29,    49,  1511,  1512,    52,  1514,    39,
+    1516,    30,    28,    30,    50,    45,    42,    51,   542,   543,
+     544,   545,   546,   547,   548,   549,   550,   551,  1105,   553,
+     554,   555,   556,    49,   558,   559,   560,   561,   624,   563,
+      98,    99,   566,   567,   568,   631,  1736,    28,    29,    26,
+      30,    30,   687,   688,    27,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    46,    29,    51,    45,    50,
+      50,    50,    30,    46,    29,    26,    44,    28,    29,    30,
+      31,   261,   262,   263,   264,   265,    49,    29,  1977,    44,
+      48,   764,    43,  1432,    32,    33,   276,  1976,    49,  1163,
+      31,    52,  1168,   283,    46,   285,   286,   287,   288,   289,
+      48,   291,   292,    44,   294,   295,   296,  1393,   298,    30,
+     300,   301,   302,   303,   304,  1159,   306,   307,   308,   309,
+     310,   311,   312,   313,   314,   315,  1786,    29,    44,   319,
+      28,    29,   322,    31,   324,    29,    39,   327,    29,    28,
+      29,   331,   332,   333,    46,    43,   336,   337,    51,   339,
+     340,    49,    46,    44,    43,    28,   346,   347,   348,   349,
+      49,   351,   352,   353,   354,    26,    39,    28,    29,    30,
+      31,   361,    26,    51,    52,    26,    30,    31,   368,    30,
+    1715,   371,    43,   373,   374,   375,   376,    39,    49,    43,
+     380,   381,    43,   383,   384,   385,   386,   387,   388,    31,
+      32,    33,    54,  1738,   394,   395,   396,   397,   398,   399,
+     400,   401,   402,   403,   404,   405,   406,   407,   408,  1749,
+     410,    44,   412,    97,   541,    48,   175,  1743,    31,    32,
+      33,    39,   541,   541,   954,   184,    26,   186,   187,  1784,
+      30,    44,     0,   192,   193,    48,   195,    55,  1778,    29,
+    1780,    46,    42,    43,    44,    29,    31,    31,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    39,    29,    44,
+      44,  1787,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    54,    44,   612,  1005,    43,   955,   956,  1446,
+    1447,    48,   937,   938,   939,    28,   624,   487,   624,   489,
+     945,    37,   988,    28,   494,    43,    39,  1492,  1493,   992,
+    1030,   994,   624,   624,    39,  1402,   175,  1404,    43,   624,
+     179,  1395,    39,    28,  1044,   184,    31,  1047,    45,    28,
+     998,   999,  1000,  1001,    26,    27,    28,    29,    30,    31,
+      39,    28,    29,    27,    43,    37,    30,    30,  1016,  1436,
+    1018,    43,    39,  1021,  1022,  1023,  1024,    49,    50,    49,
+      52,   524,    31,    32,    33,    26,  1052,    26,    29,    28,
+      29,    30,    31,  1041,  1042,    44,    32,    33,    39,    48,
+      51,    52,    32,    33,    43,  1105,    28,  1055,    44,   552,
+      49,    50,   175,    52,   557,    45,    46,    39,    42,    20,
+      46,    45,   179,   186,    48,   188,   189,   184,  1091,   572,
+     234,   574,   236,   237,   238,   239,   240,   241,   242,   243,
+      31,    32,    33,    43,  1110,  1111,    28,   590,  1515,    49,
+     593,   594,   595,  1101,  1102,    28,  1104,    39,  1106,    44,
+     603,   604,    43,   178,    39,    50,    39,    42,    49,   184,
+     613,   614,    30,    10,    11,    12,    13,    14,    15,    16,
+      17,    49,   625,   626,    52,   628,   629,    39,    25,    28,
+    1004,   634,   635,   636,   637,    32,    33,    34,   175,    36,
+      39,    32,    33,   180,   181,   675,   631,   632,   633,   186,
+     187,    28,   676,   677,   678,   679,   680,   681,   682,   683,
+     684,    44,    39,    49,    32,    33,    52,    64,   698,   699,
+     700,    68,    29,    70,  1159,    72,    44,    74,  1163,  1595,
+     180,   181,    48,  1168,   182,   183,   186,   187,   186,   187,
+      50,   721,   722,   723,   724,   725,   726,   727,   728,   729,
+     730,   731,   732,   733,   734,   735,    49,   737,   738,   739,
+     740,    46,    32,    33,    49,   745,   746,   747,   748,    46,
+      49,   751,    49,   753,    26,   755,   756,   757,    46,  1732,
+     760,   761,  1735,    52,    46,   765,   766,    49,    46,    46,
+      39,    49,    49,   773,   774,   775,   776,    28,    29,    27,
+     780,   781,   782,   783,    28,    29,   687,   688,   788,    98,
+     790,   764,    29,   793,   794,   691,   692,    43,   798,   190,
+     191,   190,   191,   182,   183,   805,   176,   177,   577,   578,
+      43,   811,    28,   813,    49,   815,  2286,  1714,   818,  1716,
+     820,    39,   822,    27,  2169,   825,    39,   827,   828,    30,
+      26,   831,    55,    26,   834,    10,    11,    12,    13,    14,
+      15,    16,    17,    50,   844,   845,   846,    50,    29,    43,
+      30,    50,   852,   853,   854,   855,   856,   857,   858,   859,
+     860,   861,   862,   863,   864,   865,  1790,   867,   868,   869,
+      29,   871,  1402,  1369,  1404,   875,   876,   877,   878,   879,
+      30,   881,   882,    50,   884,   885,   886,    45,    30,    29,
+      26,    51,    49,   887,   888,    38,    27,    30,    39,   899,
+     900,    38,    27,    27,    39,  1491,  1436,    45,    27,  1844,
+      39,    45,    39,    45,    31,    54,   916,   917,    39,    31,
+      30,    51,    44,    39,    44,  1403,    39,  1405,     1,    38,
+      31,     4,    39,    51,    42,    26,    51,   937,    26,    45,
+    1395,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    51,   169,    26,    27,    28,    29,    30,    31,    54,
+      45,    30,    44,    44,    37,    44,    39,    50,    48,    42,
+      43,    48,  1468,    48,    47,    48,    49,    28,    51,    50,
+      52,    46,    27,    26,    44,  1515,  1482,    92,    29,  1485,
+    1445,    43,    29,  1486,  1490,    26,    26,    31,    92,    37,
+     634,    29,    42,    92,    48,    29,    39,   980,  1008,    44,
+     983,   984,   985,   986,   987,   988,   989,   990,    50,   992,
+      39,   994,    29,   996,    92,    98,    99,    49,    29,  1002,
+      92,    29,    31,    92,  1931,    29,    29,  1010,    92,    31,
+      29,    44,   676,   677,   678,   679,   680,   681,   682,   683,
+     684,    39,    43,    49,    30,    29,  1980,    38,    31,  1032,
+    1033,    29,    52,  2389,    30,    44,    29,    31,    26,    92,
+      52,    31,    92,  1046,    45,    44,    48,    39,  1051,  1052,
       10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    26,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,    95,    96,    97,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    42,    45,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,     3,     4,     5,     6,     7,     8,     9,
+      43,  1064,  1065,  1066,     7,    50,    26,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    39,    49,    29,
+      50,    30,  1085,    50,  1087,  1109,  1089,    45,  1091,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,  2026,
+      30,    48,    50,    49,    44,    39,    39,  1110,  1111,  1139,
+    1595,     7,    29,    39,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    42,    45,    30,  2483,   589,   590,
+     591,     7,    39,  1163,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,  1174,    39,  1176,  1177,  1178,  1179,
+     611,    44,    39,    30,  1714,     7,  1716,    39,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    30,  1199,
+    1786,    49,    39,    29,    28,    30,   637,  1207,    52,  1209,
+    1210,    26,    51,    44,  1214,  1215,  1216,    50,  1218,  1219,
+      50,    42,    39,  1223,  1224,    44,    39,    45,    39,    45,
+      27,  1231,    39,    39,    30,    49,  1236,    39,    39,  1717,
+      30,  1241,    29,  1243,  1244,  1245,    49,    39,    39,    44,
+      50,    31,    45,   887,   888,    39,  1256,   891,    30,  1259,
+    1260,  1261,  1235,     7,    45,    39,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    42,  1277,    51,  1279,
+      45,  1281,    44,    51,    45,  1285,  1286,     7,  1743,    45,
       10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    44,    31,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,    95,    96,    97,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    48,    44,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,     3,     4,     5,     6,     7,     8,     9,
+      26,    26,    51,  1303,  1304,  1305,  1306,  1307,  1308,  1309,
+    1310,  1311,  1312,  1313,  1314,    30,  1316,    39,  1318,    30,
+    1320,    39,  1322,    39,    31,    44,  1326,  1327,  1328,  1329,
+    1330,    39,  1332,  1333,    39,  1335,  1336,  1337,    30,    49,
+      27,  1341,  1342,    39,  1338,  1339,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,  1358,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    28,    30,  1395,  1369,    29,    26,    28,
+      39,  1931,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    50,    28,    55,    39,    28,    92,    44,    44,
+      92,    32,    29,    26,    33,    35,    44,  1400,    28,    45,
+      44,    44,    28,    30,    92,    92,    42,    30,    26,  1439,
+      44,    42,    31,    30,    43,    92,    48,    42,    92,    92,
+      44,    49,    44,  1426,  1427,  1428,  1429,  1430,    44,  1432,
+    1433,  1434,    44,    28,    45,    45,    30,  1440,    28,    92,
+      92,    30,    92,  1107,  1108,  1109,    29,    49,    48,    31,
+      48,    28,  1455,    45,    42,    28,    42,    92,    29,    50,
+      29,    29,    42,    50,  1467,  1468,  2026,  1470,  1471,    50,
+      42,    29,    28,    43,    52,    49,    42,    30,    45,  1482,
+    1483,    44,  1485,  1486,  1487,  1488,    28,  1490,  1491,  1492,
+    1493,  1494,    44,    30,  1497,  1498,    26,    30,    26,    92,
+      29,    42,  1505,  1506,  1507,  1508,  1509,    92,    30,    48,
+      27,    38,    48,    34,    30,  1545,  1519,  1520,   979,    39,
+     981,   982,    30,    49,  1554,  1555,  1556,  1557,    39,    39,
+     991,    50,    92,    51,   995,    92,    26,    30,    50,    30,
+      49,   788,    44,  1573,  1574,   792,   793,    39,    30,  1579,
+    1580,  1581,    48,    30,  1015,  1585,  1017,    43,    92,    30,
+      49,    45,    30,    50,    39,    39,  1596,  1597,  1029,    92,
+    1031,    49,    55,    39,    50,    39,   823,  1607,  1608,    92,
+      49,  1605,  1606,    44,  1587,    92,    92,    50,    44,    39,
+      30,    39,    50,    30,    51,    28,    50,    92,  1628,  1629,
+      39,  1631,    45,  1064,  1065,  1066,    30,    39,    39,    30,
+      45,    30,  1642,    51,    39,    30,    39,    28,    30,    92,
+      48,    30,    49,  1084,    30,    42,    44,  1088,    50,  1659,
+      30,    39,    42,    92,    30,    39,  1666,    92,    43,    31,
+      39,    42,    44,  1673,  1674,  1675,  1676,  1677,    51,    42,
+      92,   898,    50,    48,    45,  1685,  1686,    27,    42,    44,
+      50,    29,    92,    49,    31,    26,  1127,    50,    48,    48,
+    2286,    44,  1702,   592,  1338,  1339,  1340,   596,    43,    50,
+      44,    44,    48,    29,    29,    45,   605,    44,    50,    45,
+      44,    31,    43,   612,    28,    92,    48,    30,    92,    48,
+      30,    45,    44,    92,    92,    92,  1709,    45,    45,    48,
+    1740,    92,  1715,    42,    92,    92,    92,    45,    42,    50,
+    1750,    29,    44,  1753,    42,    31,    28,    43,    27,    48,
+      31,    45,    49,  1736,    92,  1738,    39,   656,    30,    92,
+      49,    30,    92,    48,    92,    92,  1749,    51,    42,    49,
+      31,  1754,    39,    49,    45,  1779,    30,    50,    43,    28,
+      48,  1764,    39,  1766,    48,    51,    49,    49,    46,    49,
+       6,  1774,    51,    39,  1777,  1778,    51,  1780,    31,    39,
+    1783,  1784,  1785,  1786,    51,    30,    50,  1790,  1791,    51,
+      39,  1455,    39,  1823,    28,    26,    39,    92,    30,    45,
+      28,    51,    92,    26,    46,  1808,  1836,    31,    48,  1839,
+      43,    31,    39,    39,    28,    45,    92,    29,    29,    92,
+      45,    30,    30,    30,    28,    30,    44,  1491,    44,    51,
+    1494,    50,    30,    39,  1498,    92,    51,    50,    39,    30,
+      92,    51,    26,    30,    43,    26,    48,    50,    44,    49,
+      28,  1881,    44,  1517,  1518,    50,    50,    31,    51,  1883,
+    1884,    50,    50,  1893,  1894,    51,    51,    50,    44,    51,
+      50,  1901,    43,    50,    44,    44,    51,    45,    45,    44,
+      44,    39,    45,    45,    50,    46,    39,    44,    44,    30,
+      50,  1921,    51,    44,    39,    45,    51,    51,    44,    43,
+      48,    28,    26,    46,    51,    26,    46,    43,    28,    48,
+      52,    49,    30,    92,    28,  1945,    50,    30,    44,    48,
+      48,    43,    28,    48,    43,    30,    49,  1970,  1785,    46,
+      26,    46,  1501,    30,    50,    42,    44,    49,    48,    50,
+      49,  1605,  1606,    46,    46,    29,    50,    48,    31,  1973,
+      50,    50,    46,    51,    45,    44,    51,    50,    50,    39,
+    1207,  1208,    43,    49,  1425,    50,    45,  1970,    44,    30,
+    1431,  1218,    28,  1976,  1977,  1222,    48,  1980,    51,    28,
+      44,    50,    50,  1444,    30,  1446,  1447,    42,    51,    51,
+      50,    48,    30,  1454,    30,  1242,    49,  2000,    26,    51,
+      50,    30,    92,    51,    44,    50,    50,    50,    30,    51,
+    1257,    30,    51,    44,    51,   934,    51,    50,    92,    51,
+      50,    92,    92,  1484,    51,  2049,  2050,    50,  1489,    38,
+      51,  1492,  1493,    51,  1495,    50,    48,    50,  1499,    39,
+      51,    51,    50,    50,    42,    51,    51,    31,    29,    39,
+      30,    50,    31,    45,    51,   974,    51,   976,   977,   978,
+      45,    50,    44,    30,    50,    26,    92,    44,  1315,    43,
+      39,    49,  1319,  2103,    50,    92,    49,    26,   997,    50,
+      44,    51,    26,    43,    43,  1749,    26,    50,    92,    92,
+    1754,    92,    43,    43,    50,    26,    44,    43,    50,    44,
+      29,    26,    29,    50,    43,    92,    26,    50,    50,    30,
+      46,  1358,    50,    46,  1778,  1779,  1780,    26,    42,    45,
+      48,  1040,  1786,    45,    39,    44,    44,    50,    44,  1048,
+    1049,    45,    29,    43,  1053,    92,    30,    92,    51,    50,
+      28,    39,    50,    29,    29,    37,  1607,  1608,    31,    29,
+      50,    92,    45,  1072,  1073,  1074,  1075,  1076,  1077,  1078,
+    1079,  1080,  1081,  1082,  1083,    44,  2169,    30,    28,    28,
+      37,    44,    50,    49,    30,    92,  1095,  1096,  1097,  1098,
+    1099,    30,    50,    30,    50,    92,    92,    30,    92,    44,
+      30,    30,    28,    92,    44,    49,    30,    45,    28,    51,
+    2230,    92,    92,    45,    50,    30,    51,    44,    30,  1128,
+      28,    44,    50,    28,    38,    50,    29,    44,    50,  1883,
+    1884,    49,    39,  1887,    30,    39,    52,    39,    39,    28,
+      39,    52,    48,    38,    44,    28,    30,    45,    29,    92,
+      44,    44,    49,    44,    28,    42,    29,    28,    44,    38,
+      52,    28,    52,    48,    52,    29,    28,    27,    50,    44,
+      50,    29,    50,    38,    50,    52,    45,    26,    30,    38,
+      48,  1732,  1733,  1734,  1735,    28,    30,    29,    45,    44,
+      26,    39,    29,  2286,    45,    30,    52,    50,    30,  1750,
+      50,    39,  1753,    30,    51,    50,    30,    26,    39,    50,
+      50,    50,    38,    30,    30,    45,    39,  1971,  1972,  1973,
+      92,  2341,    92,    38,    42,    50,    92,    55,    30,    92,
+      30,    92,    39,    26,    39,    39,  1573,    50,    92,    51,
+      26,    52,    39,  1580,    50,    30,    92,    39,    28,    40,
+      39,    30,    39,    51,    44,  1592,    39,    52,    92,    92,
+      28,    49,    28,    39,    26,    28,    26,  1604,    52,    46,
+      52,    49,    92,    48,    28,    30,    40,  1614,    52,    28,
+      45,    39,    92,    44,    92,    44,    39,    43,    39,    30,
+      30,    48,    44,  1844,    44,  2049,  2050,  2051,    45,    44,
+      39,    31,    45,    49,    52,    49,    48,    43,  1645,    46,
+      48,    44,    44,    39,    48,    50,    39,    30,    43,  2439,
+      44,  1658,    44,    39,    30,    44,    38,  1664,    55,    50,
+      30,  1668,    39,    48,    45,    31,    30,    51,    48,    44,
+      30,    50,    26,    44,    30,    28,    27,    51,    46,    44,
+      30,    26,    49,    26,    39,    26,    49,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    30,
+      28,    34,  2126,  2127,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,  1751,  1424,    92,    50,    92,    28,
+      44,    28,    92,    26,    46,    44,    28,    27,    44,    30,
+      45,    45,    44,    92,    45,    26,    44,    92,    28,    92,
+      46,    30,    30,    48,    28,    30,    50,    28,    46,    46,
+      46,    43,    51,    48,    30,    42,    30,  1466,    44,    30,
+      30,    30,    30,    46,    46,    44,    30,    28,    31,    31,
+      50,    46,    92,    51,    51,    42,    26,    50,    50,    26,
+      26,    46,    92,    49,    26,    30,    38,    44,    42,    42,
+      50,    49,    51,    48,    50,    39,    45,    48,    92,    92,
+    1837,  1838,    50,    44,    43,    45,    44,    44,    51,    45,
+      45,    44,    46,    45,    45,    29,    31,    30,  1855,    45,
+      50,    49,    49,    46,    48,    54,    44,  1536,    45,    50,
+      31,    51,  2286,     3,     4,     5,     6,     7,     8,     9,
       10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
       20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    45,    45,    34,    35,    36,    37,    38,    39,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
       40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
       50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
       60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
@@ -2198,26 +2134,121 @@ static const yytype_int16 yycheck[] =
       90,    91,    92,    93,    94,    95,    96,    97,     3,     4,
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    44,    44,    34,
+      25,    26,    27,    28,    29,    30,    31,    32,    92,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
       55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
       65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
       75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
       85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    45,    55,    26,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    91,    92,    93,    94,    95,    96,    97,     3,     4,
+      95,    96,    97,    92,    92,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,  1763,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      50,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    51,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    48,
+      46,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    26,    50,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    29,
+      48,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    92,    26,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    30,
+      30,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    39,    48,    26,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,     3,     4,
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      25,    26,    27,    28,    29,    30,    31,    26,    42,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
       55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
@@ -2227,7 +2258,7 @@ static const yytype_int16 yycheck[] =
       95,    96,     3,     4,     5,     6,     7,     8,     9,    10,
       11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
       21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      31,    45,    44,    34,    35,    36,    37,    38,    39,    40,
       41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
       51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
       61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
@@ -2236,7 +2267,7 @@ static const yytype_int16 yycheck[] =
       91,    92,    93,    94,    95,    96,     3,     4,     5,     6,
        7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
       17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-      27,    28,    29,    30,    31,    48,    92,    34,    35,    36,
+      27,    28,    29,    30,    31,    31,    48,    34,    35,    36,
       37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
       47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
       57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
@@ -2245,8 +2276,8 @@ static const yytype_int16 yycheck[] =
       87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
        3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
       13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,    27,    28,    29,    30,    31,    48,
-      28,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    44,
+      44,    34,    35,    36,    37,    38,    39,    40,    41,    42,
       43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
       53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
       63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
@@ -2255,7 +2286,7 @@ static const yytype_int16 yycheck[] =
       93,    94,    95,    96,     3,     4,     5,     6,     7,     8,
        9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
       19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
-      29,    30,    31,    43,    50,    34,    35,    36,    37,    38,
+      29,    30,    31,    45,    45,    34,    35,    36,    37,    38,
       39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
       49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
       59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
@@ -2264,7 +2295,7 @@ static const yytype_int16 yycheck[] =
       89,    90,    91,    92,    93,    94,    95,    96,     3,     4,
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    43,    49,    34,
+      25,    26,    27,    28,    29,    30,    31,    44,    55,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
       55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
@@ -2274,7 +2305,7 @@ static const yytype_int16 yycheck[] =
       95,    96,     3,     4,     5,     6,     7,     8,     9,    10,
       11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
       21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    39,    48,    34,    35,    36,    37,    38,    39,    40,
+      31,    45,    26,    34,    35,    36,    37,    38,    39,    40,
       41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
       51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
       61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
@@ -2283,7 +2314,7 @@ static const yytype_int16 yycheck[] =
       91,    92,    93,    94,    95,    96,     3,     4,     5,     6,
        7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
       17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-      27,    28,    29,    30,    31,    43,    51,    34,    35,    36,
+      27,    28,    29,    30,    31,    48,    92,    34,    35,    36,
       37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
       47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
       57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
@@ -2292,8 +2323,8 @@ static const yytype_int16 yycheck[] =
       87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
        3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
       13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,    27,    28,    29,    30,    31,    31,
-      45,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    48,
+      28,    34,    35,    36,    37,    38,    39,    40,    41,    42,
       43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
       53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
       63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
@@ -2302,7 +2333,7 @@ static const yytype_int16 yycheck[] =
       93,    94,    95,    96,     3,     4,     5,     6,     7,     8,
        9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
       19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
-      29,    30,    31,    55,    50,    34,    35,    36,    37,    38,
+      29,    30,    31,    43,    50,    34,    35,    36,    37,    38,
       39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
       49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
       59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
@@ -2311,319 +2342,305 @@ static const yytype_int16 yycheck[] =
       89,    90,    91,    92,    93,    94,    95,    96,     3,     4,
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    51,    31,    34,
+      25,    26,    27,    28,    29,    30,    31,    43,    49,    39,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
       55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
       65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
       75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
       85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    50,    48,    34,    35,    36,    37,    38,    39,    40,
+      95,    96,    48,    43,    51,    31,    45,    55,    50,    31,
+      51,    48,    50,    26,    29,    39,    30,    45,    30,    30,
+      26,    50,    26,    30,    44,    92,    45,    44,    26,    45,
+      48,    52,    92,    43,    30,  2483,    44,    30,  1787,    30,
+      49,    44,    43,    30,    29,    50,    48,    39,    43,    30,
+      50,    50,    30,    50,    44,    44,    50,    45,    30,   985,
+      31,    30,    30,  1497,    50,    48,    48,    30,    52,    48,
+      50,    30,    48,    50,    44,    49,    51,    50,    45,    45,
+      42,    29,  1754,    48,    48,    45,  1743,    48,    42,   956,
+    1392,    48,    50,    49,   692,  1608,  1405,  1780,   184,   184,
+     184,   191,   191,   191,   191,   608,   624,   633,   191,   191,
+     191,   191,   191,   191,   191,   191,   191,   191,    73,   191,
+     191,   191,   191,   191,   185,   191,   191,   191,   191,   191,
+     184,   187,   184,   184,   187,   184,   191,   187,   197,   184,
+     184,   184,    -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,
+      -1,   184,   187,   187
+};
+
+  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
+     symbol of state STATE-NUM.  */
+static const yytype_uint16 yystos[] =
+{
+       0,     1,     4,    26,    27,    28,    29,    30,    31,    37,
+      39,    42,    43,    47,    48,    49,    51,   101,   102,   103,
+     104,   105,   197,   198,   199,   200,   201,   202,   204,   205,
+     206,   207,   208,   209,   214,   215,   219,   220,   221,   222,
+     298,   325,   326,   328,   333,   334,   335,    29,    46,    30,
+      42,    45,    48,    30,    29,    44,    39,    45,    30,    44,
+      39,    45,    26,    45,    51,    30,    30,    51,    44,     0,
+      98,    99,   195,   196,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    34,    35,    36,    37,    38,    39,    40,
       41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
       51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
       61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
       71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
       81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
-      91,    92,    93,    94,    95,    96,     3,     4,     5,     6,
-       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-      27,    28,    29,    30,    31,    26,    29,    39,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
-      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
-      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
-      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
-      30,    45,    30,    30,    26,    50,    26,    30,    44,    92,
-      45,    44,    26,    45,    43,    52,    50,    48,    30,    44,
-      30,    30,    43,    49,    48,    44,    39,    30,    43,    29,
-      92,    30,    50,    50,    50,    30,    44,    30,    45,    50,
-      44,    31,    30,    30,    50,    30,    48,    52,   966,    50,
-      48,    48,    38,    30,    50,  1473,    48,    51,    29,    50,
-      49,    45,    44,    42,    45,    48,  1728,    45,    48,  1717,
-      42,   939,    48,  1369,    48,    50,    49,   677,  1583,  1382,
-    1754,   179,   186,   179,   179,   186,   186,   186,   595,   611,
-     620,   179,   186,    -1,   186,    -1,   186,   186,    68,   186,
-     186,   186,   186,    -1,   186,   186,   186,   186,   186,   186,
-     186,   186,   186,   186,   186,   186,   180,   182,   179,   179,
-     186,   179,   179,   182,   179,   179,   182,   179,    -1,   182,
-     179,   182
-};
-
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
-{
-       0,     1,     4,    26,    28,    29,    30,    31,    37,    39,
-      42,    43,    47,    48,    49,    51,   101,   102,   103,   104,
-     105,   197,   198,   199,   200,   201,   202,   204,   205,   206,
-     207,   208,   209,   214,   215,   219,   220,   221,   222,   297,
-     324,   325,   327,   332,    29,    46,    42,    45,    48,    30,
-      29,    39,    45,    30,    44,    39,    45,    26,    45,    51,
-      30,    30,    51,    44,     0,    98,    99,   195,   196,     3,
-       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,   173,   176,   186,   188,   189,   190,   194,   194,
-     194,   194,   194,   194,   194,   194,   194,   194,   194,   194,
+      91,    92,    93,    94,    95,    96,    97,   173,   176,   186,
+     188,   189,   190,   194,   194,   194,   194,   194,   194,   194,
      194,   194,   194,   194,   194,   194,   194,   194,   194,   194,
-     194,    29,    46,    30,    46,    30,    49,    39,    44,    48,
-      50,    49,    49,    26,    46,    52,    39,    43,    49,    44,
-      50,    27,    43,    49,   195,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,   172,   173,   172,   172,   172,
-     172,   172,   172,   172,   172,     4,    10,    11,    12,    13,
-      14,    15,    16,    17,    18,    19,   188,    28,    29,    43,
-      49,   106,   223,   278,   288,   300,   302,    26,    28,    29,
-      30,    31,    43,    49,    50,    52,   112,   223,   224,   225,
-     226,   251,   252,   253,   261,   266,   267,   268,   269,   270,
-     271,   273,   274,   275,   276,   277,   278,   279,   280,   282,
-     283,   284,   285,   286,   287,   288,   289,   290,   291,   298,
-     299,   300,   301,   302,   303,   304,   313,   314,   319,   320,
-     323,    43,   109,   286,   110,   286,    43,   116,   287,    29,
-      42,   117,   301,   302,   311,    29,   118,   300,   303,   119,
-     300,   303,    26,    30,    31,    43,   114,   267,   275,   284,
-     298,   120,   267,   275,   284,   298,    26,    30,    31,    43,
-      49,   130,   223,   224,   225,   226,   266,   273,   276,   279,
-     280,   283,   287,   289,   299,   301,   302,   323,    30,    39,
-     121,   259,   261,   111,   223,   278,   288,   298,   300,   303,
-      26,    30,    43,    49,   113,   216,   223,   265,   270,   277,
-     281,   282,   288,   298,   300,   303,   314,   319,   320,   330,
-     122,   278,   123,   278,    26,    27,    28,    29,    30,    31,
-      37,    43,    49,    50,    52,   107,   228,   229,   230,   231,
+     194,   194,   194,   194,   194,   194,   194,   194,    29,    46,
+      37,    30,    46,    30,    49,    39,    29,    44,    48,    50,
+      49,    49,    26,    46,    52,    39,    43,    49,    44,    50,
+      27,    43,    49,   195,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,   172,   173,   172,   172,   172,   172,
+     172,   172,   172,   172,     4,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,   188,    28,    29,    43,    49,
+     106,   223,   279,   289,   301,   303,    26,    28,    29,    30,
+      31,    43,    49,    50,    52,   112,   223,   224,   225,   226,
+     252,   253,   254,   262,   267,   268,   269,   270,   271,   272,
+     274,   275,   276,   277,   278,   279,   280,   281,   283,   284,
+     285,   286,   287,   288,   289,   290,   291,   292,   299,   300,
+     301,   302,   303,   304,   305,   314,   315,   320,   321,   324,
+      43,   109,   287,   110,   287,    43,   116,   288,    29,    42,
+     117,   302,   303,   312,    29,   118,   301,   304,   119,   301,
+     304,    26,    30,    31,    43,   114,   268,   276,   285,   299,
+     120,   268,   276,   285,   299,    26,    30,    31,    43,    49,
+     130,   223,   224,   225,   226,   267,   274,   277,   280,   281,
+     284,   288,   290,   300,   302,   303,   324,    30,    39,   121,
+     260,   262,   111,   223,   279,   289,   299,   301,   304,    26,
+      30,    43,    49,   113,   216,   223,   266,   271,   278,   282,
+     283,   289,   299,   301,   304,   315,   320,   321,   331,   122,
+     279,   123,   279,    26,    27,    28,    29,    30,    31,    37,
+      43,    49,    50,    52,   107,   228,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   238,   239,   241,   242,   243,
+     244,   245,   246,   247,   248,   249,   251,   252,   253,   255,
+     256,   257,   258,   259,   329,   108,   228,   229,   230,   231,
      232,   233,   234,   235,   236,   237,   238,   239,   241,   242,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
-     254,   255,   256,   257,   258,   328,   108,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   241,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   254,   255,   256,   257,   258,   328,   131,   223,   125,
-     223,    39,   126,   305,   115,   223,    30,    26,    55,    26,
-      50,    50,    29,    43,    30,    50,    29,    30,    50,    45,
-      30,    29,    49,    26,    51,   173,    38,    27,    39,    30,
-     194,   194,   194,   194,   194,    51,    52,    38,    27,    31,
-      44,    39,    54,    39,    30,    50,    45,    45,   194,   194,
+     243,   244,   245,   246,   247,   248,   249,   251,   252,   253,
+     255,   256,   257,   258,   259,   329,   131,   223,   125,   223,
+      39,   126,   306,   115,   223,    27,   336,   336,    30,    39,
+      26,    55,    26,    50,    50,    29,    43,    30,    50,    29,
+      30,    50,    45,    30,    29,    49,    26,    51,   173,    38,
+      27,    39,    30,   194,   194,   194,   194,   194,    51,    52,
+      38,    27,    31,    44,    39,    54,    39,    30,    50,    45,
+      45,   194,   194,   194,   194,   194,   194,   194,   194,   194,
      194,   194,   194,   194,   194,   194,   194,   194,   194,   194,
      194,   194,   194,   194,   194,   194,   194,   194,   194,   194,
-     194,   194,   194,   194,   194,   194,   194,    39,   194,   194,
-      39,   194,    27,    45,   194,   194,   194,    27,   194,   194,
-     194,   194,    51,    31,    54,    39,   194,   194,   194,   194,
-     194,   194,   194,   194,    51,    31,    54,    39,    30,   194,
-     194,   194,   194,   194,   194,   194,    44,   194,   194,   194,
-     194,   194,   194,   194,   194,    51,    28,    31,    39,    38,
+      39,   194,   194,    39,   194,    27,    45,   194,   194,   194,
+      27,   194,   194,   194,   194,    51,    31,    54,    39,   194,
+     194,   194,   194,   194,   194,   194,   194,    51,    31,    54,
+      39,    30,   194,   194,   194,   194,   194,   194,   194,    44,
+     194,   194,   194,   194,   194,   194,   194,   194,    51,    28,
+      31,    39,    38,   194,   194,   194,   194,   194,   194,   194,
      194,   194,   194,   194,   194,   194,   194,   194,   194,   194,
-     194,   194,   194,   194,   194,   194,   194,    51,    51,    38,
-      27,    30,    31,    54,    42,    39,    30,    50,    45,    45,
-     194,   194,    44,   194,    44,    48,    50,    48,    26,    48,
-      52,    50,    28,    46,    27,    26,    92,    29,    44,    43,
-     294,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-     136,   176,    32,    33,   154,   182,    32,    33,   153,   177,
-      31,    44,    48,   153,   166,   213,   308,   309,   310,    29,
-      26,    26,    92,    31,    37,    42,    92,    29,    44,    48,
-      48,    50,    39,    42,    39,    49,   227,   248,   249,   250,
-     227,   227,   227,   227,   227,   227,   227,   227,   227,   227,
-     136,   227,   227,   227,   227,    26,   142,   176,   210,   227,
-     227,   227,   227,   148,   176,   227,   153,   309,   153,   309,
-     227,   227,   227,    39,   259,   260,    29,    44,   127,   213,
-     142,    29,   142,   210,    92,    49,    44,   153,   310,   153,
-     310,    29,   240,    92,   153,   153,   153,   153,    29,    31,
-      92,    29,   186,   158,   167,   176,   186,   186,   148,   176,
-     176,   176,   148,    29,    31,    92,    29,    44,    43,   295,
-     176,   142,   210,   148,   153,   309,   153,   309,    39,   260,
-      49,   132,   152,   177,   213,   133,   151,   186,   148,   294,
-      30,   136,   274,   142,   210,   274,    31,   153,   307,   153,
-      29,    38,    31,    29,    30,    26,    29,    39,   217,   218,
-     331,    26,    43,    49,    52,   124,   267,   271,   272,   284,
-     288,   291,   292,   293,   294,   314,   317,   318,   176,   176,
-      52,   316,   176,   176,    44,   329,    26,    42,    43,   271,
-     274,   296,   315,   329,    29,   306,   329,    31,   306,   312,
-     329,     8,     9,   146,   170,   172,   173,   176,   176,   176,
-     169,   176,   186,   274,   274,    29,    31,    26,    92,    52,
-      31,    92,    45,    29,    49,    44,    48,    50,    39,    43,
-     326,   259,    49,   148,    29,    30,    45,    50,    50,    30,
-      48,    49,    44,    39,    39,    29,    39,   194,    34,    36,
-     184,   185,   187,   190,   191,   192,   193,   194,   185,    34,
-     178,   179,   189,   178,    42,    45,    30,   194,   194,   194,
-      39,    39,    44,    39,    30,    39,    30,    49,    39,    29,
-      52,    30,    26,    28,    51,    44,   194,   194,   194,   194,
+      51,    51,    38,    27,    30,    31,    54,    42,    39,    30,
+      50,    45,    45,   194,   194,    44,   194,    26,    44,    44,
+      48,    50,    48,    26,    48,    52,    50,    28,    46,    27,
+      26,    92,    29,    44,    43,   295,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,   136,   176,    32,    33,   154,
+     182,    32,    33,   153,   177,    31,    44,    48,   153,   166,
+     213,   309,   310,   311,    29,    26,    26,    92,    31,    37,
+      42,    92,    29,    44,    48,    48,    50,    39,    42,    39,
+      49,   227,   248,   249,   250,   251,   227,   227,   227,   227,
+     227,   227,   227,   227,   227,   227,   136,   227,   227,   227,
+     227,    26,   142,   176,   210,   227,   227,   227,   227,   148,
+     176,   227,   153,   310,   153,   310,   227,   227,   227,    39,
+     260,   261,    29,    44,   127,   213,   142,    29,   142,   210,
+      92,    49,    44,   153,   311,   153,   311,    29,   240,    92,
+     153,   153,   153,   153,    29,    31,    92,    29,   186,   158,
+     167,   176,   186,   186,   148,   176,   176,   176,   148,    29,
+      31,    92,    29,    44,    43,   296,   176,   142,   210,   148,
+     153,   310,   153,   310,    39,   261,    49,   132,   152,   177,
+     213,   133,   151,   186,   148,   295,    30,   136,   275,   142,
+     210,   275,    31,   153,   308,   153,    29,    38,    31,    29,
+      30,    26,    29,    39,   217,   218,   332,    26,    43,    49,
+      52,   124,   268,   272,   273,   285,   289,   292,   293,   294,
+     295,   315,   318,   319,   176,   176,    52,   317,   176,   176,
+      44,   330,    26,    42,    43,   272,   275,   297,   316,   330,
+      29,   307,   330,    31,   307,   313,   330,     8,     9,   146,
+     170,   172,   173,   176,   176,   176,   169,   176,   186,   275,
+     275,    29,    31,    26,    92,    52,    31,    92,    45,    29,
+      49,    44,    48,    50,    39,    43,   327,   260,    49,   148,
+      50,    29,    30,    45,    50,    50,    30,    48,    49,    44,
+      39,    39,    29,    39,   194,    34,    36,   184,   185,   187,
+     190,   191,   192,   193,   194,   185,    34,   178,   179,   189,
+     178,    42,    45,    30,   194,   194,   194,    39,    39,    44,
+      39,    30,    39,    30,    49,    39,    29,    52,    30,    26,
+      28,    51,    44,    50,   194,   194,   194,   194,   194,   194,
      194,   194,   194,   194,   194,   194,   194,   194,   194,   194,
-     194,   194,   194,   194,    42,   194,   194,   194,   194,   194,
-     194,   194,   194,   194,    44,   194,   194,    39,    45,   142,
-     194,   194,    39,    39,    50,    45,   194,   194,   194,   194,
-      27,    39,   194,   194,   194,   194,    39,    30,    49,    39,
-     194,   194,   194,   194,   194,    39,    30,    49,    39,    29,
-      39,   194,   194,   194,    44,   194,    50,   194,   194,   194,
-     194,    31,   194,   194,   194,    45,   194,    39,    45,    30,
-      39,    42,    51,    45,    44,   194,   194,   194,    51,    39,
-      51,    45,    45,   194,   194,   194,   194,   194,   194,   194,
-     194,   194,   194,   194,   194,   194,   194,    26,   194,   194,
-     194,    26,   194,    51,    30,    39,   194,   194,   194,   194,
-     194,    30,   194,   194,    39,   194,   194,   194,   172,   172,
-       7,   194,   194,    39,    31,    44,    39,    39,    30,    49,
-      27,    39,    28,    29,    30,    26,    28,    39,   194,   194,
-      50,    55,    39,    28,    44,    44,    92,    92,    29,   148,
+     194,   194,   194,    42,   194,   194,   194,   194,   194,   194,
+     194,   194,   194,    44,   194,   194,    39,    45,   142,   194,
+     194,    39,    39,    50,    45,   194,   194,   194,   194,    27,
+      39,   194,   194,   194,   194,    39,    30,    49,    39,   194,
+     194,   194,   194,   194,    39,    30,    49,    39,    29,    39,
+     194,   194,   194,    44,   194,    50,   194,   194,   194,   194,
+      31,   194,   194,   194,    45,   194,    39,    45,    30,    39,
+      42,    51,    45,    44,   194,   194,   194,    51,    39,    51,
+      45,    45,   194,   194,   194,   194,   194,   194,   194,   194,
+     194,   194,   194,   194,   194,   194,    26,   194,   194,   194,
+      26,   194,    51,    30,    39,   194,   194,   194,   194,   194,
+      30,   194,   194,    39,   194,   194,   194,   172,   172,     7,
+     194,   194,    39,    31,    44,    39,    39,    30,    49,    27,
+      39,    28,    29,    30,    26,    28,    39,   194,   194,    50,
+      28,    55,    39,    28,    44,    44,    92,    92,    29,   148,
       10,    11,    12,    13,    14,    15,    16,    17,    25,    32,
       33,    34,    36,    64,    68,    70,    72,    74,   174,   187,
      194,    32,    34,   184,   190,   191,    33,    32,   180,    35,
       33,    26,    44,    28,   152,    31,   153,   203,   153,   166,
       45,    42,    44,    44,    28,    44,    30,    92,    92,    30,
-      26,    42,    30,    43,    31,   148,    27,    46,   129,   321,
-     322,   148,   148,   151,   176,   186,   186,   176,   176,   158,
-     135,   176,   135,   136,   176,   176,   186,   142,    42,   142,
-     186,   176,   148,   153,   153,   153,   153,   176,    49,   227,
-     152,    92,    44,   194,   143,   176,    92,    44,    44,   164,
-     186,   153,   164,   153,    92,    44,   153,   153,   153,   153,
-      45,    28,    30,    92,   128,   186,   152,   168,   128,   145,
-     176,   150,   176,    45,    28,    30,    92,    92,    29,   148,
-     153,   153,    49,   152,    48,   149,   176,   152,   148,   148,
-      31,   159,   176,   136,   148,    48,   153,    45,    28,    92,
-      42,    50,    28,    50,   169,   169,   169,    29,    29,    50,
-      42,   148,   148,   148,   148,   148,   148,   148,   148,   148,
-     148,   148,   148,   186,   176,    42,   135,   186,   176,    43,
-     142,    29,    52,    29,   148,   148,   148,   148,   148,    49,
-     153,   153,    42,   153,   152,   153,     7,     7,   172,   136,
-     136,    45,    30,    44,    44,    28,    28,    30,    26,    92,
-      30,    92,    26,    42,    30,    29,   186,   148,    48,    27,
-      48,    30,    49,    39,    30,    39,   194,    10,    11,    12,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,    27,    28,    29,    30,    31,   175,
-     174,    34,   184,    34,    50,    92,    51,   194,    39,   194,
-     194,   194,   194,    92,    26,    30,    49,    50,    30,    44,
-      39,    30,    48,    43,    92,    49,    30,    45,    55,    30,
-     194,   194,   194,   194,   194,   194,   194,   194,   194,   194,
-     194,    50,   194,    39,    92,   143,   194,    39,    49,    92,
-     194,     5,   194,   194,    39,    49,    92,    50,    44,    39,
-     194,     5,   194,   194,    92,    50,    44,    39,    30,    39,
-      50,    51,   194,   194,   194,    30,   194,   194,    28,    92,
-      50,    39,    45,    30,    39,    39,    30,    45,   194,   194,
-     194,   194,   194,   194,   194,   194,   194,   194,   194,   194,
-       5,   194,    51,   194,     5,   194,    30,   194,    39,    30,
-      39,   194,   194,   194,   194,   194,    28,   194,   194,    30,
-     194,   194,   194,   172,   172,   194,   194,    92,    48,    30,
-      49,    30,    50,    44,    42,    39,    42,    30,    43,    92,
-      92,    39,   194,    51,    30,    39,    42,    50,    44,    31,
-      92,   136,   175,   174,    43,    48,    48,   149,    42,   152,
-     153,   152,   153,   203,    45,    27,    42,    50,    92,    29,
-      44,    31,    49,    49,    52,    50,    48,   148,   186,   176,
-     176,   161,   176,   159,   176,   186,   143,   176,   150,    48,
-     152,    44,   194,   144,   176,    44,    50,   186,   165,   182,
-     185,   164,   164,    44,    50,    45,    92,    29,    44,   186,
-       8,     9,    32,    33,   162,   163,   170,   176,   181,   186,
-     157,   182,   156,   182,    45,    92,    29,    44,    31,    92,
-      48,    43,   148,   149,   136,    28,   159,   150,    30,    45,
-      92,    44,    92,    48,    45,    92,   136,   137,   176,   138,
-     186,   136,    29,    44,   142,   211,   212,   139,   176,   140,
-     176,   210,   141,   186,   136,   146,   169,   169,   162,   186,
-      30,   161,   162,   186,   154,    45,    42,    92,   150,   150,
-     150,   150,   150,    48,   182,   182,    92,   182,   152,   182,
-     159,   159,    45,    92,    42,    50,    92,    92,    29,    92,
-      44,    42,    31,    92,    52,    28,    92,   148,    43,    27,
-      48,    49,    31,    39,   194,    45,    30,    49,    30,   194,
-     194,   194,   194,    51,    42,    49,    48,    39,    49,    46,
-      49,    31,    50,    45,    30,    28,   194,   194,   194,   194,
-     194,    51,   194,    49,   144,    49,    48,     5,    49,    48,
-      51,    39,    46,     5,   183,   186,   194,   183,     6,    51,
-      39,    46,    49,    31,    39,    51,    30,   194,   194,    50,
-     194,    51,    39,    46,    28,    26,    92,    39,   194,    30,
-      45,   194,     5,   194,     5,    92,    28,   194,   194,   194,
-     194,   194,    39,    46,   194,   194,    51,    31,    92,    48,
-      43,    39,    92,    39,    46,    49,    26,    31,    28,    45,
-      45,    29,   194,    30,    30,    51,    50,    30,    44,   139,
-      29,    28,    39,    92,   152,   149,   152,   153,    50,    30,
-      51,    44,    51,    50,    30,    48,    39,    49,    30,   128,
-     186,   186,   128,   144,    43,   149,    50,   194,    50,    51,
-     165,    50,    51,    50,    44,    51,   162,    32,   186,   194,
-      33,   163,    50,    44,    51,    50,    30,    44,    43,    44,
-     148,   139,   160,   176,    50,    44,    51,    45,    28,    45,
-      44,   137,    31,    44,   139,   162,     8,     9,   147,   171,
-     172,    44,   162,   211,    45,    45,   137,   159,   145,   146,
-     156,    46,    26,   135,   160,    50,    39,    28,    39,    43,
-      51,    39,    44,    28,    39,    44,    51,    50,    44,    30,
-      45,    39,    51,    26,   176,    44,    43,    48,    28,    46,
-      26,    51,    52,    26,   194,    46,    92,    43,    49,    50,
-      48,    28,    30,    28,    44,    30,    48,   151,    48,    43,
-      48,    43,    46,    49,    50,    46,    49,    50,    48,    28,
-      46,    30,    50,    46,    49,    50,    48,    50,    51,    46,
-      26,    30,   194,   172,   172,     7,    51,    44,   194,   194,
-      50,    50,   194,    46,    42,    45,    44,    39,    43,    29,
-      49,    45,    44,    31,    50,    48,    30,    28,    51,    28,
-      44,    50,   194,    50,    30,    51,    50,    51,    42,    48,
-      30,    49,   152,    51,    26,    30,    43,    30,    50,    92,
-      51,    50,    26,    30,    50,    44,    51,   194,    51,    30,
-      51,    30,    51,    50,    92,    51,    50,    92,    51,    50,
-      51,    44,    51,    50,    92,    48,    50,    51,    51,   140,
-       7,     7,   172,    50,    50,   137,   160,    39,    38,   135,
-      51,    42,    51,    31,    29,    30,    39,    50,    51,    31,
-      45,    92,    51,    45,    50,    44,    30,    50,    26,   176,
-      49,    44,    43,    92,    50,    49,    92,    50,    51,    31,
-      44,    39,    44,    26,    29,    46,    43,    92,    43,    92,
+      26,    42,    30,    43,    31,    48,   148,    27,    46,   129,
+     322,   323,   148,   148,   148,   151,   176,   186,   186,   176,
+     176,   158,   135,   176,   135,   136,   176,   176,   186,   142,
+      42,   142,   186,   176,   148,   153,   153,   153,   153,   176,
+      49,   227,   152,    92,    44,   194,   143,   176,    92,    44,
+      44,   164,   186,   153,   164,   153,    92,    44,   153,   153,
+     153,   153,    45,    28,    30,    92,   128,   186,   152,   168,
+     128,   145,   176,   150,   176,    45,    28,    30,    92,    92,
+      29,   148,   153,   153,    49,   152,    48,   149,   176,   152,
+     148,   148,    31,   159,   176,   136,   148,    48,   153,    45,
+      28,    92,    42,    50,    28,    50,   169,   169,   169,    29,
+      29,    50,    42,   148,   148,   148,   148,   148,   148,   148,
+     148,   148,   148,   148,   148,   186,   176,    42,   135,   186,
+     176,    43,   142,    29,    52,    29,   148,   148,   148,   148,
+     148,    49,   153,   153,    42,   153,   152,   153,     7,     7,
+     172,   136,   136,    45,    30,    44,    44,    28,    28,    30,
+      26,    92,    30,    92,    26,    42,    30,    29,   186,   148,
+      48,    38,    27,    48,    30,    49,    39,    30,    39,   194,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,   175,   174,    34,   184,    34,    50,    92,    51,
+     194,    39,   194,   194,   194,   194,    92,    26,    30,    49,
+      50,    30,    44,    39,    30,    48,    43,    92,    49,    30,
+      45,    30,    55,    30,   194,   194,   194,   194,   194,   194,
+     194,   194,   194,   194,   194,    50,   194,    39,    92,   143,
+     194,    39,    49,    92,   194,     5,   194,   194,    39,    49,
+      92,    50,    44,    39,   194,     5,   194,   194,    92,    50,
+      44,    39,    30,    39,    50,    51,   194,   194,   194,    30,
+     194,   194,    28,    92,    50,    39,    45,    30,    39,    39,
+      30,    45,   194,   194,   194,   194,   194,   194,   194,   194,
+     194,   194,   194,   194,     5,   194,    51,   194,     5,   194,
+      30,   194,    39,    30,    39,   194,   194,   194,   194,   194,
+      28,   194,   194,    30,   194,   194,   194,   172,   172,   194,
+     194,    92,    48,    30,    49,    30,    50,    44,    42,    39,
+      42,    30,    43,    92,    92,    39,   194,    51,    30,    39,
+      42,    50,    44,    31,    92,   136,   175,   174,    43,    48,
+      48,   149,    42,   152,   153,   152,   153,   203,    45,    27,
+      42,    50,    92,    29,    44,    31,    49,    49,    52,    26,
+      50,    48,   148,   186,   176,   176,   161,   176,   159,   176,
+     186,   143,   176,   150,    48,   152,    44,   194,   144,   176,
+      44,    50,   186,   165,   182,   185,   164,   164,    44,    50,
+      45,    92,    29,    44,   186,     8,     9,    32,    33,   162,
+     163,   170,   176,   181,   186,   157,   182,   156,   182,    45,
+      92,    29,    44,    31,    92,    48,    43,   148,   149,   136,
+      28,   159,   150,    30,    45,    92,    44,    92,    48,    45,
+      92,   136,   137,   176,   138,   186,   136,    29,    44,   142,
+     211,   212,   139,   176,   140,   176,   210,   141,   186,   136,
+     146,   169,   169,   162,   186,    30,   161,   162,   186,   154,
+      45,    42,    92,   150,   150,   150,   150,   150,    48,   182,
+     182,    92,   182,   152,   182,   159,   159,    45,    92,    42,
+      50,    92,    92,    29,    92,    44,    42,    31,    92,    52,
+      28,    92,   148,    43,    27,    48,    49,    31,    39,   194,
+      45,    30,    49,    30,   194,   194,   194,   194,    51,    42,
+      49,    48,    39,    49,    46,    49,    31,    50,    45,    43,
+      30,    28,   194,   194,   194,   194,   194,    51,   194,    49,
+     144,    49,    48,     5,    49,    48,    51,    39,    46,     5,
+     183,   186,   194,   183,     6,    51,    39,    46,    49,    31,
+      39,    51,    30,   194,   194,    50,   194,    51,    39,    46,
+      28,    26,    92,    39,   194,    30,    45,   194,     5,   194,
+       5,    92,    28,   194,   194,   194,   194,   194,    39,    46,
+     194,   194,    51,    31,    92,    48,    43,    39,    92,    39,
+      46,    49,    26,    31,    28,    45,    45,    29,   194,    30,
+      30,    51,    50,    30,    44,   139,    29,    28,    39,    92,
+     152,   149,   152,   153,    50,    30,    51,    44,    51,    50,
+      30,    48,    39,    92,    49,    30,   128,   186,   186,   128,
+     144,    43,   149,    50,   194,    50,    51,   165,    50,    51,
+      50,    44,    51,   162,    32,   186,   194,    33,   163,    50,
+      44,    51,    50,    30,    44,    43,    44,   148,   139,   160,
+     176,    50,    44,    51,    45,    28,    45,    44,   137,    31,
+      44,   139,   162,     8,     9,   147,   171,   172,    44,   162,
+     211,    45,    45,   137,   159,   145,   146,   156,    46,    26,
+     135,   160,    50,    39,    28,    39,    43,    51,    39,    44,
+      28,    39,    44,    51,    50,    44,    30,    45,    39,    51,
+      26,   176,    44,    43,    48,    28,    46,    26,    51,    52,
+      26,   194,    46,    92,    43,    49,    50,    48,    28,    30,
+      28,    49,    44,    30,    48,   151,    48,    43,    48,    43,
+      46,    49,    50,    46,    49,    50,    48,    28,    46,    30,
+      50,    46,    49,    50,    48,    50,    51,    46,    26,    30,
+     194,   172,   172,     7,    51,    44,   194,   194,    50,    50,
+     194,    46,    42,    45,    44,    39,    43,    29,    49,    45,
+      44,    31,    50,    48,    30,    28,    51,    28,    44,    50,
+     194,    50,    30,    51,    50,    51,    42,    48,    30,    49,
+     152,    51,    26,    30,    43,    30,    50,    92,    51,    50,
+      26,    30,    50,    50,    44,    51,   194,    51,    30,    51,
+      30,    51,    50,    92,    51,    50,    92,    51,    50,    51,
+      44,    51,    50,    92,    48,    50,    51,    51,   140,     7,
+       7,   172,    50,    50,   137,   160,    39,    38,   135,    51,
+      42,    51,    31,    29,    30,    39,    50,    51,    31,    45,
+      92,    51,    45,    50,    44,    30,    50,    26,   176,    49,
+      44,    43,    92,    50,    49,    92,    50,    51,    31,    44,
+      39,    44,    26,    29,    46,    43,    92,    43,    92,    26,
       26,    50,    43,   152,    43,    44,    43,    44,    50,    26,
       29,    50,    26,    29,    43,    92,    50,    50,    50,    26,
       29,    46,    30,    46,    50,    42,   172,   172,    46,    48,
       45,    50,    44,    45,    39,    44,    26,    44,    45,    29,
       43,    51,    92,    50,    92,    92,    50,    30,    28,    39,
       29,    92,    29,    31,    37,    29,    50,    44,    30,    48,
-      45,    30,    28,    92,    28,    37,    49,    30,   194,    30,
-      50,    30,    50,    92,    44,    30,    92,    44,    30,    30,
-      28,    49,    92,    44,    30,    45,    28,    51,    92,    50,
-      51,    45,    44,    92,    50,    50,    44,    50,    30,    30,
-      49,    28,    28,    29,    49,    92,    44,    38,    52,    39,
-      28,    29,    39,    30,    39,    39,    49,    92,    28,    52,
-      39,    48,    44,    38,    28,    45,    30,    44,   149,    44,
-      92,    44,    29,    28,    52,    29,    28,    52,    44,    38,
-      28,    29,    28,    52,    48,    50,    50,    28,    46,    50,
-      50,    42,    29,    49,    92,    28,    52,    44,    38,    45,
-      27,    29,    50,    26,    30,    48,    38,    30,    48,    45,
-      28,    44,    92,    92,    29,    30,    39,    52,    50,    50,
-      26,    45,    51,    50,   194,    50,    29,    50,    30,    30,
-      39,    30,    30,    39,    50,    26,    38,    30,    30,    39,
-      50,    92,    38,    45,    55,    92,    42,    30,    92,    28,
-      29,    39,    30,    39,    50,    26,    51,    39,    92,    39,
-      26,    52,    39,    92,    50,    30,    39,    40,    39,    49,
-      92,    28,    30,    92,    49,    92,    39,    51,    44,   146,
-      39,    92,    52,    28,    52,    28,    92,    39,    26,    52,
-      28,    28,    50,    26,    48,    46,    30,    52,    40,    45,
-      39,    44,    92,    28,    92,    39,    44,    48,    43,    44,
-      44,    39,    52,    45,    49,    49,    44,    45,    48,    39,
-      30,    48,    46,    43,    44,    44,    50,   194,    48,    31,
-      39,    30,    39,    30,    43,    44,    44,    39,    30,    38,
-      55,    44,    50,    30,    48,    39,    45,    51,    48,    31,
-      28,    39,    30,    28,    39,    43,    44,    50,    30,    26,
-      44,    28,    30,    51,    46,    27,    30,    44,    49,    92,
-      26,    26,    49,    50,    92,    45,    46,   134,   155,   182,
-     262,   263,   264,    30,    39,    28,    28,    26,    44,    28,
-      92,    26,    46,    44,    28,    27,    44,    30,    45,    45,
-      44,    92,    45,    44,    26,    92,    28,    46,    30,    30,
-      48,    50,    51,    28,    46,    46,    48,    46,    43,    44,
-      30,   194,    28,    42,    30,    30,    46,    30,    30,    46,
-      44,    30,    30,    30,    92,    50,    28,    51,    31,    28,
-      39,    51,    31,    46,    28,    39,    50,    42,    49,    92,
-      46,    50,    50,    51,    26,    26,    49,    26,    92,    48,
-     155,    50,    30,    42,    92,    26,    44,    42,    92,    39,
-      50,    44,    45,    45,    44,    44,    45,    92,    45,    44,
-      45,    92,    46,    51,    92,    45,    50,    48,    43,    54,
-      29,    49,    45,    49,    46,    48,    30,    28,    39,    44,
-      45,    50,    51,    31,    50,    28,    39,    51,    31,    48,
-      46,    26,    50,    29,    48,    92,    26,    30,    30,    39,
-      48,    26,    26,    42,    45,    44,    31,    48,    44,    45,
-      45,    44,    44,    45,    55,    26,    48,    92,    48,    39,
-      28,    43,    50,    43,    49,    48,    43,    51,    31,    45,
-      55,    50,    51,    31,    50,    48,    26,    29,    39,    30,
-      45,    30,    30,    26,    50,    26,    30,    44,    45,    92,
-      44,    45,    26,    43,    48,    52,    49,    44,    50,    48,
-      44,    30,    43,    50,    50,    28,    39,    50,    43,    30,
-      39,    30,    50,    30,    29,    44,    30,    30,    45,    44,
-      30,    50,    52,    48,    48,    48,    92,    50,    50,    48,
-      51,    31,    50,    30,    30,    49,    45,    38,    30,    44,
-      45,    30,    48,    48,    42,    45,    48,    50,    48,    49,
-      42,    29
+      45,    30,    28,    92,    28,    50,    37,    49,    30,   194,
+      30,    50,    30,    50,    92,    44,    30,    92,    44,    30,
+      30,    28,    49,    92,    44,    30,    45,    28,    51,    92,
+      50,    51,    45,    44,    92,    50,    50,    44,    50,    30,
+      30,    49,    28,    28,    29,    49,    92,    44,    38,    52,
+      39,    28,    29,    39,    30,    39,    39,    49,    92,    28,
+      52,    39,    48,    44,    38,    28,    45,    49,    30,    44,
+     149,    44,    92,    44,    29,    28,    52,    29,    28,    52,
+      44,    38,    28,    29,    28,    52,    48,    50,    50,    28,
+      46,    50,    50,    42,    29,    49,    92,    28,    52,    44,
+      38,    45,    27,    29,    50,    26,    30,    48,    38,    30,
+      48,    45,    28,    44,    92,    92,    29,    30,    39,    52,
+      50,    50,    26,    45,    51,    50,   194,    50,    29,    50,
+      30,    30,    39,    30,    30,    39,    50,    26,    38,    30,
+      30,    39,    50,    92,    38,    45,    55,    92,    42,    30,
+      92,    28,    29,    39,    30,    39,    50,    26,    51,    39,
+      92,    39,    26,    52,    39,    92,    50,    30,    39,    40,
+      39,    49,    92,    28,    30,    92,    49,    92,    39,    51,
+      44,   146,    39,    92,    52,    28,    52,    28,    92,    39,
+      26,    52,    28,    28,    50,    26,    48,    46,    30,    52,
+      40,    45,    39,    44,    92,    28,    92,    39,    44,    48,
+      43,    44,    44,    39,    52,    45,    49,    49,    44,    45,
+      48,    39,    30,    48,    46,    43,    44,    44,    50,   194,
+      48,    31,    39,    30,    39,    30,    43,    44,    44,    39,
+      30,    38,    55,    44,    50,    30,    48,    39,    45,    51,
+      48,    31,    28,    39,    30,    28,    39,    43,    44,    50,
+      30,    26,    44,    28,    30,    51,    46,    27,    30,    44,
+      49,    92,    26,    26,    49,    50,    92,    45,    46,   134,
+     155,   182,   263,   264,   265,    30,    39,    28,    28,    26,
+      44,    28,    92,    26,    46,    44,    28,    27,    44,    30,
+      45,    45,    44,    92,    45,    44,    26,    92,    28,    46,
+      30,    30,    48,    50,    51,    28,    46,    46,    48,    46,
+      43,    44,    30,   194,    28,    42,    30,    30,    46,    30,
+      30,    46,    44,    30,    30,    30,    92,    50,    28,    51,
+      31,    28,    39,    51,    31,    46,    28,    39,    50,    42,
+      49,    92,    46,    50,    50,    51,    26,    26,    49,    26,
+      92,    48,   155,    50,    30,    42,    92,    26,    44,    42,
+      92,    39,    50,    44,    45,    45,    44,    44,    45,    92,
+      45,    44,    45,    92,    46,    51,    92,    45,    50,    48,
+      43,    54,    29,    49,    45,    49,    46,    48,    30,    28,
+      39,    44,    45,    50,    51,    31,    50,    28,    39,    51,
+      31,    48,    46,    26,    50,    29,    48,    92,    26,    30,
+      30,    39,    48,    26,    26,    42,    45,    44,    31,    48,
+      44,    45,    45,    44,    44,    45,    55,    26,    48,    92,
+      48,    39,    28,    43,    50,    43,    49,    48,    43,    51,
+      31,    45,    55,    50,    51,    31,    50,    48,    26,    29,
+      39,    30,    45,    30,    30,    26,    50,    26,    30,    44,
+      45,    92,    44,    45,    26,    43,    48,    52,    49,    44,
+      50,    48,    44,    30,    43,    50,    50,    28,    39,    50,
+      43,    30,    39,    30,    50,    30,    29,    44,    30,    30,
+      45,    44,    30,    50,    52,    48,    48,    48,    92,    50,
+      50,    48,    51,    31,    50,    30,    30,    49,    45,    38,
+      30,    44,    45,    30,    48,    48,    42,    45,    48,    50,
+      48,    49,    42,    29
 };
 
   /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
@@ -2632,70 +2649,71 @@ static const yytype_uint16 yyr1[] =
        0,   100,   101,   101,   102,   102,   103,   103,   103,   104,
      104,   104,   104,   104,   105,   105,   105,   105,   105,   105,
      105,   105,   105,   105,   105,   105,   105,   105,   105,   105,
-     105,   105,   105,   105,   105,   105,   105,   105,   106,   106,
+     105,   105,   105,   105,   105,   105,   105,   105,   105,   105,
      106,   106,   106,   106,   106,   106,   106,   106,   106,   106,
-     106,   106,   106,   107,   107,   107,   107,   107,   107,   107,
+     106,   106,   106,   106,   106,   107,   107,   107,   107,   107,
      107,   107,   107,   107,   107,   107,   107,   107,   107,   107,
      107,   107,   107,   107,   107,   107,   107,   107,   107,   107,
-     107,   107,   107,   108,   108,   108,   108,   108,   108,   108,
+     107,   107,   107,   107,   107,   108,   108,   108,   108,   108,
      108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
      108,   108,   108,   108,   108,   108,   108,   108,   108,   108,
-     108,   108,   108,   109,   109,   109,   109,   110,   111,   111,
+     108,   108,   108,   108,   108,   109,   109,   109,   109,   110,
      111,   111,   111,   111,   111,   111,   111,   111,   111,   111,
+     111,   111,   112,   112,   112,   112,   112,   112,   112,   112,
      112,   112,   112,   112,   112,   112,   112,   112,   112,   112,
      112,   112,   112,   112,   112,   112,   112,   112,   112,   112,
      112,   112,   112,   112,   112,   112,   112,   112,   112,   112,
      112,   112,   112,   112,   112,   112,   112,   112,   112,   112,
-     112,   112,   112,   112,   112,   112,   112,   112,   112,   112,
-     112,   112,   112,   113,   113,   113,   113,   113,   113,   113,
+     112,   112,   112,   112,   112,   112,   113,   113,   113,   113,
+     113,   113,   113,   113,   113,   113,   113,   113,   113,   113,
      113,   113,   113,   113,   113,   113,   113,   113,   113,   113,
-     113,   113,   113,   113,   113,   113,   113,   113,   114,   114,
-     114,   114,   114,   114,   114,   114,   115,   116,   116,   117,
-     117,   117,   117,   117,   118,   118,   119,   119,   120,   120,
-     120,   120,   121,   121,   122,   123,   124,   124,   124,   124,
+     113,   114,   114,   114,   114,   114,   114,   114,   114,   115,
+     116,   116,   117,   117,   117,   117,   117,   118,   118,   119,
+     119,   120,   120,   120,   120,   121,   121,   122,   123,   124,
      124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
-     125,   126,   127,   127,   128,   128,   129,   129,   130,   130,
+     124,   124,   124,   125,   126,   127,   127,   128,   128,   129,
+     129,   130,   130,   130,   130,   130,   130,   130,   130,   130,
      130,   130,   130,   130,   130,   130,   130,   130,   130,   130,
-     130,   130,   130,   130,   130,   130,   130,   131,   132,   132,
-     133,   134,   134,   134,   135,   136,   137,   138,   139,   140,
-     140,   141,   142,   143,   144,   145,   146,   146,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,   161,   162,   162,   163,   163,   163,   163,   164,
-     164,   165,   165,   166,   166,   166,   167,   168,   169,   169,
-     170,   170,   170,   171,   171,   171,   171,   171,   171,   172,
-     172,   173,   173,   173,   173,   173,   173,   173,   173,   173,
-     173,   174,   174,   174,   174,   174,   174,   174,   174,   175,
-     175,   175,   175,   175,   175,   175,   175,   175,   175,   175,
+     131,   132,   132,   133,   134,   134,   134,   135,   136,   137,
+     138,   139,   140,   140,   141,   142,   143,   144,   145,   146,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   162,   163,   163,
+     163,   163,   164,   164,   165,   165,   166,   166,   166,   167,
+     168,   169,   169,   170,   170,   170,   171,   171,   171,   171,
+     171,   171,   172,   172,   173,   173,   173,   173,   173,   173,
+     173,   173,   173,   173,   174,   174,   174,   174,   174,   174,
+     174,   174,   175,   175,   175,   175,   175,   175,   175,   175,
      175,   175,   175,   175,   175,   175,   175,   175,   175,   175,
-     175,   176,   176,   176,   176,   176,   176,   176,   176,   176,
-     176,   177,   177,   178,   179,   179,   180,   180,   180,   181,
-     181,   182,   182,   183,   183,   183,   183,   184,   184,   184,
-     184,   185,   185,   185,   185,   186,   186,   187,   187,   187,
-     187,   188,   188,   188,   189,   189,   189,   189,   189,   189,
+     175,   175,   175,   175,   176,   176,   176,   176,   176,   176,
+     176,   176,   176,   176,   177,   177,   178,   179,   179,   180,
+     180,   180,   181,   181,   182,   182,   183,   183,   183,   183,
+     184,   184,   184,   184,   185,   185,   185,   185,   186,   186,
+     187,   187,   187,   187,   188,   188,   188,   189,   189,   189,
      189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
      189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
      189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
      189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
-     189,   189,   189,   189,   189,   189,   190,   190,   190,   190,
+     189,   189,   189,   189,   189,   189,   189,   189,   189,   190,
      190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
      190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
      190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
-     190,   190,   190,   190,   190,   191,   191,   191,   191,   191,
-     191,   191,   191,   191,   191,   191,   192,   192,   192,   193,
-     193,   194,   195,   196,   197,   198,   199,   200,   201,   202,
-     203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
-     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
-     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
-     263,   264,   265,   266,   267,   268,   269,   270,   271,   272,
-     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
-     283,   284,   285,   286,   287,   288,   289,   290,   291,   292,
-     293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
-     303,   304,   305,   306,   307,   308,   309,   310,   311,   312,
-     313,   314,   315,   316,   317,   318,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,   328,   329,   330,   331,   332
+     190,   190,   190,   190,   190,   190,   190,   190,   191,   191,
+     191,   191,   191,   191,   191,   191,   191,   191,   191,   192,
+     192,   192,   193,   193,   194,   195,   196,   197,   198,   199,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   223,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
+     290,   291,   292,   293,   294,   295,   296,   297,   298,   299,
+     300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
+     310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336
 };
 
   /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
@@ -2704,46 +2722,46 @@ static const yytype_uint8 yyr2[] =
        0,     2,     1,     1,     2,     3,     0,     1,     1,     1,
        2,     2,     2,     2,     3,     3,     3,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     1,     1,     1,     7,
-       9,     3,     9,    11,     7,     9,     7,     9,     5,     7,
-       1,     3,     3,     1,     1,     1,     1,     1,     1,     1,
+       3,     3,     3,     3,     3,     3,     1,     3,     3,     1,
+       1,     7,     9,     3,     9,    11,     7,     9,     7,     9,
+       5,     7,     1,     3,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,    16,    18,    18,    20,     7,     3,     5,
-       7,     9,     3,     3,     5,     9,     7,     5,     3,     3,
-       1,     1,     1,     5,     5,     7,     3,     7,     1,     5,
-       7,     9,     1,     5,     7,     9,     1,     1,     5,     5,
-       7,     9,     7,     9,     1,     5,     7,     5,     5,     5,
-       3,     1,     1,     1,     3,     3,     9,     1,     5,     3,
-       7,     5,     3,     5,     5,     3,     5,     5,     1,     1,
-       1,     5,     9,     7,     9,     7,     9,     9,     9,     3,
-       7,     9,    11,     9,     9,    11,     7,     7,     7,     7,
-       7,     3,     5,     5,     5,     3,     3,     3,     5,     3,
-       5,     3,     5,     7,     3,     7,     3,     3,     3,     7,
-       5,     7,     5,     3,     5,     5,     5,     5,     3,     3,
-       5,     3,     3,     3,     9,    11,     5,     7,     5,     9,
-       5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
-       5,     1,     0,     2,     3,     5,     1,     1,     1,     1,
-       1,     5,     1,     1,     1,     3,     1,     1,     3,     3,
-       1,     3,     5,     3,     5,     3,     5,    11,     5,     7,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,    16,    18,    18,    20,     7,
+       3,     5,     7,     9,     3,     3,     5,     9,     7,     5,
+       3,     3,     1,     1,     1,     5,     5,     7,     3,     7,
+       1,     5,     7,     9,     1,     5,     7,     9,     1,     1,
+       5,     5,     7,     9,     7,     9,     1,     5,     7,     5,
+       5,     5,     5,     3,     1,     1,     1,     3,     3,     9,
+       1,     5,     3,     7,     5,     3,     5,     5,     3,     5,
+       5,     1,     1,     1,     5,     9,     7,     9,     7,     9,
+       9,     9,     3,     7,     9,    11,     9,     9,    11,     7,
+       7,     7,     7,     7,     3,     5,     5,     5,     3,     3,
+       3,     5,     3,     5,     3,     5,     7,     3,     7,     3,
+       3,     3,     7,     5,     7,     5,     3,     5,     5,     5,
+       5,     3,     3,     5,     3,     3,     3,     9,    11,     5,
+       7,     5,     9,     5,     5,     5,     5,     5,     5,     5,
+       5,     5,     5,     5,     1,     0,     2,     3,     5,     1,
+       1,     1,     1,     1,     5,     1,     1,     1,     3,     1,
+       1,     3,     3,     1,     3,     5,     3,     5,     3,     5,
+      11,     5,     7,     3,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     3,     1,     1,     1,     1,     3,
-       5,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       3,     4,     4,     3,     4,     4,     1,     2,     2,     1,
-       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     3,     1,     1,
+       1,     1,     3,     5,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     3,     4,     4,     3,     4,     4,     1,
+       2,     2,     1,     2,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     3,     3,     2,     1,     3,     0,     2,     2,     3,
-       3,     3,     3,     1,     1,     2,     2,     1,     1,     2,
-       2,     1,     1,     2,     2,     1,     2,     1,     1,     2,
-       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     3,     3,     2,     1,     3,     0,
+       2,     2,     3,     3,     3,     3,     1,     1,     2,     2,
+       1,     1,     2,     2,     1,     1,     2,     2,     1,     2,
+       1,     1,     2,     2,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
@@ -2752,22 +2770,23 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     1,     1,     2,     3,     4,     3,
-       4,     1,     1,     1,     3,     3,     3,     5,     5,     4,
-      11,     4,     4,     6,     7,     4,     4,     3,     4,     7,
-       9,     6,     3,     5,     8,    12,     6,     6,     9,    11,
-       7,    17,    30,     8,     4,    25,    24,    23,    22,    25,
-      24,    21,    20,    29,    28,    19,    18,    19,    23,    13,
-      12,    11,    12,    13,    12,    11,    12,    11,    18,    17,
-      21,    11,    21,    20,    23,    22,    10,    11,     6,     9,
-      14,    10,    29,    20,    19,    29,    19,    30,    20,    17,
-      17,     6,    15,    16,    29,    17,    18,    28,    27,    25,
-      18,    17,    27,    15,    16,    19,    20,    17,    15,    18,
-      15,    10,    11,    15,     4,     7,     8,    23,    25,    14,
-      13,    18,    14,    11,     5,     4,     9,    13,     4,     9,
-       6,     6,     5,     5,     4,     4,     6,     7,     5,    10,
-       4,     4,     6,     9,     5,    13,     4,     4,     3,     4
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     1,     1,     2,
+       3,     4,     3,     4,     1,     1,     1,     3,     3,     3,
+       5,     5,     4,    11,     4,     4,     6,     7,     4,     4,
+       3,     4,     7,     9,     6,     3,     5,     8,    12,     6,
+       6,     9,    11,     7,    17,    30,     8,     4,    25,    24,
+      23,    22,    25,    24,    21,    20,    29,    28,    19,    18,
+      19,    23,    13,    12,    11,    12,    13,    12,    11,    12,
+      12,    11,    18,    17,    21,    11,    21,    20,    23,    22,
+      10,    11,     6,     9,    14,    10,    29,    20,    19,    29,
+      19,    30,    20,    17,    17,     6,    15,    16,    29,    17,
+      18,    28,    27,    25,    18,    17,    27,    15,    16,    19,
+      20,    17,    15,    18,    15,    10,    11,    15,     4,     7,
+       8,    23,    25,    14,    13,    18,    14,    11,     5,     4,
+       9,    13,     4,     9,     6,     6,     5,     5,     4,     4,
+       6,     7,     5,    10,     4,     4,     6,     9,     5,    13,
+       4,     4,     3,     4,     5,     3,     5
 };
 
 
@@ -3285,7 +3304,7 @@ YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
     p->ppStackTop    = &yyssp;
 }
 
-#line 3289 "y.tab.c" /* yacc.c:1431  */
+#line 3308 "y.tab.c" /* yacc.c:1431  */
   goto yysetstate;
 
 
@@ -3471,1673 +3490,1691 @@ yyreduce:
         case 2:
 #line 227 "lscp.y" /* yacc.c:1652  */
     { INCREMENT_LINE; if (!(yyvsp[0].String).empty()) LSCPSERVER->AnswerClient((yyvsp[0].String)); return LSCP_DONE; }
-#line 3475 "y.tab.c" /* yacc.c:1652  */
+#line 3494 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 3:
 #line 228 "lscp.y" /* yacc.c:1652  */
     { INCREMENT_LINE; LSCPSERVER->AnswerClient("ERR:0:" + sLastError + "\r\n"); RESTART; return LSCP_SYNTAX_ERROR; }
-#line 3481 "y.tab.c" /* yacc.c:1652  */
+#line 3500 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 4:
 #line 231 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[-1].String); }
-#line 3487 "y.tab.c" /* yacc.c:1652  */
+#line 3506 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 5:
 #line 232 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[-2].String); }
-#line 3493 "y.tab.c" /* yacc.c:1652  */
+#line 3512 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 6:
 #line 235 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = ""; }
-#line 3499 "y.tab.c" /* yacc.c:1652  */
+#line 3518 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 7:
 #line 236 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = ""; }
-#line 3505 "y.tab.c" /* yacc.c:1652  */
+#line 3524 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 14:
 #line 247 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3511 "y.tab.c" /* yacc.c:1652  */
+#line 3530 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 15:
 #line 248 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3517 "y.tab.c" /* yacc.c:1652  */
+#line 3536 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 16:
 #line 249 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3523 "y.tab.c" /* yacc.c:1652  */
+#line 3542 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 17:
 #line 250 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3529 "y.tab.c" /* yacc.c:1652  */
+#line 3548 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 18:
 #line 251 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3535 "y.tab.c" /* yacc.c:1652  */
+#line 3554 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 19:
 #line 252 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3541 "y.tab.c" /* yacc.c:1652  */
+#line 3560 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 20:
 #line 253 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3547 "y.tab.c" /* yacc.c:1652  */
+#line 3566 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 21:
 #line 254 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3553 "y.tab.c" /* yacc.c:1652  */
+#line 3572 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 22:
 #line 255 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3559 "y.tab.c" /* yacc.c:1652  */
+#line 3578 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 23:
 #line 256 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3565 "y.tab.c" /* yacc.c:1652  */
+#line 3584 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 24:
 #line 257 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3571 "y.tab.c" /* yacc.c:1652  */
+#line 3590 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 25:
 #line 258 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3577 "y.tab.c" /* yacc.c:1652  */
+#line 3596 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 26:
 #line 259 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3583 "y.tab.c" /* yacc.c:1652  */
+#line 3602 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 27:
 #line 260 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3589 "y.tab.c" /* yacc.c:1652  */
+#line 3608 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 28:
 #line 261 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3595 "y.tab.c" /* yacc.c:1652  */
+#line 3614 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 29:
 #line 262 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3601 "y.tab.c" /* yacc.c:1652  */
+#line 3620 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 30:
 #line 263 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3607 "y.tab.c" /* yacc.c:1652  */
+#line 3626 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 31:
 #line 264 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3613 "y.tab.c" /* yacc.c:1652  */
+#line 3632 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 32:
 #line 265 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3619 "y.tab.c" /* yacc.c:1652  */
+#line 3638 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 33:
 #line 266 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3625 "y.tab.c" /* yacc.c:1652  */
+#line 3644 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 34:
 #line 267 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3631 "y.tab.c" /* yacc.c:1652  */
+#line 3650 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 35:
 #line 268 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].String);                                                }
-#line 3637 "y.tab.c" /* yacc.c:1652  */
+#line 3656 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 36:
 #line 269 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = LSCPSERVER->ResetSampler();                        }
-#line 3643 "y.tab.c" /* yacc.c:1652  */
+#line 3662 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 37:
 #line 270 "lscp.y" /* yacc.c:1652  */
-    { LSCPSERVER->AnswerClient("Bye!\r\n"); return LSCP_QUIT; }
-#line 3649 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->BeginBatch((yyparse_param_t*) yyparse_param); }
+#line 3668 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 38:
-#line 273 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddChannel();                  }
-#line 3655 "y.tab.c" /* yacc.c:1652  */
+#line 271 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->EndBatch((yyparse_param_t*) yyparse_param); }
+#line 3674 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 39:
-#line 274 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddChannelMidiInput((yyvsp[-2].Number),(yyvsp[0].Number));    }
-#line 3661 "y.tab.c" /* yacc.c:1652  */
+#line 272 "lscp.y" /* yacc.c:1652  */
+    { LSCPSERVER->AnswerClient("Bye!\r\n"); return LSCP_QUIT; }
+#line 3680 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 40:
 #line 275 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddChannelMidiInput((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
-#line 3667 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddChannel();                  }
+#line 3686 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 41:
 #line 276 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddDbInstrumentDirectory((yyvsp[0].String));  }
-#line 3673 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddChannelMidiInput((yyvsp[-2].Number),(yyvsp[0].Number));    }
+#line 3692 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 42:
 #line 277 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-4].String),(yyvsp[-2].String),(yyvsp[0].String), true);        }
-#line 3679 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddChannelMidiInput((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
+#line 3698 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 43:
 #line 278 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-6].String),(yyvsp[-2].String),(yyvsp[0].String), true, true); }
-#line 3685 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddDbInstrumentDirectory((yyvsp[0].String));  }
+#line 3704 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 44:
 #line 279 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-4].String),(yyvsp[-2].String),(yyvsp[0].String));              }
-#line 3691 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-4].String),(yyvsp[-2].String),(yyvsp[0].String), true);        }
+#line 3710 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 45:
 #line 280 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-6].String),(yyvsp[-2].String),(yyvsp[0].String), false, true); }
-#line 3697 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-6].String),(yyvsp[-2].String),(yyvsp[0].String), true, true); }
+#line 3716 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 46:
 #line 281 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-2].String),(yyvsp[0].String), -1, true);       }
-#line 3703 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-4].String),(yyvsp[-2].String),(yyvsp[0].String));              }
+#line 3722 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 47:
 #line 282 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-4].String),(yyvsp[-2].String),(yyvsp[0].Number), true);        }
-#line 3709 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-6].String),(yyvsp[-2].String),(yyvsp[0].String), false, true); }
+#line 3728 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 48:
 #line 283 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-2].String),(yyvsp[0].String));                 }
-#line 3715 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-2].String),(yyvsp[0].String), -1, true);       }
+#line 3734 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 49:
 #line 284 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-4].String),(yyvsp[-2].String),(yyvsp[0].Number));              }
-#line 3721 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-4].String),(yyvsp[-2].String),(yyvsp[0].Number), true);        }
+#line 3740 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 50:
 #line 285 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddMidiInstrumentMap();                }
-#line 3727 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-2].String),(yyvsp[0].String));                 }
+#line 3746 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 51:
 #line 286 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddMidiInstrumentMap((yyvsp[0].String));              }
-#line 3733 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddDbInstruments((yyvsp[-4].String),(yyvsp[-2].String),(yyvsp[0].Number));              }
+#line 3752 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 52:
 #line 287 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddSendEffectChain((yyvsp[0].Number));                }
-#line 3739 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddMidiInstrumentMap();                }
+#line 3758 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 53:
-#line 290 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_audio_device_count);   }
-#line 3745 "y.tab.c" /* yacc.c:1652  */
+#line 288 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddMidiInstrumentMap((yyvsp[0].String));              }
+#line 3764 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 54:
-#line 291 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_audio_device_info);    }
-#line 3751 "y.tab.c" /* yacc.c:1652  */
+#line 289 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddSendEffectChain((yyvsp[0].Number));                }
+#line 3770 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 55:
 #line 292 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_midi_device_count);    }
-#line 3757 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_audio_device_count);   }
+#line 3776 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 56:
 #line 293 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_midi_device_info);     }
-#line 3763 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_audio_device_info);    }
+#line 3782 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 57:
 #line 294 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_channel_count);        }
-#line 3769 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_midi_device_count);    }
+#line 3788 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 58:
 #line 295 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_channel_midi);         }
-#line 3775 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_midi_device_info);     }
+#line 3794 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 59:
 #line 296 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_device_midi);          }
-#line 3781 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_channel_count);        }
+#line 3800 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 60:
 #line 297 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_voice_count);          }
-#line 3787 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_channel_midi);         }
+#line 3806 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 61:
 #line 298 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_stream_count);         }
-#line 3793 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_device_midi);          }
+#line 3812 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 62:
 #line 299 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_buffer_fill);          }
-#line 3799 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_voice_count);          }
+#line 3818 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 63:
 #line 300 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_channel_info);         }
-#line 3805 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_stream_count);         }
+#line 3824 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 64:
 #line 301 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_fx_send_count);        }
-#line 3811 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_buffer_fill);          }
+#line 3830 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 65:
 #line 302 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_fx_send_info);         }
-#line 3817 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_channel_info);         }
+#line 3836 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 66:
 #line 303 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_midi_instr_map_count); }
-#line 3823 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_fx_send_count);        }
+#line 3842 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 67:
 #line 304 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_midi_instr_map_info);  }
-#line 3829 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_fx_send_info);         }
+#line 3848 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 68:
 #line 305 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_midi_instr_count);     }
-#line 3835 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_midi_instr_map_count); }
+#line 3854 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 69:
 #line 306 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_midi_instr_info);      }
-#line 3841 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_midi_instr_map_info);  }
+#line 3860 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 70:
 #line 307 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_db_instr_dir_count);   }
-#line 3847 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_midi_instr_count);     }
+#line 3866 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 71:
 #line 308 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_db_instr_dir_info);    }
-#line 3853 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_midi_instr_info);      }
+#line 3872 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 72:
 #line 309 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_db_instr_count);       }
-#line 3859 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_db_instr_dir_count);   }
+#line 3878 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 73:
 #line 310 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_db_instr_info);        }
-#line 3865 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_db_instr_dir_info);    }
+#line 3884 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 74:
 #line 311 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_db_instrs_job_info);   }
-#line 3871 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_db_instr_count);       }
+#line 3890 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 75:
 #line 312 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_misc);                 }
-#line 3877 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_db_instr_info);        }
+#line 3896 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 76:
 #line 313 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_total_stream_count);   }
-#line 3883 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_db_instrs_job_info);   }
+#line 3902 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 77:
 #line 314 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_total_voice_count);    }
-#line 3889 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_misc);                 }
+#line 3908 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 78:
 #line 315 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_global_info);          }
-#line 3895 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_total_stream_count);   }
+#line 3914 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 79:
 #line 316 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_fx_instance_count);    }
-#line 3901 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_total_voice_count);    }
+#line 3920 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 80:
 #line 317 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_fx_instance_info);     }
-#line 3907 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_global_info);          }
+#line 3926 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 81:
 #line 318 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_send_fx_chain_count);  }
-#line 3913 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_fx_instance_count);    }
+#line 3932 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 82:
 #line 319 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_send_fx_chain_info);   }
-#line 3919 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_fx_instance_info);     }
+#line 3938 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 83:
-#line 322 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_audio_device_count);   }
-#line 3925 "y.tab.c" /* yacc.c:1652  */
+#line 320 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_send_fx_chain_count);  }
+#line 3944 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 84:
-#line 323 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_audio_device_info);    }
-#line 3931 "y.tab.c" /* yacc.c:1652  */
+#line 321 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SubscribeNotification(LSCPEvent::event_send_fx_chain_info);   }
+#line 3950 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 85:
 #line 324 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_midi_device_count);    }
-#line 3937 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_audio_device_count);   }
+#line 3956 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 86:
 #line 325 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_midi_device_info);     }
-#line 3943 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_audio_device_info);    }
+#line 3962 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 87:
 #line 326 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_channel_count);        }
-#line 3949 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_midi_device_count);    }
+#line 3968 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 88:
 #line 327 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_channel_midi);         }
-#line 3955 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_midi_device_info);     }
+#line 3974 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 89:
 #line 328 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_device_midi);          }
-#line 3961 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_channel_count);        }
+#line 3980 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 90:
 #line 329 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_voice_count);          }
-#line 3967 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_channel_midi);         }
+#line 3986 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 91:
 #line 330 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_stream_count);         }
-#line 3973 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_device_midi);          }
+#line 3992 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 92:
 #line 331 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_buffer_fill);          }
-#line 3979 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_voice_count);          }
+#line 3998 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 93:
 #line 332 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_channel_info);         }
-#line 3985 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_stream_count);         }
+#line 4004 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 94:
 #line 333 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_fx_send_count);        }
-#line 3991 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_buffer_fill);          }
+#line 4010 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 95:
 #line 334 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_fx_send_info);         }
-#line 3997 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_channel_info);         }
+#line 4016 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 96:
 #line 335 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_midi_instr_map_count); }
-#line 4003 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_fx_send_count);        }
+#line 4022 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 97:
 #line 336 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_midi_instr_map_info);  }
-#line 4009 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_fx_send_info);         }
+#line 4028 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 98:
 #line 337 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_midi_instr_count);     }
-#line 4015 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_midi_instr_map_count); }
+#line 4034 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 99:
 #line 338 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_midi_instr_info);      }
-#line 4021 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_midi_instr_map_info);  }
+#line 4040 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 100:
 #line 339 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_db_instr_dir_count);   }
-#line 4027 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_midi_instr_count);     }
+#line 4046 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 101:
 #line 340 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_db_instr_dir_info);    }
-#line 4033 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_midi_instr_info);      }
+#line 4052 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 102:
 #line 341 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_db_instr_count);       }
-#line 4039 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_db_instr_dir_count);   }
+#line 4058 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 103:
 #line 342 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_db_instr_info);        }
-#line 4045 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_db_instr_dir_info);    }
+#line 4064 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 104:
 #line 343 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_db_instrs_job_info);   }
-#line 4051 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_db_instr_count);       }
+#line 4070 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 105:
 #line 344 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_misc);                 }
-#line 4057 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_db_instr_info);        }
+#line 4076 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 106:
 #line 345 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_total_stream_count);   }
-#line 4063 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_db_instrs_job_info);   }
+#line 4082 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 107:
 #line 346 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_total_voice_count);    }
-#line 4069 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_misc);                 }
+#line 4088 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 108:
 #line 347 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_global_info);          }
-#line 4075 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_total_stream_count);   }
+#line 4094 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 109:
 #line 348 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_fx_instance_count);    }
-#line 4081 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_total_voice_count);    }
+#line 4100 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 110:
 #line 349 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_fx_instance_info);     }
-#line 4087 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_global_info);          }
+#line 4106 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 111:
 #line 350 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_send_fx_chain_count);  }
-#line 4093 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_fx_instance_count);    }
+#line 4112 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 112:
 #line 351 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_send_fx_chain_info);   }
-#line 4099 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_fx_instance_info);     }
+#line 4118 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 113:
-#line 354 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddOrReplaceMIDIInstrumentMapping((yyvsp[-12].Number),(yyvsp[-10].Number),(yyvsp[-8].Number),(yyvsp[-6].String),(yyvsp[-4].String),(yyvsp[-2].Number),(yyvsp[0].Dotnum),MidiInstrumentMapper::DONTCARE,"",(yyvsp[-13].Bool)); }
-#line 4105 "y.tab.c" /* yacc.c:1652  */
+#line 352 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_send_fx_chain_count);  }
+#line 4124 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 114:
-#line 355 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddOrReplaceMIDIInstrumentMapping((yyvsp[-14].Number),(yyvsp[-12].Number),(yyvsp[-10].Number),(yyvsp[-8].String),(yyvsp[-6].String),(yyvsp[-4].Number),(yyvsp[-2].Dotnum),(yyvsp[0].LoadMode),"",(yyvsp[-15].Bool)); }
-#line 4111 "y.tab.c" /* yacc.c:1652  */
+#line 353 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->UnsubscribeNotification(LSCPEvent::event_send_fx_chain_info);   }
+#line 4130 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 115:
 #line 356 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddOrReplaceMIDIInstrumentMapping((yyvsp[-14].Number),(yyvsp[-12].Number),(yyvsp[-10].Number),(yyvsp[-8].String),(yyvsp[-6].String),(yyvsp[-4].Number),(yyvsp[-2].Dotnum),MidiInstrumentMapper::DONTCARE,(yyvsp[0].String),(yyvsp[-15].Bool)); }
-#line 4117 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddOrReplaceMIDIInstrumentMapping((yyvsp[-12].Number),(yyvsp[-10].Number),(yyvsp[-8].Number),(yyvsp[-6].String),(yyvsp[-4].String),(yyvsp[-2].Number),(yyvsp[0].Dotnum),MidiInstrumentMapper::DONTCARE,"",(yyvsp[-13].Bool)); }
+#line 4136 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 116:
 #line 357 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AddOrReplaceMIDIInstrumentMapping((yyvsp[-16].Number),(yyvsp[-14].Number),(yyvsp[-12].Number),(yyvsp[-10].String),(yyvsp[-8].String),(yyvsp[-6].Number),(yyvsp[-4].Dotnum),(yyvsp[-2].LoadMode),(yyvsp[0].String),(yyvsp[-17].Bool)); }
-#line 4123 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddOrReplaceMIDIInstrumentMapping((yyvsp[-14].Number),(yyvsp[-12].Number),(yyvsp[-10].Number),(yyvsp[-8].String),(yyvsp[-6].String),(yyvsp[-4].Number),(yyvsp[-2].Dotnum),(yyvsp[0].LoadMode),"",(yyvsp[-15].Bool)); }
+#line 4142 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 117:
-#line 360 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->RemoveMIDIInstrumentMapping((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
-#line 4129 "y.tab.c" /* yacc.c:1652  */
+#line 358 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddOrReplaceMIDIInstrumentMapping((yyvsp[-14].Number),(yyvsp[-12].Number),(yyvsp[-10].Number),(yyvsp[-8].String),(yyvsp[-6].String),(yyvsp[-4].Number),(yyvsp[-2].Dotnum),MidiInstrumentMapper::DONTCARE,(yyvsp[0].String),(yyvsp[-15].Bool)); }
+#line 4148 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 118:
-#line 363 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->RemoveChannel((yyvsp[0].Number));                      }
-#line 4135 "y.tab.c" /* yacc.c:1652  */
+#line 359 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AddOrReplaceMIDIInstrumentMapping((yyvsp[-16].Number),(yyvsp[-14].Number),(yyvsp[-12].Number),(yyvsp[-10].String),(yyvsp[-8].String),(yyvsp[-6].Number),(yyvsp[-4].Dotnum),(yyvsp[-2].LoadMode),(yyvsp[0].String),(yyvsp[-17].Bool)); }
+#line 4154 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 119:
-#line 364 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->RemoveChannelMidiInput((yyvsp[0].Number));       }
-#line 4141 "y.tab.c" /* yacc.c:1652  */
+#line 362 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->RemoveMIDIInstrumentMapping((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
+#line 4160 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 120:
 #line 365 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->RemoveChannelMidiInput((yyvsp[-2].Number),(yyvsp[0].Number));    }
-#line 4147 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->RemoveChannel((yyvsp[0].Number));                      }
+#line 4166 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 121:
 #line 366 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->RemoveChannelMidiInput((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
-#line 4153 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->RemoveChannelMidiInput((yyvsp[0].Number));       }
+#line 4172 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 122:
 #line 367 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->RemoveMidiInstrumentMap((yyvsp[0].Number));            }
-#line 4159 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->RemoveChannelMidiInput((yyvsp[-2].Number),(yyvsp[0].Number));    }
+#line 4178 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 123:
 #line 368 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->RemoveAllMidiInstrumentMaps();          }
-#line 4165 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->RemoveChannelMidiInput((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
+#line 4184 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 124:
 #line 369 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->RemoveSendEffectChain((yyvsp[-2].Number),(yyvsp[0].Number));     }
-#line 4171 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->RemoveMidiInstrumentMap((yyvsp[0].Number));            }
+#line 4190 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 125:
 #line 370 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->RemoveSendEffectChainEffect((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
-#line 4177 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->RemoveAllMidiInstrumentMaps();          }
+#line 4196 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 126:
 #line 371 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetFxSendEffect((yyvsp[-2].Number),(yyvsp[0].Number),-1,-1);    }
-#line 4183 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->RemoveSendEffectChain((yyvsp[-2].Number),(yyvsp[0].Number));     }
+#line 4202 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 127:
 #line 372 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->RemoveDbInstrumentDirectory((yyvsp[0].String), true);  }
-#line 4189 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->RemoveSendEffectChainEffect((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
+#line 4208 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 128:
 #line 373 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->RemoveDbInstrumentDirectory((yyvsp[0].String));        }
-#line 4195 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetFxSendEffect((yyvsp[-2].Number),(yyvsp[0].Number),-1,-1);    }
+#line 4214 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 129:
 #line 374 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->RemoveDbInstrument((yyvsp[0].String));                 }
-#line 4201 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->RemoveDbInstrumentDirectory((yyvsp[0].String), true);  }
+#line 4220 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 130:
-#line 377 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAvailableEngines();                          }
-#line 4207 "y.tab.c" /* yacc.c:1652  */
+#line 375 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->RemoveDbInstrumentDirectory((yyvsp[0].String));        }
+#line 4226 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 131:
-#line 378 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAvailableEffects();                          }
-#line 4213 "y.tab.c" /* yacc.c:1652  */
+#line 376 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->RemoveDbInstrument((yyvsp[0].String));                 }
+#line 4232 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 132:
 #line 379 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetEffectInstances();                           }
-#line 4219 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAvailableEngines();                          }
+#line 4238 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 133:
 #line 380 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetEffectInfo((yyvsp[0].Number));                              }
-#line 4225 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAvailableEffects();                          }
+#line 4244 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 134:
 #line 381 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetEffectInstanceInfo((yyvsp[0].Number));                      }
-#line 4231 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetEffectInstances();                           }
+#line 4250 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 135:
 #line 382 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetEffectInstanceInputControlInfo((yyvsp[-2].Number),(yyvsp[0].Number));       }
-#line 4237 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetEffectInfo((yyvsp[0].Number));                              }
+#line 4256 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 136:
 #line 383 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetSendEffectChains((yyvsp[0].Number));                        }
-#line 4243 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetEffectInstanceInfo((yyvsp[0].Number));                      }
+#line 4262 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 137:
 #line 384 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetSendEffectChainInfo((yyvsp[-2].Number),(yyvsp[0].Number));                  }
-#line 4249 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetEffectInstanceInputControlInfo((yyvsp[-2].Number),(yyvsp[0].Number));       }
+#line 4268 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 138:
 #line 385 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAvailableMidiInputDrivers();                 }
-#line 4255 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetSendEffectChains((yyvsp[0].Number));                        }
+#line 4274 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 139:
 #line 386 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetMidiInputDriverInfo((yyvsp[0].String));                     }
-#line 4261 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetSendEffectChainInfo((yyvsp[-2].Number),(yyvsp[0].Number));                  }
+#line 4280 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 140:
 #line 387 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetMidiInputDriverParameterInfo((yyvsp[-2].String), (yyvsp[0].String));        }
-#line 4267 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAvailableMidiInputDrivers();                 }
+#line 4286 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 141:
 #line 388 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetMidiInputDriverParameterInfo((yyvsp[-4].String), (yyvsp[-2].String), (yyvsp[0].KeyValList));    }
-#line 4273 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetMidiInputDriverInfo((yyvsp[0].String));                     }
+#line 4292 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 142:
 #line 389 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAvailableAudioOutputDrivers();               }
-#line 4279 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetMidiInputDriverParameterInfo((yyvsp[-2].String), (yyvsp[0].String));        }
+#line 4298 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 143:
 #line 390 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAudioOutputDriverInfo((yyvsp[0].String));                   }
-#line 4285 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetMidiInputDriverParameterInfo((yyvsp[-4].String), (yyvsp[-2].String), (yyvsp[0].KeyValList));    }
+#line 4304 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 144:
 #line 391 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAudioOutputDriverParameterInfo((yyvsp[-2].String), (yyvsp[0].String));      }
-#line 4291 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAvailableAudioOutputDrivers();               }
+#line 4310 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 145:
 #line 392 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAudioOutputDriverParameterInfo((yyvsp[-4].String), (yyvsp[-2].String), (yyvsp[0].KeyValList));  }
-#line 4297 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAudioOutputDriverInfo((yyvsp[0].String));                   }
+#line 4316 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 146:
 #line 393 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAudioOutputDeviceCount();                    }
-#line 4303 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAudioOutputDriverParameterInfo((yyvsp[-2].String), (yyvsp[0].String));      }
+#line 4322 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 147:
 #line 394 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetMidiInputDeviceCount();                      }
-#line 4309 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAudioOutputDriverParameterInfo((yyvsp[-4].String), (yyvsp[-2].String), (yyvsp[0].KeyValList));  }
+#line 4328 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 148:
 #line 395 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAudioOutputDeviceInfo((yyvsp[0].Number));                   }
-#line 4315 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAudioOutputDeviceCount();                    }
+#line 4334 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 149:
 #line 396 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetMidiInputDeviceInfo((yyvsp[0].Number));                     }
-#line 4321 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetMidiInputDeviceCount();                      }
+#line 4340 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 150:
 #line 397 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetMidiInputPortInfo((yyvsp[-2].Number), (yyvsp[0].Number));                   }
-#line 4327 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAudioOutputDeviceInfo((yyvsp[0].Number));                   }
+#line 4346 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 151:
 #line 398 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetMidiInputPortParameterInfo((yyvsp[-4].Number), (yyvsp[-2].Number), (yyvsp[0].String));      }
-#line 4333 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetMidiInputDeviceInfo((yyvsp[0].Number));                     }
+#line 4352 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 152:
 #line 399 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAudioOutputChannelInfo((yyvsp[-2].Number), (yyvsp[0].Number));              }
-#line 4339 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetMidiInputPortInfo((yyvsp[-2].Number), (yyvsp[0].Number));                   }
+#line 4358 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 153:
 #line 400 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAudioOutputChannelParameterInfo((yyvsp[-4].Number), (yyvsp[-2].Number), (yyvsp[0].String)); }
-#line 4345 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetMidiInputPortParameterInfo((yyvsp[-4].Number), (yyvsp[-2].Number), (yyvsp[0].String));      }
+#line 4364 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 154:
 #line 401 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetChannels();                                  }
-#line 4351 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAudioOutputChannelInfo((yyvsp[-2].Number), (yyvsp[0].Number));              }
+#line 4370 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 155:
 #line 402 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetChannelInfo((yyvsp[0].Number));                             }
-#line 4357 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAudioOutputChannelParameterInfo((yyvsp[-4].Number), (yyvsp[-2].Number), (yyvsp[0].String)); }
+#line 4376 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 156:
 #line 403 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetBufferFill((yyvsp[-2].FillResponse), (yyvsp[0].Number));                          }
-#line 4363 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetChannels();                                  }
+#line 4382 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 157:
 #line 404 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetStreamCount((yyvsp[0].Number));                             }
-#line 4369 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetChannelInfo((yyvsp[0].Number));                             }
+#line 4388 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 158:
 #line 405 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetVoiceCount((yyvsp[0].Number));                              }
-#line 4375 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetBufferFill((yyvsp[-2].FillResponse), (yyvsp[0].Number));                          }
+#line 4394 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 159:
 #line 406 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetEngineInfo((yyvsp[0].String));                              }
-#line 4381 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetStreamCount((yyvsp[0].Number));                             }
+#line 4400 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 160:
 #line 407 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetServerInfo();                                }
-#line 4387 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetStreamStats((yyvsp[0].Number));                             }
+#line 4406 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 161:
 #line 408 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetTotalStreamCount();                           }
-#line 4393 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetVoiceCount((yyvsp[0].Number));                              }
+#line 4412 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 162:
 #line 409 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetTotalVoiceCount();                           }
-#line 4399 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetEngineInfo((yyvsp[0].String));                              }
+#line 4418 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 163:
 #line 410 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetTotalVoiceCountMax();                        }
-#line 4405 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetServerInfo();                                }
+#line 4424 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 164:
 #line 411 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetMidiInstrumentMappings((yyvsp[0].Number));                  }
-#line 4411 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetTotalStreamCount();                           }
+#line 4430 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 165:
 #line 412 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAllMidiInstrumentMappings();                 }
-#line 4417 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetTotalVoiceCount();                           }
+#line 4436 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 166:
 #line 413 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetMidiInstrumentMapping((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number));             }
-#line 4423 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetTotalVoiceCountMax();                        }
+#line 4442 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 167:
 #line 414 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetMidiInstrumentMaps();                        }
-#line 4429 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetMidiInstrumentMappings((yyvsp[0].Number));                  }
+#line 4448 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 168:
 #line 415 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetMidiInstrumentMap((yyvsp[0].Number));                       }
-#line 4435 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAllMidiInstrumentMappings();                 }
+#line 4454 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 169:
 #line 416 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetFxSends((yyvsp[0].Number));                                 }
-#line 4441 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetMidiInstrumentMapping((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number));             }
+#line 4460 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 170:
 #line 417 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetFxSendInfo((yyvsp[-2].Number),(yyvsp[0].Number));                           }
-#line 4447 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetMidiInstrumentMaps();                        }
+#line 4466 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 171:
 #line 418 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetDbInstrumentDirectoryCount((yyvsp[0].String), true);        }
-#line 4453 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetMidiInstrumentMap((yyvsp[0].Number));                       }
+#line 4472 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 172:
 #line 419 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetDbInstrumentDirectoryCount((yyvsp[0].String), false);       }
-#line 4459 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetFxSends((yyvsp[0].Number));                                 }
+#line 4478 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 173:
 #line 420 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetDbInstrumentDirectoryInfo((yyvsp[0].String));               }
-#line 4465 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetFxSendInfo((yyvsp[-2].Number),(yyvsp[0].Number));                           }
+#line 4484 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 174:
 #line 421 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetDbInstrumentCount((yyvsp[0].String), true);                 }
-#line 4471 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetDbInstrumentDirectoryCount((yyvsp[0].String), true);        }
+#line 4490 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 175:
 #line 422 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetDbInstrumentCount((yyvsp[0].String), false);                }
-#line 4477 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetDbInstrumentDirectoryCount((yyvsp[0].String), false);       }
+#line 4496 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 176:
 #line 423 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetDbInstrumentInfo((yyvsp[0].String));                        }
-#line 4483 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetDbInstrumentDirectoryInfo((yyvsp[0].String));               }
+#line 4502 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 177:
 #line 424 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetDbInstrumentsJobInfo((yyvsp[0].Number));                    }
-#line 4489 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetDbInstrumentCount((yyvsp[0].String), true);                 }
+#line 4508 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 178:
 #line 425 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetGlobalVolume();                              }
-#line 4495 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetDbInstrumentCount((yyvsp[0].String), false);                }
+#line 4514 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 179:
 #line 426 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetGlobalMaxVoices();                           }
-#line 4501 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetDbInstrumentInfo((yyvsp[0].String));                        }
+#line 4520 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 180:
 #line 427 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetGlobalMaxStreams();                          }
-#line 4507 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetDbInstrumentsJobInfo((yyvsp[0].Number));                    }
+#line 4526 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 181:
 #line 428 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetFileInstruments((yyvsp[0].String));                         }
-#line 4513 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetGlobalVolume();                              }
+#line 4532 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 182:
 #line 429 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetFileInstrumentInfo((yyvsp[-2].String),(yyvsp[0].Number));                   }
-#line 4519 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetGlobalMaxVoices();                           }
+#line 4538 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 183:
-#line 432 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetAudioOutputDeviceParameter((yyvsp[-4].Number), (yyvsp[-2].String), (yyvsp[0].String));      }
-#line 4525 "y.tab.c" /* yacc.c:1652  */
+#line 430 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetGlobalMaxStreams();                          }
+#line 4544 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 184:
-#line 433 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetAudioOutputChannelParameter((yyvsp[-6].Number), (yyvsp[-4].Number), (yyvsp[-2].String), (yyvsp[0].String)); }
-#line 4531 "y.tab.c" /* yacc.c:1652  */
+#line 431 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetFileInstruments((yyvsp[0].String));                         }
+#line 4550 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 185:
-#line 434 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetMidiInputDeviceParameter((yyvsp[-4].Number), (yyvsp[-2].String), (yyvsp[0].String));        }
-#line 4537 "y.tab.c" /* yacc.c:1652  */
+#line 432 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetFileInstrumentInfo((yyvsp[-2].String),(yyvsp[0].Number));                   }
+#line 4556 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 186:
 #line 435 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetMidiInputPortParameter((yyvsp[-6].Number), (yyvsp[-4].Number), (yyvsp[-2].String), "");      }
-#line 4543 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetAudioOutputDeviceParameter((yyvsp[-4].Number), (yyvsp[-2].String), (yyvsp[0].String));      }
+#line 4562 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 187:
 #line 436 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetMidiInputPortParameter((yyvsp[-6].Number), (yyvsp[-4].Number), (yyvsp[-2].String), (yyvsp[0].String));      }
-#line 4549 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetAudioOutputChannelParameter((yyvsp[-6].Number), (yyvsp[-4].Number), (yyvsp[-2].String), (yyvsp[0].String)); }
+#line 4568 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 188:
 #line 437 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetEffectInstanceInputControlValue((yyvsp[-4].Number), (yyvsp[-2].Number), (yyvsp[0].Dotnum)); }
-#line 4555 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetMidiInputDeviceParameter((yyvsp[-4].Number), (yyvsp[-2].String), (yyvsp[0].String));        }
+#line 4574 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 189:
 #line 438 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[0].String);                                                         }
-#line 4561 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetMidiInputPortParameter((yyvsp[-6].Number), (yyvsp[-4].Number), (yyvsp[-2].String), "");      }
+#line 4580 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 190:
 #line 439 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetMidiInstrumentMapName((yyvsp[-2].Number), (yyvsp[0].String));               }
-#line 4567 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetMidiInputPortParameter((yyvsp[-6].Number), (yyvsp[-4].Number), (yyvsp[-2].String), (yyvsp[0].String));      }
+#line 4586 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 191:
 #line 440 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetFxSendName((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].String));                        }
-#line 4573 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetEffectInstanceInputControlValue((yyvsp[-4].Number), (yyvsp[-2].Number), (yyvsp[0].Dotnum)); }
+#line 4592 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 192:
 #line 441 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetFxSendAudioOutputChannel((yyvsp[-6].Number),(yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
-#line 4579 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[0].String);                                                         }
+#line 4598 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 193:
 #line 442 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetFxSendMidiController((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number));              }
-#line 4585 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetMidiInstrumentMapName((yyvsp[-2].Number), (yyvsp[0].String));               }
+#line 4604 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 194:
 #line 443 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetFxSendLevel((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Dotnum));                       }
-#line 4591 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetFxSendName((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].String));                        }
+#line 4610 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 195:
 #line 444 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetFxSendEffect((yyvsp[-6].Number),(yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number));                  }
-#line 4597 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetFxSendAudioOutputChannel((yyvsp[-6].Number),(yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
+#line 4616 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 196:
 #line 445 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetDbInstrumentDirectoryName((yyvsp[-2].String),(yyvsp[0].String));            }
-#line 4603 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetFxSendMidiController((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number));              }
+#line 4622 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 197:
 #line 446 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetDbInstrumentDirectoryDescription((yyvsp[-2].String),(yyvsp[0].String));     }
-#line 4609 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetFxSendLevel((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Dotnum));                       }
+#line 4628 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 198:
 #line 447 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetDbInstrumentName((yyvsp[-2].String),(yyvsp[0].String));                     }
-#line 4615 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetFxSendEffect((yyvsp[-6].Number),(yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number));                  }
+#line 4634 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 199:
 #line 448 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetDbInstrumentDescription((yyvsp[-2].String),(yyvsp[0].String));              }
-#line 4621 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetDbInstrumentDirectoryName((yyvsp[-2].String),(yyvsp[0].String));            }
+#line 4640 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 200:
 #line 449 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetDbInstrumentFilePath((yyvsp[-2].String),(yyvsp[0].String));                 }
-#line 4627 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetDbInstrumentDirectoryDescription((yyvsp[-2].String),(yyvsp[0].String));     }
+#line 4646 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 201:
 #line 450 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetEcho((yyparse_param_t*) yyparse_param, (yyvsp[0].Dotnum));  }
-#line 4633 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetDbInstrumentName((yyvsp[-2].String),(yyvsp[0].String));                     }
+#line 4652 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 202:
 #line 451 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetShellInteract((yyparse_param_t*) yyparse_param, (yyvsp[0].Dotnum)); }
-#line 4639 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetDbInstrumentDescription((yyvsp[-2].String),(yyvsp[0].String));              }
+#line 4658 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 203:
 #line 452 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetShellAutoCorrect((yyparse_param_t*) yyparse_param, (yyvsp[0].Dotnum)); }
-#line 4645 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetDbInstrumentFilePath((yyvsp[-2].String),(yyvsp[0].String));                 }
+#line 4664 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 204:
 #line 453 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetShellDoc((yyparse_param_t*) yyparse_param, (yyvsp[0].Dotnum)); }
-#line 4651 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetEcho((yyparse_param_t*) yyparse_param, (yyvsp[0].Dotnum));  }
+#line 4670 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 205:
 #line 454 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetGlobalVolume((yyvsp[0].Dotnum));                            }
-#line 4657 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetShellInteract((yyparse_param_t*) yyparse_param, (yyvsp[0].Dotnum)); }
+#line 4676 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 206:
 #line 455 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetGlobalMaxVoices((yyvsp[0].Number));                         }
-#line 4663 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetShellAutoCorrect((yyparse_param_t*) yyparse_param, (yyvsp[0].Dotnum)); }
+#line 4682 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 207:
 #line 456 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetGlobalMaxStreams((yyvsp[0].Number));                        }
-#line 4669 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetShellDoc((yyparse_param_t*) yyparse_param, (yyvsp[0].Dotnum)); }
+#line 4688 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 208:
-#line 459 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->CreateAudioOutputDevice((yyvsp[-2].String),(yyvsp[0].KeyValList)); }
-#line 4675 "y.tab.c" /* yacc.c:1652  */
+#line 457 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetGlobalVolume((yyvsp[0].Dotnum));                            }
+#line 4694 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 209:
-#line 460 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->CreateAudioOutputDevice((yyvsp[0].String));    }
-#line 4681 "y.tab.c" /* yacc.c:1652  */
+#line 458 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetGlobalMaxVoices((yyvsp[0].Number));                         }
+#line 4700 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 210:
-#line 461 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->CreateMidiInputDevice((yyvsp[-2].String),(yyvsp[0].KeyValList));   }
-#line 4687 "y.tab.c" /* yacc.c:1652  */
+#line 459 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetGlobalMaxStreams((yyvsp[0].Number));                        }
+#line 4706 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 211:
 #line 462 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->CreateMidiInputDevice((yyvsp[0].String));      }
-#line 4693 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->CreateAudioOutputDevice((yyvsp[-2].String),(yyvsp[0].KeyValList)); }
+#line 4712 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 212:
 #line 463 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->CreateFxSend((yyvsp[-2].Number),(yyvsp[0].Number));            }
-#line 4699 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->CreateAudioOutputDevice((yyvsp[0].String));    }
+#line 4718 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 213:
 #line 464 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->CreateFxSend((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].String)); }
-#line 4705 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->CreateMidiInputDevice((yyvsp[-2].String),(yyvsp[0].KeyValList));   }
+#line 4724 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 214:
 #line 465 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->CreateEffectInstance((yyvsp[0].Number));       }
-#line 4711 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->CreateMidiInputDevice((yyvsp[0].String));      }
+#line 4730 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 215:
 #line 466 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->CreateEffectInstance((yyvsp[-4].String),(yyvsp[-2].String),(yyvsp[0].String)); }
-#line 4717 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->CreateFxSend((yyvsp[-2].Number),(yyvsp[0].Number));            }
+#line 4736 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 216:
-#line 469 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ResetChannel((yyvsp[0].Number)); }
-#line 4723 "y.tab.c" /* yacc.c:1652  */
+#line 467 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->CreateFxSend((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].String)); }
+#line 4742 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 217:
-#line 472 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ClearMidiInstrumentMappings((yyvsp[0].Number));  }
-#line 4729 "y.tab.c" /* yacc.c:1652  */
+#line 468 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->CreateEffectInstance((yyvsp[0].Number));       }
+#line 4748 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 218:
-#line 473 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ClearAllMidiInstrumentMappings(); }
-#line 4735 "y.tab.c" /* yacc.c:1652  */
+#line 469 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->CreateEffectInstance((yyvsp[-4].String),(yyvsp[-2].String),(yyvsp[0].String)); }
+#line 4754 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 219:
-#line 476 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->FindDbInstruments((yyvsp[-2].String),(yyvsp[0].KeyValList), false);           }
-#line 4741 "y.tab.c" /* yacc.c:1652  */
+#line 472 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ResetChannel((yyvsp[0].Number)); }
+#line 4760 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 220:
-#line 477 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->FindDbInstruments((yyvsp[-2].String),(yyvsp[0].KeyValList), true);            }
-#line 4747 "y.tab.c" /* yacc.c:1652  */
+#line 475 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ClearMidiInstrumentMappings((yyvsp[0].Number));  }
+#line 4766 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 221:
-#line 478 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->FindDbInstrumentDirectories((yyvsp[-2].String),(yyvsp[0].KeyValList), false); }
-#line 4753 "y.tab.c" /* yacc.c:1652  */
+#line 476 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ClearAllMidiInstrumentMappings(); }
+#line 4772 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 222:
 #line 479 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->FindDbInstrumentDirectories((yyvsp[-2].String),(yyvsp[0].KeyValList), true);  }
-#line 4759 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->FindDbInstruments((yyvsp[-2].String),(yyvsp[0].KeyValList), false);           }
+#line 4778 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 223:
 #line 480 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->FindLostDbInstrumentFiles();                 }
-#line 4765 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->FindDbInstruments((yyvsp[-2].String),(yyvsp[0].KeyValList), true);            }
+#line 4784 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 224:
-#line 483 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->MoveDbInstrumentDirectory((yyvsp[-2].String),(yyvsp[0].String)); }
-#line 4771 "y.tab.c" /* yacc.c:1652  */
+#line 481 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->FindDbInstrumentDirectories((yyvsp[-2].String),(yyvsp[0].KeyValList), false); }
+#line 4790 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 225:
-#line 484 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->MoveDbInstrument((yyvsp[-2].String),(yyvsp[0].String));          }
-#line 4777 "y.tab.c" /* yacc.c:1652  */
+#line 482 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->FindDbInstrumentDirectories((yyvsp[-2].String),(yyvsp[0].KeyValList), true);  }
+#line 4796 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 226:
-#line 487 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->CopyDbInstrumentDirectory((yyvsp[-2].String),(yyvsp[0].String)); }
-#line 4783 "y.tab.c" /* yacc.c:1652  */
+#line 483 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->FindLostDbInstrumentFiles();                 }
+#line 4802 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 227:
-#line 488 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->CopyDbInstrument((yyvsp[-2].String),(yyvsp[0].String));          }
-#line 4789 "y.tab.c" /* yacc.c:1652  */
+#line 486 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->MoveDbInstrumentDirectory((yyvsp[-2].String),(yyvsp[0].String)); }
+#line 4808 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 228:
-#line 491 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->DestroyAudioOutputDevice((yyvsp[0].Number)); }
-#line 4795 "y.tab.c" /* yacc.c:1652  */
+#line 487 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->MoveDbInstrument((yyvsp[-2].String),(yyvsp[0].String));          }
+#line 4814 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 229:
-#line 492 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->DestroyMidiInputDevice((yyvsp[0].Number));   }
-#line 4801 "y.tab.c" /* yacc.c:1652  */
+#line 490 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->CopyDbInstrumentDirectory((yyvsp[-2].String),(yyvsp[0].String)); }
+#line 4820 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 230:
-#line 493 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->DestroyFxSend((yyvsp[-2].Number),(yyvsp[0].Number)); }
-#line 4807 "y.tab.c" /* yacc.c:1652  */
+#line 491 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->CopyDbInstrument((yyvsp[-2].String),(yyvsp[0].String));          }
+#line 4826 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 231:
 #line 494 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->DestroyEffectInstance((yyvsp[0].Number));    }
-#line 4813 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->DestroyAudioOutputDevice((yyvsp[0].Number)); }
+#line 4832 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 232:
-#line 497 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[0].String); }
-#line 4819 "y.tab.c" /* yacc.c:1652  */
+#line 495 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->DestroyMidiInputDevice((yyvsp[0].Number));   }
+#line 4838 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 233:
-#line 498 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[0].String); }
-#line 4825 "y.tab.c" /* yacc.c:1652  */
+#line 496 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->DestroyFxSend((yyvsp[-2].Number),(yyvsp[0].Number)); }
+#line 4844 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 234:
-#line 501 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->AppendSendEffectChainEffect((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
-#line 4831 "y.tab.c" /* yacc.c:1652  */
+#line 497 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->DestroyEffectInstance((yyvsp[0].Number));    }
+#line 4850 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 235:
-#line 504 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->InsertSendEffectChainEffect((yyvsp[-6].Number),(yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
-#line 4837 "y.tab.c" /* yacc.c:1652  */
+#line 500 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[0].String); }
+#line 4856 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 236:
-#line 507 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetAudioOutputDevice((yyvsp[0].Number), (yyvsp[-2].Number));      }
-#line 4843 "y.tab.c" /* yacc.c:1652  */
+#line 501 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[0].String); }
+#line 4862 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 237:
-#line 508 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetAudioOutputChannel((yyvsp[-2].Number), (yyvsp[0].Number), (yyvsp[-4].Number)); }
-#line 4849 "y.tab.c" /* yacc.c:1652  */
+#line 504 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->AppendSendEffectChainEffect((yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
+#line 4868 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 238:
-#line 509 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetAudioOutputType((yyvsp[0].String), (yyvsp[-2].Number));        }
-#line 4855 "y.tab.c" /* yacc.c:1652  */
+#line 507 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->InsertSendEffectChainEffect((yyvsp[-6].Number),(yyvsp[-4].Number),(yyvsp[-2].Number),(yyvsp[0].Number)); }
+#line 4874 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 239:
 #line 510 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetMIDIInput((yyvsp[-4].Number), (yyvsp[-2].Number), (yyvsp[0].Number), (yyvsp[-6].Number));      }
-#line 4861 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetAudioOutputDevice((yyvsp[0].Number), (yyvsp[-2].Number));      }
+#line 4880 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 240:
 #line 511 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetMIDIInputDevice((yyvsp[0].Number), (yyvsp[-2].Number));        }
-#line 4867 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetAudioOutputChannel((yyvsp[-2].Number), (yyvsp[0].Number), (yyvsp[-4].Number)); }
+#line 4886 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 241:
 #line 512 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetMIDIInputPort((yyvsp[0].Number), (yyvsp[-2].Number));          }
-#line 4873 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetAudioOutputType((yyvsp[0].String), (yyvsp[-2].Number));        }
+#line 4892 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 242:
 #line 513 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetMIDIInputChannel((yyvsp[0].Number), (yyvsp[-2].Number));       }
-#line 4879 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetMIDIInput((yyvsp[-4].Number), (yyvsp[-2].Number), (yyvsp[0].Number), (yyvsp[-6].Number));      }
+#line 4898 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 243:
 #line 514 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetMIDIInputType((yyvsp[0].String), (yyvsp[-2].Number));          }
-#line 4885 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetMIDIInputDevice((yyvsp[0].Number), (yyvsp[-2].Number));        }
+#line 4904 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 244:
 #line 515 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetVolume((yyvsp[0].Dotnum), (yyvsp[-2].Number));                 }
-#line 4891 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetMIDIInputPort((yyvsp[0].Number), (yyvsp[-2].Number));          }
+#line 4910 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 245:
 #line 516 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetChannelMute((yyvsp[0].Dotnum), (yyvsp[-2].Number));            }
-#line 4897 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetMIDIInputChannel((yyvsp[0].Number), (yyvsp[-2].Number));       }
+#line 4916 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 246:
 #line 517 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetChannelSolo((yyvsp[0].Dotnum), (yyvsp[-2].Number));            }
-#line 4903 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetMIDIInputType((yyvsp[0].String), (yyvsp[-2].Number));          }
+#line 4922 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 247:
 #line 518 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetChannelMap((yyvsp[-2].Number), (yyvsp[0].Number));             }
-#line 4909 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetVolume((yyvsp[0].Dotnum), (yyvsp[-2].Number));                 }
+#line 4928 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 248:
 #line 519 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetChannelMap((yyvsp[-2].Number), -1);             }
-#line 4915 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetChannelMute((yyvsp[0].Dotnum), (yyvsp[-2].Number));            }
+#line 4934 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 249:
 #line 520 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetChannelMap((yyvsp[-2].Number), -2);             }
-#line 4921 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetChannelSolo((yyvsp[0].Dotnum), (yyvsp[-2].Number));            }
+#line 4940 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 250:
-#line 523 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->EditSamplerChannelInstrument((yyvsp[0].Number)); }
-#line 4927 "y.tab.c" /* yacc.c:1652  */
+#line 521 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetChannelMap((yyvsp[-2].Number), (yyvsp[0].Number));             }
+#line 4946 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 251:
-#line 526 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->FormatInstrumentsDb(); }
-#line 4933 "y.tab.c" /* yacc.c:1652  */
+#line 522 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetChannelMap((yyvsp[-2].Number), -1);             }
+#line 4952 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 252:
-#line 529 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Bool) = true;  }
-#line 4939 "y.tab.c" /* yacc.c:1652  */
+#line 523 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetChannelMap((yyvsp[-2].Number), -2);             }
+#line 4958 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 253:
-#line 530 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Bool) = false; }
-#line 4945 "y.tab.c" /* yacc.c:1652  */
+#line 526 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->EditSamplerChannelInstrument((yyvsp[0].Number)); }
+#line 4964 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 254:
-#line 533 "lscp.y" /* yacc.c:1652  */
-    { (yyval.KeyValList)[(yyvsp[-2].String)] = (yyvsp[0].String);          }
-#line 4951 "y.tab.c" /* yacc.c:1652  */
+#line 529 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->FormatInstrumentsDb(); }
+#line 4970 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 255:
-#line 534 "lscp.y" /* yacc.c:1652  */
-    { (yyval.KeyValList) = (yyvsp[-4].KeyValList); (yyval.KeyValList)[(yyvsp[-2].String)] = (yyvsp[0].String); }
-#line 4957 "y.tab.c" /* yacc.c:1652  */
+#line 532 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Bool) = true;  }
+#line 4976 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 256:
-#line 537 "lscp.y" /* yacc.c:1652  */
-    { (yyval.FillResponse) = fill_response_bytes;      }
-#line 4963 "y.tab.c" /* yacc.c:1652  */
+#line 533 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Bool) = false; }
+#line 4982 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 257:
-#line 538 "lscp.y" /* yacc.c:1652  */
-    { (yyval.FillResponse) = fill_response_percentage; }
-#line 4969 "y.tab.c" /* yacc.c:1652  */
+#line 536 "lscp.y" /* yacc.c:1652  */
+    { (yyval.KeyValList)[(yyvsp[-2].String)] = (yyvsp[0].String);          }
+#line 4988 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 258:
-#line 541 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetAudioOutputDevices();              }
-#line 4975 "y.tab.c" /* yacc.c:1652  */
+#line 537 "lscp.y" /* yacc.c:1652  */
+    { (yyval.KeyValList) = (yyvsp[-4].KeyValList); (yyval.KeyValList)[(yyvsp[-2].String)] = (yyvsp[0].String); }
+#line 4994 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 259:
-#line 542 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetMidiInputDevices();                }
-#line 4981 "y.tab.c" /* yacc.c:1652  */
+#line 540 "lscp.y" /* yacc.c:1652  */
+    { (yyval.FillResponse) = fill_response_bytes;      }
+#line 5000 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 260:
-#line 543 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListChannels();                       }
-#line 4987 "y.tab.c" /* yacc.c:1652  */
+#line 541 "lscp.y" /* yacc.c:1652  */
+    { (yyval.FillResponse) = fill_response_percentage; }
+#line 5006 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 261:
 #line 544 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListChannelMidiInputs((yyvsp[0].Number));            }
-#line 4993 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetAudioOutputDevices();              }
+#line 5012 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 262:
 #line 545 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListAvailableEngines();               }
-#line 4999 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetMidiInputDevices();                }
+#line 5018 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 263:
 #line 546 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListAvailableEffects();               }
-#line 5005 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListChannels();                       }
+#line 5024 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 264:
 #line 547 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListEffectInstances();                }
-#line 5011 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListChannelMidiInputs((yyvsp[0].Number));            }
+#line 5030 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 265:
 #line 548 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListSendEffectChains((yyvsp[0].Number));             }
-#line 5017 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListAvailableEngines();               }
+#line 5036 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 266:
 #line 549 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListAvailableMidiInputDrivers();      }
-#line 5023 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListAvailableEffects();               }
+#line 5042 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 267:
 #line 550 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListAvailableAudioOutputDrivers();    }
-#line 5029 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListEffectInstances();                }
+#line 5048 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 268:
 #line 551 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListMidiInstrumentMappings((yyvsp[0].Number));       }
-#line 5035 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListSendEffectChains((yyvsp[0].Number));             }
+#line 5054 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 269:
 #line 552 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListAllMidiInstrumentMappings();      }
-#line 5041 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListAvailableMidiInputDrivers();      }
+#line 5060 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 270:
 #line 553 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListMidiInstrumentMaps();             }
-#line 5047 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListAvailableAudioOutputDrivers();    }
+#line 5066 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 271:
 #line 554 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListFxSends((yyvsp[0].Number));                      }
-#line 5053 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListMidiInstrumentMappings((yyvsp[0].Number));       }
+#line 5072 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 272:
 #line 555 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetDbInstrumentDirectories((yyvsp[0].String), true); }
-#line 5059 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListAllMidiInstrumentMappings();      }
+#line 5078 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 273:
 #line 556 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetDbInstrumentDirectories((yyvsp[0].String));       }
-#line 5065 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListMidiInstrumentMaps();             }
+#line 5084 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 274:
 #line 557 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetDbInstruments((yyvsp[0].String), true);           }
-#line 5071 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListFxSends((yyvsp[0].Number));                      }
+#line 5090 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 275:
 #line 558 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->GetDbInstruments((yyvsp[0].String));                 }
-#line 5077 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetDbInstrumentDirectories((yyvsp[0].String), true); }
+#line 5096 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 276:
 #line 559 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->ListFileInstruments((yyvsp[0].String));              }
-#line 5083 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetDbInstrumentDirectories((yyvsp[0].String));       }
+#line 5102 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 277:
-#line 562 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SendChannelMidiData((yyvsp[-6].String), (yyvsp[-4].Number), (yyvsp[-2].Number), (yyvsp[0].Number)); }
-#line 5089 "y.tab.c" /* yacc.c:1652  */
+#line 560 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetDbInstruments((yyvsp[0].String), true);           }
+#line 5108 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 278:
-#line 565 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->LoadInstrument((yyvsp[-4].String), (yyvsp[-2].Number), (yyvsp[0].Number));       }
-#line 5095 "y.tab.c" /* yacc.c:1652  */
+#line 561 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->GetDbInstruments((yyvsp[0].String));                 }
+#line 5114 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 279:
-#line 566 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->LoadInstrument((yyvsp[-4].String), (yyvsp[-2].Number), (yyvsp[0].Number), true); }
-#line 5101 "y.tab.c" /* yacc.c:1652  */
+#line 562 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->ListFileInstruments((yyvsp[0].String));              }
+#line 5120 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 280:
-#line 569 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = LSCPSERVER->SetEngineType((yyvsp[-2].String), (yyvsp[0].Number)); }
-#line 5107 "y.tab.c" /* yacc.c:1652  */
+#line 565 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SendChannelMidiData((yyvsp[-6].String), (yyvsp[-4].Number), (yyvsp[-2].Number), (yyvsp[0].Number)); }
+#line 5126 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 281:
+#line 568 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->LoadInstrument((yyvsp[-4].String), (yyvsp[-2].Number), (yyvsp[0].Number));       }
+#line 5132 "y.tab.c" /* yacc.c:1652  */
+    break;
+
+  case 282:
+#line 569 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->LoadInstrument((yyvsp[-4].String), (yyvsp[-2].Number), (yyvsp[0].Number), true); }
+#line 5138 "y.tab.c" /* yacc.c:1652  */
+    break;
+
+  case 283:
 #line 572 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = LSCPSERVER->SetEngineType((yyvsp[-2].String), (yyvsp[0].Number)); }
+#line 5144 "y.tab.c" /* yacc.c:1652  */
+    break;
+
+  case 284:
+#line 575 "lscp.y" /* yacc.c:1652  */
     { (yyval.LoadMode) = MidiInstrumentMapper::ON_DEMAND;      }
-#line 5113 "y.tab.c" /* yacc.c:1652  */
+#line 5150 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 282:
-#line 573 "lscp.y" /* yacc.c:1652  */
+  case 285:
+#line 576 "lscp.y" /* yacc.c:1652  */
     { (yyval.LoadMode) = MidiInstrumentMapper::ON_DEMAND_HOLD; }
-#line 5119 "y.tab.c" /* yacc.c:1652  */
+#line 5156 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 283:
-#line 574 "lscp.y" /* yacc.c:1652  */
+  case 286:
+#line 577 "lscp.y" /* yacc.c:1652  */
     { (yyval.LoadMode) = MidiInstrumentMapper::PERSISTENT;     }
-#line 5125 "y.tab.c" /* yacc.c:1652  */
+#line 5162 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 290:
-#line 593 "lscp.y" /* yacc.c:1652  */
+  case 293:
+#line 596 "lscp.y" /* yacc.c:1652  */
     { (yyval.Number) = 16; }
-#line 5131 "y.tab.c" /* yacc.c:1652  */
+#line 5168 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 297:
-#line 612 "lscp.y" /* yacc.c:1652  */
+  case 300:
+#line 615 "lscp.y" /* yacc.c:1652  */
     { (yyval.Dotnum) = (yyvsp[0].Number); }
-#line 5137 "y.tab.c" /* yacc.c:1652  */
+#line 5174 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 303:
-#line 630 "lscp.y" /* yacc.c:1652  */
+  case 306:
+#line 633 "lscp.y" /* yacc.c:1652  */
     {
                                  #if WIN32
                                  (yyval.String) = (yyvsp[0].UniversalPath).toWindows();
@@ -5146,1247 +5183,1247 @@ yyreduce:
                                  (yyval.String) = (yyvsp[0].UniversalPath).toPosix();
                                  #endif
                              }
-#line 5150 "y.tab.c" /* yacc.c:1652  */
+#line 5187 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 304:
-#line 640 "lscp.y" /* yacc.c:1652  */
+  case 307:
+#line 643 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[0].UniversalPath).toDbPath(); }
-#line 5156 "y.tab.c" /* yacc.c:1652  */
+#line 5193 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 314:
-#line 668 "lscp.y" /* yacc.c:1652  */
+  case 317:
+#line 671 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[-2].String) + "," + (yyvsp[0].String); }
-#line 5162 "y.tab.c" /* yacc.c:1652  */
+#line 5199 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 315:
-#line 672 "lscp.y" /* yacc.c:1652  */
+  case 318:
+#line 675 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = "\'" + (yyvsp[0].String) + "\'"; }
-#line 5168 "y.tab.c" /* yacc.c:1652  */
+#line 5205 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 316:
-#line 673 "lscp.y" /* yacc.c:1652  */
+  case 319:
+#line 676 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = "\'" + (yyvsp[0].String) + "\'"; }
-#line 5174 "y.tab.c" /* yacc.c:1652  */
+#line 5211 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 317:
-#line 674 "lscp.y" /* yacc.c:1652  */
+  case 320:
+#line 677 "lscp.y" /* yacc.c:1652  */
     { std::stringstream ss; ss << "\'" << (yyvsp[0].Number) << "\'"; (yyval.String) = ss.str(); }
-#line 5180 "y.tab.c" /* yacc.c:1652  */
+#line 5217 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 318:
-#line 675 "lscp.y" /* yacc.c:1652  */
+  case 321:
+#line 678 "lscp.y" /* yacc.c:1652  */
     { std::stringstream ss; ss << "\'" << (yyvsp[0].Dotnum) << "\'"; (yyval.String) = ss.str(); }
-#line 5186 "y.tab.c" /* yacc.c:1652  */
+#line 5223 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 319:
-#line 678 "lscp.y" /* yacc.c:1652  */
+  case 322:
+#line 681 "lscp.y" /* yacc.c:1652  */
     { (yyval.KeyValList)[(yyvsp[-2].String)] = (yyvsp[0].String);          }
-#line 5192 "y.tab.c" /* yacc.c:1652  */
+#line 5229 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 320:
-#line 679 "lscp.y" /* yacc.c:1652  */
+  case 323:
+#line 682 "lscp.y" /* yacc.c:1652  */
     { (yyval.KeyValList) = (yyvsp[-4].KeyValList); (yyval.KeyValList)[(yyvsp[-2].String)] = (yyvsp[0].String); }
-#line 5198 "y.tab.c" /* yacc.c:1652  */
+#line 5235 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 323:
-#line 686 "lscp.y" /* yacc.c:1652  */
+  case 326:
+#line 689 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = "RECURSIVE"; }
-#line 5204 "y.tab.c" /* yacc.c:1652  */
+#line 5241 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 324:
-#line 687 "lscp.y" /* yacc.c:1652  */
+  case 327:
+#line 690 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = "NON_RECURSIVE"; }
-#line 5210 "y.tab.c" /* yacc.c:1652  */
-    break;
-
-  case 325:
-#line 688 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = "FLAT"; }
-#line 5216 "y.tab.c" /* yacc.c:1652  */
+#line 5247 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 328:
-#line 702 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Dotnum) = (yyvsp[0].Number); }
-#line 5222 "y.tab.c" /* yacc.c:1652  */
-    break;
-
-  case 329:
-#line 703 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Dotnum) = -1; }
-#line 5228 "y.tab.c" /* yacc.c:1652  */
-    break;
-
-  case 330:
-#line 706 "lscp.y" /* yacc.c:1652  */
-    { std::stringstream ss((yyvsp[-2].String) + "." + (yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum); }
-#line 5234 "y.tab.c" /* yacc.c:1652  */
+#line 691 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = "FLAT"; }
+#line 5253 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 331:
-#line 707 "lscp.y" /* yacc.c:1652  */
-    { std::stringstream ss((yyvsp[-2].String) + "." + (yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum); }
-#line 5240 "y.tab.c" /* yacc.c:1652  */
+#line 705 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Dotnum) = (yyvsp[0].Number); }
+#line 5259 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 332:
-#line 708 "lscp.y" /* yacc.c:1652  */
-    { std::stringstream ss("-" + (yyvsp[-2].String) + "." + (yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum); }
-#line 5246 "y.tab.c" /* yacc.c:1652  */
+#line 706 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Dotnum) = -1; }
+#line 5265 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 333:
-#line 711 "lscp.y" /* yacc.c:1652  */
+#line 709 "lscp.y" /* yacc.c:1652  */
     { std::stringstream ss((yyvsp[-2].String) + "." + (yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum); }
-#line 5252 "y.tab.c" /* yacc.c:1652  */
+#line 5271 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 334:
-#line 712 "lscp.y" /* yacc.c:1652  */
+#line 710 "lscp.y" /* yacc.c:1652  */
     { std::stringstream ss((yyvsp[-2].String) + "." + (yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum); }
-#line 5258 "y.tab.c" /* yacc.c:1652  */
+#line 5277 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 335:
-#line 713 "lscp.y" /* yacc.c:1652  */
+#line 711 "lscp.y" /* yacc.c:1652  */
     { std::stringstream ss("-" + (yyvsp[-2].String) + "." + (yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum); }
-#line 5264 "y.tab.c" /* yacc.c:1652  */
+#line 5283 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 336:
 #line 714 "lscp.y" /* yacc.c:1652  */
-    { std::stringstream ss((yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum);                  }
-#line 5270 "y.tab.c" /* yacc.c:1652  */
+    { std::stringstream ss((yyvsp[-2].String) + "." + (yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum); }
+#line 5289 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 337:
 #line 715 "lscp.y" /* yacc.c:1652  */
-    { std::stringstream ss((yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum);                  }
-#line 5276 "y.tab.c" /* yacc.c:1652  */
+    { std::stringstream ss((yyvsp[-2].String) + "." + (yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum); }
+#line 5295 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 338:
 #line 716 "lscp.y" /* yacc.c:1652  */
-    { std::stringstream ss("-" + (yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum);            }
-#line 5282 "y.tab.c" /* yacc.c:1652  */
+    { std::stringstream ss("-" + (yyvsp[-2].String) + "." + (yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum); }
+#line 5301 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 339:
-#line 720 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[0].Char);      }
-#line 5288 "y.tab.c" /* yacc.c:1652  */
+#line 717 "lscp.y" /* yacc.c:1652  */
+    { std::stringstream ss((yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum);                  }
+#line 5307 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 340:
-#line 721 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].Char); }
-#line 5294 "y.tab.c" /* yacc.c:1652  */
+#line 718 "lscp.y" /* yacc.c:1652  */
+    { std::stringstream ss((yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum);                  }
+#line 5313 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 341:
-#line 724 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '0'; }
-#line 5300 "y.tab.c" /* yacc.c:1652  */
+#line 719 "lscp.y" /* yacc.c:1652  */
+    { std::stringstream ss("-" + (yyvsp[0].String)); ss.imbue(std::locale::classic()); ss >> (yyval.Dotnum);            }
+#line 5319 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 342:
-#line 725 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '1'; }
-#line 5306 "y.tab.c" /* yacc.c:1652  */
+#line 723 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[0].Char);      }
+#line 5325 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 343:
-#line 726 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '2'; }
-#line 5312 "y.tab.c" /* yacc.c:1652  */
+#line 724 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].Char); }
+#line 5331 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 344:
 #line 727 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '3'; }
-#line 5318 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '0'; }
+#line 5337 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 345:
 #line 728 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '4'; }
-#line 5324 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '1'; }
+#line 5343 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 346:
 #line 729 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '5'; }
-#line 5330 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '2'; }
+#line 5349 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 347:
 #line 730 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '6'; }
-#line 5336 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '3'; }
+#line 5355 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 348:
 #line 731 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '7'; }
-#line 5342 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '4'; }
+#line 5361 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 349:
 #line 732 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '8'; }
-#line 5348 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '5'; }
+#line 5367 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 350:
 #line 733 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '9'; }
-#line 5354 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '6'; }
+#line 5373 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 351:
-#line 736 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '0'; }
-#line 5360 "y.tab.c" /* yacc.c:1652  */
+#line 734 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Char) = '7'; }
+#line 5379 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 352:
-#line 737 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '1'; }
-#line 5366 "y.tab.c" /* yacc.c:1652  */
+#line 735 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Char) = '8'; }
+#line 5385 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 353:
-#line 738 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '2'; }
-#line 5372 "y.tab.c" /* yacc.c:1652  */
+#line 736 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Char) = '9'; }
+#line 5391 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 354:
 #line 739 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '3'; }
-#line 5378 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '0'; }
+#line 5397 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 355:
 #line 740 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '4'; }
-#line 5384 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '1'; }
+#line 5403 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 356:
 #line 741 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '5'; }
-#line 5390 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '2'; }
+#line 5409 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 357:
 #line 742 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '6'; }
-#line 5396 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '3'; }
+#line 5415 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 358:
 #line 743 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '7'; }
-#line 5402 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '4'; }
+#line 5421 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 359:
-#line 746 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '0'; }
-#line 5408 "y.tab.c" /* yacc.c:1652  */
+#line 744 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Char) = '5'; }
+#line 5427 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 360:
-#line 747 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '1'; }
-#line 5414 "y.tab.c" /* yacc.c:1652  */
+#line 745 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Char) = '6'; }
+#line 5433 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 361:
-#line 748 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '2'; }
-#line 5420 "y.tab.c" /* yacc.c:1652  */
+#line 746 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Char) = '7'; }
+#line 5439 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 362:
 #line 749 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '3'; }
-#line 5426 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '0'; }
+#line 5445 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 363:
 #line 750 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '4'; }
-#line 5432 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '1'; }
+#line 5451 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 364:
 #line 751 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '5'; }
-#line 5438 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '2'; }
+#line 5457 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 365:
 #line 752 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '6'; }
-#line 5444 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '3'; }
+#line 5463 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 366:
 #line 753 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '7'; }
-#line 5450 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '4'; }
+#line 5469 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 367:
 #line 754 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '8'; }
-#line 5456 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '5'; }
+#line 5475 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 368:
 #line 755 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '9'; }
-#line 5462 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '6'; }
+#line 5481 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 369:
 #line 756 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = 'a'; }
-#line 5468 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '7'; }
+#line 5487 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 370:
 #line 757 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = 'b'; }
-#line 5474 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '8'; }
+#line 5493 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 371:
 #line 758 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = 'c'; }
-#line 5480 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = '9'; }
+#line 5499 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 372:
 #line 759 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = 'd'; }
-#line 5486 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = 'a'; }
+#line 5505 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 373:
 #line 760 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = 'e'; }
-#line 5492 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = 'b'; }
+#line 5511 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 374:
 #line 761 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = 'f'; }
-#line 5498 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = 'c'; }
+#line 5517 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 375:
 #line 762 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = 'a'; }
-#line 5504 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = 'd'; }
+#line 5523 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 376:
 #line 763 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = 'b'; }
-#line 5510 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = 'e'; }
+#line 5529 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 377:
 #line 764 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = 'c'; }
-#line 5516 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = 'f'; }
+#line 5535 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 378:
 #line 765 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = 'd'; }
-#line 5522 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = 'a'; }
+#line 5541 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 379:
 #line 766 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = 'e'; }
-#line 5528 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = 'b'; }
+#line 5547 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 380:
 #line 767 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = 'f'; }
-#line 5534 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Char) = 'c'; }
+#line 5553 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 381:
-#line 770 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Number) = atoi(String(1, (yyvsp[0].Char)).c_str());      }
-#line 5540 "y.tab.c" /* yacc.c:1652  */
+#line 768 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Char) = 'd'; }
+#line 5559 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 382:
-#line 771 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Number) = atoi(String(String("1") + (yyvsp[0].String)).c_str()); }
-#line 5546 "y.tab.c" /* yacc.c:1652  */
+#line 769 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Char) = 'e'; }
+#line 5565 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 383:
-#line 772 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Number) = atoi(String(String("2") + (yyvsp[0].String)).c_str()); }
-#line 5552 "y.tab.c" /* yacc.c:1652  */
+#line 770 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Char) = 'f'; }
+#line 5571 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 384:
 #line 773 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Number) = atoi(String(String("3") + (yyvsp[0].String)).c_str()); }
-#line 5558 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Number) = atoi(String(1, (yyvsp[0].Char)).c_str());      }
+#line 5577 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 385:
 #line 774 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Number) = atoi(String(String("4") + (yyvsp[0].String)).c_str()); }
-#line 5564 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Number) = atoi(String(String("1") + (yyvsp[0].String)).c_str()); }
+#line 5583 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 386:
 #line 775 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Number) = atoi(String(String("5") + (yyvsp[0].String)).c_str()); }
-#line 5570 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Number) = atoi(String(String("2") + (yyvsp[0].String)).c_str()); }
+#line 5589 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 387:
 #line 776 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Number) = atoi(String(String("6") + (yyvsp[0].String)).c_str()); }
-#line 5576 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Number) = atoi(String(String("3") + (yyvsp[0].String)).c_str()); }
+#line 5595 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 388:
 #line 777 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Number) = atoi(String(String("7") + (yyvsp[0].String)).c_str()); }
-#line 5582 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Number) = atoi(String(String("4") + (yyvsp[0].String)).c_str()); }
+#line 5601 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 389:
 #line 778 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Number) = atoi(String(String("8") + (yyvsp[0].String)).c_str()); }
-#line 5588 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Number) = atoi(String(String("5") + (yyvsp[0].String)).c_str()); }
+#line 5607 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 390:
 #line 779 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Number) = atoi(String(String("9") + (yyvsp[0].String)).c_str()); }
-#line 5594 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.Number) = atoi(String(String("6") + (yyvsp[0].String)).c_str()); }
+#line 5613 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 391:
-#line 782 "lscp.y" /* yacc.c:1652  */
-    { (yyval.UniversalPath) = (yyvsp[-1].UniversalPath); }
-#line 5600 "y.tab.c" /* yacc.c:1652  */
+#line 780 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Number) = atoi(String(String("7") + (yyvsp[0].String)).c_str()); }
+#line 5619 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 392:
-#line 783 "lscp.y" /* yacc.c:1652  */
-    { (yyval.UniversalPath) = (yyvsp[-1].UniversalPath); }
-#line 5606 "y.tab.c" /* yacc.c:1652  */
+#line 781 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Number) = atoi(String(String("8") + (yyvsp[0].String)).c_str()); }
+#line 5625 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 393:
-#line 786 "lscp.y" /* yacc.c:1652  */
-    { (yyval.UniversalPath) = (yyvsp[-1].UniversalPath) + (yyvsp[0].UniversalPath); }
-#line 5612 "y.tab.c" /* yacc.c:1652  */
+#line 782 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Number) = atoi(String(String("9") + (yyvsp[0].String)).c_str()); }
+#line 5631 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 394:
-#line 789 "lscp.y" /* yacc.c:1652  */
-    { (yyval.UniversalPath) = Path();                    }
-#line 5618 "y.tab.c" /* yacc.c:1652  */
+#line 785 "lscp.y" /* yacc.c:1652  */
+    { (yyval.UniversalPath) = (yyvsp[-1].UniversalPath); }
+#line 5637 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 395:
-#line 790 "lscp.y" /* yacc.c:1652  */
-    { Path p; p.setDrive((yyvsp[-2].Char)); (yyval.UniversalPath) = p; }
-#line 5624 "y.tab.c" /* yacc.c:1652  */
+#line 786 "lscp.y" /* yacc.c:1652  */
+    { (yyval.UniversalPath) = (yyvsp[-1].UniversalPath); }
+#line 5643 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 396:
-#line 793 "lscp.y" /* yacc.c:1652  */
-    { (yyval.UniversalPath) = Path();                           }
-#line 5630 "y.tab.c" /* yacc.c:1652  */
+#line 789 "lscp.y" /* yacc.c:1652  */
+    { (yyval.UniversalPath) = (yyvsp[-1].UniversalPath) + (yyvsp[0].UniversalPath); }
+#line 5649 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 397:
-#line 794 "lscp.y" /* yacc.c:1652  */
-    { (yyval.UniversalPath) = (yyvsp[-1].UniversalPath);                               }
-#line 5636 "y.tab.c" /* yacc.c:1652  */
+#line 792 "lscp.y" /* yacc.c:1652  */
+    { (yyval.UniversalPath) = Path();                    }
+#line 5655 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 398:
-#line 795 "lscp.y" /* yacc.c:1652  */
-    { Path p; p.appendNode((yyvsp[0].String)); (yyval.UniversalPath) = (yyvsp[-1].UniversalPath) + p; }
-#line 5642 "y.tab.c" /* yacc.c:1652  */
+#line 793 "lscp.y" /* yacc.c:1652  */
+    { Path p; p.setDrive((yyvsp[-2].Char)); (yyval.UniversalPath) = p; }
+#line 5661 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 399:
-#line 798 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[-1].String); }
-#line 5648 "y.tab.c" /* yacc.c:1652  */
+#line 796 "lscp.y" /* yacc.c:1652  */
+    { (yyval.UniversalPath) = Path();                           }
+#line 5667 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 400:
-#line 799 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[-1].String); }
-#line 5654 "y.tab.c" /* yacc.c:1652  */
+#line 797 "lscp.y" /* yacc.c:1652  */
+    { (yyval.UniversalPath) = (yyvsp[-1].UniversalPath);                               }
+#line 5673 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 401:
-#line 802 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[-1].String); }
-#line 5660 "y.tab.c" /* yacc.c:1652  */
+#line 798 "lscp.y" /* yacc.c:1652  */
+    { Path p; p.appendNode((yyvsp[0].String)); (yyval.UniversalPath) = (yyvsp[-1].UniversalPath) + p; }
+#line 5679 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 402:
-#line 803 "lscp.y" /* yacc.c:1652  */
+#line 801 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[-1].String); }
-#line 5666 "y.tab.c" /* yacc.c:1652  */
+#line 5685 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 403:
-#line 806 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = " ";      }
-#line 5672 "y.tab.c" /* yacc.c:1652  */
+#line 802 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[-1].String); }
+#line 5691 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 405:
-#line 808 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[-1].String) + " "; }
-#line 5678 "y.tab.c" /* yacc.c:1652  */
+  case 404:
+#line 805 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[-1].String); }
+#line 5697 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 406:
-#line 809 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].String);  }
-#line 5684 "y.tab.c" /* yacc.c:1652  */
+  case 405:
+#line 806 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[-1].String); }
+#line 5703 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 407:
-#line 813 "lscp.y" /* yacc.c:1652  */
+  case 406:
+#line 809 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = " ";      }
-#line 5690 "y.tab.c" /* yacc.c:1652  */
+#line 5709 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 409:
-#line 815 "lscp.y" /* yacc.c:1652  */
+  case 408:
+#line 811 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[-1].String) + " "; }
-#line 5696 "y.tab.c" /* yacc.c:1652  */
+#line 5715 "y.tab.c" /* yacc.c:1652  */
+    break;
+
+  case 409:
+#line 812 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].String);  }
+#line 5721 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 410:
 #line 816 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].String);  }
-#line 5702 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = " ";      }
+#line 5727 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 411:
-#line 819 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = "/";      }
-#line 5708 "y.tab.c" /* yacc.c:1652  */
+  case 412:
+#line 818 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[-1].String) + " "; }
+#line 5733 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 413:
-#line 821 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[-1].String) + "/"; }
-#line 5714 "y.tab.c" /* yacc.c:1652  */
+#line 819 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].String);  }
+#line 5739 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 414:
 #line 822 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].String);  }
-#line 5720 "y.tab.c" /* yacc.c:1652  */
-    break;
-
-  case 415:
-#line 825 "lscp.y" /* yacc.c:1652  */
-    { std::string s; s = (yyvsp[0].Char); (yyval.String) = s; }
-#line 5726 "y.tab.c" /* yacc.c:1652  */
+    { (yyval.String) = "/";      }
+#line 5745 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 416:
-#line 826 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].Char);                  }
-#line 5732 "y.tab.c" /* yacc.c:1652  */
+#line 824 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[-1].String) + "/"; }
+#line 5751 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 417:
-#line 829 "lscp.y" /* yacc.c:1652  */
-    { std::string s; s = (yyvsp[0].Char); (yyval.String) = s; }
-#line 5738 "y.tab.c" /* yacc.c:1652  */
+#line 825 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].String);  }
+#line 5757 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 418:
-#line 830 "lscp.y" /* yacc.c:1652  */
+#line 828 "lscp.y" /* yacc.c:1652  */
     { std::string s; s = (yyvsp[0].Char); (yyval.String) = s; }
-#line 5744 "y.tab.c" /* yacc.c:1652  */
+#line 5763 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 419:
-#line 831 "lscp.y" /* yacc.c:1652  */
+#line 829 "lscp.y" /* yacc.c:1652  */
     { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].Char);                  }
-#line 5750 "y.tab.c" /* yacc.c:1652  */
+#line 5769 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 420:
 #line 832 "lscp.y" /* yacc.c:1652  */
-    { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].Char);                  }
-#line 5756 "y.tab.c" /* yacc.c:1652  */
+    { std::string s; s = (yyvsp[0].Char); (yyval.String) = s; }
+#line 5775 "y.tab.c" /* yacc.c:1652  */
+    break;
+
+  case 421:
+#line 833 "lscp.y" /* yacc.c:1652  */
+    { std::string s; s = (yyvsp[0].Char); (yyval.String) = s; }
+#line 5781 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 422:
-#line 837 "lscp.y" /* yacc.c:1652  */
-    { (yyval.Char) = '\\'; }
-#line 5762 "y.tab.c" /* yacc.c:1652  */
+#line 834 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].Char);                  }
+#line 5787 "y.tab.c" /* yacc.c:1652  */
     break;
 
   case 423:
-#line 838 "lscp.y" /* yacc.c:1652  */
+#line 835 "lscp.y" /* yacc.c:1652  */
+    { (yyval.String) = (yyvsp[-1].String) + (yyvsp[0].Char);                  }
+#line 5793 "y.tab.c" /* yacc.c:1652  */
+    break;
+
+  case 425:
+#line 840 "lscp.y" /* yacc.c:1652  */
+    { (yyval.Char) = '\\'; }
+#line 5799 "y.tab.c" /* yacc.c:1652  */
+    break;
+
+  case 426:
+#line 841 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '/';  }
-#line 5768 "y.tab.c" /* yacc.c:1652  */
+#line 5805 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 424:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 427:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'A'; }
-#line 5774 "y.tab.c" /* yacc.c:1652  */
+#line 5811 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 425:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 428:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'B'; }
-#line 5780 "y.tab.c" /* yacc.c:1652  */
+#line 5817 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 426:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 429:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'C'; }
-#line 5786 "y.tab.c" /* yacc.c:1652  */
+#line 5823 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 427:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 430:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'D'; }
-#line 5792 "y.tab.c" /* yacc.c:1652  */
+#line 5829 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 428:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 431:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'E'; }
-#line 5798 "y.tab.c" /* yacc.c:1652  */
+#line 5835 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 429:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 432:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'F'; }
-#line 5804 "y.tab.c" /* yacc.c:1652  */
+#line 5841 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 430:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 433:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'G'; }
-#line 5810 "y.tab.c" /* yacc.c:1652  */
+#line 5847 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 431:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 434:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'H'; }
-#line 5816 "y.tab.c" /* yacc.c:1652  */
+#line 5853 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 432:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 435:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'I'; }
-#line 5822 "y.tab.c" /* yacc.c:1652  */
+#line 5859 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 433:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 436:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'J'; }
-#line 5828 "y.tab.c" /* yacc.c:1652  */
+#line 5865 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 434:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 437:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'K'; }
-#line 5834 "y.tab.c" /* yacc.c:1652  */
+#line 5871 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 435:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 438:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'L'; }
-#line 5840 "y.tab.c" /* yacc.c:1652  */
+#line 5877 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 436:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 439:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'M'; }
-#line 5846 "y.tab.c" /* yacc.c:1652  */
+#line 5883 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 437:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 440:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'N'; }
-#line 5852 "y.tab.c" /* yacc.c:1652  */
+#line 5889 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 438:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 441:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'O'; }
-#line 5858 "y.tab.c" /* yacc.c:1652  */
+#line 5895 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 439:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 442:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'P'; }
-#line 5864 "y.tab.c" /* yacc.c:1652  */
+#line 5901 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 440:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 443:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'Q'; }
-#line 5870 "y.tab.c" /* yacc.c:1652  */
+#line 5907 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 441:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 444:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'R'; }
-#line 5876 "y.tab.c" /* yacc.c:1652  */
+#line 5913 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 442:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 445:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'S'; }
-#line 5882 "y.tab.c" /* yacc.c:1652  */
+#line 5919 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 443:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 446:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'T'; }
-#line 5888 "y.tab.c" /* yacc.c:1652  */
+#line 5925 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 444:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 447:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'U'; }
-#line 5894 "y.tab.c" /* yacc.c:1652  */
+#line 5931 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 445:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 448:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'V'; }
-#line 5900 "y.tab.c" /* yacc.c:1652  */
+#line 5937 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 446:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 449:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'W'; }
-#line 5906 "y.tab.c" /* yacc.c:1652  */
+#line 5943 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 447:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 450:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'X'; }
-#line 5912 "y.tab.c" /* yacc.c:1652  */
+#line 5949 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 448:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 451:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'Y'; }
-#line 5918 "y.tab.c" /* yacc.c:1652  */
+#line 5955 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 449:
-#line 842 "lscp.y" /* yacc.c:1652  */
+  case 452:
+#line 845 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'Z'; }
-#line 5924 "y.tab.c" /* yacc.c:1652  */
+#line 5961 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 450:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 453:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'a'; }
-#line 5930 "y.tab.c" /* yacc.c:1652  */
+#line 5967 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 451:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 454:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'b'; }
-#line 5936 "y.tab.c" /* yacc.c:1652  */
+#line 5973 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 452:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 455:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'c'; }
-#line 5942 "y.tab.c" /* yacc.c:1652  */
+#line 5979 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 453:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 456:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'd'; }
-#line 5948 "y.tab.c" /* yacc.c:1652  */
+#line 5985 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 454:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 457:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'e'; }
-#line 5954 "y.tab.c" /* yacc.c:1652  */
+#line 5991 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 455:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 458:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'f'; }
-#line 5960 "y.tab.c" /* yacc.c:1652  */
+#line 5997 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 456:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 459:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'g'; }
-#line 5966 "y.tab.c" /* yacc.c:1652  */
+#line 6003 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 457:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 460:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'h'; }
-#line 5972 "y.tab.c" /* yacc.c:1652  */
+#line 6009 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 458:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 461:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'i'; }
-#line 5978 "y.tab.c" /* yacc.c:1652  */
+#line 6015 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 459:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 462:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'j'; }
-#line 5984 "y.tab.c" /* yacc.c:1652  */
+#line 6021 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 460:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 463:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'k'; }
-#line 5990 "y.tab.c" /* yacc.c:1652  */
+#line 6027 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 461:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 464:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'l'; }
-#line 5996 "y.tab.c" /* yacc.c:1652  */
+#line 6033 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 462:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 465:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'm'; }
-#line 6002 "y.tab.c" /* yacc.c:1652  */
+#line 6039 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 463:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 466:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'n'; }
-#line 6008 "y.tab.c" /* yacc.c:1652  */
+#line 6045 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 464:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 467:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'o'; }
-#line 6014 "y.tab.c" /* yacc.c:1652  */
+#line 6051 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 465:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 468:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'p'; }
-#line 6020 "y.tab.c" /* yacc.c:1652  */
+#line 6057 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 466:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 469:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'q'; }
-#line 6026 "y.tab.c" /* yacc.c:1652  */
+#line 6063 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 467:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 470:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'r'; }
-#line 6032 "y.tab.c" /* yacc.c:1652  */
+#line 6069 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 468:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 471:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 's'; }
-#line 6038 "y.tab.c" /* yacc.c:1652  */
+#line 6075 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 469:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 472:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 't'; }
-#line 6044 "y.tab.c" /* yacc.c:1652  */
+#line 6081 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 470:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 473:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'u'; }
-#line 6050 "y.tab.c" /* yacc.c:1652  */
+#line 6087 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 471:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 474:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'v'; }
-#line 6056 "y.tab.c" /* yacc.c:1652  */
+#line 6093 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 472:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 475:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'w'; }
-#line 6062 "y.tab.c" /* yacc.c:1652  */
+#line 6099 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 473:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 476:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'x'; }
-#line 6068 "y.tab.c" /* yacc.c:1652  */
+#line 6105 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 474:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 477:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'y'; }
-#line 6074 "y.tab.c" /* yacc.c:1652  */
+#line 6111 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 475:
-#line 843 "lscp.y" /* yacc.c:1652  */
+  case 478:
+#line 846 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = 'z'; }
-#line 6080 "y.tab.c" /* yacc.c:1652  */
+#line 6117 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 477:
-#line 848 "lscp.y" /* yacc.c:1652  */
+  case 480:
+#line 851 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '0'; }
-#line 6086 "y.tab.c" /* yacc.c:1652  */
+#line 6123 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 478:
-#line 848 "lscp.y" /* yacc.c:1652  */
+  case 481:
+#line 851 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '1'; }
-#line 6092 "y.tab.c" /* yacc.c:1652  */
+#line 6129 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 479:
-#line 848 "lscp.y" /* yacc.c:1652  */
+  case 482:
+#line 851 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '2'; }
-#line 6098 "y.tab.c" /* yacc.c:1652  */
+#line 6135 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 480:
-#line 848 "lscp.y" /* yacc.c:1652  */
+  case 483:
+#line 851 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '3'; }
-#line 6104 "y.tab.c" /* yacc.c:1652  */
+#line 6141 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 481:
-#line 848 "lscp.y" /* yacc.c:1652  */
+  case 484:
+#line 851 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '4'; }
-#line 6110 "y.tab.c" /* yacc.c:1652  */
+#line 6147 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 482:
-#line 848 "lscp.y" /* yacc.c:1652  */
+  case 485:
+#line 851 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '5'; }
-#line 6116 "y.tab.c" /* yacc.c:1652  */
+#line 6153 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 483:
-#line 848 "lscp.y" /* yacc.c:1652  */
+  case 486:
+#line 851 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '6'; }
-#line 6122 "y.tab.c" /* yacc.c:1652  */
+#line 6159 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 484:
-#line 848 "lscp.y" /* yacc.c:1652  */
+  case 487:
+#line 851 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '7'; }
-#line 6128 "y.tab.c" /* yacc.c:1652  */
+#line 6165 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 485:
-#line 848 "lscp.y" /* yacc.c:1652  */
+  case 488:
+#line 851 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '8'; }
-#line 6134 "y.tab.c" /* yacc.c:1652  */
+#line 6171 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 486:
-#line 848 "lscp.y" /* yacc.c:1652  */
+  case 489:
+#line 851 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '9'; }
-#line 6140 "y.tab.c" /* yacc.c:1652  */
+#line 6177 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 487:
-#line 849 "lscp.y" /* yacc.c:1652  */
+  case 490:
+#line 852 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '!'; }
-#line 6146 "y.tab.c" /* yacc.c:1652  */
+#line 6183 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 488:
-#line 849 "lscp.y" /* yacc.c:1652  */
+  case 491:
+#line 852 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '#'; }
-#line 6152 "y.tab.c" /* yacc.c:1652  */
+#line 6189 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 489:
-#line 849 "lscp.y" /* yacc.c:1652  */
+  case 492:
+#line 852 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '$'; }
-#line 6158 "y.tab.c" /* yacc.c:1652  */
+#line 6195 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 490:
-#line 849 "lscp.y" /* yacc.c:1652  */
+  case 493:
+#line 852 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '%'; }
-#line 6164 "y.tab.c" /* yacc.c:1652  */
+#line 6201 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 491:
-#line 849 "lscp.y" /* yacc.c:1652  */
+  case 494:
+#line 852 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '&'; }
-#line 6170 "y.tab.c" /* yacc.c:1652  */
+#line 6207 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 492:
-#line 849 "lscp.y" /* yacc.c:1652  */
+  case 495:
+#line 852 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '('; }
-#line 6176 "y.tab.c" /* yacc.c:1652  */
+#line 6213 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 493:
-#line 849 "lscp.y" /* yacc.c:1652  */
+  case 496:
+#line 852 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = ')'; }
-#line 6182 "y.tab.c" /* yacc.c:1652  */
+#line 6219 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 494:
-#line 849 "lscp.y" /* yacc.c:1652  */
+  case 497:
+#line 852 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '*'; }
-#line 6188 "y.tab.c" /* yacc.c:1652  */
+#line 6225 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 495:
-#line 849 "lscp.y" /* yacc.c:1652  */
+  case 498:
+#line 852 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '+'; }
-#line 6194 "y.tab.c" /* yacc.c:1652  */
+#line 6231 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 496:
-#line 849 "lscp.y" /* yacc.c:1652  */
+  case 499:
+#line 852 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '-'; }
-#line 6200 "y.tab.c" /* yacc.c:1652  */
+#line 6237 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 497:
-#line 849 "lscp.y" /* yacc.c:1652  */
+  case 500:
+#line 852 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '.'; }
-#line 6206 "y.tab.c" /* yacc.c:1652  */
+#line 6243 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 498:
-#line 849 "lscp.y" /* yacc.c:1652  */
+  case 501:
+#line 852 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = ','; }
-#line 6212 "y.tab.c" /* yacc.c:1652  */
+#line 6249 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 499:
-#line 850 "lscp.y" /* yacc.c:1652  */
+  case 502:
+#line 853 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = ':'; }
-#line 6218 "y.tab.c" /* yacc.c:1652  */
+#line 6255 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 500:
-#line 850 "lscp.y" /* yacc.c:1652  */
+  case 503:
+#line 853 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = ';'; }
-#line 6224 "y.tab.c" /* yacc.c:1652  */
+#line 6261 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 501:
-#line 850 "lscp.y" /* yacc.c:1652  */
+  case 504:
+#line 853 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '<'; }
-#line 6230 "y.tab.c" /* yacc.c:1652  */
+#line 6267 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 502:
-#line 850 "lscp.y" /* yacc.c:1652  */
+  case 505:
+#line 853 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '='; }
-#line 6236 "y.tab.c" /* yacc.c:1652  */
+#line 6273 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 503:
-#line 850 "lscp.y" /* yacc.c:1652  */
+  case 506:
+#line 853 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '>'; }
-#line 6242 "y.tab.c" /* yacc.c:1652  */
+#line 6279 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 504:
-#line 850 "lscp.y" /* yacc.c:1652  */
+  case 507:
+#line 853 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '?'; }
-#line 6248 "y.tab.c" /* yacc.c:1652  */
+#line 6285 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 505:
-#line 850 "lscp.y" /* yacc.c:1652  */
+  case 508:
+#line 853 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '@'; }
-#line 6254 "y.tab.c" /* yacc.c:1652  */
+#line 6291 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 506:
-#line 851 "lscp.y" /* yacc.c:1652  */
+  case 509:
+#line 854 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '['; }
-#line 6260 "y.tab.c" /* yacc.c:1652  */
+#line 6297 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 507:
-#line 851 "lscp.y" /* yacc.c:1652  */
+  case 510:
+#line 854 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = ']'; }
-#line 6266 "y.tab.c" /* yacc.c:1652  */
+#line 6303 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 508:
-#line 851 "lscp.y" /* yacc.c:1652  */
+  case 511:
+#line 854 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '^'; }
-#line 6272 "y.tab.c" /* yacc.c:1652  */
+#line 6309 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 509:
-#line 851 "lscp.y" /* yacc.c:1652  */
+  case 512:
+#line 854 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '_'; }
-#line 6278 "y.tab.c" /* yacc.c:1652  */
+#line 6315 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 510:
-#line 852 "lscp.y" /* yacc.c:1652  */
+  case 513:
+#line 855 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '{'; }
-#line 6284 "y.tab.c" /* yacc.c:1652  */
+#line 6321 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 511:
-#line 852 "lscp.y" /* yacc.c:1652  */
+  case 514:
+#line 855 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '|'; }
-#line 6290 "y.tab.c" /* yacc.c:1652  */
+#line 6327 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 512:
-#line 852 "lscp.y" /* yacc.c:1652  */
+  case 515:
+#line 855 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '}'; }
-#line 6296 "y.tab.c" /* yacc.c:1652  */
+#line 6333 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 513:
-#line 852 "lscp.y" /* yacc.c:1652  */
+  case 516:
+#line 855 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '~'; }
-#line 6302 "y.tab.c" /* yacc.c:1652  */
+#line 6339 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 515:
-#line 856 "lscp.y" /* yacc.c:1652  */
+  case 518:
+#line 859 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '\''; }
-#line 6308 "y.tab.c" /* yacc.c:1652  */
+#line 6345 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 516:
-#line 857 "lscp.y" /* yacc.c:1652  */
+  case 519:
+#line 860 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '\"'; }
-#line 6314 "y.tab.c" /* yacc.c:1652  */
+#line 6351 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 517:
-#line 858 "lscp.y" /* yacc.c:1652  */
+  case 520:
+#line 861 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '\\'; }
-#line 6320 "y.tab.c" /* yacc.c:1652  */
+#line 6357 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 518:
-#line 859 "lscp.y" /* yacc.c:1652  */
+  case 521:
+#line 862 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '/';  }
-#line 6326 "y.tab.c" /* yacc.c:1652  */
+#line 6363 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 519:
-#line 860 "lscp.y" /* yacc.c:1652  */
+  case 522:
+#line 863 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '\n'; }
-#line 6332 "y.tab.c" /* yacc.c:1652  */
+#line 6369 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 520:
-#line 861 "lscp.y" /* yacc.c:1652  */
+  case 523:
+#line 864 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '\r'; }
-#line 6338 "y.tab.c" /* yacc.c:1652  */
+#line 6375 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 521:
-#line 862 "lscp.y" /* yacc.c:1652  */
+  case 524:
+#line 865 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '\f'; }
-#line 6344 "y.tab.c" /* yacc.c:1652  */
+#line 6381 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 522:
-#line 863 "lscp.y" /* yacc.c:1652  */
+  case 525:
+#line 866 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '\t'; }
-#line 6350 "y.tab.c" /* yacc.c:1652  */
+#line 6387 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 523:
-#line 864 "lscp.y" /* yacc.c:1652  */
+  case 526:
+#line 867 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = '\v'; }
-#line 6356 "y.tab.c" /* yacc.c:1652  */
+#line 6393 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 526:
-#line 869 "lscp.y" /* yacc.c:1652  */
+  case 529:
+#line 872 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = (char) octalsToNumber((yyvsp[0].Char));       }
-#line 6362 "y.tab.c" /* yacc.c:1652  */
+#line 6399 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 527:
-#line 870 "lscp.y" /* yacc.c:1652  */
+  case 530:
+#line 873 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = (char) octalsToNumber((yyvsp[0].Char),(yyvsp[-1].Char));    }
-#line 6368 "y.tab.c" /* yacc.c:1652  */
+#line 6405 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 528:
-#line 871 "lscp.y" /* yacc.c:1652  */
+  case 531:
+#line 874 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = (char) octalsToNumber((yyvsp[0].Char),(yyvsp[-1].Char),(yyvsp[-2].Char)); }
-#line 6374 "y.tab.c" /* yacc.c:1652  */
+#line 6411 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 529:
-#line 874 "lscp.y" /* yacc.c:1652  */
+  case 532:
+#line 877 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = (char) hexsToNumber((yyvsp[0].Char));    }
-#line 6380 "y.tab.c" /* yacc.c:1652  */
+#line 6417 "y.tab.c" /* yacc.c:1652  */
     break;
 
-  case 530:
-#line 875 "lscp.y" /* yacc.c:1652  */
+  case 533:
+#line 878 "lscp.y" /* yacc.c:1652  */
     { (yyval.Char) = (char) hexsToNumber((yyvsp[0].Char),(yyvsp[-1].Char)); }
-#line 6386 "y.tab.c" /* yacc.c:1652  */
+#line 6423 "y.tab.c" /* yacc.c:1652  */
     break;
 
 
-#line 6390 "y.tab.c" /* yacc.c:1652  */
+#line 6427 "y.tab.c" /* yacc.c:1652  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -6617,7 +6654,7 @@ yyreturn:
 #endif
   return yyresult;
 }
-#line 1297 "lscp.y" /* yacc.c:1918  */
+#line 1312 "lscp.y" /* yacc.c:1918  */
 
 
 // TODO: actually would be fine to have the following bunch of source code in a separate file, however those functions are a) accessing private Bison tables like yytable and b) including the functions from another file here would make the line numbers incorrect on compile errors in auto generated lscpparser.cpp
@@ -25,6 +25,7 @@
 #include <string>
 
 #include "../common/File.h"
+#include "../common/RTMath.h"
 #include "lscpserver.h"
 #include "lscpresultset.h"
 #include "lscpevent.h"
@@ -90,7 +91,8 @@ static String _escapeLscpResponse(String txt) {
  * Below are a few static members of the LSCPServer class.
  * The big assumption here is that LSCPServer is going to remain a singleton.
  * These members are used to support client connections.
- * Class handles multiple connections at the same time using select() and non-blocking recv()
+ * Class handles multiple connections at the same time using epoll (or select()
+ * where not available) and non-blocking recv()
  * Commands are processed by a single LSCPServer thread.
  * Notifications are delivered either by the thread that originated them
  * or (if the resultset is currently in progress) by the LSCPServer thread
@@ -99,12 +101,18 @@ static String _escapeLscpResponse(String txt) {
  * This also makes sure that the thread sending notification is not blocked
  * by the LSCPServer thread.
  */
+#if LSCP_USE_EPOLL
+int LSCPServer::hEpoll = -1;
+#else
 fd_set LSCPServer::fdSet;
+#endif
 int LSCPServer::currentSocket = -1;
 std::vector<yyparse_param_t> LSCPServer::Sessions;
 std::vector<yyparse_param_t>::iterator itCurrentSession;
 std::map<int,String> LSCPServer::bufferedNotifies;
 std::map<int,String> LSCPServer::bufferedCommands;
+std::map<int,String> LSCPServer::receivedData;
+std::map<int,LSCPServer::batch_t> LSCPServer::batches;
 std::map< LSCPEvent::event_t, std::list<int> > LSCPServer::eventSubscriptions;
 Mutex LSCPServer::NotifyMutex;
 Mutex LSCPServer::NotifyBufferMutex;
@@ -437,13 +445,26 @@ int LSCPServer::Main() {
     InstrumentsDb::GetInstrumentsDb()->AddInstrumentsDbListener(&dbInstrumentsEventHandler);
 #endif
     // now wait for client connections and handle their requests
-    sockaddr_in client;
-    int length = sizeof(client);
+#if LSCP_USE_EPOLL
+    hEpoll = epoll_create(16);
+    if (hEpoll < 0) {
+        std::cerr << "LSCPServer: Could not create epoll instance." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    epoll_event event;
+    event.events  = EPOLLIN;
+    event.data.fd = hSocket;
+    if (epoll_ctl(hEpoll, EPOLL_CTL_ADD, hSocket, &event)) {
+        std::cerr << "LSCPServer: Could not watch server socket." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    epoll_event events[LSCP_MAX_EVENTS];
+#else
     FD_ZERO(&fdSet);
     FD_SET(hSocket, &fdSet);
-    int maxSessions = hSocket;
 
     timeval timeout;
+#endif
 
     while (true) {
 	#if CONFIG_PTHREAD_TESTCANCEL
@@ -533,15 +554,46 @@ int LSCPServer::Main() {
             bufferedNotifies.clear();
         }
 
+        // send the answers of batches whose instrument loads are done now
+        FinishBatches();
+
+        // Don't sleep if clients sent several commands at once which were
+        // not processed yet, and only shortly while batches wait for their
+        // instrument loads.
+        int timeoutMs = 100;
+        for (std::map<int,batch_t>::iterator it = batches.begin(); it != batches.end(); ++it)
+            if (it->second.bEnding || it->second.bDeferred) timeoutMs = 10;
+        for (std::map<int,String>::iterator it = receivedData.begin(); it != receivedData.end(); ++it) {
+            if (it->second.empty()) continue;
+            std::map<int,batch_t>::iterator itBatch = batches.find(it->first);
+            if (itBatch == batches.end() || !(itBatch->second.bEnding || itBatch->second.bDeferred)) timeoutMs = 0;
+        }
+
+        bool bNewConnection = false;
+        std::vector<int> readySockets;
+#if LSCP_USE_EPOLL
+        int retval = epoll_wait(hEpoll, events, LSCP_MAX_EVENTS, timeoutMs);
+        for (int i = 0; i < retval; ++i) {
+            if (events[i].data.fd == hSocket) bNewConnection = true;
+            else readySockets.push_back(events[i].data.fd);
+        }
+#else
         fd_set selectSet = fdSet;
+        int maxSessions = hSocket;
+        for (std::vector<yyparse_param_t>::iterator iter = Sessions.begin(); iter != Sessions.end(); iter++)
+            if ((*iter).hSession > maxSessions) maxSessions = (*iter).hSession;
         timeout.tv_sec  = 0;
-        timeout.tv_usec = 100000;
+        timeout.tv_usec = timeoutMs * 1000;
 
         int retval = select(maxSessions+1, &selectSet, NULL, NULL, &timeout);
+        if (retval > 0) {
+            bNewConnection = FD_ISSET(hSocket, &selectSet);
+            for (std::vector<yyparse_param_t>::iterator iter = Sessions.begin(); iter != Sessions.end(); iter++)
+                if (FD_ISSET((*iter).hSession, &selectSet)) readySockets.push_back((*iter).hSession);
+        }
+#endif
 
-	if (retval == 0 || (retval == -1 && errno == EINTR))
-		continue; //Nothing try again
-	if (retval == -1) {
+	if (retval == -1 && errno != EINTR) {
 		std::cerr << "LSCPServer: Socket select error." << std::endl;
 		#if defined(WIN32)
 		closesocket(hSocket);
@@ -552,75 +604,139 @@ int LSCPServer::Main() {
 	}
 
 	//Accept new connections now (if any)
-	if (FD_ISSET(hSocket, &selectSet)) {
-		int socket = accept(hSocket, (sockaddr*) &client, (socklen_t*) &length);
-		if (socket < 0) {
-			std::cerr << "LSCPServer: Client connection failed." << std::endl;
-			exit(EXIT_FAILURE);
-		}
+	if (bNewConnection) AcceptConnection();
 
-		#if defined(WIN32)
-		u_long nonblock_io = 1;
-		if( ioctlsocket(socket, FIONBIO, &nonblock_io) ) {
-		  std::cerr << "LSCPServer: ioctlsocket: set FIONBIO failed. Error " << WSAGetLastError() << std::endl;
-		  exit(EXIT_FAILURE);
-		}
-        #else
-                struct linger linger;
-                linger.l_onoff = 1;
-                linger.l_linger = 0;
-                if(setsockopt(socket, SOL_SOCKET, SO_LINGER, &linger, sizeof(linger))) {
-                    std::cerr << "LSCPServer: Failed to set SO_LINGER\n";
-                }
+	//Read everything that arrived on the client connections
+	for (int i = 0; i < readySockets.size(); ++i) {
+		std::vector<yyparse_param_t>::iterator iter = FindSession(readySockets[i]);
+		if (iter != Sessions.end()) ReceiveData(iter);
+	}
 
-		if (fcntl(socket, F_SETFL, O_NONBLOCK)) {
-			std::cerr << "LSCPServer: F_SETFL O_NONBLOCK failed." << std::endl;
-			exit(EXIT_FAILURE);
-		}
-		#endif
+	//Execute all complete commands received so far, so commands sent at
+	//once by a client don't wait for another round each
+	std::vector<int> sockets;
+	for (std::vector<yyparse_param_t>::iterator iter = Sessions.begin(); iter != Sessions.end(); iter++)
+		sockets.push_back((*iter).hSession);
+	for (int i = 0; i < sockets.size(); ++i)
+		ProcessCommands(sockets[i]);
+    }
+}
 
-                // Parser initialization
-                yyparse_param_t yyparse_param;
-                yyparse_param.pServer  = this;
-                yyparse_param.hSession = socket;
-
-		Sessions.push_back(yyparse_param);
-		FD_SET(socket, &fdSet);
-		if (socket > maxSessions)
-			maxSessions = socket;
-		dmsg(1,("LSCPServer: Client connection established on socket:%d.\n", socket));
-		LSCPServer::SendLSCPNotify(LSCPEvent(LSCPEvent::event_misc, "Client connection established on socket", socket));
-		continue; //Maybe this was the only selected socket, better select again
+void LSCPServer::AcceptConnection() {
+	sockaddr_in client;
+	int length = sizeof(client);
+	int socket = accept(hSocket, (sockaddr*) &client, (socklen_t*) &length);
+	if (socket < 0) {
+		std::cerr << "LSCPServer: Client connection failed." << std::endl;
+		exit(EXIT_FAILURE);
 	}
 
-	//Something was selected and it was not the hSocket, so it must be some command(s) coming.
-	for (std::vector<yyparse_param_t>::iterator iter = Sessions.begin(); iter != Sessions.end(); iter++) {
-		if (FD_ISSET((*iter).hSession, &selectSet)) {	//Was it this socket?
-			currentSocket = (*iter).hSession;  //a hack
-			if (GetLSCPCommand(iter)) {	//Have we read the entire command?
-				dmsg(3,("LSCPServer: Got command on socket %d, calling parser.\n", currentSocket));
-                                int dummy; // just a temporary hack to fulfill the restart() function prototype
-                                restart(NULL, dummy); // restart the 'scanner'
-				itCurrentSession = iter; // another hack
-				dmsg(2,("LSCPServer: [%s]\n",bufferedCommands[currentSocket].c_str()));
-                                if ((*iter).bVerbose) { // if echo mode enabled
-                                    AnswerClient(bufferedCommands[currentSocket]);
-                                }
-				int result = yyparse(&(*iter));
-				currentSocket = -1;	//continuation of a hack
-				itCurrentSession = Sessions.end(); // hack as well
-				dmsg(3,("LSCPServer: Done parsing on socket %d.\n", currentSocket));
-				if (result == LSCP_QUIT) { //Was it a quit command by any chance?
-					CloseConnection(iter);
-				}
+	#if defined(WIN32)
+	u_long nonblock_io = 1;
+	if( ioctlsocket(socket, FIONBIO, &nonblock_io) ) {
+	  std::cerr << "LSCPServer: ioctlsocket: set FIONBIO failed. Error " << WSAGetLastError() << std::endl;
+	  exit(EXIT_FAILURE);
+	}
+	#else
+	struct linger linger;
+	linger.l_onoff = 1;
+	linger.l_linger = 0;
+	if(setsockopt(socket, SOL_SOCKET, SO_LINGER, &linger, sizeof(linger))) {
+	    std::cerr << "LSCPServer: Failed to set SO_LINGER\n";
+	}
+
+	if (fcntl(socket, F_SETFL, O_NONBLOCK)) {
+		std::cerr << "LSCPServer: F_SETFL O_NONBLOCK failed." << std::endl;
+		exit(EXIT_FAILURE);
+	}
+	#endif
+
+	#if LSCP_USE_EPOLL
+	epoll_event event;
+	event.events  = EPOLLIN;
+	event.data.fd = socket;
+	if (epoll_ctl(hEpoll, EPOLL_CTL_ADD, socket, &event)) {
+		std::cerr << "LSCPServer: Could not watch client socket." << std::endl;
+		close(socket);
+		return;
+	}
+	#else
+	FD_SET(socket, &fdSet);
+	#endif
+
+	// Parser initialization
+	yyparse_param_t yyparse_param;
+	yyparse_param.pServer  = this;
+	yyparse_param.hSession = socket;
+
+	Sessions.push_back(yyparse_param);
+	dmsg(1,("LSCPServer: Client connection established on socket:%d.\n", socket));
+	LSCPServer::SendLSCPNotify(LSCPEvent(LSCPEvent::event_misc, "Client connection established on socket", socket));
+}
+
+/**
+ * Executes the complete commands received from the given client so far,
+ * one after another.
+ */
+void LSCPServer::ProcessCommands(int socket) {
+	while (true) {
+		// later commands must not overtake the answer of a batch, nor a
+		// command waiting for the instrument loads of the batch
+		std::map<int,batch_t>::iterator itBatch = batches.find(socket);
+		if (itBatch != batches.end()) {
+			batch_t& batch = itBatch->second;
+			if (batch.bEnding) return;
+			if (batch.bDeferred && !PollBatchLoads(batch, batch.iDeferChannel)) return;
+		}
+
+		std::vector<yyparse_param_t>::iterator iter = FindSession(socket);
+		if (iter == Sessions.end()) return; // connection was closed
+
+		currentSocket = socket;  //a hack
+		if (itBatch != batches.end() && itBatch->second.bDeferred) {
+			itBatch->second.bDeferred = false;
+			bufferedCommands[socket] = itBatch->second.deferredCommand;
+		} else if (!GetLSCPCommand(iter)) {	//Have we read an entire command?
+			currentSocket = -1;
+			return;
+		}
+		const String command = bufferedCommands[socket];
+		dmsg(3,("LSCPServer: Got command on socket %d, calling parser.\n", currentSocket));
+		int dummy; // just a temporary hack to fulfill the restart() function prototype
+		restart(NULL, dummy); // restart the 'scanner'
+		itCurrentSession = iter; // another hack
+		dmsg(2,("LSCPServer: [%s]\n",bufferedCommands[currentSocket].c_str()));
+		if ((*iter).bVerbose && !CurrentBatch()) { // if echo mode enabled
+			AnswerClient(bufferedCommands[currentSocket]);
+		}
+		int result = yyparse(&(*iter));
+		itBatch = batches.find(socket);
+		if (itBatch != batches.end()) {
+			batch_t& batch = itBatch->second;
+			if (batch.bDeferred) batch.deferredCommand = command;
+			// QUIT ends the connection and with it the batch, but its
+			// answer is still sent
+			if (result == LSCP_QUIT && !batch.answers.empty()) {
+				const String bye = batch.answers.back();
+				batch.bEnding = true;
+				AnswerClient(bye);
 			}
-			currentSocket = -1;	//continuation of a hack
-			//socket may have been closed, iter may be invalid, get out of the loop for now.
-			//we'll be back if there is data.
-			break;
+		}
+		currentSocket = -1;	//continuation of a hack
+		itCurrentSession = Sessions.end(); // hack as well
+		dmsg(3,("LSCPServer: Done parsing on socket %d.\n", socket));
+		if (result == LSCP_QUIT) { //Was it a quit command by any chance?
+			CloseConnection(iter);
+			return;
 		}
 	}
-    }
+}
+
+std::vector<yyparse_param_t>::iterator LSCPServer::FindSession(int socket) {
+	std::vector<yyparse_param_t>::iterator iter = Sessions.begin();
+	for (; iter != Sessions.end(); iter++)
+		if ((*iter).hSession == socket) break;
+	return iter;
 }
 
 void LSCPServer::CloseConnection( std::vector<yyparse_param_t>::iterator iter ) {
@@ -628,7 +744,11 @@ void LSCPServer::CloseConnection( std::vector<yyparse_param_t>::iterator iter )
 	dmsg(1,("LSCPServer: Client connection terminated on socket:%d.\n",socket));
 	LSCPServer::SendLSCPNotify(LSCPEvent(LSCPEvent::event_misc, "Client connection terminated on socket", socket));
 	Sessions.erase(iter);
+	#if LSCP_USE_EPOLL
+	epoll_ctl(hEpoll, EPOLL_CTL_DEL, socket, NULL);
+	#else
 	FD_CLR(socket,  &fdSet);
+	#endif
 	{
             LockGuard lock(SubscriptionMutex);
             // Must unsubscribe this socket from all events (if any)
@@ -639,6 +759,14 @@ void LSCPServer::CloseConnection( std::vector<yyparse_param_t>::iterator iter )
 	LockGuard lock(NotifyMutex);
 	bufferedCommands.erase(socket);
 	bufferedNotifies.erase(socket);
+	receivedData.erase(socket);
+	// nobody is waiting for the instrument loads of an unfinished batch anymore
+	std::map<int,batch_t>::iterator itBatch = batches.find(socket);
+	if (itBatch != batches.end()) {
+		for (int i = 0; i < itBatch->second.loads.size(); ++i)
+			InstrumentManager::ForgetBackgroundLoad(itBatch->second.loads[i].id);
+		batches.erase(itBatch);
+	}
 	#if defined(WIN32)
 	closesocket(socket);
 	#else
@@ -751,27 +879,15 @@ String LSCPServer::generateLSCPDocReply(const String& line, yyparse_param_t* par
 }
 
 /**
- * Will be called to try to read the command from the socket
- * If command is read, it will return true. Otherwise false is returned.
- * In any case the received portion (complete or incomplete) is saved into bufferedCommand map.
+ * Will be called to try to get the next command from the data received from
+ * the client so far. If a complete command is available, it will return true.
+ * Otherwise false is returned. In any case the processed portion (complete or
+ * incomplete) is moved into bufferedCommand map.
  */
 bool LSCPServer::GetLSCPCommand( std::vector<yyparse_param_t>::iterator iter ) {
 	int socket = (*iter).hSession;
-	int result;
 	char c;
-	std::vector<char> input;
-
-	// first get as many character as possible and add it to the 'input' buffer
-	while (true) {
-		#if defined(WIN32)
-		result = (int)recv(socket, (char*)&c, 1, 0); //Read one character at a time for now
-		#else
-		result = (int)recv(socket, (void*)&c, 1, 0); //Read one character at a time for now
-		#endif
-		if (result == 1) input.push_back(c);
-		else break; // end of input or some error
-		if (c == '\n') break; // process line by line
-	}
+	String& input = receivedData[socket];
 
 	// process input buffer
 	for (int i = 0; i < input.size(); ++i) {
@@ -793,6 +909,7 @@ bool LSCPServer::GetLSCPCommand( std::vector<yyparse_param_t>::iterator iter ) {
 			}
 			LSCPServer::SendLSCPNotify(LSCPEvent(LSCPEvent::event_misc, "Received \'" + bufferedCommands[socket] + "\' on socket", socket));
 			bufferedCommands[socket] += "\r\n";
+			input.erase(0, i + 1); // keep following commands for the next call
 			return true; //Complete command was read
 		} else if (c == 2) { // custom ASCII code usage for moving cursor left (LSCP shell)
 			if (iter->iCursorOffset + bufferedCommands[socket].size() > 0)
@@ -834,6 +951,29 @@ bool LSCPServer::GetLSCPCommand( std::vector<yyparse_param_t>::iterator iter ) {
 			}
 		}
 	}
+	input.clear();
+	return false;
+}
+
+/**
+ * Will be called to read the data sent by the client, when the socket was
+ * selected. All available data (up to a certain limit) is appended to the
+ * receivedData map, commands are extracted from there by GetLSCPCommand().
+ * Returns false if the connection was closed.
+ */
+bool LSCPServer::ReceiveData( std::vector<yyparse_param_t>::iterator iter ) {
+	int socket = (*iter).hSession;
+	int result;
+	char buf[LSCP_RECV_BUFFER_SIZE];
+	int total = 0;
+
+	while (true) {
+		result = (int)recv(socket, buf, sizeof(buf), 0);
+		if (result <= 0) break; // end of input or some error
+		receivedData[socket].append(buf, result);
+		total += result;
+		if (total >= LSCP_MAX_RECV_PER_ROUND) return true; // rest on next round
+	}
 
 	// handle network errors ...
 	if (result == 0) { //socket was selected, so 0 here means client has closed the connection
@@ -844,13 +984,15 @@ bool LSCPServer::GetLSCPCommand( std::vector<yyparse_param_t>::iterator iter ) {
 	if (result == SOCKET_ERROR) {
 		int wsa_lasterror = WSAGetLastError();
 		if (wsa_lasterror == WSAEWOULDBLOCK) //Would block, try again later.
-			return false;
+			return true;
 		dmsg(2,("LSCPScanner: Socket error after recv() Error %d.\n", wsa_lasterror));
 		CloseConnection(iter);
 		return false;
 	}
 	#else
 	if (result == -1) {
+		if (errno == EAGAIN || errno == EWOULDBLOCK)
+			return true; // read all data available for now
 		switch(errno) {
 			case EBADF:
 				dmsg(2,("LSCPScanner: The argument s is an invalid descriptor.\n"));
@@ -864,9 +1006,6 @@ bool LSCPServer::GetLSCPCommand( std::vector<yyparse_param_t>::iterator iter ) {
 			case ENOTSOCK:
 				dmsg(2,("LSCPScanner: The argument s does not refer to a socket.\n"));
 				break; // close connection
-			case EAGAIN:
-				dmsg(2,("LSCPScanner: The socket is marked non-blocking and the receive operation would block, or a receive timeout had been set and the timeout expired before data was received.\n"));
-				return false; // don't close connection, try again later
 			case EINTR:
 				dmsg(2,("LSCPScanner: The receive was interrupted by delivery of a signal before any data were available.\n"));
 				break; // close connection
@@ -888,7 +1027,7 @@ bool LSCPServer::GetLSCPCommand( std::vector<yyparse_param_t>::iterator iter ) {
 	}
 	#endif
 
-	return false;
+	return true;
 }
 
 /**
@@ -900,6 +1039,13 @@ bool LSCPServer::GetLSCPCommand( std::vector<yyparse_param_t>::iterator iter ) {
 void LSCPServer::AnswerClient(String ReturnMessage) {
     dmsg(2,("LSCPServer::AnswerClient(ReturnMessage='%s')", ReturnMessage.c_str()));
     if (currentSocket != -1) {
+        // answers to commands of a batch are sent all at once by END BATCH
+        batch_t* pBatch = CurrentBatch();
+        if (pBatch) {
+            pBatch->answers.push_back(ReturnMessage);
+            return;
+        }
+
 	    LockGuard lock(NotifyMutex);
 
         // just if other side is LSCP shell: in case respose is a multi-line
@@ -1046,7 +1192,21 @@ String LSCPServer::LoadInstrument(String Filename, uint uiInstrument, uint uiSam
         if (!pEngineChannel) throw Exception("No engine type assigned to sampler channel yet");
         if (!pSamplerChannel->GetAudioOutputDevice())
             throw Exception("No audio output device connected to sampler channel");
-        if (bBackground) {
+        batch_t* pBatch = CurrentBatch();
+        if (pBatch) {
+            // within a batch all loads run in the background, a failed
+            // load replaces the answer of its command by END BATCH
+            InstrumentManager::instrument_id_t id;
+            id.FileName = Filename;
+            id.Index    = uiInstrument;
+            batch_t::load_t load;
+            load.id     = InstrumentManager::StartBackgroundLoad(id, pEngineChannel);
+            load.answer = bBackground ? -1 : int(pBatch->answers.size());
+            load.uiSamplerChannel = uiSamplerChannel;
+            pBatch->loads.push_back(load);
+            pBatch->loadCount++;
+        }
+        else if (bBackground) {
             InstrumentManager::instrument_id_t id;
             id.FileName = Filename;
             id.Index    = uiInstrument;
@@ -1075,6 +1235,7 @@ String LSCPServer::SetEngineType(String EngineName, uint uiSamplerChannel) {
     try {
         SamplerChannel* pSamplerChannel = pSampler->GetSamplerChannel(uiSamplerChannel);
         if (!pSamplerChannel) throw Exception("Invalid sampler channel number " + ToString(uiSamplerChannel));
+        if (DeferForBatchLoads(uiSamplerChannel)) return "";
 	LockGuard lock(RTNotifyMutex);
         pSamplerChannel->SetEngineType(EngineName);
         if(HasSoloChannel()) pSamplerChannel->GetEngineChannel()->SetMute(-1);
@@ -1132,6 +1293,7 @@ String LSCPServer::AddChannel() {
 String LSCPServer::RemoveChannel(uint uiSamplerChannel) {
     dmsg(2,("LSCPServer: RemoveChannel(SamplerChannel=%d)\n", uiSamplerChannel));
     LSCPResultSet result;
+    if (DeferForBatchLoads(uiSamplerChannel)) return "";
     {
         LockGuard lock(RTNotifyMutex);
         pSampler->RemoveSamplerChannel(uiSamplerChannel);
@@ -1316,6 +1478,32 @@ String LSCPServer::GetStreamCount(uint uiSamplerChannel) {
     return result.Produce();
 }
 
+/**
+ * Will be called by the parser to get the streaming statistics of the disk
+ * thread serving a particular sampler channel.
+ */
+String LSCPServer::GetStreamStats(uint uiSamplerChannel) {
+    dmsg(2,("LSCPServer: GetStreamStats(SamplerChannel=%d)\n", uiSamplerChannel));
+    LSCPResultSet result;
+    try {
+        EngineChannel* pEngineChannel = GetEngineChannel(uiSamplerChannel);
+        Engine* pEngine = pEngineChannel->GetEngine();
+        if (!pEngine) throw Exception("No audio output device connected to sampler channel");
+        if (!pEngine->DiskStreamSupported()) throw Exception("Engine of sampler channel doesn't support disk streaming");
+        result.Add("UNDERRUNS", (int)pEngine->DiskStreamUnderruns());
+        result.Add("QUEUE_DEPTH", (int)pEngine->DiskStreamQueueDepth());
+        result.Add("QUEUE_DEPTH_MAX", (int)pEngine->DiskStreamQueueDepthMax());
+        result.Add("READER_THREADS", (int)pEngine->DiskStreamReaderThreads());
+        result.Add("PRELOAD_BYTES", ToString(pEngine->DiskStreamPreloadBytes()));
+        result.Add("PRELOAD_BUDGET", ToString(pEngine->DiskStreamPreloadBudget()));
+        result.Add("STREAMING_LATENCY", pEngine->DiskStreamLatency());
+    }
+    catch (Exception e) {
+         result.Error(e);
+    }
+    return result.Produce();
+}
+
 /**
  * Will be called by the parser to get the buffer fill states of all disk
  * streams on a particular sampler channel.
@@ -3223,6 +3411,7 @@ String LSCPServer::ResetChannel(uint uiSamplerChannel) {
  */
 String LSCPServer::ResetSampler() {
     dmsg(2,("LSCPServer: ResetSampler()\n"));
+    if (DeferForBatchLoads()) return "";
     pSampler->Reset();
     LSCPResultSet result;
     return result.Produce();
@@ -4116,4 +4305,142 @@ String LSCPServer::SetShellDoc(yyparse_param_t* pSession, double boolean_value)
     return result.Produce();
 }
 
+/**
+ * Will be called by the parser on BEGIN BATCH. All following commands of
+ * the session are executed as usual, but their answers are held back until
+ * END BATCH and instrument loads run in the background meanwhile.
+ */
+String LSCPServer::BeginBatch(yyparse_param_t* pSession) {
+    dmsg(2,("LSCPServer: BeginBatch()\n"));
+    LSCPResultSet result;
+    if (batches.count(pSession->hSession)) {
+        result.Error("Batch already started");
+        return result.Produce();
+    }
+    if (pSession->bShellInteract) {
+        result.Error("Batches are not available in shell interaction mode");
+        return result.Produce();
+    }
+    // the answer to BEGIN BATCH itself is sent immediately
+    AnswerClient(result.Produce());
+    batch_t& batch = batches[pSession->hSession];
+    batch.startTime = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+    return "";
+}
+
+/**
+ * Will be called by the parser on END BATCH. The session is not processed
+ * any further until all instrument loads of the batch completed, then the
+ * collected answers are sent to the client, followed by a summary of the
+ * batch (see FinishBatches()).
+ */
+String LSCPServer::EndBatch(yyparse_param_t* pSession) {
+    dmsg(2,("LSCPServer: EndBatch()\n"));
+    std::map<int,batch_t>::iterator iter = batches.find(pSession->hSession);
+    if (iter == batches.end()) {
+        LSCPResultSet result;
+        result.Error("No batch started");
+        return result.Produce();
+    }
+    iter->second.bEnding = true;
+    return "";
+}
+
+/**
+ * Returns the batch of the session whose command is currently executed,
+ * or NULL if that session has no batch running.
+ */
+LSCPServer::batch_t* LSCPServer::CurrentBatch() {
+    if (currentSocket == -1) return NULL;
+    std::map<int,batch_t>::iterator iter = batches.find(currentSocket);
+    if (iter == batches.end() || iter->second.bEnding) return NULL;
+    return &iter->second;
+}
+
+/**
+ * Collects the results of all completed instrument loads of the given
+ * batch. Returns true if no load is pending anymore on the given sampler
+ * channel, respectively on any channel if @a iSamplerChannel is negative.
+ */
+bool LSCPServer::PollBatchLoads(batch_t& batch, int iSamplerChannel) {
+    bool bDone = true;
+    for (int i = 0; i < batch.loads.size(); ) {
+        batch_t::load_t& load = batch.loads[i];
+        String error;
+        if (InstrumentManager::BackgroundLoadFinished(load.id, error)) {
+            if (!error.empty()) {
+                batch.failedLoads++;
+                if (load.answer >= 0) {
+                    LSCPResultSet result;
+                    result.Error(error);
+                    batch.answers[load.answer] = result.Produce();
+                }
+            }
+            batch.loads.erase(batch.loads.begin() + i);
+            continue;
+        }
+        if (iSamplerChannel < 0 || load.uiSamplerChannel == iSamplerChannel)
+            bDone = false;
+        ++i;
+    }
+    return bDone;
+}
+
+/**
+ * Called by commands which would otherwise pull the engine channel away
+ * under a running load. Returns true if instrument loads of the current
+ * batch are still pending on the given sampler channel (or on any channel).
+ * The command must then return without doing anything: ProcessCommands()
+ * executes it again once those loads completed, and meanwhile does not
+ * process any further commands of the session.
+ */
+bool LSCPServer::DeferForBatchLoads(int iSamplerChannel) {
+    batch_t* pBatch = CurrentBatch();
+    if (!pBatch || PollBatchLoads(*pBatch, iSamplerChannel)) return false;
+    pBatch->bDeferred     = true;
+    pBatch->iDeferChannel = iSamplerChannel;
+    return true;
+}
+
+/**
+ * Sends the answers of all batches which were ended by their clients and
+ * whose instrument loads all completed.
+ */
+void LSCPServer::FinishBatches() {
+    for (std::map<int,batch_t>::iterator iter = batches.begin(); iter != batches.end(); ) {
+        batch_t& batch = iter->second;
+        if (!batch.bEnding || !PollBatchLoads(batch)) {
+            ++iter;
+            continue;
+        }
+
+        String answer;
+        int errors = 0, warnings = 0;
+        for (int i = 0; i < batch.answers.size(); ++i) {
+            const String& s = batch.answers[i];
+            if      (s.compare(0, 3, "ERR") == 0) ++errors;
+            else if (s.compare(0, 3, "WRN") == 0) ++warnings;
+            answer += s;
+        }
+        const int64_t now = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+        LSCPResultSet summary;
+        summary.Add("COMMANDS", int(batch.answers.size()));
+        summary.Add("ERRORS", errors);
+        summary.Add("WARNINGS", warnings);
+        summary.Add("INSTRUMENT_LOADS", batch.loadCount);
+        summary.Add("FAILED_LOADS", batch.failedLoads);
+        summary.Add("TIME", float(now - batch.startTime) / 1000000.0f);
+        answer += summary.Produce();
+
+        const int socket = iter->first;
+        batches.erase(iter++);
+
+        currentSocket = socket;
+        itCurrentSession = FindSession(socket);
+        if (itCurrentSession != Sessions.end()) AnswerClient(answer);
+        currentSocket = -1;
+        itCurrentSession = Sessions.end();
+    }
+}
+
 }
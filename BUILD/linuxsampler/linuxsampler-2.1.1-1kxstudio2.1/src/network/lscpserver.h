@@ -39,6 +39,12 @@ typedef int socklen_t;
 #include <netdb.h>
 #endif
 
+// use epoll instead of select() for waiting on client connections
+#if defined(__linux__)
+# define LSCP_USE_EPOLL 1
+# include <sys/epoll.h>
+#endif
+
 #include <list>
 
 #include "lscp.h"
@@ -64,6 +70,15 @@ typedef int socklen_t;
 /// try up to 3 minutes to bind server socket
 #define LSCP_SERVER_BIND_TIMEOUT 180
 
+/// max. amount of socket events handled per epoll_wait() call
+#define LSCP_MAX_EVENTS 64
+
+/// max. amount of bytes read from one client connection at once
+#define LSCP_RECV_BUFFER_SIZE 4096
+
+/// max. amount of bytes read from one client per round, for fairness
+#define LSCP_MAX_RECV_PER_ROUND 65536
+
 // External references to the main scanner and parser functions
 extern int yyparse(void* YYPARSE_PARAM);
 
@@ -96,6 +111,7 @@ class LSCPServer : public Thread {
         String GetChannelInfo(uint uiSamplerChannel);
         String GetVoiceCount(uint uiSamplerChannel);
         String GetStreamCount(uint uiSamplerChannel);
+        String GetStreamStats(uint uiSamplerChannel);
         String GetBufferFill(fill_response_t ResponseType, uint uiSamplerChannel);
         String GetAvailableAudioOutputDrivers();
         String ListAvailableAudioOutputDrivers();
@@ -242,6 +258,8 @@ class LSCPServer : public Thread {
         String SetShellInteract(yyparse_param_t* pSession, double boolean_value);
         String SetShellDoc(yyparse_param_t* pSession, double boolean_value);
         String SetShellAutoCorrect(yyparse_param_t* pSession, double boolean_value);
+        String BeginBatch(yyparse_param_t* pSession);
+        String EndBatch(yyparse_param_t* pSession);
         void   AnswerClient(String ReturnMessage);
         void   CloseAllConnections();
 
@@ -299,11 +317,49 @@ class LSCPServer : public Thread {
 	static Mutex NotifyBufferMutex;
 	String generateLSCPDocReply(const String& line, yyparse_param_t* param);
 	bool GetLSCPCommand( std::vector<yyparse_param_t>::iterator iter );
+	bool ReceiveData( std::vector<yyparse_param_t>::iterator iter );
+	void ProcessCommands( int socket );
+	void AcceptConnection();
 	static void CloseConnection( std::vector<yyparse_param_t>::iterator iter );
+	static std::vector<yyparse_param_t>::iterator FindSession( int socket );
 	static std::vector<yyparse_param_t> Sessions;
 	static Mutex SubscriptionMutex;
 	static std::map< LSCPEvent::event_t, std::list<int> > eventSubscriptions;
+	static std::map<int,String> receivedData; ///< per socket: received data not processed yet
+#if LSCP_USE_EPOLL
+	static int hEpoll;
+#else
 	static fd_set fdSet;
+#endif
+
+        /**
+         * State of a client connection between BEGIN BATCH and the
+         * aggregated answer to END BATCH.
+         */
+        struct batch_t {
+            struct load_t {
+                int  id;               ///< ID of the InstrumentManager background load
+                int  answer;           ///< answer replaced by the outcome of the load, -1 for NON_MODAL loads
+                uint uiSamplerChannel;
+            };
+            std::vector<String> answers; ///< answers of all commands of the batch so far
+            std::vector<load_t> loads;   ///< instrument loads not finished yet
+            int     loadCount;           ///< instrument loads issued by the batch
+            int     failedLoads;
+            bool    bEnding;             ///< END BATCH received, waiting for the loads
+            bool    bDeferred;           ///< a command waits for the loads on iDeferChannel
+            int     iDeferChannel;       ///< sampler channel of the deferred command, -1 for all channels
+            String  deferredCommand;     ///< executed again once those loads completed
+            int64_t startTime;           ///< when BEGIN BATCH was received (in microseconds)
+
+            batch_t() : loadCount(0), failedLoads(0), bEnding(false), bDeferred(false), iDeferChannel(-1), startTime(0) {}
+        };
+	static std::map<int,batch_t> batches; ///< per socket: current batch, if any
+
+        batch_t* CurrentBatch();
+        static bool PollBatchLoads(batch_t& batch, int iSamplerChannel = -1);
+        bool DeferForBatchLoads(int iSamplerChannel = -1);
+        void FinishBatches();
 
         class EventHandler : public ChannelCountListener, public AudioDeviceCountListener,
             public MidiDeviceCountListener, public MidiInstrumentCountListener,
@@ -0,0 +1,643 @@
+/*
+ * Copyright (c) 2026
+ *
+ * http://www.linuxsampler.org
+ *
+ * This file is part of LinuxSampler and released under the same terms.
+ * See README file for details.
+ */
+
+#include "Bytecode.h"
+
+#include <stdio.h>
+
+namespace LinuxSampler {
+
+static const char* opName(uint8_t op) {
+    switch (op) {
+        case BC_MOV: return "MOV";
+        case BC_ADD: return "ADD";
+        case BC_SUB: return "SUB";
+        case BC_MUL: return "MUL";
+        case BC_DIV: return "DIV";
+        case BC_MOD: return "MOD";
+        case BC_BAND: return "BAND";
+        case BC_BOR: return "BOR";
+        case BC_LT: return "LT";
+        case BC_GT: return "GT";
+        case BC_LE: return "LE";
+        case BC_GE: return "GE";
+        case BC_EQ: return "EQ";
+        case BC_NE: return "NE";
+        case BC_NEG: return "NEG";
+        case BC_NOT: return "NOT";
+        case BC_BNOT: return "BNOT";
+        case BC_JMP: return "JMP";
+        case BC_JZ: return "JZ";
+        case BC_JNZ: return "JNZ";
+        case BC_JLT: return "JLT";
+        case BC_JGT: return "JGT";
+        case BC_JLE: return "JLE";
+        case BC_JGE: return "JGE";
+        case BC_JEQ: return "JEQ";
+        case BC_JNE: return "JNE";
+        case BC_LOOP: return "LOOP";
+        case BC_ARR_LOAD: return "ARR_LOAD";
+        case BC_ARR_STORE: return "ARR_STORE";
+        case BC_RELPTR_LOAD: return "RELPTR_LOAD";
+        case BC_EVAL: return "EVAL";
+        case BC_EXEC: return "EXEC";
+        case BC_SYNC_BEGIN: return "SYNC_BEGIN";
+        case BC_SYNC_END: return "SYNC_END";
+        case BC_END: return "END";
+    }
+    return "???";
+}
+
+static void printOperand(const Bytecode* bc, uint32_t op) {
+    const uint32_t index = BC_OPERAND_INDEX(op);
+    switch (BC_OPERAND_BANK(op)) {
+        case BC_BANK_REGISTER: printf(" r%u", index); break;
+        case BC_BANK_GLOBAL:   printf(" g%u", index); break;
+        case BC_BANK_POLY:     printf(" p%u", index); break;
+        case BC_BANK_CONST:    printf(" #%d", bc->constants[index]); break;
+    }
+}
+
+void Bytecode::dump() {
+    printf("Bytecode (%d instructions, %d registers) {\n", int(code.size()), registerCount);
+    for (int i = 0; i < code.size(); ++i) {
+        const BytecodeInstr& in = code[i];
+        printf("  %4d%s %s", i, (in.flags & BC_FLAG_STEP) ? "*" : " ", opName(in.op));
+        switch (in.op) {
+            case BC_MOV: case BC_NEG: case BC_NOT: case BC_BNOT:
+                printOperand(this, in.a);
+                printOperand(this, in.b);
+                break;
+            case BC_JMP:
+                printf(" @%u", in.a);
+                break;
+            case BC_JZ: case BC_JNZ:
+                printf(" @%u", in.a);
+                printOperand(this, in.b);
+                break;
+            case BC_JLT: case BC_JGT: case BC_JLE: case BC_JGE: case BC_JEQ: case BC_JNE:
+                printf(" @%u", in.a);
+                printOperand(this, in.b);
+                printOperand(this, in.c);
+                break;
+            case BC_ARR_LOAD:
+                printOperand(this, in.a);
+                printf(" array%u", in.b);
+                printOperand(this, in.c);
+                break;
+            case BC_ARR_STORE:
+                printf(" array%u", in.b);
+                printOperand(this, in.c);
+                printOperand(this, in.a);
+                break;
+            case BC_RELPTR_LOAD:
+                printOperand(this, in.a);
+                printf(" builtin%u", in.b);
+                break;
+            case BC_EVAL:
+                printOperand(this, in.a);
+                printf(" expr%u (stmt @%u)", in.b, in.c);
+                break;
+            case BC_EXEC:
+                printf(" leaf%u (stmt @%u)", in.b, in.c);
+                break;
+            case BC_LOOP: case BC_SYNC_BEGIN: case BC_SYNC_END: case BC_END:
+                break;
+            default:
+                printOperand(this, in.a);
+                printOperand(this, in.b);
+                printOperand(this, in.c);
+        }
+        printf("\n");
+    }
+    printf("}\n");
+}
+
+BytecodeCompiler::BytecodeCompiler() : bc(NULL), registerTop(0), statementStart(0) {
+}
+
+Bytecode* BytecodeCompiler::compile(EventHandler* handler) {
+    BytecodeCompiler compiler;
+    compiler.bc = new Bytecode;
+    if (!compiler.compileStatements(handler)) {
+        delete compiler.bc;
+        return NULL;
+    }
+    compiler.emit(BC_END);
+    return compiler.bc;
+}
+
+bool BytecodeCompiler::compileStatements(Statements* statements) {
+    for (uint i = 0; Statement* statement = statements->statement(i); ++i)
+        if (!compileStatement(statement))
+            return false;
+    return true;
+}
+
+bool BytecodeCompiler::compileStatement(Statement* statement) {
+    const size_t start = bc->code.size();
+    statementStart = int(start);
+    registerTop = 0;
+
+    switch (statement->statementType()) {
+        case STMT_LEAF: {
+            Assignment* assignment = dynamic_cast<Assignment*>(statement);
+            if (assignment) {
+                if (!compileAssignment(assignment)) return false;
+            } else {
+                LeafStatement* leaf = dynamic_cast<LeafStatement*>(statement);
+                if (!leaf) return false;
+                emitExec(leaf);
+            }
+            markStep(start);
+            return true;
+        }
+        case STMT_LIST: {
+            Statements* statements = dynamic_cast<Statements*>(statement);
+            return statements && compileStatements(statements);
+        }
+        case STMT_BRANCH: {
+            If* ifStmt = dynamic_cast<If*>(statement);
+            if (ifStmt) return compileIf(ifStmt);
+            SelectCase* selectStmt = dynamic_cast<SelectCase*>(statement);
+            if (selectStmt) return compileSelectCase(selectStmt);
+            return false;
+        }
+        case STMT_LOOP: {
+            While* whileStmt = dynamic_cast<While*>(statement);
+            return whileStmt && compileWhile(whileStmt);
+        }
+        case STMT_SYNC: {
+            SyncBlock* syncStmt = dynamic_cast<SyncBlock*>(statement);
+            if (!syncStmt) return false;
+            if (!syncStmt->statements()) return true;
+            emit(BC_SYNC_BEGIN);
+            if (!compileStatements(syncStmt->statements())) return false;
+            emit(BC_SYNC_END);
+            return true;
+        }
+        case STMT_NOOP:
+            return true;
+    }
+    return false;
+}
+
+bool BytecodeCompiler::compileAssignment(Assignment* assignment) {
+    if (!assignment->variable || !assignment->value ||
+        assignment->value->exprType() != INT_EXPR)
+    {
+        emitExec(assignment);
+        return true;
+    }
+    Variable* variable = &*assignment->variable;
+    IntExpr* value = dynamic_cast<IntExpr*>(&*assignment->value);
+    if (!value) {
+        emitExec(assignment);
+        return true;
+    }
+
+    if (dynamic_cast<ConstIntVariable*>(variable))
+        return true; // assignment is ignored
+
+    IntArrayElement* element = dynamic_cast<IntArrayElement*>(variable);
+    if (element) {
+        // same evaluation order as IntArrayElement::assign()
+        const uint32_t v = compileExpr(value);
+        if (!element->index) return true;
+        const uint32_t index = compileExpr(&*element->index);
+        emit(BC_ARR_STORE, v, arraySlot(&*element->array), index);
+        return true;
+    }
+
+    IntVariable* intVariable = dynamic_cast<IntVariable*>(variable);
+    if (!intVariable || dynamic_cast<BuiltInIntVariable*>(variable)) {
+        emitExec(assignment);
+        return true;
+    }
+    const uint32_t dest = BC_OPERAND(
+        intVariable->isPolyphonic() ? BC_BANK_POLY : BC_BANK_GLOBAL, variable->memPos
+    );
+    const uint32_t result = compileExpr(value, dest);
+    if (result != dest) emit(BC_MOV, dest, result);
+    return true;
+}
+
+bool BytecodeCompiler::compileIf(If* stmt) {
+    const size_t start = bc->code.size();
+    std::vector<int> toElse;
+    compileCond(&*stmt->condition, false, toElse);
+    markStep(start);
+
+    if (stmt->ifStatements && !compileStatements(&*stmt->ifStatements))
+        return false;
+    if (stmt->elseStatements) {
+        std::vector<int> toEnd(1, emit(BC_JMP));
+        patch(toElse, int(bc->code.size()));
+        if (!compileStatements(&*stmt->elseStatements))
+            return false;
+        patch(toEnd, int(bc->code.size()));
+    } else {
+        patch(toElse, int(bc->code.size()));
+    }
+    return true;
+}
+
+bool BytecodeCompiler::compileSelectCase(SelectCase* stmt) {
+    const int start = int(bc->code.size());
+    const uint32_t value = compileExpr(&*stmt->select);
+    // the selected value stays in its register until a case matched
+    const int selectTop = registerTop;
+
+    std::vector<int> toEnd;
+    for (int i = 0; i < stmt->branches.size(); ++i) {
+        CaseBranch& branch = stmt->branches[i];
+        const size_t caseStart = bc->code.size();
+        std::vector<int> toNext;
+        statementStart = start;
+        registerTop = selectTop;
+
+        if (branch.from && branch.to) { // i.e. "case 4 to 7" ...
+            const uint32_t from = compileExpr(&*branch.from);
+            toNext.push_back(emit(BC_JGT, 0, from, value));
+            registerTop = selectTop;
+            const uint32_t to = compileExpr(&*branch.to);
+            toNext.push_back(emit(BC_JLT, 0, to, value));
+        } else { // i.e. "case 5" ...
+            const uint32_t from = compileExpr(&*branch.from);
+            toNext.push_back(emit(BC_JNE, 0, from, value));
+        }
+        markStep(caseStart);
+
+        if (branch.statements && !compileStatements(&*branch.statements))
+            return false;
+        toEnd.push_back(emit(BC_JMP));
+        patch(toNext, int(bc->code.size()));
+    }
+    patch(toEnd, int(bc->code.size()));
+    return true;
+}
+
+bool BytecodeCompiler::compileWhile(While* stmt) {
+    const int top = int(bc->code.size());
+    std::vector<int> toEnd;
+    if (stmt->m_condition)
+        compileCond(&*stmt->m_condition, false, toEnd);
+    else
+        toEnd.push_back(emit(BC_JMP));
+
+    if (stmt->statements()) {
+        bc->code[emit(BC_LOOP)].flags |= BC_FLAG_STEP;
+        if (!compileStatements(stmt->statements()))
+            return false;
+        emit(BC_JMP, top);
+    }
+    patch(toEnd, int(bc->code.size()));
+    return true;
+}
+
+uint32_t BytecodeCompiler::compileExpr(IntExpr* expr, int64_t dest) {
+    int value;
+    if (constValue(expr, value)) {
+        const uint32_t c = constant(value);
+        if (dest < 0) return c;
+        emit(BC_MOV, uint32_t(dest), c);
+        return uint32_t(dest);
+    }
+
+    const int top = registerTop;
+
+    if (IntArrayElement* element = dynamic_cast<IntArrayElement*>(expr)) {
+        const uint32_t index = compileExpr(&*element->index);
+        registerTop = top;
+        const uint32_t r = destOrRegister(dest);
+        emit(BC_ARR_LOAD, r, arraySlot(&*element->array), index);
+        return r;
+    }
+
+    if (BuiltInIntVariable* builtIn = dynamic_cast<BuiltInIntVariable*>(expr)) {
+        const uint32_t r = destOrRegister(dest);
+        emit(BC_RELPTR_LOAD, r, uint32_t(bc->relPtrs.size()));
+        bc->relPtrs.push_back(builtIn->ptr);
+        return r;
+    }
+
+    if (IntVariable* intVariable = dynamic_cast<IntVariable*>(expr)) {
+        const uint32_t v = BC_OPERAND(
+            intVariable->isPolyphonic() ? BC_BANK_POLY : BC_BANK_GLOBAL,
+            static_cast<Variable*>(intVariable)->memPos
+        );
+        if (dest < 0) return v;
+        emit(BC_MOV, uint32_t(dest), v);
+        return uint32_t(dest);
+    }
+
+    if (BinaryOp* binary = dynamic_cast<BinaryOp*>(expr)) {
+        IntExpr* lhs = dynamic_cast<IntExpr*>(&*binary->lhs);
+        IntExpr* rhs = dynamic_cast<IntExpr*>(&*binary->rhs);
+        if (lhs && rhs) {
+            if (dynamic_cast<And*>(expr) || dynamic_cast<Or*>(expr)) {
+                // short-circuit evaluation, result is either 0 or 1
+                const uint32_t r = allocRegister();
+                std::vector<int> toFalse;
+                emit(BC_MOV, r, constant(0));
+                compileCond(expr, false, toFalse);
+                emit(BC_MOV, r, constant(1));
+                patch(toFalse, int(bc->code.size()));
+                if (dest < 0) return r;
+                emit(BC_MOV, uint32_t(dest), r);
+                return uint32_t(dest);
+            }
+            uint8_t op;
+            if (dynamic_cast<Add*>(expr)) op = BC_ADD;
+            else if (dynamic_cast<Sub*>(expr)) op = BC_SUB;
+            else if (dynamic_cast<Mul*>(expr)) op = BC_MUL;
+            else if (dynamic_cast<Div*>(expr)) op = BC_DIV;
+            else if (dynamic_cast<Mod*>(expr)) op = BC_MOD;
+            else if (dynamic_cast<BitwiseAnd*>(expr)) op = BC_BAND;
+            else if (dynamic_cast<BitwiseOr*>(expr)) op = BC_BOR;
+            else goto escape;
+            const uint32_t l = compileExpr(lhs);
+            const uint32_t r = compileExpr(rhs);
+            registerTop = top;
+            const uint32_t result = destOrRegister(dest);
+            emit(op, result, l, r);
+            return result;
+        }
+    }
+
+    if (Relation* relation = dynamic_cast<Relation*>(expr)) {
+        if (relation->lhs && relation->rhs &&
+            relation->lhs->exprType() != STRING_EXPR &&
+            relation->rhs->exprType() != STRING_EXPR)
+        {
+            uint8_t op = BC_EQ;
+            switch (relation->type) {
+                case Relation::LESS_THAN:        op = BC_LT; break;
+                case Relation::GREATER_THAN:     op = BC_GT; break;
+                case Relation::LESS_OR_EQUAL:    op = BC_LE; break;
+                case Relation::GREATER_OR_EQUAL: op = BC_GE; break;
+                case Relation::EQUAL:            op = BC_EQ; break;
+                case Relation::NOT_EQUAL:        op = BC_NE; break;
+            }
+            const uint32_t l = compileExpr(&*relation->lhs);
+            const uint32_t r = compileExpr(&*relation->rhs);
+            registerTop = top;
+            const uint32_t result = destOrRegister(dest);
+            emit(op, result, l, r);
+            return result;
+        }
+    }
+
+    {
+        uint8_t op = BC_NEG;
+        IntExpr* operand = NULL;
+        if (Neg* neg = dynamic_cast<Neg*>(expr)) {
+            op = BC_NEG;
+            operand = &*neg->expr;
+        } else if (Not* no = dynamic_cast<Not*>(expr)) {
+            op = BC_NOT;
+            operand = &*no->expr;
+        } else if (BitwiseNot* bnot = dynamic_cast<BitwiseNot*>(expr)) {
+            op = BC_BNOT;
+            operand = &*bnot->expr;
+        }
+        if (operand) {
+            const uint32_t v = compileExpr(operand);
+            registerTop = top;
+            const uint32_t result = destOrRegister(dest);
+            emit(op, result, v);
+            return result;
+        }
+    }
+
+escape:
+    // function calls, dynamic variables, string comparisons, ...
+    registerTop = top;
+    const uint32_t result = destOrRegister(dest);
+    emit(BC_EVAL, result, uint32_t(bc->exprs.size()), uint32_t(statementStart));
+    bc->exprs.push_back(expr);
+    return result;
+}
+
+void BytecodeCompiler::compileCond(IntExpr* expr, bool jumpIf, std::vector<int>& jumps) {
+    int value;
+    if (constValue(expr, value)) {
+        if ((value != 0) == jumpIf)
+            jumps.push_back(emit(BC_JMP));
+        return;
+    }
+
+    const int top = registerTop;
+
+    if (Not* no = dynamic_cast<Not*>(expr)) {
+        if (no->expr) {
+            compileCond(&*no->expr, !jumpIf, jumps);
+            return;
+        }
+    }
+
+    if (BinaryOp* binary = dynamic_cast<BinaryOp*>(expr)) {
+        IntExpr* lhs = dynamic_cast<IntExpr*>(&*binary->lhs);
+        IntExpr* rhs = dynamic_cast<IntExpr*>(&*binary->rhs);
+        const bool isAnd = dynamic_cast<And*>(expr);
+        const bool isOr  = dynamic_cast<Or*>(expr);
+        if (lhs && rhs && (isAnd || isOr)) {
+            // jumps if lhs alone decides the result the way we jump,
+            // otherwise rhs decides
+            if (isAnd != jumpIf) {
+                compileCond(lhs, jumpIf, jumps);
+                compileCond(rhs, jumpIf, jumps);
+            } else {
+                std::vector<int> skip;
+                compileCond(lhs, !jumpIf, skip);
+                compileCond(rhs, jumpIf, jumps);
+                patch(skip, int(bc->code.size()));
+            }
+            return;
+        }
+    }
+
+    if (Relation* relation = dynamic_cast<Relation*>(expr)) {
+        if (relation->lhs && relation->rhs &&
+            relation->lhs->exprType() != STRING_EXPR &&
+            relation->rhs->exprType() != STRING_EXPR)
+        {
+            uint8_t op = BC_JEQ;
+            switch (relation->type) {
+                case Relation::LESS_THAN:        op = jumpIf ? BC_JLT : BC_JGE; break;
+                case Relation::GREATER_THAN:     op = jumpIf ? BC_JGT : BC_JLE; break;
+                case Relation::LESS_OR_EQUAL:    op = jumpIf ? BC_JLE : BC_JGT; break;
+                case Relation::GREATER_OR_EQUAL: op = jumpIf ? BC_JGE : BC_JLT; break;
+                case Relation::EQUAL:            op = jumpIf ? BC_JEQ : BC_JNE; break;
+                case Relation::NOT_EQUAL:        op = jumpIf ? BC_JNE : BC_JEQ; break;
+            }
+            const uint32_t l = compileExpr(&*relation->lhs);
+            const uint32_t r = compileExpr(&*relation->rhs);
+            registerTop = top;
+            jumps.push_back(emit(op, 0, l, r));
+            return;
+        }
+    }
+
+    const uint32_t v = compileExpr(expr);
+    registerTop = top;
+    jumps.push_back(emit(jumpIf ? BC_JNZ : BC_JZ, 0, v));
+}
+
+bool BytecodeCompiler::constValue(IntExpr* expr, int& value) {
+    if (IntLiteral* literal = dynamic_cast<IntLiteral*>(expr)) {
+        value = literal->value;
+        return true;
+    }
+    if (ConstIntVariable* constVariable = dynamic_cast<ConstIntVariable*>(expr)) {
+        value = constVariable->value;
+        return true;
+    }
+    if (IntArrayElement* element = dynamic_cast<IntArrayElement*>(expr)) {
+        if (element->index) return false;
+        value = 0;
+        return true;
+    }
+    if (Neg* neg = dynamic_cast<Neg*>(expr)) {
+        if (!neg->expr) {
+            value = 0;
+            return true;
+        }
+        if (!constValue(&*neg->expr, value)) return false;
+        value = -value;
+        return true;
+    }
+    if (Not* no = dynamic_cast<Not*>(expr)) {
+        if (!no->expr || !constValue(&*no->expr, value)) return false;
+        value = !value;
+        return true;
+    }
+    if (BitwiseNot* bnot = dynamic_cast<BitwiseNot*>(expr)) {
+        if (!bnot->expr || !constValue(&*bnot->expr, value)) return false;
+        value = ~value;
+        return true;
+    }
+
+    IntExpr* lhs = NULL;
+    IntExpr* rhs = NULL;
+    if (Relation* relation = dynamic_cast<Relation*>(expr)) {
+        if (!relation->lhs || !relation->rhs ||
+            relation->lhs->exprType() == STRING_EXPR ||
+            relation->rhs->exprType() == STRING_EXPR) return false;
+        int l, r;
+        if (!constValue(&*relation->lhs, l) || !constValue(&*relation->rhs, r))
+            return false;
+        switch (relation->type) {
+            case Relation::LESS_THAN:        value = l < r; break;
+            case Relation::GREATER_THAN:     value = l > r; break;
+            case Relation::LESS_OR_EQUAL:    value = l <= r; break;
+            case Relation::GREATER_OR_EQUAL: value = l >= r; break;
+            case Relation::EQUAL:            value = l == r; break;
+            case Relation::NOT_EQUAL:        value = l != r; break;
+        }
+        return true;
+    }
+    BinaryOp* binary = dynamic_cast<BinaryOp*>(expr);
+    if (!binary) return false;
+    lhs = dynamic_cast<IntExpr*>(&*binary->lhs);
+    rhs = dynamic_cast<IntExpr*>(&*binary->rhs);
+    if (!lhs || !rhs) return false;
+
+    int l, r;
+    if (!constValue(lhs, l)) return false;
+    // right hand side is not evaluated if the left one decides
+    if (dynamic_cast<And*>(expr) && !l) {
+        value = 0;
+        return true;
+    }
+    if (dynamic_cast<Or*>(expr) && l) {
+        value = 1;
+        return true;
+    }
+    if (!constValue(rhs, r)) return false;
+
+    if (dynamic_cast<Add*>(expr)) value = l + r;
+    else if (dynamic_cast<Sub*>(expr)) value = l - r;
+    else if (dynamic_cast<Mul*>(expr)) value = l * r;
+    else if (dynamic_cast<Div*>(expr)) value = r ? l / r : 0;
+    else if (dynamic_cast<Mod*>(expr)) value = r ? l % r : 0;
+    else if (dynamic_cast<BitwiseAnd*>(expr)) value = l & r;
+    else if (dynamic_cast<BitwiseOr*>(expr)) value = l | r;
+    else if (dynamic_cast<And*>(expr) || dynamic_cast<Or*>(expr)) value = r ? 1 : 0;
+    else return false;
+    return true;
+}
+
+uint32_t BytecodeCompiler::constant(int value) {
+    std::map<int,int>::iterator it = constantSlots.find(value);
+    if (it != constantSlots.end())
+        return BC_OPERAND(BC_BANK_CONST, it->second);
+    const int slot = int(bc->constants.size());
+    bc->constants.push_back(value);
+    constantSlots[value] = slot;
+    return BC_OPERAND(BC_BANK_CONST, slot);
+}
+
+uint32_t BytecodeCompiler::arraySlot(IntArrayExpr* array) {
+    std::map<IntArrayExpr*,int>::iterator it = arraySlots.find(array);
+    if (it != arraySlots.end()) return it->second;
+
+    BytecodeArray arr = { NULL, 0, array };
+    IntArrayVariable* variable = dynamic_cast<IntArrayVariable*>(array);
+    if (variable && !dynamic_cast<BuiltInIntArrayVariable*>(array) &&
+        !variable->values.empty())
+    {
+        arr.data = &variable->values[0];
+        arr.size = variable->values.size();
+    }
+    const int slot = int(bc->arrays.size());
+    bc->arrays.push_back(arr);
+    arraySlots[array] = slot;
+    return slot;
+}
+
+uint32_t BytecodeCompiler::allocRegister() {
+    if (registerTop >= bc->registerCount)
+        bc->registerCount = registerTop + 1;
+    return BC_OPERAND(BC_BANK_REGISTER, registerTop++);
+}
+
+uint32_t BytecodeCompiler::destOrRegister(int64_t dest) {
+    return (dest < 0) ? allocRegister() : uint32_t(dest);
+}
+
+int BytecodeCompiler::emit(uint8_t op, uint32_t a, uint32_t b, uint32_t c) {
+    BytecodeInstr in;
+    in.op = op;
+    in.flags = 0;
+    in.a = a;
+    in.b = b;
+    in.c = c;
+    bc->code.push_back(in);
+    return int(bc->code.size()) - 1;
+}
+
+void BytecodeCompiler::emitExec(LeafStatement* leaf) {
+    emit(BC_EXEC, 0, uint32_t(bc->leafs.size()), uint32_t(statementStart));
+    bc->leafs.push_back(leaf);
+}
+
+/// Sets the jump target of all given jump instructions.
+void BytecodeCompiler::patch(const std::vector<int>& jumps, int target) {
+    for (int i = 0; i < jumps.size(); ++i)
+        bc->code[jumps[i]].a = uint32_t(target);
+}
+
+/// Counts the statement which started at @a start as one VM instruction.
+void BytecodeCompiler::markStep(size_t start) {
+    if (bc->code.size() > start)
+        bc->code.back().flags |= BC_FLAG_STEP;
+}
+
+} // namespace LinuxSampler
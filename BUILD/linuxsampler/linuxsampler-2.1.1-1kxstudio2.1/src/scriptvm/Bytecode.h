@@ -0,0 +1,161 @@
+/*                                                              -*- c++ -*-
+ *
+ * Copyright (c) 2026
+ *
+ * http://www.linuxsampler.org
+ *
+ * This file is part of LinuxSampler and released under the same terms.
+ * See README file for details.
+ */
+
+// Bytecode representation of event handlers, only used inside the core VM
+// implementation of this source directory.
+
+#ifndef LS_INSTRSCRIPTBYTECODE_H
+#define LS_INSTRSCRIPTBYTECODE_H
+
+#include <vector>
+#include <map>
+#include <stdint.h>
+#include "tree.h"
+
+namespace LinuxSampler {
+
+/**
+ * Operands of bytecode instructions address one integer slot, the upper 4
+ * bits select the memory bank and the remaining bits the slot within it.
+ */
+enum BytecodeBank_t {
+    BC_BANK_REGISTER = 0, ///< temporary registers of the ExecContext
+    BC_BANK_GLOBAL   = 1, ///< global int variables (ParserContext)
+    BC_BANK_POLY     = 2, ///< polyphonic int variables (ExecContext)
+    BC_BANK_CONST    = 3, ///< constant pool of the Bytecode
+};
+
+#define BC_OPERAND(bank, index) ((uint32_t(bank) << 28) | uint32_t(index))
+#define BC_OPERAND_BANK(op)     ((op) >> 28)
+#define BC_OPERAND_INDEX(op)    ((op) & 0x0fffffff)
+
+enum BytecodeOp_t {
+    BC_MOV,         ///< A := B
+    BC_ADD,         ///< A := B + C
+    BC_SUB,         ///< A := B - C
+    BC_MUL,         ///< A := B * C
+    BC_DIV,         ///< A := B / C (0 on division by zero)
+    BC_MOD,         ///< A := B % C (0 on division by zero)
+    BC_BAND,        ///< A := B & C
+    BC_BOR,         ///< A := B | C
+    BC_LT,          ///< A := B < C
+    BC_GT,          ///< A := B > C
+    BC_LE,          ///< A := B <= C
+    BC_GE,          ///< A := B >= C
+    BC_EQ,          ///< A := B == C
+    BC_NE,          ///< A := B != C
+    BC_NEG,         ///< A := -B
+    BC_NOT,         ///< A := !B
+    BC_BNOT,        ///< A := ~B
+    BC_JMP,         ///< jump to A
+    BC_JZ,          ///< jump to A if B == 0
+    BC_JNZ,         ///< jump to A if B != 0
+    BC_JLT,         ///< jump to A if B < C
+    BC_JGT,         ///< jump to A if B > C
+    BC_JLE,         ///< jump to A if B <= C
+    BC_JGE,         ///< jump to A if B >= C
+    BC_JEQ,         ///< jump to A if B == C
+    BC_JNE,         ///< jump to A if B != C
+    BC_LOOP,        ///< start of a while() loop iteration, may auto suspend the script
+    BC_ARR_LOAD,    ///< A := array B [C]
+    BC_ARR_STORE,   ///< array B [C] := A
+    BC_RELPTR_LOAD, ///< A := built-in variable B
+    BC_EVAL,        ///< A := expression B evaluated by the parser tree, statement starts at C
+    BC_EXEC,        ///< execute leaf statement B by the parser tree, statement starts at C
+    BC_SYNC_BEGIN,  ///< enter synchronized block
+    BC_SYNC_END,    ///< leave synchronized block
+    BC_END,         ///< end of event handler
+};
+
+/// Instruction counts as one VM instruction (statement or branch decision).
+#define BC_FLAG_STEP 1
+
+struct BytecodeInstr {
+    uint8_t  op;
+    uint8_t  flags;
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+};
+
+/**
+ * Array accessed by BC_ARR_LOAD and BC_ARR_STORE. User declared arrays are
+ * accessed directly, all others by their virtual methods.
+ */
+struct BytecodeArray {
+    int* data;
+    int size;
+    IntArrayExpr* expr;
+};
+
+/**
+ * Event handler lowered to bytecode by the BytecodeCompiler. Only integer
+ * arithmetics, variables and control flow are translated, everything else
+ * (function calls, strings, dynamic variables) is executed by the
+ * respective parser tree nodes which the bytecode refers to.
+ */
+class Bytecode {
+public:
+    std::vector<BytecodeInstr> code;
+    std::vector<int> constants;
+    std::vector<BytecodeArray> arrays;
+    std::vector<VMIntRelPtr*> relPtrs;
+    std::vector<IntExpr*> exprs;
+    std::vector<LeafStatement*> leafs;
+    int registerCount;
+
+    Bytecode() : registerCount(0) {}
+    void dump();
+};
+
+/**
+ * Translates the parsed VM tree of an event handler to bytecode, folding
+ * constant expressions and resolving variables to their memory slots on
+ * the way.
+ */
+class BytecodeCompiler {
+public:
+    /**
+     * Returns the bytecode of the given event handler, or NULL if the
+     * handler uses a construct which can only be executed by the tree
+     * based VM.
+     */
+    static Bytecode* compile(EventHandler* handler);
+
+private:
+    BytecodeCompiler();
+    bool compileStatements(Statements* statements);
+    bool compileStatement(Statement* statement);
+    bool compileAssignment(Assignment* assignment);
+    bool compileIf(If* stmt);
+    bool compileSelectCase(SelectCase* stmt);
+    bool compileWhile(While* stmt);
+    uint32_t compileExpr(IntExpr* expr, int64_t dest = -1);
+    void compileCond(IntExpr* expr, bool jumpIf, std::vector<int>& jumps);
+    bool constValue(IntExpr* expr, int& value);
+    uint32_t constant(int value);
+    uint32_t arraySlot(IntArrayExpr* array);
+    uint32_t allocRegister();
+    uint32_t destOrRegister(int64_t dest);
+    int emit(uint8_t op, uint32_t a = 0, uint32_t b = 0, uint32_t c = 0);
+    void emitExec(LeafStatement* leaf);
+    void patch(const std::vector<int>& jumps, int target);
+    void markStep(size_t start);
+
+    Bytecode* bc;
+    std::map<int,int> constantSlots;
+    std::map<IntArrayExpr*,int> arraySlots;
+    int registerTop;
+    int statementStart; ///< where forked child scripts resume the current statement
+};
+
+} // namespace LinuxSampler
+
+#endif // LS_INSTRSCRIPTBYTECODE_H
@@ -13,6 +13,7 @@
 #include <assert.h>
 #include "../common/global_private.h"
 #include "tree.h"
+#include "Bytecode.h"
 #include "CoreVMFunctions.h"
 #include "CoreVMDynVars.h"
 #include "editor/NkspScanner.h"
@@ -143,7 +144,7 @@ namespace LinuxSampler {
         return max;
     }
 
-    ScriptVM::ScriptVM() : m_eventHandler(NULL), m_parserContext(NULL), m_autoSuspend(true) {
+    ScriptVM::ScriptVM() : m_eventHandler(NULL), m_parserContext(NULL), m_autoSuspend(true), m_bytecode(true) {
         m_fnMessage = new CoreVMFunction_message;
         m_fnExit = new CoreVMFunction_exit;
         m_fnWait = new CoreVMFunction_wait(this);
@@ -215,6 +216,14 @@ namespace LinuxSampler {
 
         context->destroyScanner();
 
+        if (context->vErrors.empty() && context->handlers) {
+            for (int i = 0; EventHandler* h = context->handlers->eventHandler(i); ++i) {
+                h->bytecode = BytecodeCompiler::compile(h);
+                if (!h->bytecode)
+                    dmsg(2,("Event handler '%s' can't be compiled to bytecode.\n", h->eventHandlerName().c_str()));
+            }
+        }
+
         return context;
     }
 
@@ -233,6 +242,11 @@ namespace LinuxSampler {
             return;
         }
         ctx->handlers->dump();
+        for (int i = 0; EventHandler* h = ctx->handlers->eventHandler(i); ++i) {
+            if (!h->bytecode) continue;
+            printf("[Bytecode of event handler '%s']\n", h->eventHandlerName().c_str());
+            h->bytecode->dump();
+        }
     }
 
     VMExecContext* ScriptVM::createExecContext(VMParserContext* parserContext) {
@@ -252,6 +266,14 @@ namespace LinuxSampler {
         memset(&execCtx->polyphonicIntMemory[0], 0, polySize * sizeof(int));
 
         dmsg(2,("Allocated %ld bytes polyphonic memory.\n", long(polySize * sizeof(int))));
+
+        int registerCount = 0;
+        for (int i = 0; parserCtx->handlers && parserCtx->handlers->eventHandler(i); ++i) {
+            Bytecode* bc = parserCtx->handlers->eventHandler(i)->bytecode;
+            if (bc && registerCount < bc->registerCount)
+                registerCount = bc->registerCount;
+        }
+        execCtx->registers.resize(registerCount);
         return execCtx;
     }
 
@@ -357,6 +379,14 @@ namespace LinuxSampler {
         return m_autoSuspend;
     }
 
+    void ScriptVM::setBytecodeEnabled(bool b) {
+        m_bytecode = b;
+    }
+
+    bool ScriptVM::isBytecodeEnabled() const {
+        return m_bytecode;
+    }
+
     VMExecStatus_t ScriptVM::exec(VMParserContext* parserContext, VMExecContext* execContex, VMEventHandler* handler) {
         m_parserContext = dynamic_cast<ParserContext*>(parserContext);
         if (!m_parserContext) {
@@ -385,7 +415,9 @@ namespace LinuxSampler {
         int synced = m_autoSuspend ? 0 : 1;
 
         int& frameIdx = ctx->stackFrame;
-        if (frameIdx < 0) { // start condition ...
+        if (frameIdx < 0 && h->bytecode && (ctx->bytecodePos >= 0 || m_bytecode)) {
+            instructionsCounter = execBytecode(ctx, h->bytecode);
+        } else if (frameIdx < 0) { // start condition ...
             frameIdx = -1;
             ctx->pushStack(h);
         }
@@ -516,4 +548,135 @@ namespace LinuxSampler {
         return ctx->status;
     }
 
+    /**
+     * Executes (or resumes) the given event handler's bytecode, until it
+     * either finished or was suspended. This is the counterpart of the tree
+     * walking loop in exec() with the same semantics: one VM instruction is
+     * one statement or branch decision, and the script is only suspended at
+     * those points. Calls to built-in functions and anything else not
+     * translated by the BytecodeCompiler are executed by the respective
+     * nodes of the VM tree.
+     *
+     * @returns amount of VM instructions performed
+     */
+    int ScriptVM::execBytecode(ExecContext* ctx, Bytecode* bc) {
+        StmtFlags_t& flags = ctx->flags;
+        int instructionsCounter = 0;
+        int synced = (m_autoSuspend ? 0 : 1) + ctx->syncDepth;
+
+        ArrayList<int>& globalMemory = *m_parserContext->globalIntMemory;
+        int* banks[4] = {
+            ctx->registers.empty() ? NULL : &ctx->registers[0],
+            globalMemory.empty() ? NULL : &globalMemory[0],
+            ctx->polyphonicIntMemory.empty() ? NULL : &ctx->polyphonicIntMemory[0],
+            bc->constants.empty() ? NULL : &bc->constants[0]
+        };
+        #define BC_VALUE(op) banks[BC_OPERAND_BANK(op)][BC_OPERAND_INDEX(op)]
+
+        const BytecodeInstr* code = &bc->code[0];
+        int pc = (ctx->bytecodePos >= 0) ? ctx->bytecodePos : 0;
+
+        while (flags == STMT_SUCCESS) {
+            const BytecodeInstr& in = code[pc++];
+            switch (in.op) {
+                case BC_MOV:  BC_VALUE(in.a) = BC_VALUE(in.b); break;
+                case BC_ADD:  BC_VALUE(in.a) = BC_VALUE(in.b) + BC_VALUE(in.c); break;
+                case BC_SUB:  BC_VALUE(in.a) = BC_VALUE(in.b) - BC_VALUE(in.c); break;
+                case BC_MUL:  BC_VALUE(in.a) = BC_VALUE(in.b) * BC_VALUE(in.c); break;
+                case BC_DIV: {
+                    const int r = BC_VALUE(in.c);
+                    BC_VALUE(in.a) = r ? BC_VALUE(in.b) / r : 0;
+                    break;
+                }
+                case BC_MOD: {
+                    const int r = BC_VALUE(in.c);
+                    BC_VALUE(in.a) = r ? BC_VALUE(in.b) % r : 0;
+                    break;
+                }
+                case BC_BAND: BC_VALUE(in.a) = BC_VALUE(in.b) & BC_VALUE(in.c); break;
+                case BC_BOR:  BC_VALUE(in.a) = BC_VALUE(in.b) | BC_VALUE(in.c); break;
+                case BC_LT:   BC_VALUE(in.a) = BC_VALUE(in.b) <  BC_VALUE(in.c); break;
+                case BC_GT:   BC_VALUE(in.a) = BC_VALUE(in.b) >  BC_VALUE(in.c); break;
+                case BC_LE:   BC_VALUE(in.a) = BC_VALUE(in.b) <= BC_VALUE(in.c); break;
+                case BC_GE:   BC_VALUE(in.a) = BC_VALUE(in.b) >= BC_VALUE(in.c); break;
+                case BC_EQ:   BC_VALUE(in.a) = BC_VALUE(in.b) == BC_VALUE(in.c); break;
+                case BC_NE:   BC_VALUE(in.a) = BC_VALUE(in.b) != BC_VALUE(in.c); break;
+                case BC_NEG:  BC_VALUE(in.a) = -BC_VALUE(in.b); break;
+                case BC_NOT:  BC_VALUE(in.a) = !BC_VALUE(in.b); break;
+                case BC_BNOT: BC_VALUE(in.a) = ~BC_VALUE(in.b); break;
+                case BC_JMP:  pc = in.a; break;
+                case BC_JZ:   if (!BC_VALUE(in.b)) pc = in.a; break;
+                case BC_JNZ:  if (BC_VALUE(in.b)) pc = in.a; break;
+                case BC_JLT:  if (BC_VALUE(in.b) <  BC_VALUE(in.c)) pc = in.a; break;
+                case BC_JGT:  if (BC_VALUE(in.b) >  BC_VALUE(in.c)) pc = in.a; break;
+                case BC_JLE:  if (BC_VALUE(in.b) <= BC_VALUE(in.c)) pc = in.a; break;
+                case BC_JGE:  if (BC_VALUE(in.b) >= BC_VALUE(in.c)) pc = in.a; break;
+                case BC_JEQ:  if (BC_VALUE(in.b) == BC_VALUE(in.c)) pc = in.a; break;
+                case BC_JNE:  if (BC_VALUE(in.b) != BC_VALUE(in.c)) pc = in.a; break;
+                case BC_LOOP:
+                    if (!synced && instructionsCounter > SCRIPTVM_MAX_INSTR_PER_CYCLE_SOFT) {
+                        flags = StmtFlags_t(STMT_SUSPEND_SIGNALLED);
+                        ctx->suspendMicroseconds = SCRIPT_VM_FORCE_SUSPENSION_MICROSECONDS;
+                    }
+                    break;
+                case BC_ARR_LOAD: {
+                    const BytecodeArray& array = bc->arrays[in.b];
+                    const int i = BC_VALUE(in.c);
+                    if (array.data)
+                        BC_VALUE(in.a) = (i >= 0 && i < array.size) ? array.data[i] : 0;
+                    else
+                        BC_VALUE(in.a) = (i >= 0 && i < array.expr->arraySize()) ? array.expr->evalIntElement(i) : 0;
+                    break;
+                }
+                case BC_ARR_STORE: {
+                    const BytecodeArray& array = bc->arrays[in.b];
+                    const int i = BC_VALUE(in.c);
+                    if (array.data) {
+                        if (i >= 0 && i < array.size) array.data[i] = BC_VALUE(in.a);
+                    } else if (i >= 0 && i < array.expr->arraySize()) {
+                        array.expr->assignIntElement(i, BC_VALUE(in.a));
+                    }
+                    break;
+                }
+                case BC_RELPTR_LOAD:
+                    BC_VALUE(in.a) = bc->relPtrs[in.b]->evalInt();
+                    break;
+                case BC_EVAL:
+                    // a child forked by this call restarts the statement
+                    ctx->bytecodePos = in.c;
+                    BC_VALUE(in.a) = bc->exprs[in.b]->evalInt();
+                    break;
+                case BC_EXEC:
+                    ctx->bytecodePos = in.c;
+                    flags = bc->leafs[in.b]->exec();
+                    break;
+                case BC_SYNC_BEGIN:
+                    ++ctx->syncDepth;
+                    ++synced;
+                    break;
+                case BC_SYNC_END:
+                    --ctx->syncDepth;
+                    --synced;
+                    break;
+                case BC_END:
+                    ctx->bytecodePos = -1;
+                    return instructionsCounter;
+            }
+
+            if (in.flags & BC_FLAG_STEP) {
+                if (flags == STMT_SUCCESS && !synced &&
+                    instructionsCounter > SCRIPTVM_MAX_INSTR_PER_CYCLE_HARD)
+                {
+                    flags = StmtFlags_t(STMT_SUSPEND_SIGNALLED);
+                    ctx->suspendMicroseconds = SCRIPT_VM_FORCE_SUSPENSION_MICROSECONDS;
+                }
+                ++instructionsCounter;
+            }
+        }
+        #undef BC_VALUE
+
+        ctx->bytecodePos = pc;
+        return instructionsCounter;
+    }
+
 } // namespace LinuxSampler
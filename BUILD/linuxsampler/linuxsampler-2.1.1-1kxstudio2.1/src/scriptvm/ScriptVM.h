@@ -20,6 +20,7 @@ namespace LinuxSampler {
 
     class ParserContext;
     class ExecContext;
+    class Bytecode;
 
     /** @brief Core virtual machine for real-time instrument scripts.
      *
@@ -267,6 +268,28 @@ namespace LinuxSampler {
          */
         bool isAutoSuspendEnabled() const;
 
+        /**
+         * Enables or disables execution of scripts as bytecode. When a
+         * script is loaded, its event handlers are additionally compiled
+         * to a compact bytecode, which is executed considerably faster than
+         * walking the parsed VM tree. Script behavior, including
+         * suspension of scripts, is the same for both.
+         *
+         * Bytecode execution is enabled by default. Disabling it only makes
+         * sense for debugging or benchmarking the VM. Scripts currently
+         * suspended are resumed the way they were started.
+         *
+         * @param b - true: execute scripts as bytecode [default],
+         *            false: always execute the parsed VM tree
+         */
+        void setBytecodeEnabled(bool b = true);
+
+        /**
+         * Returns true in case scripts are executed as bytecode. See
+         * setBytecodeEnabled() for details.
+         */
+        bool isBytecodeEnabled() const;
+
         VMEventHandler* currentVMEventHandler(); //TODO: should be protected (only usable during exec() calls, intended only for VMFunctions)
         VMParserContext* currentVMParserContext(); //TODO: should be protected (only usable during exec() calls, intended only for VMFunctions)
         VMExecContext* currentVMExecContext(); //TODO: should be protected (only usable during exec() calls, intended only for VMFunctions)
@@ -275,6 +298,7 @@ namespace LinuxSampler {
         VMEventHandler* m_eventHandler;
         ParserContext* m_parserContext;
         bool m_autoSuspend;
+        bool m_bytecode;
         class CoreVMFunction_message* m_fnMessage;
         class CoreVMFunction_exit* m_fnExit;
         class CoreVMFunction_wait* m_fnWait;
@@ -293,6 +317,9 @@ namespace LinuxSampler {
         class CoreVMFunction_sort* m_fnSort;
         class CoreVMDynVar_NKSP_REAL_TIMER* m_varRealTimer;
         class CoreVMDynVar_NKSP_PERF_TIMER* m_varPerfTimer;
+
+    private:
+        int execBytecode(ExecContext* ctx, Bytecode* bc);
     };
 
 } // namespace LinuxSampler
@@ -10,6 +10,7 @@
 #include <cstdio>
 #include <string.h>
 #include "tree.h"
+#include "Bytecode.h"
 #include "../common/global_private.h"
 #include <assert.h>
 
@@ -222,11 +223,15 @@ StmtFlags_t Assignment::exec() {
     return STMT_SUCCESS;
 }
 
-EventHandler::EventHandler(StatementsRef statements) {
+EventHandler::EventHandler(StatementsRef statements) : bytecode(NULL) {
     this->statements = statements;
     usingPolyphonics = statements->isPolyphonic();
 }
 
+EventHandler::~EventHandler() {
+    if (bytecode) delete bytecode;
+}
+
 void EventHandler::dump(int level) {
     printIndents(level);
     printf("EventHandler {\n");
@@ -1074,6 +1079,8 @@ void ExecContext::forkTo(VMExecContext* ectx) const {
     child->flags = STMT_SUCCESS;
     child->stack.copyFlatFrom(stack);
     child->stackFrame = stackFrame;
+    child->bytecodePos = bytecodePos;
+    child->syncDepth = syncDepth;
     child->suspendMicroseconds = 0;
     child->instructionsCount = 0;
 }
@@ -30,6 +30,8 @@ namespace LinuxSampler {
     
 class ParserContext;
 class ExecContext;
+class Bytecode;
+class BytecodeCompiler;
 
 enum StmtType_t {
     STMT_LEAF,
@@ -83,6 +85,7 @@ typedef Ref<StringExpr,Node> StringExprRef;
 
 class IntLiteral : virtual public IntExpr {
     int value;
+    friend class BytecodeCompiler;
 public:
     IntLiteral(int value) : value(value) { }
     int evalInt();
@@ -121,6 +124,8 @@ public:
     virtual void assign(Expression* expr) = 0;
     void assignExpr(VMExpr* expr) OVERRIDE { Expression* e = dynamic_cast<Expression*>(expr); if (e) assign(e); }
 protected:
+    friend class BytecodeCompiler;
+
     Variable(ParserContext* ctx, int _memPos, bool _bConst)
         : context(ctx), memPos(_memPos), bConst(_bConst) {}
 
@@ -158,6 +163,7 @@ typedef Ref<ConstIntVariable,Node> ConstIntVariableRef;
 class BuiltInIntVariable : public IntVariable {
     String name;
     VMIntRelPtr* ptr;
+    friend class BytecodeCompiler;
 public:
     BuiltInIntVariable(const String& name, VMIntRelPtr* ptr);
     bool isAssignable() const OVERRIDE { return !ptr->readonly; }
@@ -176,6 +182,7 @@ typedef Ref<PolyphonicIntVariable,Node> PolyphonicIntVariableRef;
 
 class IntArrayVariable : public Variable, virtual public IntArrayExpr {
     ArrayList<int> values;
+    friend class BytecodeCompiler;
 public:
     IntArrayVariable(ParserContext* ctx, int size);
     IntArrayVariable(ParserContext* ctx, int size, ArgsRef values, bool _bConst = false);
@@ -208,6 +215,7 @@ typedef Ref<BuiltInIntArrayVariable,Node> BuiltInIntArrayVariableRef;
 class IntArrayElement : public IntVariable {
     IntArrayExprRef array;
     IntExprRef index;
+    friend class BytecodeCompiler;
 public:
     IntArrayElement(IntArrayExprRef array, IntExprRef arrayIndex);
     void assign(Expression* expr);
@@ -243,6 +251,7 @@ class BinaryOp : virtual public Expression {
 protected:
     ExpressionRef lhs;
     ExpressionRef rhs;
+    friend class BytecodeCompiler;
 public:
     BinaryOp(ExpressionRef lhs, ExpressionRef rhs) : lhs(lhs), rhs(rhs) { }
     bool isConstExpr() const { return lhs->isConstExpr() && rhs->isConstExpr(); }
@@ -387,9 +396,12 @@ class EventHandler : virtual public Statements, virtual public VMEventHandler {
     StatementsRef statements;
     bool usingPolyphonics;
 public:
+    Bytecode* bytecode; ///< compiled handler, NULL if it can only be executed as tree
+
     void dump(int level = 0);
     StmtFlags_t exec();
     EventHandler(StatementsRef statements);
+    virtual ~EventHandler();
     Statement* statement(uint i) { return statements->statement(i); }
     bool isPolyphonic() const { return usingPolyphonics; }
 };
@@ -446,6 +458,7 @@ class Assignment : public LeafStatement {
 protected:
     VariableRef variable;
     ExpressionRef value;
+    friend class BytecodeCompiler;
 public:
     Assignment(VariableRef variable, ExpressionRef value);
     void dump(int level = 0);
@@ -458,6 +471,7 @@ class If : public BranchStatement {
     IntExprRef condition;
     StatementsRef ifStatements;
     StatementsRef elseStatements;
+    friend class BytecodeCompiler;
 public:
     If(IntExprRef condition, StatementsRef ifStatements, StatementsRef elseStatements) :
         condition(condition), ifStatements(ifStatements), elseStatements(elseStatements) { }
@@ -481,6 +495,7 @@ typedef std::vector<CaseBranch> CaseBranches;
 class SelectCase : public BranchStatement {
     IntExprRef select;
     CaseBranches branches;
+    friend class BytecodeCompiler;
 public:
     SelectCase(IntExprRef select, const CaseBranches& branches) : select(select), branches(branches) { }
     void dump(int level = 0);
@@ -497,6 +512,7 @@ typedef Ref<SelectCase,Node> SelectCaseRef;
 class While : public Statement {
     IntExprRef m_condition;
     StatementsRef m_statements;
+    friend class BytecodeCompiler;
 public:
     While(IntExprRef condition, StatementsRef statements) :
         m_condition(condition), m_statements(statements) {}
@@ -520,6 +536,7 @@ typedef Ref<SyncBlock,Node> SyncBlockRef;
 
 class Neg : public IntExpr {
     IntExprRef expr;
+    friend class BytecodeCompiler;
 public:
     Neg(IntExprRef expr) : expr(expr) { }
     int evalInt() { return (expr) ? -expr->evalInt() : 0; }
@@ -561,6 +578,7 @@ private:
     IntExprRef lhs;
     IntExprRef rhs;
     Type type;
+    friend class BytecodeCompiler;
 };
 typedef Ref<Relation,Node> RelationRef;
 
@@ -598,6 +616,7 @@ typedef Ref<BitwiseAnd,Node> BitwiseAndRef;
 
 class Not : virtual public IntExpr {
     IntExprRef expr;
+    friend class BytecodeCompiler;
 public:
     Not(IntExprRef expr) : expr(expr) {}
     int evalInt() { return !expr->evalInt(); }
@@ -609,6 +628,7 @@ typedef Ref<Not,Node> NotRef;
 
 class BitwiseNot : virtual public IntExpr {
     IntExprRef expr;
+    friend class BytecodeCompiler;
 public:
     BitwiseNot(IntExprRef expr) : expr(expr) {}
     int evalInt() { return ~expr->evalInt(); }
@@ -709,10 +729,14 @@ public:
     int stackFrame;
     int suspendMicroseconds;
     size_t instructionsCount;
+    ArrayList<int> registers; ///< temporaries of the bytecode executor
+    int bytecodePos; ///< bytecode instruction to resume with, -1 if not executing bytecode
+    int syncDepth; ///< synchronized blocks entered by the bytecode executor
 
     ExecContext() :
         status(VM_EXEC_NOT_RUNNING), flags(STMT_SUCCESS), stackFrame(-1),
-        suspendMicroseconds(0), instructionsCount(0) {}
+        suspendMicroseconds(0), instructionsCount(0), bytecodePos(-1),
+        syncDepth(0) {}
 
     virtual ~ExecContext() {}
 
@@ -735,6 +759,8 @@ public:
         stack[0].statement = NULL;
         stack[0].subindex  = -1;
         stackFrame = -1;
+        bytecodePos = -1;
+        syncDepth = 0;
         flags = STMT_SUCCESS;
     }
 
@@ -11,6 +11,7 @@
 #include <iostream>
 #include <sstream>
 #include <string.h>
+#include <fstream>
 
 #include "lscp.h"
 #include "LSCPClient.h"
@@ -26,6 +27,7 @@
 #include "../common/global.h"
 #include "../common/global_private.h"
 #include "../common/Condition.h"
+#include "../common/RTMath.h"
 
 #define LSCP_DEFAULT_HOST "localhost"
 #define LSCP_DEFAULT_PORT 8888
@@ -74,7 +76,7 @@ void lscpLog(const char* format, ...) {
 static void printUsage() {
     cout << "lscp - The LinuxSampler Control Protocol (LSCP) Shell." << endl;
     cout << endl;
-    cout << "Usage: lscp [-h HOSTNAME] [-p PORT]" << endl;
+    cout << "Usage: lscp [-h HOSTNAME] [-p PORT] [-f FILE]" << endl;
     cout << endl;
     cout << "   -h  Host name of LSCP server (default \"" << LSCP_DEFAULT_HOST << "\")." << endl;
     cout << endl;
@@ -84,6 +86,9 @@ static void printUsage() {
     cout << endl;
     cout << "   --no-doc  Don't show LSCP reference documentation on screen." << endl;
     cout << endl;
+    cout << "   -f  Send the LSCP commands of FILE to the sampler as one batch and" << endl;
+    cout << "       quit, instead of running an interactive shell." << endl;
+    cout << endl;
 }
 
 static void printWelcome() {
@@ -122,6 +127,67 @@ static void onLSCPClientErrorOccured(LSCPClient* client) {
     quitApp();
 }
 
+/**
+ * Sends all commands of the LSCP file @a filename as one batch to the sampler
+ * (see BEGIN BATCH / END BATCH in the LSCP specs), prints the errors and
+ * warnings reported for the batch and its summary. Returns the exit code for
+ * the application.
+ */
+static int runFile(const String& filename) {
+    std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!file) {
+        cerr << "Error: could not open file \"" << filename << "\"\n";
+        return -1;
+    }
+    std::stringstream ss;
+    ss << file.rdbuf();
+    String commands = ss.str();
+    if (!commands.empty() && commands[commands.size() - 1] != '\n')
+        commands += '\n';
+
+    const uint64_t t0 = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+
+    String sResponse = g_client->sendCommandSync("BEGIN BATCH");
+    if (sResponse.substr(0, 2) != "OK") {
+        cerr << "Error: sampler too old, it does not support command batches\n";
+        return -1;
+    }
+    g_client->setCallback(onLSCPClientNewInputAvailable);
+    if (!g_client->send(commands + "END BATCH\n")) {
+        cerr << "Error: could not send file to sampler\n";
+        return -1;
+    }
+
+    // the answers of all commands arrive at once, followed by the summary
+    bool bSummary = false;
+    int errors = 0, failedLoads = 0;
+    while (!g_quitAppRequested) {
+        g_todo.WaitIf(false);
+        g_todo.Set(false);
+        g_todo.Unlock();
+
+        while (optional<String> line = g_client->popLine()) {
+            const String& s = *line;
+            if (!bSummary) {
+                if (s.substr(0, 4) == "ERR:" || s.substr(0, 4) == "WRN:")
+                    cout << s << endl;
+                if (s.substr(0, 9) != "COMMANDS:") continue;
+                bSummary = true;
+            }
+            if (s == ".") {
+                const uint64_t t1 = RTMath::unsafeMicroSeconds(RTMath::real_clock);
+                printf("Loaded '%s' in %.3f s\n", filename.c_str(), double(t1 - t0) / 1000000.0);
+                return (errors || failedLoads) ? -1 : 0;
+            }
+            sscanf(s.c_str(), "ERRORS: %d", &errors);
+            sscanf(s.c_str(), "FAILED_LOADS: %d", &failedLoads);
+            cout << s << endl;
+        }
+    }
+    cerr << "Error: connection to sampler lost\n";
+    return -1;
+}
+
 /// Will be called when the user hits tab key to trigger auto completion.
 static void autoComplete() {
     if (g_suggestedPortion.empty()) return;
@@ -298,6 +364,7 @@ int main(int argc, char *argv[]) {
     int port    = LSCP_DEFAULT_PORT;
     bool autoCorrect = true;
     bool showDoc = true;
+    String filename;
 
     // parse command line arguments
     for (int i = 0; i < argc; ++i) {
@@ -318,6 +385,12 @@ int main(int argc, char *argv[]) {
                 cerr << "Error: invalid port argument \"" << argv[i] << "\"\n";
                 return -1;
             }
+        } else if (s == "-f" || s == "--file") {
+            if (++i >= argc) {
+                printUsage();
+                return -1;
+            }
+            filename = argv[i];
         } else if (s == "--no-auto-correct") {
             autoCorrect = false;
         } else if (s == "--no-doc") {
@@ -333,6 +406,11 @@ int main(int argc, char *argv[]) {
     g_client = new LSCPClient;
     g_client->setErrorCallback(onLSCPClientErrorOccured);
     if (!g_client->connect(host, port)) return -1;
+    if (!filename.empty()) {
+        const int res = runFile(filename);
+        delete g_client;
+        return res;
+    }
     g_client->sendCommandSync(
         (showDoc) ? "SET SHELL DOC 1" : "SET SHELL DOC 0"
     );
@@ -0,0 +1,177 @@
+/*
+   Test timing for note on with and without a NotePool
+
+   g++ -Wall -O2 -pthread -I/home/will/yoshimi-code/src /home/will/yoshimi-code/Util/note_pool_time.cpp /home/will/yoshimi-code/src/Misc/NotePool.cpp -o /home/will/yoshimi-code/Util/note_pool_time
+
+   Each thread stands in for a part hammering all its note slots. A 'note'
+   makes roughly the allocations of an AddSynth note with 8 voices at
+   unison 8, 256 frame buffers and 1024 oscillator size.
+   Give the number of threads as an argument, default is 4.
+*/
+
+#include <pthread.h>
+#include <time.h>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "Misc/NotePool.h"
+
+using namespace std;
+
+#define SLOTS 60        // same as POLIPHONY
+#define NOTES 50000     // note ons per thread
+#define MAX_ALLOCS 512
+
+static size_t noteSizes[MAX_ALLOCS];
+static int noteAllocs = 0;
+
+struct Note {
+    void *mem[MAX_ALLOCS];
+};
+
+struct Result {
+    bool usePool;
+    double total;
+    double worst;
+};
+
+
+static void addSize(size_t size, int count = 1)
+{
+    while (count-- > 0)
+        noteSizes[noteAllocs++] = size;
+}
+
+
+static void makeNoteSizes(void)
+{
+    int buffer = 256 * sizeof(float);
+    int oscil = (1024 + 5) * sizeof(float);
+    int unison = 8;
+    addSize(3000);                     // the note itself
+    addSize(unison * sizeof(float*), 2);
+    addSize(buffer, unison * 2);       // unison work buffers
+    addSize(200, 3);                   // global envelopes
+    addSize(100, 3);                   // global LFOs
+    addSize(64, 2);                    // global filters
+    addSize(400, 2);
+    addSize(buffer, 2);
+    for (int voice = 0; voice < 8; ++voice)
+    {
+        addSize(buffer);               // voice out
+        addSize(oscil);                // oscillator copy
+        addSize(unison * sizeof(float), 14);
+        addSize(200, 4);
+        addSize(100, 2);
+        addSize(64, 2);
+        addSize(400, 2);
+        addSize(buffer, 2);
+    }
+}
+
+
+static void noteOn(Note &note)
+{
+    for (int i = 0; i < noteAllocs; ++i)
+    {
+        note.mem[i] = NotePool::get(noteSizes[i]);
+        memset(note.mem[i], 0, noteSizes[i] < 64 ? noteSizes[i] : 64);
+    }
+}
+
+
+static void noteOff(Note &note)
+{
+    for (int i = 0; i < noteAllocs; ++i)
+        NotePool::release(note.mem[i]);
+}
+
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+
+static void *part(void *arg)
+{
+    Result *result = static_cast<Result*>(arg);
+    NotePool pool;
+    if (result->usePool)
+    {
+        NotePool measured(true);
+        {
+            NotePool::Use usePool(&measured);
+            Note note;
+            noteOn(note);
+            noteOff(note);
+        }
+        pool.reserve(measured, SLOTS);
+    }
+
+    static thread_local Note notes[SLOTS];
+    bool playing[SLOTS] = {false};
+    unsigned int seed = 1;
+    result->total = 0;
+    result->worst = 0;
+
+    NotePool::Use usePool(result->usePool ? &pool : NULL);
+    for (int i = 0; i < NOTES; ++i)
+    {
+        int slot = rand_r(&seed) % SLOTS;
+        if (playing[slot])
+            noteOff(notes[slot]);
+        double start = now();
+        noteOn(notes[slot]);
+        double taken = now() - start;
+        playing[slot] = true;
+        result->total += taken;
+        if (taken > result->worst)
+            result->worst = taken;
+    }
+    for (int slot = 0; slot < SLOTS; ++slot)
+        if (playing[slot])
+            noteOff(notes[slot]);
+    if (pool.shortfall())
+        cout << "  pool fell short " << pool.shortfall() << " times" << endl;
+    return NULL;
+}
+
+
+static void run(bool usePool, int threads)
+{
+    pthread_t thread[64];
+    Result result[64];
+    for (int i = 0; i < threads; ++i)
+    {
+        result[i].usePool = usePool;
+        pthread_create(&thread[i], NULL, part, &result[i]);
+    }
+    double total = 0;
+    double worst = 0;
+    for (int i = 0; i < threads; ++i)
+    {
+        pthread_join(thread[i], NULL);
+        total += result[i].total;
+        if (result[i].worst > worst)
+            worst = result[i].worst;
+    }
+    cout << (usePool ? "Pool" : "Heap") << "  mean " << total / (double(NOTES) * threads)
+         << " uS  worst " << worst << " uS" << endl;
+}
+
+
+int main(int argc, char **argv)
+{
+    int threads = (argc > 1) ? atoi(argv[1]) : 4;
+    if (threads < 1 || threads > 64)
+        threads = 4;
+    makeNoteSizes();
+    cout << noteAllocs << " allocations per note, " << threads << " threads" << endl;
+    run(false, threads);
+    run(true, threads);
+    return 0;
+}
@@ -55,7 +55,7 @@ AnalogFilter::AnalogFilter(unsigned char Ftype, float Ffreq, float Fq, unsigned
     firsttime = true;
     d[0] = 0; // this is not used
     outgain = 1.0f;
-    tmpismp = (float*)fftwf_malloc(synth->bufferbytes);
+    tmpismp = (float*)NotePool::get(synth->bufferbytes);
 }
 
 
@@ -86,14 +86,14 @@ AnalogFilter::AnalogFilter(const AnalogFilter &orig) :
     memcpy(yd, orig.yd, sizeof(yd));
 
     // No need to memcpy as this is always memcpy'd to before use
-    tmpismp = (float*)fftwf_malloc(synth->bufferbytes);
+    tmpismp = (float*)NotePool::get(synth->bufferbytes);
 }
 
 
 AnalogFilter::~AnalogFilter()
 {
     if (tmpismp)
-        fftwf_free(tmpismp);
+        NotePool::release(tmpismp);
 }
 
 
@@ -37,6 +37,7 @@ FFTwrapper::FFTwrapper(int fftsize_) :
     data2 = (float*)fftwf_malloc(fftsize * sizeof(float));
     planBasic = fftwf_plan_r2r_1d(fftsize, data1, data1, FFTW_R2HC, FFTW_ESTIMATE);
     planInv = fftwf_plan_r2r_1d(fftsize, data2, data2, FFTW_HC2R, FFTW_ESTIMATE);
+    pthread_mutex_init(&mutex, NULL);
 }
 
 
@@ -46,6 +47,7 @@ FFTwrapper::~FFTwrapper()
     fftwf_destroy_plan(planInv);
     fftwf_free(data1);
     fftwf_free(data2);
+    pthread_mutex_destroy(&mutex);
 }
 
 
@@ -71,22 +73,26 @@ void FFTwrapper::deleteFFTFREQS(FFTFREQS *f)
 // Fast Fourier Transform
 void FFTwrapper::smps2freqs(const float *smps, FFTFREQS *freqs)
 {
+    pthread_mutex_lock(&mutex);
     memcpy(data1, smps, fftsize * sizeof(float));
     fftwf_execute(planBasic);
     memcpy(freqs->c, data1, half_fftsize * sizeof(float));
     for (int i = 1; i < half_fftsize; ++i)
         freqs->s[i] = data1[fftsize - i];
     data2[half_fftsize] = 0.0f;
+    pthread_mutex_unlock(&mutex);
 }
 
 
 // Inverse Fast Fourier Transform
 void FFTwrapper::freqs2smps(const FFTFREQS *freqs, float *smps)
 {
+    pthread_mutex_lock(&mutex);
     memcpy(data2, freqs->c, half_fftsize * sizeof(float));
     data2[half_fftsize] = 0.0;
     for (int i = 1; i < half_fftsize; ++i)
         data2[fftsize - i] = freqs->s[i];
     fftwf_execute(planInv);
     memcpy(smps, data2, fftsize * sizeof(float));
+    pthread_mutex_unlock(&mutex);
 }
@@ -26,6 +26,7 @@
 #define FFT_WRAPPER_H
 
 #include <fftw3.h>
+#include <pthread.h>
 
 typedef struct {
     float *s;
@@ -50,6 +51,7 @@ class FFTwrapper
         float *data2;
         fftwf_plan planBasic;
         fftwf_plan planInv;
+        pthread_mutex_t mutex; // parts may share this across part threads
 };
 
 #endif
@@ -31,6 +31,7 @@
 #include "DSP/FormantFilter.h"
 #include "DSP/SVFilter.h"
 #include "Params/FilterParams.h"
+#include "Misc/NotePool.h"
 
 class SynthEngine;
 
@@ -47,6 +48,8 @@ class Filter
             filter = orig.filter->clone();
         };
         ~Filter();
+        static void *operator new(size_t size) { return NotePool::get(size); }
+        static void operator delete(void *ptr) { NotePool::release(ptr); }
         void filterout(float *smp);
         void setfreq(float frequency);
         void setfreq_and_q(float frequency, float q_);
@@ -27,11 +27,15 @@
 #ifndef FILTER__H
 #define FILTER__H
 
+#include "Misc/NotePool.h"
+
 class Filter_
 {
     public:
         Filter_() { };
         virtual ~Filter_() { };
+        static void *operator new(size_t size) { return NotePool::get(size); }
+        static void operator delete(void *ptr) { NotePool::release(ptr); }
         virtual Filter_* clone() = 0;
         virtual void filterout(float *smp) = 0;
         virtual void setfreq(float frequency) = 0;
@@ -44,8 +44,8 @@ FormantFilter::FormantFilter(FilterParams *pars_, SynthEngine *_synth):
     for (int i = 0; i < numformants; ++i)
         formant[i] = new AnalogFilter(4/*BPF*/, 1000.0f, 10.0f, pars->Pstages, synth);
     cleanup();
-    inbuffer = (float*)fftwf_malloc(synth->bufferbytes);
-    tmpbuf = (float*)fftwf_malloc(synth->bufferbytes);
+    inbuffer = (float*)NotePool::get(synth->bufferbytes);
+    tmpbuf = (float*)NotePool::get(synth->bufferbytes);
 
     for (int i = 0; i < FF_MAX_FORMANTS; ++i)
         oldformantamp[i] = 1.0f;
@@ -99,8 +99,8 @@ FormantFilter::FormantFilter(const FormantFilter &orig) :
         formant[i] = new AnalogFilter(*orig.formant[i]);
 
     // These don't hold persistent state and don't need a memcpy
-    inbuffer = (float*)fftwf_malloc(synth->bufferbytes);
-    tmpbuf = (float*)fftwf_malloc(synth->bufferbytes);
+    inbuffer = (float*)NotePool::get(synth->bufferbytes);
+    tmpbuf = (float*)NotePool::get(synth->bufferbytes);
 }
 
 
@@ -108,8 +108,8 @@ FormantFilter::~FormantFilter()
 {
     for (int i = 0; i < numformants; ++i)
         delete(formant[i]);
-    fftwf_free(inbuffer);
-    fftwf_free(tmpbuf);
+    NotePool::release(inbuffer);
+    NotePool::release(tmpbuf);
 }
 
 
@@ -46,7 +46,7 @@ SVFilter::SVFilter(unsigned char Ftype, float Ffreq, float Fq,
     if (stages >= MAX_FILTER_STAGES)
         stages = MAX_FILTER_STAGES;
     outgain = 1.0f;
-    tmpismp = (float*)fftwf_malloc(synth->bufferbytes);
+    tmpismp = (float*)NotePool::get(synth->bufferbytes);
     cleanup();
     setfreq_and_q(Ffreq, Fq);
 }
@@ -69,14 +69,14 @@ SVFilter::SVFilter(const SVFilter &orig) :
 
     memcpy(st, orig.st, sizeof(st));
 
-    tmpismp = (float*)fftwf_malloc(synth->bufferbytes);
+    tmpismp = (float*)NotePool::get(synth->bufferbytes);
 }
 
 
 SVFilter::~SVFilter()
 {
     if (tmpismp)
-        fftwf_free(tmpismp);
+        NotePool::release(tmpismp);
 }
 
 
@@ -177,6 +177,7 @@ void *InterChange::sortResultsThread(void)
             else
                 resolveReplies(&getData);
         }
+        synth->topUpNotePools();
         usleep(80); // actually gives around 120 uS
     }
     return NULL;
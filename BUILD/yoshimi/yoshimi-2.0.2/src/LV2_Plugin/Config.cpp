@@ -118,6 +118,8 @@ Config::Config(SynthEngine *_synth, int argc, char **argv) :
     bufferChanged(false),
     Oscilsize(512),
     oscilChanged(false),
+    PartThreads(0), // never read from config, the host owns the threading
+    partThreadsChanged(false),
     showGui(true),
     guiChanged(false),
     showCli(true),
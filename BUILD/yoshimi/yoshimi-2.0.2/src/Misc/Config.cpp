@@ -99,6 +99,7 @@ namespace { // constants used in the implementation
         {"name-tag",          'N',  "<tag>",      0,  "add tag to clientname", 0},
         {"samplerate",        'R',  "<rate>",     0,  "set alsa audio sample rate", 0},
         {"oscilsize",         'o',  "<size>",     0,  "set AddSynth oscilator size", 0},
+        {"part-threads",      'T',  "<count>",    0,  "compute parts on extra threads", 0},
         {"state",             'S',  "<file>",     1,  stateText.c_str(), 0},
         #if defined(JACK_SESSION)
             {"jack-session-uuid", 'U',  "<uuid>",     0,  "jack session uuid", 0},
@@ -155,6 +156,8 @@ Config::Config(SynthEngine *_synth, int argc, char **argv) :
     bufferChanged(false),
     Oscilsize(512),
     oscilChanged(false),
+    PartThreads(0),
+    partThreadsChanged(false),
     showGui(true),
     guiChanged(false),
     showCli(true),
@@ -261,6 +264,8 @@ bool Config::Setup(int argc, char **argv)
     if (!midiDevice.size())
         midiDevice = "";
     Oscilsize = nearestPowerOf2(Oscilsize, MIN_OSCIL_SIZE, MAX_OSCIL_SIZE);
+    if (PartThreads > MAX_PART_THREADS)
+        PartThreads = MAX_PART_THREADS;
     Buffersize = nearestPowerOf2(Buffersize, MIN_BUFFER_SIZE, MAX_BUFFER_SIZE);
 
     if (!jUuid.empty())
@@ -620,6 +625,8 @@ bool Config::extractConfigData(XMLwrapper *xml)
             Buffersize = xml->getpar("sound_buffer_size", Buffersize, MIN_BUFFER_SIZE, MAX_BUFFER_SIZE);
         if (!oscilChanged)
             Oscilsize = xml->getpar("oscil_size", Oscilsize, MIN_OSCIL_SIZE, MAX_OSCIL_SIZE);
+        if (!partThreadsChanged)
+            PartThreads = xml->getpar("part_threads", PartThreads, 0, MAX_PART_THREADS);
         single_row_panel = xml->getpar("single_row_panel", single_row_panel, 0, 1);
         toConsole = xml->getpar("reports_destination", toConsole, 0, 1);
         hideErrors = xml->getpar("hide_system_errors", hideErrors, 0, 1);
@@ -745,6 +752,7 @@ void Config::addConfigXML(XMLwrapper *xml)
     xml->addpar("sample_rate", synth->getRuntime().Samplerate);
     xml->addpar("sound_buffer_size", synth->getRuntime().Buffersize);
     xml->addpar("oscil_size", synth->getRuntime().Oscilsize);
+    xml->addpar("part_threads", synth->getRuntime().PartThreads);
 
     xml->addpar("single_row_panel", single_row_panel);
     xml->addpar("reports_destination", toConsole);
@@ -932,6 +940,7 @@ void Config::StartupReport(const string& clientName)
         Log("Oscilsize: " + asString(synth->oscilsize), 2);
         Log("Samplerate: " + asString(synth->samplerate), 2);
         Log("Period size: " + asString(synth->buffersize), 2);
+        Log("Part threads: " + asString(PartThreads), 2);
     }
 }
 
@@ -1416,6 +1425,15 @@ static error_t parse_cmds (int key, char *arg, struct argp_state *state)
             settings->Oscilsize = string2int(string(arg));
             break;
 
+        case 'T':
+        {
+            int count = string2int(string(arg));
+            settings->configChanged = true;
+            settings->partThreadsChanged = true;
+            settings->PartThreads = (count > 0) ? count : 0;
+            break;
+        }
+
         case 'R':
             settings->configChanged = true;
             settings->rateChanged = true;
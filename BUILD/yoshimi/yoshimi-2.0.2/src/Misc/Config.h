@@ -150,6 +150,8 @@ class Config
         bool          bufferChanged;
         unsigned int  Oscilsize;
         bool          oscilChanged;
+        unsigned int  PartThreads;
+        bool          partThreadsChanged;
         bool          showGui;
         bool          guiChanged;
         bool          showCli;
@@ -0,0 +1,213 @@
+/*
+    NotePool.cpp - preallocated memory for notes
+
+    Copyright 2026, agent
+
+    This file is part of yoshimi, which is free software: you can redistribute
+    it and/or modify it under the terms of the GNU Library General Public
+    License as published by the Free Software Foundation; either version 2 of
+    the License, or (at your option) any later version.
+
+    yoshimi is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.   See the GNU General Public License (version 2 or
+    later) for more details.
+
+    You should have received a copy of the GNU General Public License along with
+    yoshimi; if not, write to the Free Software Foundation, Inc., 51 Franklin
+    Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+*/
+
+#include <cstdlib>
+#include <new>
+
+#include "Misc/NotePool.h"
+
+thread_local NotePool *NotePool::current = NULL;
+
+
+NotePool::NotePool(bool _counting) :
+    counting(_counting),
+    missedTotal(0),
+    hungry(false),
+    reserved(0)
+{
+    for (int i = 0; i < NOTE_POOL_CLASSES; ++i)
+    {
+        freeList[i] = NULL;
+        incoming[i].store(NULL);
+        missed[i].store(0);
+        live[i] = 0;
+        peak[i] = 0;
+        owned[i] = 0;
+    }
+    pthread_mutex_init(&growMutex, NULL);
+}
+
+
+NotePool::~NotePool()
+{
+    // every block must have been released by now
+    for (size_t i = 0; i < chunks.size(); ++i)
+        free(chunks[i]);
+    pthread_mutex_destroy(&growMutex);
+}
+
+
+int NotePool::classFor(size_t bytes)
+{
+    for (int i = 0; i < NOTE_POOL_CLASSES; ++i)
+    {
+        if (bytes <= (size_t(32) << i))
+            return i;
+    }
+    return -1;
+}
+
+
+void *NotePool::fromHeap(size_t bytes, NotePool *owner, int sizeClass)
+{
+    void *mem;
+    if (posix_memalign(&mem, NOTE_POOL_HEADER, NOTE_POOL_HEADER + bytes))
+        throw std::bad_alloc();
+    Block *block = static_cast<Block*>(mem);
+    block->pool = owner;
+    block->sizeClass = sizeClass;
+    return static_cast<char*>(mem) + NOTE_POOL_HEADER;
+}
+
+
+void *NotePool::get(size_t bytes)
+{
+    if (current)
+        return current->take(bytes);
+    return fromHeap(bytes, NULL, -1);
+}
+
+
+void *NotePool::take(size_t bytes)
+{
+    int sizeClass = classFor(bytes);
+    if (sizeClass < 0)
+        return fromHeap(bytes, NULL, -1);
+
+    if (counting)
+    {
+        if (++live[sizeClass] > peak[sizeClass])
+            peak[sizeClass] = live[sizeClass];
+        return fromHeap(bytes, this, sizeClass);
+    }
+
+    Block *block = freeList[sizeClass];
+    if (!block)
+        block = incoming[sizeClass].exchange(NULL, std::memory_order_acquire);
+    if (!block)
+    {
+        missed[sizeClass].fetch_add(1, std::memory_order_relaxed);
+        missedTotal.fetch_add(1, std::memory_order_relaxed);
+        hungry.store(true, std::memory_order_relaxed);
+        return fromHeap(bytes, NULL, -1);
+    }
+    freeList[sizeClass] = block->next;
+    return reinterpret_cast<char*>(block) + NOTE_POOL_HEADER;
+}
+
+
+void NotePool::release(void *ptr)
+{
+    if (!ptr)
+        return;
+    Block *block = reinterpret_cast<Block*>(static_cast<char*>(ptr) - NOTE_POOL_HEADER);
+    NotePool *pool = block->pool;
+    if (!pool)
+    {
+        free(block);
+        return;
+    }
+    if (pool->counting)
+    {
+        --pool->live[block->sizeClass];
+        free(block);
+        return;
+    }
+    block->next = pool->freeList[block->sizeClass];
+    pool->freeList[block->sizeClass] = block;
+}
+
+
+/*
+ * Sets aside enough blocks for 'notes' copies of whatever a counting
+ * pool saw at its busiest, keeping within NOTE_POOL_LIMIT.
+ * Never shrinks, blocks already held are counted towards the total.
+ */
+void NotePool::reserve(const NotePool &measured, unsigned int notes)
+{
+    size_t perNote = 0;
+    for (int i = 0; i < NOTE_POOL_CLASSES; ++i)
+        perNote += measured.peak[i] * blockSize(i);
+    if (perNote == 0)
+        return;
+    if (perNote * notes > NOTE_POOL_LIMIT)
+    {
+        notes = NOTE_POOL_LIMIT / perNote;
+        if (notes < 1)
+            notes = 1;
+    }
+
+    pthread_mutex_lock(&growMutex);
+    for (int i = 0; i < NOTE_POOL_CLASSES; ++i)
+    {
+        unsigned int wanted = measured.peak[i] * notes;
+        if (wanted > owned[i])
+            grow(i, wanted - owned[i]);
+    }
+    pthread_mutex_unlock(&growMutex);
+}
+
+
+// after a shortfall, add twice what was missing
+void NotePool::topUp(void)
+{
+    pthread_mutex_lock(&growMutex);
+    hungry.store(false, std::memory_order_relaxed);
+    for (int i = 0; i < NOTE_POOL_CLASSES; ++i)
+    {
+        unsigned int count = missed[i].exchange(0, std::memory_order_relaxed);
+        if (count)
+            grow(i, count * 2);
+    }
+    pthread_mutex_unlock(&growMutex);
+}
+
+
+void NotePool::grow(int sizeClass, unsigned int count)
+{
+    size_t size = blockSize(sizeClass);
+    void *chunk;
+    if (posix_memalign(&chunk, NOTE_POOL_HEADER, size * count))
+        return;
+    chunks.push_back(chunk);
+    owned[sizeClass] += count;
+    reserved.fetch_add(size * count, std::memory_order_relaxed);
+
+    char *mem = static_cast<char*>(chunk);
+    Block *first = reinterpret_cast<Block*>(mem);
+    Block *last = first;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        Block *block = reinterpret_cast<Block*>(mem + i * size);
+        block->pool = this;
+        block->sizeClass = sizeClass;
+        block->next = NULL;
+        if (i > 0)
+            last->next = block;
+        last = block;
+    }
+
+    // the part's thread only ever takes the whole list
+    Block *head = incoming[sizeClass].load(std::memory_order_relaxed);
+    do
+        last->next = head;
+    while (!incoming[sizeClass].compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+}
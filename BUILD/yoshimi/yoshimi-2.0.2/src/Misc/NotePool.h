@@ -0,0 +1,113 @@
+/*
+    NotePool.h - preallocated memory for notes
+
+    Copyright 2026, agent
+
+    This file is part of yoshimi, which is free software: you can redistribute
+    it and/or modify it under the terms of the GNU Library General Public
+    License as published by the Free Software Foundation; either version 2 of
+    the License, or (at your option) any later version.
+
+    yoshimi is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.   See the GNU General Public License (version 2 or
+    later) for more details.
+
+    You should have received a copy of the GNU General Public License along with
+    yoshimi; if not, write to the Free Software Foundation, Inc., 51 Franklin
+    Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+*/
+
+#ifndef NOTEPOOL_H
+#define NOTEPOOL_H
+
+#include <cstddef>
+#include <pthread.h>
+#include <atomic>
+#include <vector>
+
+/*
+ * Blocks are 32 bytes for the smallest class, doubling up to 128k which
+ * covers the largest oscillator tables. Each block carries a 32 byte
+ * header so it can find its way home, and keeps payloads 32 byte aligned.
+ */
+#define NOTE_POOL_CLASSES 13
+#define NOTE_POOL_HEADER 32
+#define NOTE_POOL_LIMIT (16 * 1024 * 1024) // most any part reserves up front
+
+
+/*
+ * One of these belongs to every part. Anything a note allocates while
+ * the part's pool is in use comes from here, so neither note on nor
+ * note off touch the heap once the pool has been sized.
+ *
+ * Only the thread computing the part takes and releases blocks.
+ * Blocks are added from other threads, either sized from the
+ * instrument when it is loaded, or topped up after a shortfall,
+ * and are handed over through a lock free list.
+ *
+ * If a class is empty the block comes from the heap instead,
+ * the shortfall is noted, and it is freed to the heap later.
+ */
+class NotePool
+{
+    public:
+        NotePool(bool _counting = false);
+        ~NotePool();
+
+        static void *get(size_t bytes);
+        static void release(void *ptr);
+        template <class T> static T *getArray(size_t count)
+            { return static_cast<T*>(get(count * sizeof(T))); }
+
+        void reserve(const NotePool &measured, unsigned int notes);
+        void topUp(void);
+        bool wanting(void) { return hungry.load(std::memory_order_relaxed); }
+        size_t reservedBytes(void) { return reserved.load(std::memory_order_relaxed); }
+        unsigned int shortfall(void) { return missedTotal.load(std::memory_order_relaxed); }
+
+        // makes a pool the source for everything this thread allocates
+        class Use
+        {
+            public:
+                Use(NotePool *pool) : previous(current) { current = pool; }
+                ~Use() { current = previous; }
+            private:
+                NotePool *previous;
+        };
+
+    private:
+        struct Block {
+            NotePool *pool;
+            int sizeClass;
+            Block *next;
+        };
+
+        static thread_local NotePool *current;
+        static int classFor(size_t bytes);
+        static size_t blockSize(int sizeClass) { return NOTE_POOL_HEADER + (size_t(32) << sizeClass); }
+        static void *fromHeap(size_t bytes, NotePool *owner, int sizeClass);
+
+        void *take(size_t bytes);
+        void grow(int sizeClass, unsigned int count);
+
+        bool counting;
+        Block *freeList[NOTE_POOL_CLASSES];
+        std::atomic <Block*> incoming[NOTE_POOL_CLASSES];
+        std::atomic <unsigned int> missed[NOTE_POOL_CLASSES];
+        std::atomic <unsigned int> missedTotal;
+        std::atomic <bool> hungry;
+
+        // filled by a counting pool
+        unsigned int live[NOTE_POOL_CLASSES];
+        unsigned int peak[NOTE_POOL_CLASSES];
+
+        // only touched by threads adding blocks
+        pthread_mutex_t growMutex;
+        std::vector <void*> chunks;
+        unsigned int owned[NOTE_POOL_CLASSES];
+        std::atomic <size_t> reserved;
+};
+
+#endif
@@ -61,6 +61,7 @@ Part::Part(Microtonal *microtonal_, FFTwrapper *fft_, SynthEngine *_synth) :
     synth(_synth)
 {
     ctl = new Controller(synth);
+    poolWanted.store(true);
     partoutl = (float*)fftwf_malloc(synth->bufferbytes);
     memset(partoutl, 0, synth->bufferbytes);
     partoutr = (float*)fftwf_malloc(synth->bufferbytes);
@@ -373,6 +374,7 @@ void Part::NoteOn(int note, int velocity, bool renote)
 {
     if (note < Pminkey || note > Pmaxkey)
         return;
+    NotePool::Use usePool(&notePool);
 
     // Legato and MonoMem used vars:
     int posb = POLIPHONY - 1;     // Just a dummy initial value.
@@ -1086,8 +1088,9 @@ void Part::enforcekeylimit()
 // Compute Part samples and store them in the partoutl[] and partoutr[]
 void Part::ComputePartSmps(void)
 {
-    tmpoutl = synth->getRuntime().genMixl;
-    tmpoutr = synth->getRuntime().genMixr;
+    NotePool::Use usePool(&notePool);
+    tmpoutl = synth->scratch().genMixl;
+    tmpoutr = synth->scratch().genMixr;
     for (int nefx = 0; nefx < NUM_PART_EFX + 1; ++nefx)
     {
         memset(partfxinputl[nefx], 0, synth->sent_bufferbytes);
@@ -1261,6 +1264,56 @@ void Part::ComputePartSmps(void)
 }
 
 
+/*
+ * Plays one silent note of every enabled engine against a counting
+ * pool, then sets aside room for POLIPHONY of them. The notes share
+ * the part's OscilGens, so this is only run while the part is off
+ * and never from the audio thread.
+ */
+void Part::sizeNotePool(void)
+{
+    // this isn't the audio thread, so the notes mustn't use its generator
+    RandomGen sizingPrng;
+    sizingPrng.init(0x5eed);
+    PartScratch sizingScratch;
+    memset(&sizingScratch, 0, sizeof(sizingScratch));
+    sizingScratch.prng = &sizingPrng;
+    PartScratch *previous = SynthEngine::threadScratch;
+    SynthEngine::threadScratch = &sizingScratch;
+
+    NotePool measured(true);
+    {
+        NotePool::Use usePool(&measured);
+        ADnote *adnote[NUM_KIT_ITEMS];
+        SUBnote *subnote[NUM_KIT_ITEMS];
+        PADnote *padnote[NUM_KIT_ITEMS];
+        int items = Pkitmode ? NUM_KIT_ITEMS : 1;
+        for (int item = 0; item < items; ++item)
+        {
+            adnote[item] = NULL;
+            subnote[item] = NULL;
+            padnote[item] = NULL;
+            if (Pkitmode && kit[item].Pmuted)
+                continue;
+            if (kit[item].adpars && kit[item].Padenabled)
+                adnote[item] = new ADnote(kit[item].adpars, ctl, 440.0f, 1.0f, 0, 69, synth);
+            if (kit[item].subpars && kit[item].Psubenabled)
+                subnote[item] = new SUBnote(kit[item].subpars, ctl, 440.0f, 1.0f, 0, 69, synth);
+            if (kit[item].padpars && kit[item].Ppadenabled)
+                padnote[item] = new PADnote(kit[item].padpars, ctl, 440.0f, 1.0f, 0, 69, synth);
+        }
+        for (int item = 0; item < items; ++item)
+        {
+            delete adnote[item];
+            delete subnote[item];
+            delete padnote[item];
+        }
+    }
+    SynthEngine::threadScratch = previous;
+    notePool.reserve(measured, POLIPHONY);
+}
+
+
 // Parameter control
 void Part::setVolume(float value)
 {
@@ -1562,6 +1615,7 @@ int Part::loadXMLinstrument(string filename)
     }
     xml->exitbranch();
     delete xml;
+    poolWanted.store(true); // sized when partonoffLock next enables the part
     return 1;
 }
 
@@ -1684,7 +1738,9 @@ void Part::getfromXMLinstrument(XMLwrapper *xml)
 
 void Part::getfromXML(XMLwrapper *xml)
 {
-    Penabled = (xml->getparbool("enabled", Penabled) == 1);
+    bool enable = (xml->getparbool("enabled", Penabled) == 1);
+    if (!enable)
+        Penabled = 0;
 
     setVolume(xml->getpar127("volume", Pvolume));
     setPan(xml->getpar127("panning", Ppanning));
@@ -1736,6 +1792,14 @@ void Part::getfromXML(XMLwrapper *xml)
         ctl->getfromXML(xml);
         xml->exitbranch();
     }
+    if (enable && Penabled != 1)
+    {
+        sizeNotePool(); // still off, so no note can be using its OscilGens
+        poolWanted.store(false);
+    }
+    else
+        poolWanted.store(true);
+    Penabled = enable;
 }
 
 
@@ -28,8 +28,10 @@
 #define PART_H
 
 #include <list>
+#include <atomic>
 #include <string>
 #include "globals.h"
+#include "Misc/NotePool.h"
 
 class ADnoteParameters;
 class SUBnoteParameters;
@@ -69,6 +71,7 @@ class Part
         void ReleaseSustainedKeys(void);
         void ReleaseAllKeys(void);
         void ComputePartSmps(void);
+        void sizeNotePool(void);
 
         bool saveXML(std::string filename, bool yoshiFormat); // result true for load ok, otherwise false
         int loadXMLinstrument(std::string filename);
@@ -79,6 +82,8 @@ class Part
         float getLimits(CommandBlock *getData);
 
         Controller *ctl;
+        NotePool notePool; // everything the notes allocate
+        std::atomic <bool> poolWanted; // pool not yet sized for the current instrument
 
         // part's kit
         struct {
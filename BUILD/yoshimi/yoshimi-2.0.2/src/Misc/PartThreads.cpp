@@ -0,0 +1,173 @@
+/*
+    PartThreads.cpp - pool of threads computing parts in parallel
+
+    Copyright 2026, agent
+
+    This file is part of yoshimi, which is free software: you can redistribute
+    it and/or modify it under the terms of the GNU Library General Public
+    License as published by the Free Software Foundation; either version 2 of
+    the License, or (at your option) any later version.
+
+    yoshimi is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.   See the GNU General Public License (version 2 or
+    later) for more details.
+
+    You should have received a copy of the GNU General Public License along with
+    yoshimi; if not, write to the Free Software Foundation, Inc., 51 Franklin
+    Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+*/
+
+#include <errno.h>
+#include <fftw3.h>
+
+#include "Misc/SynthEngine.h"
+#include "Misc/PartThreads.h"
+#include "Misc/FormatFuncs.h"
+
+using func::asString;
+
+
+PartThreads::PartThreads(SynthEngine *_synth) :
+    synth(_synth),
+    workerCount(0),
+    quit(false),
+    nextJob(0),
+    jobs(NULL),
+    jobCount(0)
+{
+    sem_init(&done, 0, 0);
+}
+
+
+PartThreads::~PartThreads()
+{
+    stop();
+    sem_destroy(&done);
+}
+
+
+bool PartThreads::start(int count)
+{
+    if (count > MAX_PART_THREADS)
+        count = MAX_PART_THREADS;
+    quit.store(false);
+    while (workerCount < count)
+    {
+        Worker &w = worker[workerCount];
+        w.pool = this;
+        w.scratch.genTmp1 = (float*)fftwf_malloc(synth->bufferbytes);
+        w.scratch.genTmp2 = (float*)fftwf_malloc(synth->bufferbytes);
+        w.scratch.genTmp3 = (float*)fftwf_malloc(synth->bufferbytes);
+        w.scratch.genTmp4 = (float*)fftwf_malloc(synth->bufferbytes);
+        w.scratch.genMixl = (float*)fftwf_malloc(synth->bufferbytes);
+        w.scratch.genMixr = (float*)fftwf_malloc(synth->bufferbytes);
+        w.scratch.prng = new RandomGen;
+        w.scratch.prng->init(synth->randomINT());
+        sem_init(&w.go, 0, 0);
+
+        // same priority as the audio thread that waits on them
+        if (!synth->getRuntime().startThread(&w.thread, _workerThread, &w, true, 0, "Part thread " + asString(workerCount)))
+        {
+            synth->getRuntime().Log("Failed to start part thread " + asString(workerCount));
+            sem_destroy(&w.go);
+            delete w.scratch.prng;
+            fftwf_free(w.scratch.genTmp1);
+            fftwf_free(w.scratch.genTmp2);
+            fftwf_free(w.scratch.genTmp3);
+            fftwf_free(w.scratch.genTmp4);
+            fftwf_free(w.scratch.genMixl);
+            fftwf_free(w.scratch.genMixr);
+            break;
+        }
+        ++workerCount;
+    }
+    return workerCount == count;
+}
+
+
+void PartThreads::stop(void)
+{
+    if (!workerCount)
+        return;
+    quit.store(true);
+    for (int i = 0; i < workerCount; ++i)
+        sem_post(&worker[i].go);
+    for (int i = 0; i < workerCount; ++i)
+    {
+        Worker &w = worker[i];
+        pthread_join(w.thread, 0);
+        sem_destroy(&w.go);
+        delete w.scratch.prng;
+        fftwf_free(w.scratch.genTmp1);
+        fftwf_free(w.scratch.genTmp2);
+        fftwf_free(w.scratch.genTmp3);
+        fftwf_free(w.scratch.genTmp4);
+        fftwf_free(w.scratch.genMixl);
+        fftwf_free(w.scratch.genMixr);
+    }
+    workerCount = 0;
+}
+
+
+/*
+ * Called from the audio thread. The caller takes jobs from the
+ * list as well, so only count - 1 workers are ever woken, and
+ * it doesn't return until every part in the list is complete.
+ */
+void PartThreads::compute(const int *partList, int count)
+{
+    jobs = partList;
+    jobCount = count;
+    nextJob.store(0);
+
+    int helpers = count - 1;
+    if (helpers > workerCount)
+        helpers = workerCount;
+    for (int i = 0; i < helpers; ++i)
+        sem_post(&worker[i].go);
+
+    runJobs();
+
+    for (int i = 0; i < helpers; ++i)
+    {
+        while (sem_wait(&done) < 0 && errno == EINTR)
+            ;
+    }
+}
+
+
+void PartThreads::runJobs(void)
+{
+    int job;
+    while ((job = nextJob.fetch_add(1)) < jobCount)
+        synth->computePart(jobs[job]);
+}
+
+
+void *PartThreads::_workerThread(void *arg)
+{
+    Worker *w = static_cast<Worker*>(arg);
+    return w->pool->workerThread(w);
+}
+
+
+void *PartThreads::workerThread(Worker *w)
+{
+    SynthEngine::threadScratch = &w->scratch;
+    while (true)
+    {
+        if (sem_wait(&w->go) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        if (quit.load())
+            break;
+        runJobs();
+        sem_post(&done);
+    }
+    return NULL;
+}
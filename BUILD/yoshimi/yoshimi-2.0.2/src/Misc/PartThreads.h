@@ -0,0 +1,82 @@
+/*
+    PartThreads.h - pool of threads computing parts in parallel
+
+    Copyright 2026, agent
+
+    This file is part of yoshimi, which is free software: you can redistribute
+    it and/or modify it under the terms of the GNU Library General Public
+    License as published by the Free Software Foundation; either version 2 of
+    the License, or (at your option) any later version.
+
+    yoshimi is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.   See the GNU General Public License (version 2 or
+    later) for more details.
+
+    You should have received a copy of the GNU General Public License along with
+    yoshimi; if not, write to the Free Software Foundation, Inc., 51 Franklin
+    Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+*/
+
+#ifndef PARTTHREADS_H
+#define PARTTHREADS_H
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <atomic>
+
+#include "Misc/RandomGen.h"
+#include "globals.h"
+
+class SynthEngine;
+
+/*
+ * Everything a part (and its notes) scribbles on while it is
+ * being computed. The audio thread uses the buffers held in
+ * Config, each worker thread gets a private set.
+ */
+struct PartScratch {
+    float *genTmp1;
+    float *genTmp2;
+    float *genTmp3;
+    float *genTmp4;
+    float *genMixl;
+    float *genMixr;
+    RandomGen *prng;
+};
+
+
+class PartThreads
+{
+    public:
+        PartThreads(SynthEngine *_synth);
+        ~PartThreads();
+        bool start(int count);
+        void stop(void);
+        int active(void) { return workerCount; }
+        void compute(const int *partList, int count);
+
+    private:
+        struct Worker {
+            PartThreads *pool;
+            pthread_t thread;
+            sem_t go;
+            PartScratch scratch;
+        };
+
+        static void *_workerThread(void *arg);
+        void *workerThread(Worker *worker);
+        void runJobs(void);
+
+        SynthEngine *synth;
+        Worker worker[MAX_PART_THREADS];
+        int workerCount;
+        sem_t done;
+        std::atomic <bool> quit;
+        std::atomic <int> nextJob;
+        const int *jobs;
+        int jobCount;
+};
+
+#endif
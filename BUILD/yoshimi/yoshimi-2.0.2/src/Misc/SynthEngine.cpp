@@ -150,7 +150,8 @@ SynthEngine::SynthEngine(int argc, char **argv, bool _isLV2Plugin, unsigned int
     LFOtime(0),
     songBeat(0.0f),
     monotonicBeat(0.0f),
-    windowTitle("Yoshimi" + asString(uniqueId))
+    windowTitle("Yoshimi" + asString(uniqueId)),
+    partThreads(this)
 {
     union {
         uint32_t u32 = 0x11223344;
@@ -174,14 +175,20 @@ SynthEngine::SynthEngine(int argc, char **argv, bool _isLV2Plugin, unsigned int
 
     // seed the shared master random number generator
     prng.init(time(NULL));
+    memset(&mainScratch, 0, sizeof(mainScratch));
+    mainScratch.prng = &prng;
 }
 
 
+thread_local PartScratch *SynthEngine::threadScratch = NULL;
+
+
 SynthEngine::~SynthEngine()
 {
 #ifdef GUI_FLTK
     closeGui();
 #endif
+    partThreads.stop();
 
     for (int npart = 0; npart < NUM_MIDI_PARTS; ++npart)
         if (part[npart])
@@ -318,6 +325,14 @@ bool SynthEngine::Init(unsigned int audiosrate, int audiobufsize)
     Runtime.genMixl = (float*)fftwf_malloc(bufferbytes);
     Runtime.genMixr = (float*)fftwf_malloc(bufferbytes);
 
+    // the audio thread's own set, workers have theirs
+    mainScratch.genTmp1 = Runtime.genTmp1;
+    mainScratch.genTmp2 = Runtime.genTmp2;
+    mainScratch.genTmp3 = Runtime.genTmp3;
+    mainScratch.genTmp4 = Runtime.genTmp4;
+    mainScratch.genMixl = Runtime.genMixl;
+    mainScratch.genMixr = Runtime.genMixr;
+
     defaults();
     ClearNRPNs();
 
@@ -361,6 +376,12 @@ bool SynthEngine::Init(unsigned int audiosrate, int audiobufsize)
             Runtime.midiLearnLoad = "";
         }
     }
+    for (int npart = 0; npart < NUM_MIDI_PARTS; ++npart)
+    {
+        if (part[npart]->Penabled && part[npart]->poolWanted.exchange(false))
+            part[npart]->sizeNotePool(); // audio isn't running yet
+    }
+
     /*
      * put here so its threads don't run until everthing else is ready
      */
@@ -370,6 +391,14 @@ bool SynthEngine::Init(unsigned int audiosrate, int audiobufsize)
         goto bail_out;
     }
 
+    if (Runtime.PartThreads > 0)
+    {
+        if (!partThreads.start(Runtime.PartThreads))
+            Runtime.Log("Only " + asString(partThreads.active()) + " of " + asString(Runtime.PartThreads) + " part threads started");
+        else
+            Runtime.Log("Computing parts on " + asString(Runtime.PartThreads) + " extra threads", 2);
+    }
+
     // we seem to need this here only for first time startup :(
     bank.setCurrentBankID(Runtime.tempBank, false);
     return true;
@@ -1881,6 +1910,16 @@ void SynthEngine::resetAll(bool andML)
 void SynthEngine::partonoffLock(int npart, int what)
 {
     sem_wait(&partlock);
+    if (npart < Runtime.NumAvailableParts && part[npart]->poolWanted.load())
+    {
+        char enabled = part[npart]->Penabled;
+        if ((what == 1 && enabled != 1) || (what == 2 && enabled == 0))
+        {
+            // size it before it goes on, while no note can be using its OscilGens
+            part[npart]->poolWanted.store(false);
+            part[npart]->sizeNotePool();
+        }
+    }
     partonoffWrite(npart, what);
     sem_post(&partlock);
 }
@@ -1942,6 +1981,56 @@ char SynthEngine::partonoffRead(int npart)
 }
 
 
+/*
+ * Replaces anything notes had to take from the heap.
+ * Runs on the same thread as instrument loads.
+ */
+void SynthEngine::topUpNotePools(void)
+{
+    for (int npart = 0; npart < NUM_MIDI_PARTS; ++npart)
+    {
+        if (!part[npart])
+            continue;
+        if (part[npart]->notePool.wanting())
+            part[npart]->notePool.topUp();
+    }
+}
+
+
+// Everything that happens to one part before it is mixed
+// Runs on a part thread when these are enabled
+void SynthEngine::computePart(int npart)
+{
+    part[npart]->ComputePartSmps();
+    for (int nefx = 0; nefx < NUM_INS_EFX; ++nefx)
+    {
+        if (Pinsparts[nefx] == npart)
+            insefx[nefx]->out(part[npart]->partoutl, part[npart]->partoutr);
+    }
+    applyPartVolume(npart, Runtime.panLaw);
+}
+
+
+// Apply the part volume and panning (after insertion effects)
+void SynthEngine::applyPartVolume(int npart, unsigned char panLaw)
+{
+    float Step = ControlStep;
+    for (int i = 0; i < sent_buffersize; ++i)
+    {
+        if (part[npart]->Ppanning - part[npart]->TransPanning > Step)
+            part[npart]->checkPanning(Step, panLaw);
+        else if (part[npart]->TransPanning - part[npart]->Ppanning > Step)
+            part[npart]->checkPanning(-Step, panLaw);
+        if (part[npart]->Pvolume - part[npart]->TransVolume > Step)
+            part[npart]->checkVolume(Step);
+        else if (part[npart]->TransVolume - part[npart]->Pvolume > Step)
+            part[npart]->checkVolume(-Step);
+        part[npart]->partoutl[i] *= (part[npart]->pannedVolLeft() * part[npart]->ctl->expression.relvolume);
+        part[npart]->partoutr[i] *= (part[npart]->pannedVolRight() * part[npart]->ctl->expression.relvolume);
+    }
+}
+
+
 // Master audio out (the final sound)
 int SynthEngine::MasterAudio(float *outl [NUM_MIDI_PARTS + 1], float *outr [NUM_MIDI_PARTS + 1], int to_process)
 {
@@ -2040,50 +2129,34 @@ int SynthEngine::MasterAudio(float *outl [NUM_MIDI_PARTS + 1], float *outr [NUM_
  */
     else
     {
-        // Compute part samples and store them ->partoutl,partoutr
-        for (int npart = 0; npart < Runtime.NumAvailableParts; ++npart)
+        if (partThreads.active())
         {
-            if (partLocal[npart])
+            int partList[NUM_MIDI_PARTS];
+            int partCount = 0;
+            for (int npart = 0; npart < Runtime.NumAvailableParts; ++npart)
             {
-                legatoPart = npart;
-                part[npart]->ComputePartSmps();
+                if (partLocal[npart])
+                    partList[partCount++] = npart;
             }
-        }
-        // Insertion effects
-        int nefx;
-        for (nefx = 0; nefx < NUM_INS_EFX; ++nefx)
-        {
-            if (Pinsparts[nefx] >= 0)
+            if (partCount > 0)
             {
-                int efxpart = Pinsparts[nefx];
-                if (part[efxpart]->Penabled)
-                    insefx[nefx]->out(part[efxpart]->partoutl, part[efxpart]->partoutr);
+                legatoPart = partList[partCount - 1];
+                partThreads.compute(partList, partCount);
             }
         }
-
-        // Apply the part volumes and pannings (after insertion effects)
-        unsigned char panLaw = Runtime.panLaw;
-        for (int npart = 0; npart < Runtime.NumAvailableParts; ++npart)
+        else
         {
-            if (!partLocal[npart])
-                continue;
-
-            float Step = ControlStep;
-            for (int i = 0; i < sent_buffersize; ++i)
+            // same parts, insertion effects and volumes as the threads
+            for (int npart = 0; npart < Runtime.NumAvailableParts; ++npart)
             {
-                if (part[npart]->Ppanning - part[npart]->TransPanning > Step)
-                    part[npart]->checkPanning(Step, panLaw);
-                else if (part[npart]->TransPanning - part[npart]->Ppanning > Step)
-                    part[npart]->checkPanning(-Step, panLaw);
-                if (part[npart]->Pvolume - part[npart]->TransVolume > Step)
-                    part[npart]->checkVolume(Step);
-                else if (part[npart]->TransVolume - part[npart]->Pvolume > Step)
-                    part[npart]->checkVolume(-Step);
-                part[npart]->partoutl[i] *= (part[npart]->pannedVolLeft() * part[npart]->ctl->expression.relvolume);
-                part[npart]->partoutr[i] *= (part[npart]->pannedVolRight() * part[npart]->ctl->expression.relvolume);
+                if (partLocal[npart])
+                {
+                    legatoPart = npart;
+                    computePart(npart);
+                }
             }
-
         }
+        int nefx;
         // System effects
         for (nefx = 0; nefx < NUM_SYS_EFX; ++nefx)
         {
@@ -37,6 +37,7 @@
 #include <list>
 
 #include "Misc/RandomGen.h"
+#include "Misc/PartThreads.h"
 #include "Misc/Microtonal.h"
 #include "Misc/Bank.h"
 #include "Interface/InterChange.h"
@@ -147,6 +148,9 @@ class SynthEngine
         void resetAll(bool andML);
         void ShutUp(void);
         int MasterAudio(float *outl [NUM_MIDI_PARTS + 1], float *outr [NUM_MIDI_PARTS + 1], int to_process = 0);
+        void computePart(int npart);
+        void topUpNotePools(void);
+        void applyPartVolume(int npart, unsigned char panLaw);
         void partonoffLock(int npart, int what);
         void partonoffWrite(int npart, int what);
         char partonoffRead(int npart);
@@ -298,9 +302,13 @@ class SynthEngine
         //MusicClient *musicClient;
 
         RandomGen prng;
+        PartScratch mainScratch;
+        PartThreads partThreads;
     public:
-        float numRandom()   { return prng.numRandom(); }
-        uint32_t randomINT(){ return prng.randomINT(); }   // random number in the range 0...INT_MAX
+        static thread_local PartScratch *threadScratch; // set by part worker threads
+        PartScratch &scratch() { return threadScratch ? *threadScratch : mainScratch; }
+        float numRandom()   { return scratch().prng->numRandom(); }
+        uint32_t randomINT(){ return scratch().prng->randomINT(); }   // random number in the range 0...INT_MAX
         void reseed(int value) { prng.init(value); }
 };
 
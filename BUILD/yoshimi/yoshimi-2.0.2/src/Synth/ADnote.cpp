@@ -155,13 +155,13 @@ ADnote::ADnote(const ADnote &orig, ADnote *topVoice_, float *parentFMmod_) :
     memcpy(freqbasedmod, orig.freqbasedmod, sizeof(freqbasedmod));
     memcpy(firsttick, orig.firsttick, sizeof(firsttick));
 
-    tmpwave_unison = new float*[max_unison];
-    tmpmod_unison = new float*[max_unison];
+    tmpwave_unison = NotePool::getArray<float*>(max_unison);
+    tmpmod_unison = NotePool::getArray<float*>(max_unison);
 
     for (int i = 0; i < max_unison; ++i)
     {
-        tmpwave_unison[i] = (float*)fftwf_malloc(synth->bufferbytes);
-        tmpmod_unison[i] = (float*)fftwf_malloc(synth->bufferbytes);
+        tmpwave_unison[i] = (float*)NotePool::get(synth->bufferbytes);
+        tmpmod_unison[i] = (float*)NotePool::get(synth->bufferbytes);
     }
 
     for (int i = 0; i < NUM_VOICES; ++i)
@@ -174,7 +174,7 @@ ADnote::ADnote(const ADnote &orig, ADnote *topVoice_, float *parentFMmod_) :
         vpar.FMEnabled = oldvpar.FMEnabled;
 
         if (oldvpar.VoiceOut != NULL) {
-            vpar.VoiceOut = (float*)fftwf_malloc(synth->bufferbytes);
+            vpar.VoiceOut = (float*)NotePool::get(synth->bufferbytes);
             // Not sure the memcpy is necessary
             memcpy(vpar.VoiceOut, oldvpar.VoiceOut, synth->bufferbytes);
         } else
@@ -222,13 +222,13 @@ ADnote::ADnote(const ADnote &orig, ADnote *topVoice_, float *parentFMmod_) :
 
             if (oldvpar.OscilSmp != NULL)
             {
-                vpar.OscilSmp = new float[size];
+                vpar.OscilSmp = NotePool::getArray<float>(size);
                 memcpy(vpar.OscilSmp, oldvpar.OscilSmp, size * sizeof(float));
             }
 
             if (oldvpar.FMSmp != NULL)
             {
-                vpar.FMSmp = (float*)fftwf_malloc(size * sizeof(float));
+                vpar.FMSmp = (float*)NotePool::get(size * sizeof(float));
                 memcpy(vpar.FMSmp, oldvpar.FMSmp, size * sizeof(float));
             }
         } else {
@@ -279,55 +279,55 @@ ADnote::ADnote(const ADnote &orig, ADnote *topVoice_, float *parentFMmod_) :
 
         int unison = unison_size[i];
 
-        oscfreqhi[i] = new int[unison];
+        oscfreqhi[i] = NotePool::getArray<int>(unison);
         memcpy(oscfreqhi[i], orig.oscfreqhi[i], unison * sizeof(int));
 
-        oscfreqlo[i] = new float[unison];
+        oscfreqlo[i] = NotePool::getArray<float>(unison);
         memcpy(oscfreqlo[i], orig.oscfreqlo[i], unison * sizeof(float));
 
-        oscfreqhiFM[i] = new int[unison];
+        oscfreqhiFM[i] = NotePool::getArray<int>(unison);
         memcpy(oscfreqhiFM[i], orig.oscfreqhiFM[i], unison * sizeof(unsigned int));
 
-        oscfreqloFM[i] = new float[unison];
+        oscfreqloFM[i] = NotePool::getArray<float>(unison);
         memcpy(oscfreqloFM[i], orig.oscfreqloFM[i], unison * sizeof(float));
 
-        oscposhi[i] = new int[unison];
+        oscposhi[i] = NotePool::getArray<int>(unison);
         memcpy(oscposhi[i], orig.oscposhi[i], unison * sizeof(int));
 
-        oscposlo[i] = new float[unison];
+        oscposlo[i] = NotePool::getArray<float>(unison);
         memcpy(oscposlo[i], orig.oscposlo[i], unison * sizeof(float));
 
-        oscposhiFM[i] = new int[unison];
+        oscposhiFM[i] = NotePool::getArray<int>(unison);
         memcpy(oscposhiFM[i], orig.oscposhiFM[i], unison * sizeof(unsigned int));
 
-        oscposloFM[i] = new float[unison];
+        oscposloFM[i] = NotePool::getArray<float>(unison);
         memcpy(oscposloFM[i], orig.oscposloFM[i], unison * sizeof(float));
 
 
-        unison_base_freq_rap[i] = new float[unison];
+        unison_base_freq_rap[i] = NotePool::getArray<float>(unison);
         memcpy(unison_base_freq_rap[i], orig.unison_base_freq_rap[i],
             unison * sizeof(float));
 
-        unison_freq_rap[i] = new float[unison];
+        unison_freq_rap[i] = NotePool::getArray<float>(unison);
         memcpy(unison_freq_rap[i], orig.unison_freq_rap[i],
             unison * sizeof(float));
 
-        unison_invert_phase[i] = new bool[unison];
+        unison_invert_phase[i] = NotePool::getArray<bool>(unison);
         memcpy(unison_invert_phase[i], orig.unison_invert_phase[i],
             unison * sizeof(bool));
 
         unison_vibratto[i].amplitude = orig.unison_vibratto[i].amplitude;
 
-        unison_vibratto[i].step = new float[unison];
+        unison_vibratto[i].step = NotePool::getArray<float>(unison);
         memcpy(unison_vibratto[i].step,
             orig.unison_vibratto[i].step, unison * sizeof(float));
 
-        unison_vibratto[i].position = new float[unison];
+        unison_vibratto[i].position = NotePool::getArray<float>(unison);
         memcpy(unison_vibratto[i].position,
             orig.unison_vibratto[i].position, unison * sizeof(float));
 
 
-        FMoldsmp[i] = new float[unison];
+        FMoldsmp[i] = NotePool::getArray<float>(unison);
         memcpy(FMoldsmp[i], orig.unison_vibratto[i].position,
             unison * sizeof(float));
 
@@ -335,30 +335,30 @@ ADnote::ADnote(const ADnote &orig, ADnote *topVoice_, float *parentFMmod_) :
         {
             if (NoteVoicePar[i].FMEnabled == FREQ_MOD)
             {
-                FMFMoldPhase[i] = new float[unison];
+                FMFMoldPhase[i] = NotePool::getArray<float>(unison);
                 memcpy(FMFMoldPhase[i], orig.FMFMoldPhase[i],
                     unison * sizeof(float));
 
-                FMFMoldInterpPhase[i] = new float[unison];
+                FMFMoldInterpPhase[i] = NotePool::getArray<float>(unison);
                 memcpy(FMFMoldInterpPhase[i], orig.FMFMoldInterpPhase[i],
                     unison * sizeof(float));
 
-                FMFMoldPMod[i] = new float[unison];
+                FMFMoldPMod[i] = NotePool::getArray<float>(unison);
                 memcpy(FMFMoldPMod[i], orig.FMFMoldPMod[i],
                     unison * sizeof(float));
             }
 
             if (forFM)
             {
-                oscFMoldPhase[i] = new float[unison];
+                oscFMoldPhase[i] = NotePool::getArray<float>(unison);
                 memcpy(oscFMoldPhase[i], orig.oscFMoldPhase[i],
                     unison * sizeof(float));
 
-                oscFMoldInterpPhase[i] = new float[unison];
+                oscFMoldInterpPhase[i] = NotePool::getArray<float>(unison);
                 memcpy(oscFMoldInterpPhase[i], orig.oscFMoldInterpPhase[i],
                     unison * sizeof(float));
 
-                oscFMoldPMod[i] = new float[unison];
+                oscFMoldPMod[i] = NotePool::getArray<float>(unison);
                 memcpy(oscFMoldPMod[i], orig.oscFMoldPMod[i],
                     unison * sizeof(float));
             }
@@ -371,7 +371,7 @@ ADnote::ADnote(const ADnote &orig, ADnote *topVoice_, float *parentFMmod_) :
 
         if (orig.subVoice[i] != NULL)
         {
-            subVoice[i] = new ADnote*[orig.unison_size[i]];
+            subVoice[i] = NotePool::getArray<ADnote*>(orig.unison_size[i]);
             for (int k = 0; k < orig.unison_size[i]; ++k)
             {
                 subVoice[i][k] = new ADnote(*orig.subVoice[i][k], topVoice, freqbasedmod[i] ? tmpmod_unison[k] : parentFMmod);
@@ -382,7 +382,7 @@ ADnote::ADnote(const ADnote &orig, ADnote *topVoice_, float *parentFMmod_) :
 
         if (orig.subFMVoice[i] != NULL)
         {
-            subFMVoice[i] = new ADnote*[orig.unison_size[i]];
+            subFMVoice[i] = NotePool::getArray<ADnote*>(orig.unison_size[i]);
             for (int k = 0; k < orig.unison_size[i]; ++k)
             {
                 subFMVoice[i][k] = new ADnote(*orig.subFMVoice[i][k], topVoice, parentFMmod);
@@ -476,11 +476,11 @@ void ADnote::construct()
         // compute unison
         unison_size[nvoice] = unison;
 
-        unison_base_freq_rap[nvoice] = new float[unison];
-        unison_freq_rap[nvoice] = new float[unison];
-        unison_invert_phase[nvoice] = new bool[unison];
-        unison_vibratto[nvoice].step = new float[unison];
-        unison_vibratto[nvoice].position = new float[unison];
+        unison_base_freq_rap[nvoice] = NotePool::getArray<float>(unison);
+        unison_freq_rap[nvoice] = NotePool::getArray<float>(unison);
+        unison_invert_phase[nvoice] = NotePool::getArray<bool>(unison);
+        unison_vibratto[nvoice].step = NotePool::getArray<float>(unison);
+        unison_vibratto[nvoice].position = NotePool::getArray<float>(unison);
 
         if (unison >> is_pwm > 1)
         {
@@ -518,14 +518,14 @@ void ADnote::construct()
             }
         }
 
-        oscfreqhi[nvoice] = new int[unison];
-        oscfreqlo[nvoice] = new float[unison];
-        oscfreqhiFM[nvoice] = new int[unison];
-        oscfreqloFM[nvoice] = new float[unison];
-        oscposhi[nvoice] = new int[unison];
-        oscposlo[nvoice] = new float[unison];
-        oscposhiFM[nvoice] = new int[unison];
-        oscposloFM[nvoice] = new float[unison];
+        oscfreqhi[nvoice] = NotePool::getArray<int>(unison);
+        oscfreqlo[nvoice] = NotePool::getArray<float>(unison);
+        oscfreqhiFM[nvoice] = NotePool::getArray<int>(unison);
+        oscfreqloFM[nvoice] = NotePool::getArray<float>(unison);
+        oscposhi[nvoice] = NotePool::getArray<int>(unison);
+        oscposlo[nvoice] = NotePool::getArray<float>(unison);
+        oscposhiFM[nvoice] = NotePool::getArray<int>(unison);
+        oscposloFM[nvoice] = NotePool::getArray<float>(unison);
 
         NoteVoicePar[nvoice].Enabled = true;
         memset(oscposhi[nvoice], 0, unison * sizeof(int));
@@ -544,7 +544,7 @@ void ADnote::construct()
             adpars->VoicePar[nvoice].OscilSmp->newrandseed();
 
             NoteVoicePar[nvoice].OscilSmp = // the extra points contains the first point
-                new float[synth->oscilsize + OSCIL_SMP_EXTRA_SAMPLES];
+                NotePool::getArray<float>(synth->oscilsize + OSCIL_SMP_EXTRA_SAMPLES);
 
             // Get the voice's oscil or external's voice oscil
             if (!adpars->GlobalPar.Hrandgrouping)
@@ -615,7 +615,7 @@ void ADnote::construct()
         NoteVoicePar[nvoice].FMFreqEnvelope = NULL;
         NoteVoicePar[nvoice].FMAmpEnvelope = NULL;
 
-        FMoldsmp[nvoice] = new float [unison];
+        FMoldsmp[nvoice] = NotePool::getArray<float>(unison);
         memset(FMoldsmp[nvoice], 0, unison * sizeof(float));
 
         firsttick[nvoice] = 1;
@@ -624,19 +624,19 @@ void ADnote::construct()
             * logf(50.0f)) - 1.0f) / synth->fixed_sample_step_f / 10.0f);
 
         if (parentFMmod != NULL && NoteVoicePar[nvoice].FMEnabled == FREQ_MOD) {
-            FMFMoldPhase[nvoice] = new float [unison];
+            FMFMoldPhase[nvoice] = NotePool::getArray<float>(unison);
             memset(FMFMoldPhase[nvoice], 0, unison * sizeof(*FMFMoldPhase[nvoice]));
-            FMFMoldInterpPhase[nvoice] = new float [unison];
+            FMFMoldInterpPhase[nvoice] = NotePool::getArray<float>(unison);
             memset(FMFMoldInterpPhase[nvoice], 0, unison * sizeof(*FMFMoldInterpPhase[nvoice]));
-            FMFMoldPMod[nvoice] = new float [unison];
+            FMFMoldPMod[nvoice] = NotePool::getArray<float>(unison);
             memset(FMFMoldPMod[nvoice], 0, unison * sizeof(*FMFMoldPMod[nvoice]));
         }
         if (parentFMmod != NULL && forFM) {
-            oscFMoldPhase[nvoice] = new float [unison];
+            oscFMoldPhase[nvoice] = NotePool::getArray<float>(unison);
             memset(oscFMoldPhase[nvoice], 0, unison * sizeof(*oscFMoldPhase[nvoice]));
-            oscFMoldInterpPhase[nvoice] = new float [unison];
+            oscFMoldInterpPhase[nvoice] = NotePool::getArray<float>(unison);
             memset(oscFMoldInterpPhase[nvoice], 0, unison * sizeof(*oscFMoldInterpPhase[nvoice]));
-            oscFMoldPMod[nvoice] = new float [unison];
+            oscFMoldPMod[nvoice] = NotePool::getArray<float>(unison);
             memset(oscFMoldPMod[nvoice], 0, unison * sizeof(*oscFMoldPMod[nvoice]));
         }
     }
@@ -646,13 +646,13 @@ void ADnote::construct()
         if (unison_size[nvoice] > max_unison)
             max_unison = unison_size[nvoice];
 
-    tmpwave_unison = new float*[max_unison];
-    tmpmod_unison = new float*[max_unison];
+    tmpwave_unison = NotePool::getArray<float*>(max_unison);
+    tmpmod_unison = NotePool::getArray<float*>(max_unison);
     for (int k = 0; k < max_unison; ++k)
     {
-        tmpwave_unison[k] = (float*)fftwf_malloc(synth->bufferbytes);
+        tmpwave_unison[k] = (float*)NotePool::get(synth->bufferbytes);
         memset(tmpwave_unison[k], 0, synth->bufferbytes);
-        tmpmod_unison[k] = (float*)fftwf_malloc(synth->bufferbytes);
+        tmpmod_unison[k] = (float*)NotePool::get(synth->bufferbytes);
         memset(tmpmod_unison[k], 0, synth->bufferbytes);
     }
 
@@ -673,7 +673,7 @@ void ADnote::initSubVoices(void)
 
         if (NoteVoicePar[nvoice].Voice != -1)
         {
-            subVoice[nvoice] = new ADnote*[unison_size[nvoice]];
+            subVoice[nvoice] = NotePool::getArray<ADnote*>(unison_size[nvoice]);
             for (int k = 0; k < unison_size[nvoice]; ++k) {
                 float *freqmod = freqbasedmod[nvoice] ? tmpmod_unison[k] : parentFMmod;
                 subVoice[nvoice][k] = new ADnote(topVoice,
@@ -687,7 +687,7 @@ void ADnote::initSubVoices(void)
         if (NoteVoicePar[nvoice].FMVoice != -1)
         {
             bool voiceForFM = NoteVoicePar[nvoice].FMEnabled == FREQ_MOD;
-            subFMVoice[nvoice] = new ADnote*[unison_size[nvoice]];
+            subFMVoice[nvoice] = NotePool::getArray<ADnote*>(unison_size[nvoice]);
             for (int k = 0; k < unison_size[nvoice]; ++k) {
                 subFMVoice[nvoice][k] = new ADnote(topVoice,
                                                    getFMVoiceBaseFreq(nvoice),
@@ -869,33 +869,33 @@ void ADnote::legatoFadeOut(const ADnote &orig)
 // Kill a voice of ADnote
 void ADnote::killVoice(int nvoice)
 {
-    delete [] oscfreqhi[nvoice];
-    delete [] oscfreqlo[nvoice];
-    delete [] oscfreqhiFM[nvoice];
-    delete [] oscfreqloFM[nvoice];
-    delete [] oscposhi[nvoice];
-    delete [] oscposlo[nvoice];
-    delete [] oscposhiFM[nvoice];
-    delete [] oscposloFM[nvoice];
-
-    delete [] unison_base_freq_rap[nvoice];
-    delete [] unison_freq_rap[nvoice];
-    delete [] unison_invert_phase[nvoice];
-    delete [] FMoldsmp[nvoice];
-    delete [] unison_vibratto[nvoice].step;
-    delete [] unison_vibratto[nvoice].position;
+    NotePool::release(oscfreqhi[nvoice]);
+    NotePool::release(oscfreqlo[nvoice]);
+    NotePool::release(oscfreqhiFM[nvoice]);
+    NotePool::release(oscfreqloFM[nvoice]);
+    NotePool::release(oscposhi[nvoice]);
+    NotePool::release(oscposlo[nvoice]);
+    NotePool::release(oscposhiFM[nvoice]);
+    NotePool::release(oscposloFM[nvoice]);
+
+    NotePool::release(unison_base_freq_rap[nvoice]);
+    NotePool::release(unison_freq_rap[nvoice]);
+    NotePool::release(unison_invert_phase[nvoice]);
+    NotePool::release(FMoldsmp[nvoice]);
+    NotePool::release(unison_vibratto[nvoice].step);
+    NotePool::release(unison_vibratto[nvoice].position);
 
     if (subVoice[nvoice] != NULL) {
         for (int k = 0; k < unison_size[nvoice]; ++k)
             delete subVoice[nvoice][k];
-        delete [] subVoice[nvoice];
+        NotePool::release(subVoice[nvoice]);
     }
     subVoice[nvoice] = NULL;
 
     if (subFMVoice[nvoice] != NULL) {
         for (int k = 0; k < unison_size[nvoice]; ++k)
             delete subFMVoice[nvoice][k];
-        delete [] subFMVoice[nvoice];
+        NotePool::release(subFMVoice[nvoice]);
     }
     subFMVoice[nvoice] = NULL;
 
@@ -944,14 +944,14 @@ void ADnote::killVoice(int nvoice)
         // do not delete, yet: perhaps is used by another voice
 
     if (parentFMmod != NULL && NoteVoicePar[nvoice].FMEnabled == FREQ_MOD) {
-        delete [] FMFMoldPhase[nvoice];
-        delete [] FMFMoldInterpPhase[nvoice];
-        delete [] FMFMoldPMod[nvoice];
+        NotePool::release(FMFMoldPhase[nvoice]);
+        NotePool::release(FMFMoldInterpPhase[nvoice]);
+        NotePool::release(FMFMoldPMod[nvoice]);
     }
     if (parentFMmod != NULL && forFM) {
-        delete [] oscFMoldPhase[nvoice];
-        delete [] oscFMoldInterpPhase[nvoice];
-        delete [] oscFMoldPMod[nvoice];
+        NotePool::release(oscFMoldPhase[nvoice]);
+        NotePool::release(oscFMoldInterpPhase[nvoice]);
+        NotePool::release(oscFMoldPMod[nvoice]);
     }
 
     NoteVoicePar[nvoice].Enabled = false;
@@ -969,11 +969,11 @@ void ADnote::killNote()
 
         // Parent deletes oscillator samples.
         if (subVoiceNumber == -1)
-            delete [] NoteVoicePar[nvoice].OscilSmp;
+            NotePool::release(NoteVoicePar[nvoice].OscilSmp);
         if ((NoteVoicePar[nvoice].FMEnabled != NONE)
             && (NoteVoicePar[nvoice].FMVoice < 0)
             && (subVoiceNumber == -1))
-            fftwf_free(NoteVoicePar[nvoice].FMSmp);
+            NotePool::release(NoteVoicePar[nvoice].FMSmp);
     }
 
 
@@ -1000,16 +1000,16 @@ ADnote::~ADnote()
     {
         if (NoteVoicePar[nvoice].VoiceOut)
         {
-            fftwf_free(NoteVoicePar[nvoice].VoiceOut);
+            NotePool::release(NoteVoicePar[nvoice].VoiceOut);
             NoteVoicePar[nvoice].VoiceOut = NULL;
         }
     }
     for (int k = 0; k < max_unison; ++k) {
-        fftwf_free(tmpwave_unison[k]);
-        fftwf_free(tmpmod_unison[k]);
+        NotePool::release(tmpwave_unison[k]);
+        NotePool::release(tmpmod_unison[k]);
     }
-    delete [] tmpwave_unison;
-    delete [] tmpmod_unison;
+    NotePool::release(tmpwave_unison);
+    NotePool::release(tmpmod_unison);
 }
 
 
@@ -1103,7 +1103,7 @@ void ADnote::initParameters(void)
             if (subVoiceNumber == -1) {
                 adpars->VoicePar[nvoice].FMSmp->newrandseed();
                 NoteVoicePar[nvoice].FMSmp =
-                    (float*)fftwf_malloc((synth->oscilsize + OSCIL_SMP_EXTRA_SAMPLES) * sizeof(float));
+                    (float*)NotePool::get((synth->oscilsize + OSCIL_SMP_EXTRA_SAMPLES) * sizeof(float));
 
                 if (!adpars->GlobalPar.Hrandgrouping)
                     adpars->VoicePar[vc].FMSmp->newrandseed();
@@ -1150,7 +1150,7 @@ void ADnote::initParameters(void)
 
     if (subVoiceNumber != -1)
     {
-        NoteVoicePar[subVoiceNumber].VoiceOut = (float*)fftwf_malloc(synth->bufferbytes);
+        NoteVoicePar[subVoiceNumber].VoiceOut = (float*)NotePool::get(synth->bufferbytes);
         memset(NoteVoicePar[subVoiceNumber].VoiceOut, 0, synth->bufferbytes);
     }
 }
@@ -2444,11 +2444,11 @@ void ADnote::ComputeVoiceSpotNoise(int nvoice)
 // Compute the ADnote samples, returns 0 if the note is finished
 int ADnote::noteout(float *outl, float *outr)
 {
-    Config &Runtime = synth->getRuntime();
-    float *tmpwavel = Runtime.genTmp1;
-    float *tmpwaver = Runtime.genTmp2;
-    float *bypassl = Runtime.genTmp3;
-    float *bypassr = Runtime.genTmp4;
+    PartScratch &scratch = synth->scratch();
+    float *tmpwavel = scratch.genTmp1;
+    float *tmpwaver = scratch.genTmp2;
+    float *bypassl = scratch.genTmp3;
+    float *bypassr = scratch.genTmp4;
     int i, nvoice;
     if (outl != NULL) {
         memset(outl, 0, synth->sent_bufferbytes);
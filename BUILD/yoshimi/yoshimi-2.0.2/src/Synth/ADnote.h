@@ -30,6 +30,7 @@
 
 #include "Params/ADnoteParameters.h"
 #include "Misc/RandomGen.h"
+#include "Misc/NotePool.h"
 
 class ADnoteParameters;
 class Controller;
@@ -54,6 +55,8 @@ class ADnote
                float *parentFMmod_, bool forFM_);
         ADnote(const ADnote &orig, ADnote *topVoice_ = NULL, float *parentFMmod_ = NULL);
         ~ADnote();
+        static void *operator new(size_t size) { return NotePool::get(size); }
+        static void operator delete(void *ptr) { NotePool::release(ptr); }
 
         void construct();
 
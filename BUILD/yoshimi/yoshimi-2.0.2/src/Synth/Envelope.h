@@ -28,6 +28,7 @@
 
 #include "globals.h"
 #include "Params/Presets.h"
+#include "Misc/NotePool.h"
 
 class EnvelopeParams;
 class SynthEngine;
@@ -37,6 +38,8 @@ class Envelope
     public:
         Envelope(EnvelopeParams *envpars, float basefreq_, SynthEngine *_synth);
         ~Envelope() { };
+        static void *operator new(size_t size) { return NotePool::get(size); }
+        static void operator delete(void *ptr) { NotePool::release(ptr); }
         void releasekey(void);
         void recomputePoints(void);
         float envout(void);
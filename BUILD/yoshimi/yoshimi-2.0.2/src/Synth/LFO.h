@@ -30,6 +30,7 @@
 
 #include "Params/LFOParams.h"
 #include "Misc/NumericFuncs.h"
+#include "Misc/NotePool.h"
 
 class SynthEngine;
 
@@ -38,6 +39,8 @@ class LFO
     public:
         LFO(LFOParams *_lfopars, float basefreq, SynthEngine *_synth);
         ~LFO() { };
+        static void *operator new(size_t size) { return NotePool::get(size); }
+        static void operator delete(void *ptr) { NotePool::release(ptr); }
         float lfoout(void);
         float amplfoout(void);
     private:
@@ -28,6 +28,8 @@
 #ifndef PAD_NOTE_H
 #define PAD_NOTE_H
 
+#include "Misc/NotePool.h"
+
 class PADnoteParameters;
 class Controller;
 class Envelope;
@@ -44,6 +46,8 @@ class PADnote
                 float velocity, int portamento_, int midinote_, SynthEngine *_synth);
         PADnote(const PADnote &orig);
         ~PADnote();
+        static void *operator new(size_t size) { return NotePool::get(size); }
+        static void operator delete(void *ptr) { NotePool::release(ptr); }
 
         void legatoFadeIn(float freq_, float velocity_, int portamento_, int midinote_);
         void legatoFadeOut(const PADnote &orig);
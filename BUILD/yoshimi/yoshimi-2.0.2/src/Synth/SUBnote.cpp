@@ -167,13 +167,13 @@ SUBnote::SUBnote(const SUBnote &orig) :
 
     if (orig.lfilter != NULL)
     {
-        lfilter = new bpfilter[numstages * numharmonics];
+        lfilter = NotePool::getArray<bpfilter>(numstages * numharmonics);
         memcpy(lfilter, orig.lfilter,
             numstages * numharmonics * sizeof(bpfilter));
     }
     if (orig.rfilter != NULL)
     {
-        rfilter = new bpfilter[numstages * numharmonics];
+        rfilter = NotePool::getArray<bpfilter>(numstages * numharmonics);
         memcpy(rfilter, orig.rfilter,
             numstages * numharmonics * sizeof(bpfilter));
     }
@@ -276,10 +276,10 @@ void SUBnote::KillNote(void)
 {
     if (NoteStatus != NOTE_DISABLED)
     {
-        delete [] lfilter;
+        NotePool::release(lfilter);
         lfilter = NULL;
         if (stereo)
-            delete [] rfilter;
+            NotePool::release(rfilter);
         rfilter = NULL;
         delete AmpEnvelope;
         if (FreqEnvelope != NULL)
@@ -312,20 +312,20 @@ int SUBnote::createNewFilters()
     if (numharmonics == origNumHarmonics)
         return 0;
 
-    bpfilter *newFilter = new bpfilter[numstages * numharmonics];
+    bpfilter *newFilter = NotePool::getArray<bpfilter>(numstages * numharmonics);
     if (lfilter != NULL)
     {
         memcpy(newFilter, lfilter, numstages * origNumHarmonics * sizeof(bpfilter));
-        delete [] lfilter;
+        NotePool::release(lfilter);
     }
     lfilter = newFilter;
     if (stereo != 0)
     {
-        newFilter = new bpfilter[numstages * numharmonics];
+        newFilter = NotePool::getArray<bpfilter>(numstages * numharmonics);
         if (rfilter != NULL)
         {
             memcpy(newFilter, rfilter, numstages * origNumHarmonics * sizeof(bpfilter));
-            delete [] rfilter;
+            NotePool::release(rfilter);
         }
         rfilter = newFilter;
     }
@@ -697,8 +697,8 @@ void SUBnote::computecurrentparameters(void)
 // Note Output
 int SUBnote::noteout(float *outl, float *outr)
 {
-    tmpsmp = synth->getRuntime().genTmp1;
-    tmprnd = synth->getRuntime().genTmp2;
+    tmpsmp = synth->scratch().genTmp1;
+    tmprnd = synth->scratch().genTmp2;
     memset(outl, 0, synth->sent_bufferbytes);
     memset(outr, 0, synth->sent_bufferbytes);
     if (NoteStatus == NOTE_DISABLED)
@@ -28,6 +28,8 @@
 #ifndef SUB_NOTE_H
 #define SUB_NOTE_H
 
+#include "Misc/NotePool.h"
+
 class SUBnoteParameters;
 class Controller;
 class Envelope;
@@ -43,6 +45,8 @@ class SUBnote
                 int midinote_, SynthEngine *_synth);
         SUBnote(const SUBnote &rhs);
         ~SUBnote();
+        static void *operator new(size_t size) { return NotePool::get(size); }
+        static void operator delete(void *ptr) { NotePool::release(ptr); }
 
         void legatoFadeIn(float basefreq_, float velocity_, int portamento_, int midinote_);
         void legatoFadeOut(const SUBnote &syncwith);
@@ -108,6 +108,7 @@
 #define NUM_INS_EFX 8
 #define NUM_PART_EFX 3
 #define NUM_KIT_ITEMS 16
+#define MAX_PART_THREADS 16
 #define FADEIN_ADJUSTMENT_SCALE 20
 #define MAX_EQ_BANDS 8  // MAX_EQ_BANDS must be less than 20
 #define MAX_FILTER_STAGES 5
@@ -19,6 +19,7 @@
 
 
 #include <stdlib.h>
+#include <unistd.h>
 #include <string.h>
 #include <stdio.h>
 #include <math.h>
@@ -32,7 +33,12 @@ Alsathread::Alsathread (Alsa_pcmi *alsadev, int mode) :
     _fsize (alsadev->fsize ()),
     _audioq (0),
     _commq (0),
-    _alsaq (0)
+    _alsaq (0),
+    _direct (false),
+    _dchan (0),
+    _dsize (0),
+    _capt_conv (0),
+    _play_conv (0)
 {
     // Compute DLL filter coefficients.
     _dt = (double) _fsize / _alsadev->fsamp ();
@@ -50,6 +56,34 @@ Alsathread::~Alsathread (void)
 }
 
 
+int Alsathread::set_direct (void)
+{
+    snd_pcm_t            *H;
+    snd_pcm_hw_params_t  *P;
+    snd_pcm_access_t     acc;
+    snd_pcm_format_t     form;
+    unsigned int         nch;
+
+    // Use the mmap area directly if the device is interleaved
+    // and has a sample format we can convert.
+    H = (_mode == PLAY) ? _alsadev->play_handle () : _alsadev->capt_handle ();
+    if (H == 0) return 1;
+    snd_pcm_hw_params_alloca (&P);
+    if (   (snd_pcm_hw_params_current (H, P) < 0)
+        || (snd_pcm_hw_params_get_access (P, &acc) < 0)
+        || (snd_pcm_hw_params_get_format (P, &form) < 0)
+        || (snd_pcm_hw_params_get_channels (P, &nch) < 0)) return 1;
+    if (acc != SND_PCM_ACCESS_MMAP_INTERLEAVED) return 1;
+    _capt_conv = capt_conv (form);
+    _play_conv = play_conv (form);
+    if ((_capt_conv == 0) || (_play_conv == 0)) return 1;
+    _dchan = nch;
+    _dsize = snd_pcm_format_physical_width (form) / 8;
+    _direct = true;
+    return 0;
+}
+
+
 int Alsathread::start (Lfq_audio *audioq, Lfq_int32 *commq, Lfq_adata *alsaq, int rtprio)
 {
     // Start the ALSA thread.
@@ -151,9 +185,95 @@ int Alsathread::playback (void)
 }
 
 
+// Same as above, but accessing the mmap area directly instead of
+// using Alsa_pcmi's per-channel functions. Each contiguous part of
+// the ALSA buffer is converted to the audio queue in a single call.
+
+int Alsathread::capt_direct (void)
+{
+    const snd_pcm_channel_area_t  *A;
+    snd_pcm_uframes_t             offs, k;
+    snd_pcm_t                     *H;
+    int                           n, m, j;
+    const char                    *p;
+
+    H = _alsadev->capt_handle ();
+    for (n = _fsize; n; n -= k)
+    {
+	k = n;
+	if ((snd_pcm_mmap_begin (H, &A, &offs, &k) < 0) || (k == 0)) break;
+	if (_state == PROC)
+	{
+	    p = (const char *)(A->addr) + (A->first + offs * A->step) / 8;
+	    // The inner loop takes care of wraparound.
+	    for (j = k; j; j -= m)
+	    {
+		m = _audioq->wr_linav ();
+		if (m > j) m = j;
+		_capt_conv (p, _audioq->wr_datap (), m, _dchan, _audioq->nchan ());
+		_audioq->wr_commit (m);
+		p += m * _dchan * _dsize;
+	    }
+	}
+	snd_pcm_mmap_commit (H, offs, k);
+    }
+    return _fsize;
+}
+
+
+int Alsathread::play_direct (void)
+{
+    const snd_pcm_channel_area_t  *A;
+    snd_pcm_uframes_t             offs, k;
+    snd_pcm_t                     *H;
+    int                           n, m, j;
+    char                          *p;
+
+    H = _alsadev->play_handle ();
+    for (n = _fsize; n; n -= k)
+    {
+	k = n;
+	if ((snd_pcm_mmap_begin (H, &A, &offs, &k) < 0) || (k == 0)) break;
+	p = (char *)(A->addr) + (A->first + offs * A->step) / 8;
+	if (_state == PROC)
+	{
+	    // The inner loop takes care of wraparound.
+	    for (j = k; j; j -= m)
+	    {
+		m = _audioq->rd_linav ();
+		if (m > j) m = j;
+		_play_conv (_audioq->rd_datap (), p, m, _dchan, _audioq->nchan ());
+		_audioq->rd_commit (m);
+		p += m * _dchan * _dsize;
+	    }
+	}
+	else memset (p, 0, k * _dchan * _dsize);
+	snd_pcm_mmap_commit (H, offs, k);
+    }
+    return _fsize;
+}
+
+
+void Alsathread::realign (int32_t tw)
+{
+    double  p, t;
+
+    // Restart the device so that its period wakeups will be
+    // at time tw modulo the period time. The first one will
+    // be one period after the start.
+    _alsadev->pcm_stop ();
+    p = (double) _fsize / _alsadev->fsamp ();
+    t = modtime (1e-6 * tw - jacktime (jack_get_time ())) - p;
+    t -= p * floor (t / p);
+    if (t < 1e-3) t += p;
+    usleep ((useconds_t)(1e6 * t));
+    _alsadev->pcm_start ();
+}
+
+
 void Alsathread::thr_main (void)
 {
-    int     na, nu;
+    int     na, nu, k;
     double  tw, er;
 
     _alsadev->pcm_start ();
@@ -173,7 +293,16 @@ void Alsathread::thr_main (void)
         // Check for commands from the Jack thread.
         if (_commq->rd_avail ())
 	{
-	    _state = _commq->rd_int32 ();
+	    k = _commq->rd_int32 ();
+	    if (k & ALIGN)
+	    {
+		// Restart with the requested period phase. The Jack
+		// thread will then restart synchronisation.
+		realign (k & 0x0FFFFFFF);
+		_state = WAIT;
+		continue;
+	    }
+	    _state = k;
 	    if (_state == PROC) _first = true;
 	    if (_state == TERM) send (0, 0);
 	}
@@ -183,8 +312,8 @@ void Alsathread::thr_main (void)
         while (na >= _fsize)
        	{
 	    // Transfer frames.
-	    if (_mode == PLAY) nu += playback ();
-	    else               nu += capture ();
+	    if (_mode == PLAY) nu += _direct ? play_direct () : playback ();
+	    else               nu += _direct ? capt_direct () : capture ();
             // Update loop condition.
             na -= _fsize;
 	    // Run the DLL if in PROC state.
@@ -26,6 +26,7 @@
 #include <jack/jack.h>
 #include "pxthread.h"
 #include "lfqueue.h"
+#include "sampconv.h"
 
 
 class Alsathread : public Pxthread
@@ -34,11 +35,14 @@ public:
 
     enum { INIT, WAIT, PROC, TERM };
     enum { PLAY, CAPT };
+    // Command flag, the lower 28 bits are a Jack time in usecs.
+    enum { ALIGN = 0x10000000 };
 
     Alsathread (Alsa_pcmi  *alsadev, int mode);
     virtual ~Alsathread (void);
     virtual void thr_main (void);
 
+    int set_direct (void);
     int start (Lfq_audio *audioq, Lfq_int32 *commq, Lfq_adata *alsaq, int rtprio);
 
 private:
@@ -46,6 +50,9 @@ private:
     void send (int k, double t);
     int capture (void);
     int playback (void);
+    int capt_direct (void);
+    int play_direct (void);
+    void realign (int32_t tw);
 
     double modtime (double d)
     {
@@ -75,6 +82,11 @@ private:
     double        _dt;
     double        _w1;
     double        _w2;
+    bool          _direct;
+    int           _dchan;
+    int           _dsize;
+    Capt_conv     _capt_conv;
+    Play_conv     _play_conv;
 };
 
 
@@ -150,7 +150,8 @@ void Jackclient::start (Lfq_audio   *audioq,
                         double      ratio,
                         int         delay,
 			int         ltcor,
-                        int         rqual)
+                        int         rqual,
+                        int         amarg)
 {
     double d;
 
@@ -169,6 +170,19 @@ void Jackclient::start (Lfq_audio   *audioq,
         if (_mode == PLAY) d *= _ratio;
         _delay += d;
     }
+    _dnorm = _delay;
+    _amarg = amarg;
+    _acount = 0;
+    _acorr = 0;
+    if (_amarg)
+    {
+	// The ALSA period wakeups will be aligned to be _amarg
+	// frames before the start of the Jack cycle. For playback
+	// the Jack cycle must then finish before the next wakeup,
+	// for capture the ALSA thread must finish before the start
+	// of the Jack cycle. See checkphase().
+	_delay = (_mode == PLAY) ? _bsize : 2 * _amarg;
+    }
     _ltcor = ltcor;
     _ppsec = (_fsamp + _bsize / 2) / _bsize;
     initwait (_ppsec / 2);
@@ -225,6 +239,48 @@ void Jackclient::setloop (double bw)
 }
 
 
+bool Jackclient::checkphase (double tj, double ph)
+{
+    double e;
+
+    // This is used only with word clock sync and the same
+    // period size as the ALSA device, so the phase of the
+    // ALSA periods relative to the Jack cycle is constant.
+    // The argument ph is the time since the last ALSA period
+    // wakeup, in periods. Return true if the ALSA device
+    // needs to be restarted.
+    e = _bsize * (ph - floor (ph)) - _amarg;
+    if (e >= _bsize / 2) e -= _bsize;
+    if (fabs (e) <= 0.5 * _amarg)
+    {
+	_acount = 0;
+	return false;
+    }
+    if (_acount == 4)
+    {
+	// Give up, and use the normal delay.
+	_amarg = 0;
+	_delay = _dnorm;
+	sendinfo (NOALIGN, e, 0);
+	return false;
+    }
+    // After a restart requested here, the remaining error is
+    // due to the device start latency. Correct for it in the
+    // next one.
+    if (_acount++)
+    {
+	_acorr += e;
+	_acorr -= _bsize * floor (_acorr / _bsize + 0.5);
+    }
+    // Request the ALSA thread to restart with wakeups at the
+    // wanted time, then restart synchronisation.
+    _commq->wr_int32 (Alsathread::ALIGN | ((int)(1e6 * (tj + (_acorr - _amarg) / _fsamp)) & 0x0FFFFFFF));
+    sendinfo (ALIGN, e, 0);
+    initwait (_ppsec / 2);
+    return true;
+}
+
+
 void Jackclient::playback (int nframes)
 {
     int    i, j, n;
@@ -489,6 +545,7 @@ int Jackclient::jack_process (int nframes)
         // Compute the delay error.
         d1 = modtime (tj - _t_a0);
         d2 = modtime (_t_a1 - _t_a0);
+	if ((_state == SYNC2) && _amarg && checkphase (tj, d1 / d2)) return 0;
 	rd = _resamp ? _resamp->inpdist () : 0.0;
 
 	if (_mode == PLAY)
@@ -36,6 +36,8 @@ public:
     
     enum { PLAY, CAPT, MAXCHAN = 64 };
     enum { INIT, TERM, WAIT, SYNC0, SYNC1, SYNC2, PROC1, PROC2 };
+    // Info only, not used as state.
+    enum { ALIGN = 16, NOALIGN };
 
     void start (Lfq_audio   *audioq,
                 Lfq_int32   *commq, 
@@ -44,7 +46,10 @@ public:
                 double      ratio,
 	        int         delay,
 	        int         ltcor,
-	        int         rqual);
+	        int         rqual,
+	        int         amarg);
+
+    void recompute_latency (void) { jack_recompute_total_latencies (_client); }
 
     const char *jname (void) const { return _jname; }
     int fsamp (void) const { return _fsamp; }
@@ -71,6 +76,7 @@ private:
     void initwait (int nwait);
     void initsync (void);
     void setloop (double bw);
+    bool checkphase (double tj, double ph);
     void silence (int nframes);
     void playback (int nframes);
     void capture (int nframes);
@@ -110,7 +116,11 @@ private:
     int             _k_a0;
     int             _k_a1;
     double          _delay;
+    double          _dnorm;
     int             _ltcor;
+    int             _amarg;
+    int             _acount;
+    double          _acorr;
 
     double           _w0;
     double           _w1;
@@ -0,0 +1,312 @@
+// ----------------------------------------------------------------------------
+//
+//  Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ----------------------------------------------------------------------------
+
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "sampconv.h"
+
+
+// Scale factors, the same as used by zita-alsa-pcmi.
+
+#define G16  32767.0f
+#define G24  8388607.0f
+#define G32  2147483392.0f
+
+
+static inline int32_t ftoi (float v, float g)
+{
+    if (v >  1.0f) v =  1.0f;
+    if (v < -1.0f) v = -1.0f;
+    return lrintf (g * v);
+}
+
+
+// Each format class provides the conversion of a single sample,
+// and optionally SIMD code for a contiguous block of samples.
+// The latter return the number of samples done, the remaining
+// ones are converted one by one.
+
+class Fmt_s16
+{
+public:
+
+    enum { SIZE = 2 };
+
+    static float get (const char *p) { return *((const int16_t *) p) * (1.0f / G16); }
+    static void  put (char *p, float v) { *((int16_t *) p) = ftoi (v, G16); }
+
+    static int capt_simd (const char *src, float *dst, int n)
+    {
+	int i = 0;
+#ifdef __SSE2__
+	const __m128  g = _mm_set1_ps (1.0f / G16);
+	__m128i       x, a, b;
+
+	for (; i + 8 <= n; i += 8)
+	{
+	    x = _mm_loadu_si128 ((const __m128i *)(src + 2 * i));
+	    // Sign extend to 32 bits.
+	    a = _mm_srai_epi32 (_mm_unpacklo_epi16 (x, x), 16);
+	    b = _mm_srai_epi32 (_mm_unpackhi_epi16 (x, x), 16);
+	    _mm_storeu_ps (dst + i,     _mm_mul_ps (_mm_cvtepi32_ps (a), g));
+	    _mm_storeu_ps (dst + i + 4, _mm_mul_ps (_mm_cvtepi32_ps (b), g));
+	}
+#endif
+	return i;
+    }
+
+    static int play_simd (const float *src, char *dst, int n)
+    {
+	int i = 0;
+#ifdef __SSE2__
+	const __m128  g = _mm_set1_ps (G16);
+	const __m128  h = _mm_set1_ps (1.0f);
+	const __m128  l = _mm_set1_ps (-1.0f);
+	__m128        x, y;
+
+	for (; i + 8 <= n; i += 8)
+	{
+	    x = _mm_max_ps (_mm_min_ps (_mm_loadu_ps (src + i), h), l);
+	    y = _mm_max_ps (_mm_min_ps (_mm_loadu_ps (src + i + 4), h), l);
+	    _mm_storeu_si128 ((__m128i *)(dst + 2 * i),
+			      _mm_packs_epi32 (_mm_cvtps_epi32 (_mm_mul_ps (x, g)),
+					       _mm_cvtps_epi32 (_mm_mul_ps (y, g))));
+	}
+#endif
+	return i;
+    }
+};
+
+
+class Fmt_s24
+{
+public:
+
+    // 24 bits in the lower part of a 32-bit word.
+    enum { SIZE = 4 };
+
+    static float get (const char *p) { return ((int32_t)(*((const uint32_t *) p) << 8) >> 8) * (1.0f / G24); }
+    static void  put (char *p, float v) { *((int32_t *) p) = ftoi (v, G24); }
+
+    static int capt_simd (const char *src, float *dst, int n)
+    {
+	int i = 0;
+#ifdef __SSE2__
+	const __m128  g = _mm_set1_ps (1.0f / G24);
+	__m128i       x;
+
+	for (; i + 4 <= n; i += 4)
+	{
+	    x = _mm_loadu_si128 ((const __m128i *)(src + 4 * i));
+	    x = _mm_srai_epi32 (_mm_slli_epi32 (x, 8), 8);
+	    _mm_storeu_ps (dst + i, _mm_mul_ps (_mm_cvtepi32_ps (x), g));
+	}
+#endif
+	return i;
+    }
+
+    static int play_simd (const float *src, char *dst, int n)
+    {
+	int i = 0;
+#ifdef __SSE2__
+	const __m128  g = _mm_set1_ps (G24);
+	const __m128  h = _mm_set1_ps (1.0f);
+	const __m128  l = _mm_set1_ps (-1.0f);
+	__m128        x;
+
+	for (; i + 4 <= n; i += 4)
+	{
+	    x = _mm_max_ps (_mm_min_ps (_mm_loadu_ps (src + i), h), l);
+	    _mm_storeu_si128 ((__m128i *)(dst + 4 * i), _mm_cvtps_epi32 (_mm_mul_ps (x, g)));
+	}
+#endif
+	return i;
+    }
+};
+
+
+class Fmt_s24_3
+{
+public:
+
+    // Packed 24 bits, little-endian. No SIMD code.
+    enum { SIZE = 3 };
+
+    static float get (const char *p)
+    {
+	const unsigned char *q = (const unsigned char *) p;
+	uint32_t s = (q [0] << 8) | (q [1] << 16) | ((uint32_t) q [2] << 24);
+	return ((int32_t) s >> 8) * (1.0f / G24);
+    }
+
+    static void put (char *p, float v)
+    {
+	int32_t s = ftoi (v, G24);
+	p [0] = s;
+	p [1] = s >> 8;
+	p [2] = s >> 16;
+    }
+
+    static int capt_simd (const char *, float *, int) { return 0; }
+    static int play_simd (const float *, char *, int) { return 0; }
+};
+
+
+class Fmt_s32
+{
+public:
+
+    enum { SIZE = 4 };
+
+    static float get (const char *p) { return *((const int32_t *) p) * (1.0f / G32); }
+    static void  put (char *p, float v) { *((int32_t *) p) = ftoi (v, G32); }
+
+    static int capt_simd (const char *src, float *dst, int n)
+    {
+	int i = 0;
+#ifdef __SSE2__
+	const __m128  g = _mm_set1_ps (1.0f / G32);
+	__m128i       x;
+
+	for (; i + 4 <= n; i += 4)
+	{
+	    x = _mm_loadu_si128 ((const __m128i *)(src + 4 * i));
+	    _mm_storeu_ps (dst + i, _mm_mul_ps (_mm_cvtepi32_ps (x), g));
+	}
+#endif
+	return i;
+    }
+
+    static int play_simd (const float *src, char *dst, int n)
+    {
+	int i = 0;
+#ifdef __SSE2__
+	const __m128  g = _mm_set1_ps (G32);
+	const __m128  h = _mm_set1_ps (1.0f);
+	const __m128  l = _mm_set1_ps (-1.0f);
+	__m128        x;
+
+	for (; i + 4 <= n; i += 4)
+	{
+	    x = _mm_max_ps (_mm_min_ps (_mm_loadu_ps (src + i), h), l);
+	    _mm_storeu_si128 ((__m128i *)(dst + 4 * i), _mm_cvtps_epi32 (_mm_mul_ps (x, g)));
+	}
+#endif
+	return i;
+    }
+};
+
+
+class Fmt_float
+{
+public:
+
+    enum { SIZE = 4 };
+
+    static float get (const char *p) { return *((const float *) p); }
+    static void  put (char *p, float v) { *((float *) p) = v; }
+
+    static int capt_simd (const char *src, float *dst, int n)
+    {
+	memcpy (dst, src, n * sizeof (float));
+	return n;
+    }
+
+    static int play_simd (const float *src, char *dst, int n)
+    {
+	memcpy (dst, src, n * sizeof (float));
+	return n;
+    }
+};
+
+
+template <class F> static void capt (const char *src, float *dst, int nfrm, int ndev, int nchan)
+{
+    int i, j, n;
+
+    if (ndev == nchan)
+    {
+	n = nfrm * nchan;
+	for (i = F::capt_simd (src, dst, n); i < n; i++) dst [i] = F::get (src + i * F::SIZE);
+    }
+    else
+    {
+	for (i = 0; i < nfrm; i++)
+	{
+	    for (j = 0; j < nchan; j++) dst [j] = F::get (src + j * F::SIZE);
+	    src += ndev * F::SIZE;
+	    dst += nchan;
+	}
+    }
+}
+
+
+template <class F> static void play (const float *src, char *dst, int nfrm, int ndev, int nchan)
+{
+    int i, j, n;
+
+    if (ndev == nchan)
+    {
+	n = nfrm * nchan;
+	for (i = F::play_simd (src, dst, n); i < n; i++) F::put (dst + i * F::SIZE, src [i]);
+    }
+    else
+    {
+	for (i = 0; i < nfrm; i++)
+	{
+	    for (j = 0; j < nchan; j++) F::put (dst + j * F::SIZE, src [j]);
+	    for (; j < ndev; j++) F::put (dst + j * F::SIZE, 0.0f);
+	    src += nchan;
+	    dst += ndev * F::SIZE;
+	}
+    }
+}
+
+
+Capt_conv capt_conv (snd_pcm_format_t form)
+{
+    switch (form)
+    {
+    case SND_PCM_FORMAT_S16:     return capt <Fmt_s16>;
+    case SND_PCM_FORMAT_S24:     return capt <Fmt_s24>;
+    case SND_PCM_FORMAT_S24_3LE: return capt <Fmt_s24_3>;
+    case SND_PCM_FORMAT_S32:     return capt <Fmt_s32>;
+    case SND_PCM_FORMAT_FLOAT:   return capt <Fmt_float>;
+    default: return 0;
+    }
+}
+
+
+Play_conv play_conv (snd_pcm_format_t form)
+{
+    switch (form)
+    {
+    case SND_PCM_FORMAT_S16:     return play <Fmt_s16>;
+    case SND_PCM_FORMAT_S24:     return play <Fmt_s24>;
+    case SND_PCM_FORMAT_S24_3LE: return play <Fmt_s24_3>;
+    case SND_PCM_FORMAT_S32:     return play <Fmt_s32>;
+    case SND_PCM_FORMAT_FLOAT:   return play <Fmt_float>;
+    default: return 0;
+    }
+}
@@ -0,0 +1,46 @@
+// ----------------------------------------------------------------------------
+//
+//  Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ----------------------------------------------------------------------------
+
+
+#ifndef __SAMPCONV_H
+#define __SAMPCONV_H
+
+
+#include <alsa/asoundlib.h>
+
+
+// Sample format conversion between an interleaved ALSA buffer
+// with 'ndev' channels and the interleaved float audio queue
+// with 'nchan' channels, nchan <= ndev. Capture ignores the
+// extra device channels, playback clears them.
+//
+// If ndev == nchan all samples are converted in a single loop,
+// using SSE2 code where available.
+
+typedef void (*Capt_conv)(const char *src, float *dst, int nfrm, int ndev, int nchan);
+typedef void (*Play_conv)(const float *src, char *dst, int nfrm, int ndev, int nchan);
+
+
+// These return 0 if the format is not supported.
+
+extern Capt_conv capt_conv (snd_pcm_format_t form);
+extern Play_conv play_conv (snd_pcm_format_t form);
+
+
+#endif
@@ -34,10 +34,11 @@ static Lfq_jdata   infoq (256);
 static Lfq_audio  *audioq = 0;
 static bool stop = false;
 
-static const char   *clopt = "hvLSj:d:r:p:n:c:Q:I:";
+static const char   *clopt = "hvLSMj:d:r:p:n:c:Q:I:A:";
 static bool          v_opt = false;
 static bool          L_opt = false;
 static bool          S_opt = false;
+static bool          M_opt = false;
 static const char   *jname = APPNAME;
 static const char   *device = 0;
 static int           fsamp = 48000;
@@ -46,6 +47,8 @@ static int           nfrag = 2;
 static int           nchan = 2;
 static int           rqual = 0;
 static int           ltcor = 0;
+static int           amarg = 0;
+static bool          newlat = false;
 
 
 static void help (void)
@@ -65,6 +68,8 @@ static void help (void)
     fprintf (stderr, "  -S                 Word clock sync, no resampling\n");
     fprintf (stderr, "  -Q <quality>       Resampling quality, 16..96 [auto]\n");
     fprintf (stderr, "  -I <samples>       Latency adjustment [0]\n");
+    fprintf (stderr, "  -M                 Direct mmap transfer [off]\n");
+    fprintf (stderr, "  -A <usecs>         Align periods to Jack, with -S [off]\n");
     fprintf (stderr, "  -L                 Force 16-bit and 2 channels [off]\n");
     fprintf (stderr, "  -v                 Print tracing information [off]\n");
     exit (1);
@@ -90,6 +95,7 @@ static void procoptions (int ac, char *av [])
         case 'h' : help (); exit (0);
         case 'v' : v_opt = true; break;
         case 'L' : L_opt = true; break;
+        case 'M' : M_opt = true; break;
 	case 'S' : S_opt = true; break;
         case 'j' : jname = optarg; break;
         case 'd' : device = optarg; break;
@@ -98,6 +104,7 @@ static void procoptions (int ac, char *av [])
 	case 'n' : nfrag = atoi (optarg); break;    
 	case 'c' : nchan = atoi (optarg); break;    
 	case 'Q' : rqual = atoi (optarg); break;    
+	case 'A' : amarg = atoi (optarg); break;    
 	case 'I' : ltcor = atoi (optarg); break;    
         case '?':
             if (optopt != ':' && strchr (clopt, optopt))
@@ -155,6 +162,15 @@ static void printinfo (void)
 	{
             printf ("Starting synchronisation.\n");
 	}
+	else if (J->_state == Jackclient::ALIGN)
+	{
+	    if (v_opt) printf ("Aligning periods, error %3.0lf frames.\n", J->_error);
+	}
+	else if (J->_state == Jackclient::NOALIGN)
+	{
+	    printf ("Can't align periods, using the normal delay.\n");
+	    newlat = true;
+	}
 	else if (v_opt)
 	{
 	    n++;
@@ -173,14 +189,14 @@ int main (int ac, char *av [])
     Alsa_pcmi      *A = 0;
     Alsathread     *C = 0;
     Jackclient     *J = 0;
-    int            k, k_del, opts;
+    int            k, k_del, k_mrg, opts;
     double         t_jack;
     double         t_alsa;
     double         t_del;
 
     procoptions (ac, av);
     if (device == 0) help ();
-    if ((fsamp < 8000) || (bsize < 16) || (nfrag < 2) || (nchan < 1))
+    if ((fsamp < 8000) || (bsize < 16) || (nfrag < 2) || (nchan < 1) || (amarg < 0))
     {
 	fprintf (stderr, "Illegal parameter value(s).\n");
 	return 1;
@@ -203,6 +219,10 @@ int main (int ac, char *av [])
     }
     C = new Alsathread (A, Alsathread::CAPT);
     J = new Jackclient (jname, 0, Jackclient::CAPT, nchan, S_opt);
+    if (M_opt && C->set_direct ())
+    {
+	fprintf (stderr, "Warning: direct mmap transfer not supported for this device.\n");
+    }
     usleep (100000);
 
     t_alsa = (double) bsize / fsamp;
@@ -213,6 +233,24 @@ int main (int ac, char *av [])
     for (k = 256; k < 2 * k_del; k *= 2);
     audioq = new Lfq_audio (k, nchan);
 
+    k_mrg = 0;
+    if (amarg)
+    {
+	// Period alignment requires the ALSA device and Jack
+	// to run in lockstep.
+	k_mrg = (int)(1e-6 * amarg * fsamp + 0.5);
+	if (! S_opt || (fsamp != J->fsamp ()) || (bsize != J->bsize ()))
+	{
+	    fprintf (stderr, "Warning: period alignment requires -S, and the same rate and period size as Jack.\n");
+	    k_mrg = 0;
+	}
+	else if ((k_mrg < 1) || (k_mrg > bsize / 2))
+	{
+	    fprintf (stderr, "Warning: alignment margin must be less than half a period.\n");
+	    k_mrg = 0;
+	}
+    }
+
     if (rqual == 0)
     {
         k = (fsamp < J->fsamp ()) ? fsamp : J->fsamp ();
@@ -223,13 +261,18 @@ int main (int ac, char *av [])
     if (rqual > 96) rqual = 96;
 
     C->start (audioq, &commq, &alsaq, J->rprio () + 10);
-    J->start (audioq, &commq, &alsaq, &infoq, J->fsamp () / (double) fsamp, k_del, ltcor, rqual);
+    J->start (audioq, &commq, &alsaq, &infoq, J->fsamp () / (double) fsamp, k_del, ltcor, rqual, k_mrg);
 
     signal (SIGINT, sigint_handler);
     while (! stop)
     {
 	usleep (250000);
 	printinfo ();
+	if (newlat)
+	{
+	    J->recompute_latency ();
+	    newlat = false;
+	}
     }
 
     commq.wr_int32 (Alsathread::TERM);
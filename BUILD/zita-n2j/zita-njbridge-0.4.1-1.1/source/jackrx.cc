@@ -27,11 +27,19 @@
 #include "netrx.h"
 
 
-Jackrx::Jackrx (const char *jname, const char*jserv, int nchan, const int *clist) :
+// Adaptive delay: margin added to the arrival time percentile,
+// and maximum rate of change of the delay.
+#define GUARD 0.25e-3
+#define SLEW  5e-4
+
+
+Jackrx::Jackrx (const char *jname, const char*jserv, int nchan, const int *clist, int nstream) :
     _client (0),
     _nchan (nchan),     
-    _state (INIT),
-    _freew (false)
+    _nstream (nstream),
+    _active (false),
+    _freew (false),
+    _buff (0)
 {
     init (jname, jserv, clist);
 }
@@ -45,10 +53,11 @@ Jackrx::~Jackrx (void)
 
 void Jackrx::init (const char *jname, const char *jserv, const int *clist)
 {
-    int                 i, opts, spol, flags;
-    char                s [16];
+    int                 i, j, opts, spol, flags;
+    char                s [32];
     jack_status_t       stat;
     struct sched_param  spar;
+    Rxstream            *S;
 
     opts = JackNoStartServer;
     if (jserv) opts |= JackServerName;
@@ -77,33 +86,49 @@ void Jackrx::init (const char *jname, const char *jserv, const int *clist)
 
     flags = JackPortIsTerminal | JackPortIsPhysical;
     if (_nchan > Netdata::MAXCHAN) _nchan = Netdata::MAXCHAN;
-    for (i = 0; i < _nchan; i++)
+    if (_nstream > MAXSTREAM) _nstream = MAXSTREAM;
+    for (j = 0; j < _nstream; j++)
     {
-        sprintf (s, "out_%d", clist [i] + 1);
-        _ports [i] = jack_port_register (_client, s, JACK_DEFAULT_AUDIO_TYPE,
-                                         flags | JackPortIsOutput, 0);
+	S = new Rxstream (this, j, _nchan);
+        for (i = 0; i < _nchan; i++)
+        {
+	    // Keep the original port names if there is only one stream.
+	    if (_nstream > 1) sprintf (s, "s%d_out_%d", j + 1, clist [i] + 1);
+	    else sprintf (s, "out_%d", clist [i] + 1);
+            S->_ports [i] = jack_port_register (_client, s, JACK_DEFAULT_AUDIO_TYPE,
+                                                flags | JackPortIsOutput, 0);
+        }
+	S->_state = Rxstream::IDLE;
+	_streams [j] = S;
     }
     pthread_getschedparam (jack_client_thread_id (_client), &spol, &spar);
     _rprio = spar.sched_priority -  sched_get_priority_max (spol);
+    // The resampler output buffer is used by each stream in turn.
     _buff = new float [_bsize * _nchan];
-    _state = IDLE;
+    _active = true;
 }
 
 
 void Jackrx::fini (void)
 {
+    int i;
+
     if (_client)
     {
         jack_deactivate (_client);
         jack_client_close (_client);
     }
+    if (_active)
+    {
+	for (i = 0; i < _nstream; i++) delete _streams [i];
+    }
     delete[] _buff;
 }
 
 
 void Jackrx::jack_static_shutdown (void *arg)
 {
-    ((Jackrx *) arg)->sendinfo (FATAL, 0, 0, 0);
+    ((Jackrx *) arg)->jack_shutdown ();
 }
 
 
@@ -131,14 +156,94 @@ int Jackrx::jack_static_process (jack_nframes_t nframes, void *arg)
 }
 
 
-void Jackrx::start (Lfq_audio      *audioq,
-                    Lfq_int32      *commq, 
-                    Lfq_timedata   *timeq,
-                    Lfq_timedata   *syncq,
-                    Lfq_infodata   *infoq,
-                    double         ratio,
-                    int            delay,
-                    int            rqual)
+void Jackrx::jack_shutdown (void)
+{
+    int i;
+
+    if (! _active) return;
+    for (i = 0; i < _nstream; i++) _streams [i]->sendinfo (Rxstream::FATAL, 0, 0, 0);
+}
+
+
+void Jackrx::jack_freewheel (int yesno)
+{
+    int i;
+
+    _freew = yesno ? true : false;
+    if (_freew && _active)
+    {
+	for (i = 0; i < _nstream; i++)
+	{
+	    if (_streams [i]->_state >= Rxstream::WAIT) _streams [i]->initwait (_streams [i]->_ppsec / 4);
+	}
+    }
+}
+
+
+void Jackrx::jack_buffsize (int bsize)
+{
+    int i;
+
+    if (_bsize == 0) _bsize = bsize;
+    else if ((_bsize != bsize) && _active)
+    {
+	for (i = 0; i < _nstream; i++) _streams [i]->_state = Rxstream::FATAL;
+    }
+}
+
+
+int Jackrx::jack_process (int nframes)
+{
+    int             i;
+    jack_time_t     t0, t1;
+    jack_nframes_t  ft;
+    float           usecs;
+
+    // Skip cycle if ports may not yet exist.
+    if (! _active) return 0;
+
+    // Get local timing info, common to all streams.
+    jack_get_cycle_times (_client, &ft, &t0, &t1, &usecs);
+    for (i = 0; i < _nstream; i++) _streams [i]->process (nframes, t0, t1);
+    return 0;
+}
+
+
+Rxstream::Rxstream (Jackrx *jackrx, int index, int nchan) :
+    _jackrx (jackrx),
+    _master (0),
+    _index (index),
+    _nchan (nchan),
+    _state (INIT),
+    _fsamp (jackrx->_fsamp),
+    _bsize (jackrx->_bsize),
+    _infoq (0),
+    _syncnt (0),
+    _dprob (0),
+    _htot (0)
+{
+    _hist = new float [NHIST];
+    memset (_hist, 0, NHIST * sizeof (float));
+    memset (_jitt, 0, 3 * sizeof (float));
+}
+
+
+Rxstream::~Rxstream (void)
+{
+    delete[] _hist;
+}
+
+
+void Rxstream::start (Lfq_audio      *audioq,
+                      Lfq_int32      *commq, 
+                      Lfq_timedata   *timeq,
+                      Lfq_timedata   *syncq,
+                      Lfq_infodata   *infoq,
+                      double         ratio,
+                      int            delay,
+                      int            rqual,
+                      double         dband,
+                      double         dprob)
 {
     _audioq = audioq;
     _commq = commq;
@@ -149,7 +254,19 @@ void Jackrx::start (Lfq_audio      *audioq,
     _rcorr = 1.0;
     _resamp.setup (_ratio, _nchan, rqual);
     _resamp.set_rrfilt (100);
+    // The filter can be bypassed only if both sample rates are the same.
+    _resamp.set_dband ((_ratio == 1.0) ? dband : 0.0);
     _delay = delay;
+    _dmax = delay;
+    _dtarg = delay;
+    _dprob = dprob;
+    // Older data is forgotten by halving the histogram, but
+    // only once it has enough data for the dropout probability.
+    _hmax = (dprob > 0) ? 4 / dprob : 0;
+    if (_hmax < 4000) _hmax = 4000;
+    _htot = 0;
+    memset (_hist, 0, NHIST * sizeof (float));
+    memset (_jitt, 0, 3 * sizeof (float));
     _ppsec = (_fsamp + _bsize / 2) / _bsize;
     _first = true;
     _tnext = 0;
@@ -158,7 +275,7 @@ void Jackrx::start (Lfq_audio      *audioq,
 }
 
 
-void Jackrx::initwait (int nwait)
+void Rxstream::initwait (int nwait)
 {
     _count = -nwait;
     _commq->wr_int32 (Netrx::WAIT);
@@ -167,7 +284,7 @@ void Jackrx::initwait (int nwait)
 }
 
 
-void Jackrx::initsync (void)
+void Rxstream::initsync (void)
 {
 //  Reset all lock-free queues.
     _commq->reset ();
@@ -184,6 +301,8 @@ void Jackrx::initsync (void)
     _k_a0 = _k_a1 = 0;
     // Initialise loop filter state.
     _z1 = _z2 = _z3 = 0;
+    // Start again from the maximum delay.
+    _delay = _dtarg = _dmax;
     // Activate the netrx thread,
     _commq->wr_int32 (Netrx::PROC);
     _state = SYNC0;
@@ -193,7 +312,7 @@ void Jackrx::initsync (void)
 }
 
 
-void Jackrx::setloop (double bw)
+void Rxstream::setloop (double bw)
 {
     double w;
 
@@ -205,15 +324,16 @@ void Jackrx::setloop (double bw)
 }
 
 
-void Jackrx::capture (int nframes)
+void Rxstream::capture (int nframes)
 {
     int    i, j, k1, k2;
-    float  *p, *q;
+    float  *p, *q, *buff;
 
     // Read from audio queue and resample.
     // The while loop takes care of wraparound.
+    buff = _jackrx->_buff;
     _resamp.out_count = _bsize;
-    _resamp.out_data  = _buff;
+    _resamp.out_data  = buff;
     while (_resamp.out_count)
     {
 	// Allow the audio queue to underrun, but
@@ -241,17 +361,17 @@ void Jackrx::capture (int nframes)
         // number of frames consumed.
 	_audioq->rd_commit (k1);
     }
-    // Deinterleave _buff to outputs.
+    // Deinterleave buff to outputs.
     for (j = 0; j < _nchan; j++)
     {
-	p = _buff + j;
+	p = buff + j;
 	q = (float *)(jack_port_get_buffer (_ports [j], nframes));
 	for (i = 0; i < _bsize; i++) q [i] = p [i * _nchan];
     }       
 }
 
 
-void Jackrx::silence (int nframes)
+void Rxstream::silence (int nframes)
 {
     int    i;
     float  *q;
@@ -265,11 +385,12 @@ void Jackrx::silence (int nframes)
 }
 
 
-void Jackrx::sendinfo (int state, double error, double ratio, int nfram)
+void Rxstream::sendinfo (int state, double error, double ratio, int nfram)
 {
     Infodata *I;
 
-    if (_infoq->wr_avail ())
+    // The info queue exists only after start().
+    if (_infoq && _infoq->wr_avail ())
     {
 	I = _infoq->wr_datap ();
 	I->_state = state;
@@ -277,50 +398,36 @@ void Jackrx::sendinfo (int state, double error, double ratio, int nfram)
 	I->_ratio = ratio;
 	I->_nfram = nfram;
 	I->_syncc = _syncnt;
+	I->_delay = 1e3 * _delay * _ratio / _fsamp;
+	memcpy (I->_jitt, _jitt, 3 * sizeof (float));
 	_infoq->wr_commit ();
     }
 }
 
 
-void Jackrx::jack_freewheel (int yesno)
-{
-    _freew = yesno ? true : false;
-    if (_freew) initwait (_ppsec / 4);
-}
-
-
-void Jackrx::jack_buffsize (int bsize)
-{
-    if (_bsize == 0) _bsize = bsize;
-    else if (_bsize != bsize) _state = Jackrx::FATAL;
-}
-
-
-int Jackrx::jack_process (int nframes)
+void Rxstream::process (int nframes, jack_time_t t0, jack_time_t t1)
 {
     int             k, nskip;
-    double          d1, d2, err;
-    jack_time_t     t0, t1;
-    jack_nframes_t  ft;
+    double          d1, d2, err, dd, dm, ff;
     float           usecs;
     bool            shift; 
     Timedata        *D;
 
-    // Skip cylce if ports may not yet exist.
-    if (_state < IDLE) return 0;
+    // Skip cycle if ports may not yet exist.
+    if (_state < IDLE) return;
 
     // Buffer size change, no data, or other evil.
     if (_state >= TXEND)
     {
 	sendinfo (_state, 0, 0, 0);
 	_state = IDLE;
-	return 0;
+	return;
     }
     // Output silence if idle.
     if (_state < WAIT)
     {
 	silence (nframes);
-        return 0;
+        return;
     }
 
     // Start synchronisation 1/2 second after entering
@@ -328,13 +435,12 @@ int Jackrx::jack_process (int nframes)
     if (_state == WAIT)
     {
 	silence (nframes);
-	if (_freew) return 0;
+	if (_jackrx->_freew) return;
         if (++_count == 0) initsync ();
-        else return 0;
+        else return;
     }
 
-    // Get local timing info.
-    jack_get_cycle_times (_client, &ft, &t0, &t1, &usecs);
+    // Local timing info.
     _t_j0 = tjack (t0);
     if (_first)
     {
@@ -356,7 +462,8 @@ int Jackrx::jack_process (int nframes)
     if (_timeq->rd_avail () >= _timeq->nelm ())
     {
         initwait (_ppsec / 2);
-        return 0;
+	silence (nframes);
+        return;
     }
     shift = true;
     while (_timeq->rd_avail ())
@@ -369,7 +476,8 @@ int Jackrx::jack_process (int nframes)
 	    // thread signals a problem. This will happen
 	    // when the sender goes into freewheeling mode.
 	    initwait (_ppsec / 2);
-	    return 0;
+	    silence (nframes);
+	    return;
 	case Netrx::PROC:
             // Frame count and reception time stamp.
 	    if (_state < SYNC2)
@@ -385,6 +493,7 @@ int Jackrx::jack_process (int nframes)
 	    }
 	    _k_a1 = D->_count;
 	    _t_a1 = D->_tjack;
+	    if (_state == PROC2) addtime (D->_tlate);
 	    break;
 //	case Netrx::TNTP:
 //	    // Frame count and system time at sender.
@@ -393,15 +502,33 @@ int Jackrx::jack_process (int nframes)
 	case Netrx::TERM:
 	    // Sender terminated.
 	    _state = TXEND;
-	    return 0;
+	    silence (nframes);
+	    return;
 	case Netrx::FAIL:
 	    // Fatal error in netrx thread.
 	    _state = FATAL;
-	    return 0;
+	    silence (nframes);
+	    return;
 	}
 	_timeq->rd_commit ();
     }
 
+    // Move the delay towards the target, at a rate that
+    // is compensated by the resampling ratio, so the loop
+    // error does not change.
+    ff = 1.0;
+    if ((_state == PROC2) && (_dtarg != _delay))
+    {
+	// Input frames per cycle, and maximum change.
+	ff = _bsize / _ratio;
+	dm = SLEW * ff;
+	dd = _dtarg - _delay;
+	if (dd >  dm) dd =  dm;
+	if (dd < -dm) dd = -dm;
+	_delay += dd;
+	ff = 1.0 + dd / ff;
+    }
+
     err = 0;
     if (_state >= SYNC2)
     {
@@ -430,23 +557,46 @@ int Jackrx::jack_process (int nframes)
         setloop (0.05);
     } 
 
+    // Update the delay target once per second.
+    if ((_state == PROC2) && (++_count % _ppsec == 0)) adapt ();
+
     if (_state >= PROC1)
     {
-        // Run loop filter and set resample ratio.
-        _z1 += _w0 * (_w1 * err - _z1);
-        _z2 += _w0 * (_z1 - _z2);
-        _z3 += _w2 * _z2;
-        if (fabs (_z3) > 0.05)
-        {
-            // Something is really wrong.
-	    // Wait 10 seconds then restart.
-            initwait (10 * _ppsec);
-            return 0;
-        }
-        _rcorr = 1 - (_z2 + _z3);
-	if (_rcorr > 1.05) _rcorr = 1.05;
-	if (_rcorr < 0.95) _rcorr = 0.95;
-        _resamp.set_rratio (_rcorr);
+	if (_master && (_master->_state >= PROC1) && (_master->_ratio == _ratio))
+	{
+	    // Same clock as the master stream, use its ratio.
+	    // The error should remain small, if not then the
+	    // clocks are not the same and we restart.
+	    if (fabs (err) > _bsize)
+	    {
+		initwait (_ppsec / 2);
+		silence (nframes);
+		return;
+	    }
+	    _rcorr = _master->_rcorr;
+	    // Continue from here if the master stops.
+	    _z1 = _z2 = 0;
+	    _z3 = 1 - _rcorr;
+	}
+	else
+	{
+            // Run loop filter and set resample ratio.
+            _z1 += _w0 * (_w1 * err - _z1);
+            _z2 += _w0 * (_z1 - _z2);
+            _z3 += _w2 * _z2;
+            if (fabs (_z3) > 0.05)
+            {
+                // Something is really wrong.
+	        // Wait 10 seconds then restart.
+                initwait (10 * _ppsec);
+	        silence (nframes);
+                return;
+            }
+            _rcorr = 1 - (_z2 + _z3);
+	    if (_rcorr > 1.05) _rcorr = 1.05;
+	    if (_rcorr < 0.95) _rcorr = 0.95;
+	}
+        _resamp.set_rratio (_rcorr * ff);
 
 	// Resample and transfer between audio
         // queue and jack ports.
@@ -456,8 +606,57 @@ int Jackrx::jack_process (int nframes)
 	if (k < -_limit) _state = TXEND;
     }
     else silence (nframes);
+}
+
+
+void Rxstream::addtime (double tlate)
+{
+    int i;
+
+    i = (int)(floor ((tlate + 50e-3) / 50e-6));
+    if (i < 0) i = 0;
+    if (i >= NHIST) i = NHIST - 1;
+    _hist [i] += 1;
+    _htot += 1;
+    if (_htot >= _hmax)
+    {
+	for (i = 0; i < NHIST; i++) _hist [i] *= 0.5f;
+	_htot *= 0.5;
+    }
+}
+
 
-    return 0; 
+void Rxstream::adapt (void)
+{
+    int     i, k;
+    double  s, d, q [4], v [4];
+
+    // Find the arrival time percentiles, the last
+    // one is for the required dropout probability.
+    q [0] = 0.5 * _htot;
+    q [1] = 0.99 * _htot;
+    q [2] = 0.999 * _htot;
+    q [3] = (1 - _dprob) * _htot;
+    s = 0;
+    for (i = k = 0; (i < NHIST) && (k < 4); i++)
+    {
+	s += _hist [i];
+	while ((k < 4) && (s >= q [k])) v [k++] = (i + 1) * 50e-6 - 50e-3;
+    }
+    while (k < 4) v [k++] = NHIST * 50e-6 - 50e-3;
+    for (i = 0; i < 3; i++) _jitt [i] = 1e3 * v [i];
+    if ((_dprob <= 0) || (_htot < 0.5 * _hmax)) return;
+
+    // Frames of the packets received at some time are needed
+    // from a time given by the delay, minus the receiver's
+    // period and half the resampler filter length. Data is
+    // in time if that is later than its arrival time.
+    d = (v [3] + GUARD) * _fsamp / _ratio + _bsize / _ratio + _resamp.inpsize () / 2;
+    if (d < 0) d = 0;
+    if (d > _dmax) d = _dmax;
+    // Increase the delay at once, decrease it only if
+    // the change is more than 0.5 ms.
+    if ((d > _dtarg) || (d < _dtarg - 0.5e-3 * _fsamp / _ratio)) _dtarg = d;
 }
 
 
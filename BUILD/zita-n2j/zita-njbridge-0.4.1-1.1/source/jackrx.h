@@ -22,19 +22,26 @@
 #define __JACKRX_H
 
 
-#include <zita-resampler/vresampler.h>
 #include <jack/jack.h>
+#include "mcresampler.h"
 #include "lfqueue.h"
 #include "netdata.h"
 
 
-class Jackrx
+class Jackrx;
+
+
+// State of one received stream. All streams are processed
+// by the callback of a single Jack client, but each of them
+// has its own queues, delay locked loop and resampler.
+//
+class Rxstream
 {
 public:
 
-    Jackrx (const char  *jname, const char *jserv, int nchan, const int *clist);
-    virtual ~Jackrx (void);
-    
+    Rxstream (Jackrx *jackrx, int index, int nchan);
+    ~Rxstream (void);
+
     enum { INIT, IDLE, WAIT, SYNC0, SYNC1, SYNC2, PROC1, PROC2, TXEND, FATAL };
 
     void start (Lfq_audio     *audioq,
@@ -44,17 +51,20 @@ public:
 		Lfq_infodata  *infoq,
                 double         ratio,
 	        int            delay,
-	        int            rqual);
+	        int            rqual,
+	        double         dband,
+	        double         dprob);
 
-    const char *jname (void) const { return _jname; }
-    int fsamp (void) const { return _fsamp; }
-    int bsize (void) const { return _bsize; }
-    int rprio (void) const { return _rprio; }
+    // Use the resampling ratio of another stream
+    // having the same clock.
+    void set_master (Rxstream *master) { _master = master; }
 
 private:
 
-    void init (const char *jname, const char *jserv, const int *clist);
-    void fini (void);
+    friend class Jackrx;
+
+    // Arrival time histogram, bins of 50 us from -50 ms.
+    enum { NHIST = 4000 };
 
     void initwait (int nwait);
     void initsync (void);
@@ -62,27 +72,19 @@ private:
     void silence (int nframes);
     void capture (int nframes);
     void sendinfo (int state, double error, double ratio, int nfram);
-    void procsync (int32_t ctx, uint32_t stx, uint32_t ftx);
-
-    virtual void thr_main (void) {}
+    void process (int nframes, jack_time_t t0, jack_time_t t1);
+    void addtime (double tlate);
+    void adapt (void);
 
-    void jack_buffsize (int bsize);
-    void jack_freewheel (int state);
-    void jack_latency (jack_latency_callback_mode_t jlcm);
-    int  jack_process (int nframes);
-
-
-    jack_client_t  *_client;
+    Jackrx         *_jackrx;
+    Rxstream       *_master;
+    int             _index;
     jack_port_t    *_ports [Netdata::MAXCHAN];
-    const char     *_jname;
     int             _nchan;
     int             _state;
-    bool            _freew;
     int             _count;
     int             _fsamp;
     int             _bsize;
-    int             _rprio;
-    float          *_buff;
     Lfq_audio      *_audioq;
     Lfq_int32      *_commq; 
     Lfq_timedata   *_timeq;
@@ -112,7 +114,60 @@ private:
     double          _z2;
     double          _z3;
     double          _rcorr;
-    VResampler      _resamp;
+    Mcresampler     _resamp;
+
+    double          _dprob;    // Dropout probability, zero for a fixed delay.
+    double          _dmax;     // Initial and maximum delay.
+    double          _dtarg;    // Target delay.
+    float          *_hist;
+    double          _htot;
+    double          _hmax;
+    float           _jitt [3];
+};
+
+
+class Jackrx
+{
+public:
+
+    Jackrx (const char  *jname, const char *jserv, int nchan, const int *clist, int nstream);
+    virtual ~Jackrx (void);
+    
+    enum { MAXSTREAM = 8 };
+
+    Rxstream *stream (int i) const { return _streams [i]; }
+    const char *jname (void) const { return _jname; }
+    int fsamp (void) const { return _fsamp; }
+    int bsize (void) const { return _bsize; }
+    int rprio (void) const { return _rprio; }
+
+private:
+
+    friend class Rxstream;
+
+    void init (const char *jname, const char *jserv, const int *clist);
+    void fini (void);
+
+    virtual void thr_main (void) {}
+
+    void jack_shutdown (void);
+    void jack_buffsize (int bsize);
+    void jack_freewheel (int state);
+    void jack_latency (jack_latency_callback_mode_t jlcm);
+    int  jack_process (int nframes);
+
+
+    jack_client_t  *_client;
+    Rxstream       *_streams [MAXSTREAM];
+    const char     *_jname;
+    int             _nchan;
+    int             _nstream;
+    bool            _active;
+    bool            _freew;
+    int             _fsamp;
+    int             _bsize;
+    int             _rprio;
+    float          *_buff;
 
     static void jack_static_shutdown (void *arg);
     static int  jack_static_buffsize (jack_nframes_t nframes, void *arg);
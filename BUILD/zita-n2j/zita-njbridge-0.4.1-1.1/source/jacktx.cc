@@ -130,7 +130,8 @@ void Jacktx::start (Lfq_packdata   *packq,
                     Lfq_int32      *infoq, 
 		    Nettx          *nettx,
 		    int             sform,
-                    int             npack)
+                    int             npack,
+		    bool            gso)
 {
     _packq = packq;
     _timeq = timeq;
@@ -138,6 +139,7 @@ void Jacktx::start (Lfq_packdata   *packq,
     _nettx = nettx;
     _sform = sform;
     _npack = npack;
+    _gso = gso;
     _count = 0;
     _first = true;
     _tnext = 0;
@@ -168,7 +170,7 @@ void Jacktx::jack_buffsize (int bsize)
 int Jacktx::jack_process (int nframes)
 {
     int             i, j, bdiff, bstep;
-    int             dtime, nskip, flags, nfram;
+    int             dtime, nskip, flags, nfram, nsent;
     jack_time_t     t0, t1;
     jack_nframes_t  ft;
     float           usecs;
@@ -267,17 +269,25 @@ int Jacktx::jack_process (int nframes)
 
     // Bresenham algo to divide period in packets.
     // The first packet of a period has valid time.
+    // With GSO all packets but the last one have the
+    // same size, so a period needs fewer messages.
     bdiff = 0;
     bstep = _bsize / _npack;
+    if (_gso) bstep = (_bsize + _npack - 1) / _npack;
+    nsent = 0;
     flags = Netdata::FL_TIMED;
     for (j = 0; j < _npack; j++)
     {
 	if (_packq->wr_avail () > 0)
 	{
-	    // Create and send an audio data packet.
+	    // Create and queue an audio data packet.
 	    D = _packq->wr_datap ();
 	    nfram = bstep;
-    	    if (bdiff < 0) nfram++; // Bresenham algo.
+	    if (_gso)
+	    {
+		if (nfram > _bsize - nsent) nfram = _bsize - nsent;
+	    }
+    	    else if (bdiff < 0) nfram++; // Bresenham algo.
 	    D->init_audio_data (flags, _sform, _nchan, _count, nfram, dtime);
 	    for (i = 0; i < _nchan; i++)
   	    { 
@@ -285,8 +295,8 @@ int Jacktx::jack_process (int nframes)
 		inp [i] += nfram;
 	    }
 	    _packq->wr_commit ();
-	    _nettx->trigger ();
 	    _count += nfram;
+	    nsent += nfram;
 	    // Only used in first packet of each period.
 	    dtime = 0;
 	    flags = 0;
@@ -301,6 +311,8 @@ int Jacktx::jack_process (int nframes)
 	// Update Bresenham algo.
 	bdiff += nfram * _npack - _bsize;
     }
+    // Send the whole period at once.
+    _nettx->trigger ();
 
     return 0; 
 }
@@ -43,7 +43,8 @@ public:
                 Lfq_int32    *infoq,
 		Nettx        *nettx,
 		int           sform,
-		int           npack);
+		int           npack,
+		bool          gso);
 
     const char *jname (void) const { return _jname; }
     int fsamp (void) const { return _fsamp; }
@@ -75,6 +76,7 @@ private:
     int             _freew;
     int             _sform;
     int             _npack;
+    bool            _gso;
     int             _count;
     int             _tscnt;
     bool            _first;
@@ -36,6 +36,7 @@ public:
     double   _tjack;  // Jack time modulo 2^28 microseconds
     uint32_t _tsecs;  // Seconds of NTP time
     uint32_t _tfrac;  // Fraction of NTP time
+    float    _tlate;  // Arrival time minus DLL time, seconds
 };
 
 
@@ -48,6 +49,8 @@ public:
     double   _ratio;
     int      _nfram;
     int      _syncc;
+    float    _delay;     // Target delay, ms
+    float    _jitt [3];  // Arrival jitter percentiles, ms
 };
 
 
@@ -116,7 +119,7 @@ private:
 
 
 // Queue of Packdata objects, from jack TX thread to network TX.
-// Single element read/write.
+// Single element write, single or multiple element read.
 // Nelm will be rounded up to a power of 2.
 //
 class Lfq_packdata
@@ -135,7 +138,9 @@ public:
 
     int       rd_avail (void) const { return _nwr - _nrd; } 
     Netdata  *rd_datap (void) { return _data [_nrd & _mask]; }
+    Netdata  *rd_datap (int k) { return _data [(_nrd + k) & _mask]; }
     void      rd_commit (void) { _nrd++; }
+    void      rd_commit (int k) { _nrd += k; }
 
 private:
 
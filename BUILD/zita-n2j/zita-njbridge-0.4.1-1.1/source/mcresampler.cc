@@ -0,0 +1,420 @@
+// ----------------------------------------------------------------------------
+//
+//  Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ----------------------------------------------------------------------------
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "mcresampler.h"
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+#define MCRESAMPLER_AVX2
+#include <immintrin.h>
+#endif
+
+
+// Maximum phase change per output sample while
+// bringing the phase to zero in the dead band.
+#define STEER 1e-4
+
+
+static double sinc (double x)
+{
+    x = fabs (x);
+    if (x < 1e-6) return 1.0;
+    x *= M_PI;
+    return sin (x) / x;
+}
+
+
+static double wind (double x)
+{
+    x = fabs (x);
+    if (x >= 1.0) return 0.0;
+    x *= M_PI;
+    return 0.384 + 0.500 * cos (x) + 0.116 * cos (2 * x);
+}
+
+
+// Compute the coefficients for the current phase, and
+// apply them to a window of ntap interleaved frames.
+//
+static void filter_gen (const float *t, const float *d, float b, float *c,
+                        const float *w, float *y, int ntap, int nt, int nchan)
+{
+    int          i, j;
+    float        v;
+    const float  *x;
+
+    for (i = 0; i < nt; i++) c [i] = t [i] + b * d [i];
+    for (j = 0; j < nchan; j++) y [j] = 0;
+    for (i = 0; i < ntap; i++)
+    {
+	v = c [i];
+	x = w + i * nchan;
+	for (j = 0; j < nchan; j++) y [j] += v * x [j];
+    }
+}
+
+
+#ifdef MCRESAMPLER_AVX2
+
+// Blocks of 16 and 8 channels, then the remaining ones using
+// masked loads. Even and odd taps use separate accumulators.
+//
+__attribute__((target("avx2,fma")))
+static void filter_avx2 (const float *t, const float *d, float b, float *c,
+                         const float *w, float *y, int ntap, int nt, int nchan)
+{
+    int          i, j, s;
+    __m256       vb, c0, c1, a0, a1, a2, a3;
+    __m256i      m;
+    const float  *x;
+
+    vb = _mm256_set1_ps (b);
+    for (i = 0; i < nt; i += 8)
+    {
+	_mm256_storeu_ps (c + i, _mm256_fmadd_ps (vb, _mm256_loadu_ps (d + i), _mm256_loadu_ps (t + i)));
+    }
+
+    s = 2 * nchan;
+    for (j = 0; j + 16 <= nchan; j += 16)
+    {
+	a0 = a1 = a2 = a3 = _mm256_setzero_ps ();
+	x = w + j;
+	for (i = 0; i < ntap; i += 2, x += s)
+	{
+	    c0 = _mm256_broadcast_ss (c + i);
+	    c1 = _mm256_broadcast_ss (c + i + 1);
+	    a0 = _mm256_fmadd_ps (c0, _mm256_loadu_ps (x), a0);
+	    a1 = _mm256_fmadd_ps (c0, _mm256_loadu_ps (x + 8), a1);
+	    a2 = _mm256_fmadd_ps (c1, _mm256_loadu_ps (x + nchan), a2);
+	    a3 = _mm256_fmadd_ps (c1, _mm256_loadu_ps (x + nchan + 8), a3);
+	}
+	_mm256_storeu_ps (y + j, _mm256_add_ps (a0, a2));
+	_mm256_storeu_ps (y + j + 8, _mm256_add_ps (a1, a3));
+    }
+    if (j + 8 <= nchan)
+    {
+	a0 = a1 = _mm256_setzero_ps ();
+	x = w + j;
+	for (i = 0; i < ntap; i += 2, x += s)
+	{
+	    a0 = _mm256_fmadd_ps (_mm256_broadcast_ss (c + i), _mm256_loadu_ps (x), a0);
+	    a1 = _mm256_fmadd_ps (_mm256_broadcast_ss (c + i + 1), _mm256_loadu_ps (x + nchan), a1);
+	}
+	_mm256_storeu_ps (y + j, _mm256_add_ps (a0, a1));
+	j += 8;
+    }
+    if (j < nchan)
+    {
+	m = _mm256_cmpgt_epi32 (_mm256_set1_epi32 (nchan - j), _mm256_setr_epi32 (0, 1, 2, 3, 4, 5, 6, 7));
+	a0 = a1 = _mm256_setzero_ps ();
+	x = w + j;
+	for (i = 0; i < ntap; i += 2, x += s)
+	{
+	    a0 = _mm256_fmadd_ps (_mm256_broadcast_ss (c + i), _mm256_maskload_ps (x, m), a0);
+	    a1 = _mm256_fmadd_ps (_mm256_broadcast_ss (c + i + 1), _mm256_maskload_ps (x + nchan, m), a1);
+	}
+	_mm256_maskstore_ps (y + j, m, _mm256_add_ps (a0, a1));
+    }
+}
+
+#endif
+
+
+Mcresampler::Mcresampler (void) :
+    _ratio (1.0),
+    _nchan (0),
+    _hl (0),
+    _nt (0),
+    _nbuff (0),
+    _qstep (1.0),
+    _wstep (1.0),
+    _wlpf (1.0),
+    _dband (0.0),
+    _simd (SIMD_NONE),
+    _table (0),
+    _tdiff (0),
+    _coeff (0),
+    _buff (0)
+{
+    set_simd (SIMD_AVX2);
+    reset ();
+}
+
+
+Mcresampler::~Mcresampler (void)
+{
+    clear ();
+}
+
+
+void Mcresampler::set_simd (int simd)
+{
+    _simd = SIMD_NONE;
+#ifdef MCRESAMPLER_AVX2
+    __builtin_cpu_init ();
+    if (   (simd == SIMD_AVX2)
+        && __builtin_cpu_supports ("avx2")
+        && __builtin_cpu_supports ("fma")) _simd = SIMD_AVX2;
+#endif
+}
+
+
+int Mcresampler::setup (double ratio, unsigned int nchan, unsigned int hlen)
+{
+    return setup (ratio, nchan, hlen, 1.0 - 2.6 / hlen);
+}
+
+
+int Mcresampler::setup (double ratio, unsigned int nchan, unsigned int hlen, double frel)
+{
+    unsigned int  i, j, n;
+    double        fr, x, s, *v;
+    float         *p;
+
+    clear ();
+    if (! nchan || (hlen < 8) || (hlen > 96) || (16 * ratio < 1) || (ratio > 64)) return 1;
+
+    // For downsampling the cutoff and the filter length
+    // scale with the ratio, in input samples.
+    fr = frel;
+    _hl = hlen;
+    if (ratio < 1.0)
+    {
+	fr *= ratio;
+	_hl = (unsigned int)(ceil (hlen / ratio));
+    }
+    _ratio = ratio;
+    _nchan = nchan;
+    _nt = (2 * _hl + 7) & ~7;
+    _nbuff = 2 * _hl + NBUFF;
+
+    // Coefficients for NPHASE + 1 phases, the last one is used to
+    // interpolate up to the next input sample. The output sample
+    // for phase f is at position _hl - 1 + f in the window. Each
+    // phase is normalised for unity gain at DC.
+    n = (NPHASE + 1) * _nt;
+    _table = new float [n];
+    _tdiff = new float [n];
+    _coeff = new float [_nt];
+    _buff = new float [_nbuff * _nchan];
+    memset (_table, 0, n * sizeof (float));
+    memset (_tdiff, 0, n * sizeof (float));
+    v = new double [2 * _hl];
+    for (j = 0; j <= NPHASE; j++)
+    {
+	s = 0;
+	for (i = 0; i < 2 * _hl; i++)
+	{
+	    x = i + 1.0 - _hl - (double) j / NPHASE;
+	    v [i] = fr * sinc (fr * x) * wind (x / _hl);
+	    s += v [i];
+	}
+	p = _table + j * _nt;
+	for (i = 0; i < 2 * _hl; i++) p [i] = v [i] / s;
+    }
+    delete[] v;
+    for (j = 0; j < NPHASE; j++)
+    {
+	p = _table + j * _nt;
+	for (i = 0; i < _nt; i++) _tdiff [j * _nt + i] = p [_nt + i] - p [i];
+    }
+
+    _qstep = _wstep = 1.0 / ratio;
+    _wlpf = 1.0;
+    reset ();
+    return 0;
+}
+
+
+void Mcresampler::clear (void)
+{
+    delete[] _table;
+    delete[] _tdiff;
+    delete[] _coeff;
+    delete[] _buff;
+    _table = 0;
+    _tdiff = 0;
+    _coeff = 0;
+    _buff = 0;
+    _ratio = 1.0;
+    _nchan = 0;
+    _hl = 0;
+    _nt = 0;
+    _nbuff = 0;
+    reset ();
+}
+
+
+int Mcresampler::reset (void)
+{
+    inp_count = 0;
+    out_count = 0;
+    inp_data = 0;
+    out_data = 0;
+    _index = 0;
+    _nread = 2 * _hl;
+    _phase = 0.0;
+    _qstep = _wstep = 1.0 / _ratio;
+    _dhold = 0;
+    _bypass = false;
+    if (_buff) memset (_buff, 0, _nbuff * _nchan * sizeof (float));
+    return _table ? 0 : 1;
+}
+
+
+double Mcresampler::inpdist (void) const
+{
+    return (int)(_hl + 1) - (int) _nread - _phase;
+}
+
+
+void Mcresampler::set_rratio (double r)
+{
+    if (r > 16.0) r = 16.0;
+    if (r < 0.95) r = 0.95;
+    _qstep = 1.0 / (_ratio * r);
+}
+
+
+void Mcresampler::set_rrfilt (double t)
+{
+    _wlpf = (t < 1) ? 1 : 1 - exp (-1 / t);
+}
+
+
+// Return the input step for the next output sample.
+//
+double Mcresampler::next_step (void)
+{
+    _wstep += _wlpf * (_qstep - _wstep);
+    if ((_dband <= 0) || (_ratio != 1.0)) return _wstep;
+
+    if (fabs (_qstep - 1.0) >= _dband)
+    {
+	_dhold = 0;
+	_bypass = false;
+	return _wstep;
+    }
+    if (_bypass) return 1.0;
+    if (_dhold < HOLD)
+    {
+	_dhold++;
+	return _wstep;
+    }
+
+    // Bring the phase to zero, then bypass the filter.
+    if (_phase == 0.0)
+    {
+	_bypass = true;
+	return 1.0;
+    }
+    if (_phase < 0.5)
+    {
+	if (_phase > STEER) return 1.0 - STEER;
+	_phase = 0.0;
+	return 1.0;
+    }
+    if (1.0 - _phase > STEER) return 1.0 + STEER;
+    _phase = 0.0;
+    return 2.0;
+}
+
+
+void Mcresampler::filter (float *out)
+{
+    int           j;
+    float         b;
+    double        p;
+    const float  *w;
+
+    p = _phase * NPHASE;
+    j = (int) p;
+    b = (float)(p - j);
+    w = _buff + _index * _nchan;
+#ifdef MCRESAMPLER_AVX2
+    if (_simd == SIMD_AVX2)
+    {
+	filter_avx2 (_table + j * _nt, _tdiff + j * _nt, b, _coeff, w, out, 2 * _hl, _nt, _nchan);
+	return;
+    }
+#endif
+    filter_gen (_table + j * _nt, _tdiff + j * _nt, b, _coeff, w, out, 2 * _hl, _nt, _nchan);
+}
+
+
+int Mcresampler::process (void)
+{
+    unsigned int  k, n, nc;
+    double        step;
+    float         *p;
+
+    if (! _table) return 1;
+    nc = _nchan;
+    while (out_count)
+    {
+	if (_nread)
+	{
+	    // Read input frames into the window.
+	    // Null input data means silence.
+	    if (! inp_count) break;
+	    n = (_nread < inp_count) ? _nread : inp_count;
+	    p = _buff + (_index + 2 * _hl - _nread) * nc;
+	    if (inp_data)
+	    {
+		memcpy (p, inp_data, n * nc * sizeof (float));
+		inp_data += n * nc;
+	    }
+	    else memset (p, 0, n * nc * sizeof (float));
+	    inp_count -= n;
+	    _nread -= n;
+	}
+	else
+	{
+	    // Compute one output frame, unless the
+	    // output data is a null pointer.
+	    if (out_data)
+	    {
+		if (_bypass) memcpy (out_data, _buff + (_index + _hl - 1) * nc, nc * sizeof (float));
+		else filter (out_data);
+		out_data += nc;
+	    }
+	    out_count--;
+
+	    // Advance the window.
+	    step = next_step ();
+	    _phase += step;
+	    k = (unsigned int) _phase;
+	    _phase -= k;
+	    if (k)
+	    {
+		if (_index + k + 2 * _hl > _nbuff)
+		{
+		    memmove (_buff, _buff + (_index + k) * nc, (2 * _hl - k) * nc * sizeof (float));
+		    _index = 0;
+		}
+		else _index += k;
+		_nread = k;
+	    }
+	}
+    }
+    return 0;
+}
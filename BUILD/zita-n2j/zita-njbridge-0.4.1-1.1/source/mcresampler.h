@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+//
+//  Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ----------------------------------------------------------------------------
+
+
+#ifndef __MCRESAMPLER_H
+#define __MCRESAMPLER_H
+
+
+// Variable ratio multichannel resampler, used by Jackrx.
+//
+// The interface is the same as zita-resampler's VResampler, and
+// so is the filter: a windowed sinc of 2 * hlen taps, tabulated
+// for 256 phases and interpolated linearly between them.
+//
+// Audio is interleaved, and each tap is applied to all channels
+// at once. The coefficients for an output sample are computed
+// once and then used for all channels. On x86 AVX2/FMA code is
+// used if the CPU supports it.
+//
+// If the nominal ratio is exactly 1 and the requested ratio stays
+// within the dead band set by set_dband(), the filter phase is
+// brought to zero and input samples are just copied, until the
+// ratio leaves the dead band again.
+//
+class Mcresampler
+{
+public:
+
+    Mcresampler (void);
+    ~Mcresampler (void);
+
+    enum { NPHASE = 256 };
+    enum { SIMD_NONE, SIMD_AVX2 };
+
+    int  setup (double ratio, unsigned int nchan, unsigned int hlen);
+    int  setup (double ratio, unsigned int nchan, unsigned int hlen, double frel);
+    void clear (void);
+    int  reset (void);
+    int  nchan (void) const { return _nchan; }
+    int  inpsize (void) const { return 2 * _hl; }
+    double inpdist (void) const;
+    int  process (void);
+
+    void set_rratio (double r);
+    void set_rrfilt (double t);
+    void set_dband (double d) { _dband = d; }
+    bool bypass (void) const { return _bypass; }
+    int  simd (void) const { return _simd; }
+    void set_simd (int simd);
+
+    unsigned int    inp_count;
+    unsigned int    out_count;
+    float          *inp_data;
+    float          *out_data;
+
+private:
+
+    enum { NBUFF = 256, HOLD = 16384 };
+
+    void filter (float *out);
+    double next_step (void);
+
+    double          _ratio;
+    unsigned int    _nchan;
+    unsigned int    _hl;       // Half filter length, in input samples.
+    unsigned int    _nt;       // Number of taps, 2 * _hl rounded up to 8.
+    unsigned int    _nbuff;    // Input buffer size in frames.
+    unsigned int    _index;    // First frame of the filter window.
+    unsigned int    _nread;    // Frames to be read before next output.
+    double          _phase;    // Output position in input samples, 0..1.
+    double          _qstep;    // Requested input samples per output.
+    double          _wstep;    // Current input samples per output.
+    double          _wlpf;     // Step filter coefficient.
+    double          _dband;
+    int             _dhold;
+    bool            _bypass;
+    int             _simd;
+    float          *_table;    // Coefficients for all phases.
+    float          *_tdiff;    // Difference with the next phase.
+    float          *_coeff;    // Coefficients for the current output.
+    float          *_buff;
+};
+
+
+#endif
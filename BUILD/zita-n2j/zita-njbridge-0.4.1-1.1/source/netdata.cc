@@ -43,17 +43,25 @@ Netdata::~Netdata (void)
 }
 
 
-int Netdata::packetsperperiod (int maxsize, int period, int sform, int nchan)
+int Netdata::bytespersample (int sform)
 {
-    int b, n;
-
     switch (sform)
     {
-    case FM_16BIT: b = 2; break;          // Bytes per sample.
-    case FM_24BIT: b = 3; break;
-    case FM_FLOAT: b = 4; break;
-    default: return -1; 
+    case FM_16BIT: return 2;
+    case FM_24BIT: return 3;
+    case FM_FLOAT: return 4;
+    case FM_HALF:  return 2;
     }
+    return 0;
+}
+
+
+int Netdata::packetsperperiod (int maxsize, int period, int sform, int nchan)
+{
+    int b, n;
+
+    b = bytespersample (sform);
+    if (b == 0) return -1; 
     n = (maxsize - ADATA) / (b * nchan);  // Number of frames per packet.
     return (period + n - 1) / n;          // Number of packets per period.
 }
@@ -82,13 +90,7 @@ void Netdata::init_audio_data (int flags, int sform, int nchan,
 {
     int b;
 
-    switch (sform)
-    {
-    case FM_16BIT: b = 2; break;
-    case FM_24BIT: b = 3; break;
-    case FM_FLOAT: b = 4; break;
-    default: b = 0; 
-    }
+    b = bytespersample (sform);
     init_header (TY_ADATA, flags, sform, nchan);
     putint (COUNT, count);
     putint (NFRAM, nfram);
@@ -132,6 +134,61 @@ int Netdata::check_ptype (void) const
 #define R24 8388607
 
 
+// Conversion to and from IEEE 754 half precision. Values out
+// of range are clipped to the largest finite value, like the
+// integer formats, and rounding is to nearest even.
+//
+static inline uint16_t float_to_half (float f)
+{
+    union { float f; uint32_t u; } v;
+    uint32_t  s, m, h, r, k;
+    int       e;
+
+    v.f = f;
+    s = (v.u >> 16) & 0x8000;
+    e = (int)((v.u >> 23) & 0xFF) - 112;
+    m = v.u & 0x007FFFFF;
+    if (e == 143) return s | (m ? 0x7E00 : 0x7BFF);  // NaN or infinity.
+    if (e >= 31) return s | 0x7BFF;
+    if (e <= 0)
+    {
+	// Denormal or zero.
+	if (e < -10) return s;
+	k = 14 - e;
+	m |= 0x00800000;
+	h = m >> k;
+	r = m & ((1 << k) - 1);
+	if ((r > (1U << (k - 1))) || ((r == (1U << (k - 1))) && (h & 1))) h++;
+	return s | h;
+    }
+    h = (e << 10) | (m >> 13);
+    r = m & 0x1FFF;
+    if ((r > 0x1000) || ((r == 0x1000) && (h & 1))) h++;
+    if (h > 0x7BFF) h = 0x7BFF;
+    return s | h;
+}
+
+
+static inline float half_to_float (uint16_t h)
+{
+    union { float f; uint32_t u; } v;
+    uint32_t  s, e, m;
+
+    s = (h & 0x8000) << 16;
+    e = (h >> 10) & 0x1F;
+    m = h & 0x03FF;
+    if (e == 0)
+    {
+	// Denormal or zero.
+	v.f = m * (1.0f / 16777216);
+	v.u |= s;
+    }
+    else if (e == 31) v.u = s | 0x7F800000 | (m << 13);
+    else v.u = s | ((e + 112) << 23) | (m << 13);
+    return v.f;
+}
+
+
 // Put audio samples from float array into network packet.
 //
 void Netdata::put_audio (int chan, int offs, int nsamp, const float *adata, int astep)
@@ -170,6 +227,17 @@ void Netdata::put_audio (int chan, int offs, int nsamp, const float *adata, int
 	}
 	break;
 
+    case FM_HALF:
+	q = _data + ADATA + 2 * (nch * offs + chan);
+	for (i = 0; i < nsamp; i++)
+	{
+	    v = float_to_half (adata [i * astep]);
+	    q [0] = v >> 8;
+	    q [1] = v;
+	    q += 2 * nch;
+	}
+	break;
+
 #if __BYTE_ORDER == __BIG_ENDIAN
     case FM_FLOAT:
 	float *f = (float *)(_data + ADATA);
@@ -231,6 +299,15 @@ void Netdata::get_audio (int chan, int offs, int nsamp, float *adata, int astep)
 	}
 	break;
 
+    case FM_HALF:
+	p = _data + ADATA + 2 * (nch * offs + chan);
+	for (i = 0; i < nsamp; i++)
+	{
+	    adata [i * astep] = half_to_float ((p [0] << 8) + p [1]);
+	    p += 2 * nch;
+	}
+	break;
+
 #if __BYTE_ORDER == __BIG_ENDIAN
     case FM_FLOAT:
 	float *f = (float *)(_data + ADATA);
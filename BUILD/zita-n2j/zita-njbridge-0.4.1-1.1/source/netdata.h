@@ -42,6 +42,7 @@ public:
         FM_16BIT,
         FM_24BIT,
         FM_FLOAT,
+        FM_HALF     // IEEE 754 binary16.
     };
     enum
     {
@@ -83,6 +84,7 @@ public:
     void put_audio (int chan, int offs, int nsamp, const float *adata, int astep);
     void get_audio (int chan, int offs, int nsamp, float *adata, int astep) const;
 
+    static int bytespersample (int sform);
     static int packetsperperiod (int maxsize, int period, int sform, int nchan);
 
 private:
@@ -22,6 +22,9 @@
 #include <string.h>
 #include <stdint.h>
 #include <math.h>
+#ifdef __linux__
+#include <netinet/udp.h>
+#endif
 #include <jack/jack.h>
 #include "zsockets.h"
 #include "timers.h"
@@ -47,8 +50,12 @@ int Netrx::start (Lfq_audio     *audioq,
 		  int            fsamp,
 		  int            fsize,
                   int            rtprio,
-		  int            sockfd)
+		  int            sockfd,
+		  bool           gro)
 {
+    int i;
+
+
     _audioq = audioq;
     _commq  = commq;
     _timeq  = timeq;
@@ -56,7 +63,17 @@ int Netrx::start (Lfq_audio     *audioq,
     _fsamp  = fsamp;
     _fsize  = fsize;
     _sockfd = sockfd;
+    _gro    = gro;
+#ifdef __linux__
+    _nbuff  = gro ? MAXBATCH_GRO : MAXBATCH;
+#else
+    _nbuff  = 1;
+#endif
     _packet = new Netdata (psmax);
+    for (i = 0; i < _nbuff; i++)
+    {
+	_buffers [i] = new Netdata (gro ? GROSIZE : psmax);
+    }
 
     // Compute DLL filter coefficients.
     _dt = (double) _fsize / fsamp;
@@ -72,123 +89,212 @@ int Netrx::start (Lfq_audio     *audioq,
 
 void Netrx::thr_main (void)
 {
-    int     rv, pt, fl, fc, dc;
-    double  tr, err;
+    int      i, k, n, len, seg;
+    double   tr;
+    Netdata  *D;
 
     _state = WAIT;
     while (_state < TERM)
     {
-        // Wait for packet, get timestamp.
-	rv = recv (_sockfd, _packet->data (), _packet->size (), 0);
+        // Wait for packets, get timestamp. Packets received
+        // together get the same time, but only the first one
+        // of each period is used for timing and the sender
+        // transmits a full period at once.
+	n = recv_batch ();
         tr = tjack (jack_get_time ());
 	
 	// Check socket status.
-	if (rv <= 0)
+	if (n <= 0)
 	{
 	    _state = FAIL;
 	    send (_state, 0, 0.0, 0, 0);
 	    break;
 	}
 
-	// Basic packet validity check.
-	pt = _packet->check_ptype ();
-	if (pt < 0) continue;
+	for (i = 0; (i < n) && (_state < TERM); i++)
+	{
+	    D = _buffers [i];
+	    seg = _seglen [i];
+	    if (D->_dlen <= 0) continue;
+	    if ((seg <= 0) || (seg >= D->_dlen)) proc_packet (D, tr);
+	    else
+	    {
+		// Split a GRO message into the original packets.
+		for (k = 0; (k < D->_dlen) && (_state < TERM); k += seg)
+		{
+		    len = D->_dlen - k;
+		    if (len > seg) len = seg;
+		    if (len > _packet->_size) len = _packet->_size;
+		    memcpy (_packet->_data, D->_data + k, len);
+		    _packet->_dlen = len;
+		    proc_packet (_packet, tr);
+		}
+	    }
+	}
+    }
+    
+    for (i = 0; i < _nbuff; i++) delete _buffers [i];
+    delete _packet;
+    _state = INIT;
+}
+
 
-	// Check for termination or suspend.
-        fl = _packet->get_flags ();
-	if (fl & Netdata::FL_TERM)
+// Receive one or more packets, waiting for at least one.
+// Returns the number of messages, and sets their sizes
+// and GRO segment sizes.
+//
+int Netrx::recv_batch (void)
+{
+#ifdef __linux__
+    int             i, n;
+    struct msghdr   *H;
+    struct cmsghdr  *C;
+
+    for (i = 0; i < _nbuff; i++)
+    {
+	H = &(_msgs [i].msg_hdr);
+	memset (H, 0, sizeof (struct msghdr));
+	_iovs [i].iov_base = _buffers [i]->_data;
+	_iovs [i].iov_len = _buffers [i]->_size;
+	H->msg_iov = _iovs + i;
+	H->msg_iovlen = 1;
+	if (_gro)
 	{
-	    _state = TERM;
-	    send (_state, 0, 0.0, 0, 0);
-	    break;
+	    H->msg_control = _ctrl [i];
+	    H->msg_controllen = sizeof (_ctrl [i]);
 	}
-	if (fl & Netdata::FL_SUSP)
+    }
+    n = recvmmsg (_sockfd, _msgs, _nbuff, MSG_WAITFORONE, 0);
+    for (i = 0; i < n; i++)
+    {
+	H = &(_msgs [i].msg_hdr);
+	_buffers [i]->_dlen = _msgs [i].msg_len;
+	_seglen [i] = 0;
+#ifdef UDP_GRO
+	for (C = CMSG_FIRSTHDR (H); C; C = CMSG_NXTHDR (H, C))
 	{
-	    _state = WAIT;
-	    send (_state, 0, 0.0, 0, 0);
-	    continue;
+	    if ((C->cmsg_level == SOL_UDP) && (C->cmsg_type == UDP_GRO))
+	    {
+		_seglen [i] = *(int *) CMSG_DATA (C);
+	    }
 	}
+#endif
+    }
+    return n;
+#else
+    int rv;
+
+    rv = recv (_sockfd, _buffers [0]->_data, _buffers [0]->_size, 0);
+    if (rv <= 0) return -1;
+    _buffers [0]->_dlen = rv;
+    _seglen [0] = 0;
+    return 1;
+#endif
+}
 
-	// // Get time marker if descriptor packet.
-	// if ((pt == Netdata::TY_ADESC) && (rv == Netdata::DPEND))
-	// {
-   	//     send (TNTP, _packet->get_tfcnt (), 0.0,
-	// 	  _packet->get_tsecs (), _packet->get_tfrac ());
-	// }
 
-	// Ignore packet if not sample data.
-	if (pt != Netdata::TY_ADATA) continue;
+void Netrx::proc_packet (Netdata *D, double tr)
+{
+    int     pt, fl, fc, dc;
+    double  err, ta;
 
-        // Check for commands from the Jack thread.
-        if (_commq->rd_avail ())
-	{
-	    _state = _commq->rd_int32 ();
-	    if (_state == PROC) _first = true;
-	}
+    // Basic packet validity check.
+    pt = D->check_ptype ();
+    if (pt < 0) return;
 
-	// Ignore data if not yet active.
-        if (_state != PROC) continue;
+    // Check for termination or suspend.
+    fl = D->get_flags ();
+    if (fl & Netdata::FL_TERM)
+    {
+	_state = TERM;
+	send (_state, 0, 0.0, 0, 0);
+	return;
+    }
+    if (fl & Netdata::FL_SUSP)
+    {
+	_state = WAIT;
+	send (_state, 0, 0.0, 0, 0);
+	return;
+    }
+
+    // // Get time marker if descriptor packet.
+    // if ((pt == Netdata::TY_ADESC) && (rv == Netdata::DPEND))
+    // {
+    //     send (TNTP, D->get_tfcnt (), 0.0,
+    // 	  D->get_tsecs (), D->get_tfrac ());
+    // }
+
+    // Ignore packet if not sample data.
+    if (pt != Netdata::TY_ADATA) return;
+
+    // Check for commands from the Jack thread.
+    if (_commq->rd_avail ())
+    {
+	_state = _commq->rd_int32 ();
+	if (_state == PROC) _first = true;
+    }
+
+    // Ignore data if not yet active.
+    if (_state != PROC) return;
 
-        // Apply timing correction from sender.
-        tr -= 1e-6 * _packet->get_dtime ();
+    // Apply timing correction from sender. The uncorrected
+    // time is when the data actually became available.
+    ta = tr;
+    tr -= 1e-6 * D->get_dtime ();
 
-	dc = 0;
-	fc = _packet->get_count ();
-	if (_first)
+    dc = 0;
+    fc = D->get_count ();
+    if (_first)
+    {
+	// First packet must be a timed one.
+	if (fl & Netdata::FL_TIMED)
 	{
-   	    // First packet must be a timed one.
-	    if (fl & Netdata::FL_TIMED)
-	    {
-   	        _first = false;
-		_audioq->wr_commit (fc);
-	        _t0 = tr;
-	    }
-	    else continue;
+	    _first = false;
+	    _audioq->wr_commit (fc);
+	    _t0 = tr;
 	}
-	else
+	else return;
+    }
+    else
+    {
+	// Check frame count continuity.
+	dc = fc - _audioq->nwr ();
+	if (dc > 0)
 	{
-	    // Check frame count continuity.
- 	    dc = fc - _audioq->nwr ();
-	    if (dc > 0)
-	    {
-		// Missing frames, replace by silence.
-	         write_zeros (dc);
-		 _t0 += (double) dc / _fsamp;
-	    }
-	    if (dc < 0)
-	    {
-		// Packet out of order, already
-		// replaced by silence so ignore.
-                continue;
-	    }
-	    if (fl & Netdata::FL_TIMED)
-	    {
-  	        // Update the DLL.
-                err = tjack_diff (tr, _t0);
-	        if (err >  _dt) err =  _dt;
-	        if (err < -_dt) err = -_dt;
-		_t0 += _w1 * err;
-	        _dt += _w2 * err;
-	    }
+	    // Missing frames, replace by silence.
+	     write_zeros (dc);
+	     _t0 += (double) dc / _fsamp;
+	}
+	if (dc < 0)
+	{
+	    // Packet out of order, already
+	    // replaced by silence so ignore.
+	    return;
 	}
-
 	if (fl & Netdata::FL_TIMED)
 	{
-	    // Send timing data to Jack thread and update DLL.
-	    send (_state, _audioq->nwr (), _t0, 0, 0);
-  	    _t0 = tjack_diff (_t0, -_dt);
+	    // Update the DLL.
+	    err = tjack_diff (tr, _t0);
+	    if (err >  _dt) err =  _dt;
+	    if (err < -_dt) err = -_dt;
+	    _t0 += _w1 * err;
+	    _dt += _w2 * err;
 	}
+    }
 
-	// Write samples to queue.
-	write_audio (_packet);
+    if (fl & Netdata::FL_TIMED)
+    {
+	// Send timing data to Jack thread and update DLL.
+	send (_state, _audioq->nwr (), _t0, 0, 0, tjack_diff (ta, _t0));
+	_t0 = tjack_diff (_t0, -_dt);
     }
-    
-    delete _packet;
-    _state = INIT;
+
+    // Write samples to queue.
+    write_audio (D);
 }
 
 
-void Netrx::send (int flags, int32_t count, double tjack, uint32_t tsecs, uint32_t tfrac)
+void Netrx::send (int flags, int32_t count, double tjack, uint32_t tsecs, uint32_t tfrac, float tlate)
 {
     Timedata *D;
 
@@ -200,6 +306,7 @@ void Netrx::send (int flags, int32_t count, double tjack, uint32_t tsecs, uint32
         D->_tjack = tjack;
 	D->_tsecs = tsecs;
 	D->_tfrac = tfrac;
+	D->_tlate = tlate;
         _timeq->wr_commit ();
     }
 }
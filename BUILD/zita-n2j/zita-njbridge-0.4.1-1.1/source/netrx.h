@@ -22,15 +22,21 @@
 #define __NETRX_H
 
 #include <stdint.h>
+#include <sys/socket.h>
 #include "pxthread.h"
 #include "lfqueue.h"
 
 
+// Packets are received in batches using recvmmsg(), on systems
+// that provide it. With UDP GRO the kernel may merge a number of
+// packets into a single message, these are split again here.
+//
 class Netrx : public Pxthread
 {
 public:
 
     enum { INIT, WAIT, PROC, TNTP, TERM, FAIL };
+    enum { MAXBATCH = 64, MAXBATCH_GRO = 8, GROSIZE = 65536 };
 
     Netrx (void);
     virtual ~Netrx (void);
@@ -43,13 +49,16 @@ public:
 	       int            fsamp,
 	       int            fsize,
                int            rtprio,
-	       int            sockfd);
+	       int            sockfd,
+	       bool           gro);
 
 private:
 
     virtual void thr_main (void);
 
-    void send (int flags, int32_t count, double tjack, uint32_t tsecs, uint32_t tfrac);
+    int  recv_batch (void);
+    void proc_packet (Netdata *D, double tr);
+    void send (int flags, int32_t count, double tjack, uint32_t tsecs, uint32_t tfrac, float tlate = 0);
     int write_audio (Netdata *D);
     int write_zeros (int nfram);
 
@@ -67,7 +76,16 @@ private:
     int            _fsamp;
     int            _fsize;
     int            _sockfd;
+    bool           _gro;
+    int            _nbuff;
     Netdata       *_packet;
+    Netdata       *_buffers [MAXBATCH];
+    int            _seglen [MAXBATCH];
+#ifdef __linux__
+    struct mmsghdr _msgs [MAXBATCH];
+    struct iovec   _iovs [MAXBATCH];
+    char           _ctrl [MAXBATCH][CMSG_SPACE (sizeof (int))];
+#endif
 };
 
 
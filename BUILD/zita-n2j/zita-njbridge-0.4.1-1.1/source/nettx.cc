@@ -19,12 +19,23 @@
 
 
 #include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#ifdef __linux__
+#include <netinet/udp.h>
+#endif
 #include "nettx.h"
 #include "zsockets.h"
 
 
+// Limits for a single GSO message, below the kernel ones.
+#define GSO_MAXSEG   64
+#define GSO_MAXSIZE  60000
+
+
 Nettx::Nettx (void) :
-    _stop (false)
+    _stop (false),
+    _gso (false)
 {
 }
 
@@ -38,12 +49,14 @@ void Nettx::start (Lfq_packdata   *packq,
 		   Lfq_timedata   *timeq,
 		   Netdata        *descpack,
  	           int             sockfd,
-		   int             rtprio)
+		   int             rtprio,
+		   bool            gso)
 {
     _packq = packq;
     _timeq = timeq;
     _descpack = descpack;
     _sockfd = sockfd;
+    _gso = gso;
     thr_start (SCHED_FIFO, rtprio, 0);
 }
 
@@ -56,7 +69,6 @@ void Nettx::trigger (void)
 
 void Nettx::thr_main (void)
 {
-    Netdata  *D;
     Timedata *M;
     
     while (true)
@@ -72,9 +84,7 @@ void Nettx::thr_main (void)
 	}
         if (_packq->rd_avail () > 0)
 	{
-	    D = _packq->rd_datap ();
-	    send (_sockfd, (char *) D->data (), D->dlen (), 0);
-	    _packq->rd_commit ();
+	    send_packets ();
 	}
 	else
 	{
@@ -88,3 +98,107 @@ void Nettx::thr_main (void)
 	}
     }
 }
+
+
+// Send all packets in the queue. The Jack thread triggers
+// once per period, so normally this sends a full period.
+//
+void Nettx::send_packets (void)
+{
+    int n;
+
+    while ((n = _packq->rd_avail ()) > 0)
+    {
+	if (n > MAXBATCH) n = MAXBATCH;
+	_packq->rd_commit (send_batch (n));
+    }
+}
+
+
+// Send the first npack packets in the queue, return the
+// number of packets that can be removed from it. Errors
+// are ignored, as for a single send().
+//
+int Nettx::send_batch (int npack)
+{
+#ifdef __linux__
+    int             i, j, k, m, n, size, rv;
+    Netdata         *D;
+    struct msghdr   *H;
+    struct cmsghdr  *C;
+
+    // Make one message per packet, or with GSO one per run of
+    // packets of the same size, possibly ending with a shorter
+    // one. Each packet then becomes one UDP datagram again.
+    for (i = m = 0; i < npack; m++)
+    {
+	size = _packq->rd_datap (i)->dlen ();
+	n = 1;
+	if (_gso)
+	{
+	    k = size;
+	    while ((i + n < npack) && (n < GSO_MAXSEG) && (k + size <= GSO_MAXSIZE))
+	    {
+		j = _packq->rd_datap (i + n)->dlen ();
+		if (j > size) break;
+		k += j;
+		n++;
+		if (j < size) break;
+	    }
+	}
+	for (j = i; j < i + n; j++)
+	{
+	    D = _packq->rd_datap (j);
+	    _iovs [j].iov_base = D->data ();
+	    _iovs [j].iov_len = D->dlen ();
+	}
+	H = &(_msgs [m].msg_hdr);
+	memset (H, 0, sizeof (struct msghdr));
+	H->msg_iov = _iovs + i;
+	H->msg_iovlen = n;
+	if (n > 1)
+	{
+	    H->msg_control = _ctrl [m];
+	    H->msg_controllen = sizeof (_ctrl [m]);
+	    C = CMSG_FIRSTHDR (H);
+	    C->cmsg_level = SOL_UDP;
+	    C->cmsg_type = UDP_SEGMENT;
+	    C->cmsg_len = CMSG_LEN (sizeof (uint16_t));
+	    *(uint16_t *) CMSG_DATA (C) = size;
+	}
+	_nseg [m] = n;
+	i += n;
+    }
+
+    for (i = j = 0; j < m; )
+    {
+	rv = sendmmsg (_sockfd, _msgs + j, m - j, 0);
+	if (rv > 0)
+	{
+	    while (rv--) i += _nseg [j++];
+	}
+	else
+	{
+	    if ((_nseg [j] > 1) && ((errno == EIO) || (errno == EINVAL) || (errno == ENOPROTOOPT)))
+	    {
+		// GSO not available on this path, the
+		// remaining packets are sent separately.
+		_gso = false;
+		return i;
+	    }
+	    i += _nseg [j++];
+	}
+    }
+    return i;
+#else
+    int      i;
+    Netdata  *D;
+
+    for (i = 0; i < npack; i++)
+    {
+	D = _packq->rd_datap (i);
+	send (_sockfd, (char *) D->data (), D->dlen (), 0);
+    }
+    return npack;
+#endif
+}
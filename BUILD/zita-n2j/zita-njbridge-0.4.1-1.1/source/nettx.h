@@ -23,16 +23,23 @@
 
 
 #include <sys/types.h>
+#include <sys/socket.h>
 #include <pthread.h>
 #include "pxthread.h"
 #include "lfqueue.h"
 #include "netdata.h"
 
 
+// Packets are sent in batches of up to MAXBATCH using sendmmsg(),
+// on systems that provide it. Optionally runs of packets of equal
+// size are sent as a single UDP GSO message.
+//
 class Nettx : public Pxthread
 {
 public:
 
+    enum { MAXBATCH = 64 };
+
     Nettx (void);
     virtual ~Nettx (void);
     
@@ -40,7 +47,8 @@ public:
 		Lfq_timedata *timeq, 
 		Netdata      *descpack,
 		int           sockfd,
-	        int           rtprio);
+	        int           rtprio,
+		bool          gso);
 
     void stop (void)
     {
@@ -54,12 +62,22 @@ private:
 
     virtual void thr_main (void);
 
+    void send_packets (void);
+    int  send_batch (int npack);
+
     Lfq_packdata    *_packq;
     Lfq_timedata    *_timeq; 
     Netdata         *_descpack;
     int              _sockfd;
     bool             _stop;
+    bool             _gso;
     Pxsema           _sema;
+#ifdef __linux__
+    struct mmsghdr   _msgs [MAXBATCH];
+    struct iovec     _iovs [MAXBATCH];
+    int              _nseg [MAXBATCH];
+    char             _ctrl [MAXBATCH][CMSG_SPACE (sizeof (uint16_t))];
+#endif
 };
 
 
@@ -0,0 +1,172 @@
+// ----------------------------------------------------------------------------
+//
+//  Copyright (C) 2026
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// ----------------------------------------------------------------------------
+
+
+// Measures the cost per channel of the zita-n2j resampler, for the
+// generic and SIMD code, and its accuracy for a sine wave compared
+// to an ideal resampler.
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "mcresampler.h"
+
+
+static double tnow (void)
+{
+    timespec t;
+
+    clock_gettime (CLOCK_MONOTONIC, &t);
+    return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+
+// Returns the time in ns per output frame per channel.
+//
+static double bench (int simd, double ratio, int nchan, int hlen)
+{
+    Mcresampler  R;
+    float        *inp, *out;
+    int          i, n, nout;
+    double       t0, t;
+
+    R.set_simd (simd);
+    if (R.setup (ratio, nchan, hlen)) return -1;
+    R.set_rrfilt (100);
+    nout = 256;
+    inp = new float [2 * nout * 4 * nchan];
+    out = new float [nout * nchan];
+    for (i = 0; i < 2 * nout * 4 * nchan; i++) inp [i] = (float)(drand48 () - 0.5);
+    n = 0;
+    t0 = tnow ();
+    do
+    {
+	for (i = 0; i < 100; i++)
+	{
+	    // Vary the ratio slightly as Jackrx does.
+	    R.set_rratio (1 + 1e-5 * sin (1e-3 * n));
+	    R.out_count = nout;
+	    R.out_data = out;
+	    while (R.out_count)
+	    {
+		R.inp_count = 4 * nout;
+		R.inp_data = inp;
+		R.process ();
+	    }
+	    n++;
+	}
+	t = tnow () - t0;
+    }
+    while (t < 0.5);
+    delete[] inp;
+    delete[] out;
+    return 1e9 * t / ((double) n * nout * nchan);
+}
+
+
+// Resamples a sine wave at frequency f (relative to the input rate)
+// and returns the error in dB relative to the exact output.
+//
+static double error (double ratio, int hlen, double f)
+{
+    Mcresampler  R;
+    float        *inp, *out;
+    int          i, ninp, nout, skip;
+    double       d, x, e, s;
+
+    if (R.setup (ratio, 1, hlen)) return 0;
+    ninp = 100000;
+    nout = (int)(ninp * ratio) - 4 * R.inpsize ();
+    inp = new float [ninp];
+    out = new float [nout];
+    for (i = 0; i < ninp; i++) inp [i] = (float)(0.5 * sin (2 * M_PI * f * i));
+    R.inp_count = R.inpsize () / 2 - 1;
+    R.inp_data = 0;
+    R.out_count = 1000;
+    R.out_data = 0;
+    R.process ();
+    R.inp_count = ninp;
+    R.inp_data = inp;
+    R.out_count = nout;
+    R.out_data = out;
+    R.process ();
+    // Output sample k corresponds to input position k / ratio.
+    skip = (int)(2 * R.inpsize () * ratio);
+    e = s = 0;
+    for (i = skip; i < nout; i++)
+    {
+	x = 0.5 * sin (2 * M_PI * f * (i / ratio));
+	d = out [i] - x;
+	e += d * d;
+	s += x * x;
+    }
+    delete[] inp;
+    delete[] out;
+    return 10 * log10 (e / s + 1e-30);
+}
+
+
+int main (int ac, char *av [])
+{
+    static const int   chans [] = { 1, 2, 8, 13, 32, 64 };
+    static const int   hlens [] = { 16, 32, 48, 96 };
+    static const double ratios [] = { 1.0, 48e3 / 44.1e3, 44.1e3 / 48e3 };
+    Mcresampler  R;
+    unsigned int i, j, k;
+    double       a, b;
+
+    R.set_simd (Mcresampler::SIMD_AVX2);
+    printf ("SIMD code %savailable.\n\n", R.simd () ? "" : "not ");
+    printf ("Time per output frame per channel (ns), generic / SIMD.\n\n");
+    for (k = 0; k < sizeof (ratios) / sizeof (double); k++)
+    {
+	printf ("ratio %8.6lf\n", ratios [k]);
+	printf ("filt ");
+	for (j = 0; j < sizeof (chans) / sizeof (int); j++) printf ("   %3d chan     ", chans [j]);
+	printf ("\n");
+	for (i = 0; i < sizeof (hlens) / sizeof (int); i++)
+	{
+	    printf ("%3d  ", hlens [i]);
+	    for (j = 0; j < sizeof (chans) / sizeof (int); j++)
+	    {
+		a = bench (Mcresampler::SIMD_NONE, ratios [k], chans [j], hlens [i]);
+		b = bench (Mcresampler::SIMD_AVX2, ratios [k], chans [j], hlens [i]);
+		printf (" %6.2lf /%6.2lf ", a, b);
+	    }
+	    printf ("\n");
+	}
+	printf ("\n");
+    }
+
+    printf ("Error (dB) for a sine wave at 1 kHz, 10 kHz, 20 kHz (48 kHz input).\n\n");
+    for (k = 0; k < sizeof (ratios) / sizeof (double); k++)
+    {
+	for (i = 0; i < sizeof (hlens) / sizeof (int); i++)
+	{
+	    printf ("ratio %8.6lf  filt %3d  %7.1lf %7.1lf %7.1lf\n", ratios [k], hlens [i],
+		    error (ratios [k], hlens [i], 1e3 / 48e3),
+		    error (ratios [k], hlens [i], 1e4 / 48e3),
+		    error (ratios [k], hlens [i], 2e4 / 48e3));
+	}
+    }
+    return 0;
+}
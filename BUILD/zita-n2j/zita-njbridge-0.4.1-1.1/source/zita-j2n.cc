@@ -51,6 +51,7 @@ static const char   *dev_arg   = 0;
 static int           mtu_arg   = 1500;
 static int           hops_arg  = 1;
 static int           form_arg  = Netdata::FM_24BIT;
+static bool          gso_opt   = false;
 
 
 static void help (void)
@@ -68,13 +69,15 @@ static void help (void)
     fprintf (stderr, "  --16bit             Send 16-bit samples\n");
     fprintf (stderr, "  --24bit             Send 24-bit samples (default)\n");
     fprintf (stderr, "  --float             Send floating point samples\n");
+    fprintf (stderr, "  --float16           Send half precision floating point samples\n");
     fprintf (stderr, "  --mtu   <size>      Maximum packet size [%d]\n", mtu_arg);
     fprintf (stderr, "  --hops  <hops>      Number of hops for multicast [%d]\n", hops_arg);
+    fprintf (stderr, "  --gso               Use UDP segmentation offload\n");
     exit (1);
 }
 
 
-enum { HELP, NAME, SERV, CHAN, BIT16, BIT24, FLT32, MTU, HOPS };
+enum { HELP, NAME, SERV, CHAN, BIT16, BIT24, FLT32, FLT16, MTU, HOPS, GSO };
 
 
 static struct option options [] = 
@@ -88,6 +91,8 @@ static struct option options [] =
     { "16bit", 0, 0, BIT16 },
     { "24bit", 0, 0, BIT24 },
     { "float", 0, 0, FLT32 },
+    { "float16", 0, 0, FLT16 },
+    { "gso",   0, 0, GSO   },
     { 0, 0, 0, 0 }
 };
 
@@ -141,6 +146,12 @@ static void procoptions (int ac, char *av [])
         case FLT32:
 	    form_arg = Netdata::FM_FLOAT;
 	    break;
+        case FLT16:
+	    form_arg = Netdata::FM_HALF;
+	    break;
+	case GSO:
+	    gso_opt = true;
+	    break;
  	}
     }
     if (ac < optind + 2) help ();
@@ -240,6 +251,11 @@ int main (int ac, char *av [])
     usleep (100000);
 
     sockfd = opensocket (&A);
+    if (gso_opt && sock_set_udp_segment (sockfd, 0))
+    {
+	fprintf (stderr, "Warning: UDP segmentation offload not available.\n");
+	gso_opt = false;
+    }
     psize = mtu_arg - ((A.family () == AF_INET6) ? 48 : 28);
     ppper = Netdata::packetsperperiod (psize, jacktx->bsize (), form_arg, chan_arg);
     npack = ppper * (int)(ceil (0.05 * jacktx->fsamp () / jacktx->bsize ()));
@@ -248,8 +264,8 @@ int main (int ac, char *av [])
     infoq = new Lfq_int32 (16);
 
     descpack.init_audio_desc (0, form_arg, chan_arg, psize, jacktx->fsamp (), jacktx->bsize ());
-    nettx->start (packq, timeq, &descpack, sockfd, jacktx->rtprio () + 5);
-    jacktx->start (packq, timeq, infoq, nettx, form_arg, ppper);
+    nettx->start (packq, timeq, &descpack, sockfd, jacktx->rtprio () + 5, gso_opt);
+    jacktx->start (packq, timeq, infoq, nettx, form_arg, ppper, gso_opt);
 
     signal (SIGINT, siginthandler);
     while (! stop)
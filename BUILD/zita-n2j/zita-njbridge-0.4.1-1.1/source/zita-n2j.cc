@@ -24,6 +24,7 @@
 #include <ctype.h>
 #include <signal.h>
 #include <getopt.h>
+#include <poll.h>
 #include <sys/mman.h>
 #include "lfqueue.h"
 #include "netdata.h"
@@ -36,23 +37,45 @@
 #define APPNAME "zita-n2j"
 
 
-static Lfq_audio      *audioq = 0;
-static Lfq_int32      *commq = 0;
-static Lfq_timedata   *timeq = 0;
-static Lfq_timedata   *syncq = 0;
-static Lfq_infodata   *infoq = 0;
+// Main thread state for each received stream.
+//
+struct Stream
+{
+    Sockaddr        Arx;
+    Sockaddr        Asy;
+    const char     *dev;
+    int             port;
+    int             sockfd1;
+    int             sockfd2;
+    bool            active;
+    char            pref [16];
+    Lfq_audio      *audioq;
+    Lfq_int32      *commq;
+    Lfq_timedata   *timeq;
+    Lfq_timedata   *syncq;
+    Lfq_infodata   *infoq;
+    Netrx          *netrx;
+    Rxstream       *rxstream;
+};
+
+
+static Stream         streams [Jackrx::MAXSTREAM];
+static int            nstream = 0;
 static bool stop = false;
 
 static const char   *name_arg  = APPNAME;
 static const char   *serv_arg  = 0;
 static const char   *chan_arg  = "1,2";
-static const char   *addr_arg  = 0;
-static int           port_arg  = 0;
-static const char   *dev_arg   = 0;
+static char        **addr_args = 0;
+static int           addr_narg = 0;
 static int           buff_arg  = 10;
 static int           sync_arg  = 0;
 static int           filt_arg  = 0;
+static int           dband_arg = 2;
+static double        adapt_arg = 0;
 static bool          info_opt  = false;
+static bool          gro_opt   = false;
+static bool          lock_opt  = false;
 
 
 static void help (void)
@@ -62,20 +85,25 @@ static void help (void)
     fprintf (stderr, "Receive audio from zita-j2n.\n\n");
     fprintf (stderr, "Usage: %s <options> ip-address ip-port \n", APPNAME);
     fprintf (stderr, "       %s <options> ip-address ip-port interface\n", APPNAME);
+    fprintf (stderr, "       %s <options> stream stream ...\n", APPNAME);
     fprintf (stderr, "Options:\n");
     fprintf (stderr, "  --help              Display this text\n");
     fprintf (stderr, "  --jname <name>      Jack client name [%s]\n", APPNAME);
     fprintf (stderr, "  --jserv <name>      Jack server name\n");
     fprintf (stderr, "  --chan  <list>      List of channels [%s]\n", chan_arg);
     fprintf (stderr, "  --buff  <time>      Additional buffering (ms) [%d]\n", buff_arg);
+    fprintf (stderr, "  --adapt <prob>      Adaptive buffering, dropout probability\n");
 //    fprintf (stderr, "  --sync  <time>      Sync delay (ms) [%d]\n", sync_arg);
     fprintf (stderr, "  --filt  <delay>     Resampler filter delay [16..96]\n");
+    fprintf (stderr, "  --dband <ppm>       Resampler bypass dead band [%d]\n", dband_arg);
+    fprintf (stderr, "  --gro               Use UDP receive offload\n");
+    fprintf (stderr, "  --lock              Streams have a common clock\n");
     fprintf (stderr, "  --info              Print additional info\n");
     exit (1);
 }
 
 
-enum { HELP, NAME, SERV, CHAN, BUFF, SYNC, FILT, INFO };
+enum { HELP, NAME, SERV, CHAN, BUFF, ADAPT, SYNC, FILT, DBAND, INFO, GRO, LOCK };
 
 
 static struct option options [] = 
@@ -85,9 +113,13 @@ static struct option options [] =
     { "jserv", 1, 0, SERV  },
     { "chan",  1, 0, CHAN  },
     { "buff",  1, 0, BUFF  },
+    { "adapt", 1, 0, ADAPT },
     { "sync",  1, 0, SYNC  },
     { "filt",  1, 0, FILT  },
+    { "dband", 1, 0, DBAND },
     { "info",  0, 0, INFO  },
+    { "gro",   0, 0, GRO   },
+    { "lock",  0, 0, LOCK  },
     { 0, 0, 0, 0 }
 };
 
@@ -105,6 +137,19 @@ static int getint (const char *optname)
 }
 
 
+static double getdbl (const char *optname)
+{
+    double v;
+
+    if (sscanf (optarg, "%lf", &v) != 1)
+    {
+	fprintf (stderr, "Bad option argument: --%s %s\n", optname, optarg);
+	exit (1);
+    }
+    return v;
+}
+
+
 static void procoptions (int ac, char *av [])
 {
     int k;
@@ -129,22 +174,89 @@ static void procoptions (int ac, char *av [])
 	case BUFF:
 	    buff_arg = getint ("buff");
 	    break;
+	case ADAPT:
+	    adapt_arg = getdbl ("adapt");
+	    break;
 //	case SYNC:
 //	    sync_arg = getint ("sync");
 //	    break;
 	case FILT:
 	    filt_arg = getint ("filt");
 	    break;
+	case DBAND:
+	    dband_arg = getint ("dband");
+	    break;
 	case INFO:
 	    info_opt = true;
 	    break;
+	case GRO:
+	    gro_opt = true;
+	    break;
+	case LOCK:
+	    lock_opt = true;
+	    break;
  	}
     }
     if (ac < optind + 2) help ();
-    if (ac > optind + 3) help ();
-    addr_arg = av [optind++];
-    port_arg = atoi (av [optind++]);
-    if (ac == optind + 1) dev_arg = av [optind];
+    addr_args = av + optind;
+    addr_narg = ac - optind;
+}
+
+
+static void readstreams (void)
+{
+    // Each stream is given by an address and port, followed
+    // by the network interface if the address is multicast.
+
+    int     i;
+    Stream  *S;
+
+    i = 0;
+    while (i < addr_narg)
+    {
+	if (nstream == Jackrx::MAXSTREAM)
+	{
+	    fprintf (stderr, "Too many streams, the maximum is %d.\n", Jackrx::MAXSTREAM);
+	    exit (1);
+	}
+	if (addr_narg < i + 2) help ();
+	S = streams + nstream;
+	if (   S->Arx.set_addr (AF_INET, SOCK_DGRAM, 0, addr_args [i])
+	    || S->Asy.set_addr (AF_INET, SOCK_DGRAM, 0, addr_args [i]))
+	{
+	    fprintf (stderr, "Address resolution failed.\n");
+	    exit (1);
+	}
+	S->port = atoi (addr_args [i + 1]);
+	S->dev = 0;
+	i += 2;
+	if (S->Arx.is_multicast ())
+	{
+	    if (i < addr_narg) S->dev = addr_args [i++];
+	}
+	else if ((addr_narg == 3) && (i < addr_narg))
+	{
+	    fprintf (stderr, "Ignored extra argument '%s'.\n", addr_args [i++]);
+	}
+        if ((S->port < 1) || (S->port > 65535))
+        {
+	    fprintf (stderr, "Port number is out of range.\n");
+	    exit (1);
+        }
+        S->Arx.set_port (S->port);
+        S->Asy.set_port (S->port + 1);
+	nstream++;
+    }
+    for (i = 0; i < nstream; i++)
+    {
+	S = streams + i;
+	if (nstream > 1) sprintf (S->pref, "Stream %d: ", i + 1);
+	else S->pref [0] = 0;
+	S->sockfd1 = -1;
+	S->sockfd2 = -1;
+	S->active = false;
+	S->audioq = 0;
+    }
 }
 
 
@@ -181,11 +293,12 @@ static void sigint_handler (int)
 }
 
 
-static bool checkstatus (void)
+static bool checkstatus (Stream *S)
 {
-    int       c, n, m;
-    double    e, r;
-    Infodata *I;
+    int           c, n, m;
+    double        e, r, d, j [3];
+    Infodata     *I;
+    Lfq_infodata *infoq = S->infoq;
 
     n = 0;
     m = 999999999;
@@ -195,48 +308,57 @@ static bool checkstatus (void)
 	I = infoq->rd_datap ();
 	switch (I->_state)
 	{
-	case Jackrx::FATAL:
-	    printf ("Fatal error, terminating.\n");
+	case Rxstream::FATAL:
+	    printf ("%sFatal error, terminating.\n", S->pref);
 	    stop = true;
   	    infoq->rd_commit ();
 	    return true;
-	case Jackrx::TXEND:
-	    printf ("Transmitter terminated.\n");
+	case Rxstream::TXEND:
+	    printf ("%sTransmitter terminated.\n", S->pref);
   	    infoq->rd_commit ();
 	    return true;
-	case Jackrx::WAIT:
-	    printf ("Waiting for %3.1lf seconds...\n", I->_error);
+	case Rxstream::WAIT:
+	    printf ("%sWaiting for %3.1lf seconds...\n", S->pref, I->_error);
   	    infoq->rd_commit ();
 	    return false;
-	case Jackrx::SYNC0:
-            printf ("Syncing...\n");
+	case Rxstream::SYNC0:
+            printf ("%sSyncing...\n", S->pref);
 	    break;
-	case Jackrx::SYNC2:
-            printf ("Receiving.\n");
+	case Rxstream::SYNC2:
+            printf ("%sReceiving.\n", S->pref);
 	    break;
 	}
-	if (info_opt && (I->_state >= Jackrx::PROC1))
+	if (info_opt && (I->_state >= Rxstream::PROC1))
 	{
 	    n++;
 	    e += I->_error;
 	    r += I->_ratio;
             c = I->_syncc;
+	    d = I->_delay;
+	    j [0] = I->_jitt [0];
+	    j [1] = I->_jitt [1];
+	    j [2] = I->_jitt [2];
             if (m > I->_nfram) m = I->_nfram;
 	}
 	infoq->rd_commit ();
     }
-    if (n) printf ("%3d %8.3lf %9.6lf %8d %3d\n", n, e / n, r / n, m, c);
+    if (n)
+    {
+	if (adapt_arg) printf ("%s%3d %8.3lf %9.6lf %8d %3d %6.2lf %6.2lf %6.2lf %6.2lf\n",
+			       S->pref, n, e / n, r / n, m, c, d, j [0], j [1], j [2]);
+	else printf ("%s%3d %8.3lf %9.6lf %8d %3d\n", S->pref, n, e / n, r / n, m, c);
+    }
     return false;
 }
 
 
-static int opensocket (Sockaddr *A)
+static int opensocket (Sockaddr *A, const char *dev)
 {
     int fd = -1;
 
     if (A->is_multicast ())
     {
-	if (dev_arg) fd = sock_open_mcrecv (A, dev_arg);
+	if (dev) fd = sock_open_mcrecv (A, dev);
         else
 	{
 	    fprintf (stderr, "Multicast requires a network device.\n");
@@ -245,7 +367,6 @@ static int opensocket (Sockaddr *A)
     }
     else
     {
-	if (dev_arg) fprintf (stderr, "Ignored extra argument '%s'.\n", dev_arg);
 	fd = sock_open_dgram (0, A);
     }
     if (fd < 0)
@@ -258,18 +379,89 @@ static int opensocket (Sockaddr *A)
 }
 
 
-int main (int ac, char *av [])
+static void openstream (Stream *S)
 {
-    Sockaddr     Arx, Atx, Asy;
-    int          sockfd1, sockfd2, nchan, fsamp, filt;
-    int          tx_psmax, tx_nchan, tx_fsamp, tx_fsize;
-    int          chlist [Netdata::MAXCHAN + 1];
+    S->sockfd1 = opensocket (&S->Arx, S->dev);
+    S->sockfd2 = opensocket (&S->Asy, S->dev);
+    if (gro_opt && sock_set_udp_gro (S->sockfd1, true))
+    {
+	fprintf (stderr, "Warning: UDP receive offload not available.\n");
+	gro_opt = false;
+    }
+    printf ("%sWaiting for info packet...\n", S->pref);
+}
+
+
+static void closestream (Stream *S)
+{
+    sock_close (S->sockfd1);
+    sock_close (S->sockfd2);
+    S->sockfd1 = -1;
+    S->sockfd2 = -1;
+    if (S->active)
+    {
+	usleep (100000);
+        delete S->audioq;
+	S->audioq = 0;
+	S->active = false;
+    }
+}
+
+
+static void startstream (Stream *S, Netdata *packet, Jackrx *jackrx, int nchan, int *chlist)
+{
+    int          fsamp, filt;
+    int          tx_psmax, tx_fsamp, tx_fsize;
     int          k, k_buf, k_del;
     double       t_tx, t_rx, t_buf, t_del;
+
+    tx_psmax = packet->get_psmax ();
+    tx_fsamp = packet->get_fsamp ();
+    tx_fsize = packet->get_fsize ();
+
+    fsamp = jackrx->fsamp ();
+    t_tx = (double) tx_fsize / tx_fsamp;
+    t_rx = (double) jackrx->bsize () / fsamp; 
+    t_buf = t_tx + t_rx + 1e-3 * buff_arg;
+    if (sync_arg) t_del = 1e-3 * sync_arg;    
+    else          t_del = 1e-3 * buff_arg;
+    k_buf = (int)(t_buf * tx_fsamp + 0.5);
+    k_del = (int)(t_del * tx_fsamp + 0.5);
+    for (k = 256; k < 2 * k_buf; k *= 2);
+    S->audioq = new Lfq_audio (k, nchan);
+	
+    if (filt_arg) filt = filt_arg;
+    else
+    {
+        k = (fsamp < tx_fsamp) ? fsamp : tx_fsamp;
+	if (k < 44100) k = 44100;
+	filt = (int)((6.7 * k) / (k - 38000));
+	if (filt < 16) filt = 16;
+  	printf ("%sResampler filter delay is %d.\n", S->pref, filt);
+    }
+
+//    if (sync_arg) syncrx->start (syncq, jackrx->rprio() + 5, S->sockfd2);
+
+    S->netrx->start (S->audioq, S->commq, S->timeq, chlist, 
+   	             tx_psmax, tx_fsamp, tx_fsize, jackrx->rprio() + 5, S->sockfd1, gro_opt);
+
+    S->rxstream->start (S->audioq, S->commq, S->timeq, S->syncq, S->infoq,
+                        (double) fsamp / tx_fsamp, k_del, filt, 1e-6 * dband_arg, adapt_arg);
+    S->active = true;
+}
+
+
+int main (int ac, char *av [])
+{
+    int          i, n, nchan;
+    int          chlist [Netdata::MAXCHAN + 1];
     Netdata      *packet = 0;
     Jackrx       *jackrx = 0;
-    Syncrx       *syncrx = 0;
-    Netrx        *netrx = 0;
+//    Syncrx       *syncrx = 0;
+    Stream       *S;
+    Stream       *W [Jackrx::MAXSTREAM];
+    struct pollfd pfd [Jackrx::MAXSTREAM];
+    Sockaddr     Atx;
     char         s [256];
 
     procoptions (ac, av);
@@ -284,6 +476,11 @@ int main (int ac, char *av [])
 	fprintf (stderr, "Buffer time is out of range.\n");
 	exit (1);
     }
+    if (adapt_arg && ((adapt_arg < 1e-5) || (adapt_arg > 0.1)))
+    {
+	fprintf (stderr, "Dropout probability is out of range.\n");
+	exit (1);
+    }
     if (sync_arg && (sync_arg > buff_arg))
     {
 	fprintf (stderr, "Sync delay too high.\n");
@@ -294,20 +491,12 @@ int main (int ac, char *av [])
 	fprintf (stderr, "Filter delay is out of range.\n");
 	exit (1);
     }
-    if (   Arx.set_addr (AF_INET, SOCK_DGRAM, 0, addr_arg)
-        || Asy.set_addr (AF_INET, SOCK_DGRAM, 0, addr_arg))
-    {
-	fprintf (stderr, "Address resolution failed.\n");
-	exit (1);
-    }
-    if ((port_arg < 1) || (port_arg > 65535))
+    if ((dband_arg < 0) || (dband_arg > 100))
     {
-	fprintf (stderr, "Port number is out of range.\n");
+	fprintf (stderr, "Dead band is out of range.\n");
 	exit (1);
     }
-
-    Arx.set_port (port_arg);
-    Asy.set_port (port_arg + 1);
+    readstreams ();
 
     if (mlockall (MCL_CURRENT | MCL_FUTURE))
     {
@@ -315,89 +504,90 @@ int main (int ac, char *av [])
     }
 
     packet = new Netdata (1500);
-    jackrx = new Jackrx (name_arg, serv_arg, nchan, chlist);
+    jackrx = new Jackrx (name_arg, serv_arg, nchan, chlist, nstream);
 //    syncrx = new Syncrx ();
-    netrx  = new Netrx ();
-    commq = new Lfq_int32 (16);
-    timeq = new Lfq_timedata (256);
-//    syncq = new Lfq_timedata (256);
-    infoq = new Lfq_infodata (256);
+    for (i = 0; i < nstream; i++)
+    {
+	S = streams + i;
+	S->rxstream = jackrx->stream (i);
+	if (lock_opt && i) S->rxstream->set_master (jackrx->stream (0));
+        S->netrx  = new Netrx ();
+        S->commq = new Lfq_int32 (16);
+        S->timeq = new Lfq_timedata (256);
+        S->syncq = 0;
+//      S->syncq = new Lfq_timedata (256);
+        S->infoq = new Lfq_infodata (256);
+    }
     usleep (100000);
 
+    signal (SIGINT, sigint_handler);
     while (! stop)
     {
-        signal (SIGINT, SIG_DFL);
-        sockfd1 = opensocket (&Arx);
-        sockfd2 = opensocket (&Asy);
-	printf ("Waiting for info packet...\n");
-        while (true)
-        {
-	    if (sock_recvfm (sockfd1, packet->data (), packet->size (), &Atx) <= 0)
+	// Wait for info packets on the streams that are not
+	// active, and check the status of the others.
+	n = 0;
+	for (i = 0; i < nstream; i++)
+	{
+	    S = streams + i;
+	    if (S->active) continue;
+	    if (S->sockfd1 < 0) openstream (S);
+	    W [n] = S;
+	    pfd [n].fd = S->sockfd1;
+	    pfd [n].events = POLLIN;
+	    n++;
+	}
+	if (n)
+	{
+	    if (poll (pfd, n, 250) < 0) continue;
+	}
+	else usleep (250000);
+
+	for (i = 0; i < n; i++)
+	{
+	    S = W [i];
+	    if (! pfd [i].revents) continue;
+	    if (sock_recvfm (S->sockfd1, packet->data (), packet->size (), &Atx) <= 0)
   	    {
-  	        fprintf (stderr, "Fatal error on socket.\n");
-	        sock_close (sockfd1);
-	        sock_close (sockfd2);
+  	        fprintf (stderr, "%sFatal error on socket.\n", S->pref);
 		stop = true;
 		break;
 	    }
   	    if (packet->check_ptype () == Netdata::TY_ADESC)
 	    {
                 Atx.get_addr (s, 256);
- 	        tx_psmax = packet->get_psmax ();
-                tx_nchan = packet->get_nchan ();
-                tx_fsamp = packet->get_fsamp ();
-                tx_fsize = packet->get_fsize ();
-                printf ("From %s : %d chan, %d Hz\n", s, tx_nchan, tx_fsamp);
-	        break;
+                printf ("%sFrom %s : %d chan, %d Hz\n", S->pref, s, packet->get_nchan (), packet->get_fsamp ());
+		startstream (S, packet, jackrx, nchan, chlist);
 	    }
-        }
-	if (stop) break;
-
-	fsamp = jackrx->fsamp ();
-        t_tx = (double) tx_fsize / tx_fsamp;
-        t_rx = (double) jackrx->bsize () / fsamp; 
-        t_buf = t_tx + t_rx + 1e-3 * buff_arg;
-        if (sync_arg) t_del = 1e-3 * sync_arg;    
-        else          t_del = 1e-3 * buff_arg;
-        k_buf = (int)(t_buf * tx_fsamp + 0.5);
-	k_del = (int)(t_del * tx_fsamp + 0.5);
-	for (k = 256; k < 2 * k_buf; k *= 2);
-        audioq = new Lfq_audio (k, nchan);
-	
-	if (filt_arg) filt = filt_arg;
-	else
-	{
-  	    k = (fsamp < tx_fsamp) ? fsamp : tx_fsamp;
-	    if (k < 44100) k = 44100;
-	    filt = (int)((6.7 * k) / (k - 38000));
-	    if (filt < 16) filt = 16;
-  	    printf ("Resampler filter delay is %d.\n", filt);
 	}
 
-//        if (sync_arg) syncrx->start (syncq, jackrx->rprio() + 5, sockfd2);
-
-        netrx->start (audioq, commq, timeq, chlist, 
-	   	      tx_psmax, tx_fsamp, tx_fsize, jackrx->rprio() + 5, sockfd1);
-
-        jackrx->start (audioq, commq, timeq, syncq, infoq,
-                       (double) jackrx->fsamp () / tx_fsamp, k_del, filt);
-
-        signal (SIGINT, sigint_handler);
-        while (! (stop || checkstatus ())) usleep (250000);
-
-        sock_close (sockfd1);
-        sock_close (sockfd2);
-	usleep (100000);
-        delete audioq;
+	for (i = 0; (i < nstream) && ! stop; i++)
+	{
+	    S = streams + i;
+	    if (S->active && checkstatus (S)) closestream (S);
+	}
     }
 
-    delete commq;
-    delete timeq;
-    delete syncq;
-    delete infoq;
-    delete netrx;
-    delete syncrx;
+    // Stop the netrx threads, and the Jack client
+    // before deleting the audio queues.
+    for (i = 0; i < nstream; i++)
+    {
+	S = streams + i;
+        if (S->sockfd1 >= 0) sock_close (S->sockfd1);
+        if (S->sockfd2 >= 0) sock_close (S->sockfd2);
+    }
+    usleep (100000);
     delete jackrx;
+    for (i = 0; i < nstream; i++)
+    {
+	S = streams + i;
+        delete S->audioq;
+        delete S->commq;
+        delete S->timeq;
+        delete S->syncq;
+        delete S->infoq;
+        delete S->netrx;
+    }
+//    delete syncrx;
     delete packet;
 
     return 0;
@@ -27,6 +27,9 @@
 #include <sys/ioctl.h>
 #include <sys/un.h>
 #include <netinet/tcp.h>
+#ifdef __linux__
+#include <netinet/udp.h>
+#endif
 #ifdef __APPLE__
 #include <netinet/in.h>
 #endif
@@ -487,6 +490,32 @@ int sock_set_read_buffer (int fd, size_t size)
 }
 
 
+// UDP segmentation and receive offload, Linux only.
+// A zero segment size only checks if GSO is supported.
+//
+int sock_set_udp_segment (int fd, int size)
+{
+#ifdef UDP_SEGMENT
+    return setsockopt (fd, SOL_UDP, UDP_SEGMENT, (char*) &size, sizeof (size));
+#else
+    errno = ENOPROTOOPT;
+    return -1;
+#endif
+}
+
+
+int sock_set_udp_gro (int fd, bool flag)
+{
+#ifdef UDP_GRO
+    int ipar = flag;
+    return setsockopt (fd, SOL_UDP, UDP_GRO, (char*) &ipar, sizeof (ipar));
+#else
+    errno = ENOPROTOOPT;
+    return -1;
+#endif
+}
+
+
 int sock_write (int fd, void* data, size_t size, size_t min)
 {
     int    n;
@@ -63,6 +63,8 @@ extern int sock_set_close_on_exec (int fd, bool flag);
 extern int sock_set_no_delay (int fd, bool flag);
 extern int sock_set_write_buffer (int fd, size_t size);
 extern int sock_set_read_buffer (int fd, size_t size);
+extern int sock_set_udp_segment (int fd, int size);
+extern int sock_set_udp_gro (int fd, bool flag);
 
 extern int sock_write (int fd, void* data, size_t size, size_t min);
 extern int sock_read (int fd, void* data, size_t size, size_t min);